@@ -69,7 +69,7 @@ static void GEMMBenchmark(benchmark::State& state,
   std::vector<char, AlignedAllocator<char, 32>> w(w_size * num_buffers);
   std::fill(w.begin(), w.end(), 0);
   const xnn_qs8_packing_params packing_params = { 127 };
-  xnn_pack_qs8_gemm_goi_w(1 /* groups */, nc, kc, nr, kr, sr, k.data(), b.data(), w.data(), &packing_params);
+  xnn_pack_qs8_gemm_goi_w(1 /* groups */, nc, kc, nr, kr, sr, k.data(), b.data(), w.data(), 0, &packing_params);
   std::vector<int8_t> c(c_elements * num_buffers);
   std::fill(c.begin(), c.end(), 0xA5);
 
@@ -150,7 +150,7 @@ static void GEMMBenchmark(benchmark::State& state,
   std::vector<char, AlignedAllocator<char, 32>> w(w_size * num_buffers);
   std::fill(w.begin(), w.end(), 0);
   const xnn_qs8_packing_params packing_params = { 127 };
-  xnn_pack_qs8_gemm_xw_goi_w(1 /* groups */, nc, kc, nr, kr, sr, k.data(), b.data(), w.data(), &packing_params);
+  xnn_pack_qs8_gemm_xw_goi_w(1 /* groups */, nc, kc, nr, kr, sr, k.data(), b.data(), w.data(), 0, &packing_params);
   std::vector<int8_t> c(c_elements * num_buffers);
   std::fill(c.begin(), c.end(), 0xA5);
 
@@ -23,6 +23,78 @@
 #include "tensorflow/lite/version.h"
 #endif  // BENCHMARK_TENSORFLOW_LITE
 
+#ifndef XNN_NO_QS8_OPERATORS
+static void xnnpack_softmax_qs8(benchmark::State& state) {
+  const size_t batch_size = static_cast<size_t>(state.range(0));
+  const size_t channels = static_cast<size_t>(state.range(1));
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto i8rng = std::bind(
+    std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+    std::ref(rng));
+
+  std::vector<int8_t> input(batch_size * channels);
+  std::vector<int8_t> output(batch_size * channels);
+  std::generate(input.begin(), input.end(), std::ref(i8rng));
+  std::fill(output.begin(), output.end(), 0xA5);
+
+  xnn_status status = xnn_initialize(nullptr /* allocator */);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to initialize XNNPACK");
+    return;
+  }
+
+  xnn_operator_t softmax_op = nullptr;
+  status = xnn_create_softmax_nc_qs8(
+    channels, channels /* input stride */, channels /* output stride */,
+    1.0f /* input scale */,
+    -128 /* output zero point */, 1.0f / 256.0f /* output scale */,
+    0 /* flags */, &softmax_op);
+  if (status != xnn_status_success || softmax_op == nullptr) {
+    state.SkipWithError("failed to create SoftMax operator");
+    return;
+  }
+
+  status = xnn_setup_softmax_nc_qs8(
+    softmax_op,
+    batch_size,
+    input.data(), output.data(),
+    nullptr /* thread pool */);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to setup SoftMax operator");
+    return;
+  }
+
+  for (auto _ : state) {
+    status = xnn_run_operator(softmax_op, nullptr /* thread pool */);
+    if (status != xnn_status_success) {
+      state.SkipWithError("failed to run SoftMax operator");
+      return;
+    }
+  }
+
+  status = xnn_delete_operator(softmax_op);
+  if (status != xnn_status_success) {
+    state.SkipWithError("failed to delete SoftMax operator");
+    return;
+  }
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+
+  const size_t elements_per_iteration = batch_size * channels;
+  state.counters["elements"] =
+    benchmark::Counter(uint64_t(state.iterations()) * elements_per_iteration, benchmark::Counter::kIsRate);
+
+  const size_t bytes_per_iteration = 2 * elements_per_iteration * sizeof(int8_t);
+  state.counters["bytes"] =
+    benchmark::Counter(uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+}
+#endif  // XNN_NO_QS8_OPERATORS
+
 #ifndef XNN_NO_QU8_OPERATORS
 static void xnnpack_softmax_qu8(benchmark::State& state) {
   const size_t batch_size = static_cast<size_t>(state.range(0));
@@ -296,6 +368,9 @@ static void CharacteristicArguments(benchmark::internal::Benchmark* b)
   b->Args({257 * 257, 151});
 }
 
+#ifndef XNN_NO_QS8_OPERATORS
+BENCHMARK(xnnpack_softmax_qs8)->Apply(CharacteristicArguments)->UseRealTime();
+#endif  // XNN_NO_QS8_OPERATORS
 #ifndef XNN_NO_QU8_OPERATORS
 BENCHMARK(xnnpack_softmax_qu8)->Apply(CharacteristicArguments)->UseRealTime();
 #endif  // XNN_NO_QU8_OPERATORS
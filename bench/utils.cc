@@ -272,5 +272,13 @@ bool CheckAVX512SKX(benchmark::State& state) {
   return true;
 }
 
+bool CheckAVX512VBMI(benchmark::State& state) {
+  if (!cpuinfo_initialize() || !cpuinfo_has_x86_avx512bw() || !cpuinfo_has_x86_avx512vbmi()) {
+    state.SkipWithError("no AVX512VBMI extension");
+    return false;
+  }
+  return true;
+}
+
 }  // namespace utils
 }  // namespace benchmark
@@ -83,6 +83,10 @@ bool CheckAVX512F(benchmark::State& state);
 // If SKX-level AVX512 extensions are unsupported, report error in benchmark state, and return false.
 bool CheckAVX512SKX(benchmark::State& state);
 
+// Check if x86 AVX512VBMI extension (together with AVX512BW) is supported.
+// If AVX512VBMI is unsupported, report error in benchmark state, and return false.
+bool CheckAVX512VBMI(benchmark::State& state);
+
 template <class T>
 inline T DivideRoundUp(T x, T q) {
   return x / q + T(x % q != 0);
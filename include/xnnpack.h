@@ -32,12 +32,44 @@ extern "C" {
 /// Note: this flag forces XNNPACK to consider sparse inference, but does not guarantee it.
 #define XNN_FLAG_SPARSE_INFERENCE 0x00000001
 
+/// Run independent small operators of a Runtime concurrently on the threads of its thread pool.
+///
+/// Note: operators which run concurrently with other operators are single-threaded. Large operators still run one at a
+/// time on the whole thread pool. The flag benefits graphs with many small independent branches.
+///
+/// Note: the flag disables in-place memory planning: the outputs of elementwise operators never reuse the memory of
+/// their inputs, so the Runtime may need a larger Workspace than without the flag.
+#define XNN_FLAG_INTER_OPERATOR_PARALLELISM 0x00000002
+
+/// Record the wall time of every operator run in a Runtime, to be queried with xnn_get_runtime_profile.
+#define XNN_FLAG_BASIC_PROFILING 0x00000004
+
+/// Run Fully Connected nodes with fp32 weights in a Runtime on weights quantized to signed 8-bit values per output
+/// channel, and inputs dynamically quantized to signed 8-bit values per row.
+///
+/// Note: the flag trades accuracy for speed and 4X smaller weights, and benefits models bound by the bandwidth of
+/// loading large Fully Connected weights. The flag is ignored on hardware without optimized micro-kernels for
+/// dynamically quantized inputs.
+#define XNN_FLAG_DYNAMIC_RANGE_QUANTIZATION 0x00000008
+
+/// Run F32 Nodes of a Runtime with F16 operators where the hardware supports them, and F16 operators exist.
+///
+/// Static filters and biases are converted to half precision when the Runtime is created, and Convert Nodes are
+/// inserted between F16 and F32 Nodes and on the F32 external inputs and outputs.
+///
+/// Note: the flag halves the memory footprint of weights and intermediate tensors at the cost of accuracy, and is
+/// ignored on hardware without F16 operators.
+#define XNN_FLAG_FP16_INFERENCE 0x00000010
+
 /// The convolution operator represents a depthwise convolution, and use HWGo layout for filters.
 #define XNN_FLAG_DEPTHWISE_CONVOLUTION 0x00000001
 
 /// Assume transposed weights in a fully connected operator.
 #define XNN_FLAG_TRANSPOSE_WEIGHTS 0x00000001
 
+/// Assume transposed second input in a batch matrix multiply operator.
+#define XNN_FLAG_TRANSPOSE_B XNN_FLAG_TRANSPOSE_WEIGHTS
+
 /// The operator assumes NHWC layout for the input, regardless of the output layout.
 #define XNN_FLAG_INPUT_NHWC 0x00000002
 
@@ -54,6 +86,10 @@ extern "C" {
 /// Align corners of input and output images in resize operations.
 #define XNN_FLAG_ALIGN_CORNERS 0x00000008
 
+/// Apply HardSwish activation function to the output of a Convolution or Fully Connected operator.
+/// Only supported for F32 operators with unbounded output range.
+#define XNN_FLAG_FUSED_HARDSWISH 0x00000010
+
 /// Status code for any XNNPACK function call.
 enum xnn_status {
   /// The call succeeded, and all output arguments now contain valid data.
@@ -529,6 +565,28 @@ enum xnn_status xnn_define_fully_connected(xnn_subgraph_t subgraph,
                                            uint32_t filter_id, uint32_t bias_id,
                                            uint32_t output_id, uint32_t flags);
 
+/// Define a Batch Matrix Multiply Node and add it to a Subgraph.
+///
+/// The Node computes C[..., m, n] = sum_k A[..., m, k] * B[..., k, n] for every matrix in the batch, with both matrix
+/// operands produced at inference time (e.g. attention scores or context in Transformer models).
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input1_id - Value ID for the first input tensor (A). The input tensor must be an N-dimensional tensor
+///                    defined in the @a subgraph with N >= 2 and [..., M, K] dimensions.
+/// @param input2_id - Value ID for the second input tensor (B). The input tensor must be an N-dimensional tensor
+///                    defined in the @a subgraph with the same batch dimensions as the first input, and
+///                    [..., K, N] dimensions, or [..., N, K] dimensions if XNN_FLAG_TRANSPOSE_B is specified.
+/// @param output_id - Value ID for the output tensor. The output tensor must be an N-dimensional tensor defined in the
+///                    @a subgraph with the same batch dimensions as the inputs and [..., M, N] dimensions.
+/// @param flags - binary features of the Batch Matrix Multiply Node. The only currently supported value is
+///                XNN_FLAG_TRANSPOSE_B.
+enum xnn_status xnn_define_batch_matrix_multiply(
+  xnn_subgraph_t subgraph,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a 2D Max Pooling Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -857,6 +915,168 @@ enum xnn_status xnn_define_static_reshape(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Transpose Node with static permutation specification and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_dims - number of dimensions in the input and output tensors.
+/// @param perm - permutation of the input dimensions: dimension #i of the output tensor is dimension #perm[i] of the
+///               input tensor. This array must have as many elements as the number of dimensions in the input tensor,
+///               and contain each of the values [0, num_dims-1] exactly once.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a num_dims-dimensional tensor defined in
+///                   the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be a num_dims-dimensional tensor defined
+///                    in the @a subgraph with dimensions of the input tensor permuted according to @a perm.
+/// @param flags - binary features of the Transpose Node. No supported flags are currently defined.
+enum xnn_status xnn_define_static_transpose(
+  xnn_subgraph_t subgraph,
+  size_t num_dims,
+  const size_t* perm,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a 2-Input Concatenate Node and add it to a Subgraph.
+///
+/// The 2-Input Concatenate Node concatenates two tensors along the innermost (channel) dimension. The Node doesn't
+/// copy data when the inputs are produced by operators which can write their output with a channel stride: the
+/// producers write directly into their slices of the output tensor.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input1_id - Value ID for the first input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph.
+/// @param input2_id - Value ID for the second input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with the same dimensions as the first input, except for the innermost dimension.
+/// @param output_id - Value ID for the output tensor. The output tensor must be an N-dimensional tensor defined in the
+///                    @a subgraph with the same dimensions as the inputs, except for the innermost dimension, which
+///                    must equal the sum of the innermost dimensions of the inputs.
+/// @param flags - binary features of the Concatenate Node. No supported flags are currently defined.
+enum xnn_status xnn_define_concatenate2(
+  xnn_subgraph_t subgraph,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a 3-Input Concatenate Node and add it to a Subgraph.
+///
+/// The 3-Input Concatenate Node concatenates three tensors along the innermost (channel) dimension.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input1_id - Value ID for the first input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph.
+/// @param input2_id - Value ID for the second input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with the same dimensions as the first input, except for the innermost dimension.
+/// @param input3_id - Value ID for the third input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with the same dimensions as the first input, except for the innermost dimension.
+/// @param output_id - Value ID for the output tensor. The output tensor must be an N-dimensional tensor defined in the
+///                    @a subgraph with the same dimensions as the inputs, except for the innermost dimension, which
+///                    must equal the sum of the innermost dimensions of the inputs.
+/// @param flags - binary features of the Concatenate Node. No supported flags are currently defined.
+enum xnn_status xnn_define_concatenate3(
+  xnn_subgraph_t subgraph,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t input3_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a 4-Input Concatenate Node and add it to a Subgraph.
+///
+/// The 4-Input Concatenate Node concatenates four tensors along the innermost (channel) dimension.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input1_id - Value ID for the first input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph.
+/// @param input2_id - Value ID for the second input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with the same dimensions as the first input, except for the innermost dimension.
+/// @param input3_id - Value ID for the third input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with the same dimensions as the first input, except for the innermost dimension.
+/// @param input4_id - Value ID for the fourth input tensor. The input tensor must be an N-dimensional tensor defined in
+///                    the @a subgraph with the same dimensions as the first input, except for the innermost dimension.
+/// @param output_id - Value ID for the output tensor. The output tensor must be an N-dimensional tensor defined in the
+///                    @a subgraph with the same dimensions as the inputs, except for the innermost dimension, which
+///                    must equal the sum of the innermost dimensions of the inputs.
+/// @param flags - binary features of the Concatenate Node. No supported flags are currently defined.
+enum xnn_status xnn_define_concatenate4(
+  xnn_subgraph_t subgraph,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t input3_id,
+  uint32_t input4_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a 2-Output Split Node and add it to a Subgraph.
+///
+/// The 2-Output Split Node splits a tensor into two tensors along the innermost (channel) dimension. The Node doesn't
+/// copy data when the outputs are consumed by operators which can read their input with a channel stride: the
+/// consumers read their slices directly from the input tensor.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph.
+/// @param output1_id - Value ID for the first output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with the same dimensions as the input, except for the innermost dimension.
+/// @param output2_id - Value ID for the second output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with the same dimensions as the input, except for the innermost dimension.
+///                     The innermost dimensions of the outputs must add up to the innermost dimension of the input.
+/// @param flags - binary features of the Split Node. No supported flags are currently defined.
+enum xnn_status xnn_define_split2(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output1_id,
+  uint32_t output2_id,
+  uint32_t flags);
+
+/// Define a 3-Output Split Node and add it to a Subgraph.
+///
+/// The 3-Output Split Node splits a tensor into three tensors along the innermost (channel) dimension.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph.
+/// @param output1_id - Value ID for the first output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with the same dimensions as the input, except for the innermost dimension.
+/// @param output2_id - Value ID for the second output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with the same dimensions as the input, except for the innermost dimension.
+/// @param output3_id - Value ID for the third output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with the same dimensions as the input, except for the innermost dimension.
+///                     The innermost dimensions of the outputs must add up to the innermost dimension of the input.
+/// @param flags - binary features of the Split Node. No supported flags are currently defined.
+enum xnn_status xnn_define_split3(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output1_id,
+  uint32_t output2_id,
+  uint32_t output3_id,
+  uint32_t flags);
+
+/// Define a 4-Output Split Node and add it to a Subgraph.
+///
+/// The 4-Output Split Node splits a tensor into four tensors along the innermost (channel) dimension.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph.
+/// @param output1_id - Value ID for the first output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with the same dimensions as the input, except for the innermost dimension.
+/// @param output2_id - Value ID for the second output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with the same dimensions as the input, except for the innermost dimension.
+/// @param output3_id - Value ID for the third output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with the same dimensions as the input, except for the innermost dimension.
+/// @param output4_id - Value ID for the fourth output tensor. The output tensor must be an N-dimensional tensor defined
+///                     in the @a subgraph with the same dimensions as the input, except for the innermost dimension.
+///                     The innermost dimensions of the outputs must add up to the innermost dimension of the input.
+/// @param flags - binary features of the Split Node. No supported flags are currently defined.
+enum xnn_status xnn_define_split4(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output1_id,
+  uint32_t output2_id,
+  uint32_t output3_id,
+  uint32_t output4_id,
+  uint32_t flags);
+
 /// Define a 2D Resize Bilinear Node with static output height & width specification and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -949,6 +1169,22 @@ enum xnn_status xnn_define_clamp(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Convert Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor. Either the input or the output tensor must have
+///                    the FP32 datatype, and the other tensor must have the FP16 or QINT8 datatype. QINT8 tensors are
+///                    converted with their quantization parameters: FP32 to QINT8 conversion rounds to nearest-even
+///                    and saturates to the range of the datatype.
+/// @param flags - binary features of the Convert Node. No supported flags are currently defined.
+enum xnn_status xnn_define_convert(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define an ELU (Exponential Linear Unit) Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1071,16 +1307,147 @@ enum xnn_status xnn_define_square_root(
   uint32_t output_id,
   uint32_t flags);
 
+/// Workspace is a memory arena for the internal Values of one or more Runtime objects.
+///
+/// Runtime objects which share a Workspace must not be set up or invoked concurrently: an internal Value of one Runtime
+/// may be overwritten by an invocation of another Runtime sharing the same Workspace.
+///
+/// The Workspace is not thread-safe. Runtime objects which share a Workspace must be created, reshaped, and deleted,
+/// and the Workspace must be released, on one thread (or with external synchronization): these calls grow the
+/// Workspace memory and update its reference count without locking.
+typedef struct xnn_workspace* xnn_workspace_t;
+
+/// Create a Workspace object.
+///
+/// @param workspace_out - pointer to the variable that will be initialized with a handle to the Workspace object upon
+///                        successful return. The Workspace object starts empty and grows when Runtime objects are
+///                        created with it.
+enum xnn_status xnn_create_workspace(xnn_workspace_t* workspace_out);
+
+/// Release a Workspace object.
+///
+/// The memory of the Workspace is freed once the Workspace is released and all Runtime objects created with it are
+/// deleted.
+///
+/// @param workspace - the Workspace object to release.
+enum xnn_status xnn_release_workspace(xnn_workspace_t workspace);
+
+/// Weights cache deduplicates the packed weights of operators across one or more Runtime objects.
+///
+/// Convolution, deconvolution, and fully connected operators look up their packed weights in the Weights cache by their
+/// raw weights and packing configuration before packing, so operators with identical weights (e.g. the same model
+/// loaded into several Runtime objects) skip packing and share a single copy of the packed weights. The Weights cache
+/// is thread-safe: Runtime objects using it may be created and deleted concurrently from different threads.
+typedef struct xnn_weights_cache* xnn_weights_cache_t;
+
+/// Create a Weights cache object.
+///
+/// @param weights_cache_out - pointer to the variable that will be initialized with a handle to the Weights cache
+///                            object upon successful return.
+enum xnn_status xnn_create_weights_cache(xnn_weights_cache_t* weights_cache_out);
+
+/// Release a Weights cache object.
+///
+/// The memory of the Weights cache is freed once the Weights cache is released and all Runtime objects created with
+/// it are deleted.
+///
+/// @param weights_cache - the Weights cache object to release.
+enum xnn_status xnn_release_weights_cache(xnn_weights_cache_t weights_cache);
+
+/// Save the packed weights of a Weights cache to a file.
+///
+/// The file holds the packed weights of the convolution, deconvolution, and fully connected operators created with
+/// the Weights cache, keyed by their raw weights and packing configuration. The packed weights are specific to the
+/// micro-kernel configuration of the processor: the file can only be loaded on processors with the same configuration.
+///
+/// @param weights_cache - the Weights cache object to save.
+/// @param filename - path of the file to create or overwrite. The file must not be the one the Weights cache was loaded
+///                   from.
+/// @retval xnn_status_invalid_parameter - the file can't be written, or is the file the Weights cache was loaded from.
+enum xnn_status xnn_save_weights_cache(
+  xnn_weights_cache_t weights_cache,
+  const char* filename);
+
+/// Create a Weights cache object from a memory mapping of a file saved with @ref xnn_save_weights_cache.
+///
+/// Operators created with the loaded Weights cache use the packed weights directly from the mapping, and skip packing
+/// when their raw weights and packing configuration match an entry in the file. Processes loading the same file share
+/// the packed weights through the page cache. The file must not be modified while the Weights cache exists.
+///
+/// @param filename - path of the file to load.
+/// @param weights_cache_out - pointer to the variable that will be initialized with a handle to the Weights cache
+///                            object upon successful return.
+/// @retval xnn_status_invalid_parameter - the file can't be mapped, is not a weights cache file, or is truncated.
+/// @retval xnn_status_unsupported_parameter - the file was saved by a version of XNNPACK with a different file format,
+///                                            or on a processor with a different micro-kernel configuration.
+enum xnn_status xnn_load_weights_cache(
+  const char* filename,
+  xnn_weights_cache_t* weights_cache_out);
+
 /// Runtime is a combination of an execution plan for subgraph Nodes and a memory manager for subgraph Values.
 typedef struct xnn_runtime* xnn_runtime_t;
 
+/// Create a Runtime object from a subgraph, with internal Values allocated in a (possibly shared) Workspace.
+///
+/// @param subgraph - a Subgraph object with all Values and Nodes that would be handled by the runtime. No Values or
+///                   Nodes can be added to the runtime once it is constructed.
+/// @param workspace - a Workspace object to hold the internal Values of the runtime. The Workspace grows if it is
+///                    smaller than needed for the runtime, which invalidates the setup of the other Runtime objects
+///                    sharing it: they must be set up again with @ref xnn_setup_runtime before their next invocation.
+///                    If the Workspace is NULL, the runtime allocates a private Workspace.
+/// @param threadpool - the thread pool to be used for parallelisation of computations in the runtime, and for packing
+///                     of weights when the runtime is created. If the thread pool is NULL, the computation would run
+///                     on the caller thread without parallelization.
+/// @param flags - binary features of the runtime. The currently supported values are XNN_FLAG_SPARSE_INFERENCE,
+///                XNN_FLAG_INTER_OPERATOR_PARALLELISM, XNN_FLAG_BASIC_PROFILING,
+///                XNN_FLAG_DYNAMIC_RANGE_QUANTIZATION and XNN_FLAG_FP16_INFERENCE, and their combinations.
+/// @param runtime_out - pointer to the variable that will be initialized with a handle to the Runtime object upon
+///                      successful return. Once constructed, the Runtime object is independent of the Subgraph object
+///                      used to create it.
+enum xnn_status xnn_create_runtime_v3(
+  xnn_subgraph_t subgraph,
+  xnn_workspace_t workspace,
+  pthreadpool_t threadpool,
+  uint32_t flags,
+  xnn_runtime_t* runtime_out);
+
+/// Create a Runtime object from a subgraph, with packed weights shared through a Weights cache, and internal Values
+/// allocated in a (possibly shared) Workspace.
+///
+/// @param subgraph - a Subgraph object with all Values and Nodes that would be handled by the runtime. No Values or
+///                   Nodes can be added to the runtime once it is constructed.
+/// @param weights_cache - a Weights cache object to share the packed weights of the runtime operators with other
+///                        Runtime objects. If the Weights cache is NULL, the runtime operators own their packed
+///                        weights.
+/// @param workspace - a Workspace object to hold the internal Values of the runtime. If the Workspace is NULL, the
+///                    runtime allocates a private Workspace. See @ref xnn_create_runtime_v3 for details.
+/// @param threadpool - the thread pool to be used for parallelisation of computations in the runtime, and for packing
+///                     of weights when the runtime is created. If the thread pool is NULL, the computation would run
+///                     on the caller thread without parallelization.
+/// @param flags - binary features of the runtime. The currently supported values are XNN_FLAG_SPARSE_INFERENCE,
+///                XNN_FLAG_INTER_OPERATOR_PARALLELISM, XNN_FLAG_BASIC_PROFILING,
+///                XNN_FLAG_DYNAMIC_RANGE_QUANTIZATION and XNN_FLAG_FP16_INFERENCE, and their combinations.
+/// @param runtime_out - pointer to the variable that will be initialized with a handle to the Runtime object upon
+///                      successful return. Once constructed, the Runtime object is independent of the Subgraph object
+///                      used to create it.
+enum xnn_status xnn_create_runtime_v4(
+  xnn_subgraph_t subgraph,
+  xnn_weights_cache_t weights_cache,
+  xnn_workspace_t workspace,
+  pthreadpool_t threadpool,
+  uint32_t flags,
+  xnn_runtime_t* runtime_out);
+
 /// Create a Runtime object from a subgraph.
 ///
 /// @param subgraph - a Subgraph object with all Values and Nodes that would be handled by the runtime. No Values or
 ///                   Nodes can be added to the runtime once it is constructed.
-/// @param threadpool - the thread pool to be used for parallelisation of computations in the runtime. If the thread
-///                     pool is NULL, the computation would run on the caller thread without parallelization.
-/// @param flags - binary features of the runtime. The only currently supported value is XNN_FLAG_SPARSE_INFERENCE.
+/// @param threadpool - the thread pool to be used for parallelisation of computations in the runtime, and for packing
+///                     of weights when the runtime is created. If the thread pool is NULL, the computation would run
+///                     on the caller thread without parallelization.
+/// @param flags - binary features of the runtime. The currently supported values are XNN_FLAG_SPARSE_INFERENCE,
+///                XNN_FLAG_INTER_OPERATOR_PARALLELISM, XNN_FLAG_BASIC_PROFILING,
+///                XNN_FLAG_DYNAMIC_RANGE_QUANTIZATION and XNN_FLAG_FP16_INFERENCE, and their combinations.
 /// @param runtime_out - pointer to the variable that will be initialized with a handle to the Runtime object upon
 ///                      successful return. Once constructed, the Runtime object is independent of the Subgraph object
 ///                      used to create it.
@@ -1099,9 +1466,53 @@ struct xnn_external_value {
   void* data;
 };
 
+/// Change the shape of an external input Value in a Runtime object.
+///
+/// The new shape takes effect in the next call to @ref xnn_reshape_runtime.
+///
+/// @param runtime - a Runtime object created with @ref xnn_create_runtime, @ref xnn_create_runtime_v2, or
+///                  @ref xnn_create_runtime_v3.
+/// @param external_id - the ID of an external input Value in the Runtime object.
+/// @param num_dims - number of dimensions in the new shape. Must match the number of dimensions of the Value.
+/// @param dims - new shape dimensions. The last (channel) dimension must match the channel dimension of the Value, and
+///               all dimensions must be non-zero.
+enum xnn_status xnn_reshape_external_value(
+  xnn_runtime_t runtime,
+  uint32_t external_id,
+  size_t num_dims,
+  const size_t* dims);
+
+/// Get the current shape of an external input or output Value in a Runtime object.
+///
+/// @param runtime - a Runtime object created with @ref xnn_create_runtime, @ref xnn_create_runtime_v2, or
+///                  @ref xnn_create_runtime_v3.
+/// @param external_id - the ID of an external input or output Value in the Runtime object.
+/// @param num_dims - pointer to the variable that will be initialized with the number of dimensions in the shape.
+/// @param dims - pointer to an array of at least XNN_MAX_TENSOR_DIMS elements that will be initialized with the shape
+///               dimensions.
+enum xnn_status xnn_get_external_value_shape(
+  xnn_runtime_t runtime,
+  uint32_t external_id,
+  size_t* num_dims,
+  size_t* dims);
+
+/// Propagate the shapes of external inputs through all Nodes of a Runtime object, and re-plan its memory.
+///
+/// Operators and their packed weights are reused. The Workspace of the Runtime object grows if it is smaller than
+/// needed, which invalidates the setup of other Runtime objects sharing it. The Runtime object must be set up again
+/// with @ref xnn_setup_runtime before its next invocation, and the shapes of external outputs can be queried with
+/// @ref xnn_get_external_value_shape. If the call fails, the shapes of the Runtime object are inconsistent and it must
+/// not be set up until a call to this function succeeds.
+///
+/// @param runtime - a Runtime object created with @ref xnn_create_runtime, @ref xnn_create_runtime_v2, or
+///                  @ref xnn_create_runtime_v3.
+enum xnn_status xnn_reshape_runtime(
+  xnn_runtime_t runtime);
+
 /// Setup data pointers for external inputs and outputs in a Runtime object.
 ///
-/// @param runtime - a Runtime object created with @ref xnn_create_runtime or @ref xnn_create_runtime_v2.
+/// @param runtime - a Runtime object created with @ref xnn_create_runtime, @ref xnn_create_runtime_v2, or
+///                  @ref xnn_create_runtime_v3.
 /// @param num_external_values - the number of external inputs and outputs specified in this call. This number must
 ///                              match the number of external inputs and outputs in the runtime, i.e. all external
 ///                              inputs and outputs in the runtime must be specified in one call.
@@ -1117,6 +1528,43 @@ enum xnn_status xnn_setup_runtime(
 enum xnn_status xnn_invoke_runtime(
   xnn_runtime_t runtime);
 
+/// Profiling information of an operator in a Runtime object.
+struct xnn_operator_profile {
+  /// Name of the operator type.
+  const char* operator_name;
+  /// ID of the subgraph Node implemented by the operator. Operators which the runtime inserts for a Node, e.g. Copy
+  /// operators for the inputs of a Concatenate Node, report the ID of that Node.
+  uint32_t node_id;
+  /// Number of dimensions in the current shape of the first input of the operator.
+  size_t num_input_dims;
+  /// Current shape of the first input of the operator.
+  size_t input_dims[XNN_MAX_TENSOR_DIMS];
+  /// Number of dimensions in the current shape of the first output of the operator.
+  size_t num_output_dims;
+  /// Current shape of the first output of the operator.
+  size_t output_dims[XNN_MAX_TENSOR_DIMS];
+  /// Number of runs of the operator since the creation of the Runtime object.
+  uint64_t num_runs;
+  /// Wall time of the last run of the operator, in nanoseconds.
+  uint64_t last_time_ns;
+  /// Cumulative wall time of all runs of the operator, in nanoseconds.
+  uint64_t total_time_ns;
+};
+
+/// Get profiling information of the operators in a Runtime object created with XNN_FLAG_BASIC_PROFILING.
+///
+/// @param runtime - a Runtime object created with XNN_FLAG_BASIC_PROFILING.
+/// @param max_operators - the number of elements in the @a operator_profiles array.
+/// @param operator_profiles - an array to fill with the profiling information of the operators in execution order, or
+///                            NULL to only query the number of operators.
+/// @param num_operators_out - pointer to the variable that will be initialized with the number of operators in the
+///                            Runtime object. Nodes fused into other operators have no operators of their own.
+enum xnn_status xnn_get_runtime_profile(
+  xnn_runtime_t runtime,
+  size_t max_operators,
+  struct xnn_operator_profile* operator_profiles,
+  size_t* num_operators_out);
+
 /// Destroy a Runtime object, as well as operators and memory associated with it.
 ///
 /// @param runtime - the Runtime object to destroy.
@@ -1214,6 +1662,21 @@ enum xnn_status xnn_setup_average_pooling2d_nhwc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_batch_matrix_multiply_nc_f32(
+  uint32_t flags,
+  xnn_operator_t* batch_matrix_multiply_op_out);
+
+enum xnn_status xnn_setup_batch_matrix_multiply_nc_f32(
+  xnn_operator_t batch_matrix_multiply_op,
+  size_t batch_size,
+  size_t m,
+  size_t k,
+  size_t n,
+  const float* input_a,
+  const float* input_b,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_bankers_rounding_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -1810,6 +2273,19 @@ enum xnn_status xnn_setup_depth_to_space_nchw2nhwc_x32(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_transpose_nd_x32(
+  uint32_t flags,
+  xnn_operator_t* transpose_op_out);
+
+enum xnn_status xnn_setup_transpose_nd_x32(
+  xnn_operator_t transpose_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* perm,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_unpooling2d_nhwc_x32(
   uint32_t input_padding_top,
   uint32_t input_padding_right,
@@ -1936,6 +2412,23 @@ enum xnn_status xnn_setup_multiply_nd_f16(
 
 #endif  // XNN_NO_F16_OPERATORS
 
+#ifndef XNN_NO_X16_OPERATORS
+
+enum xnn_status xnn_create_transpose_nd_x16(
+  uint32_t flags,
+  xnn_operator_t* transpose_op_out);
+
+enum xnn_status xnn_setup_transpose_nd_x16(
+  xnn_operator_t transpose_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* perm,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+#endif  // XNN_NO_X16_OPERATORS
+
 #ifndef XNN_NO_QS8_OPERATORS
 
 enum xnn_status xnn_create_add_nd_qs8(
@@ -2022,6 +2515,102 @@ enum xnn_status xnn_setup_fully_connected_nc_qs8(
   int8_t* output,
   pthreadpool_t threadpool);
 
+/// Create a Convolution operator with signed 8-bit input and output, and per-channel quantized signed 8-bit weights.
+///
+/// @param kernel_scale - array of groups * group_output_channels scales, one per output channel of the kernel.
+enum xnn_status xnn_create_convolution2d_nhwc_qc8(
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t kernel_height,
+  uint32_t kernel_width,
+  uint32_t subsampling_height,
+  uint32_t subsampling_width,
+  uint32_t dilation_height,
+  uint32_t dilation_width,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  const float* kernel_scale,
+  const int8_t* kernel,
+  const int32_t* bias,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* convolution_op_out);
+
+enum xnn_status xnn_setup_convolution2d_nhwc_qc8(
+  xnn_operator_t convolution_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+/// Create a Fully Connected operator with signed 8-bit input and output, and per-channel quantized signed 8-bit
+/// weights.
+///
+/// @param kernel_scale - array of output_channels scales, one per output channel of the kernel.
+enum xnn_status xnn_create_fully_connected_nc_qc8(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  const float* kernel_scale,
+  const int8_t* kernel,
+  const int32_t* bias,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_setup_fully_connected_nc_qc8(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+/// Create a Fully Connected operator with single-precision floating-point input and output, and per-channel quantized
+/// signed 8-bit weights. Each row of the input is quantized to signed 8-bit values with its own scale and zero point on
+/// every run, and the products with the quantized weights are dequantized back to floating-point.
+///
+/// @param kernel_scale - array of output_channels scales, one per output channel of the kernel.
+/// @param kernel - array of output_channels x input_channels signed 8-bit weights with zero point of 0, or
+///                 input_channels x output_channels weights if XNN_FLAG_TRANSPOSE_WEIGHTS is specified.
+/// @param bias - optional array of output_channels floating-point biases.
+enum xnn_status xnn_create_fully_connected_nc_qd8_f32_qc8w(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  const float* kernel_scale,
+  const int8_t* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_setup_fully_connected_nc_qd8_f32_qc8w(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_global_average_pooling_nwc_qs8(
   size_t channels,
   size_t input_stride,
@@ -2043,6 +2632,23 @@ enum xnn_status xnn_setup_global_average_pooling_nwc_qs8(
   int8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_softmax_nc_qs8(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float input_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  uint32_t flags,
+  xnn_operator_t* softmax_op_out);
+
+enum xnn_status xnn_setup_softmax_nc_qs8(
+  xnn_operator_t softmax_op,
+  size_t batch_size,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
 #endif  // XNN_NO_QS8_OPERATORS
 
 #ifndef XNN_NO_QU8_OPERATORS
@@ -2326,8 +2932,101 @@ enum xnn_status xnn_setup_channel_shuffle_nc_x8(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_copy_nc_x8(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* copy_op_out);
+
+enum xnn_status xnn_setup_copy_nc_x8(
+  xnn_operator_t copy_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_transpose_nd_x8(
+  uint32_t flags,
+  xnn_operator_t* transpose_op_out);
+
+enum xnn_status xnn_setup_transpose_nd_x8(
+  xnn_operator_t transpose_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* perm,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 #endif  // XNN_NO_X8_OPERATORS
 
+#ifndef XNN_NO_VCVT_OPERATORS
+
+enum xnn_status xnn_create_convert_nc_f16_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* convert_op_out);
+
+enum xnn_status xnn_setup_convert_nc_f16_f32(
+  xnn_operator_t convert_op,
+  size_t batch_size,
+  const void* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_convert_nc_f32_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* convert_op_out);
+
+enum xnn_status xnn_setup_convert_nc_f32_f16(
+  xnn_operator_t convert_op,
+  size_t batch_size,
+  const float* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_convert_nc_f32_qs8(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float output_scale,
+  int8_t output_zero_point,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* convert_op_out);
+
+enum xnn_status xnn_setup_convert_nc_f32_qs8(
+  xnn_operator_t convert_op,
+  size_t batch_size,
+  const float* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_convert_nc_qs8_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float input_scale,
+  int8_t input_zero_point,
+  uint32_t flags,
+  xnn_operator_t* convert_op_out);
+
+enum xnn_status xnn_setup_convert_nc_qs8_f32(
+  xnn_operator_t convert_op,
+  size_t batch_size,
+  const int8_t* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+#endif  // XNN_NO_VCVT_OPERATORS
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -41,5 +41,14 @@ tools/xngen src/f16-gemm/neonfp16arith-ld64.c.in -D MR=4 -D NR=16 -D INC=1 -o sr
 tools/xngen src/f16-gemm/neonfp16arith-ld64.c.in -D MR=6 -D NR=16 -D INC=1 -o src/f16-gemm/gen-inc/6x16inc-minmax-neonfp16arith-ld64.c
 tools/xngen src/f16-gemm/neonfp16arith-ld64.c.in -D MR=8 -D NR=16 -D INC=1 -o src/f16-gemm/gen-inc/8x16inc-minmax-neonfp16arith-ld64.c
 
+################################### x86 AVX ###################################
+### FMA3+F16C+BROADCAST micro-kernels
+tools/xngen src/f16-gemm/fma3-broadcast.c.in -D MR=1 -D NR=8 -o src/f16-gemm/gen/1x8-minmax-fma3-broadcast.c
+tools/xngen src/f16-gemm/fma3-broadcast.c.in -D MR=4 -D NR=8 -o src/f16-gemm/gen/4x8-minmax-fma3-broadcast.c
+tools/xngen src/f16-gemm/fma3-broadcast.c.in -D MR=1 -D NR=16 -o src/f16-gemm/gen/1x16-minmax-fma3-broadcast.c
+tools/xngen src/f16-gemm/fma3-broadcast.c.in -D MR=3 -D NR=16 -o src/f16-gemm/gen/3x16-minmax-fma3-broadcast.c
+tools/xngen src/f16-gemm/fma3-broadcast.c.in -D MR=4 -D NR=16 -o src/f16-gemm/gen/4x16-minmax-fma3-broadcast.c
+tools/xngen src/f16-gemm/fma3-broadcast.c.in -D MR=5 -D NR=16 -o src/f16-gemm/gen/5x16-minmax-fma3-broadcast.c
+
 ################################## Unit tests #################################
 tools/generate-gemm-test.py --spec test/f16-gemm-minmax.yaml --output test/f16-gemm-minmax.cc
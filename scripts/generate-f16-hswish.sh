@@ -8,5 +8,9 @@
 tools/xngen src/f16-hswish/neonfp16arith.c.in -D BATCH_TILE=8  -o src/f16-hswish/gen/hswish-neonfp16arith-x8.c
 tools/xngen src/f16-hswish/neonfp16arith.c.in -D BATCH_TILE=16 -o src/f16-hswish/gen/hswish-neonfp16arith-x16.c
 
+################################### x86 F16C ##################################
+tools/xngen src/f16-hswish/f16c.c.in -D BATCH_TILE=8  -o src/f16-hswish/gen/hswish-f16c-x8.c
+tools/xngen src/f16-hswish/f16c.c.in -D BATCH_TILE=16 -o src/f16-hswish/gen/hswish-f16c-x16.c
+
 ################################## Unit tests #################################
 tools/generate-hswish-test.py --spec test/f16-hswish.yaml --output test/f16-hswish.cc
@@ -15,5 +15,14 @@ tools/xngen src/f16-igemm/neonfp16arith-ld64.c.in -D MR=4 -D NR=16 -o src/f16-ig
 tools/xngen src/f16-igemm/neonfp16arith-ld64.c.in -D MR=6 -D NR=16 -o src/f16-igemm/gen/6x16-minmax-neonfp16arith-ld64.c
 tools/xngen src/f16-igemm/neonfp16arith-ld64.c.in -D MR=8 -D NR=16 -o src/f16-igemm/gen/8x16-minmax-neonfp16arith-ld64.c
 
+################################### x86 AVX ###################################
+### FMA3+F16C+BROADCAST micro-kernels
+tools/xngen src/f16-igemm/fma3-broadcast.c.in -D MR=1 -D NR=8 -o src/f16-igemm/gen/1x8-minmax-fma3-broadcast.c
+tools/xngen src/f16-igemm/fma3-broadcast.c.in -D MR=4 -D NR=8 -o src/f16-igemm/gen/4x8-minmax-fma3-broadcast.c
+tools/xngen src/f16-igemm/fma3-broadcast.c.in -D MR=1 -D NR=16 -o src/f16-igemm/gen/1x16-minmax-fma3-broadcast.c
+tools/xngen src/f16-igemm/fma3-broadcast.c.in -D MR=3 -D NR=16 -o src/f16-igemm/gen/3x16-minmax-fma3-broadcast.c
+tools/xngen src/f16-igemm/fma3-broadcast.c.in -D MR=4 -D NR=16 -o src/f16-igemm/gen/4x16-minmax-fma3-broadcast.c
+tools/xngen src/f16-igemm/fma3-broadcast.c.in -D MR=5 -D NR=16 -o src/f16-igemm/gen/5x16-minmax-fma3-broadcast.c
+
 ################################## Unit tests #################################
 tools/generate-gemm-test.py --spec test/f16-igemm-minmax.yaml --output test/f16-igemm-minmax.cc
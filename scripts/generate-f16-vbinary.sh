@@ -39,6 +39,41 @@ tools/xngen src/f16-vbinary/vopc-neonfp16arith.c.in -D OP=SUB      -D BATCH_TILE
 tools/xngen src/f16-vbinary/vopc-neonfp16arith.c.in -D OP=RSUB     -D BATCH_TILE=8  -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vrsubc-minmax-neonfp16arith-x8.c
 tools/xngen src/f16-vbinary/vopc-neonfp16arith.c.in -D OP=RSUB     -D BATCH_TILE=16 -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vrsubc-minmax-neonfp16arith-x16.c
 
+################################### x86 F16C ##################################
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=ADD     -D BATCH_TILE=8  -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vadd-minmax-f16c-x8.c
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=ADD     -D BATCH_TILE=16 -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vadd-minmax-f16c-x16.c
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=DIV     -D BATCH_TILE=8  -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vdiv-minmax-f16c-x8.c
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=DIV     -D BATCH_TILE=16 -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vdiv-minmax-f16c-x16.c
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=MAX     -D BATCH_TILE=8  -D ACTIVATION=LINEAR -o src/f16-vbinary/gen/vmax-f16c-x8.c
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=MAX     -D BATCH_TILE=16 -D ACTIVATION=LINEAR -o src/f16-vbinary/gen/vmax-f16c-x16.c
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=MIN     -D BATCH_TILE=8  -D ACTIVATION=LINEAR -o src/f16-vbinary/gen/vmin-f16c-x8.c
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=MIN     -D BATCH_TILE=16 -D ACTIVATION=LINEAR -o src/f16-vbinary/gen/vmin-f16c-x16.c
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=MUL     -D BATCH_TILE=8  -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vmul-minmax-f16c-x8.c
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=MUL     -D BATCH_TILE=16 -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vmul-minmax-f16c-x16.c
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=SQRDIFF -D BATCH_TILE=8  -D ACTIVATION=LINEAR -o src/f16-vbinary/gen/vsqrdiff-f16c-x8.c
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=SQRDIFF -D BATCH_TILE=16 -D ACTIVATION=LINEAR -o src/f16-vbinary/gen/vsqrdiff-f16c-x16.c
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=SUB     -D BATCH_TILE=8  -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vsub-minmax-f16c-x8.c
+tools/xngen src/f16-vbinary/vop-f16c.c.in -D OP=SUB     -D BATCH_TILE=16 -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vsub-minmax-f16c-x16.c
+
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=ADD      -D BATCH_TILE=8  -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vaddc-minmax-f16c-x8.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=ADD      -D BATCH_TILE=16 -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vaddc-minmax-f16c-x16.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=DIV      -D BATCH_TILE=8  -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vdivc-minmax-f16c-x8.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=DIV      -D BATCH_TILE=16 -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vdivc-minmax-f16c-x16.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=RDIV     -D BATCH_TILE=8  -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vrdivc-minmax-f16c-x8.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=RDIV     -D BATCH_TILE=16 -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vrdivc-minmax-f16c-x16.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=MAX      -D BATCH_TILE=8  -D ACTIVATION=LINEAR -o src/f16-vbinary/gen/vmaxc-f16c-x8.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=MAX      -D BATCH_TILE=16 -D ACTIVATION=LINEAR -o src/f16-vbinary/gen/vmaxc-f16c-x16.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=MIN      -D BATCH_TILE=8  -D ACTIVATION=LINEAR -o src/f16-vbinary/gen/vminc-f16c-x8.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=MIN      -D BATCH_TILE=16 -D ACTIVATION=LINEAR -o src/f16-vbinary/gen/vminc-f16c-x16.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=MUL      -D BATCH_TILE=8  -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vmulc-minmax-f16c-x8.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=MUL      -D BATCH_TILE=16 -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vmulc-minmax-f16c-x16.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=SQRDIFF  -D BATCH_TILE=8  -D ACTIVATION=LINEAR -o src/f16-vbinary/gen/vsqrdiffc-f16c-x8.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=SQRDIFF  -D BATCH_TILE=16 -D ACTIVATION=LINEAR -o src/f16-vbinary/gen/vsqrdiffc-f16c-x16.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=SUB      -D BATCH_TILE=8  -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vsubc-minmax-f16c-x8.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=SUB      -D BATCH_TILE=16 -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vsubc-minmax-f16c-x16.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=RSUB     -D BATCH_TILE=8  -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vrsubc-minmax-f16c-x8.c
+tools/xngen src/f16-vbinary/vopc-f16c.c.in -D OP=RSUB     -D BATCH_TILE=16 -D ACTIVATION=MINMAX -o src/f16-vbinary/gen/vrsubc-minmax-f16c-x16.c
+
 ################################## Unit tests #################################
 tools/generate-vbinary-test.py --tester VBinOpMicrokernelTester  --spec test/f16-vadd-minmax.yaml --output test/f16-vadd-minmax.cc
 tools/generate-vbinary-test.py --tester VBinOpMicrokernelTester  --spec test/f16-vdiv-minmax.yaml --output test/f16-vdiv-minmax.cc
@@ -0,0 +1,38 @@
+#!/bin/sh
+# Copyright 2020 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### ARM NEON ##################################
+tools/xngen src/f32-qs8-vcvt/neon.c.in -D BATCH_TILE=8  -o src/f32-qs8-vcvt/gen/vcvt-neon-x8.c
+tools/xngen src/f32-qs8-vcvt/neon.c.in -D BATCH_TILE=16 -o src/f32-qs8-vcvt/gen/vcvt-neon-x16.c
+
+tools/xngen src/f32-qs8-vcvt/neonv8.c.in -D BATCH_TILE=8  -o src/f32-qs8-vcvt/gen/vcvt-neonv8-x8.c
+tools/xngen src/f32-qs8-vcvt/neonv8.c.in -D BATCH_TILE=16 -o src/f32-qs8-vcvt/gen/vcvt-neonv8-x16.c
+
+################################## WAsm SIMD ##################################
+tools/xngen src/f32-qs8-vcvt/wasmsimd-magic.c.in -D BATCH_TILE=8  -o src/f32-qs8-vcvt/gen/vcvt-wasmsimd-magic-x8.c
+tools/xngen src/f32-qs8-vcvt/wasmsimd-magic.c.in -D BATCH_TILE=16 -o src/f32-qs8-vcvt/gen/vcvt-wasmsimd-magic-x16.c
+
+################################# x86 128-bit #################################
+tools/xngen src/f32-qs8-vcvt/sse2.c.in -D BATCH_TILE=16 -o src/f32-qs8-vcvt/gen/vcvt-sse2-x16.c
+tools/xngen src/f32-qs8-vcvt/sse2.c.in -D BATCH_TILE=32 -o src/f32-qs8-vcvt/gen/vcvt-sse2-x32.c
+
+################################# x86 256-bit #################################
+tools/xngen src/f32-qs8-vcvt/avx.c.in -D BATCH_TILE=16 -o src/f32-qs8-vcvt/gen/vcvt-avx-x16.c
+tools/xngen src/f32-qs8-vcvt/avx.c.in -D BATCH_TILE=32 -o src/f32-qs8-vcvt/gen/vcvt-avx-x32.c
+
+tools/xngen src/f32-qs8-vcvt/avx2.c.in -D BATCH_TILE=32 -o src/f32-qs8-vcvt/gen/vcvt-avx2-x32.c
+tools/xngen src/f32-qs8-vcvt/avx2.c.in -D BATCH_TILE=64 -o src/f32-qs8-vcvt/gen/vcvt-avx2-x64.c
+
+################################# x86 512-bit #################################
+tools/xngen src/f32-qs8-vcvt/avx512skx.c.in -D BATCH_TILE=32 -o src/f32-qs8-vcvt/gen/vcvt-avx512skx-x32.c
+tools/xngen src/f32-qs8-vcvt/avx512skx.c.in -D BATCH_TILE=64 -o src/f32-qs8-vcvt/gen/vcvt-avx512skx-x64.c
+
+#################################### Scalar ###################################
+tools/xngen src/f32-qs8-vcvt/scalar-magic.c.in -D BATCH_TILE=1 -o src/f32-qs8-vcvt/gen/vcvt-scalar-magic-x1.c
+tools/xngen src/f32-qs8-vcvt/scalar-magic.c.in -D BATCH_TILE=4 -o src/f32-qs8-vcvt/gen/vcvt-scalar-magic-x4.c
+
+################################## Unit tests #################################
+tools/generate-vcvt-test.py --spec test/f32-qs8-vcvt.yaml --output test/f32-qs8-vcvt.cc
@@ -0,0 +1,19 @@
+#!/bin/sh
+# Copyright 2021 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### ARM NEON ##################################
+tools/xngen src/qs8-dwconv/unipass-neon-mul16.c.in -D CHANNEL_TILE=8 -D KERNEL_TILE=9 -D DATATYPE=QC8 -o src/qc8-dwconv/gen/up8x9-minmax-neon-mul16.c
+tools/xngen src/qs8-dwconv/unipass-neon-mul16.c.in -D CHANNEL_TILE=8 -D KERNEL_TILE=25 -D DATATYPE=QC8 -o src/qc8-dwconv/gen/up8x25-minmax-neon-mul16.c
+
+################################### x86 SSE ###################################
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=8 -D KERNEL_TILE=9 -D SSE=2 -D AVX=0 -D DATATYPE=QC8 -o src/qc8-dwconv/gen/up8x9-minmax-sse2-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=8 -D KERNEL_TILE=25 -D SSE=2 -D AVX=0 -D DATATYPE=QC8 -o src/qc8-dwconv/gen/up8x25-minmax-sse2-mul16.c
+
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=8 -D KERNEL_TILE=9 -D SSE=4 -D AVX=0 -D DATATYPE=QC8 -o src/qc8-dwconv/gen/up8x9-minmax-sse41-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=8 -D KERNEL_TILE=25 -D SSE=4 -D AVX=0 -D DATATYPE=QC8 -o src/qc8-dwconv/gen/up8x25-minmax-sse41-mul16.c
+
+################################## Unit tests #################################
+tools/generate-dwconv-test.py --spec test/qc8-dwconv-minmax.yaml --output test/qc8-dwconv-minmax.cc
@@ -0,0 +1,28 @@
+#!/bin/sh
+# Copyright 2021 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### ARM NEON ##################################
+### C2 micro-kernels
+tools/xngen src/qs8-igemm/c2-neon-mull-padal-dup.c.in -D MR=1 -D NR=8  -D MLA=1 -D DATATYPE=QC8 -o src/qc8-igemm/gen/1x8c2-minmax-neon-mlal-padal-dup.c
+tools/xngen src/qs8-igemm/c2-neon-mull-padal-dup.c.in -D MR=2 -D NR=8  -D MLA=1 -D DATATYPE=QC8 -o src/qc8-igemm/gen/2x8c2-minmax-neon-mlal-padal-dup.c
+
+### C4 micro-kernels
+tools/xngen src/qs8-igemm/MRxNRc4-neondot.c.in -D MR=1 -D NR=8  -D DATATYPE=QC8 -o src/qc8-igemm/gen/1x8c4-minmax-neondot.c
+tools/xngen src/qs8-igemm/MRxNRc4-neondot.c.in -D MR=4 -D NR=8  -D DATATYPE=QC8 -o src/qc8-igemm/gen/4x8c4-minmax-neondot.c
+tools/xngen src/qs8-igemm/MRxNRc4-neondot.c.in -D MR=1 -D NR=16 -D DATATYPE=QC8 -o src/qc8-igemm/gen/1x16c4-minmax-neondot.c
+tools/xngen src/qs8-igemm/MRxNRc4-neondot.c.in -D MR=4 -D NR=16 -D DATATYPE=QC8 -o src/qc8-igemm/gen/4x16c4-minmax-neondot.c
+
+################################### x86 SSE ###################################
+tools/xngen src/qs8-igemm/MRx4c8-sse.c.in -D MR=1 -D SSE=2 -D AVX=0 -D XOP=0 -D VARIANT=LD64 -D DATATYPE=QC8 -o src/qc8-igemm/gen/1x4c8-minmax-sse2-ld64.c
+tools/xngen src/qs8-igemm/MRx4c8-sse.c.in -D MR=2 -D SSE=2 -D AVX=0 -D XOP=0 -D VARIANT=LD64 -D DATATYPE=QC8 -o src/qc8-igemm/gen/2x4c8-minmax-sse2-ld64.c
+tools/xngen src/qs8-igemm/MRx4c8-sse.c.in -D MR=3 -D SSE=2 -D AVX=0 -D XOP=0 -D VARIANT=LD64 -D DATATYPE=QC8 -o src/qc8-igemm/gen/3x4c8-minmax-sse2-ld64.c
+
+tools/xngen src/qs8-igemm/MRx4c8-sse.c.in -D MR=1 -D SSE=4 -D AVX=0 -D XOP=0 -D VARIANT=LD64 -D DATATYPE=QC8 -o src/qc8-igemm/gen/1x4c8-minmax-sse41-ld64.c
+tools/xngen src/qs8-igemm/MRx4c8-sse.c.in -D MR=2 -D SSE=4 -D AVX=0 -D XOP=0 -D VARIANT=LD64 -D DATATYPE=QC8 -o src/qc8-igemm/gen/2x4c8-minmax-sse41-ld64.c
+tools/xngen src/qs8-igemm/MRx4c8-sse.c.in -D MR=3 -D SSE=4 -D AVX=0 -D XOP=0 -D VARIANT=LD64 -D DATATYPE=QC8 -o src/qc8-igemm/gen/3x4c8-minmax-sse41-ld64.c
+
+################################## Unit tests #################################
+tools/generate-gemm-test.py --spec test/qc8-igemm-minmax.yaml --output test/qc8-igemm-minmax.cc
@@ -0,0 +1,22 @@
+#!/bin/sh
+# Copyright 2020 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+#################################### Scalar ###################################
+tools/xngen src/qd8-f32-qc8w-gemm/scalar.c.in -D MR=1 -D NR=4 -o src/qd8-f32-qc8w-gemm/gen/1x4-minmax-scalar.c
+tools/xngen src/qd8-f32-qc8w-gemm/scalar.c.in -D MR=2 -D NR=4 -o src/qd8-f32-qc8w-gemm/gen/2x4-minmax-scalar.c
+tools/xngen src/qd8-f32-qc8w-gemm/scalar.c.in -D MR=4 -D NR=4 -o src/qd8-f32-qc8w-gemm/gen/4x4-minmax-scalar.c
+
+################################### x86 SSE ###################################
+tools/xngen src/qd8-f32-qc8w-gemm/MRx4c8-sse.c.in -D MR=1 -D SSE=2 -D VARIANT=LD64 -o src/qd8-f32-qc8w-gemm/gen/1x4c8-minmax-sse2-ld64.c
+tools/xngen src/qd8-f32-qc8w-gemm/MRx4c8-sse.c.in -D MR=2 -D SSE=2 -D VARIANT=LD64 -o src/qd8-f32-qc8w-gemm/gen/2x4c8-minmax-sse2-ld64.c
+tools/xngen src/qd8-f32-qc8w-gemm/MRx4c8-sse.c.in -D MR=3 -D SSE=2 -D VARIANT=LD64 -o src/qd8-f32-qc8w-gemm/gen/3x4c8-minmax-sse2-ld64.c
+
+tools/xngen src/qd8-f32-qc8w-gemm/MRx4c8-sse.c.in -D MR=1 -D SSE=4 -D VARIANT=LD64 -o src/qd8-f32-qc8w-gemm/gen/1x4c8-minmax-sse41-ld64.c
+tools/xngen src/qd8-f32-qc8w-gemm/MRx4c8-sse.c.in -D MR=2 -D SSE=4 -D VARIANT=LD64 -o src/qd8-f32-qc8w-gemm/gen/2x4c8-minmax-sse41-ld64.c
+tools/xngen src/qd8-f32-qc8w-gemm/MRx4c8-sse.c.in -D MR=3 -D SSE=4 -D VARIANT=LD64 -o src/qd8-f32-qc8w-gemm/gen/3x4c8-minmax-sse41-ld64.c
+
+################################## Unit tests #################################
+tools/generate-gemm-test.py --spec test/qd8-f32-qc8w-gemm-minmax.yaml --output test/qd8-f32-qc8w-gemm-minmax.cc
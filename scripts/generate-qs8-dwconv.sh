@@ -5,10 +5,12 @@
 # LICENSE file in the root directory of this source tree.
 
 ################################## ARM NEON ##################################
-tools/xngen src/qs8-dwconv/unipass-neon-mul16.c.in -D CHANNEL_TILE=8  -D KERNEL_TILE=9 -o src/qs8-dwconv/gen/up8x9-minmax-neon-mul16.c
-tools/xngen src/qs8-dwconv/unipass-neon-mul16.c.in -D CHANNEL_TILE=16 -D KERNEL_TILE=9 -o src/qs8-dwconv/gen/up16x9-minmax-neon-mul16.c
-tools/xngen src/qs8-dwconv/unipass-neon-mul16.c.in -D CHANNEL_TILE=24 -D KERNEL_TILE=9 -o src/qs8-dwconv/gen/up24x9-minmax-neon-mul16.c
-tools/xngen src/qs8-dwconv/unipass-neon-mul16.c.in -D CHANNEL_TILE=32 -D KERNEL_TILE=9 -o src/qs8-dwconv/gen/up32x9-minmax-neon-mul16.c
+tools/xngen src/qs8-dwconv/unipass-neon-mul16.c.in -D CHANNEL_TILE=8  -D KERNEL_TILE=9 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up8x9-minmax-neon-mul16.c
+tools/xngen src/qs8-dwconv/unipass-neon-mul16.c.in -D CHANNEL_TILE=16 -D KERNEL_TILE=9 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up16x9-minmax-neon-mul16.c
+tools/xngen src/qs8-dwconv/unipass-neon-mul16.c.in -D CHANNEL_TILE=24 -D KERNEL_TILE=9 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up24x9-minmax-neon-mul16.c
+tools/xngen src/qs8-dwconv/unipass-neon-mul16.c.in -D CHANNEL_TILE=32 -D KERNEL_TILE=9 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up32x9-minmax-neon-mul16.c
+
+tools/xngen src/qs8-dwconv/multipass-neon-mul16.c.in -D CHANNEL_TILE=8 -D PRIMARY_TILE=9 -D INCREMENTAL_TILE=8 -o src/qs8-dwconv/gen/mp8x9p8-minmax-neon-mul16.c
 
 ################################## WAsm SIMD ##################################
 tools/xngen src/qs8-dwconv/unipass-wasmsimd-mul16.c.in -D CHANNEL_TILE=8  -D KERNEL_TILE=9 -o src/qs8-dwconv/gen/up8x9-minmax-wasmsimd-mul16.c
@@ -16,21 +18,24 @@ tools/xngen src/qs8-dwconv/unipass-wasmsimd-mul16.c.in -D CHANNEL_TILE=16 -D KER
 tools/xngen src/qs8-dwconv/unipass-wasmsimd-mul16.c.in -D CHANNEL_TILE=24 -D KERNEL_TILE=9 -o src/qs8-dwconv/gen/up24x9-minmax-wasmsimd-mul16.c
 
 ################################### x86 SSE ###################################
-tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=8  -D KERNEL_TILE=9 -D SSE=2 -D AVX=0 -o src/qs8-dwconv/gen/up8x9-minmax-sse2-mul16.c
-tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=16 -D KERNEL_TILE=9 -D SSE=2 -D AVX=0 -o src/qs8-dwconv/gen/up16x9-minmax-sse2-mul16.c
-tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=24 -D KERNEL_TILE=9 -D SSE=2 -D AVX=0 -o src/qs8-dwconv/gen/up24x9-minmax-sse2-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=8  -D KERNEL_TILE=9 -D SSE=2 -D AVX=0 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up8x9-minmax-sse2-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=16 -D KERNEL_TILE=9 -D SSE=2 -D AVX=0 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up16x9-minmax-sse2-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=24 -D KERNEL_TILE=9 -D SSE=2 -D AVX=0 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up24x9-minmax-sse2-mul16.c
+tools/xngen src/qs8-dwconv/multipass-sse-mul16.c.in -D CHANNEL_TILE=8 -D PRIMARY_TILE=9 -D INCREMENTAL_TILE=8 -D SSE=2 -o src/qs8-dwconv/gen/mp8x9p8-minmax-sse2-mul16.c
 
-tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=8  -D KERNEL_TILE=9 -D SSE=3 -D AVX=0 -o src/qs8-dwconv/gen/up8x9-minmax-ssse3-mul16.c
-tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=16 -D KERNEL_TILE=9 -D SSE=3 -D AVX=0 -o src/qs8-dwconv/gen/up16x9-minmax-ssse3-mul16.c
-tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=24 -D KERNEL_TILE=9 -D SSE=3 -D AVX=0 -o src/qs8-dwconv/gen/up24x9-minmax-ssse3-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=8  -D KERNEL_TILE=9 -D SSE=3 -D AVX=0 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up8x9-minmax-ssse3-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=16 -D KERNEL_TILE=9 -D SSE=3 -D AVX=0 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up16x9-minmax-ssse3-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=24 -D KERNEL_TILE=9 -D SSE=3 -D AVX=0 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up24x9-minmax-ssse3-mul16.c
+tools/xngen src/qs8-dwconv/multipass-sse-mul16.c.in -D CHANNEL_TILE=8 -D PRIMARY_TILE=9 -D INCREMENTAL_TILE=8 -D SSE=3 -o src/qs8-dwconv/gen/mp8x9p8-minmax-ssse3-mul16.c
 
-tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=8  -D KERNEL_TILE=9 -D SSE=4 -D AVX=0 -o src/qs8-dwconv/gen/up8x9-minmax-sse41-mul16.c
-tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=16 -D KERNEL_TILE=9 -D SSE=4 -D AVX=0 -o src/qs8-dwconv/gen/up16x9-minmax-sse41-mul16.c
-tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=24 -D KERNEL_TILE=9 -D SSE=4 -D AVX=0 -o src/qs8-dwconv/gen/up24x9-minmax-sse41-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=8  -D KERNEL_TILE=9 -D SSE=4 -D AVX=0 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up8x9-minmax-sse41-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=16 -D KERNEL_TILE=9 -D SSE=4 -D AVX=0 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up16x9-minmax-sse41-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=24 -D KERNEL_TILE=9 -D SSE=4 -D AVX=0 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up24x9-minmax-sse41-mul16.c
+tools/xngen src/qs8-dwconv/multipass-sse-mul16.c.in -D CHANNEL_TILE=8 -D PRIMARY_TILE=9 -D INCREMENTAL_TILE=8 -D SSE=4 -o src/qs8-dwconv/gen/mp8x9p8-minmax-sse41-mul16.c
 
-tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=8  -D KERNEL_TILE=9 -D SSE=4 -D AVX=1 -o src/qs8-dwconv/gen/up8x9-minmax-avx-mul16.c
-tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=16 -D KERNEL_TILE=9 -D SSE=4 -D AVX=1 -o src/qs8-dwconv/gen/up16x9-minmax-avx-mul16.c
-tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=24 -D KERNEL_TILE=9 -D SSE=4 -D AVX=1 -o src/qs8-dwconv/gen/up24x9-minmax-avx-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=8  -D KERNEL_TILE=9 -D SSE=4 -D AVX=1 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up8x9-minmax-avx-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=16 -D KERNEL_TILE=9 -D SSE=4 -D AVX=1 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up16x9-minmax-avx-mul16.c
+tools/xngen src/qs8-dwconv/unipass-sse-mul16.c.in -D CHANNEL_TILE=24 -D KERNEL_TILE=9 -D SSE=4 -D AVX=1 -D DATATYPE=QS8 -o src/qs8-dwconv/gen/up24x9-minmax-avx-mul16.c
 
 tools/xngen src/qs8-dwconv/unipass-sse-mul32.c.in -D CHANNEL_TILE=8  -D KERNEL_TILE=9 -D SSE=4 -D AVX=0 -D XOP=0 -o src/qs8-dwconv/gen/up8x9-minmax-sse41-mul32.c
 tools/xngen src/qs8-dwconv/unipass-sse-mul32.c.in -D CHANNEL_TILE=16 -D KERNEL_TILE=9 -D SSE=4 -D AVX=0 -D XOP=0 -o src/qs8-dwconv/gen/up16x9-minmax-sse41-mul32.c
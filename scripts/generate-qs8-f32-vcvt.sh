@@ -0,0 +1,38 @@
+#!/bin/sh
+# Copyright 2020 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### ARM NEON ##################################
+tools/xngen src/qs8-f32-vcvt/neon.c.in -D BATCH_TILE=8  -o src/qs8-f32-vcvt/gen/vcvt-neon-x8.c
+tools/xngen src/qs8-f32-vcvt/neon.c.in -D BATCH_TILE=16 -o src/qs8-f32-vcvt/gen/vcvt-neon-x16.c
+
+################################## WAsm SIMD ##################################
+tools/xngen src/qs8-f32-vcvt/wasmsimd.c.in -D BATCH_TILE=8  -o src/qs8-f32-vcvt/gen/vcvt-wasmsimd-x8.c
+tools/xngen src/qs8-f32-vcvt/wasmsimd.c.in -D BATCH_TILE=16 -o src/qs8-f32-vcvt/gen/vcvt-wasmsimd-x16.c
+
+################################# x86 128-bit #################################
+tools/xngen src/qs8-f32-vcvt/sse.c.in -D SSE=2 -D BATCH_TILE=8  -o src/qs8-f32-vcvt/gen/vcvt-sse2-x8.c
+tools/xngen src/qs8-f32-vcvt/sse.c.in -D SSE=2 -D BATCH_TILE=16 -o src/qs8-f32-vcvt/gen/vcvt-sse2-x16.c
+
+tools/xngen src/qs8-f32-vcvt/sse.c.in -D SSE=4 -D BATCH_TILE=8  -o src/qs8-f32-vcvt/gen/vcvt-sse41-x8.c
+tools/xngen src/qs8-f32-vcvt/sse.c.in -D SSE=4 -D BATCH_TILE=16 -o src/qs8-f32-vcvt/gen/vcvt-sse41-x16.c
+
+################################# x86 256-bit #################################
+tools/xngen src/qs8-f32-vcvt/avx.c.in -D BATCH_TILE=16 -o src/qs8-f32-vcvt/gen/vcvt-avx-x16.c
+tools/xngen src/qs8-f32-vcvt/avx.c.in -D BATCH_TILE=32 -o src/qs8-f32-vcvt/gen/vcvt-avx-x32.c
+
+tools/xngen src/qs8-f32-vcvt/avx2.c.in -D BATCH_TILE=16 -o src/qs8-f32-vcvt/gen/vcvt-avx2-x16.c
+tools/xngen src/qs8-f32-vcvt/avx2.c.in -D BATCH_TILE=32 -o src/qs8-f32-vcvt/gen/vcvt-avx2-x32.c
+
+################################# x86 512-bit #################################
+tools/xngen src/qs8-f32-vcvt/avx512skx.c.in -D BATCH_TILE=16 -o src/qs8-f32-vcvt/gen/vcvt-avx512skx-x16.c
+tools/xngen src/qs8-f32-vcvt/avx512skx.c.in -D BATCH_TILE=32 -o src/qs8-f32-vcvt/gen/vcvt-avx512skx-x32.c
+
+#################################### Scalar ###################################
+tools/xngen src/qs8-f32-vcvt/scalar.c.in -D BATCH_TILE=1 -o src/qs8-f32-vcvt/gen/vcvt-scalar-x1.c
+tools/xngen src/qs8-f32-vcvt/scalar.c.in -D BATCH_TILE=4 -o src/qs8-f32-vcvt/gen/vcvt-scalar-x4.c
+
+################################## Unit tests #################################
+tools/generate-vcvt-test.py --spec test/qs8-f32-vcvt.yaml --output test/qs8-f32-vcvt.cc
@@ -0,0 +1,362 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-dwconv/mp-neonfp16arith.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/dwconv.h>
+
+
+void xnn_f16_dwconv_minmax_ukernel_mp8x9p8__neonfp16arith(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const void** input,
+    const void* weights,
+    void* buffer_ptr,
+    void* output_ptr,
+    size_t input_stride,
+    size_t output_increment,
+    size_t input_offset,
+    const void* zero,
+    const struct xnn_f16_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_DISABLE_TSAN
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+  assert(kernel_size > 9);
+
+  __fp16* output = (__fp16*) output_ptr;
+  __fp16* buffer = (__fp16*) buffer_ptr;
+  const float16x8_t vmax = vld1q_dup_f16(&params->max);
+  const float16x8_t vmin = vld1q_dup_f16(&params->min);
+  do {
+    const void** pass_input = input;
+    const __fp16* w = (const __fp16*) weights;
+
+    // First pass: initialize the accumulators in the buffer with the bias and the first 9 taps.
+    {
+      const __fp16* i0 = (const __fp16*) pass_input[0];
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != (const __fp16*) zero) {
+        i0 = (const __fp16*) ((uintptr_t) i0 + input_offset);
+      }
+      const __fp16* i1 = (const __fp16*) pass_input[1];
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != (const __fp16*) zero) {
+        i1 = (const __fp16*) ((uintptr_t) i1 + input_offset);
+      }
+      const __fp16* i2 = (const __fp16*) pass_input[2];
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != (const __fp16*) zero) {
+        i2 = (const __fp16*) ((uintptr_t) i2 + input_offset);
+      }
+      const __fp16* i3 = (const __fp16*) pass_input[3];
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != (const __fp16*) zero) {
+        i3 = (const __fp16*) ((uintptr_t) i3 + input_offset);
+      }
+      const __fp16* i4 = (const __fp16*) pass_input[4];
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != (const __fp16*) zero) {
+        i4 = (const __fp16*) ((uintptr_t) i4 + input_offset);
+      }
+      const __fp16* i5 = (const __fp16*) pass_input[5];
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != (const __fp16*) zero) {
+        i5 = (const __fp16*) ((uintptr_t) i5 + input_offset);
+      }
+      const __fp16* i6 = (const __fp16*) pass_input[6];
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != (const __fp16*) zero) {
+        i6 = (const __fp16*) ((uintptr_t) i6 + input_offset);
+      }
+      const __fp16* i7 = (const __fp16*) pass_input[7];
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != (const __fp16*) zero) {
+        i7 = (const __fp16*) ((uintptr_t) i7 + input_offset);
+      }
+      const __fp16* i8 = (const __fp16*) pass_input[8];
+      assert(i8 != NULL);
+      if XNN_UNPREDICTABLE(i8 != (const __fp16*) zero) {
+        i8 = (const __fp16*) ((uintptr_t) i8 + input_offset);
+      }
+      pass_input += 9;
+
+      __fp16* b = buffer;
+      for (size_t c = 0; c < channels; c += 8) {
+        float16x8_t vacc01234567p0 = vld1q_f16(w); w += 8;
+
+        const float16x8_t vi0x01234567 = vld1q_f16(i0); i0 += 8;
+        const float16x8_t vk0x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi0x01234567, vk0x01234567);
+
+        const float16x8_t vi1x01234567 = vld1q_f16(i1); i1 += 8;
+        const float16x8_t vk1x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi1x01234567, vk1x01234567);
+
+        const float16x8_t vi2x01234567 = vld1q_f16(i2); i2 += 8;
+        const float16x8_t vk2x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi2x01234567, vk2x01234567);
+
+        const float16x8_t vi3x01234567 = vld1q_f16(i3); i3 += 8;
+        const float16x8_t vk3x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi3x01234567, vk3x01234567);
+
+        const float16x8_t vi4x01234567 = vld1q_f16(i4); i4 += 8;
+        const float16x8_t vk4x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi4x01234567, vk4x01234567);
+
+        const float16x8_t vi5x01234567 = vld1q_f16(i5); i5 += 8;
+        const float16x8_t vk5x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi5x01234567, vk5x01234567);
+
+        const float16x8_t vi6x01234567 = vld1q_f16(i6); i6 += 8;
+        const float16x8_t vk6x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi6x01234567, vk6x01234567);
+
+        const float16x8_t vi7x01234567 = vld1q_f16(i7); i7 += 8;
+        const float16x8_t vk7x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi7x01234567, vk7x01234567);
+
+        const float16x8_t vi8x01234567 = vld1q_f16(i8); i8 += 8;
+        const float16x8_t vk8x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi8x01234567, vk8x01234567);
+
+        vst1q_f16(b, vacc01234567p0); b += 8;
+      }
+    }
+
+    // Middle passes: accumulate the next 8 taps into the buffer.
+    size_t k = kernel_size - 9;
+    for (; k > 8; k -= 8) {
+      const __fp16* i0 = (const __fp16*) pass_input[0];
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != (const __fp16*) zero) {
+        i0 = (const __fp16*) ((uintptr_t) i0 + input_offset);
+      }
+      const __fp16* i1 = (const __fp16*) pass_input[1];
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != (const __fp16*) zero) {
+        i1 = (const __fp16*) ((uintptr_t) i1 + input_offset);
+      }
+      const __fp16* i2 = (const __fp16*) pass_input[2];
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != (const __fp16*) zero) {
+        i2 = (const __fp16*) ((uintptr_t) i2 + input_offset);
+      }
+      const __fp16* i3 = (const __fp16*) pass_input[3];
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != (const __fp16*) zero) {
+        i3 = (const __fp16*) ((uintptr_t) i3 + input_offset);
+      }
+      const __fp16* i4 = (const __fp16*) pass_input[4];
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != (const __fp16*) zero) {
+        i4 = (const __fp16*) ((uintptr_t) i4 + input_offset);
+      }
+      const __fp16* i5 = (const __fp16*) pass_input[5];
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != (const __fp16*) zero) {
+        i5 = (const __fp16*) ((uintptr_t) i5 + input_offset);
+      }
+      const __fp16* i6 = (const __fp16*) pass_input[6];
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != (const __fp16*) zero) {
+        i6 = (const __fp16*) ((uintptr_t) i6 + input_offset);
+      }
+      const __fp16* i7 = (const __fp16*) pass_input[7];
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != (const __fp16*) zero) {
+        i7 = (const __fp16*) ((uintptr_t) i7 + input_offset);
+      }
+      pass_input += 8;
+
+      __fp16* b = buffer;
+      for (size_t c = 0; c < channels; c += 8) {
+        float16x8_t vacc01234567p0 = vld1q_f16(b);
+
+        const float16x8_t vi0x01234567 = vld1q_f16(i0); i0 += 8;
+        const float16x8_t vk0x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi0x01234567, vk0x01234567);
+
+        const float16x8_t vi1x01234567 = vld1q_f16(i1); i1 += 8;
+        const float16x8_t vk1x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi1x01234567, vk1x01234567);
+
+        const float16x8_t vi2x01234567 = vld1q_f16(i2); i2 += 8;
+        const float16x8_t vk2x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi2x01234567, vk2x01234567);
+
+        const float16x8_t vi3x01234567 = vld1q_f16(i3); i3 += 8;
+        const float16x8_t vk3x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi3x01234567, vk3x01234567);
+
+        const float16x8_t vi4x01234567 = vld1q_f16(i4); i4 += 8;
+        const float16x8_t vk4x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi4x01234567, vk4x01234567);
+
+        const float16x8_t vi5x01234567 = vld1q_f16(i5); i5 += 8;
+        const float16x8_t vk5x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi5x01234567, vk5x01234567);
+
+        const float16x8_t vi6x01234567 = vld1q_f16(i6); i6 += 8;
+        const float16x8_t vk6x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi6x01234567, vk6x01234567);
+
+        const float16x8_t vi7x01234567 = vld1q_f16(i7); i7 += 8;
+        const float16x8_t vk7x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi7x01234567, vk7x01234567);
+
+        vst1q_f16(b, vacc01234567p0); b += 8;
+      }
+    }
+
+    // Last pass: add up to 8 remaining taps (the weights of the missing taps are zero) and produce the output.
+    {
+      const __fp16* i0 = (const __fp16*) pass_input[0];
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != (const __fp16*) zero) {
+        i0 = (const __fp16*) ((uintptr_t) i0 + input_offset);
+      }
+      const __fp16* i1 = (const __fp16*) pass_input[1];
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != (const __fp16*) zero) {
+        i1 = (const __fp16*) ((uintptr_t) i1 + input_offset);
+      }
+      const __fp16* i2 = (const __fp16*) pass_input[2];
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != (const __fp16*) zero) {
+        i2 = (const __fp16*) ((uintptr_t) i2 + input_offset);
+      }
+      const __fp16* i3 = (const __fp16*) pass_input[3];
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != (const __fp16*) zero) {
+        i3 = (const __fp16*) ((uintptr_t) i3 + input_offset);
+      }
+      const __fp16* i4 = (const __fp16*) pass_input[4];
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != (const __fp16*) zero) {
+        i4 = (const __fp16*) ((uintptr_t) i4 + input_offset);
+      }
+      const __fp16* i5 = (const __fp16*) pass_input[5];
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != (const __fp16*) zero) {
+        i5 = (const __fp16*) ((uintptr_t) i5 + input_offset);
+      }
+      const __fp16* i6 = (const __fp16*) pass_input[6];
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != (const __fp16*) zero) {
+        i6 = (const __fp16*) ((uintptr_t) i6 + input_offset);
+      }
+      const __fp16* i7 = (const __fp16*) pass_input[7];
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != (const __fp16*) zero) {
+        i7 = (const __fp16*) ((uintptr_t) i7 + input_offset);
+      }
+
+      const __fp16* b = buffer;
+      size_t c = channels;
+      for (; c >= 8; c -= 8) {
+        float16x8_t vacc01234567p0 = vld1q_f16(b); b += 8;
+
+        const float16x8_t vi0x01234567 = vld1q_f16(i0); i0 += 8;
+        const float16x8_t vk0x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi0x01234567, vk0x01234567);
+
+        const float16x8_t vi1x01234567 = vld1q_f16(i1); i1 += 8;
+        const float16x8_t vk1x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi1x01234567, vk1x01234567);
+
+        const float16x8_t vi2x01234567 = vld1q_f16(i2); i2 += 8;
+        const float16x8_t vk2x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi2x01234567, vk2x01234567);
+
+        const float16x8_t vi3x01234567 = vld1q_f16(i3); i3 += 8;
+        const float16x8_t vk3x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi3x01234567, vk3x01234567);
+
+        const float16x8_t vi4x01234567 = vld1q_f16(i4); i4 += 8;
+        const float16x8_t vk4x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi4x01234567, vk4x01234567);
+
+        const float16x8_t vi5x01234567 = vld1q_f16(i5); i5 += 8;
+        const float16x8_t vk5x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi5x01234567, vk5x01234567);
+
+        const float16x8_t vi6x01234567 = vld1q_f16(i6); i6 += 8;
+        const float16x8_t vk6x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi6x01234567, vk6x01234567);
+
+        const float16x8_t vi7x01234567 = vld1q_f16(i7); i7 += 8;
+        const float16x8_t vk7x01234567 = vld1q_f16(w); w += 8;
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi7x01234567, vk7x01234567);
+
+        float16x8_t vacc01234567 = vmaxq_f16(vacc01234567p0, vmin);
+        vacc01234567 = vminq_f16(vacc01234567, vmax);
+
+        vst1q_f16(output, vacc01234567); output += 8;
+      }
+      if XNN_UNLIKELY(c != 0) {
+        float16x8_t vacc01234567p0 = vld1q_f16(b);
+
+        const float16x8_t vi0x01234567 = vld1q_f16(i0);
+        const float16x8_t vk0x01234567 = vld1q_f16(w + 0);
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi0x01234567, vk0x01234567);
+
+        const float16x8_t vi1x01234567 = vld1q_f16(i1);
+        const float16x8_t vk1x01234567 = vld1q_f16(w + 8);
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi1x01234567, vk1x01234567);
+
+        const float16x8_t vi2x01234567 = vld1q_f16(i2);
+        const float16x8_t vk2x01234567 = vld1q_f16(w + 16);
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi2x01234567, vk2x01234567);
+
+        const float16x8_t vi3x01234567 = vld1q_f16(i3);
+        const float16x8_t vk3x01234567 = vld1q_f16(w + 24);
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi3x01234567, vk3x01234567);
+
+        const float16x8_t vi4x01234567 = vld1q_f16(i4);
+        const float16x8_t vk4x01234567 = vld1q_f16(w + 32);
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi4x01234567, vk4x01234567);
+
+        const float16x8_t vi5x01234567 = vld1q_f16(i5);
+        const float16x8_t vk5x01234567 = vld1q_f16(w + 40);
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi5x01234567, vk5x01234567);
+
+        const float16x8_t vi6x01234567 = vld1q_f16(i6);
+        const float16x8_t vk6x01234567 = vld1q_f16(w + 48);
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi6x01234567, vk6x01234567);
+
+        const float16x8_t vi7x01234567 = vld1q_f16(i7);
+        const float16x8_t vk7x01234567 = vld1q_f16(w + 56);
+        vacc01234567p0 = vfmaq_f16(vacc01234567p0, vi7x01234567, vk7x01234567);
+
+        float16x8_t vacc01234567 = vmaxq_f16(vacc01234567p0, vmin);
+        vacc01234567 = vminq_f16(vacc01234567, vmax);
+
+        float16x4_t vacc0123 = vget_low_f16(vacc01234567);
+        if (c & 4) {
+          vst1_f16(output, vacc0123); output += 4;
+          vacc0123 = vget_high_f16(vacc01234567);
+        }
+        if (c & 2) {
+          vst1_lane_u32(__builtin_assume_aligned(output, 1), vreinterpret_u32_f16(vacc0123), 0); output += 2;
+          vacc0123 = vext_f16(vacc0123, vacc0123, 2);
+        }
+        if (c & 1) {
+          vst1_lane_f16(output, vacc0123, 0); output += 1;
+        }
+      }
+    }
+
+    input = (const void**) ((uintptr_t) input + input_stride);
+    output = (__fp16*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
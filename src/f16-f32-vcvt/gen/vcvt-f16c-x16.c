@@ -0,0 +1,66 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-f32-vcvt/f16c.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f16_f32_vcvt_ukernel__f16c_x16(
+    size_t n,
+    const void* input,
+    float* output,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const uint16_t* i = (const uint16_t*) input;
+  for (; n >= 16 * sizeof(uint16_t); n -= 16 * sizeof(uint16_t)) {
+    const __m256 vacc01234567 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    const __m256 vacc89ABCDEF = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    _mm256_storeu_ps(output, vacc01234567);
+    _mm256_storeu_ps(output + 8, vacc89ABCDEF);
+    output += 16;
+  }
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    const __m256 vacc = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    _mm256_storeu_ps(output, vacc);
+    output += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(uint16_t));
+    assert(n <= 7 * sizeof(uint16_t));
+    const __m256 vacc = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    __m128 vacc_lo = _mm256_castps256_ps128(vacc);
+    if (n & (4 * sizeof(uint16_t))) {
+      _mm_storeu_ps(output, vacc_lo);
+      vacc_lo = _mm256_extractf128_ps(vacc, 1);
+      output += 4;
+    }
+    if (n & (2 * sizeof(uint16_t))) {
+      _mm_storel_pi((__m64*) output, vacc_lo);
+      vacc_lo = _mm_movehl_ps(vacc_lo, vacc_lo);
+      output += 2;
+    }
+    if (n & (1 * sizeof(uint16_t))) {
+      _mm_store_ss(output, vacc_lo);
+    }
+  }
+}
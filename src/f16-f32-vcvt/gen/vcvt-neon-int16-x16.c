@@ -0,0 +1,146 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-f32-vcvt/neon-int16.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f16_f32_vcvt_ukernel__neon_int16_x16(
+    size_t n,
+    const void* input,
+    float* output,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Normalized inputs are rebiased by adding 224 to the exponent and scaling by 2**-112, which also maps the
+  // maximum exponent to infinity and NaN. Denormalized inputs are reconstructed as 0.5 + mantissa * 2**-24 less 0.5.
+  const uint16x8_t vsign_mask = vmovq_n_u16(0x8000);
+  const uint16x8_t vexp_offset = vmovq_n_u16(0x7000);
+  const float32x4_t vexp_scale = vmovq_n_f32(0x1.0p-112f);
+  const uint16x8_t vmagic_mask = vmovq_n_u16(0x3F00);
+  const float32x4_t vmagic_bias = vmovq_n_f32(0.5f);
+  const uint16x8_t vdenorm_cutoff = vmovq_n_u16(0x0400);
+
+  const uint16_t* i = (const uint16_t*) input;
+  for (; n >= 16 * sizeof(uint16_t); n -= 16 * sizeof(uint16_t)) {
+    const uint16x8_t vh0 = vld1q_u16(i); i += 8;
+    const uint16x8_t vh1 = vld1q_u16(i); i += 8;
+
+    const uint16x8_t vsign0 = vandq_u16(vh0, vsign_mask);
+    const uint16x8_t vsign1 = vandq_u16(vh1, vsign_mask);
+
+    const uint16x8_t vnonsign0 = veorq_u16(vh0, vsign0);
+    const uint16x8_t vnonsign1 = veorq_u16(vh1, vsign1);
+
+    const uint16x8x2_t vprenorm0 = vzipq_u16(vshlq_n_u16(vnonsign0, 13), vsraq_n_u16(vexp_offset, vnonsign0, 3));
+    const uint16x8x2_t vdenorm0 = vzipq_u16(vnonsign0, vmagic_mask);
+    const uint16x8x2_t vprenorm1 = vzipq_u16(vshlq_n_u16(vnonsign1, 13), vsraq_n_u16(vexp_offset, vnonsign1, 3));
+    const uint16x8x2_t vdenorm1 = vzipq_u16(vnonsign1, vmagic_mask);
+
+    const float32x4_t vnorm0 = vmulq_f32(vreinterpretq_f32_u16(vprenorm0.val[0]), vexp_scale);
+    const float32x4_t vnorm1 = vmulq_f32(vreinterpretq_f32_u16(vprenorm0.val[1]), vexp_scale);
+    const float32x4_t vnorm2 = vmulq_f32(vreinterpretq_f32_u16(vprenorm1.val[0]), vexp_scale);
+    const float32x4_t vnorm3 = vmulq_f32(vreinterpretq_f32_u16(vprenorm1.val[1]), vexp_scale);
+
+    const float32x4_t vdenorm0 = vsubq_f32(vreinterpretq_f32_u16(vdenorm0.val[0]), vmagic_bias);
+    const float32x4_t vdenorm1 = vsubq_f32(vreinterpretq_f32_u16(vdenorm0.val[1]), vmagic_bias);
+    const float32x4_t vdenorm2 = vsubq_f32(vreinterpretq_f32_u16(vdenorm1.val[0]), vmagic_bias);
+    const float32x4_t vdenorm3 = vsubq_f32(vreinterpretq_f32_u16(vdenorm1.val[1]), vmagic_bias);
+
+    const uint16x8x2_t vmask0 = vzipq_u16(vcltq_u16(vnonsign0, vdenorm_cutoff), vcltq_u16(vnonsign0, vdenorm_cutoff));
+    const uint16x8x2_t vmask1 = vzipq_u16(vcltq_u16(vnonsign1, vdenorm_cutoff), vcltq_u16(vnonsign1, vdenorm_cutoff));
+
+    const uint32x4_t vf0 = vorrq_u32(vshll_n_u16(vget_low_u16(vsign0), 16),
+      vbslq_u32(vreinterpretq_u32_u16(vmask0.val[0]), vreinterpretq_u32_f32(vdenorm0), vreinterpretq_u32_f32(vnorm0)));
+    const uint32x4_t vf1 = vorrq_u32(vshll_n_u16(vget_high_u16(vsign0), 16),
+      vbslq_u32(vreinterpretq_u32_u16(vmask0.val[1]), vreinterpretq_u32_f32(vdenorm1), vreinterpretq_u32_f32(vnorm1)));
+    const uint32x4_t vf2 = vorrq_u32(vshll_n_u16(vget_low_u16(vsign1), 16),
+      vbslq_u32(vreinterpretq_u32_u16(vmask1.val[0]), vreinterpretq_u32_f32(vdenorm2), vreinterpretq_u32_f32(vnorm2)));
+    const uint32x4_t vf3 = vorrq_u32(vshll_n_u16(vget_high_u16(vsign1), 16),
+      vbslq_u32(vreinterpretq_u32_u16(vmask1.val[1]), vreinterpretq_u32_f32(vdenorm3), vreinterpretq_u32_f32(vnorm3)));
+
+    vst1q_f32(output, vreinterpretq_f32_u32(vf0)); output += 4;
+    vst1q_f32(output, vreinterpretq_f32_u32(vf1)); output += 4;
+    vst1q_f32(output, vreinterpretq_f32_u32(vf2)); output += 4;
+    vst1q_f32(output, vreinterpretq_f32_u32(vf3)); output += 4;
+  }
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    const uint16x8_t vh = vld1q_u16(i); i += 8;
+
+    const uint16x8_t vsign = vandq_u16(vh, vsign_mask);
+
+    const uint16x8_t vnonsign = veorq_u16(vh, vsign);
+
+    const uint16x8x2_t vprenorm = vzipq_u16(vshlq_n_u16(vnonsign, 13), vsraq_n_u16(vexp_offset, vnonsign, 3));
+    const uint16x8x2_t vdenorm = vzipq_u16(vnonsign, vmagic_mask);
+
+    const float32x4_t vnorm_lo = vmulq_f32(vreinterpretq_f32_u16(vprenorm.val[0]), vexp_scale);
+    const float32x4_t vnorm_hi = vmulq_f32(vreinterpretq_f32_u16(vprenorm.val[1]), vexp_scale);
+
+    const float32x4_t vdenorm_lo = vsubq_f32(vreinterpretq_f32_u16(vdenorm.val[0]), vmagic_bias);
+    const float32x4_t vdenorm_hi = vsubq_f32(vreinterpretq_f32_u16(vdenorm.val[1]), vmagic_bias);
+
+    const uint16x8x2_t vmask = vzipq_u16(vcltq_u16(vnonsign, vdenorm_cutoff), vcltq_u16(vnonsign, vdenorm_cutoff));
+
+    const uint32x4_t vf_lo = vorrq_u32(vshll_n_u16(vget_low_u16(vsign), 16),
+      vbslq_u32(vreinterpretq_u32_u16(vmask.val[0]), vreinterpretq_u32_f32(vdenorm_lo), vreinterpretq_u32_f32(vnorm_lo)));
+    const uint32x4_t vf_hi = vorrq_u32(vshll_n_u16(vget_high_u16(vsign), 16),
+      vbslq_u32(vreinterpretq_u32_u16(vmask.val[1]), vreinterpretq_u32_f32(vdenorm_hi), vreinterpretq_u32_f32(vnorm_hi)));
+
+    vst1q_f32(output, vreinterpretq_f32_u32(vf_lo)); output += 4;
+    vst1q_f32(output, vreinterpretq_f32_u32(vf_hi)); output += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(uint16_t));
+    assert(n <= 7 * sizeof(uint16_t));
+    const uint16x8_t vh = vld1q_u16(i);
+
+    const uint16x8_t vsign = vandq_u16(vh, vsign_mask);
+
+    const uint16x8_t vnonsign = veorq_u16(vh, vsign);
+
+    const uint16x8x2_t vprenorm = vzipq_u16(vshlq_n_u16(vnonsign, 13), vsraq_n_u16(vexp_offset, vnonsign, 3));
+    const uint16x8x2_t vdenorm = vzipq_u16(vnonsign, vmagic_mask);
+
+    const float32x4_t vnorm_lo = vmulq_f32(vreinterpretq_f32_u16(vprenorm.val[0]), vexp_scale);
+    const float32x4_t vnorm_hi = vmulq_f32(vreinterpretq_f32_u16(vprenorm.val[1]), vexp_scale);
+
+    const float32x4_t vdenorm_lo = vsubq_f32(vreinterpretq_f32_u16(vdenorm.val[0]), vmagic_bias);
+    const float32x4_t vdenorm_hi = vsubq_f32(vreinterpretq_f32_u16(vdenorm.val[1]), vmagic_bias);
+
+    const uint16x8x2_t vmask = vzipq_u16(vcltq_u16(vnonsign, vdenorm_cutoff), vcltq_u16(vnonsign, vdenorm_cutoff));
+
+    uint32x4_t vf = vorrq_u32(vshll_n_u16(vget_low_u16(vsign), 16),
+      vbslq_u32(vreinterpretq_u32_u16(vmask.val[0]), vreinterpretq_u32_f32(vdenorm_lo), vreinterpretq_u32_f32(vnorm_lo)));
+
+    if (n & (4 * sizeof(uint16_t))) {
+      vst1q_f32(output, vreinterpretq_f32_u32(vf)); output += 4;
+
+      vf = vorrq_u32(vshll_n_u16(vget_high_u16(vsign), 16),
+        vbslq_u32(vreinterpretq_u32_u16(vmask.val[1]), vreinterpretq_u32_f32(vdenorm_hi), vreinterpretq_u32_f32(vnorm_hi)));
+    }
+    float32x2_t vf_lo = vreinterpret_f32_u32(vget_low_u32(vf));
+    if (n & (2 * sizeof(uint16_t))) {
+      vst1_f32(output, vf_lo); output += 2;
+
+      vf_lo = vreinterpret_f32_u32(vget_high_u32(vf));
+    }
+    if (n & (1 * sizeof(uint16_t))) {
+      vst1_lane_f32(output, vf_lo, 0);
+    }
+  }
+}
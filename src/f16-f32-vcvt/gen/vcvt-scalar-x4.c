@@ -0,0 +1,49 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-f32-vcvt/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f16_f32_vcvt_ukernel__scalar_x4(
+    size_t n,
+    const void* input,
+    float* output,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const uint16_t* i = (const uint16_t*) input;
+  for (; n >= 4 * sizeof(uint16_t); n -= 4 * sizeof(uint16_t)) {
+    const uint16_t vh0 = i[0];
+    const uint16_t vh1 = i[1];
+    const uint16_t vh2 = i[2];
+    const uint16_t vh3 = i[3];
+    i += 4;
+
+    output[0] = fp16_ieee_to_fp32_value(vh0);
+    output[1] = fp16_ieee_to_fp32_value(vh1);
+    output[2] = fp16_ieee_to_fp32_value(vh2);
+    output[3] = fp16_ieee_to_fp32_value(vh3);
+    output += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      *output++ = fp16_ieee_to_fp32_value(*i++);
+      n -= sizeof(uint16_t);
+    } while (n != 0);
+  }
+}
@@ -0,0 +1,111 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-f32-vcvt/sse-int16.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f16_f32_vcvt_ukernel__sse41_int16_x8(
+    size_t n,
+    const void* input,
+    float* output,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Normalized inputs are rebiased by adding 224 to the exponent and scaling by 2**-112, which also maps the
+  // maximum exponent to infinity and NaN. Denormalized inputs are reconstructed as 0.5 + mantissa * 2**-24 less 0.5.
+  const __m128i vsign_mask = _mm_set1_epi16((short) 0x8000);
+  const __m128i vexp_offset = _mm_set1_epi16(0x7000);
+  const __m128 vexp_scale = _mm_set1_ps(0x1.0p-112f);
+  const __m128i vmagic_mask = _mm_set1_epi16(0x3F00);
+  const __m128 vmagic_bias = _mm_set1_ps(0.5f);
+  const __m128i vdenorm_cutoff = _mm_set1_epi16(0x0400);
+
+  const uint16_t* i = (const uint16_t*) input;
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    const __m128i vh = _mm_loadu_si128((const __m128i*) i);
+    i += 8;
+
+    const __m128i vsign = _mm_and_si128(vh, vsign_mask);
+
+    const __m128i vnonsign = _mm_xor_si128(vh, vsign);
+
+    const __m128i vprenorm_lo = _mm_slli_epi16(vnonsign, 13);
+    const __m128i vprenorm_hi = _mm_add_epi16(_mm_srli_epi16(vnonsign, 3), vexp_offset);
+
+    const __m128 vnorm_lo = _mm_mul_ps(_mm_castsi128_ps(_mm_unpacklo_epi16(vprenorm_lo, vprenorm_hi)), vexp_scale);
+    const __m128 vnorm_hi = _mm_mul_ps(_mm_castsi128_ps(_mm_unpackhi_epi16(vprenorm_lo, vprenorm_hi)), vexp_scale);
+
+    const __m128 vdenorm_lo = _mm_sub_ps(_mm_castsi128_ps(_mm_unpacklo_epi16(vnonsign, vmagic_mask)), vmagic_bias);
+    const __m128 vdenorm_hi = _mm_sub_ps(_mm_castsi128_ps(_mm_unpackhi_epi16(vnonsign, vmagic_mask)), vmagic_bias);
+
+    const __m128i vmask = _mm_cmplt_epi16(vnonsign, vdenorm_cutoff);
+
+    const __m128i vxmask_lo = _mm_unpacklo_epi16(vmask, vmask);
+    const __m128i vf_lo = _mm_or_si128(_mm_unpacklo_epi16(_mm_setzero_si128(), vsign),
+      _mm_blendv_epi8(_mm_castps_si128(vnorm_lo), _mm_castps_si128(vdenorm_lo), vxmask_lo));
+    const __m128i vxmask_hi = _mm_unpackhi_epi16(vmask, vmask);
+    const __m128i vf_hi = _mm_or_si128(_mm_unpackhi_epi16(_mm_setzero_si128(), vsign),
+      _mm_blendv_epi8(_mm_castps_si128(vnorm_hi), _mm_castps_si128(vdenorm_hi), vxmask_hi));
+
+    _mm_storeu_ps(output, _mm_castsi128_ps(vf_lo));
+    _mm_storeu_ps(output + 4, _mm_castsi128_ps(vf_hi));
+    output += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(uint16_t));
+    assert(n <= 7 * sizeof(uint16_t));
+    const __m128i vh = _mm_loadu_si128((const __m128i*) i);
+
+    const __m128i vsign = _mm_and_si128(vh, vsign_mask);
+
+    const __m128i vnonsign = _mm_xor_si128(vh, vsign);
+
+    const __m128i vprenorm_lo = _mm_slli_epi16(vnonsign, 13);
+    const __m128i vprenorm_hi = _mm_add_epi16(_mm_srli_epi16(vnonsign, 3), vexp_offset);
+
+    const __m128 vnorm_lo = _mm_mul_ps(_mm_castsi128_ps(_mm_unpacklo_epi16(vprenorm_lo, vprenorm_hi)), vexp_scale);
+    const __m128 vnorm_hi = _mm_mul_ps(_mm_castsi128_ps(_mm_unpackhi_epi16(vprenorm_lo, vprenorm_hi)), vexp_scale);
+
+    const __m128 vdenorm_lo = _mm_sub_ps(_mm_castsi128_ps(_mm_unpacklo_epi16(vnonsign, vmagic_mask)), vmagic_bias);
+    const __m128 vdenorm_hi = _mm_sub_ps(_mm_castsi128_ps(_mm_unpackhi_epi16(vnonsign, vmagic_mask)), vmagic_bias);
+
+    const __m128i vmask = _mm_cmplt_epi16(vnonsign, vdenorm_cutoff);
+
+    const __m128i vxmask_lo = _mm_unpacklo_epi16(vmask, vmask);
+    __m128i vf = _mm_or_si128(_mm_unpacklo_epi16(_mm_setzero_si128(), vsign),
+      _mm_blendv_epi8(_mm_castps_si128(vnorm_lo), _mm_castps_si128(vdenorm_lo), vxmask_lo));
+
+    if (n & (4 * sizeof(uint16_t))) {
+      _mm_storeu_ps(output, _mm_castsi128_ps(vf));
+      output += 4;
+
+      const __m128i vxmask_hi = _mm_unpackhi_epi16(vmask, vmask);
+      vf = _mm_or_si128(_mm_unpackhi_epi16(_mm_setzero_si128(), vsign),
+        _mm_blendv_epi8(_mm_castps_si128(vnorm_hi), _mm_castps_si128(vdenorm_hi), vxmask_hi));
+    }
+    if (n & (2 * sizeof(uint16_t))) {
+      _mm_storel_pi((__m64*) output, _mm_castsi128_ps(vf));
+      output += 2;
+
+      vf = _mm_castps_si128(_mm_movehl_ps(_mm_castsi128_ps(vf), _mm_castsi128_ps(vf)));
+    }
+    if (n & (1 * sizeof(uint16_t))) {
+      _mm_store_ss(output, _mm_castsi128_ps(vf));
+    }
+  }
+}
@@ -0,0 +1,69 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-hswish/f16c.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/hswish.h>
+
+
+void xnn_f16_hswish_ukernel__f16c_x8(
+    size_t n,
+    const void* restrict x_ptr,
+    void* restrict y_ptr,
+    const struct xnn_f16_hswish_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+
+  const uint16_t* x = (const uint16_t*) x_ptr;
+  uint16_t* y = (uint16_t*) y_ptr;
+
+  const __m256 vsixth = _mm256_cvtph_ps(_mm_set1_epi16((short) params->sixth));
+  const __m256 vthree = _mm256_cvtph_ps(_mm_set1_epi16((short) params->three));
+  const __m256 vsix = _mm256_cvtph_ps(_mm_set1_epi16((short) params->six));
+  const __m256 vzero = _mm256_setzero_ps();
+
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) x));
+    x += 8;
+    __m256 vacc = _mm256_add_ps(vx, vthree);
+    vx = _mm256_mul_ps(vx, vsixth);
+    vacc = _mm256_max_ps(vacc, vzero);
+    vacc = _mm256_min_ps(vacc, vsix);
+    vacc = _mm256_mul_ps(vacc, vx);
+    _mm_storeu_si128((__m128i*) y, _mm256_cvtps_ph(vacc, _MM_FROUND_NO_EXC));
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) x));
+    __m256 vacc = _mm256_add_ps(vx, vthree);
+    vx = _mm256_mul_ps(vx, vsixth);
+    vacc = _mm256_max_ps(vacc, vzero);
+    vacc = _mm256_min_ps(vacc, vsix);
+    vacc = _mm256_mul_ps(vacc, vx);
+
+    __m128i vh = _mm256_cvtps_ph(vacc, _MM_FROUND_NO_EXC);
+    if (n & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) y, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      y += 4;
+    }
+    if (n & (2 * sizeof(uint16_t))) {
+      *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      y += 2;
+    }
+    if (n & (1 * sizeof(uint16_t))) {
+      *y = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
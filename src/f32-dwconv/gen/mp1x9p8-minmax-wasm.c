@@ -0,0 +1,315 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-dwconv/mp-scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/dwconv.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const float** input,
+    const float* weights,
+    float* buffer,
+    float* output,
+    size_t input_stride,
+    size_t output_increment,
+    size_t input_offset,
+    const float* zero,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(output_width != 0);
+  assert(kernel_size > 9);
+
+  const float vmin = params->scalar.min;
+  const float vmax = params->scalar.max;
+  do {
+    const float** pass_input = input;
+    const float* w = weights;
+
+    // First pass: initialize the accumulators in the buffer with the bias and the first 9 taps.
+    {
+      const float* i0 = pass_input[0];
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != zero) {
+        i0 = (const float*) ((uintptr_t) i0 + input_offset);
+      }
+      const float* i1 = pass_input[1];
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != zero) {
+        i1 = (const float*) ((uintptr_t) i1 + input_offset);
+      }
+      const float* i2 = pass_input[2];
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != zero) {
+        i2 = (const float*) ((uintptr_t) i2 + input_offset);
+      }
+      const float* i3 = pass_input[3];
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != zero) {
+        i3 = (const float*) ((uintptr_t) i3 + input_offset);
+      }
+      const float* i4 = pass_input[4];
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != zero) {
+        i4 = (const float*) ((uintptr_t) i4 + input_offset);
+      }
+      const float* i5 = pass_input[5];
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != zero) {
+        i5 = (const float*) ((uintptr_t) i5 + input_offset);
+      }
+      const float* i6 = pass_input[6];
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != zero) {
+        i6 = (const float*) ((uintptr_t) i6 + input_offset);
+      }
+      const float* i7 = pass_input[7];
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != zero) {
+        i7 = (const float*) ((uintptr_t) i7 + input_offset);
+      }
+      const float* i8 = pass_input[8];
+      assert(i8 != NULL);
+      if XNN_UNPREDICTABLE(i8 != zero) {
+        i8 = (const float*) ((uintptr_t) i8 + input_offset);
+      }
+      pass_input += 9;
+
+      float* b = buffer;
+      size_t c = channels;
+      do {
+        float vacc0p0 = w[0];
+
+        const float vi0 = *i0++;
+        const float vk0 = w[1];
+        vacc0p0 += vi0 * vk0;
+
+        const float vi1 = *i1++;
+        const float vk1 = w[2];
+        vacc0p0 += vi1 * vk1;
+
+        const float vi2 = *i2++;
+        const float vk2 = w[3];
+        vacc0p0 += vi2 * vk2;
+
+        const float vi3 = *i3++;
+        const float vk3 = w[4];
+        vacc0p0 += vi3 * vk3;
+
+        const float vi4 = *i4++;
+        const float vk4 = w[5];
+        vacc0p0 += vi4 * vk4;
+
+        const float vi5 = *i5++;
+        const float vk5 = w[6];
+        vacc0p0 += vi5 * vk5;
+
+        const float vi6 = *i6++;
+        const float vk6 = w[7];
+        vacc0p0 += vi6 * vk6;
+
+        const float vi7 = *i7++;
+        const float vk7 = w[8];
+        vacc0p0 += vi7 * vk7;
+
+        const float vi8 = *i8++;
+        const float vk8 = w[9];
+        vacc0p0 += vi8 * vk8;
+
+        w += 10;
+
+        *b++ = vacc0p0;
+      } while (--c != 0);
+    }
+
+    // Middle passes: accumulate the next 8 taps into the buffer.
+    size_t k = kernel_size - 9;
+    for (; k > 8; k -= 8) {
+      const float* i0 = pass_input[0];
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != zero) {
+        i0 = (const float*) ((uintptr_t) i0 + input_offset);
+      }
+      const float* i1 = pass_input[1];
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != zero) {
+        i1 = (const float*) ((uintptr_t) i1 + input_offset);
+      }
+      const float* i2 = pass_input[2];
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != zero) {
+        i2 = (const float*) ((uintptr_t) i2 + input_offset);
+      }
+      const float* i3 = pass_input[3];
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != zero) {
+        i3 = (const float*) ((uintptr_t) i3 + input_offset);
+      }
+      const float* i4 = pass_input[4];
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != zero) {
+        i4 = (const float*) ((uintptr_t) i4 + input_offset);
+      }
+      const float* i5 = pass_input[5];
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != zero) {
+        i5 = (const float*) ((uintptr_t) i5 + input_offset);
+      }
+      const float* i6 = pass_input[6];
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != zero) {
+        i6 = (const float*) ((uintptr_t) i6 + input_offset);
+      }
+      const float* i7 = pass_input[7];
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != zero) {
+        i7 = (const float*) ((uintptr_t) i7 + input_offset);
+      }
+      pass_input += 8;
+
+      float* b = buffer;
+      size_t c = channels;
+      do {
+        float vacc0p0 = *b;
+
+        const float vi0 = *i0++;
+        const float vk0 = w[0];
+        vacc0p0 += vi0 * vk0;
+
+        const float vi1 = *i1++;
+        const float vk1 = w[1];
+        vacc0p0 += vi1 * vk1;
+
+        const float vi2 = *i2++;
+        const float vk2 = w[2];
+        vacc0p0 += vi2 * vk2;
+
+        const float vi3 = *i3++;
+        const float vk3 = w[3];
+        vacc0p0 += vi3 * vk3;
+
+        const float vi4 = *i4++;
+        const float vk4 = w[4];
+        vacc0p0 += vi4 * vk4;
+
+        const float vi5 = *i5++;
+        const float vk5 = w[5];
+        vacc0p0 += vi5 * vk5;
+
+        const float vi6 = *i6++;
+        const float vk6 = w[6];
+        vacc0p0 += vi6 * vk6;
+
+        const float vi7 = *i7++;
+        const float vk7 = w[7];
+        vacc0p0 += vi7 * vk7;
+
+        w += 8;
+
+        *b++ = vacc0p0;
+      } while (--c != 0);
+    }
+
+    // Last pass: add up to 8 remaining taps (the weights of the missing taps are zero) and produce the output.
+    {
+      const float* i0 = pass_input[0];
+      assert(i0 != NULL);
+      if XNN_UNPREDICTABLE(i0 != zero) {
+        i0 = (const float*) ((uintptr_t) i0 + input_offset);
+      }
+      const float* i1 = pass_input[1];
+      assert(i1 != NULL);
+      if XNN_UNPREDICTABLE(i1 != zero) {
+        i1 = (const float*) ((uintptr_t) i1 + input_offset);
+      }
+      const float* i2 = pass_input[2];
+      assert(i2 != NULL);
+      if XNN_UNPREDICTABLE(i2 != zero) {
+        i2 = (const float*) ((uintptr_t) i2 + input_offset);
+      }
+      const float* i3 = pass_input[3];
+      assert(i3 != NULL);
+      if XNN_UNPREDICTABLE(i3 != zero) {
+        i3 = (const float*) ((uintptr_t) i3 + input_offset);
+      }
+      const float* i4 = pass_input[4];
+      assert(i4 != NULL);
+      if XNN_UNPREDICTABLE(i4 != zero) {
+        i4 = (const float*) ((uintptr_t) i4 + input_offset);
+      }
+      const float* i5 = pass_input[5];
+      assert(i5 != NULL);
+      if XNN_UNPREDICTABLE(i5 != zero) {
+        i5 = (const float*) ((uintptr_t) i5 + input_offset);
+      }
+      const float* i6 = pass_input[6];
+      assert(i6 != NULL);
+      if XNN_UNPREDICTABLE(i6 != zero) {
+        i6 = (const float*) ((uintptr_t) i6 + input_offset);
+      }
+      const float* i7 = pass_input[7];
+      assert(i7 != NULL);
+      if XNN_UNPREDICTABLE(i7 != zero) {
+        i7 = (const float*) ((uintptr_t) i7 + input_offset);
+      }
+
+      const float* b = buffer;
+      size_t c = channels;
+      do {
+        float vacc0p0 = *b++;
+
+        const float vi0 = *i0++;
+        const float vk0 = w[0];
+        vacc0p0 += vi0 * vk0;
+
+        const float vi1 = *i1++;
+        const float vk1 = w[1];
+        vacc0p0 += vi1 * vk1;
+
+        const float vi2 = *i2++;
+        const float vk2 = w[2];
+        vacc0p0 += vi2 * vk2;
+
+        const float vi3 = *i3++;
+        const float vk3 = w[3];
+        vacc0p0 += vi3 * vk3;
+
+        const float vi4 = *i4++;
+        const float vk4 = w[4];
+        vacc0p0 += vi4 * vk4;
+
+        const float vi5 = *i5++;
+        const float vk5 = w[5];
+        vacc0p0 += vi5 * vk5;
+
+        const float vi6 = *i6++;
+        const float vk6 = w[6];
+        vacc0p0 += vi6 * vk6;
+
+        const float vi7 = *i7++;
+        const float vk7 = w[7];
+        vacc0p0 += vi7 * vk7;
+
+        w += 8;
+
+        float vacc0 = __builtin_wasm_max_f32(vacc0p0, vmin);
+        vacc0 = __builtin_wasm_min_f32(vacc0, vmax);
+        *output++ = vacc0;
+      } while (--c != 0);
+    }
+
+    input = (const float**) ((uintptr_t) input + input_stride);
+    output = (float*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
@@ -0,0 +1,219 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-f16-vcvt/neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_f16_vcvt_ukernel__neon_x16(
+    size_t n,
+    const float* input,
+    void* output,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Conversion rounds to nearest-even, overflows to infinity, and keeps the sign of zero, infinity, and NaN inputs.
+  // Adding a power of 2 with the exponent of the input rebiased for half-precision (but no less than 2**-14) leaves
+  // the rounded half-precision exponent and mantissa in the low bits of the sum.
+  const uint32x4_t vexp_bias = vdupq_n_u32(0x07800000);
+  const float32x4_t vscale_to_inf = vdupq_n_f32(0x1.0p+112f);
+  const uint32x4_t vexpw_max = vdupq_n_u32(0x7F800000);
+  const float32x4_t vscale_to_zero = vdupq_n_f32(0x1.0p-110f);
+  const uint32x4_t vbias_min = vdupq_n_u32(0x40000000);
+  const uint16x8_t vexph_mask = vdupq_n_u16(0x7C00);
+  const uint16x8_t vmanth_mask = vdupq_n_u16(0x0FFF);
+  const uint16x8_t vnanh = vdupq_n_u16(0x7E00);
+
+  uint16_t* o = (uint16_t*) output;
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const float32x4_t vx0 = vld1q_f32(input); input += 4;
+    const float32x4_t vx1 = vld1q_f32(input); input += 4;
+    const float32x4_t vx2 = vld1q_f32(input); input += 4;
+    const float32x4_t vx3 = vld1q_f32(input); input += 4;
+
+    const float32x4_t vabsx0 = vabsq_f32(vx0);
+    const float32x4_t vabsx1 = vabsq_f32(vx1);
+    const float32x4_t vabsx2 = vabsq_f32(vx2);
+    const float32x4_t vabsx3 = vabsq_f32(vx3);
+
+    uint32x4_t vbias0 = vaddq_u32(vreinterpretq_u32_f32(vabsx0), vexp_bias);
+    uint32x4_t vbias1 = vaddq_u32(vreinterpretq_u32_f32(vabsx1), vexp_bias);
+    uint32x4_t vbias2 = vaddq_u32(vreinterpretq_u32_f32(vabsx2), vexp_bias);
+    uint32x4_t vbias3 = vaddq_u32(vreinterpretq_u32_f32(vabsx3), vexp_bias);
+
+    float32x4_t vf0 = vmulq_f32(vabsx0, vscale_to_inf);
+    float32x4_t vf1 = vmulq_f32(vabsx1, vscale_to_inf);
+    float32x4_t vf2 = vmulq_f32(vabsx2, vscale_to_inf);
+    float32x4_t vf3 = vmulq_f32(vabsx3, vscale_to_inf);
+
+    const uint16x8_t vnanmaskh0 = vcombine_u16(
+      vmovn_u32(vcgtq_u32(vreinterpretq_u32_f32(vabsx0), vexpw_max)),
+      vmovn_u32(vcgtq_u32(vreinterpretq_u32_f32(vabsx1), vexpw_max)));
+    const uint16x8_t vnanmaskh1 = vcombine_u16(
+      vmovn_u32(vcgtq_u32(vreinterpretq_u32_f32(vabsx2), vexpw_max)),
+      vmovn_u32(vcgtq_u32(vreinterpretq_u32_f32(vabsx3), vexpw_max)));
+
+    vbias0 = vandq_u32(vbias0, vexpw_max);
+    vbias1 = vandq_u32(vbias1, vexpw_max);
+    vbias2 = vandq_u32(vbias2, vexpw_max);
+    vbias3 = vandq_u32(vbias3, vexpw_max);
+
+    vf0 = vmulq_f32(vf0, vscale_to_zero);
+    vf1 = vmulq_f32(vf1, vscale_to_zero);
+    vf2 = vmulq_f32(vf2, vscale_to_zero);
+    vf3 = vmulq_f32(vf3, vscale_to_zero);
+
+    const uint16x8_t vsignh0 = vcombine_u16(
+      vshrn_n_u32(veorq_u32(vreinterpretq_u32_f32(vx0), vreinterpretq_u32_f32(vabsx0)), 16),
+      vshrn_n_u32(veorq_u32(vreinterpretq_u32_f32(vx1), vreinterpretq_u32_f32(vabsx1)), 16));
+    const uint16x8_t vsignh1 = vcombine_u16(
+      vshrn_n_u32(veorq_u32(vreinterpretq_u32_f32(vx2), vreinterpretq_u32_f32(vabsx2)), 16),
+      vshrn_n_u32(veorq_u32(vreinterpretq_u32_f32(vx3), vreinterpretq_u32_f32(vabsx3)), 16));
+
+    vbias0 = vmaxq_u32(vbias0, vbias_min);
+    vbias1 = vmaxq_u32(vbias1, vbias_min);
+    vbias2 = vmaxq_u32(vbias2, vbias_min);
+    vbias3 = vmaxq_u32(vbias3, vbias_min);
+
+    vf0 = vaddq_f32(vf0, vreinterpretq_f32_u32(vbias0));
+    vf1 = vaddq_f32(vf1, vreinterpretq_f32_u32(vbias1));
+    vf2 = vaddq_f32(vf2, vreinterpretq_f32_u32(vbias2));
+    vf3 = vaddq_f32(vf3, vreinterpretq_f32_u32(vbias3));
+
+    uint16x8_t vexph0 = vcombine_u16(vshrn_n_u32(vreinterpretq_u32_f32(vf0), 13), vshrn_n_u32(vreinterpretq_u32_f32(vf1), 13));
+    uint16x8_t vexph1 = vcombine_u16(vshrn_n_u32(vreinterpretq_u32_f32(vf2), 13), vshrn_n_u32(vreinterpretq_u32_f32(vf3), 13));
+
+    uint16x8_t vmanth0 = vcombine_u16(vmovn_u32(vreinterpretq_u32_f32(vf0)), vmovn_u32(vreinterpretq_u32_f32(vf1)));
+    uint16x8_t vmanth1 = vcombine_u16(vmovn_u32(vreinterpretq_u32_f32(vf2)), vmovn_u32(vreinterpretq_u32_f32(vf3)));
+
+    vexph0 = vandq_u16(vexph0, vexph_mask);
+    vexph1 = vandq_u16(vexph1, vexph_mask);
+
+    vmanth0 = vandq_u16(vmanth0, vmanth_mask);
+    vmanth1 = vandq_u16(vmanth1, vmanth_mask);
+
+    uint16x8_t vh0 = vaddq_u16(vmanth0, vexph0);
+    uint16x8_t vh1 = vaddq_u16(vmanth1, vexph1);
+
+    vh0 = vbslq_u16(vnanmaskh0, vnanh, vh0);
+    vh1 = vbslq_u16(vnanmaskh1, vnanh, vh1);
+
+    vh0 = vorrq_u16(vh0, vsignh0);
+    vh1 = vorrq_u16(vh1, vsignh1);
+
+    vst1q_u16(o, vh0); o += 8;
+    vst1q_u16(o, vh1); o += 8;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const float32x4_t vx_lo = vld1q_f32(input); input += 4;
+    const float32x4_t vx_hi = vld1q_f32(input); input += 4;
+
+    const float32x4_t vabsx_lo = vabsq_f32(vx_lo);
+    const float32x4_t vabsx_hi = vabsq_f32(vx_hi);
+
+    uint32x4_t vbias_lo = vaddq_u32(vreinterpretq_u32_f32(vabsx_lo), vexp_bias);
+    uint32x4_t vbias_hi = vaddq_u32(vreinterpretq_u32_f32(vabsx_hi), vexp_bias);
+    float32x4_t vf_lo = vmulq_f32(vabsx_lo, vscale_to_inf);
+    float32x4_t vf_hi = vmulq_f32(vabsx_hi, vscale_to_inf);
+    const uint16x8_t vnanmaskh = vcombine_u16(
+      vmovn_u32(vcgtq_u32(vreinterpretq_u32_f32(vabsx_lo), vexpw_max)),
+      vmovn_u32(vcgtq_u32(vreinterpretq_u32_f32(vabsx_hi), vexpw_max)));
+
+    vbias_lo = vandq_u32(vbias_lo, vexpw_max);
+    vbias_hi = vandq_u32(vbias_hi, vexpw_max);
+    vf_lo = vmulq_f32(vf_lo, vscale_to_zero);
+    vf_hi = vmulq_f32(vf_hi, vscale_to_zero);
+    const uint16x8_t vsignh = vcombine_u16(
+      vshrn_n_u32(veorq_u32(vreinterpretq_u32_f32(vx_lo), vreinterpretq_u32_f32(vabsx_lo)), 16),
+      vshrn_n_u32(veorq_u32(vreinterpretq_u32_f32(vx_hi), vreinterpretq_u32_f32(vabsx_hi)), 16));
+
+    vbias_lo = vmaxq_u32(vbias_lo, vbias_min);
+    vbias_hi = vmaxq_u32(vbias_hi, vbias_min);
+
+    vf_lo = vaddq_f32(vf_lo, vreinterpretq_f32_u32(vbias_lo));
+    vf_hi = vaddq_f32(vf_hi, vreinterpretq_f32_u32(vbias_hi));
+
+    uint16x8_t vexph = vcombine_u16(vshrn_n_u32(vreinterpretq_u32_f32(vf_lo), 13), vshrn_n_u32(vreinterpretq_u32_f32(vf_hi), 13));
+    uint16x8_t vmanth = vcombine_u16(vmovn_u32(vreinterpretq_u32_f32(vf_lo)), vmovn_u32(vreinterpretq_u32_f32(vf_hi)));
+
+    vexph = vandq_u16(vexph, vexph_mask);
+    vmanth = vandq_u16(vmanth, vmanth_mask);
+
+    uint16x8_t vh = vaddq_u16(vmanth, vexph);
+
+    vh = vbslq_u16(vnanmaskh, vnanh, vh);
+    vh = vorrq_u16(vh, vsignh);
+
+    vst1q_u16(o, vh); o += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const float32x4_t vx_lo = vld1q_f32(input);
+    const float* input_hi = (const float*) ((uintptr_t) input + (n & (4 * sizeof(float))));
+    const float32x4_t vx_hi = vld1q_f32(input_hi);
+
+    const float32x4_t vabsx_lo = vabsq_f32(vx_lo);
+    const float32x4_t vabsx_hi = vabsq_f32(vx_hi);
+
+    uint32x4_t vbias_lo = vaddq_u32(vreinterpretq_u32_f32(vabsx_lo), vexp_bias);
+    uint32x4_t vbias_hi = vaddq_u32(vreinterpretq_u32_f32(vabsx_hi), vexp_bias);
+    float32x4_t vf_lo = vmulq_f32(vabsx_lo, vscale_to_inf);
+    float32x4_t vf_hi = vmulq_f32(vabsx_hi, vscale_to_inf);
+    const uint16x8_t vnanmaskh = vcombine_u16(
+      vmovn_u32(vcgtq_u32(vreinterpretq_u32_f32(vabsx_lo), vexpw_max)),
+      vmovn_u32(vcgtq_u32(vreinterpretq_u32_f32(vabsx_hi), vexpw_max)));
+
+    vbias_lo = vandq_u32(vbias_lo, vexpw_max);
+    vbias_hi = vandq_u32(vbias_hi, vexpw_max);
+    vf_lo = vmulq_f32(vf_lo, vscale_to_zero);
+    vf_hi = vmulq_f32(vf_hi, vscale_to_zero);
+    const uint16x8_t vsignh = vcombine_u16(
+      vshrn_n_u32(veorq_u32(vreinterpretq_u32_f32(vx_lo), vreinterpretq_u32_f32(vabsx_lo)), 16),
+      vshrn_n_u32(veorq_u32(vreinterpretq_u32_f32(vx_hi), vreinterpretq_u32_f32(vabsx_hi)), 16));
+
+    vbias_lo = vmaxq_u32(vbias_lo, vbias_min);
+    vbias_hi = vmaxq_u32(vbias_hi, vbias_min);
+
+    vf_lo = vaddq_f32(vf_lo, vreinterpretq_f32_u32(vbias_lo));
+    vf_hi = vaddq_f32(vf_hi, vreinterpretq_f32_u32(vbias_hi));
+
+    uint16x8_t vexph = vcombine_u16(vshrn_n_u32(vreinterpretq_u32_f32(vf_lo), 13), vshrn_n_u32(vreinterpretq_u32_f32(vf_hi), 13));
+    uint16x8_t vmanth = vcombine_u16(vmovn_u32(vreinterpretq_u32_f32(vf_lo)), vmovn_u32(vreinterpretq_u32_f32(vf_hi)));
+
+    vexph = vandq_u16(vexph, vexph_mask);
+    vmanth = vandq_u16(vmanth, vmanth_mask);
+
+    uint16x8_t vh = vaddq_u16(vmanth, vexph);
+
+    vh = vbslq_u16(vnanmaskh, vnanh, vh);
+    vh = vorrq_u16(vh, vsignh);
+
+    uint16x4_t vh_lo = vget_low_u16(vh);
+    if (n & (4 * sizeof(float))) {
+      vst1_u16(o, vh_lo); o += 4;
+      vh_lo = vget_high_u16(vh);
+    }
+    if (n & (2 * sizeof(float))) {
+      vst1_lane_u32(__builtin_assume_aligned(o, 1), vreinterpret_u32_u16(vh_lo), 0); o += 2;
+      vh_lo = vext_u16(vh_lo, vh_lo, 2);
+    }
+    if (n & (1 * sizeof(float))) {
+      vst1_lane_u16(o, vh_lo, 0);
+    }
+  }
+}
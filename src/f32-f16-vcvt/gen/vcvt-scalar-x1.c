@@ -0,0 +1,35 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-f16-vcvt/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_f16_vcvt_ukernel__scalar_x1(
+    size_t n,
+    const float* input,
+    void* output,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Conversion rounds to nearest-even, overflows to infinity, and keeps the sign of zero, infinity, and NaN inputs.
+  uint16_t* o = (uint16_t*) output;
+  do {
+    *o++ = fp16_ieee_from_fp32_value(*input++);
+    n -= sizeof(float);
+  } while (n != 0);
+}
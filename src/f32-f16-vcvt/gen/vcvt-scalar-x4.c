@@ -0,0 +1,50 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-f16-vcvt/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_f16_vcvt_ukernel__scalar_x4(
+    size_t n,
+    const float* input,
+    void* output,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Conversion rounds to nearest-even, overflows to infinity, and keeps the sign of zero, infinity, and NaN inputs.
+  uint16_t* o = (uint16_t*) output;
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    o[0] = fp16_ieee_from_fp32_value(vx0);
+    o[1] = fp16_ieee_from_fp32_value(vx1);
+    o[2] = fp16_ieee_from_fp32_value(vx2);
+    o[3] = fp16_ieee_from_fp32_value(vx3);
+    o += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      *o++ = fp16_ieee_from_fp32_value(*input++);
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+}
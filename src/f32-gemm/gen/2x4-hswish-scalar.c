@@ -0,0 +1,162 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-gemm/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_gemm_hswish_ukernel_2x4__scalar(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float* restrict a,
+    size_t a_stride,
+    const float* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_hswish_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 2);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+  const float* a1 = (const float*) ((uintptr_t) a0 + a_stride);
+  float* c1 = (float*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+
+  const float vsixth = params->scalar.sixth;
+  const float vthree = params->scalar.three;
+  const float vsix = params->scalar.six;
+  do {
+    float vacc00 = w[0];
+    float vacc01 = w[1];
+    float vacc02 = w[2];
+    float vacc03 = w[3];
+    w += 4;
+    float vacc10 = vacc00;
+    float vacc11 = vacc01;
+    float vacc12 = vacc02;
+    float vacc13 = vacc03;
+
+    size_t k = kc;
+    do {
+      const float va0 = *a0++;
+      const float va1 = *a1++;
+
+      const float vb0 = w[0];
+      const float vb1 = w[1];
+      const float vb2 = w[2];
+      const float vb3 = w[3];
+      w += 4;
+
+      vacc00 += va0 * vb0;
+      vacc01 += va0 * vb1;
+      vacc02 += va0 * vb2;
+      vacc03 += va0 * vb3;
+      vacc10 += va1 * vb0;
+      vacc11 += va1 * vb1;
+      vacc12 += va1 * vb2;
+      vacc13 += va1 * vb3;
+
+      k -= sizeof(float);
+    } while (k != 0);
+
+    float vt00 = vacc00 + vthree;
+    vacc00 *= vsixth;
+    float vt01 = vacc01 + vthree;
+    vacc01 *= vsixth;
+    float vt02 = vacc02 + vthree;
+    vacc02 *= vsixth;
+    float vt03 = vacc03 + vthree;
+    vacc03 *= vsixth;
+    float vt10 = vacc10 + vthree;
+    vacc10 *= vsixth;
+    float vt11 = vacc11 + vthree;
+    vacc11 *= vsixth;
+    float vt12 = vacc12 + vthree;
+    vacc12 *= vsixth;
+    float vt13 = vacc13 + vthree;
+    vacc13 *= vsixth;
+
+    vt00 = math_max_f32(vt00, 0.0f);
+    vt01 = math_max_f32(vt01, 0.0f);
+    vt02 = math_max_f32(vt02, 0.0f);
+    vt03 = math_max_f32(vt03, 0.0f);
+    vt10 = math_max_f32(vt10, 0.0f);
+    vt11 = math_max_f32(vt11, 0.0f);
+    vt12 = math_max_f32(vt12, 0.0f);
+    vt13 = math_max_f32(vt13, 0.0f);
+
+    vt00 = math_min_f32(vt00, vsix);
+    vt01 = math_min_f32(vt01, vsix);
+    vt02 = math_min_f32(vt02, vsix);
+    vt03 = math_min_f32(vt03, vsix);
+    vt10 = math_min_f32(vt10, vsix);
+    vt11 = math_min_f32(vt11, vsix);
+    vt12 = math_min_f32(vt12, vsix);
+    vt13 = math_min_f32(vt13, vsix);
+
+    vacc00 *= vt00;
+    vacc01 *= vt01;
+    vacc02 *= vt02;
+    vacc03 *= vt03;
+    vacc10 *= vt10;
+    vacc11 *= vt11;
+    vacc12 *= vt12;
+    vacc13 *= vt13;
+
+    if XNN_LIKELY(nc >= 4) {
+      c1[0] = vacc10;
+      c1[1] = vacc11;
+      c1[2] = vacc12;
+      c1[3] = vacc13;
+      c1 = (float*) ((uintptr_t) c1 + cn_stride);
+      c0[0] = vacc00;
+      c0[1] = vacc01;
+      c0[2] = vacc02;
+      c0[3] = vacc03;
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a1 = (const void*) ((uintptr_t) a1 - kc);
+      a0 = (const void*) ((uintptr_t) a0 - kc);
+
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        c1[0] = vacc10;
+        c1[1] = vacc11;
+        vacc10 = vacc12;
+        c1 += 2;
+        c0[0] = vacc00;
+        c0[1] = vacc01;
+        vacc00 = vacc02;
+        c0 += 2;
+      }
+      if (nc & 1) {
+        c1[0] = vacc10;
+        c0[0] = vacc00;
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
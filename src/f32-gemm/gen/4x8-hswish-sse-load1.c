@@ -0,0 +1,200 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-gemm/sse-load1.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/gemm.h>
+
+
+void xnn_f32_gemm_hswish_ukernel_4x8__sse_load1(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float*restrict a,
+    size_t a_stride,
+    const float*restrict w,
+    float*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_hswish_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 4);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+  const float* a1 = (const float*) ((uintptr_t) a0 + a_stride);
+  float* c1 = (float*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+  const float* a2 = (const float*) ((uintptr_t) a1 + a_stride);
+  float* c2 = (float*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    a2 = a1;
+    c2 = c1;
+  }
+  const float* a3 = (const float*) ((uintptr_t) a2 + a_stride);
+  float* c3 = (float*) ((uintptr_t) c2 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 4) {
+    a3 = a2;
+    c3 = c2;
+  }
+
+  do {
+    __m128 vacc0x0123 = _mm_load_ps(w + 0);
+    __m128 vacc0x4567 = _mm_load_ps(w + 4);
+    __m128 vacc1x0123 = vacc0x0123;
+    __m128 vacc1x4567 = vacc0x4567;
+    __m128 vacc2x0123 = vacc0x0123;
+    __m128 vacc2x4567 = vacc0x4567;
+    __m128 vacc3x0123 = vacc0x0123;
+    __m128 vacc3x4567 = vacc0x4567;
+    w += 8;
+
+    size_t k = kc;
+    do {
+      const __m128 va0 = _mm_load1_ps(a0);
+      a0 += 1;
+      const __m128 va1 = _mm_load1_ps(a1);
+      a1 += 1;
+      const __m128 va2 = _mm_load1_ps(a2);
+      a2 += 1;
+      const __m128 va3 = _mm_load1_ps(a3);
+      a3 += 1;
+
+      const __m128 vb0123 = _mm_load_ps(w);
+      const __m128 vb4567 = _mm_load_ps(w + 4);
+      w += 8;
+
+      vacc0x0123 = _mm_add_ps(vacc0x0123, _mm_mul_ps(va0, vb0123));
+      vacc1x0123 = _mm_add_ps(vacc1x0123, _mm_mul_ps(va1, vb0123));
+      vacc2x0123 = _mm_add_ps(vacc2x0123, _mm_mul_ps(va2, vb0123));
+      vacc3x0123 = _mm_add_ps(vacc3x0123, _mm_mul_ps(va3, vb0123));
+      vacc0x4567 = _mm_add_ps(vacc0x4567, _mm_mul_ps(va0, vb4567));
+      vacc1x4567 = _mm_add_ps(vacc1x4567, _mm_mul_ps(va1, vb4567));
+      vacc2x4567 = _mm_add_ps(vacc2x4567, _mm_mul_ps(va2, vb4567));
+      vacc3x4567 = _mm_add_ps(vacc3x4567, _mm_mul_ps(va3, vb4567));
+
+      k -= sizeof(float);
+    } while (k != 0);
+
+    const __m128 vsixth = _mm_load_ps(params->sse.sixth);
+    const __m128 vhalf = _mm_load_ps(params->sse.half);
+    const __m128 vone = _mm_load_ps(params->sse.one);
+    const __m128 vzero = _mm_setzero_ps();
+    __m128 vt0x0123 = _mm_add_ps(_mm_mul_ps(vacc0x0123, vsixth), vhalf);
+    __m128 vt1x0123 = _mm_add_ps(_mm_mul_ps(vacc1x0123, vsixth), vhalf);
+    __m128 vt2x0123 = _mm_add_ps(_mm_mul_ps(vacc2x0123, vsixth), vhalf);
+    __m128 vt3x0123 = _mm_add_ps(_mm_mul_ps(vacc3x0123, vsixth), vhalf);
+    __m128 vt0x4567 = _mm_add_ps(_mm_mul_ps(vacc0x4567, vsixth), vhalf);
+    __m128 vt1x4567 = _mm_add_ps(_mm_mul_ps(vacc1x4567, vsixth), vhalf);
+    __m128 vt2x4567 = _mm_add_ps(_mm_mul_ps(vacc2x4567, vsixth), vhalf);
+    __m128 vt3x4567 = _mm_add_ps(_mm_mul_ps(vacc3x4567, vsixth), vhalf);
+
+    vt0x0123 = _mm_max_ps(vt0x0123, vzero);
+    vt1x0123 = _mm_max_ps(vt1x0123, vzero);
+    vt2x0123 = _mm_max_ps(vt2x0123, vzero);
+    vt3x0123 = _mm_max_ps(vt3x0123, vzero);
+    vt0x4567 = _mm_max_ps(vt0x4567, vzero);
+    vt1x4567 = _mm_max_ps(vt1x4567, vzero);
+    vt2x4567 = _mm_max_ps(vt2x4567, vzero);
+    vt3x4567 = _mm_max_ps(vt3x4567, vzero);
+
+    vt0x0123 = _mm_min_ps(vt0x0123, vone);
+    vt1x0123 = _mm_min_ps(vt1x0123, vone);
+    vt2x0123 = _mm_min_ps(vt2x0123, vone);
+    vt3x0123 = _mm_min_ps(vt3x0123, vone);
+    vt0x4567 = _mm_min_ps(vt0x4567, vone);
+    vt1x4567 = _mm_min_ps(vt1x4567, vone);
+    vt2x4567 = _mm_min_ps(vt2x4567, vone);
+    vt3x4567 = _mm_min_ps(vt3x4567, vone);
+
+    vacc0x0123 = _mm_mul_ps(vacc0x0123, vt0x0123);
+    vacc1x0123 = _mm_mul_ps(vacc1x0123, vt1x0123);
+    vacc2x0123 = _mm_mul_ps(vacc2x0123, vt2x0123);
+    vacc3x0123 = _mm_mul_ps(vacc3x0123, vt3x0123);
+    vacc0x4567 = _mm_mul_ps(vacc0x4567, vt0x4567);
+    vacc1x4567 = _mm_mul_ps(vacc1x4567, vt1x4567);
+    vacc2x4567 = _mm_mul_ps(vacc2x4567, vt2x4567);
+    vacc3x4567 = _mm_mul_ps(vacc3x4567, vt3x4567);
+
+    if XNN_LIKELY(nc >= 8) {
+      _mm_storeu_ps(c3, vacc3x0123);
+      _mm_storeu_ps(c3 + 4, vacc3x4567);
+      c3 = (float*) ((uintptr_t) c3 + cn_stride);
+      _mm_storeu_ps(c2, vacc2x0123);
+      _mm_storeu_ps(c2 + 4, vacc2x4567);
+      c2 = (float*) ((uintptr_t) c2 + cn_stride);
+      _mm_storeu_ps(c1, vacc1x0123);
+      _mm_storeu_ps(c1 + 4, vacc1x4567);
+      c1 = (float*) ((uintptr_t) c1 + cn_stride);
+      _mm_storeu_ps(c0, vacc0x0123);
+      _mm_storeu_ps(c0 + 4, vacc0x4567);
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a3 = (const float*) ((uintptr_t) a3 - kc);
+      a2 = (const float*) ((uintptr_t) a2 - kc);
+      a1 = (const float*) ((uintptr_t) a1 - kc);
+      a0 = (const float*) ((uintptr_t) a0 - kc);
+
+      nc -= 8;
+    } else {
+      if (nc & 4) {
+        _mm_storeu_ps(c3, vacc3x0123);
+        _mm_storeu_ps(c2, vacc2x0123);
+        _mm_storeu_ps(c1, vacc1x0123);
+        _mm_storeu_ps(c0, vacc0x0123);
+
+        vacc3x0123 = vacc3x4567;
+        vacc2x0123 = vacc2x4567;
+        vacc1x0123 = vacc1x4567;
+        vacc0x0123 = vacc0x4567;
+
+        c3 += 4;
+        c2 += 4;
+        c1 += 4;
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c3, vacc3x0123);
+        _mm_storel_pi((__m64*) c2, vacc2x0123);
+        _mm_storel_pi((__m64*) c1, vacc1x0123);
+        _mm_storel_pi((__m64*) c0, vacc0x0123);
+
+        vacc3x0123 = _mm_movehl_ps(vacc3x0123, vacc3x0123);
+        vacc2x0123 = _mm_movehl_ps(vacc2x0123, vacc2x0123);
+        vacc1x0123 = _mm_movehl_ps(vacc1x0123, vacc1x0123);
+        vacc0x0123 = _mm_movehl_ps(vacc0x0123, vacc0x0123);
+
+        c3 += 2;
+        c2 += 2;
+        c1 += 2;
+        c0 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c3, vacc3x0123);
+        _mm_store_ss(c2, vacc2x0123);
+        _mm_store_ss(c1, vacc1x0123);
+        _mm_store_ss(c0, vacc0x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
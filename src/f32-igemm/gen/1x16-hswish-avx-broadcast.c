@@ -0,0 +1,128 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-igemm/avx-broadcast.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/igemm.h>
+
+
+void xnn_f32_igemm_hswish_ukernel_1x16__avx_broadcast(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    size_t ks,
+    const float**restrict a,
+    const float*restrict w,
+    float*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    size_t a_offset,
+    const float* zero,
+    const union xnn_f32_hswish_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(ks != 0);
+  assert(ks % (1 * sizeof(void*)) == 0);
+  assert(a_offset % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  float* c0 = c;
+
+  do {
+    __m256 vacc0x01234567 = _mm256_load_ps(w);
+    __m256 vacc0x89ABCDEF = _mm256_load_ps(w + 8);
+    w += 16;
+
+    size_t p = ks;
+    do {
+      const float* restrict a0 = a[0];
+      assert(a0 != NULL);
+      if XNN_UNPREDICTABLE(a0 != zero) {
+        a0 = (const float*) ((uintptr_t) a0 + a_offset);
+      }
+      a += 1;
+
+      size_t k = kc;
+      do {
+        const __m256 vb01234567 = _mm256_load_ps(w);
+        const __m256 vb89ABCDEF = _mm256_load_ps(w + 8);
+        w += 16;
+
+        const __m256 va0 = _mm256_broadcast_ss(a0);
+        a0 += 1;
+
+        vacc0x01234567 = _mm256_add_ps(vacc0x01234567, _mm256_mul_ps(va0, vb01234567));
+        vacc0x89ABCDEF = _mm256_add_ps(vacc0x89ABCDEF, _mm256_mul_ps(va0, vb89ABCDEF));
+        k -= sizeof(float);
+      } while (k != 0);
+      p -= 1 * sizeof(void*);
+    } while (p != 0);
+
+    const __m256 vsixth = _mm256_broadcast_ps((const __m128*) params->sse.sixth);
+    const __m256 vhalf = _mm256_broadcast_ps((const __m128*) params->sse.half);
+    const __m256 vone = _mm256_broadcast_ps((const __m128*) params->sse.one);
+    const __m256 vzero = _mm256_setzero_ps();
+    __m256 vt0x01234567 = _mm256_add_ps(_mm256_mul_ps(vacc0x01234567, vsixth), vhalf);
+    __m256 vt0x89ABCDEF = _mm256_add_ps(_mm256_mul_ps(vacc0x89ABCDEF, vsixth), vhalf);
+
+    vt0x01234567 = _mm256_max_ps(vt0x01234567, vzero);
+    vt0x89ABCDEF = _mm256_max_ps(vt0x89ABCDEF, vzero);
+
+    vt0x01234567 = _mm256_min_ps(vt0x01234567, vone);
+    vt0x89ABCDEF = _mm256_min_ps(vt0x89ABCDEF, vone);
+
+    vacc0x01234567 = _mm256_mul_ps(vacc0x01234567, vt0x01234567);
+    vacc0x89ABCDEF = _mm256_mul_ps(vacc0x89ABCDEF, vt0x89ABCDEF);
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm256_storeu_ps(c0, vacc0x01234567);
+      _mm256_storeu_ps(c0 + 8, vacc0x89ABCDEF);
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a = (const float**restrict) ((uintptr_t) a - ks);
+      nc -= 16;
+    } else {
+      if (nc & 8) {
+        _mm256_storeu_ps(c0, vacc0x01234567);
+
+        vacc0x01234567 = vacc0x89ABCDEF;
+
+        c0 += 8;
+      }
+      __m128 vacc0x0123 = _mm256_castps256_ps128(vacc0x01234567);
+      if (nc & 4) {
+        _mm_storeu_ps(c0, vacc0x0123);
+
+        vacc0x0123 = _mm256_extractf128_ps(vacc0x01234567, 1);
+
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vacc0x0123);
+
+        vacc0x0123 = _mm_movehl_ps(vacc0x0123, vacc0x0123);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vacc0x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
@@ -0,0 +1,50 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_qd8_vcvt_ukernel__scalar(
+    size_t n,
+    const float* x,
+    int8_t* y,
+    struct xnn_qd8_quantization_params* quantization_params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // The quantized range always includes zero, so that zero inputs are quantized exactly.
+  float vmin = 0.0f;
+  float vmax = 0.0f;
+  const float* i = x;
+  size_t k = n;
+  do {
+    const float vx = *i++;
+    vmin = math_min_f32(vmin, vx);
+    vmax = math_max_f32(vmax, vx);
+    k -= sizeof(float);
+  } while (k != 0);
+
+  const float vscale = vmax == vmin ? 1.0f : (vmax - vmin) / 255.0f;
+  const float vinv_scale = 1.0f / vscale;
+  int32_t vzero_point = -128 - (int32_t) lrintf(vmin * vinv_scale);
+  vzero_point = vzero_point > 127 ? 127 : vzero_point;
+  quantization_params->zero_point = vzero_point;
+  quantization_params->scale = vscale;
+
+  const float voutput_min_less_zero_point = (float) (-128 - vzero_point);
+  const float voutput_max_less_zero_point = (float) (127 - vzero_point);
+  do {
+    float vy = *x++ * vinv_scale;
+    vy = math_max_f32(vy, voutput_min_less_zero_point);
+    vy = math_min_f32(vy, voutput_max_less_zero_point);
+    *y++ = (int8_t) ((int32_t) lrintf(vy) + vzero_point);
+    n -= sizeof(float);
+  } while (n != 0);
+}
@@ -0,0 +1,97 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_qd8_vcvt_ukernel__sse2(
+    size_t n,
+    const float* x,
+    int8_t* y,
+    struct xnn_qd8_quantization_params* quantization_params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+
+  // The quantized range always includes zero, so that zero inputs are quantized exactly.
+  __m128 vmin0123 = _mm_setzero_ps();
+  __m128 vmax0123 = _mm_setzero_ps();
+  __m128 vmin4567 = _mm_setzero_ps();
+  __m128 vmax4567 = _mm_setzero_ps();
+  const float* i = x;
+  size_t k = n;
+  for (; k >= 8 * sizeof(float); k -= 8 * sizeof(float)) {
+    const __m128 vx0123 = _mm_loadu_ps(i);
+    const __m128 vx4567 = _mm_loadu_ps(i + 4);
+    i += 8;
+
+    vmin0123 = _mm_min_ps(vmin0123, vx0123);
+    vmax0123 = _mm_max_ps(vmax0123, vx0123);
+    vmin4567 = _mm_min_ps(vmin4567, vx4567);
+    vmax4567 = _mm_max_ps(vmax4567, vx4567);
+  }
+  __m128 vmin = _mm_min_ps(vmin0123, vmin4567);
+  __m128 vmax = _mm_max_ps(vmax0123, vmax4567);
+  for (; k != 0; k -= sizeof(float)) {
+    const __m128 vx = _mm_load_ss(i);
+    i += 1;
+
+    vmin = _mm_min_ss(vmin, vx);
+    vmax = _mm_max_ss(vmax, vx);
+  }
+  vmin = _mm_min_ps(vmin, _mm_movehl_ps(vmin, vmin));
+  vmax = _mm_max_ps(vmax, _mm_movehl_ps(vmax, vmax));
+  vmin = _mm_min_ss(vmin, _mm_shuffle_ps(vmin, vmin, _MM_SHUFFLE(1, 1, 1, 1)));
+  vmax = _mm_max_ss(vmax, _mm_shuffle_ps(vmax, vmax, _MM_SHUFFLE(1, 1, 1, 1)));
+
+  const float vrange_min = _mm_cvtss_f32(vmin);
+  const float vrange_max = _mm_cvtss_f32(vmax);
+  const float vscale = vrange_max == vrange_min ? 1.0f : (vrange_max - vrange_min) / 255.0f;
+  const float vinv_scale = 1.0f / vscale;
+  int32_t vzero_point = -128 - (int32_t) lrintf(vrange_min * vinv_scale);
+  vzero_point = vzero_point > 127 ? 127 : vzero_point;
+  quantization_params->zero_point = vzero_point;
+  quantization_params->scale = vscale;
+
+  // Saturating packing clamps the quantized values to the int8 range after the zero point is added.
+  const __m128 vinv_scale_x4 = _mm_set1_ps(vinv_scale);
+  const __m128i voutput_zero_point = _mm_set1_epi16((short) vzero_point);
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m128i vy0123 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(x), vinv_scale_x4));
+    const __m128i vy4567 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(x + 4), vinv_scale_x4));
+    const __m128i vy89AB = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(x + 8), vinv_scale_x4));
+    const __m128i vyCDEF = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(x + 12), vinv_scale_x4));
+    x += 16;
+
+    const __m128i vy01234567 = _mm_adds_epi16(_mm_packs_epi32(vy0123, vy4567), voutput_zero_point);
+    const __m128i vy89ABCDEF = _mm_adds_epi16(_mm_packs_epi32(vy89AB, vyCDEF), voutput_zero_point);
+
+    const __m128i vy0123456789ABCDEF = _mm_packs_epi16(vy01234567, vy89ABCDEF);
+    _mm_storeu_si128((__m128i*) y, vy0123456789ABCDEF);
+    y += 16;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const __m128i vy0123 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(x), vinv_scale_x4));
+    x += 4;
+
+    const __m128i vy01230123 = _mm_adds_epi16(_mm_packs_epi32(vy0123, vy0123), voutput_zero_point);
+    const __m128i vy = _mm_packs_epi16(vy01230123, vy01230123);
+    *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vy);
+    y += 4;
+  }
+  for (; n != 0; n -= sizeof(float)) {
+    const __m128i vy0 = _mm_cvtps_epi32(_mm_mul_ss(_mm_load_ss(x), vinv_scale_x4));
+    x += 1;
+
+    const __m128i vy00 = _mm_adds_epi16(_mm_packs_epi32(vy0, vy0), voutput_zero_point);
+    const __m128i vy = _mm_packs_epi16(vy00, vy00);
+    *y++ = (int8_t) _mm_cvtsi128_si32(vy);
+  }
+}
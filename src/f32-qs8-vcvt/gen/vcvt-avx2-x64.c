@@ -0,0 +1,146 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-qs8-vcvt/avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+static const int32_t mask_table[14] = {-1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0};
+
+void xnn_f32_qs8_vcvt_ukernel__avx2_x64(
+    size_t n,
+    const float* input,
+    int8_t* output,
+    const union xnn_f32_qs8_cvt_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256 vscale = _mm256_broadcast_ps((const __m128*) params->sse2.scale);
+  const __m256 voutput_min_less_zero_point = _mm256_broadcast_ps((const __m128*) params->sse2.output_min_less_zero_point);
+  const __m256 voutput_max_less_zero_point = _mm256_broadcast_ps((const __m128*) params->sse2.output_max_less_zero_point);
+  const __m256i voutput_zero_point = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) params->sse2.output_zero_point));
+  const __m256i vshuffle_mask = _mm256_set_epi32(7, 3, 6, 2, 5, 1, 4, 0);
+  for (; n >= 64 * sizeof(float); n -= 64 * sizeof(float)) {
+    __m256 vx0 = _mm256_loadu_ps(input);
+    __m256 vx1 = _mm256_loadu_ps(input + 8);
+    __m256 vx2 = _mm256_loadu_ps(input + 16);
+    __m256 vx3 = _mm256_loadu_ps(input + 24);
+    __m256 vx4 = _mm256_loadu_ps(input + 32);
+    __m256 vx5 = _mm256_loadu_ps(input + 40);
+    __m256 vx6 = _mm256_loadu_ps(input + 48);
+    __m256 vx7 = _mm256_loadu_ps(input + 56);
+    input += 64;
+
+    vx0 = _mm256_mul_ps(vx0, vscale);
+    vx1 = _mm256_mul_ps(vx1, vscale);
+    vx2 = _mm256_mul_ps(vx2, vscale);
+    vx3 = _mm256_mul_ps(vx3, vscale);
+    vx4 = _mm256_mul_ps(vx4, vscale);
+    vx5 = _mm256_mul_ps(vx5, vscale);
+    vx6 = _mm256_mul_ps(vx6, vscale);
+    vx7 = _mm256_mul_ps(vx7, vscale);
+
+    vx0 = _mm256_max_ps(vx0, voutput_min_less_zero_point);
+    vx1 = _mm256_max_ps(vx1, voutput_min_less_zero_point);
+    vx2 = _mm256_max_ps(vx2, voutput_min_less_zero_point);
+    vx3 = _mm256_max_ps(vx3, voutput_min_less_zero_point);
+    vx4 = _mm256_max_ps(vx4, voutput_min_less_zero_point);
+    vx5 = _mm256_max_ps(vx5, voutput_min_less_zero_point);
+    vx6 = _mm256_max_ps(vx6, voutput_min_less_zero_point);
+    vx7 = _mm256_max_ps(vx7, voutput_min_less_zero_point);
+
+    vx0 = _mm256_min_ps(vx0, voutput_max_less_zero_point);
+    vx1 = _mm256_min_ps(vx1, voutput_max_less_zero_point);
+    vx2 = _mm256_min_ps(vx2, voutput_max_less_zero_point);
+    vx3 = _mm256_min_ps(vx3, voutput_max_less_zero_point);
+    vx4 = _mm256_min_ps(vx4, voutput_max_less_zero_point);
+    vx5 = _mm256_min_ps(vx5, voutput_max_less_zero_point);
+    vx6 = _mm256_min_ps(vx6, voutput_max_less_zero_point);
+    vx7 = _mm256_min_ps(vx7, voutput_max_less_zero_point);
+
+    const __m256i vacc0 = _mm256_cvtps_epi32(vx0);
+    const __m256i vacc1 = _mm256_cvtps_epi32(vx1);
+    const __m256i vacc2 = _mm256_cvtps_epi32(vx2);
+    const __m256i vacc3 = _mm256_cvtps_epi32(vx3);
+    const __m256i vacc4 = _mm256_cvtps_epi32(vx4);
+    const __m256i vacc5 = _mm256_cvtps_epi32(vx5);
+    const __m256i vacc6 = _mm256_cvtps_epi32(vx6);
+    const __m256i vacc7 = _mm256_cvtps_epi32(vx7);
+
+    __m256i vacc01 = _mm256_packs_epi32(vacc0, vacc1);
+    __m256i vacc23 = _mm256_packs_epi32(vacc2, vacc3);
+    __m256i vacc45 = _mm256_packs_epi32(vacc4, vacc5);
+    __m256i vacc67 = _mm256_packs_epi32(vacc6, vacc7);
+
+    vacc01 = _mm256_adds_epi16(vacc01, voutput_zero_point);
+    vacc23 = _mm256_adds_epi16(vacc23, voutput_zero_point);
+    vacc45 = _mm256_adds_epi16(vacc45, voutput_zero_point);
+    vacc67 = _mm256_adds_epi16(vacc67, voutput_zero_point);
+
+    const __m256i vy0 = _mm256_permutevar8x32_epi32(_mm256_packs_epi16(vacc01, vacc23), vshuffle_mask);
+    const __m256i vy1 = _mm256_permutevar8x32_epi32(_mm256_packs_epi16(vacc45, vacc67), vshuffle_mask);
+
+    _mm256_storeu_si256((__m256i*) output, vy0);
+    _mm256_storeu_si256((__m256i*) (output + 32), vy1);
+    output += 64;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    __m256 vx = _mm256_loadu_ps(input);
+    vx = _mm256_mul_ps(vx, vscale);
+    vx = _mm256_max_ps(vx, voutput_min_less_zero_point);
+    vx = _mm256_min_ps(vx, voutput_max_less_zero_point);
+    input += 8;
+
+    const __m256i vacc = _mm256_cvtps_epi32(vx);
+
+    __m128i vy = _mm_packs_epi32(_mm256_castsi256_si128(vacc), _mm256_extracti128_si256(vacc, 1));
+    vy = _mm_adds_epi16(vy, _mm256_castsi256_si128(voutput_zero_point));
+    vy = _mm_packs_epi16(vy, vy);
+
+    _mm_storel_epi64((__m128i*) output, vy);
+    output += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &mask_table[7] - n));
+
+    __m256 vx = _mm256_maskload_ps(input, vmask);
+    vx = _mm256_mul_ps(vx, vscale);
+    vx = _mm256_max_ps(vx, voutput_min_less_zero_point);
+    vx = _mm256_min_ps(vx, voutput_max_less_zero_point);
+
+    const __m256i vacc = _mm256_cvtps_epi32(vx);
+
+    __m128i vy = _mm_packs_epi32(_mm256_castsi256_si128(vacc), _mm256_extracti128_si256(vacc, 1));
+    vy = _mm_adds_epi16(vy, _mm256_castsi256_si128(voutput_zero_point));
+    vy = _mm_packs_epi16(vy, vy);
+
+    if (n & (4 * sizeof(float))) {
+      *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vy);
+      output += 4;
+      vy = _mm_srli_epi64(vy, 32);
+    }
+    if (n & (2 * sizeof(float))) {
+      *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vy, 0);
+      output += 2;
+      vy = _mm_srli_epi32(vy, 16);
+    }
+    if (n & (1 * sizeof(float))) {
+      *output = (int8_t) _mm_cvtsi128_si32(vy);
+    }
+  }
+}
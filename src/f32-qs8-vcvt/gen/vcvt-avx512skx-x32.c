@@ -0,0 +1,101 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-qs8-vcvt/avx512skx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_qs8_vcvt_ukernel__avx512skx_x32(
+    size_t n,
+    const float* input,
+    int8_t* output,
+    const union xnn_f32_qs8_cvt_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m512 vscale = _mm512_broadcast_f32x4(_mm_load_ps(params->sse2.scale));
+  const __m512 voutput_min_less_zero_point = _mm512_broadcast_f32x4(_mm_load_ps(params->sse2.output_min_less_zero_point));
+  const __m512 voutput_max_less_zero_point = _mm512_broadcast_f32x4(_mm_load_ps(params->sse2.output_max_less_zero_point));
+  const __m512i voutput_zero_point = _mm512_broadcast_i32x4(_mm_load_si128((const __m128i*) params->sse2.output_zero_point));
+  // Saturating packs interleave the 128-bit lanes of their operands; this permutation restores the original order.
+  const __m512i vshuffle_mask = _mm512_set_epi32(15, 11, 7, 3, 14, 10, 6, 2, 13, 9, 5, 1, 12, 8, 4, 0);
+  for (; n >= 32 * sizeof(float); n -= 32 * sizeof(float)) {
+    __m512 vx0 = _mm512_loadu_ps(input);
+    __m512 vx1 = _mm512_loadu_ps(input + 16);
+    input += 32;
+
+    vx0 = _mm512_mul_ps(vx0, vscale);
+    vx1 = _mm512_mul_ps(vx1, vscale);
+
+    vx0 = _mm512_max_ps(vx0, voutput_min_less_zero_point);
+    vx1 = _mm512_max_ps(vx1, voutput_min_less_zero_point);
+
+    vx0 = _mm512_min_ps(vx0, voutput_max_less_zero_point);
+    vx1 = _mm512_min_ps(vx1, voutput_max_less_zero_point);
+
+    const __m512i vacc0 = _mm512_cvtps_epi32(vx0);
+    const __m512i vacc1 = _mm512_cvtps_epi32(vx1);
+
+    __m512i vacc01 = _mm512_packs_epi32(vacc0, vacc1);
+
+    vacc01 = _mm512_adds_epi16(vacc01, voutput_zero_point);
+
+    const __m256i vy0 = _mm512_castsi512_si256(_mm512_permutexvar_epi32(vshuffle_mask, _mm512_packs_epi16(vacc01, vacc01)));
+
+    _mm256_storeu_si256((__m256i*) output, vy0);
+    output += 32;
+  }
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    __m512 vx = _mm512_loadu_ps(input);
+    vx = _mm512_mul_ps(vx, vscale);
+    vx = _mm512_max_ps(vx, voutput_min_less_zero_point);
+    vx = _mm512_min_ps(vx, voutput_max_less_zero_point);
+    input += 16;
+
+    const __m512i vacc = _mm512_cvtps_epi32(vx);
+
+    __m512i vy = _mm512_packs_epi32(vacc, vacc);
+    vy = _mm512_adds_epi16(vy, voutput_zero_point);
+    vy = _mm512_packs_epi16(vy, vy);
+    vy = _mm512_permutexvar_epi32(vshuffle_mask, vy);
+
+    _mm_storeu_si128((__m128i*) output, _mm512_castsi512_si128(vy));
+    output += 16;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 15 * sizeof(float));
+
+    // Prepare mask for valid elements (depends on n).
+    n >>= 2 /* log2(sizeof(float)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << n) - UINT32_C(1)));
+
+    __m512 vx = _mm512_maskz_loadu_ps(vmask, input);
+    vx = _mm512_mul_ps(vx, vscale);
+    vx = _mm512_max_ps(vx, voutput_min_less_zero_point);
+    vx = _mm512_min_ps(vx, voutput_max_less_zero_point);
+
+    const __m512i vacc = _mm512_cvtps_epi32(vx);
+
+    __m512i vy = _mm512_packs_epi32(vacc, vacc);
+    vy = _mm512_adds_epi16(vy, voutput_zero_point);
+    vy = _mm512_packs_epi16(vy, vy);
+    vy = _mm512_permutexvar_epi32(vshuffle_mask, vy);
+
+    _mm_mask_storeu_epi8(output, vmask, _mm512_castsi512_si128(vy));
+  }
+}
@@ -0,0 +1,135 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-qs8-vcvt/neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_qs8_vcvt_ukernel__neon_x16(
+    size_t n,
+    const float* input,
+    int8_t* output,
+    const union xnn_f32_qs8_cvt_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // ARMv7 NEON lacks a conversion with rounding to nearest-even, so scaled inputs are clamped to
+  // [output_min - zero point, output_max - zero point] and rounded by adding 1.5 * 2**23 as a "magic" bias.
+  const float32x4_t vscale = vld1q_dup_f32(&params->neon.scale);
+  const float32x4_t voutput_min_less_zero_point = vld1q_dup_f32(&params->neon.output_min_less_zero_point);
+  const float32x4_t voutput_max_less_zero_point = vld1q_dup_f32(&params->neon.output_max_less_zero_point);
+  const float32x4_t vmagic_bias = vld1q_dup_f32(&params->neon.magic_bias);
+  const int32x4_t vmagic_bias_less_zero_point = vld1q_dup_s32(&params->neon.magic_bias_less_zero_point);
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    float32x4_t vx0 = vld1q_f32(input); input += 4;
+    float32x4_t vx1 = vld1q_f32(input); input += 4;
+    float32x4_t vx2 = vld1q_f32(input); input += 4;
+    float32x4_t vx3 = vld1q_f32(input); input += 4;
+
+    vx0 = vmulq_f32(vx0, vscale);
+    vx1 = vmulq_f32(vx1, vscale);
+    vx2 = vmulq_f32(vx2, vscale);
+    vx3 = vmulq_f32(vx3, vscale);
+
+    vx0 = vmaxq_f32(vx0, voutput_min_less_zero_point);
+    vx1 = vmaxq_f32(vx1, voutput_min_less_zero_point);
+    vx2 = vmaxq_f32(vx2, voutput_min_less_zero_point);
+    vx3 = vmaxq_f32(vx3, voutput_min_less_zero_point);
+
+    vx0 = vminq_f32(vx0, voutput_max_less_zero_point);
+    vx1 = vminq_f32(vx1, voutput_max_less_zero_point);
+    vx2 = vminq_f32(vx2, voutput_max_less_zero_point);
+    vx3 = vminq_f32(vx3, voutput_max_less_zero_point);
+
+    vx0 = vaddq_f32(vx0, vmagic_bias);
+    vx1 = vaddq_f32(vx1, vmagic_bias);
+    vx2 = vaddq_f32(vx2, vmagic_bias);
+    vx3 = vaddq_f32(vx3, vmagic_bias);
+
+    const int32x4_t vacc0 = vsubq_s32(vreinterpretq_s32_f32(vx0), vmagic_bias_less_zero_point);
+    const int32x4_t vacc1 = vsubq_s32(vreinterpretq_s32_f32(vx1), vmagic_bias_less_zero_point);
+    const int32x4_t vacc2 = vsubq_s32(vreinterpretq_s32_f32(vx2), vmagic_bias_less_zero_point);
+    const int32x4_t vacc3 = vsubq_s32(vreinterpretq_s32_f32(vx3), vmagic_bias_less_zero_point);
+
+    const int16x8_t vacc01 = vcombine_s16(vmovn_s32(vacc0), vmovn_s32(vacc1));
+    const int16x8_t vacc23 = vcombine_s16(vmovn_s32(vacc2), vmovn_s32(vacc3));
+
+    const int8x16_t vy0 = vcombine_s8(vmovn_s16(vacc01), vmovn_s16(vacc23));
+
+    vst1q_s8(output, vy0); output += 16;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    float32x4_t vx_lo = vld1q_f32(input); input += 4;
+    float32x4_t vx_hi = vld1q_f32(input); input += 4;
+
+    vx_lo = vmulq_f32(vx_lo, vscale);
+    vx_hi = vmulq_f32(vx_hi, vscale);
+
+    vx_lo = vmaxq_f32(vx_lo, voutput_min_less_zero_point);
+    vx_hi = vmaxq_f32(vx_hi, voutput_min_less_zero_point);
+
+    vx_lo = vminq_f32(vx_lo, voutput_max_less_zero_point);
+    vx_hi = vminq_f32(vx_hi, voutput_max_less_zero_point);
+
+    vx_lo = vaddq_f32(vx_lo, vmagic_bias);
+    vx_hi = vaddq_f32(vx_hi, vmagic_bias);
+
+    const int32x4_t vacc_lo = vsubq_s32(vreinterpretq_s32_f32(vx_lo), vmagic_bias_less_zero_point);
+    const int32x4_t vacc_hi = vsubq_s32(vreinterpretq_s32_f32(vx_hi), vmagic_bias_less_zero_point);
+
+    const int16x8_t vacc = vcombine_s16(vmovn_s32(vacc_lo), vmovn_s32(vacc_hi));
+
+    const int8x8_t vy = vmovn_s16(vacc);
+    vst1_s8(output, vy); output += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    float32x4_t vx_lo = vld1q_f32(input);
+    const float* input_hi = (const float*) ((uintptr_t) input + (n & (4 * sizeof(float))));
+    float32x4_t vx_hi = vld1q_f32(input_hi);
+
+    vx_lo = vmulq_f32(vx_lo, vscale);
+    vx_hi = vmulq_f32(vx_hi, vscale);
+
+    vx_lo = vmaxq_f32(vx_lo, voutput_min_less_zero_point);
+    vx_hi = vmaxq_f32(vx_hi, voutput_min_less_zero_point);
+
+    vx_lo = vminq_f32(vx_lo, voutput_max_less_zero_point);
+    vx_hi = vminq_f32(vx_hi, voutput_max_less_zero_point);
+
+    vx_lo = vaddq_f32(vx_lo, vmagic_bias);
+    vx_hi = vaddq_f32(vx_hi, vmagic_bias);
+
+    const int32x4_t vacc_lo = vsubq_s32(vreinterpretq_s32_f32(vx_lo), vmagic_bias_less_zero_point);
+    const int32x4_t vacc_hi = vsubq_s32(vreinterpretq_s32_f32(vx_hi), vmagic_bias_less_zero_point);
+
+    const int16x8_t vacc = vcombine_s16(vmovn_s32(vacc_lo), vmovn_s32(vacc_hi));
+
+    int8x8_t vy = vmovn_s16(vacc);
+    if (n & (4 * sizeof(float))) {
+      vst1_lane_u32(__builtin_assume_aligned(output, 1), vreinterpret_u32_s8(vy), 0); output += 4;
+      vy = vext_s8(vy, vy, 4);
+    }
+    if (n & (2 * sizeof(float))) {
+      vst1_lane_u16(__builtin_assume_aligned(output, 1), vreinterpret_u16_s8(vy), 0); output += 2;
+      vy = vext_s8(vy, vy, 2);
+    }
+    if (n & (1 * sizeof(float))) {
+      vst1_lane_s8(output, vy, 0);
+    }
+  }
+}
@@ -0,0 +1,114 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-qs8-vcvt/neonv8.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_qs8_vcvt_ukernel__neonv8_x16(
+    size_t n,
+    const float* input,
+    int8_t* output,
+    const union xnn_f32_qs8_cvt_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Scaled inputs are converted with rounding to nearest-even, and saturating narrowing keeps them in range before
+  // the zero point is added and the result is clamped to [output_min, output_max].
+  const float32x4_t vscale = vld1q_dup_f32(&params->neon.scale);
+  const int16x8_t voutput_zero_point = vld1q_dup_s16(&params->neon.output_zero_point);
+  const int8x16_t voutput_min = vld1q_dup_s8(&params->neon.output_min);
+  const int8x16_t voutput_max = vld1q_dup_s8(&params->neon.output_max);
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    float32x4_t vx0 = vld1q_f32(input); input += 4;
+    float32x4_t vx1 = vld1q_f32(input); input += 4;
+    float32x4_t vx2 = vld1q_f32(input); input += 4;
+    float32x4_t vx3 = vld1q_f32(input); input += 4;
+
+    vx0 = vmulq_f32(vx0, vscale);
+    vx1 = vmulq_f32(vx1, vscale);
+    vx2 = vmulq_f32(vx2, vscale);
+    vx3 = vmulq_f32(vx3, vscale);
+
+    const int32x4_t vacc0 = vcvtnq_s32_f32(vx0);
+    const int32x4_t vacc1 = vcvtnq_s32_f32(vx1);
+    const int32x4_t vacc2 = vcvtnq_s32_f32(vx2);
+    const int32x4_t vacc3 = vcvtnq_s32_f32(vx3);
+
+    int16x8_t vacc01 = vcombine_s16(vqmovn_s32(vacc0), vqmovn_s32(vacc1));
+    int16x8_t vacc23 = vcombine_s16(vqmovn_s32(vacc2), vqmovn_s32(vacc3));
+
+    vacc01 = vqaddq_s16(vacc01, voutput_zero_point);
+    vacc23 = vqaddq_s16(vacc23, voutput_zero_point);
+
+    int8x16_t vy0 = vcombine_s8(vqmovn_s16(vacc01), vqmovn_s16(vacc23));
+
+    vy0 = vmaxq_s8(vy0, voutput_min);
+
+    vy0 = vminq_s8(vy0, voutput_max);
+
+    vst1q_s8(output, vy0); output += 16;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    float32x4_t vx_lo = vld1q_f32(input); input += 4;
+    float32x4_t vx_hi = vld1q_f32(input); input += 4;
+
+    vx_lo = vmulq_f32(vx_lo, vscale);
+    vx_hi = vmulq_f32(vx_hi, vscale);
+
+    const int32x4_t vacc_lo = vcvtnq_s32_f32(vx_lo);
+    const int32x4_t vacc_hi = vcvtnq_s32_f32(vx_hi);
+
+    int16x8_t vacc = vcombine_s16(vqmovn_s32(vacc_lo), vqmovn_s32(vacc_hi));
+    vacc = vqaddq_s16(vacc, voutput_zero_point);
+
+    int8x8_t vy = vqmovn_s16(vacc);
+    vy = vmax_s8(vy, vget_low_s8(voutput_min));
+    vy = vmin_s8(vy, vget_low_s8(voutput_max));
+    vst1_s8(output, vy); output += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    float32x4_t vx_lo = vld1q_f32(input);
+    const float* input_hi = (const float*) ((uintptr_t) input + (n & (4 * sizeof(float))));
+    float32x4_t vx_hi = vld1q_f32(input_hi);
+
+    vx_lo = vmulq_f32(vx_lo, vscale);
+    vx_hi = vmulq_f32(vx_hi, vscale);
+
+    const int32x4_t vacc_lo = vcvtnq_s32_f32(vx_lo);
+    const int32x4_t vacc_hi = vcvtnq_s32_f32(vx_hi);
+
+    int16x8_t vacc = vcombine_s16(vqmovn_s32(vacc_lo), vqmovn_s32(vacc_hi));
+    vacc = vqaddq_s16(vacc, voutput_zero_point);
+
+    int8x8_t vy = vqmovn_s16(vacc);
+    vy = vmax_s8(vy, vget_low_s8(voutput_min));
+    vy = vmin_s8(vy, vget_low_s8(voutput_max));
+    if (n & (4 * sizeof(float))) {
+      vst1_lane_u32(__builtin_assume_aligned(output, 1), vreinterpret_u32_s8(vy), 0); output += 4;
+      vy = vext_s8(vy, vy, 4);
+    }
+    if (n & (2 * sizeof(float))) {
+      vst1_lane_u16(__builtin_assume_aligned(output, 1), vreinterpret_u16_s8(vy), 0); output += 2;
+      vy = vext_s8(vy, vy, 2);
+    }
+    if (n & (1 * sizeof(float))) {
+      vst1_lane_s8(output, vy, 0);
+    }
+  }
+}
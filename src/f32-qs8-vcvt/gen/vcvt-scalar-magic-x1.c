@@ -0,0 +1,50 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-qs8-vcvt/scalar-magic.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_qs8_vcvt_ukernel__scalar_magic_x1(
+    size_t n,
+    const float* input,
+    int8_t* output,
+    const union xnn_f32_qs8_cvt_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Scaled inputs are clamped to [output_min - zero point, output_max - zero point] and rounded to nearest-even by
+  // adding 1.5 * 2**23 as a "magic" bias, which also keeps them within the range where the magic trick is exact.
+  const float vscale = params->scalar.scale;
+  const float voutput_min_less_zero_point = params->scalar.output_min_less_zero_point;
+  const float voutput_max_less_zero_point = params->scalar.output_max_less_zero_point;
+  const float vmagic_bias = params->scalar.magic_bias;
+  const int32_t vmagic_bias_less_zero_point = params->scalar.magic_bias_less_zero_point;
+
+  do {
+    float vx = *input++;
+    vx *= vscale;
+    vx = math_max_f32(vx, voutput_min_less_zero_point);
+    vx = math_min_f32(vx, voutput_max_less_zero_point);
+    vx += vmagic_bias;
+
+    const int32_t vy = (int32_t) fp32_to_bits(vx) - vmagic_bias_less_zero_point;
+    *output++ = (int8_t) vy;
+
+    n -= sizeof(float);
+  } while (n != 0);
+}
@@ -0,0 +1,160 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-qs8-vcvt/sse2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_qs8_vcvt_ukernel__sse2_x32(
+    size_t n,
+    const float* input,
+    int8_t* output,
+    const union xnn_f32_qs8_cvt_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Scaled inputs are clamped to [output_min - zero point, output_max - zero point] and converted with the default
+  // round-to-nearest-even mode, so neither the saturating packs nor the zero point addition can overflow.
+  const __m128 vscale = _mm_load_ps(params->sse2.scale);
+  const __m128 voutput_min_less_zero_point = _mm_load_ps(params->sse2.output_min_less_zero_point);
+  const __m128 voutput_max_less_zero_point = _mm_load_ps(params->sse2.output_max_less_zero_point);
+  const __m128i voutput_zero_point = _mm_load_si128((const __m128i*) params->sse2.output_zero_point);
+  for (; n >= 32 * sizeof(float); n -= 32 * sizeof(float)) {
+    __m128 vx0123 = _mm_loadu_ps(input);
+    __m128 vx4567 = _mm_loadu_ps(input + 4);
+    __m128 vx89AB = _mm_loadu_ps(input + 8);
+    __m128 vxCDEF = _mm_loadu_ps(input + 12);
+    __m128 vxGHIJ = _mm_loadu_ps(input + 16);
+    __m128 vxKLMN = _mm_loadu_ps(input + 20);
+    __m128 vxOPQR = _mm_loadu_ps(input + 24);
+    __m128 vxSTUV = _mm_loadu_ps(input + 28);
+    input += 32;
+
+    vx0123 = _mm_mul_ps(vx0123, vscale);
+    vx4567 = _mm_mul_ps(vx4567, vscale);
+    vx89AB = _mm_mul_ps(vx89AB, vscale);
+    vxCDEF = _mm_mul_ps(vxCDEF, vscale);
+    vxGHIJ = _mm_mul_ps(vxGHIJ, vscale);
+    vxKLMN = _mm_mul_ps(vxKLMN, vscale);
+    vxOPQR = _mm_mul_ps(vxOPQR, vscale);
+    vxSTUV = _mm_mul_ps(vxSTUV, vscale);
+
+    vx0123 = _mm_max_ps(vx0123, voutput_min_less_zero_point);
+    vx4567 = _mm_max_ps(vx4567, voutput_min_less_zero_point);
+    vx89AB = _mm_max_ps(vx89AB, voutput_min_less_zero_point);
+    vxCDEF = _mm_max_ps(vxCDEF, voutput_min_less_zero_point);
+    vxGHIJ = _mm_max_ps(vxGHIJ, voutput_min_less_zero_point);
+    vxKLMN = _mm_max_ps(vxKLMN, voutput_min_less_zero_point);
+    vxOPQR = _mm_max_ps(vxOPQR, voutput_min_less_zero_point);
+    vxSTUV = _mm_max_ps(vxSTUV, voutput_min_less_zero_point);
+
+    vx0123 = _mm_min_ps(vx0123, voutput_max_less_zero_point);
+    vx4567 = _mm_min_ps(vx4567, voutput_max_less_zero_point);
+    vx89AB = _mm_min_ps(vx89AB, voutput_max_less_zero_point);
+    vxCDEF = _mm_min_ps(vxCDEF, voutput_max_less_zero_point);
+    vxGHIJ = _mm_min_ps(vxGHIJ, voutput_max_less_zero_point);
+    vxKLMN = _mm_min_ps(vxKLMN, voutput_max_less_zero_point);
+    vxOPQR = _mm_min_ps(vxOPQR, voutput_max_less_zero_point);
+    vxSTUV = _mm_min_ps(vxSTUV, voutput_max_less_zero_point);
+
+    const __m128i vy0123 = _mm_cvtps_epi32(vx0123);
+    const __m128i vy4567 = _mm_cvtps_epi32(vx4567);
+    const __m128i vy89AB = _mm_cvtps_epi32(vx89AB);
+    const __m128i vyCDEF = _mm_cvtps_epi32(vxCDEF);
+    const __m128i vyGHIJ = _mm_cvtps_epi32(vxGHIJ);
+    const __m128i vyKLMN = _mm_cvtps_epi32(vxKLMN);
+    const __m128i vyOPQR = _mm_cvtps_epi32(vxOPQR);
+    const __m128i vySTUV = _mm_cvtps_epi32(vxSTUV);
+
+    __m128i vy01234567 = _mm_packs_epi32(vy0123, vy4567);
+    __m128i vy89ABCDEF = _mm_packs_epi32(vy89AB, vyCDEF);
+    __m128i vyGHIJKLMN = _mm_packs_epi32(vyGHIJ, vyKLMN);
+    __m128i vyOPQRSTUV = _mm_packs_epi32(vyOPQR, vySTUV);
+
+    vy01234567 = _mm_adds_epi16(vy01234567, voutput_zero_point);
+    vy89ABCDEF = _mm_adds_epi16(vy89ABCDEF, voutput_zero_point);
+    vyGHIJKLMN = _mm_adds_epi16(vyGHIJKLMN, voutput_zero_point);
+    vyOPQRSTUV = _mm_adds_epi16(vyOPQRSTUV, voutput_zero_point);
+
+    const __m128i vy0123456789ABCDEF = _mm_packs_epi16(vy01234567, vy89ABCDEF);
+    const __m128i vyGHIJKLMNOPQRSTUV = _mm_packs_epi16(vyGHIJKLMN, vyOPQRSTUV);
+
+    _mm_storeu_si128((__m128i*) output, vy0123456789ABCDEF);
+    _mm_storeu_si128((__m128i*) (output + 16), vyGHIJKLMNOPQRSTUV);
+    output += 32;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    __m128 vx_lo = _mm_loadu_ps(input);
+    __m128 vx_hi = _mm_loadu_ps(input + 4);
+    input += 8;
+
+    vx_lo = _mm_mul_ps(vx_lo, vscale);
+    vx_hi = _mm_mul_ps(vx_hi, vscale);
+
+    vx_lo = _mm_max_ps(vx_lo, voutput_min_less_zero_point);
+    vx_hi = _mm_max_ps(vx_hi, voutput_min_less_zero_point);
+
+    vx_lo = _mm_min_ps(vx_lo, voutput_max_less_zero_point);
+    vx_hi = _mm_min_ps(vx_hi, voutput_max_less_zero_point);
+
+    const __m128i vy_lo = _mm_cvtps_epi32(vx_lo);
+    const __m128i vy_hi = _mm_cvtps_epi32(vx_hi);
+
+    __m128i vy = _mm_packs_epi32(vy_lo, vy_hi);
+    vy = _mm_adds_epi16(vy, voutput_zero_point);
+    vy = _mm_packs_epi16(vy, vy);
+
+    _mm_storel_epi64((__m128i*) output, vy);
+    output += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    __m128 vx_lo = _mm_loadu_ps(input);
+    const float* input_hi = (const float*) ((uintptr_t) input + (n & (4 * sizeof(float))));
+    __m128 vx_hi = _mm_loadu_ps(input_hi);
+
+    vx_lo = _mm_mul_ps(vx_lo, vscale);
+    vx_hi = _mm_mul_ps(vx_hi, vscale);
+
+    vx_lo = _mm_max_ps(vx_lo, voutput_min_less_zero_point);
+    vx_hi = _mm_max_ps(vx_hi, voutput_min_less_zero_point);
+
+    vx_lo = _mm_min_ps(vx_lo, voutput_max_less_zero_point);
+    vx_hi = _mm_min_ps(vx_hi, voutput_max_less_zero_point);
+
+    const __m128i vy_lo = _mm_cvtps_epi32(vx_lo);
+    const __m128i vy_hi = _mm_cvtps_epi32(vx_hi);
+
+    __m128i vy = _mm_packs_epi32(vy_lo, vy_hi);
+    vy = _mm_adds_epi16(vy, voutput_zero_point);
+    vy = _mm_packs_epi16(vy, vy);
+
+    if (n & (4 * sizeof(float))) {
+      *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vy);
+      output += 4;
+      vy = _mm_srli_epi64(vy, 32);
+    }
+    if (n & (2 * sizeof(float))) {
+      *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vy, 0);
+      output += 2;
+      vy = _mm_srli_epi32(vy, 16);
+    }
+    if (n & (1 * sizeof(float))) {
+      *output = (int8_t) _mm_cvtsi128_si32(vy);
+    }
+  }
+}
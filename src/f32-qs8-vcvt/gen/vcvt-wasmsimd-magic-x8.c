@@ -0,0 +1,101 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-qs8-vcvt/wasmsimd-magic.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <wasm_simd128.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_qs8_vcvt_ukernel__wasmsimd_magic_x8(
+    size_t n,
+    const float* input,
+    int8_t* output,
+    const union xnn_f32_qs8_cvt_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // WAsm SIMD offers only a conversion with rounding towards zero, so scaled inputs are clamped to
+  // [output_min - zero point, output_max - zero point] and rounded by adding 1.5 * 2**23 as a "magic" bias.
+  const v128_t vscale = wasm_v32x4_load_splat(&params->wasmsimd.scale);
+  const v128_t voutput_min_less_zero_point = wasm_v32x4_load_splat(&params->wasmsimd.output_min_less_zero_point);
+  const v128_t voutput_max_less_zero_point = wasm_v32x4_load_splat(&params->wasmsimd.output_max_less_zero_point);
+  const v128_t vmagic_bias = wasm_v32x4_load_splat(&params->wasmsimd.magic_bias);
+  const v128_t vmagic_bias_less_zero_point = wasm_v32x4_load_splat(&params->wasmsimd.magic_bias_less_zero_point);
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    v128_t vx_lo = wasm_v128_load(input);
+    v128_t vx_hi = wasm_v128_load(input + 4);
+    input += 8;
+
+    vx_lo = wasm_f32x4_mul(vx_lo, vscale);
+    vx_hi = wasm_f32x4_mul(vx_hi, vscale);
+
+    vx_lo = wasm_f32x4_max(vx_lo, voutput_min_less_zero_point);
+    vx_hi = wasm_f32x4_max(vx_hi, voutput_min_less_zero_point);
+
+    vx_lo = wasm_f32x4_min(vx_lo, voutput_max_less_zero_point);
+    vx_hi = wasm_f32x4_min(vx_hi, voutput_max_less_zero_point);
+
+    vx_lo = wasm_f32x4_add(vx_lo, vmagic_bias);
+    vx_hi = wasm_f32x4_add(vx_hi, vmagic_bias);
+
+    const v128_t vacc_lo = wasm_i32x4_sub(vx_lo, vmagic_bias_less_zero_point);
+    const v128_t vacc_hi = wasm_i32x4_sub(vx_hi, vmagic_bias_less_zero_point);
+
+    const v128_t vacc = wasm_i16x8_narrow_i32x4(vacc_lo, vacc_hi);
+
+    const v128_t vy = wasm_i8x16_narrow_i16x8(vacc, vacc);
+    *((double*) output) = wasm_f64x2_extract_lane(vy, 0);
+    output += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    v128_t vx_lo = wasm_v128_load(input);
+    const float* input_hi = (const float*) ((uintptr_t) input + (n & (4 * sizeof(float))));
+    v128_t vx_hi = wasm_v128_load(input_hi);
+
+    vx_lo = wasm_f32x4_mul(vx_lo, vscale);
+    vx_hi = wasm_f32x4_mul(vx_hi, vscale);
+
+    vx_lo = wasm_f32x4_max(vx_lo, voutput_min_less_zero_point);
+    vx_hi = wasm_f32x4_max(vx_hi, voutput_min_less_zero_point);
+
+    vx_lo = wasm_f32x4_min(vx_lo, voutput_max_less_zero_point);
+    vx_hi = wasm_f32x4_min(vx_hi, voutput_max_less_zero_point);
+
+    vx_lo = wasm_f32x4_add(vx_lo, vmagic_bias);
+    vx_hi = wasm_f32x4_add(vx_hi, vmagic_bias);
+
+    const v128_t vacc_lo = wasm_i32x4_sub(vx_lo, vmagic_bias_less_zero_point);
+    const v128_t vacc_hi = wasm_i32x4_sub(vx_hi, vmagic_bias_less_zero_point);
+
+    const v128_t vacc = wasm_i16x8_narrow_i32x4(vacc_lo, vacc_hi);
+
+    v128_t vy = wasm_i8x16_narrow_i16x8(vacc, vacc);
+    if (n & (4 * sizeof(float))) {
+      *((uint32_t*) output) = (uint32_t) wasm_i32x4_extract_lane(vy, 0);
+      output += 4;
+      vy = wasm_u64x2_shr(vy, 32);
+    }
+    if (n & (2 * sizeof(float))) {
+      *((uint16_t*) output) = (uint16_t) wasm_i16x8_extract_lane(vy, 0);
+      output += 2;
+      vy = wasm_u32x4_shr(vy, 16);
+    }
+    if (n & (1 * sizeof(float))) {
+      *output = (int8_t) wasm_i8x16_extract_lane(vy, 0);
+    }
+  }
+}
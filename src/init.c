@@ -44,16 +44,20 @@
 #include <xnnpack/log.h>
 #include <xnnpack/lut.h>
 #include <xnnpack/maxpool.h>
+#include <xnnpack/packx.h>
 #include <xnnpack/pad.h>
 #include <xnnpack/params.h>
 #include <xnnpack/pavgpool.h>
+#include <xnnpack/ppmm.h>
 #include <xnnpack/prelu.h>
 #include <xnnpack/raddstoreexpminusmax.h>
 #include <xnnpack/rmax.h>
 #include <xnnpack/spmm.h>
+#include <xnnpack/transpose.h>
 #include <xnnpack/unpool.h>
 #include <xnnpack/vadd.h>
 #include <xnnpack/vbinary.h>
+#include <xnnpack/vcvt.h>
 #include <xnnpack/vmulcaddc.h>
 #include <xnnpack/vunary.h>
 #include <xnnpack/zip.h>
@@ -106,6 +110,44 @@ static void init(void) {
   #endif
 
   if (cpuinfo_has_arm_neon()) {
+    /**************************** QC8 micro-kernels ****************************/
+    #ifndef XNN_NO_QC8_OPERATORS
+      init_flags |= XNN_INIT_FLAG_QC8;
+
+      if (!XNN_PLATFORM_IOS && cpuinfo_has_arm_neon_dot()) {
+        xnn_params.qc8.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_ukernel_4x8c4__neondot);
+        xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_ukernel_4x8c4__neondot);
+        xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_ukernel_1x8c4__neondot);
+        xnn_params.qc8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_ukernel_1x8c4__neondot);
+        xnn_params.qc8.gemm.mr = 4;
+        xnn_params.qc8.gemm.nr = 8;
+        xnn_params.qc8.gemm.log2_kr = 2;
+      } else {
+        xnn_params.qc8.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_ukernel_2x8c2__neon_mlal_padal_dup);
+        xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_ukernel_2x8c2__neon_mlal_padal_dup);
+        xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_ukernel_1x8c2__neon_mlal_padal_dup);
+        xnn_params.qc8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_ukernel_1x8c2__neon_mlal_padal_dup);
+        xnn_params.qc8.gemm.mr = 2;
+        xnn_params.qc8.gemm.nr = 8;
+        xnn_params.qc8.gemm.log2_kr = 1;
+      }
+
+      xnn_params.qc8.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_qc8_dwconv_minmax_ukernel_up8x9__neon_mul16;
+      xnn_params.qc8.dwconv[0].channel_tile = 8;
+      xnn_params.qc8.dwconv[0].primary_tile = 9;
+
+      xnn_params.qc8.dwconv[1].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_qc8_dwconv_minmax_ukernel_up8x25__neon_mul16;
+      xnn_params.qc8.dwconv[1].channel_tile = 8;
+      xnn_params.qc8.dwconv[1].primary_tile = 25;
+
+      // Only scalar QD8 micro-kernels: Runtime keeps running fp32 Fully Connected Nodes on F32 micro-kernels.
+      xnn_params.qd8_f32_qc8w.gemm.minmax = xnn_qd8_f32_qc8w_gemm_minmax_ukernel_4x4__scalar;
+      xnn_params.qd8_f32_qc8w.gemm.minmax1 = xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x4__scalar;
+      xnn_params.qd8_f32_qc8w.gemm.mr = 4;
+      xnn_params.qd8_f32_qc8w.gemm.nr = 4;
+      xnn_params.qd8_f32_qc8w.vcvt = xnn_f32_qd8_vcvt_ukernel__scalar;
+    #endif  // XNN_NO_QC8_OPERATORS
+
     /**************************** QS8 micro-kernels ****************************/
     #ifndef XNN_NO_QS8_OPERATORS
       init_flags |= XNN_INIT_FLAG_QS8;
@@ -132,6 +174,11 @@ static void init(void) {
       xnn_params.qs8.dwconv[0].channel_tile = 8;
       xnn_params.qs8.dwconv[0].primary_tile = 9;
 
+      xnn_params.qs8.dwconv[1].minmax.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16;
+      xnn_params.qs8.dwconv[1].channel_tile = 8;
+      xnn_params.qs8.dwconv[1].primary_tile = 9;
+      xnn_params.qs8.dwconv[1].incremental_tile = 8;
+
       xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
         .up = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_ukernel_7x__neon_c8_acc2,
         .mp = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_ukernel_7p7x__neon_c8_acc2,
@@ -172,6 +219,13 @@ static void init(void) {
       xnn_params.qu8.vadd = (xnn_vadd_ukernel_function) xnn_qu8_vadd_minmax_ukernel__neon;
     #endif  // XNN_NO_QU8_OPERATORS
 
+    /**************************** S8 micro-kernels ****************************/
+    #ifndef XNN_NO_S8_OPERATORS
+      init_flags |= XNN_INIT_FLAG_S8;
+
+      xnn_params.s8.rmax = xnn_s8_rmax_ukernel__neon;
+    #endif  // XNN_NO_S8_OPERATORS
+
     /**************************** U8 micro-kernels ****************************/
     #ifndef XNN_NO_U8_OPERATORS
       init_flags |= XNN_INIT_FLAG_U8;
@@ -183,14 +237,18 @@ static void init(void) {
       };
       xnn_params.u8.clamp = (xnn_univector_ukernel_function) xnn_u8_clamp_ukernel__neon_x64;
       xnn_params.u8.rmax = xnn_u8_rmax_ukernel__neon;
-      xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
+      xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__neon;
     #endif  // XNN_NO_U8_OPERATORS
 
     /**************************** X8 micro-kernels ****************************/
     #ifndef XNN_NO_X8_OPERATORS
       init_flags |= XNN_INIT_FLAG_X8;
 
-      xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar;
+      xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar_x4;
+      xnn_params.x8.transpose = (struct transpose_parameters) {
+        .ukernel = (xnn_transpose_ukernel_function) xnn_x8_transpose_ukernel__8x8_neon,
+        .tile_size = 8,
+      };
       xnn_params.x8.zip = (struct zip_parameters) {
         .x2 = (xnn_zipc_ukernel_function) xnn_x8_zip_x2_ukernel__neon,
         .x3 = (xnn_zipc_ukernel_function) xnn_x8_zip_x3_ukernel__neon,
@@ -199,6 +257,16 @@ static void init(void) {
       };
     #endif  // XNN_NO_X8_OPERATORS
 
+    /**************************** X16 micro-kernels ****************************/
+    #ifndef XNN_NO_X16_OPERATORS
+      init_flags |= XNN_INIT_FLAG_X16;
+
+      xnn_params.x16.transpose = (struct transpose_parameters) {
+        .ukernel = (xnn_transpose_ukernel_function) xnn_x16_transpose_ukernel__8x8_neon,
+        .tile_size = 8,
+      };
+    #endif  // XNN_NO_X16_OPERATORS
+
     /**************************** F32 micro-kernels ****************************/
     #ifndef XNN_NO_F32_OPERATORS
       init_flags |= XNN_INIT_FLAG_F32;
@@ -304,6 +372,17 @@ static void init(void) {
       xnn_params.f32.gemm2.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_4x2__neon_lane_ld64);
       xnn_params.f32.gemm2.mr = 4;
       xnn_params.f32.gemm2.nr = 2;
+      xnn_params.f32.ppmm = (struct ppmm_parameters) {
+        .ukernel = (xnn_f32_ppmm_minmax_ukernel_function) xnn_f32_ppmm_minmax_ukernel_4x8__neon,
+        .packx = (xnn_x32_packx_ukernel_function) xnn_x32_packx_ukernel_4x__neon_st4,
+        .mr = 4,
+        .nr = 8,
+      };
+      xnn_params.f32.gemminc = (struct gemminc_parameters) {
+        .ukernel = (xnn_f32_gemminc_minmax_ukernel_function) xnn_f32_gemminc_minmax_ukernel_4x8__neon_lane_ld128,
+        .mr = 4,
+        .nr = 8,
+      };
 
       xnn_params.f32.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up4x4__neon;
       xnn_params.f32.dwconv[0].channel_tile = 4,
@@ -317,6 +396,11 @@ static void init(void) {
       xnn_params.f32.dwconv[2].channel_tile = 4;
       xnn_params.f32.dwconv[2].primary_tile = 25;
 
+      xnn_params.f32.dwconv[3].minmax.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon;
+      xnn_params.f32.dwconv[3].channel_tile = 4;
+      xnn_params.f32.dwconv[3].primary_tile = 9;
+      xnn_params.f32.dwconv[3].incremental_tile = 8;
+
       xnn_params.f32.avgpool = (struct avgpool_parameters) {
         .up = (xnn_avgpool_unipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9x__neon_c4,
         .mp = (xnn_avgpool_multipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9p8x__neon_c4,
@@ -495,6 +579,10 @@ static void init(void) {
         .row_tile = 1,
       };
       xnn_params.x32.unpool = (xnn_unpool_ukernel_function) xnn_x32_unpool_ukernel__neon;
+      xnn_params.x32.transpose = (struct transpose_parameters) {
+        .ukernel = (xnn_transpose_ukernel_function) xnn_x32_transpose_ukernel__4x4_neon,
+        .tile_size = 4,
+      };
       xnn_params.x32.zip = (struct zip_parameters) {
         .x2 = (xnn_zipc_ukernel_function) xnn_x32_zip_x2_ukernel__neon,
         .x3 = (xnn_zipc_ukernel_function) xnn_x32_zip_x3_ukernel__neon,
@@ -537,6 +625,13 @@ static void init(void) {
       xnn_params.qu8.vadd = (xnn_vadd_ukernel_function) xnn_qu8_vadd_minmax_ukernel__scalar;
     #endif  // XNN_NO_QU8_OPERATORS
 
+    /**************************** S8 micro-kernels ****************************/
+    #ifndef XNN_NO_S8_OPERATORS
+      init_flags |= XNN_INIT_FLAG_S8;
+
+      xnn_params.s8.rmax = xnn_s8_rmax_ukernel__scalar;
+    #endif  // XNN_NO_S8_OPERATORS
+
     /**************************** U8 micro-kernels ****************************/
     #ifndef XNN_NO_U8_OPERATORS
       init_flags |= XNN_INIT_FLAG_U8;
@@ -555,7 +650,11 @@ static void init(void) {
     #ifndef XNN_NO_X8_OPERATORS
       init_flags |= XNN_INIT_FLAG_X8;
 
-      xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar;
+      xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar_x4;
+      xnn_params.x8.transpose = (struct transpose_parameters) {
+        .ukernel = (xnn_transpose_ukernel_function) xnn_x8_transpose_ukernel__4x4_scalar,
+        .tile_size = 4,
+      };
       xnn_params.x8.zip = (struct zip_parameters) {
         .x2 = (xnn_zipc_ukernel_function) xnn_x8_zip_x2_ukernel__scalar,
         .x3 = (xnn_zipc_ukernel_function) xnn_x8_zip_x3_ukernel__scalar,
@@ -564,6 +663,16 @@ static void init(void) {
       };
     #endif  // XNN_NO_X8_OPERATORS
 
+    /**************************** X16 micro-kernels ****************************/
+    #ifndef XNN_NO_X16_OPERATORS
+      init_flags |= XNN_INIT_FLAG_X16;
+
+      xnn_params.x16.transpose = (struct transpose_parameters) {
+        .ukernel = (xnn_transpose_ukernel_function) xnn_x16_transpose_ukernel__4x4_scalar,
+        .tile_size = 4,
+      };
+    #endif  // XNN_NO_X16_OPERATORS
+
     /**************************** F32 micro-kernels ****************************/
     #ifndef XNN_NO_F32_OPERATORS
       init_flags |= XNN_INIT_FLAG_F32;
@@ -580,6 +689,10 @@ static void init(void) {
       xnn_params.f32.gemm.linear.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_4x4__scalar);
       xnn_params.f32.gemm.linear.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x4__scalar);
       xnn_params.f32.gemm.linear.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x4__scalar);
+      xnn_params.f32.gemm.hswish.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_hswish_ukernel_4x4__scalar);
+      xnn_params.f32.gemm.hswish.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_hswish_ukernel_4x4__scalar);
+      xnn_params.f32.gemm.hswish.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_hswish_ukernel_1x4__scalar);
+      xnn_params.f32.gemm.hswish.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_hswish_ukernel_1x4__scalar);
       xnn_params.f32.gemm.mr = 4;
       xnn_params.f32.gemm.nr = 4;
 
@@ -592,19 +705,28 @@ static void init(void) {
 
       xnn_params.f32.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up1x4__scalar_acc2;
       xnn_params.f32.dwconv[0].linear.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_ukernel_up1x4__scalar_acc2;
+      xnn_params.f32.dwconv[0].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up1x4__scalar_acc2;
       xnn_params.f32.dwconv[0].channel_tile = 1;
       xnn_params.f32.dwconv[0].primary_tile = 4;
 
       xnn_params.f32.dwconv[1].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up1x9__scalar_acc2;
       xnn_params.f32.dwconv[1].linear.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_ukernel_up1x9__scalar_acc2;
+      xnn_params.f32.dwconv[1].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up1x9__scalar_acc2;
       xnn_params.f32.dwconv[1].channel_tile = 1;
       xnn_params.f32.dwconv[1].primary_tile = 9;
 
       xnn_params.f32.dwconv[2].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up1x25__scalar_acc2;
       xnn_params.f32.dwconv[2].linear.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_ukernel_up1x25__scalar_acc2;
+      xnn_params.f32.dwconv[2].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up1x25__scalar_acc2;
       xnn_params.f32.dwconv[2].channel_tile = 1;
       xnn_params.f32.dwconv[2].primary_tile = 25;
 
+      xnn_params.f32.dwconv[3].minmax.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_mp1x9p8__scalar;
+      xnn_params.f32.dwconv[3].linear.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_f32_dwconv_ukernel_mp1x9p8__scalar;
+      xnn_params.f32.dwconv[3].channel_tile = 1;
+      xnn_params.f32.dwconv[3].primary_tile = 9;
+      xnn_params.f32.dwconv[3].incremental_tile = 8;
+
       xnn_params.f32.avgpool = (struct avgpool_parameters) {
         .up = (xnn_avgpool_unipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9x__scalar_c1,
         .mp = (xnn_avgpool_multipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9p8x__scalar_c1,
@@ -782,6 +904,10 @@ static void init(void) {
         .row_tile = 1,
       };
       xnn_params.x32.unpool = (xnn_unpool_ukernel_function) xnn_x32_unpool_ukernel__scalar;
+      xnn_params.x32.transpose = (struct transpose_parameters) {
+        .ukernel = (xnn_transpose_ukernel_function) xnn_x32_transpose_ukernel__4x4_scalar,
+        .tile_size = 4,
+      };
       xnn_params.x32.zip = (struct zip_parameters) {
         .x2 = (xnn_zipc_ukernel_function) xnn_x32_zip_x2_ukernel__scalar,
         .x3 = (xnn_zipc_ukernel_function) xnn_x32_zip_x3_ukernel__scalar,
@@ -798,6 +924,27 @@ static void init(void) {
     #endif  // XNN_NO_X32_OPERATORS
   }
 
+  /**************************** VCVT micro-kernels ****************************/
+  #ifndef XNN_NO_VCVT_OPERATORS
+    init_flags |= XNN_INIT_FLAG_VCVT;
+
+    if (cpuinfo_has_arm_neon()) {
+      xnn_params.vcvt.f16_to_f32 = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__neon_int16_x16;
+      xnn_params.vcvt.f32_to_f16 = (xnn_univector_ukernel_function) xnn_f32_f16_vcvt_ukernel__neon_x8;
+      if (cpuinfo_has_arm_neon_v8()) {
+        xnn_params.vcvt.f32_to_qs8 = (xnn_univector_ukernel_function) xnn_f32_qs8_vcvt_ukernel__neonv8_x16;
+      } else {
+        xnn_params.vcvt.f32_to_qs8 = (xnn_univector_ukernel_function) xnn_f32_qs8_vcvt_ukernel__neon_x16;
+      }
+      xnn_params.vcvt.qs8_to_f32 = (xnn_univector_ukernel_function) xnn_qs8_f32_vcvt_ukernel__neon_x16;
+    } else if (!XNN_PLATFORM_MOBILE) {
+      xnn_params.vcvt.f16_to_f32 = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__scalar_x4;
+      xnn_params.vcvt.f32_to_f16 = (xnn_univector_ukernel_function) xnn_f32_f16_vcvt_ukernel__scalar_x4;
+      xnn_params.vcvt.f32_to_qs8 = (xnn_univector_ukernel_function) xnn_f32_qs8_vcvt_ukernel__scalar_magic_x4;
+      xnn_params.vcvt.qs8_to_f32 = (xnn_univector_ukernel_function) xnn_qs8_f32_vcvt_ukernel__scalar_x4;
+    }
+  #endif  // XNN_NO_VCVT_OPERATORS
+
 #elif XNN_ARCH_ARM64
 
   /**************************** XX micro-kernels ****************************/
@@ -807,6 +954,44 @@ static void init(void) {
     xnn_params.xx.copy = (xnn_univector_ukernel_function) xnn_xx_copy_ukernel__memcpy;
   #endif
 
+  /**************************** QC8 micro-kernels ****************************/
+  #ifndef XNN_NO_QC8_OPERATORS
+    init_flags |= XNN_INIT_FLAG_QC8;
+
+    if (cpuinfo_has_arm_neon_dot()) {
+      xnn_params.qc8.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_ukernel_4x16c4__neondot);
+      xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_ukernel_4x16c4__neondot);
+      xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_ukernel_1x16c4__neondot);
+      xnn_params.qc8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_ukernel_1x16c4__neondot);
+      xnn_params.qc8.gemm.mr = 4;
+      xnn_params.qc8.gemm.nr = 16;
+      xnn_params.qc8.gemm.log2_kr = 2;
+    } else {
+      xnn_params.qc8.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_ukernel_2x8c2__neon_mlal_padal_dup);
+      xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_ukernel_2x8c2__neon_mlal_padal_dup);
+      xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_ukernel_1x8c2__neon_mlal_padal_dup);
+      xnn_params.qc8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_ukernel_1x8c2__neon_mlal_padal_dup);
+      xnn_params.qc8.gemm.mr = 2;
+      xnn_params.qc8.gemm.nr = 8;
+      xnn_params.qc8.gemm.log2_kr = 1;
+    }
+
+    xnn_params.qc8.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_qc8_dwconv_minmax_ukernel_up8x9__neon_mul16;
+    xnn_params.qc8.dwconv[0].channel_tile = 8;
+    xnn_params.qc8.dwconv[0].primary_tile = 9;
+
+    xnn_params.qc8.dwconv[1].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_qc8_dwconv_minmax_ukernel_up8x25__neon_mul16;
+    xnn_params.qc8.dwconv[1].channel_tile = 8;
+    xnn_params.qc8.dwconv[1].primary_tile = 25;
+
+    // Only scalar QD8 micro-kernels: Runtime keeps running fp32 Fully Connected Nodes on F32 micro-kernels.
+    xnn_params.qd8_f32_qc8w.gemm.minmax = xnn_qd8_f32_qc8w_gemm_minmax_ukernel_4x4__scalar;
+    xnn_params.qd8_f32_qc8w.gemm.minmax1 = xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x4__scalar;
+    xnn_params.qd8_f32_qc8w.gemm.mr = 4;
+    xnn_params.qd8_f32_qc8w.gemm.nr = 4;
+    xnn_params.qd8_f32_qc8w.vcvt = xnn_f32_qd8_vcvt_ukernel__scalar;
+  #endif  // XNN_NO_QC8_OPERATORS
+
   /**************************** QS8 micro-kernels ****************************/
   #ifndef XNN_NO_QS8_OPERATORS
     init_flags |= XNN_INIT_FLAG_QS8;
@@ -953,6 +1138,11 @@ static void init(void) {
     xnn_params.qs8.dwconv[0].channel_tile = 8;
     xnn_params.qs8.dwconv[0].primary_tile = 9;
 
+    xnn_params.qs8.dwconv[1].minmax.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16;
+    xnn_params.qs8.dwconv[1].channel_tile = 8;
+    xnn_params.qs8.dwconv[1].primary_tile = 9;
+    xnn_params.qs8.dwconv[1].incremental_tile = 8;
+
     xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
       .up = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_ukernel_7x__neon_c8_acc2,
       .mp = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_ukernel_7p7x__neon_c8_acc2,
@@ -994,6 +1184,13 @@ static void init(void) {
     xnn_params.qu8.vadd = (xnn_vadd_ukernel_function) xnn_qu8_vadd_minmax_ukernel__neon;
   #endif  // XNN_NO_QU8_OPERATORS
 
+  /**************************** S8 micro-kernels ****************************/
+  #ifndef XNN_NO_S8_OPERATORS
+    init_flags |= XNN_INIT_FLAG_S8;
+
+    xnn_params.s8.rmax = xnn_s8_rmax_ukernel__neon;
+  #endif  // XNN_NO_S8_OPERATORS
+
   /**************************** U8 micro-kernels ****************************/
   #ifndef XNN_NO_U8_OPERATORS
     init_flags |= XNN_INIT_FLAG_U8;
@@ -1004,7 +1201,7 @@ static void init(void) {
       .qr = 8,
     };
     xnn_params.u8.clamp = (xnn_univector_ukernel_function) xnn_u8_clamp_ukernel__neon_x64;
-    xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
+    xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__neon;
     xnn_params.u8.rmax = xnn_u8_rmax_ukernel__neon;
   #endif  // XNN_NO_U8_OPERATORS
 
@@ -1012,7 +1209,11 @@ static void init(void) {
   #ifndef XNN_NO_X8_OPERATORS
     init_flags |= XNN_INIT_FLAG_X8;
 
-    xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar;
+    xnn_params.x8.lut = xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x64;
+    xnn_params.x8.transpose = (struct transpose_parameters) {
+      .ukernel = (xnn_transpose_ukernel_function) xnn_x8_transpose_ukernel__8x8_neon,
+      .tile_size = 8,
+    };
     xnn_params.x8.zip = (struct zip_parameters) {
       .x2 = (xnn_zipc_ukernel_function) xnn_x8_zip_x2_ukernel__neon,
       .x3 = (xnn_zipc_ukernel_function) xnn_x8_zip_x3_ukernel__neon,
@@ -1021,6 +1222,16 @@ static void init(void) {
     };
   #endif  // XNN_NO_X8_OPERATORS
 
+  /**************************** X16 micro-kernels ****************************/
+  #ifndef XNN_NO_X16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_X16;
+
+    xnn_params.x16.transpose = (struct transpose_parameters) {
+      .ukernel = (xnn_transpose_ukernel_function) xnn_x16_transpose_ukernel__8x8_neon,
+      .tile_size = 8,
+    };
+  #endif  // XNN_NO_X16_OPERATORS
+
   /**************************** F16 micro-kernels ****************************/
   #ifndef XNN_NO_F16_OPERATORS
     if (cpuinfo_has_arm_neon_fp16_arith()) {
@@ -1050,6 +1261,11 @@ static void init(void) {
       xnn_params.f16.dwconv[2].channel_tile = 8;
       xnn_params.f16.dwconv[2].primary_tile = 25;
 
+      xnn_params.f16.dwconv[3].minmax.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_f16_dwconv_minmax_ukernel_mp8x9p8__neonfp16arith;
+      xnn_params.f16.dwconv[3].channel_tile = 8;
+      xnn_params.f16.dwconv[3].primary_tile = 9;
+      xnn_params.f16.dwconv[3].incremental_tile = 8;
+
       xnn_params.f16.gavgpool = (struct gavgpool_parameters) {
         .up = (xnn_gavgpool_unipass_ukernel_function) xnn_f16_gavgpool_minmax_ukernel_7x__neonfp16arith_c8,
         .mp = (xnn_gavgpool_multipass_ukernel_function) xnn_f16_gavgpool_minmax_ukernel_7p7x__neonfp16arith_c8,
@@ -1233,6 +1449,17 @@ static void init(void) {
     xnn_params.f32.gemm2.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_4x2__neonfma_lane_ld64);
     xnn_params.f32.gemm2.mr = 4;
     xnn_params.f32.gemm2.nr = 2;
+    xnn_params.f32.ppmm = (struct ppmm_parameters) {
+      .ukernel = (xnn_f32_ppmm_minmax_ukernel_function) xnn_f32_ppmm_minmax_ukernel_4x8__neonfma,
+      .packx = (xnn_x32_packx_ukernel_function) xnn_x32_packx_ukernel_4x__neon_st4,
+      .mr = 4,
+      .nr = 8,
+    };
+    xnn_params.f32.gemminc = (struct gemminc_parameters) {
+      .ukernel = (xnn_f32_gemminc_minmax_ukernel_function) xnn_f32_gemminc_minmax_ukernel_6x8__neonfma_lane_ld128,
+      .mr = 6,
+      .nr = 8,
+    };
 
     xnn_params.f32.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up8x4__neonfma;
     xnn_params.f32.dwconv[0].channel_tile = 8;
@@ -1270,6 +1497,11 @@ static void init(void) {
     xnn_params.f32.dwconv[2].channel_tile = 4;
     xnn_params.f32.dwconv[2].primary_tile = 25;
 
+    xnn_params.f32.dwconv[3].minmax.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma;
+    xnn_params.f32.dwconv[3].channel_tile = 4;
+    xnn_params.f32.dwconv[3].primary_tile = 9;
+    xnn_params.f32.dwconv[3].incremental_tile = 8;
+
     xnn_params.f32.avgpool = (struct avgpool_parameters) {
       .up = (xnn_avgpool_unipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9x__neon_c4,
       .mp = (xnn_avgpool_multipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9p8x__neon_c4,
@@ -1447,6 +1679,10 @@ static void init(void) {
       .row_tile = 1,
     };
     xnn_params.x32.unpool = (xnn_unpool_ukernel_function) xnn_x32_unpool_ukernel__neon;
+    xnn_params.x32.transpose = (struct transpose_parameters) {
+      .ukernel = (xnn_transpose_ukernel_function) xnn_x32_transpose_ukernel__4x4_neon,
+      .tile_size = 4,
+    };
     xnn_params.x32.zip = (struct zip_parameters) {
       .x2 = (xnn_zipc_ukernel_function) xnn_x32_zip_x2_ukernel__neon,
       .x3 = (xnn_zipc_ukernel_function) xnn_x32_zip_x3_ukernel__neon,
@@ -1462,6 +1698,16 @@ static void init(void) {
     #endif  // XNN_NO_NCHW_OPERATORS
   #endif  // XNN_NO_X32_OPERATORS
 
+  /**************************** VCVT micro-kernels ****************************/
+  #ifndef XNN_NO_VCVT_OPERATORS
+    init_flags |= XNN_INIT_FLAG_VCVT;
+
+    xnn_params.vcvt.f16_to_f32 = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__neon_int16_x16;
+    xnn_params.vcvt.f32_to_f16 = (xnn_univector_ukernel_function) xnn_f32_f16_vcvt_ukernel__neon_x8;
+    xnn_params.vcvt.f32_to_qs8 = (xnn_univector_ukernel_function) xnn_f32_qs8_vcvt_ukernel__neonv8_x16;
+    xnn_params.vcvt.qs8_to_f32 = (xnn_univector_ukernel_function) xnn_qs8_f32_vcvt_ukernel__neon_x16;
+  #endif  // XNN_NO_VCVT_OPERATORS
+
 #elif XNN_ARCH_X86 || XNN_ARCH_X86_64
   if (!cpuinfo_has_x86_sse2()) {
     xnn_log_error("XNNPACK initialization failed: SSE2 is not supported");
@@ -1475,6 +1721,55 @@ static void init(void) {
     xnn_params.xx.copy = (xnn_univector_ukernel_function) xnn_xx_copy_ukernel__memcpy;
   #endif
 
+  /**************************** QC8 micro-kernels ****************************/
+  #ifndef XNN_NO_QC8_OPERATORS
+    init_flags |= XNN_INIT_FLAG_QC8;
+
+    if (cpuinfo_has_x86_sse4_1()) {
+      xnn_params.qc8.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_ukernel_3x4c8__sse41_ld64);
+      xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_ukernel_3x4c8__sse41_ld64);
+      xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_ukernel_1x4c8__sse41_ld64);
+      xnn_params.qc8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_ukernel_1x4c8__sse41_ld64);
+      xnn_params.qc8.gemm.mr = 3;
+      xnn_params.qc8.gemm.nr = 4;
+      xnn_params.qc8.gemm.log2_kr = 3;
+    } else {
+      xnn_params.qc8.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_ukernel_3x4c8__sse2_ld64);
+      xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_ukernel_3x4c8__sse2_ld64);
+      xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_ukernel_1x4c8__sse2_ld64);
+      xnn_params.qc8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_ukernel_1x4c8__sse2_ld64);
+      xnn_params.qc8.gemm.mr = 3;
+      xnn_params.qc8.gemm.nr = 4;
+      xnn_params.qc8.gemm.log2_kr = 3;
+    }
+
+    if (cpuinfo_has_x86_sse4_1()) {
+      xnn_params.qc8.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_qc8_dwconv_minmax_ukernel_up8x9__sse41_mul16;
+      xnn_params.qc8.dwconv[1].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_qc8_dwconv_minmax_ukernel_up8x25__sse41_mul16;
+    } else {
+      xnn_params.qc8.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_qc8_dwconv_minmax_ukernel_up8x9__sse2_mul16;
+      xnn_params.qc8.dwconv[1].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_qc8_dwconv_minmax_ukernel_up8x25__sse2_mul16;
+    }
+    xnn_params.qc8.dwconv[0].channel_tile = 8;
+    xnn_params.qc8.dwconv[0].primary_tile = 9;
+    xnn_params.qc8.dwconv[1].channel_tile = 8;
+    xnn_params.qc8.dwconv[1].primary_tile = 25;
+
+    init_flags |= XNN_INIT_FLAG_QD8_OPT;
+
+    if (cpuinfo_has_x86_sse4_1()) {
+      xnn_params.qd8_f32_qc8w.gemm.minmax = xnn_qd8_f32_qc8w_gemm_minmax_ukernel_3x4c8__sse41_ld64;
+      xnn_params.qd8_f32_qc8w.gemm.minmax1 = xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x4c8__sse41_ld64;
+    } else {
+      xnn_params.qd8_f32_qc8w.gemm.minmax = xnn_qd8_f32_qc8w_gemm_minmax_ukernel_3x4c8__sse2_ld64;
+      xnn_params.qd8_f32_qc8w.gemm.minmax1 = xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x4c8__sse2_ld64;
+    }
+    xnn_params.qd8_f32_qc8w.gemm.mr = 3;
+    xnn_params.qd8_f32_qc8w.gemm.nr = 4;
+    xnn_params.qd8_f32_qc8w.gemm.log2_kr = 3;
+    xnn_params.qd8_f32_qc8w.vcvt = xnn_f32_qd8_vcvt_ukernel__sse2;
+  #endif  // XNN_NO_QC8_OPERATORS
+
   /**************************** QS8 micro-kernels ****************************/
   #ifndef XNN_NO_QS8_OPERATORS
     init_flags |= XNN_INIT_FLAG_QS8;
@@ -1563,6 +1858,17 @@ static void init(void) {
     }
     xnn_params.qs8.dwconv[0].primary_tile = 9;
 
+    if (cpuinfo_has_x86_sse4_1()) {
+      xnn_params.qs8.dwconv[1].minmax.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16;
+    } else if (cpuinfo_has_x86_ssse3()) {
+      xnn_params.qs8.dwconv[1].minmax.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16;
+    } else if (cpuinfo_has_x86_sse2()) {
+      xnn_params.qs8.dwconv[1].minmax.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16;
+    }
+    xnn_params.qs8.dwconv[1].channel_tile = 8;
+    xnn_params.qs8.dwconv[1].primary_tile = 9;
+    xnn_params.qs8.dwconv[1].incremental_tile = 8;
+
     if (cpuinfo_has_x86_sse4_1()) {
       xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
         .up = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_ukernel_7x__sse41_c8_acc2,
@@ -1642,6 +1948,13 @@ static void init(void) {
     xnn_params.qu8.vadd = (xnn_vadd_ukernel_function) xnn_qu8_vadd_minmax_ukernel__sse2;
   #endif  // XNN_NO_QU8_OPERATORS
 
+  /**************************** S8 micro-kernels ****************************/
+  #ifndef XNN_NO_S8_OPERATORS
+    init_flags |= XNN_INIT_FLAG_S8;
+
+    xnn_params.s8.rmax = xnn_s8_rmax_ukernel__sse2;
+  #endif  // XNN_NO_S8_OPERATORS
+
   /**************************** U8 micro-kernels ****************************/
   #ifndef XNN_NO_U8_OPERATORS
     init_flags |= XNN_INIT_FLAG_U8;
@@ -1652,7 +1965,13 @@ static void init(void) {
       .qr = 8,
     };
     xnn_params.u8.clamp = (xnn_univector_ukernel_function) xnn_u8_clamp_ukernel__sse2_x64;
-    xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
+    if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx2()) {
+      xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__avx2;
+    } else if (cpuinfo_has_x86_sse4_1()) {
+      xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__sse41;
+    } else {
+      xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
+    }
     xnn_params.u8.rmax = xnn_u8_rmax_ukernel__sse2;
   #endif  // XNN_NO_U8_OPERATORS
 
@@ -1660,7 +1979,20 @@ static void init(void) {
   #ifndef XNN_NO_X8_OPERATORS
     init_flags |= XNN_INIT_FLAG_X8;
 
-    xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar;
+    if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512vbmi()) {
+      xnn_params.x8.lut = xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x128;
+    } else if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl()) {
+      xnn_params.x8.lut = xnn_x8_lut_ukernel__avx512skx_vpshufb_x64;
+    } else if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx2()) {
+      xnn_params.x8.lut = xnn_x8_lut_ukernel__avx2_x128;
+    } else {
+      // With the 16 sub-tables spilled out of the 128-bit register file, the SSSE3 micro-kernel is no faster than scalar.
+      xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar_x4;
+    }
+    xnn_params.x8.transpose = (struct transpose_parameters) {
+      .ukernel = (xnn_transpose_ukernel_function) xnn_x8_transpose_ukernel__8x8_sse2,
+      .tile_size = 8,
+    };
     xnn_params.x8.zip = (struct zip_parameters) {
       .x2 = (xnn_zipc_ukernel_function) xnn_x8_zip_x2_ukernel__sse2,
       .x3 = (xnn_zipc_ukernel_function) xnn_x8_zip_x3_ukernel__sse2,
@@ -1669,6 +2001,66 @@ static void init(void) {
     };
   #endif  // XNN_NO_X8_OPERATORS
 
+  /**************************** X16 micro-kernels ****************************/
+  #ifndef XNN_NO_X16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_X16;
+
+    xnn_params.x16.transpose = (struct transpose_parameters) {
+      .ukernel = (xnn_transpose_ukernel_function) xnn_x16_transpose_ukernel__8x8_sse2,
+      .tile_size = 8,
+    };
+  #endif  // XNN_NO_X16_OPERATORS
+
+  /**************************** F16 micro-kernels ****************************/
+  #ifndef XNN_NO_F16_OPERATORS
+    if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_fma3() && cpuinfo_has_x86_f16c()) {
+      init_flags |= XNN_INIT_FLAG_F16;
+
+      xnn_params.f16.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+      xnn_params.f16.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f16_igemm_minmax_ukernel_4x16__fma3_broadcast);
+      xnn_params.f16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+      xnn_params.f16.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f16_igemm_minmax_ukernel_1x16__fma3_broadcast);
+      xnn_params.f16.gemm.mr = 4;
+      xnn_params.f16.gemm.nr = 16;
+
+      xnn_params.f16.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f16_dwconv_minmax_ukernel_up16x4__fma3;
+      xnn_params.f16.dwconv[0].channel_tile = 16;
+      xnn_params.f16.dwconv[0].primary_tile = 4;
+
+      xnn_params.f16.dwconv[1].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f16_dwconv_minmax_ukernel_up16x9__fma3;
+      xnn_params.f16.dwconv[1].channel_tile = 16;
+      xnn_params.f16.dwconv[1].primary_tile = 9;
+
+      xnn_params.f16.dwconv[2].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f16_dwconv_minmax_ukernel_up8x25__fma3;
+      xnn_params.f16.dwconv[2].channel_tile = 8;
+      xnn_params.f16.dwconv[2].primary_tile = 25;
+
+      xnn_params.f16.gavgpool = (struct gavgpool_parameters) {
+        .up = (xnn_gavgpool_unipass_ukernel_function) xnn_f16_gavgpool_minmax_ukernel_7x__f16c_c8,
+        .mp = (xnn_gavgpool_multipass_ukernel_function) xnn_f16_gavgpool_minmax_ukernel_7p7x__f16c_c8,
+        .mr = 7,
+      };
+      xnn_params.f16.vadd = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vadd_minmax_ukernel__f16c_x16,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vaddc_minmax_ukernel__f16c_x16,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vaddc_minmax_ukernel__f16c_x16,
+        .element_tile = 16,
+      };
+      xnn_params.f16.vmul = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vmul_minmax_ukernel__f16c_x16,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vmulc_minmax_ukernel__f16c_x16,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vmulc_minmax_ukernel__f16c_x16,
+        .element_tile = 16,
+      };
+      xnn_params.f16.vmulcaddc = (struct vmulcaddc_parameters) {
+        .ukernel = (xnn_vmulcaddc_ukernel_function) xnn_f16_vmulcaddc_minmax_ukernel_c8__fma3_2x,
+        .channel_tile = 8,
+        .row_tile = 2,
+      };
+      xnn_params.f16.hswish = (xnn_univector_ukernel_function) xnn_f16_hswish_ukernel__f16c_x16;
+    }
+  #endif  // XNN_NO_F16_OPERATORS
+
   /**************************** F32 micro-kernels ****************************/
   #ifndef XNN_NO_F32_OPERATORS
     init_flags |= XNN_INIT_FLAG_F32;
@@ -1680,6 +2072,11 @@ static void init(void) {
       xnn_params.f32.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_1x16__avx512f_broadcast);
       xnn_params.f32.gemm.mr = 7;
       xnn_params.f32.gemm.nr = 16;
+      xnn_params.f32.gemminc = (struct gemminc_parameters) {
+        .ukernel = (xnn_f32_gemminc_minmax_ukernel_function) xnn_f32_gemminc_minmax_ukernel_7x16__avx512f_broadcast,
+        .mr = 7,
+        .nr = 16,
+      };
     } else if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_fma3()) {
       switch (cpuinfo_get_core(0)->uarch) {
         case cpuinfo_uarch_zen:
@@ -1697,8 +2094,17 @@ static void init(void) {
           xnn_params.f32.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_5x16__fma3_broadcast);
           xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast);
           xnn_params.f32.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_1x16__fma3_broadcast);
+          xnn_params.f32.gemm.hswish.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+          xnn_params.f32.gemm.hswish.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_hswish_ukernel_5x16__fma3_broadcast);
+          xnn_params.f32.gemm.hswish.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+          xnn_params.f32.gemm.hswish.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_hswish_ukernel_1x16__fma3_broadcast);
           xnn_params.f32.gemm.mr = 5;
           xnn_params.f32.gemm.nr = 16;
+          xnn_params.f32.gemminc = (struct gemminc_parameters) {
+            .ukernel = (xnn_f32_gemminc_minmax_ukernel_function) xnn_f32_gemminc_minmax_ukernel_5x16__fma3_broadcast,
+            .mr = 5,
+            .nr = 16,
+          };
           break;
       }
     } else if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx()) {
@@ -1706,21 +2112,45 @@ static void init(void) {
       xnn_params.f32.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_5x16__avx_broadcast);
       xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast);
       xnn_params.f32.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_1x16__avx_broadcast);
+      xnn_params.f32.gemm.hswish.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+      xnn_params.f32.gemm.hswish.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_hswish_ukernel_5x16__avx_broadcast);
+      xnn_params.f32.gemm.hswish.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+      xnn_params.f32.gemm.hswish.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_hswish_ukernel_1x16__avx_broadcast);
       xnn_params.f32.gemm.mr = 5;
       xnn_params.f32.gemm.nr = 16;
+      xnn_params.f32.gemminc = (struct gemminc_parameters) {
+        .ukernel = (xnn_f32_gemminc_minmax_ukernel_function) xnn_f32_gemminc_minmax_ukernel_5x16__avx_broadcast,
+        .mr = 5,
+        .nr = 16,
+      };
     } else {
       xnn_params.f32.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_4x8__sse_load1);
       xnn_params.f32.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_4x8__sse_load1);
       xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x8__sse_load1);
       xnn_params.f32.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_1x8__sse_load1);
+      xnn_params.f32.gemm.hswish.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+      xnn_params.f32.gemm.hswish.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_hswish_ukernel_4x8__sse_load1);
+      xnn_params.f32.gemm.hswish.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+      xnn_params.f32.gemm.hswish.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_hswish_ukernel_1x8__sse_load1);
       xnn_params.f32.gemm.mr = 4;
       xnn_params.f32.gemm.nr = 8;
+      xnn_params.f32.gemminc = (struct gemminc_parameters) {
+        .ukernel = (xnn_f32_gemminc_minmax_ukernel_function) xnn_f32_gemminc_minmax_ukernel_4x8__sse_load1,
+        .mr = 4,
+        .nr = 8,
+      };
     }
     xnn_params.f32.gemm2.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_4x2c4__sse);
     xnn_params.f32.gemm2.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_4x2c4__sse);
     xnn_params.f32.gemm2.mr = 4;
     xnn_params.f32.gemm2.nr = 2;
     xnn_params.f32.gemm2.log2_kr = 2;
+    xnn_params.f32.ppmm = (struct ppmm_parameters) {
+      .ukernel = (xnn_f32_ppmm_minmax_ukernel_function) xnn_f32_ppmm_minmax_ukernel_4x8__sse,
+      .packx = (xnn_x32_packx_ukernel_function) xnn_x32_packx_ukernel_4x__sse,
+      .mr = 4,
+      .nr = 8,
+    };
 
     if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f()) {
       xnn_params.f32.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up16x4__avx512f;
@@ -1736,41 +2166,55 @@ static void init(void) {
       xnn_params.f32.dwconv[2].primary_tile = 25;
     } else if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_fma3()) {
       xnn_params.f32.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up16x4__fma3;
+      xnn_params.f32.dwconv[0].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up16x4__fma3;
       xnn_params.f32.dwconv[0].channel_tile = 16;
       xnn_params.f32.dwconv[0].primary_tile = 4;
 
       xnn_params.f32.dwconv[1].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up16x9__fma3;
+      xnn_params.f32.dwconv[1].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up16x9__fma3;
       xnn_params.f32.dwconv[1].channel_tile = 16;
       xnn_params.f32.dwconv[1].primary_tile = 9;
 
       xnn_params.f32.dwconv[2].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up8x25__fma3;
+      xnn_params.f32.dwconv[2].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up8x25__fma3;
       xnn_params.f32.dwconv[2].channel_tile = 8;
       xnn_params.f32.dwconv[2].primary_tile = 25;
     } else if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx()) {
       xnn_params.f32.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up16x4__avx;
+      xnn_params.f32.dwconv[0].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up16x4__avx;
       xnn_params.f32.dwconv[0].channel_tile = 16;
       xnn_params.f32.dwconv[0].primary_tile = 4;
 
       xnn_params.f32.dwconv[1].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up16x9__avx;
+      xnn_params.f32.dwconv[1].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up16x9__avx;
       xnn_params.f32.dwconv[1].channel_tile = 16;
       xnn_params.f32.dwconv[1].primary_tile = 9;
 
       xnn_params.f32.dwconv[2].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up8x25__avx;
+      xnn_params.f32.dwconv[2].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up8x25__avx;
       xnn_params.f32.dwconv[2].channel_tile = 8;
       xnn_params.f32.dwconv[2].primary_tile = 25;
     } else {
       xnn_params.f32.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up8x4__sse;
+      xnn_params.f32.dwconv[0].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up8x4__sse;
       xnn_params.f32.dwconv[0].channel_tile = 8;
       xnn_params.f32.dwconv[0].primary_tile = 4;
 
       xnn_params.f32.dwconv[1].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up8x9__sse;
+      xnn_params.f32.dwconv[1].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up8x9__sse;
       xnn_params.f32.dwconv[1].channel_tile = 8;
       xnn_params.f32.dwconv[1].primary_tile = 9;
 
       xnn_params.f32.dwconv[2].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up8x25__sse;
+      xnn_params.f32.dwconv[2].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up8x25__sse;
       xnn_params.f32.dwconv[2].channel_tile = 8;
       xnn_params.f32.dwconv[2].primary_tile = 25;
     }
+    xnn_params.f32.dwconv[3].minmax.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse;
+    xnn_params.f32.dwconv[3].channel_tile = 4;
+    xnn_params.f32.dwconv[3].primary_tile = 9;
+    xnn_params.f32.dwconv[3].incremental_tile = 8;
+
     xnn_params.f32.avgpool = (struct avgpool_parameters) {
       .up = (xnn_avgpool_unipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9x__sse_c4,
       .mp = (xnn_avgpool_multipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9p8x__sse_c4,
@@ -2137,6 +2581,17 @@ static void init(void) {
       .row_tile = 1,
     };
     xnn_params.x32.unpool = (xnn_unpool_ukernel_function) xnn_x32_unpool_ukernel__sse2;
+    if (cpuinfo_has_x86_avx()) {
+      xnn_params.x32.transpose = (struct transpose_parameters) {
+        .ukernel = (xnn_transpose_ukernel_function) xnn_x32_transpose_ukernel__8x8_avx,
+        .tile_size = 8,
+      };
+    } else {
+      xnn_params.x32.transpose = (struct transpose_parameters) {
+        .ukernel = (xnn_transpose_ukernel_function) xnn_x32_transpose_ukernel__4x4_sse,
+        .tile_size = 4,
+      };
+    }
     xnn_params.x32.zip = (struct zip_parameters) {
       .x2 = (xnn_zipc_ukernel_function) xnn_x32_zip_x2_ukernel__sse2,
       .x3 = (xnn_zipc_ukernel_function) xnn_x32_zip_x3_ukernel__sse2,
@@ -2152,6 +2607,41 @@ static void init(void) {
     #endif  // XNN_NO_NCHW_OPERATORS
   #endif  // XNN_NO_X32_OPERATORS
 
+  /**************************** VCVT micro-kernels ****************************/
+  #ifndef XNN_NO_VCVT_OPERATORS
+    init_flags |= XNN_INIT_FLAG_VCVT;
+
+    if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl()) {
+      xnn_params.vcvt.f16_to_f32 = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__avx512skx_x16;
+      xnn_params.vcvt.f32_to_f16 = (xnn_univector_ukernel_function) xnn_f32_f16_vcvt_ukernel__avx512skx_x16;
+    } else if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_f16c()) {
+      xnn_params.vcvt.f16_to_f32 = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__f16c_x16;
+      xnn_params.vcvt.f32_to_f16 = (xnn_univector_ukernel_function) xnn_f32_f16_vcvt_ukernel__f16c_x16;
+    } else if (cpuinfo_has_x86_sse4_1()) {
+      xnn_params.vcvt.f16_to_f32 = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__sse41_int16_x16;
+      xnn_params.vcvt.f32_to_f16 = (xnn_univector_ukernel_function) xnn_f32_f16_vcvt_ukernel__sse41_x8;
+    } else {
+      xnn_params.vcvt.f16_to_f32 = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__sse2_int16_x16;
+      xnn_params.vcvt.f32_to_f16 = (xnn_univector_ukernel_function) xnn_f32_f16_vcvt_ukernel__sse2_x16;
+    }
+    if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl()) {
+      xnn_params.vcvt.f32_to_qs8 = (xnn_univector_ukernel_function) xnn_f32_qs8_vcvt_ukernel__avx512skx_x64;
+      xnn_params.vcvt.qs8_to_f32 = (xnn_univector_ukernel_function) xnn_qs8_f32_vcvt_ukernel__avx512skx_x32;
+    } else if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx2()) {
+      xnn_params.vcvt.f32_to_qs8 = (xnn_univector_ukernel_function) xnn_f32_qs8_vcvt_ukernel__avx2_x32;
+      xnn_params.vcvt.qs8_to_f32 = (xnn_univector_ukernel_function) xnn_qs8_f32_vcvt_ukernel__avx2_x16;
+    } else if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx()) {
+      xnn_params.vcvt.f32_to_qs8 = (xnn_univector_ukernel_function) xnn_f32_qs8_vcvt_ukernel__avx_x32;
+      xnn_params.vcvt.qs8_to_f32 = (xnn_univector_ukernel_function) xnn_qs8_f32_vcvt_ukernel__avx_x32;
+    } else if (cpuinfo_has_x86_sse4_1()) {
+      xnn_params.vcvt.f32_to_qs8 = (xnn_univector_ukernel_function) xnn_f32_qs8_vcvt_ukernel__sse2_x32;
+      xnn_params.vcvt.qs8_to_f32 = (xnn_univector_ukernel_function) xnn_qs8_f32_vcvt_ukernel__sse41_x16;
+    } else {
+      xnn_params.vcvt.f32_to_qs8 = (xnn_univector_ukernel_function) xnn_f32_qs8_vcvt_ukernel__sse2_x32;
+      xnn_params.vcvt.qs8_to_f32 = (xnn_univector_ukernel_function) xnn_qs8_f32_vcvt_ukernel__sse2_x16;
+    }
+  #endif  // XNN_NO_VCVT_OPERATORS
+
 #elif XNN_ARCH_WASMSIMD
 
   /**************************** XX micro-kernels ****************************/
@@ -2218,6 +2708,13 @@ static void init(void) {
     xnn_params.qu8.vadd = (xnn_vadd_ukernel_function) xnn_qu8_vadd_minmax_ukernel__scalar;
   #endif  // XNN_NO_QU8_OPERATORS
 
+  /**************************** S8 micro-kernels ****************************/
+  #ifndef XNN_NO_S8_OPERATORS
+    init_flags |= XNN_INIT_FLAG_S8;
+
+    xnn_params.s8.rmax = xnn_s8_rmax_ukernel__scalar;
+  #endif  // XNN_NO_S8_OPERATORS
+
   /**************************** U8 micro-kernels ****************************/
   #ifndef XNN_NO_U8_OPERATORS
     init_flags |= XNN_INIT_FLAG_U8;
@@ -2236,7 +2733,11 @@ static void init(void) {
   #ifndef XNN_NO_X8_OPERATORS
     init_flags |= XNN_INIT_FLAG_X8;
 
-    xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar;
+    xnn_params.x8.lut = xnn_x8_lut_ukernel__wasmsimd_x32;
+    xnn_params.x8.transpose = (struct transpose_parameters) {
+      .ukernel = (xnn_transpose_ukernel_function) xnn_x8_transpose_ukernel__4x4_scalar,
+      .tile_size = 4,
+    };
     xnn_params.x8.zip = (struct zip_parameters) {
       .x2 = (xnn_zipc_ukernel_function) xnn_x8_zip_x2_ukernel__scalar,
       .x3 = (xnn_zipc_ukernel_function) xnn_x8_zip_x3_ukernel__scalar,
@@ -2245,6 +2746,16 @@ static void init(void) {
     };
   #endif  // XNN_NO_X8_OPERATORS
 
+  /**************************** X16 micro-kernels ****************************/
+  #ifndef XNN_NO_X16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_X16;
+
+    xnn_params.x16.transpose = (struct transpose_parameters) {
+      .ukernel = (xnn_transpose_ukernel_function) xnn_x16_transpose_ukernel__4x4_scalar,
+      .tile_size = 4,
+    };
+  #endif  // XNN_NO_X16_OPERATORS
+
   /**************************** F32 micro-kernels ****************************/
   #ifndef XNN_NO_F32_OPERATORS
     init_flags |= XNN_INIT_FLAG_F32;
@@ -2272,6 +2783,17 @@ static void init(void) {
       xnn_params.f32.gemm2.mr = 4;
       xnn_params.f32.gemm2.nr = 2;
       xnn_params.f32.gemm2.log2_kr = 2;
+      xnn_params.f32.ppmm = (struct ppmm_parameters) {
+        .ukernel = (xnn_f32_ppmm_minmax_ukernel_function) xnn_f32_ppmm_minmax_ukernel_4x8__wasmsimd_x86_splat,
+        .packx = (xnn_x32_packx_ukernel_function) xnn_x32_packx_ukernel_4x__wasmsimd,
+        .mr = 4,
+        .nr = 8,
+      };
+      xnn_params.f32.gemminc = (struct gemminc_parameters) {
+        .ukernel = (xnn_f32_gemminc_minmax_ukernel_function) xnn_f32_gemminc_minmax_ukernel_4x8__wasmsimd_x86_splat,
+        .mr = 4,
+        .nr = 8,
+      };
     } else {
       xnn_params.f32.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_5x8__wasmsimd_arm_splat);
       xnn_params.f32.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_5x8__wasmsimd_arm_splat);
@@ -2295,6 +2817,17 @@ static void init(void) {
       xnn_params.f32.gemm2.mr = 4;
       xnn_params.f32.gemm2.nr = 2;
       xnn_params.f32.gemm2.log2_kr = 2;
+      xnn_params.f32.ppmm = (struct ppmm_parameters) {
+        .ukernel = (xnn_f32_ppmm_minmax_ukernel_function) xnn_f32_ppmm_minmax_ukernel_4x8__wasmsimd_arm_splat,
+        .packx = (xnn_x32_packx_ukernel_function) xnn_x32_packx_ukernel_4x__wasmsimd,
+        .mr = 4,
+        .nr = 8,
+      };
+      xnn_params.f32.gemminc = (struct gemminc_parameters) {
+        .ukernel = (xnn_f32_gemminc_minmax_ukernel_function) xnn_f32_gemminc_minmax_ukernel_5x8__wasmsimd_arm_splat,
+        .mr = 5,
+        .nr = 8,
+      };
     }
 
     if (is_wasm_x86) {
@@ -2324,6 +2857,12 @@ static void init(void) {
     xnn_params.f32.dwconv[2].channel_tile = 4;
     xnn_params.f32.dwconv[2].primary_tile = 25;
 
+    xnn_params.f32.dwconv[3].minmax.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm;
+    xnn_params.f32.dwconv[3].linear.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_f32_dwconv_ukernel_mp1x9p8__wasm;
+    xnn_params.f32.dwconv[3].channel_tile = 1;
+    xnn_params.f32.dwconv[3].primary_tile = 9;
+    xnn_params.f32.dwconv[3].incremental_tile = 8;
+
     if (is_wasm_x86) {
       xnn_params.f32.avgpool = (struct avgpool_parameters) {
         .up = (xnn_avgpool_unipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9x__wasmsimd_x86_c4,
@@ -2654,6 +3193,10 @@ static void init(void) {
       .row_tile = 1,
     };
     xnn_params.x32.unpool = (xnn_unpool_ukernel_function) xnn_x32_unpool_ukernel__wasmsimd;
+    xnn_params.x32.transpose = (struct transpose_parameters) {
+      .ukernel = (xnn_transpose_ukernel_function) xnn_x32_transpose_ukernel__4x4_scalar,
+      .tile_size = 4,
+    };
     xnn_params.x32.zip = (struct zip_parameters) {
       .x2 = (xnn_zipc_ukernel_function) xnn_x32_zip_x2_ukernel__wasmsimd,
       .x3 = (xnn_zipc_ukernel_function) xnn_x32_zip_x3_ukernel__wasmsimd,
@@ -2669,6 +3212,16 @@ static void init(void) {
     #endif  // XNN_NO_NCHW_OPERATORS
   #endif  // XNN_NO_X32_OPERATORS
 
+  /**************************** VCVT micro-kernels ****************************/
+  #ifndef XNN_NO_VCVT_OPERATORS
+    init_flags |= XNN_INIT_FLAG_VCVT;
+
+    xnn_params.vcvt.f16_to_f32 = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__wasmsimd_int16_x16;
+    xnn_params.vcvt.f32_to_f16 = (xnn_univector_ukernel_function) xnn_f32_f16_vcvt_ukernel__wasmsimd_x16;
+    xnn_params.vcvt.f32_to_qs8 = (xnn_univector_ukernel_function) xnn_f32_qs8_vcvt_ukernel__wasmsimd_magic_x16;
+    xnn_params.vcvt.qs8_to_f32 = (xnn_univector_ukernel_function) xnn_qs8_f32_vcvt_ukernel__wasmsimd_x16;
+  #endif  // XNN_NO_VCVT_OPERATORS
+
 #elif XNN_ARCH_WASM
 
   /**************************** XX micro-kernels ****************************/
@@ -2705,6 +3258,13 @@ static void init(void) {
     xnn_params.qu8.vadd = (xnn_vadd_ukernel_function) xnn_qu8_vadd_minmax_ukernel__scalar;
   #endif  // XNN_NO_QU8_OPERATORS
 
+  /**************************** S8 micro-kernels ****************************/
+  #ifndef XNN_NO_S8_OPERATORS
+    init_flags |= XNN_INIT_FLAG_S8;
+
+    xnn_params.s8.rmax = xnn_s8_rmax_ukernel__scalar;
+  #endif  // XNN_NO_S8_OPERATORS
+
   /**************************** U8 micro-kernels ****************************/
   #ifndef XNN_NO_U8_OPERATORS
     init_flags |= XNN_INIT_FLAG_U8;
@@ -2723,7 +3283,11 @@ static void init(void) {
   #ifndef XNN_NO_X8_OPERATORS
     init_flags |= XNN_INIT_FLAG_X8;
 
-    xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar;
+    xnn_params.x8.lut = xnn_x8_lut_ukernel__scalar_x4;
+    xnn_params.x8.transpose = (struct transpose_parameters) {
+      .ukernel = (xnn_transpose_ukernel_function) xnn_x8_transpose_ukernel__4x4_scalar,
+      .tile_size = 4,
+    };
     xnn_params.x8.zip = (struct zip_parameters) {
       .x2 = (xnn_zipc_ukernel_function) xnn_x8_zip_x2_ukernel__scalar,
       .x3 = (xnn_zipc_ukernel_function) xnn_x8_zip_x3_ukernel__scalar,
@@ -2732,6 +3296,16 @@ static void init(void) {
     };
   #endif  // XNN_NO_X8_OPERATORS
 
+  /**************************** X16 micro-kernels ****************************/
+  #ifndef XNN_NO_X16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_X16;
+
+    xnn_params.x16.transpose = (struct transpose_parameters) {
+      .ukernel = (xnn_transpose_ukernel_function) xnn_x16_transpose_ukernel__4x4_scalar,
+      .tile_size = 4,
+    };
+  #endif  // XNN_NO_X16_OPERATORS
+
   /**************************** F32 micro-kernels ****************************/
   #ifndef XNN_NO_F32_OPERATORS
     init_flags |= XNN_INIT_FLAG_F32;
@@ -2749,6 +3323,10 @@ static void init(void) {
       xnn_params.f32.gemm.linear.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_2x4__scalar);
       xnn_params.f32.gemm.linear.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x4__wasm);
       xnn_params.f32.gemm.linear.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x4__wasm);
+      xnn_params.f32.gemm.hswish.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_hswish_ukernel_2x4__scalar);
+      xnn_params.f32.gemm.hswish.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_hswish_ukernel_2x4__scalar);
+      xnn_params.f32.gemm.hswish.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+      xnn_params.f32.gemm.hswish.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_hswish_ukernel_1x4__wasm);
       xnn_params.f32.gemm.mr = 2;
       xnn_params.f32.gemm.nr = 4;
     } else {
@@ -2764,6 +3342,10 @@ static void init(void) {
       xnn_params.f32.gemm.linear.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_4x4__wasm);
       xnn_params.f32.gemm.linear.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_ukernel_1x4__wasm);
       xnn_params.f32.gemm.linear.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_ukernel_1x4__wasm);
+      xnn_params.f32.gemm.hswish.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+      xnn_params.f32.gemm.hswish.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_hswish_ukernel_4x4__wasm);
+      xnn_params.f32.gemm.hswish.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+      xnn_params.f32.gemm.hswish.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_hswish_ukernel_1x4__wasm);
       xnn_params.f32.gemm.mr = 4;
       xnn_params.f32.gemm.nr = 4;
     }
@@ -2776,19 +3358,28 @@ static void init(void) {
 
     xnn_params.f32.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up1x4__wasm_acc2;
     xnn_params.f32.dwconv[0].linear.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_ukernel_up1x4__wasm_acc2;
+    xnn_params.f32.dwconv[0].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up1x4__wasm_acc2;
     xnn_params.f32.dwconv[0].channel_tile = 1;
     xnn_params.f32.dwconv[0].primary_tile = 4;
 
     xnn_params.f32.dwconv[1].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up1x9__wasm_acc2;
     xnn_params.f32.dwconv[1].linear.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_ukernel_up1x9__wasm_acc2;
+    xnn_params.f32.dwconv[1].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up1x9__wasm_acc2;
     xnn_params.f32.dwconv[1].channel_tile = 1;
     xnn_params.f32.dwconv[1].primary_tile = 9;
 
     xnn_params.f32.dwconv[2].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up1x25__wasm_acc2;
     xnn_params.f32.dwconv[2].linear.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_ukernel_up1x25__wasm_acc2;
+    xnn_params.f32.dwconv[2].hswish.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_hswish_ukernel_up1x25__wasm_acc2;
     xnn_params.f32.dwconv[2].channel_tile = 1;
     xnn_params.f32.dwconv[2].primary_tile = 25;
 
+    xnn_params.f32.dwconv[3].minmax.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm;
+    xnn_params.f32.dwconv[3].linear.multipass = (xnn_dwconv_multipass_ukernel_function) xnn_f32_dwconv_ukernel_mp1x9p8__wasm;
+    xnn_params.f32.dwconv[3].channel_tile = 1;
+    xnn_params.f32.dwconv[3].primary_tile = 9;
+    xnn_params.f32.dwconv[3].incremental_tile = 8;
+
     xnn_params.f32.avgpool = (struct avgpool_parameters) {
       .up = (xnn_avgpool_unipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9x__wasm_c1,
       .mp = (xnn_avgpool_multipass_ukernel_function) xnn_f32_avgpool_minmax_ukernel_9p8x__wasm_c1,
@@ -2987,6 +3578,10 @@ static void init(void) {
       .row_tile = 1,
     };
     xnn_params.x32.unpool = (xnn_unpool_ukernel_function) xnn_x32_unpool_ukernel__scalar;
+    xnn_params.x32.transpose = (struct transpose_parameters) {
+      .ukernel = (xnn_transpose_ukernel_function) xnn_x32_transpose_ukernel__4x4_scalar,
+      .tile_size = 4,
+    };
     xnn_params.x32.zip = (struct zip_parameters) {
       .x2 = (xnn_zipc_ukernel_function) xnn_x32_zip_x2_ukernel__scalar,
       .x3 = (xnn_zipc_ukernel_function) xnn_x32_zip_x3_ukernel__scalar,
@@ -3002,6 +3597,16 @@ static void init(void) {
     #endif  // XNN_NO_NCHW_OPERATORS
   #endif  // XNN_NO_X32_OPERATORS
 
+  /**************************** VCVT micro-kernels ****************************/
+  #ifndef XNN_NO_VCVT_OPERATORS
+    init_flags |= XNN_INIT_FLAG_VCVT;
+
+    xnn_params.vcvt.f16_to_f32 = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__scalar_x4;
+    xnn_params.vcvt.f32_to_f16 = (xnn_univector_ukernel_function) xnn_f32_f16_vcvt_ukernel__scalar_x4;
+    xnn_params.vcvt.f32_to_qs8 = (xnn_univector_ukernel_function) xnn_f32_qs8_vcvt_ukernel__scalar_magic_x4;
+    xnn_params.vcvt.qs8_to_f32 = (xnn_univector_ukernel_function) xnn_qs8_f32_vcvt_ukernel__scalar_x4;
+  #endif  // XNN_NO_VCVT_OPERATORS
+
 #else
   #error "Unsupported architecture"
 #endif
@@ -126,6 +126,9 @@ void xnn_init_value_allocation_tracker(struct xnn_value_allocation_tracker* trac
   tracker->subgraph = subgraph;
   tracker->mem_arena_size = 0;
   tracker->usage = xnn_allocate_zero_memory(sizeof(struct xnn_value_usage) * subgraph->num_values);
+  for (uint32_t i = 0; i < subgraph->num_values; i++) {
+    tracker->usage[i].reuse_value_id = XNN_INVALID_VALUE_ID;
+  }
 #if XNN_ENABLE_MEMOPT
   populate_value_lifecycle(tracker->subgraph, tracker->usage);
 #endif
@@ -133,6 +136,39 @@ void xnn_init_value_allocation_tracker(struct xnn_value_allocation_tracker* trac
   tracker->max_value_id = XNN_INVALID_VALUE_ID;
 }
 
+void xnn_assign_value_lifecycle_levels(struct xnn_value_allocation_tracker* tracker,
+                                       const uint32_t* node_levels) {
+#if XNN_ENABLE_MEMOPT
+  const xnn_subgraph_t subgraph = tracker->subgraph;
+  struct xnn_value_usage* usage = tracker->usage;
+  // Levels are not monotonic in Node indices, so the lifecycle spans the lowest to the highest level of all Nodes which
+  // use the xnn_value, rather than the levels of its first and last Nodes.
+  for (uint32_t i = 0; i < subgraph->num_values; i++) {
+    usage[i].first_node = UINT32_MAX;
+    usage[i].last_node = 0;
+  }
+  for (uint32_t nid = 0; nid < subgraph->num_nodes; nid++) {
+    const struct xnn_node* node = subgraph->nodes + nid;
+    const uint32_t level = node_levels[nid];
+    for (uint32_t i = 0; i < node->num_inputs + node->num_outputs; i++) {
+      const uint32_t value_id = i < node->num_inputs ? node->inputs[i] : node->outputs[i - node->num_inputs];
+      if (usage[value_id].first_node > level) {
+        usage[value_id].first_node = level;
+      }
+      if (usage[value_id].last_node < level) {
+        usage[value_id].last_node = level;
+      }
+    }
+  }
+  for (uint32_t i = 0; i < subgraph->num_values; i++) {
+    if (usage[i].first_node == UINT32_MAX) {
+      // xnn_value is not used by any Node.
+      usage[i].first_node = 0;
+    }
+  }
+#endif
+}
+
 void xnn_add_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker,
                                       uint32_t value_id,
                                       size_t tensor_size) {
@@ -148,6 +184,146 @@ void xnn_add_value_allocation_tracker(struct xnn_value_allocation_tracker* track
   tracker->max_value_id = value_id;
 }
 
+void xnn_mark_tensor_as_reuse(struct xnn_value_allocation_tracker* tracker,
+                              uint32_t value_id,
+                              uint32_t reuse_value_id,
+                              uint32_t new_last_node) {
+  struct xnn_value_usage* usage = tracker->usage;
+  assert(value_id != reuse_value_id);
+  assert(usage[value_id].reuse_value_id == XNN_INVALID_VALUE_ID);
+  usage[value_id].reuse_value_id = reuse_value_id;
+
+  // Extend the lifecycle of the reused xnn_value, and of any xnn_value whose memory it reuses in turn, so that the
+  // shared memory block stays live until the last use of 'value_id'.
+  if (new_last_node < usage[value_id].last_node) {
+    new_last_node = usage[value_id].last_node;
+  }
+  for (uint32_t id = reuse_value_id; id != XNN_INVALID_VALUE_ID; id = usage[id].reuse_value_id) {
+    if (usage[id].last_node < new_last_node) {
+      usage[id].last_node = new_last_node;
+    }
+  }
+}
+
+void xnn_mark_tensor_as_view(struct xnn_value_allocation_tracker* tracker,
+                             uint32_t view_id,
+                             uint32_t value_id) {
+  struct xnn_value_usage* usage = tracker->usage;
+  assert(view_id != value_id);
+  assert(usage[view_id].tensor_size == 0);
+
+  // The view is written before, or read after, any use of the xnn_value itself, e.g. when a producer writes its output
+  // into a slice of a Concatenate output.
+  for (uint32_t id = value_id; id != XNN_INVALID_VALUE_ID; id = usage[id].reuse_value_id) {
+    if (usage[id].first_node > usage[view_id].first_node) {
+      usage[id].first_node = usage[view_id].first_node;
+    }
+    if (usage[id].last_node < usage[view_id].last_node) {
+      usage[id].last_node = usage[view_id].last_node;
+    }
+  }
+}
+
+// Check if the Node computes every output element only from the input elements at the same position, so that the
+// output can overwrite an input of the same size.
+static bool is_elementwise_node(const struct xnn_node* node) {
+  switch (node->type) {
+    case xnn_node_type_abs:
+    case xnn_node_type_add2:
+    case xnn_node_type_bankers_rounding:
+    case xnn_node_type_ceiling:
+    case xnn_node_type_clamp:
+    case xnn_node_type_divide:
+    case xnn_node_type_elu:
+    case xnn_node_type_floor:
+    case xnn_node_type_hardswish:
+    case xnn_node_type_leaky_relu:
+    case xnn_node_type_maximum2:
+    case xnn_node_type_minimum2:
+    case xnn_node_type_multiply2:
+    case xnn_node_type_negate:
+    case xnn_node_type_sigmoid:
+    case xnn_node_type_square:
+    case xnn_node_type_square_root:
+    case xnn_node_type_squared_difference:
+    case xnn_node_type_subtract:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool is_same_shape(const struct xnn_value* a, const struct xnn_value* b) {
+  if (a->datatype != b->datatype || a->shape.num_dims != b->shape.num_dims) {
+    return false;
+  }
+  for (size_t i = 0; i < a->shape.num_dims; i++) {
+    if (a->shape.dim[i] != b->shape.dim[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Return the id of the xnn_value which owns the memory of the xnn_value 'value_id'.
+static uint32_t find_reused_value_id(const struct xnn_value_usage* usage, uint32_t value_id) {
+  while (usage[value_id].reuse_value_id != XNN_INVALID_VALUE_ID) {
+    value_id = usage[value_id].reuse_value_id;
+  }
+  return value_id;
+}
+
+void xnn_plan_in_place_operations(struct xnn_value_allocation_tracker* tracker) {
+// Without memory optimizations the lifecycle of xnn_values is not tracked, and in-place execution is disabled.
+#if XNN_ENABLE_MEMOPT
+  const xnn_subgraph_t subgraph = tracker->subgraph;
+  struct xnn_value_usage* usage = tracker->usage;
+  for (uint32_t nid = 0; nid < subgraph->num_nodes; nid++) {
+    const struct xnn_node* node = subgraph->nodes + nid;
+    if (!is_elementwise_node(node)) {
+      continue;
+    }
+    assert(node->num_outputs == 1);
+    const uint32_t output_id = node->outputs[0];
+    if (usage[output_id].tensor_size == 0 || usage[output_id].reuse_value_id != XNN_INVALID_VALUE_ID) {
+      // Output is not allocated in the memory arena.
+      continue;
+    }
+
+    for (uint32_t i = 0; i < node->num_inputs; i++) {
+      const uint32_t input_id = node->inputs[i];
+      if (usage[input_id].tensor_size == 0) {
+        // Input is not allocated in the memory arena.
+        continue;
+      }
+      if (!is_same_shape(&subgraph->values[input_id], &subgraph->values[output_id])) {
+        // Input is broadcasted to the output shape.
+        continue;
+      }
+      // The memory of the input, including all its aliases, must not be used after this Node.
+      if (usage[find_reused_value_id(usage, input_id)].last_node != nid) {
+        continue;
+      }
+      xnn_mark_tensor_as_reuse(tracker, output_id, input_id, usage[output_id].last_node);
+      break;
+    }
+  }
+#endif
+}
+
+// Assign xnn_values which reuse the memory of other xnn_values the same offset as the xnn_value they reuse.
+static void assign_reused_alloc_offsets(struct xnn_value_allocation_tracker* tracker) {
+  for (size_t i = tracker->min_value_id; i <= tracker->max_value_id; ++i) {
+    struct xnn_value_usage* info = tracker->usage + i;
+    if (info->reuse_value_id == XNN_INVALID_VALUE_ID) {
+      continue;
+    }
+    const uint32_t root_id = find_reused_value_id(tracker->usage, info->reuse_value_id);
+    assert(tracker->usage[root_id].tensor_size >= info->tensor_size);
+    info->alloc_offset = tracker->usage[root_id].alloc_offset;
+  }
+}
+
 void xnn_plan_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker) {
 #if XNN_ENABLE_MEMOPT
   if (tracker->min_value_id == XNN_INVALID_VALUE_ID) {
@@ -160,7 +336,7 @@ void xnn_plan_value_allocation_tracker(struct xnn_value_allocation_tracker* trac
   size_t num_values_to_alloc = 0;
   for (size_t i = tracker->min_value_id; i <= tracker->max_value_id; ++i) {
     struct xnn_value_usage* info = tracker->usage + i;
-    if (info->tensor_size != 0) {
+    if (info->tensor_size != 0 && info->reuse_value_id == XNN_INVALID_VALUE_ID) {
       sorted_usage[num_values_to_alloc++] = info;
     }
   }
@@ -192,12 +368,18 @@ void xnn_plan_value_allocation_tracker(struct xnn_value_allocation_tracker* trac
   xnn_release_memory(sorted_usage);
   xnn_release_memory(current_live_mem_blocks);
 #else
+  if (tracker->min_value_id == XNN_INVALID_VALUE_ID) {
+    assert(tracker->max_value_id == XNN_INVALID_VALUE_ID);
+    return;
+  }
+
   tracker->mem_arena_size = 0;
   for (uint32_t i = tracker->min_value_id; i <= tracker->max_value_id; ++i) {
-    if (tracker->usage[i].tensor_size > 0) {
+    if (tracker->usage[i].tensor_size > 0 && tracker->usage[i].reuse_value_id == XNN_INVALID_VALUE_ID) {
       tracker->usage[i].alloc_offset = tracker->mem_arena_size;
       tracker->mem_arena_size += tracker->usage[i].tensor_size;
     }
   }
 #endif
+  assign_reused_alloc_offsets(tracker);
 }
@@ -13,6 +13,7 @@
 #include <xnnpack/log.h>
 #include <xnnpack/operator.h>
 #include <xnnpack/params.h>
+#include <xnnpack/weights-cache.h>
 
 
 enum xnn_status xnn_delete_operator(xnn_operator_t op)
@@ -27,10 +28,15 @@ enum xnn_status xnn_delete_operator(xnn_operator_t op)
   }
 
   xnn_release_memory(op->indirection_buffer);
-  xnn_release_simd_memory(op->packed_weights);
+  if (op->weights_cache != NULL) {
+    xnn_weights_cache_release_packed_weights(op->weights_cache, op->packed_weights);
+  } else {
+    xnn_release_simd_memory(op->packed_weights);
+  }
   xnn_release_simd_memory(op->zero_buffer);
   xnn_release_memory(op->pixelwise_buffer);
   xnn_release_memory(op->subconvolution_buffer);
+  xnn_release_simd_memory(op->workspace);
   xnn_release_simd_memory(op->lookup_table);
   xnn_release_simd_memory(op);
   return xnn_status_success;
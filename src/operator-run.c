@@ -7,6 +7,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -17,6 +18,7 @@
 #include <xnnpack/log.h>
 #include <xnnpack/common.h>
 #include <xnnpack/math.h>
+#include <xnnpack/pack.h>
 #include <xnnpack/params.h>
 #include <xnnpack/compute.h>
 
@@ -37,7 +39,7 @@ void xnn_compute_grouped_gemm(
       mr_block_size,
       nr_block_size,
       k_scaled,
-      (const void*) ((uintptr_t) context->a + mr_block_start * a_stride + group_index * k_scaled),
+      (const void*) ((uintptr_t) context->a + mr_block_start * a_stride + group_index * context->ga_stride),
       a_stride,
       (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride + group_index * context->wg_stride),
       (void*) ((uintptr_t) context->c + mr_block_start * cm_stride + (nr_block_start << context->log2_csize) + group_index * context->cg_stride),
@@ -69,6 +71,169 @@ void xnn_compute_gemm(
       &context->params);
 }
 
+void xnn_compute_batch_matrix_multiply_pack_b(
+    const struct batch_matrix_multiply_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t group_index,
+    size_t nr_block_start,
+    size_t nr_block_size)
+{
+  const size_t k = context->k;
+  const float* b = (const float*) ((uintptr_t) context->b + group_index * context->gb_stride);
+  float* packed_w = (float*) ((uintptr_t) context->gemm.packed_w +
+    group_index * context->gemm.wg_stride + nr_block_start * context->gemm.w_stride);
+
+  // Bias and padding elements of the packed matrix are zeroed on setup, and are not touched here.
+  if (context->transpose_b) {
+    xnn_pack_f32_gemm_goi_w(
+      1, nr_block_size, k,
+      context->nr, context->kr, context->sr,
+      b + nr_block_start * k, NULL /* bias */,
+      packed_w, 0 /* extra bytes */, NULL /* params */);
+  } else {
+    xnn_pack_f32_gemm_gio_w(
+      1, nr_block_size, k,
+      context->nr, context->kr, context->sr,
+      context->n /* k stride */,
+      b + nr_block_start, NULL /* bias */,
+      packed_w, 0 /* extra bytes */, NULL /* params */);
+  }
+}
+
+void xnn_compute_qd8_quantize_a(
+    const struct qd8_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t m_index)
+{
+  const size_t k = context->k;
+
+  context->vcvt_ukernel(
+      k * sizeof(float),
+      (const float*) ((uintptr_t) context->a + m_index * context->a_stride),
+      (int8_t*) ((uintptr_t) context->quantized_a + m_index * k),
+      &context->quantization_params[m_index]);
+}
+
+void xnn_compute_qd8_gemm(
+    const struct qd8_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t k = context->k;
+  const size_t cm_stride = context->cm_stride;
+
+  context->gemm_ukernel(
+      mr_block_size,
+      nr_block_size,
+      k,
+      (const int8_t*) ((uintptr_t) context->quantized_a + mr_block_start * k),
+      k,
+      (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
+      (float*) ((uintptr_t) context->c + mr_block_start * cm_stride + nr_block_start * sizeof(float)),
+      cm_stride,
+      context->cn_stride,
+      &context->params,
+      &context->quantization_params[mr_block_start]);
+}
+
+void xnn_compute_ppmm(
+    const struct ppmm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start,
+    size_t mr_block_size)
+{
+  const size_t k_scaled = context->k_scaled;
+  const size_t a_stride = context->a_stride;
+  // PACKX micro-kernel always writes a full panel, so the panel for rows starting at mr_block_start is located at
+  // mr_block_start * k_scaled bytes into the buffer (mr_block_start is a multiple of MR).
+  uint32_t* packed_a = (uint32_t*) ((uintptr_t) context->packed_a + mr_block_start * k_scaled);
+
+  context->packx_ukernel(
+      mr_block_size,
+      k_scaled / sizeof(float),
+      (const uint32_t*) ((uintptr_t) context->a + mr_block_start * a_stride),
+      a_stride,
+      packed_a);
+  context->ppmm_ukernel(
+      mr_block_size,
+      context->n,
+      k_scaled,
+      (const float*) packed_a,
+      (const float*) context->packed_w,
+      (float*) ((uintptr_t) context->c + mr_block_start * context->cm_stride),
+      context->cm_stride,
+      context->cn_stride,
+      &context->params);
+}
+
+void xnn_compute_kblocked_gemm(
+    const struct kblocked_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t mr = context->mr;
+  const size_t nr = context->nr;
+  const size_t k_scaled = context->k_scaled;
+  const size_t kc_scaled = context->kc_scaled;
+  const size_t a_stride = context->a_stride;
+  const size_t w_stride = context->w_stride;
+  const size_t nr_block_end = nr_block_start + nr_block_size;
+  const void* a = (const void*) ((uintptr_t) context->a + mr_block_start * a_stride);
+  void* acc = (void*) ((uintptr_t) context->acc + mr_block_start * context->acc_stride);
+
+  // Initialize partial sums with the bias, which precedes filter elements for each tile of NR output channels.
+  for (size_t n = nr_block_start; n < nr_block_end; n += nr) {
+    const void* bias = (const void*) ((uintptr_t) context->packed_w + n * w_stride);
+    float* acc_tile = (float*) ((uintptr_t) acc + n * mr * sizeof(float));
+    for (size_t m = 0; m < mr; m++) {
+      memcpy(acc_tile + m * nr, bias, nr * sizeof(float));
+    }
+  }
+
+  size_t acc_buffer_offset = 0;
+  for (size_t k = 0; k < k_scaled; k += kc_scaled) {
+    const size_t kc = min(kc_scaled, k_scaled - k);
+    const bool last_block = k + kc == k_scaled;
+    for (size_t n = nr_block_start; n < nr_block_end; n += nr) {
+      const size_t acc_tile_offset = n * mr * sizeof(float);
+      const float* acc_tile = (const float*) ((uintptr_t) acc + acc_buffer_offset + acc_tile_offset);
+      // Filter elements for the block of K follow the bias and filter elements for previous blocks of K.
+      const float* w = (const float*) ((uintptr_t) context->packed_w + n * w_stride + nr * (sizeof(float) + k));
+      if (last_block) {
+        context->ukernel(
+            mr_block_size,
+            min(nr, nr_block_end - n),
+            kc,
+            (const float*) ((uintptr_t) a + k),
+            a_stride,
+            w,
+            (float*) ((uintptr_t) context->c + mr_block_start * context->cm_stride + n * sizeof(float)),
+            context->cm_stride,
+            nr * sizeof(float),
+            acc_tile,
+            &context->params);
+      } else {
+        // Partial sums are written to the other half of the buffer, in the same MR x NR tiled layout.
+        float* next_acc_tile = (float*) ((uintptr_t) acc + (acc_buffer_offset ^ context->acc_buffer_stride) + acc_tile_offset);
+        context->ukernel(
+            mr_block_size,
+            min(nr, nr_block_end - n),
+            kc,
+            (const float*) ((uintptr_t) a + k),
+            a_stride,
+            w,
+            next_acc_tile,
+            nr * sizeof(float),
+            mr * nr * sizeof(float),
+            acc_tile,
+            &context->partial_params);
+      }
+    }
+    acc_buffer_offset ^= context->acc_buffer_stride;
+  }
+}
+
 void xnn_compute_spmm(
     const struct spmm_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index,
@@ -384,6 +549,27 @@ void xnn_compute_dwconv_unipass(
     &context->params);
 }
 
+void xnn_compute_dwconv_multipass(
+    const struct dwconv_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t output_y)
+{
+  const void** indirect_input =
+    (const void**) ((uintptr_t) context->indirect_input + output_y * context->indirect_input_height_stride);
+  const size_t input_offset = context->input_offset + batch_index * context->input_batch_stride;
+  void* output = (void*) ((uintptr_t) context->output +
+    batch_index * context->output_batch_stride + output_y * context->output_height_stride);
+
+  void* multipass_buffer = XNN_SIMD_ALLOCA(context->buffer_size);
+
+  context->multipass_ukernel(
+    context->groups, context->output_width, context->kernel_size,
+    indirect_input, context->packed_weights, multipass_buffer, output,
+    context->indirect_input_width_stride, context->output_increment,
+    input_offset, context->zero,
+    &context->params);
+}
+
 void xnn_compute_dwconv2d_chw(
     const struct dwconv2d_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index,
@@ -763,6 +949,41 @@ void xnn_compute_pad_5d(
   }
 }
 
+void xnn_compute_transpose_6d_tile_2d(
+    const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j, size_t k, size_t l, size_t m, size_t n,
+    size_t tile_m, size_t tile_n)
+{
+  const size_t* input_stride = context->input_stride;
+  const size_t* output_stride = context->output_stride;
+  const void* input = (const void*) ((uintptr_t) context->input +
+    i * input_stride[0] + j * input_stride[1] + k * input_stride[2] + l * input_stride[3] +
+    m * input_stride[4] + n * input_stride[5]);
+  void* output = (void*) ((uintptr_t) context->output +
+    i * output_stride[0] + j * output_stride[1] + k * output_stride[2] + l * output_stride[3] +
+    m * output_stride[4] + n * output_stride[5]);
+
+  // The M dimension is contiguous in the input, and the N dimension is contiguous in the output.
+  context->transpose_ukernel(
+    input, output,
+    input_stride[5] /* input stride */, output_stride[4] /* output stride */,
+    tile_m /* block width */, tile_n /* block height */);
+}
+
+void xnn_compute_transpose_copy_5d(
+    const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j, size_t k, size_t l, size_t m)
+{
+  const size_t* input_stride = context->input_stride;
+  const size_t* output_stride = context->output_stride;
+  const void* input = (const void*) ((uintptr_t) context->input +
+    i * input_stride[0] + j * input_stride[1] + k * input_stride[2] + l * input_stride[3] + m * input_stride[4]);
+  void* output = (void*) ((uintptr_t) context->output +
+    i * output_stride[0] + j * output_stride[1] + k * output_stride[2] + l * output_stride[3] + m * output_stride[4]);
+
+  context->copy_ukernel(context->copy_size, input, output, NULL);
+}
+
 void xnn_compute_elementwise_binary_5d(
     const struct elementwise_binary_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t i, size_t j, size_t k, size_t l, size_t m)
@@ -835,7 +1056,7 @@ void xnn_compute_univector_contiguous(
     size_t size)
 {
   const void* x = (const void*) ((uintptr_t) context->x + offset);
-  void* y = (void*) ((uintptr_t) context->y + offset);
+  void* y = (void*) ((uintptr_t) context->y + ((offset >> context->log2_xsize) << context->log2_ysize));
   context->ukernel(size, x, y, &context->params);
 }
 
@@ -854,6 +1075,32 @@ void xnn_compute_u8_softmax(
   context->lut_norm_ukernel(n, x, t, y);
 }
 
+void xnn_compute_s8_softmax(
+    const struct s8_softmax_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index)
+{
+  const int8_t* x = (const int8_t*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  int8_t* y = (int8_t*) ((uintptr_t) context->y + context->y_stride * batch_index);
+  const size_t n = context->n;
+
+  int8_t x_max = INT8_MIN;
+  context->rmax_ukernel(n, x, &x_max);
+  const size_t adjustment = (size_t) (127 - (int32_t) x_max);
+
+  // Rotate the table so that the bytes of non-negative inputs index its first half, and the bytes of negative inputs
+  // index its second half. Then the unsigned LUT32NORM micro-kernel works directly on the signed inputs.
+  uint32_t t[256];
+  memcpy(t, (const uint32_t*) context->t + 128 + adjustment, 128 * sizeof(uint32_t));
+  memcpy(t + 128, (const uint32_t*) context->t + adjustment, 128 * sizeof(uint32_t));
+  context->lut_norm_ukernel(n, (const uint8_t*) x, t, (uint8_t*) y);
+
+  // Convert the outputs from zero point 0 in [0, 255] range to zero point -128 in [-128, 127] range.
+  uint8_t* o = (uint8_t*) y;
+  for (size_t i = 0; i < n; i++) {
+    o[i] ^= UINT8_C(0x80);
+  }
+}
+
 void xnn_compute_f32_three_pass_softmax(
     const struct f32_three_pass_softmax_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index)
@@ -913,7 +1160,7 @@ void xnn_compute_vmulcaddc(
         mr_block_size,
         nr_block_size,
         k_scaled,
-        (const void*) ((uintptr_t) context->a + mr_block_start * a_stride + group_index * k_scaled),
+        (const void*) ((uintptr_t) context->a + mr_block_start * a_stride + group_index * context->ga_stride),
         a_stride,
         (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride + group_index * context->wg_stride),
         (void*) ((uintptr_t) context->c + mr_block_start * cm_stride + (nr_block_start << context->log2_csize) + group_index * context->cg_stride),
@@ -1071,6 +1318,33 @@ enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
       return xnn_status_success;
   }
 
+  switch (op->compute0.type) {
+    case xnn_parallelization_type_invalid:
+      break;
+    case xnn_parallelization_type_1d:
+      assert(op->compute0.range[0] != 0);
+      pthreadpool_parallelize_1d(
+          threadpool,
+          op->compute0.task_1d,
+          &op->context,
+          op->compute0.range[0],
+          PTHREADPOOL_FLAG_DISABLE_DENORMALS /* flags */);
+      break;
+    case xnn_parallelization_type_2d_tile_1d:
+      assert(op->compute0.range[0] != 0);
+      assert(op->compute0.range[1] != 0);
+      assert(op->compute0.tile[0] != 0);
+      pthreadpool_parallelize_2d_tile_1d(
+          threadpool,
+          op->compute0.task_2d_tile_1d,
+          &op->context,
+          op->compute0.range[0], op->compute0.range[1],
+          op->compute0.tile[0],
+          PTHREADPOOL_FLAG_DISABLE_DENORMALS /* flags */);
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
   switch (op->compute.type) {
     case xnn_parallelization_type_invalid:
       break;
@@ -1277,5 +1551,22 @@ enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
     default:
       XNN_UNREACHABLE;
   }
+  switch (op->compute2.type) {
+    case xnn_parallelization_type_invalid:
+      break;
+    case xnn_parallelization_type_1d_tile_1d:
+      assert(op->compute2.range[0] != 0);
+      assert(op->compute2.tile[0] != 0);
+      pthreadpool_parallelize_1d_tile_1d(
+          threadpool,
+          op->compute2.task_1d_tile_1d,
+          &op->context2,
+          op->compute2.range[0],
+          op->compute2.tile[0],
+          PTHREADPOOL_FLAG_DISABLE_DENORMALS /* flags */);
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
   return xnn_status_success;
 }
@@ -12,8 +12,6 @@
 #include <xnnpack/subgraph.h>
 
 
-// This function is defined inline when logging is disabled
-#if XNN_LOG_LEVEL > 0
 const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
   switch (type) {
     case xnn_operator_type_invalid:
@@ -34,6 +32,8 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Average Pooling (NHWC, QU8)";
     case xnn_operator_type_bankers_rounding_nc_f32:
       return "Bankers Rounding (NC, F32)";
+    case xnn_operator_type_batch_matrix_multiply_nc_f32:
+      return "Batch Matrix Multiply (NC, F32)";
     case xnn_operator_type_ceiling_nc_f32:
       return "Ceiling (NC, F32)";
     case xnn_operator_type_channel_shuffle_nc_x32:
@@ -46,16 +46,28 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Clamp (NC, U8)";
     case xnn_operator_type_constant_pad_nd_x32:
       return "Constant Pad (ND, X32)";
+    case xnn_operator_type_convert_nc_f16_f32:
+      return "Convert (NC, F16, F32)";
+    case xnn_operator_type_convert_nc_f32_f16:
+      return "Convert (NC, F32, F16)";
+    case xnn_operator_type_convert_nc_f32_qs8:
+      return "Convert (NC, F32, QS8)";
+    case xnn_operator_type_convert_nc_qs8_f32:
+      return "Convert (NC, QS8, F32)";
     case xnn_operator_type_convolution_nhwc_f16:
       return "Convolution (NHWC, F16)";
     case xnn_operator_type_convolution_nhwc_f32:
       return "Convolution (NHWC, F32)";
+    case xnn_operator_type_convolution_nhwc_qc8:
+      return "Convolution (NHWC, QC8)";
     case xnn_operator_type_convolution_nhwc_qs8:
       return "Convolution (NHWC, QS8)";
     case xnn_operator_type_convolution_nhwc_qu8:
       return "Convolution (NHWC, QU8)";
     case xnn_operator_type_convolution_nchw_f32:
       return "Convolution (NCHW, F32)";
+    case xnn_operator_type_copy_nc_x8:
+      return "Copy (NC, X8)";
     case xnn_operator_type_copy_nc_x32:
       return "Copy (NC, X32)";
     case xnn_operator_type_deconvolution_nhwc_f32:
@@ -74,6 +86,10 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Floor (NC, F32)";
     case xnn_operator_type_fully_connected_nc_f32:
       return "Fully Connected (NC, F32)";
+    case xnn_operator_type_fully_connected_nc_qc8:
+      return "Fully Connected (NC, QC8)";
+    case xnn_operator_type_fully_connected_nc_qd8_f32_qc8w:
+      return "Fully Connected (NC, QD8, F32, QC8W)";
     case xnn_operator_type_fully_connected_nc_qs8:
       return "Fully Connected (NC, QS8)";
     case xnn_operator_type_fully_connected_nc_qu8:
@@ -122,6 +138,8 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Sigmoid (NC, QU8)";
     case xnn_operator_type_softmax_nc_f32:
       return "Softmax (NC, F32)";
+    case xnn_operator_type_softmax_nc_qs8:
+      return "Softmax (NC, QS8)";
     case xnn_operator_type_softmax_nc_qu8:
       return "Softmax (NC, QU8)";
     case xnn_operator_type_square_nc_f32:
@@ -134,10 +152,15 @@ const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
       return "Subtract (ND, F32)";
     case xnn_operator_type_truncation_nc_f32:
       return "Truncation (NC, F32)";
+    case xnn_operator_type_transpose_nd_x8:
+      return "Transpose (ND, X8)";
+    case xnn_operator_type_transpose_nd_x16:
+      return "Transpose (ND, X16)";
+    case xnn_operator_type_transpose_nd_x32:
+      return "Transpose (ND, X32)";
     case xnn_operator_type_unpooling_nhwc_x32:
       return "Unpooling (NHWC, X32)";
   }
   XNN_UNREACHABLE;
   return NULL;
 }
-#endif  // XNN_LOG_LEVEL > 0
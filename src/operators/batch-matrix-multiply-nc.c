@@ -0,0 +1,230 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params-init.h>
+#include <xnnpack/params.h>
+
+
+enum xnn_status xnn_create_batch_matrix_multiply_nc_f32(
+    uint32_t flags,
+    xnn_operator_t* batch_matrix_multiply_op_out)
+{
+  xnn_operator_t batch_matrix_multiply_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_F32) == 0) {
+    xnn_log_error(
+      "failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32));
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  batch_matrix_multiply_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (batch_matrix_multiply_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32));
+    goto error;
+  }
+
+  const struct gemm_fused_ukernels* gemm_ukernels = &xnn_params.f32.gemm.minmax;
+  if (xnn_params.f32.gemm.linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
+    gemm_ukernels = &xnn_params.f32.gemm.linear;
+  }
+  batch_matrix_multiply_op->params.f32_minmax = xnn_init_f32_minmax_params(-INFINITY, +INFINITY);
+
+  batch_matrix_multiply_op->type = xnn_operator_type_batch_matrix_multiply_nc_f32;
+  batch_matrix_multiply_op->flags = flags;
+
+  batch_matrix_multiply_op->ukernel.type = xnn_ukernel_type_gemm;
+  batch_matrix_multiply_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
+    .general_case = gemm_ukernels->gemm,
+    .mr1_case = gemm_ukernels->gemm1,
+    .mr = xnn_params.f32.gemm.mr,
+    .nr = xnn_params.f32.gemm.nr,
+    .kr = UINT32_C(1) << xnn_params.f32.gemm.log2_kr,
+  };
+
+  batch_matrix_multiply_op->state = xnn_run_state_invalid;
+
+  *batch_matrix_multiply_op_out = batch_matrix_multiply_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(batch_matrix_multiply_op);
+  return status;
+}
+
+enum xnn_status xnn_setup_batch_matrix_multiply_nc_f32(
+    xnn_operator_t batch_matrix_multiply_op,
+    size_t batch_size,
+    size_t m,
+    size_t k,
+    size_t n,
+    const float* input_a,
+    const float* input_b,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (batch_matrix_multiply_op->type != xnn_operator_type_batch_matrix_multiply_nc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32),
+      xnn_operator_type_to_string(batch_matrix_multiply_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  batch_matrix_multiply_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32));
+    return xnn_status_uninitialized;
+  }
+
+  if (k == 0) {
+    xnn_log_error(
+      "failed to setup %s operator with K = %zu: K dimension must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32), k);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (n == 0) {
+    xnn_log_error(
+      "failed to setup %s operator with N = %zu: N dimension must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_batch_matrix_multiply_nc_f32), n);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (batch_size == 0 || m == 0) {
+    batch_matrix_multiply_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  uint32_t mr = batch_matrix_multiply_op->ukernel.gemm.mr;
+  const uint32_t nr = batch_matrix_multiply_op->ukernel.gemm.nr;
+  const uint32_t kr = batch_matrix_multiply_op->ukernel.gemm.kr;
+  const uint32_t sr = UINT32_C(1) << xnn_params.f32.gemm.log2_sr;
+
+  // Packed B matrices are rebuilt on every run, and take the space of GEMM weights with bias for each matrix.
+  const size_t n_stride = round_up(n, nr);
+  const size_t w_stride = sizeof(float) + (round_up_po2(k, kr) << 2 /* log2(sizeof(float)) */);
+  const size_t wg_stride = n_stride * w_stride;
+  const size_t workspace_size = batch_size * wg_stride;
+  if (workspace_size > batch_matrix_multiply_op->workspace_size) {
+    xnn_release_simd_memory(batch_matrix_multiply_op->workspace);
+    batch_matrix_multiply_op->workspace_size = 0;
+    batch_matrix_multiply_op->workspace = xnn_allocate_simd_memory(workspace_size);
+    if (batch_matrix_multiply_op->workspace == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator workspace",
+        workspace_size, xnn_operator_type_to_string(batch_matrix_multiply_op->type));
+      return xnn_status_out_of_memory;
+    }
+    batch_matrix_multiply_op->workspace_size = workspace_size;
+  }
+  // Packing on every run writes only the elements of B, so the bias and padding stay zero.
+  memset(batch_matrix_multiply_op->workspace, 0, workspace_size);
+
+  struct xnn_hmp_gemm_ukernel gemm_ukernel = batch_matrix_multiply_op->ukernel.gemm.general_case;
+  if (m == 1 && batch_matrix_multiply_op->ukernel.gemm.mr1_case.function[XNN_UARCH_DEFAULT] != NULL) {
+    gemm_ukernel = batch_matrix_multiply_op->ukernel.gemm.mr1_case;
+    mr = 1;
+  }
+
+  batch_matrix_multiply_op->context.batch_matrix_multiply = (struct batch_matrix_multiply_context) {
+    .gemm = {
+      .k_scaled = k << 2 /* log2(sizeof(float)) */,
+      .a = input_a,
+      .a_stride = k << 2 /* log2(sizeof(float)) */,
+      .ga_stride = (m * k) << 2 /* log2(sizeof(float)) */,
+      .packed_w = batch_matrix_multiply_op->workspace,
+      .w_stride = w_stride,
+      .wg_stride = wg_stride,
+      .c = output,
+      .cm_stride = n << 2 /* log2(sizeof(float)) */,
+      .cn_stride = nr << 2 /* log2(sizeof(float)) */,
+      .cg_stride = (m * n) << 2 /* log2(sizeof(float)) */,
+      .log2_csize = 2 /* log2(sizeof(float)) */,
+      .ukernel = gemm_ukernel,
+    },
+    .k = k,
+    .n = n,
+    .b = input_b,
+    .gb_stride = (k * n) << 2 /* log2(sizeof(float)) */,
+    .transpose_b = (batch_matrix_multiply_op->flags & XNN_FLAG_TRANSPOSE_B) != 0,
+    .nr = nr,
+    .kr = kr,
+    .sr = sr,
+  };
+  batch_matrix_multiply_op->context.batch_matrix_multiply.gemm.params.f32 = batch_matrix_multiply_op->params.f32_minmax;
+
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  const size_t num_nr_blocks = divide_round_up(n, nr);
+
+  // B matrices are packed in tiles of NR-aligned blocks of columns, a few tiles per thread.
+  size_t pack_nc = n;
+  if (num_threads > 1) {
+    const size_t target_tiles_per_thread = 4;
+    pack_nc = min(n, nr * divide_round_up(batch_size * num_nr_blocks, num_threads * target_tiles_per_thread));
+  }
+  batch_matrix_multiply_op->compute0.type = xnn_parallelization_type_2d_tile_1d;
+  batch_matrix_multiply_op->compute0.task_2d_tile_1d =
+    (pthreadpool_task_2d_tile_1d_t) xnn_compute_batch_matrix_multiply_pack_b;
+  batch_matrix_multiply_op->compute0.range[0] = batch_size;
+  batch_matrix_multiply_op->compute0.range[1] = n;
+  batch_matrix_multiply_op->compute0.tile[0] = pack_nc;
+
+  size_t nc = n;
+  if (num_threads > 1) {
+    const size_t num_other_tiles = batch_size * divide_round_up(m, mr);
+    const size_t target_tiles_per_thread = 5;
+    const size_t max_nc = divide_round_up(n * num_other_tiles, num_threads * target_tiles_per_thread);
+    if (max_nc < nc) {
+      nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+    }
+  }
+  #if XNN_MAX_UARCH_TYPES > 1
+    if (xnn_is_hmp_gemm_ukernel(gemm_ukernel)) {
+      batch_matrix_multiply_op->compute.type = xnn_parallelization_type_3d_tile_2d_with_uarch;
+      batch_matrix_multiply_op->compute.task_3d_tile_2d_with_id =
+        (pthreadpool_task_3d_tile_2d_with_id_t) xnn_compute_hmp_grouped_gemm;
+    } else {
+      batch_matrix_multiply_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+      batch_matrix_multiply_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_grouped_gemm;
+    }
+  #else
+    batch_matrix_multiply_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+    batch_matrix_multiply_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_grouped_gemm;
+  #endif
+  batch_matrix_multiply_op->compute.range[0] = batch_size;
+  batch_matrix_multiply_op->compute.range[1] = m;
+  batch_matrix_multiply_op->compute.range[2] = n;
+  batch_matrix_multiply_op->compute.tile[0] = mr;
+  batch_matrix_multiply_op->compute.tile[1] = nc;
+  batch_matrix_multiply_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
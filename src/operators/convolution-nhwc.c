@@ -25,6 +25,7 @@
 #include <xnnpack/pack.h>
 #include <xnnpack/params-init.h>
 #include <xnnpack/params.h>
+#include <xnnpack/weights-cache.h>
 
 
 static inline size_t compute_output_dimension(
@@ -49,13 +50,38 @@ static const struct dwconv_parameters* find_dwconv_ukernel(
     const struct dwconv_parameters* ukernel,
     size_t num_ukernels)
 {
+  // Prefer the unipass micro-kernel with the smallest primary tile which covers the whole kernel (the extra taps are
+  // padded with zero weights), and fall back to a multipass micro-kernel for kernels larger than any primary tile.
+  const struct dwconv_parameters* best_ukernel = NULL;
   while (num_ukernels-- != 0) {
-    if (ukernel->primary_tile == kernel_size) {
-      return ukernel;
+    if (ukernel->primary_tile != 0) {
+      if (ukernel->incremental_tile == 0) {
+        if (ukernel->primary_tile >= kernel_size &&
+            (best_ukernel == NULL || best_ukernel->incremental_tile != 0 || ukernel->primary_tile < best_ukernel->primary_tile))
+        {
+          best_ukernel = ukernel;
+        }
+      } else if (best_ukernel == NULL && ukernel->primary_tile < kernel_size) {
+        best_ukernel = ukernel;
+      }
     }
     ukernel++;
   }
-  return NULL;
+  return best_ukernel;
+}
+
+// Number of kernel taps processed by a DWCONV micro-kernel, including the zero-weight taps padding the kernel to the
+// primary tile (unipass) or to the primary tile plus a multiple of the incremental tile (multipass).
+static size_t compute_dwconv_tiled_kernel_size(
+    size_t kernel_size,
+    size_t primary_tile,
+    size_t incremental_tile)
+{
+  if (kernel_size <= primary_tile) {
+    return primary_tile;
+  }
+  assert(incremental_tile != 0);
+  return primary_tile + round_up(kernel_size - primary_tile, incremental_tile);
 }
 
 static enum xnn_status create_convolution2d_nhwc(
@@ -87,18 +113,27 @@ static enum xnn_status create_convolution2d_nhwc(
     xnn_pack_conv_kgo_w_function pack_conv_kgo_w,
     xnn_pack_conv_goki_w_function pack_conv_goki_w,
     const void* packing_params,
+    size_t packing_params_size,
     int input_padding_byte,
     int packed_weights_padding_byte,
+    size_t extra_weights_bytes,
+    xnn_init_qc8_scale_params_function init_scale_params,
+    const float* scale_params,
     const void* params,
     size_t params_size,
     const struct gemm_parameters* gemm_parameters,
+    const struct ppmm_parameters* ppmm_parameters,
     const struct dwconv_parameters* dwconv_parameters,
     size_t num_dwconv_parameters,
     const struct vmulcaddc_parameters* vmulcaddc_parameters,
     bool linear_activation,
     bool relu_activation,
+    const void* hswish_params,
+    size_t hswish_params_size,
     uint32_t datatype_init_flags,
     enum xnn_operator_type operator_type,
+    struct xnn_weights_cache* weights_cache,
+    pthreadpool_t threadpool,
     xnn_operator_t* convolution_op_out)
 {
   xnn_operator_t convolution_op = NULL;
@@ -232,7 +267,33 @@ static enum xnn_status create_convolution2d_nhwc(
   }
   assert(ukernel_type != xnn_ukernel_type_default);
 
+  struct xnn_weights_cache_key weights_cache_key = { { 0 } };
+  if (weights_cache != NULL) {
+    // Packed weights are looked up by the raw weights together with everything that determines their packed layout.
+    const size_t weights_cache_config[] = {
+      (size_t) operator_type, (size_t) ukernel_type, (size_t) (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION),
+      kernel_height, kernel_width, groups, group_input_channels, group_output_channels,
+      vmulcaddc_parameters != NULL ? vmulcaddc_parameters->channel_tile : 0,
+      dwconv_ukernel != NULL ? dwconv_ukernel->channel_tile : 0,
+      dwconv_ukernel != NULL ? dwconv_ukernel->primary_tile : 0,
+      dwconv_ukernel != NULL ? dwconv_ukernel->incremental_tile : 0,
+      gemm_parameters->nr, gemm_parameters->log2_kr, gemm_parameters->log2_sr,
+      (size_t) input_padding_byte, (size_t) packed_weights_padding_byte,
+    };
+    weights_cache_key = xnn_weights_cache_compute_key(
+      weights_cache_config, sizeof(weights_cache_config),
+      packing_params, packing_params_size,
+      kernel, (groups * group_output_channels * kernel_size * group_input_channels) << log2_filter_element_size,
+      bias, groups * group_output_channels * bias_element_size);
+    if (scale_params != NULL) {
+      // Per-channel scales are stored in the packed weights too.
+      xnn_weights_cache_update_key(&weights_cache_key, scale_params, groups * group_output_channels * sizeof(float));
+    }
+  }
+
   size_t zero_size = 0;
+  bool zero_padded_taps = false;
+  bool fused_hswish = false;
   switch (ukernel_type) {
     case xnn_ukernel_type_vmulcaddc:
     {
@@ -240,17 +301,20 @@ static enum xnn_status create_convolution2d_nhwc(
 
       const size_t c_stride = round_up_po2(groups, vmulcaddc_parameters->channel_tile);
       const size_t packed_weights_size = ((UINT32_C(1) << log2_filter_element_size) + bias_element_size) * c_stride;
-      convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
-      if (convolution_op->packed_weights == NULL) {
-        xnn_log_error(
-          "failed to allocate %zu bytes for %s operator packed weights",
-          packed_weights_size, xnn_operator_type_to_string(operator_type));
-        goto error;
-      }
+      convolution_op->packed_weights_size = packed_weights_size;
+      if (!xnn_weights_cache_lookup_packed_weights(weights_cache, &weights_cache_key, convolution_op)) {
+        convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+        if (convolution_op->packed_weights == NULL) {
+          xnn_log_error(
+            "failed to allocate %zu bytes for %s operator packed weights",
+            packed_weights_size, xnn_operator_type_to_string(operator_type));
+          goto error;
+        }
 
-      pack_vmulcaddc_w(
-        groups, vmulcaddc_parameters->channel_tile,
-        kernel, bias, convolution_op->packed_weights, packing_params);
+        pack_vmulcaddc_w(
+          groups, vmulcaddc_parameters->channel_tile,
+          kernel, bias, convolution_op->packed_weights, packing_params);
+      }
 
       convolution_op->ukernel.vmulcaddc = (struct xnn_ukernel_vmulcaddc) {
         .function = vmulcaddc_parameters->ukernel,
@@ -261,42 +325,86 @@ static enum xnn_status create_convolution2d_nhwc(
     case xnn_ukernel_type_dwconv:
     {
       assert(dwconv_ukernel != NULL);
-      assert(dwconv_ukernel->primary_tile == kernel_size);
+      assert(dwconv_ukernel->primary_tile >= kernel_size || dwconv_ukernel->incremental_tile != 0);
 
+      const size_t tiled_kernel_size = compute_dwconv_tiled_kernel_size(
+        kernel_size, dwconv_ukernel->primary_tile, dwconv_ukernel->incremental_tile);
       const size_t c_stride = round_up_po2(groups, dwconv_ukernel->channel_tile);
-      const size_t packed_weights_size = ((kernel_size << log2_filter_element_size) + bias_element_size) * c_stride;
-      convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
-      if (convolution_op->packed_weights == NULL) {
-        xnn_log_error(
-          "failed to allocate %zu bytes for %s operator packed weights",
-          packed_weights_size, xnn_operator_type_to_string(operator_type));
-        goto error;
-      }
-      memset(convolution_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
+      const size_t packed_weights_size =
+        ((tiled_kernel_size << log2_filter_element_size) + bias_element_size + extra_weights_bytes) * c_stride;
+      convolution_op->packed_weights_size = packed_weights_size;
+      if (!xnn_weights_cache_lookup_packed_weights(weights_cache, &weights_cache_key, convolution_op)) {
+        convolution_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+        if (convolution_op->packed_weights == NULL) {
+          xnn_log_error(
+            "failed to allocate %zu bytes for %s operator packed weights",
+            packed_weights_size, xnn_operator_type_to_string(operator_type));
+          goto error;
+        }
+        memset(convolution_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
+
+        if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
+          pack_dwconv_hwg_w(
+            dwconv_ukernel->primary_tile, dwconv_ukernel->incremental_tile,
+            kernel_height, kernel_width,
+            groups, dwconv_ukernel->channel_tile,
+            kernel, bias, convolution_op->packed_weights,
+            dwconv_ukernel->channel_tile * extra_weights_bytes,
+            packing_params);
+        } else {
+          pack_dwconv_ghw_w(
+            dwconv_ukernel->primary_tile, dwconv_ukernel->incremental_tile,
+            kernel_height, kernel_width,
+            groups, dwconv_ukernel->channel_tile,
+            kernel, bias, convolution_op->packed_weights,
+            dwconv_ukernel->channel_tile * extra_weights_bytes,
+            packing_params);
+        }
 
-      if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
-        pack_dwconv_hwg_w(
-          kernel_height, kernel_width,
-          groups, dwconv_ukernel->channel_tile,
-          kernel, bias, convolution_op->packed_weights, packing_params);
-      } else {
-        pack_dwconv_ghw_w(
-          kernel_height, kernel_width,
-          groups, dwconv_ukernel->channel_tile,
-          kernel, bias, convolution_op->packed_weights, packing_params);
+        if (scale_params != NULL) {
+          assert(init_scale_params != NULL);
+
+          // The per-channel scales follow the taps of the last pass of each tile of channels.
+          const size_t channel_tile = dwconv_ukernel->channel_tile;
+          size_t last_pass_offset = 0;
+          size_t last_pass_size = (dwconv_ukernel->primary_tile << log2_filter_element_size) + bias_element_size;
+          if (tiled_kernel_size != dwconv_ukernel->primary_tile) {
+            last_pass_offset = (tiled_kernel_size - dwconv_ukernel->incremental_tile) * c_stride;
+            last_pass_offset = (last_pass_offset << log2_filter_element_size) + bias_element_size * c_stride;
+            last_pass_size = dwconv_ukernel->incremental_tile << log2_filter_element_size;
+          }
+          init_scale_params(
+            groups, channel_tile,
+            channel_tile * (last_pass_size + extra_weights_bytes),
+            scale_params,
+            (void*) ((uintptr_t) convolution_op->packed_weights + last_pass_offset + channel_tile * last_pass_size));
+        }
       }
 
+      // Unipass and multipass micro-kernel pointers share storage, so checking the unipass pointer covers both.
       const union dwconv_fused_ukernels* ukernels = &dwconv_ukernel->minmax;
-      if (linear_activation && dwconv_ukernel->linear.unipass != NULL) {
+      if (hswish_params != NULL) {
+        if (dwconv_ukernel->hswish.unipass != NULL) {
+          ukernels = &dwconv_ukernel->hswish;
+          fused_hswish = true;
+        }
+      } else if (linear_activation && dwconv_ukernel->linear.unipass != NULL) {
         ukernels = &dwconv_ukernel->linear;
       }
       convolution_op->ukernel.dwconv = (struct xnn_ukernel_dwconv) {
-        .unipass_function = ukernels->unipass,
+        .channel_tile = dwconv_ukernel->channel_tile,
         .primary_tile = dwconv_ukernel->primary_tile,
         .incremental_tile = dwconv_ukernel->incremental_tile,
       };
+      if (dwconv_ukernel->incremental_tile == 0) {
+        convolution_op->ukernel.dwconv.unipass_function = ukernels->unipass;
+      } else {
+        convolution_op->ukernel.dwconv.multipass_function = ukernels->multipass;
+      }
 
       zero_size = XNN_EXTRA_BYTES + (c_stride << log2_input_element_size);
+      // Taps past the kernel size in the last tile read from the zero buffer even without input padding.
+      zero_padded_taps = tiled_kernel_size != kernel_size;
       break;
     }
     case xnn_ukernel_type_gemm:
@@ -308,28 +416,43 @@ static enum xnn_status create_convolution2d_nhwc(
       const size_t n_stride = round_up(group_output_channels, nr);
       const size_t k_stride = round_up_po2(group_input_channels, kr);
 
-      const size_t packed_group_weights_size = ((kernel_size * k_stride << log2_filter_element_size) + bias_element_size) * n_stride;
-      convolution_op->packed_weights = xnn_allocate_simd_memory(packed_group_weights_size * groups);
-      if (convolution_op->packed_weights == NULL) {
-        xnn_log_error(
-          "failed to allocate %zu bytes for %s operator packed weights",
-          packed_group_weights_size * groups, xnn_operator_type_to_string(operator_type));
-        goto error;
+      const size_t packed_group_weights_size =
+        ((kernel_size * k_stride << log2_filter_element_size) + bias_element_size + extra_weights_bytes) * n_stride;
+      convolution_op->packed_weights_size = packed_group_weights_size * groups;
+      const bool pack_weights = !xnn_weights_cache_lookup_packed_weights(weights_cache, &weights_cache_key, convolution_op);
+      if (pack_weights) {
+        convolution_op->packed_weights = xnn_allocate_simd_memory(packed_group_weights_size * groups);
+        if (convolution_op->packed_weights == NULL) {
+          xnn_log_error(
+            "failed to allocate %zu bytes for %s operator packed weights",
+            packed_group_weights_size * groups, xnn_operator_type_to_string(operator_type));
+          goto error;
+        }
+        memset(convolution_op->packed_weights, packed_weights_padding_byte, packed_group_weights_size * groups);
       }
-      memset(convolution_op->packed_weights, packed_weights_padding_byte, packed_group_weights_size * groups);
 
       const struct gemm_fused_ukernels* gemm_ukernels = &gemm_parameters->minmax;
-      if (linear_activation && gemm_parameters->linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
+      if (hswish_params != NULL) {
+        if (gemm_parameters->hswish.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
+          gemm_ukernels = &gemm_parameters->hswish;
+          fused_hswish = true;
+        }
+      } else if (linear_activation && gemm_parameters->linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
         gemm_ukernels = &gemm_parameters->linear;
       } else if (relu_activation && gemm_parameters->relu.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
         gemm_ukernels = &gemm_parameters->relu;
       }
       switch (ukernel_type) {
         case xnn_ukernel_type_gemm:
-          pack_gemm_goi_w(
-              groups, group_output_channels, group_input_channels,
-              nr, kr, sr,
-              kernel, bias, convolution_op->packed_weights, packing_params);
+          if (pack_weights) {
+            xnn_parallelize_pack_gemm_goi_w(
+                pack_gemm_goi_w,
+                groups, group_output_channels, group_input_channels,
+                nr, kr, sr,
+                kernel, bias, convolution_op->packed_weights, nr * extra_weights_bytes, packing_params,
+                log2_filter_element_size, bias_element_size, packed_group_weights_size / n_stride,
+                threadpool);
+          }
           convolution_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
             .mr = gemm_parameters->mr,
             .nr = nr,
@@ -337,18 +460,31 @@ static enum xnn_status create_convolution2d_nhwc(
             .general_case = gemm_ukernels->gemm,
             .mr1_case = gemm_ukernels->gemm1,
           };
+          if (ppmm_parameters != NULL && ppmm_parameters->ukernel != NULL && !fused_hswish && groups == 1 &&
+              ppmm_parameters->nr == nr && kr == 1 && sr == 1)
+          {
+            // PPMM micro-kernels consume the same packed weights as GEMM micro-kernels, and can be selected on setup.
+            convolution_op->ukernel.gemm.ppmm_function = ppmm_parameters->ukernel;
+            convolution_op->ukernel.gemm.packx_function = ppmm_parameters->packx;
+            convolution_op->ukernel.gemm.ppmm_mr = ppmm_parameters->mr;
+          }
           break;
         case xnn_ukernel_type_igemm:
-          if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
-            pack_conv_kgo_w(
-              groups, group_output_channels, kernel_size,
-              nr, kr,
-              kernel, bias, convolution_op->packed_weights, packing_params);
-          } else {
-            pack_conv_goki_w(
-              groups, group_output_channels, kernel_size, group_input_channels,
-              nr, kr, sr,
-              kernel, bias, convolution_op->packed_weights, packing_params);
+          if (pack_weights) {
+            if (flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) {
+              pack_conv_kgo_w(
+                groups, group_output_channels, kernel_size,
+                nr, kr,
+                kernel, bias, convolution_op->packed_weights, nr * extra_weights_bytes, packing_params);
+            } else {
+              xnn_parallelize_pack_conv_goki_w(
+                pack_conv_goki_w,
+                groups, group_output_channels, kernel_size, group_input_channels,
+                nr, kr, sr,
+                kernel, bias, convolution_op->packed_weights, nr * extra_weights_bytes, packing_params,
+                log2_filter_element_size, bias_element_size, packed_group_weights_size / n_stride,
+                threadpool);
+            }
           }
           convolution_op->ukernel.igemm = (struct xnn_ukernel_igemm) {
             .mr = gemm_parameters->mr,
@@ -362,6 +498,20 @@ static enum xnn_status create_convolution2d_nhwc(
           XNN_UNREACHABLE;
       }
 
+      if (pack_weights && scale_params != NULL) {
+        assert(init_scale_params != NULL);
+
+        // The per-channel scales follow the packed weights of each block of nr output channels.
+        const size_t weights_stride = (kernel_size * k_stride << log2_filter_element_size) + bias_element_size;
+        for (uint32_t group = 0; group < groups; group++) {
+          init_scale_params(
+            group_output_channels, nr,
+            nr * (weights_stride + extra_weights_bytes),
+            scale_params + group * group_output_channels,
+            (void*) ((uintptr_t) convolution_op->packed_weights + group * packed_group_weights_size + nr * weights_stride));
+        }
+      }
+
       zero_size = XNN_EXTRA_BYTES + (k_stride << log2_input_element_size);
       break;
     }
@@ -370,7 +520,7 @@ static enum xnn_status create_convolution2d_nhwc(
   }
 
   const bool tf_same_padding = (flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0 && kernel_size != 1;
-  if (any_padding || tf_same_padding) {
+  if (any_padding || tf_same_padding || zero_padded_taps) {
     convolution_op->zero_buffer = xnn_allocate_simd_memory(zero_size);
     if (convolution_op->zero_buffer == NULL) {
       xnn_log_error(
@@ -398,7 +548,16 @@ static enum xnn_status create_convolution2d_nhwc(
   convolution_op->input_pixel_stride = input_channel_stride;
   convolution_op->output_pixel_stride = output_channel_stride;
 
-  memcpy(&convolution_op->params, params, params_size);
+  if (fused_hswish) {
+    memcpy(&convolution_op->params, hswish_params, hswish_params_size);
+  } else {
+    memcpy(&convolution_op->params, params, params_size);
+    if (hswish_params != NULL) {
+      // HardSwish is applied in a separate pass over the output, which is set up with the operator.
+      convolution_op->context2.ukernel = xnn_params.f32.hswish;
+      memcpy(&convolution_op->context2.params, hswish_params, hswish_params_size);
+    }
+  }
   convolution_op->type = operator_type;
   convolution_op->ukernel.type = ukernel_type;
   if (tf_same_padding) {
@@ -407,6 +566,11 @@ static enum xnn_status create_convolution2d_nhwc(
 
   convolution_op->state = xnn_run_state_invalid;
 
+  status = xnn_weights_cache_insert_packed_weights(weights_cache, &weights_cache_key, convolution_op);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
   *convolution_op_out = convolution_op;
   return xnn_status_success;
 
@@ -505,15 +669,20 @@ enum xnn_status xnn_create_convolution2d_nhwc_qu8(
     (xnn_pack_gemm_goi_w_function) xnn_pack_qu8_gemm_goi_w,
     (xnn_pack_conv_kgo_w_function) xnn_pack_qu8_conv_kgo_w,
     (xnn_pack_conv_goki_w_function) xnn_pack_qu8_conv_goki_w,
-    &packing_params, input_zero_point /* input padding byte */, kernel_zero_point /* packed weights padding byte */,
+    &packing_params, sizeof(packing_params),
+    input_zero_point /* input padding byte */, kernel_zero_point /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */,
     &params, sizeof(params),
-    &xnn_params.qu8.gemm, xnn_params.qu8.dwconv, XNN_MAX_QU8_DWCONV_UKERNELS, NULL /* vmulcaddc parameters */,
-    false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_QU8,
+    &xnn_params.qu8.gemm, NULL /* ppmm parameters */, xnn_params.qu8.dwconv, XNN_MAX_QU8_DWCONV_UKERNELS, NULL /* vmulcaddc parameters */,
+    false /* linear activation */, false /* relu activation */,
+    NULL /* hswish params */, 0 /* hswish params size */, XNN_INIT_FLAG_QU8,
     xnn_operator_type_convolution_nhwc_qu8,
+    NULL /* weights cache */,
+    NULL /* threadpool */,
     convolution_op_out);
 }
 
-enum xnn_status xnn_create_convolution2d_nhwc_qs8(
+enum xnn_status xnn_create_convolution2d_nhwc_qs8_with_weights_cache(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
     uint32_t input_padding_bottom,
@@ -539,6 +708,8 @@ enum xnn_status xnn_create_convolution2d_nhwc_qs8(
     int8_t output_min,
     int8_t output_max,
     uint32_t flags,
+    xnn_weights_cache_t weights_cache,
+    pthreadpool_t threadpool,
     xnn_operator_t* convolution_op_out)
 {
   if (input_scale <= 0.0f || !isnormal(input_scale)) {
@@ -599,12 +770,180 @@ enum xnn_status xnn_create_convolution2d_nhwc_qs8(
     (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
     (xnn_pack_conv_kgo_w_function) xnn_pack_qs8_conv_kgo_w,
     (xnn_pack_conv_goki_w_function) xnn_pack_qs8_conv_goki_w,
-    &packing_params, input_zero_point /* input padding byte */, 0 /* packed weights padding byte */,
+    &packing_params, sizeof(packing_params),
+    input_zero_point /* input padding byte */, 0 /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */,
     &params, sizeof(params),
-    &xnn_params.qs8.gemm, xnn_params.qs8.dwconv, XNN_MAX_QS8_DWCONV_UKERNELS, NULL /* vmulcaddc parameters */,
-    false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_QS8,
+    &xnn_params.qs8.gemm, NULL /* ppmm parameters */, xnn_params.qs8.dwconv, XNN_MAX_QS8_DWCONV_UKERNELS, NULL /* vmulcaddc parameters */,
+    false /* linear activation */, false /* relu activation */,
+    NULL /* hswish params */, 0 /* hswish params size */, XNN_INIT_FLAG_QS8,
     xnn_operator_type_convolution_nhwc_qs8,
+    weights_cache,
+    threadpool,
+    convolution_op_out);
+}
+
+enum xnn_status xnn_create_convolution2d_nhwc_qs8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    float kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  return xnn_create_convolution2d_nhwc_qs8_with_weights_cache(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    input_zero_point, input_scale, kernel_scale,
+    kernel, bias,
+    output_zero_point, output_scale, output_min, output_max,
+    flags,
+    NULL /* weights cache */,
+    NULL /* threadpool */,
+    convolution_op_out);
+}
+
+
+enum xnn_status xnn_create_convolution2d_nhwc_qc8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    const float* kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_nhwc_qc8), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  const size_t output_channels = (size_t) groups * group_output_channels;
+  for (size_t output_channel = 0; output_channel < output_channels; output_channel++) {
+    if (kernel_scale[output_channel] <= 0.0f || !isnormal(kernel_scale[output_channel])) {
+      xnn_log_error(
+        "failed to create %s operator with %.7g kernel scale in output channel #%zu: "
+        "scale must be finite, normalized, and positive",
+        xnn_operator_type_to_string(xnn_operator_type_convolution_nhwc_qc8), kernel_scale[output_channel],
+        output_channel);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_nhwc_qc8), output_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%" PRId8 ", %" PRId8 "] output range: range min must be below range max",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_nhwc_qc8), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  float* requantization_scale = xnn_allocate_memory(output_channels * sizeof(float));
+  if (requantization_scale == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator requantization scales",
+      output_channels * sizeof(float), xnn_operator_type_to_string(xnn_operator_type_convolution_nhwc_qc8));
+    return xnn_status_out_of_memory;
+  }
+  for (size_t output_channel = 0; output_channel < output_channels; output_channel++) {
+    requantization_scale[output_channel] = input_scale * kernel_scale[output_channel] / output_scale;
+    if (requantization_scale[output_channel] >= 256.0f) {
+      xnn_log_error(
+        "failed to create %s operator with %.7g input scale, %.7g kernel scale, and %.7g output scale in output channel #%zu: "
+        "requantization scale %.7g is greater or equal to 256.0",
+        xnn_operator_type_to_string(xnn_operator_type_convolution_nhwc_qc8),
+        input_scale, kernel_scale[output_channel], output_scale,
+        output_channel, requantization_scale[output_channel]);
+
+      xnn_release_memory(requantization_scale);
+      return xnn_status_unsupported_parameter;
+    }
+  }
+
+  const struct xnn_qs8_packing_params packing_params = { .input_zero_point = input_zero_point, };
+  const union xnn_qc8_gemm_params params = xnn_init_qc8_gemm_params(output_zero_point, output_min, output_max);
+  const enum xnn_status status = create_convolution2d_nhwc(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    kernel, bias, flags,
+    0 /* log2(sizeof(input element)) = log2(sizeof(int8_t)) */,
+    0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */,
+    sizeof(int32_t) /* sizeof(bias element) */,
+    (xnn_pack_vmulcaddc_w_function) NULL,
+    (xnn_pack_dwconv_hwg_w_function) xnn_pack_qs8_dwconv_hwg_w,
+    (xnn_pack_dwconv_ghw_w_function) xnn_pack_qs8_dwconv_ghw_w,
+    (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
+    (xnn_pack_conv_kgo_w_function) xnn_pack_qs8_conv_kgo_w,
+    (xnn_pack_conv_goki_w_function) xnn_pack_qs8_conv_goki_w,
+    &packing_params, sizeof(packing_params),
+    input_zero_point /* input padding byte */, 0 /* packed weights padding byte */,
+    sizeof(float) /* extra weights bytes */, xnn_init_qc8_scale_fp32_params, requantization_scale,
+    &params, sizeof(params),
+    &xnn_params.qc8.gemm, NULL /* ppmm parameters */, xnn_params.qc8.dwconv, XNN_MAX_QC8_DWCONV_UKERNELS, NULL /* vmulcaddc parameters */,
+    false /* linear activation */, false /* relu activation */,
+    NULL /* hswish params */, 0 /* hswish params size */, XNN_INIT_FLAG_QC8,
+    xnn_operator_type_convolution_nhwc_qc8,
+    NULL /* weights cache */,
+    NULL /* threadpool */,
     convolution_op_out);
+
+  xnn_release_memory(requantization_scale);
+  return status;
 }
 
 enum xnn_status xnn_create_convolution2d_nhwc_f16(
@@ -680,15 +1019,20 @@ enum xnn_status xnn_create_convolution2d_nhwc_f16(
     (xnn_pack_gemm_goi_w_function) xnn_pack_f16_gemm_goi_w,
     (xnn_pack_conv_kgo_w_function) xnn_pack_f16_conv_kgo_w,
     (xnn_pack_conv_goki_w_function) xnn_pack_f16_conv_goki_w,
-    NULL /* packing params */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
+    NULL /* packing params */, 0 /* packing params size */,
+    0 /* input padding byte */, 0 /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */,
     &params, sizeof(params),
-    &xnn_params.f16.gemm, xnn_params.f16.dwconv, XNN_MAX_F16_DWCONV_UKERNELS, &xnn_params.f16.vmulcaddc,
-    false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_F16,
+    &xnn_params.f16.gemm, NULL /* ppmm parameters */, xnn_params.f16.dwconv, XNN_MAX_F16_DWCONV_UKERNELS, &xnn_params.f16.vmulcaddc,
+    false /* linear activation */, false /* relu activation */,
+    NULL /* hswish params */, 0 /* hswish params size */, XNN_INIT_FLAG_F16,
     xnn_operator_type_convolution_nhwc_f16,
+    NULL /* weights cache */,
+    NULL /* threadpool */,
     convolution_op_out);
 }
 
-enum xnn_status xnn_create_convolution2d_nhwc_f32(
+enum xnn_status xnn_create_convolution2d_nhwc_f32_with_weights_cache(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
     uint32_t input_padding_bottom,
@@ -709,6 +1053,8 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     float output_min,
     float output_max,
     uint32_t flags,
+    xnn_weights_cache_t weights_cache,
+    pthreadpool_t threadpool,
     xnn_operator_t* convolution_op_out)
 {
   if (isnan(output_min)) {
@@ -734,7 +1080,16 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
 
   const bool linear_activation = (output_max == INFINITY) && (output_min == -output_max);
   const bool relu_activation = (output_max == INFINITY) && (output_min == 0.0f);
+  const bool hswish_activation = (flags & XNN_FLAG_FUSED_HARDSWISH) != 0;
+  if (hswish_activation && !linear_activation) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: fused HardSwish requires unbounded output range",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_nhwc_f32), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
   const union xnn_f32_minmax_params params = xnn_init_f32_minmax_params(output_min, output_max);
+  const union xnn_f32_hswish_params hswish_params = xnn_init_f32_hswish_params();
   return create_convolution2d_nhwc(
     input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
     kernel_height, kernel_width,
@@ -752,11 +1107,54 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     (xnn_pack_gemm_goi_w_function) xnn_pack_f32_gemm_goi_w,
     (xnn_pack_conv_kgo_w_function) xnn_pack_f32_conv_kgo_w,
     (xnn_pack_conv_goki_w_function) xnn_pack_f32_conv_goki_w,
-    NULL /* packing params */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
+    NULL /* packing params */, 0 /* packing params size */,
+    0 /* input padding byte */, 0 /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */,
     &params, sizeof(params),
-    &xnn_params.f32.gemm, xnn_params.f32.dwconv, XNN_MAX_F32_DWCONV_UKERNELS, &xnn_params.f32.vmulcaddc,
-    linear_activation, relu_activation, XNN_INIT_FLAG_F32,
+    &xnn_params.f32.gemm, &xnn_params.f32.ppmm, xnn_params.f32.dwconv, XNN_MAX_F32_DWCONV_UKERNELS, &xnn_params.f32.vmulcaddc,
+    linear_activation, relu_activation,
+    hswish_activation ? &hswish_params : NULL, sizeof(hswish_params), XNN_INIT_FLAG_F32,
     xnn_operator_type_convolution_nhwc_f32,
+    weights_cache,
+    threadpool,
+    convolution_op_out);
+}
+
+enum xnn_status xnn_create_convolution2d_nhwc_f32(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* convolution_op_out)
+{
+  return xnn_create_convolution2d_nhwc_f32_with_weights_cache(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    kernel, bias,
+    output_min, output_max,
+    flags,
+    NULL /* weights cache */,
+    NULL /* threadpool */,
     convolution_op_out);
 }
 
@@ -856,6 +1254,53 @@ static enum xnn_status setup_convolution2d_nhwc(
 
       uint32_t mr = convolution_op->ukernel.gemm.mr;
       const uint32_t nr = convolution_op->ukernel.gemm.nr;
+
+      if (convolution_op->ukernel.gemm.ppmm_function != NULL &&
+          batch_output_size >= XNN_PPMM_MIN_M && divide_round_up(group_output_channels, nr) >= XNN_PPMM_MIN_NR_TILES)
+      {
+        // PPMM micro-kernels are only set up for convolutions with a single group.
+        assert(groups == 1);
+
+        const uint32_t ppmm_mr = convolution_op->ukernel.gemm.ppmm_mr;
+        const size_t k_scaled = group_input_channels << log2_input_element_size;
+        const size_t workspace_size = round_up(batch_output_size, ppmm_mr) * k_scaled;
+        if (workspace_size > convolution_op->workspace_size) {
+          xnn_release_simd_memory(convolution_op->workspace);
+          convolution_op->workspace_size = 0;
+          convolution_op->workspace = xnn_allocate_simd_memory(workspace_size);
+          if (convolution_op->workspace == NULL) {
+            xnn_log_error(
+              "failed to allocate %zu bytes for %s operator packed input",
+              workspace_size, xnn_operator_type_to_string(convolution_op->type));
+            return xnn_status_out_of_memory;
+          }
+          convolution_op->workspace_size = workspace_size;
+        }
+
+        convolution_op->context.ppmm = (struct ppmm_context) {
+            .k_scaled = k_scaled,
+            .a = input,
+            .a_stride = convolution_op->input_pixel_stride << log2_input_element_size,
+            .packed_a = convolution_op->workspace,
+            .packed_w = convolution_op->packed_weights,
+            .n = group_output_channels,
+            .c = output,
+            .cm_stride = convolution_op->output_pixel_stride << log2_output_element_size,
+            .cn_stride = nr << log2_output_element_size,
+            .packx_ukernel = convolution_op->ukernel.gemm.packx_function,
+            .ppmm_ukernel = convolution_op->ukernel.gemm.ppmm_function,
+        };
+        memcpy(&convolution_op->context.ppmm.params, gemm_params, sizeof(convolution_op->context.ppmm.params));
+
+        convolution_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+        convolution_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_ppmm;
+        convolution_op->compute.range[0] = batch_output_size;
+        convolution_op->compute.tile[0] = ppmm_mr;
+        convolution_op->state = xnn_run_state_ready;
+
+        return xnn_status_success;
+      }
+
       struct xnn_hmp_gemm_ukernel gemm_ukernel = convolution_op->ukernel.gemm.general_case;
       if (batch_output_size == 1 && convolution_op->ukernel.gemm.mr1_case.function[XNN_UARCH_DEFAULT] != NULL) {
         mr = 1;
@@ -866,6 +1311,7 @@ static enum xnn_status setup_convolution2d_nhwc(
           .k_scaled = group_input_channels << log2_input_element_size,
           .a = input,
           .a_stride = convolution_op->input_pixel_stride << log2_input_element_size,
+          .ga_stride = group_input_channels << log2_input_element_size,
           .packed_w = convolution_op->packed_weights,
           .w_stride = w_stride,
           .wg_stride = w_stride * round_up(group_output_channels, nr),
@@ -1092,8 +1538,14 @@ static enum xnn_status setup_convolution2d_nhwc(
       const size_t output_width = convolution_op->output_width;
       const size_t step_width = convolution_op->dilation_width == 1 ? convolution_op->stride_width : kernel_width;
       const size_t step_height = kernel_size + (output_width - 1) * step_width * kernel_height;
+      const size_t primary_tile = convolution_op->ukernel.dwconv.primary_tile;
+      const size_t incremental_tile = convolution_op->ukernel.dwconv.incremental_tile;
+      // Micro-kernels read input pointers for all taps in their tiles, including the zero-weight padding taps. For all
+      // but the last output pixel these pointers alias the following pixels, and the last pixel is padded with extra
+      // pointers to the zero buffer.
+      const size_t tiled_kernel_size = compute_dwconv_tiled_kernel_size(kernel_size, primary_tile, incremental_tile);
       if (input_height != convolution_op->last_input_height || input_width != convolution_op->last_input_width) {
-        const size_t indirection_buffer_size = sizeof(void*) * output_height * step_height;
+        const size_t indirection_buffer_size = sizeof(void*) * (output_height * step_height + tiled_kernel_size - kernel_size);
 
         const void** indirection_buffer =
           (const void**) xnn_reallocate_memory(convolution_op->indirection_buffer, indirection_buffer_size);
@@ -1105,6 +1557,9 @@ static enum xnn_status setup_convolution2d_nhwc(
         convolution_op->indirection_buffer = indirection_buffer;
 
         xnn_indirection_init_dwconv2d(convolution_op, step_height, step_width, log2_input_element_size);
+        for (size_t i = output_height * step_height; i < output_height * step_height + tiled_kernel_size - kernel_size; i++) {
+          indirection_buffer[i] = convolution_op->zero_buffer;
+        }
 
         convolution_op->last_input = input;
         convolution_op->last_input_height = input_height;
@@ -1126,12 +1581,22 @@ static enum xnn_status setup_convolution2d_nhwc(
           .groups = groups,
           .zero = convolution_op->zero_buffer,
           .output_increment = (convolution_op->output_pixel_stride - groups) << log2_output_element_size,
-          .unipass_ukernel = convolution_op->ukernel.dwconv.unipass_function,
       };
       memcpy(&convolution_op->context.dwconv.params, dwconv_params, sizeof(convolution_op->context.dwconv.params));
 
       convolution_op->compute.type = xnn_parallelization_type_2d;
-      convolution_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_dwconv_unipass;
+      if (incremental_tile == 0) {
+        convolution_op->context.dwconv.unipass_ukernel = convolution_op->ukernel.dwconv.unipass_function;
+        convolution_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_dwconv_unipass;
+      } else {
+        // Multipass micro-kernels keep per-channel accumulators (of the same size as bias elements) in a buffer, and
+        // process whole channel tiles in all but the last pass.
+        const size_t channel_tile = convolution_op->ukernel.dwconv.channel_tile;
+        convolution_op->context.dwconv.kernel_size = kernel_size;
+        convolution_op->context.dwconv.buffer_size = round_up_po2(groups, channel_tile) * bias_element_size + XNN_EXTRA_BYTES;
+        convolution_op->context.dwconv.multipass_ukernel = convolution_op->ukernel.dwconv.multipass_function;
+        convolution_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_dwconv_multipass;
+      }
       convolution_op->compute.range[0] = batch_size;
       convolution_op->compute.range[1] = output_height;
       convolution_op->state = xnn_run_state_ready;
@@ -1235,6 +1700,36 @@ enum xnn_status xnn_setup_convolution2d_nhwc_qs8(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_convolution2d_nhwc_qc8(
+    xnn_operator_t convolution_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  if (convolution_op->type != xnn_operator_type_convolution_nhwc_qc8) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_nhwc_qc8),
+      xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_convolution2d_nhwc(
+    convolution_op,
+    batch_size, input_height, input_width,
+    input, output,
+    XNN_INIT_FLAG_QC8,
+    0 /* log2(sizeof(input element)) = log2(sizeof(int8_t)) */,
+    0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */,
+    sizeof(int32_t) + sizeof(float) /* sizeof(bias element) + sizeof(scale element) */,
+    0 /* log2(sizeof(output element)) = log2(sizeof(int8_t)) */,
+    &convolution_op->params.qc8_gemm,
+    &convolution_op->params.qc8_gemm,
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_convolution2d_nhwc_f16(
     xnn_operator_t convolution_op,
     size_t batch_size,
@@ -1281,7 +1776,7 @@ enum xnn_status xnn_setup_convolution2d_nhwc_f32(
     return xnn_status_invalid_parameter;
   }
 
-  return setup_convolution2d_nhwc(
+  const enum xnn_status status = setup_convolution2d_nhwc(
     convolution_op,
     batch_size, input_height, input_width,
     input, output,
@@ -1293,4 +1788,20 @@ enum xnn_status xnn_setup_convolution2d_nhwc_f32(
     &convolution_op->params.f32_minmax,
     &convolution_op->params.f32_minmax,
     pthreadpool_get_threads_count(threadpool));
+  if (status != xnn_status_success || convolution_op->state != xnn_run_state_ready) {
+    return status;
+  }
+
+  if (convolution_op->context2.ukernel != NULL) {
+    convolution_op->context2.n = (convolution_op->groups * convolution_op->group_output_channels) * sizeof(float);
+    convolution_op->context2.x = output;
+    convolution_op->context2.x_stride = convolution_op->output_pixel_stride * sizeof(float);
+    convolution_op->context2.y = output;
+    convolution_op->context2.y_stride = convolution_op->output_pixel_stride * sizeof(float);
+    convolution_op->compute2.type = xnn_parallelization_type_1d_tile_1d;
+    convolution_op->compute2.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_univector_strided;
+    convolution_op->compute2.range[0] = batch_size * convolution_op->output_height * convolution_op->output_width;
+    convolution_op->compute2.tile[0] = 1;
+  }
+  return xnn_status_success;
 }
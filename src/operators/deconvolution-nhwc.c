@@ -22,6 +22,7 @@
 #include <xnnpack/pack.h>
 #include <xnnpack/params-init.h>
 #include <xnnpack/params.h>
+#include <xnnpack/weights-cache.h>
 
 
 static inline size_t compute_output_dimension(
@@ -63,6 +64,7 @@ static enum xnn_status create_deconvolution2d_nhwc(
     xnn_pack_conv_goki_w_function pack_conv_goki_w,
     xnn_pack_deconv_goki_w_function pack_deconv_goki_w,
     const void* packing_params,
+    size_t packing_params_size,
     int input_padding_byte,
     int packed_weights_padding_byte,
     const void* params,
@@ -70,6 +72,7 @@ static enum xnn_status create_deconvolution2d_nhwc(
     const struct gemm_parameters* gemm_parameters,
     const struct gemm_fused_ukernels* gemm_ukernels,
     enum xnn_operator_type operator_type,
+    struct xnn_weights_cache* weights_cache,
     xnn_operator_t* deconvolution_op_out)
 {
   xnn_operator_t deconvolution_op = NULL;
@@ -203,33 +206,72 @@ static enum xnn_status create_deconvolution2d_nhwc(
       }
     }
   }
-  deconvolution_op->packed_weights = xnn_allocate_simd_memory(packed_group_weights_size * groups);
-  if (deconvolution_op->packed_weights == NULL) {
-    xnn_log_error(
-      "failed to allocate %zu bytes for %s operator packed weights",
-      packed_group_weights_size * groups, xnn_operator_type_to_string(operator_type));
-    goto error;
+
+  struct xnn_weights_cache_key weights_cache_key = { { 0 } };
+  if (weights_cache != NULL) {
+    // Packed weights are looked up by the raw weights together with everything that determines their packed layout.
+    const size_t weights_cache_config[] = {
+      (size_t) operator_type, (size_t) ukernel_type,
+      kernel_height, kernel_width, stride_height, stride_width, groups, group_input_channels, group_output_channels,
+      nr, kr, sr,
+      (size_t) input_padding_byte, (size_t) packed_weights_padding_byte,
+    };
+    weights_cache_key = xnn_weights_cache_compute_key(
+      weights_cache_config, sizeof(weights_cache_config),
+      packing_params, packing_params_size,
+      kernel, (groups * group_output_channels * kernel_size * group_input_channels) << log2_filter_element_size,
+      bias, groups * group_output_channels * bias_element_size);
   }
-  memset(deconvolution_op->packed_weights, packed_weights_padding_byte, packed_group_weights_size * groups);
 
-  switch (ukernel_type) {
-    case xnn_ukernel_type_igemm:
-      pack_conv_goki_w(
-        groups, group_output_channels, kernel_size, group_input_channels,
-        nr, kr, sr,
-        kernel, bias, deconvolution_op->packed_weights,
-        packing_params);
-      break;
-    case xnn_ukernel_type_subconv2d:
-      pack_deconv_goki_w(
-        groups, group_output_channels, kernel_height, kernel_width, group_input_channels,
-        stride_height, stride_width,
-        nr, kr, sr,
-        kernel, bias, deconvolution_op->packed_weights, deconvolution_op->subconvolution_buffer,
-        packing_params);
-      break;
-    default:
-      XNN_UNREACHABLE;
+  deconvolution_op->packed_weights_size = packed_group_weights_size * groups;
+  if (xnn_weights_cache_lookup_packed_weights(weights_cache, &weights_cache_key, deconvolution_op)) {
+    if (ukernel_type == xnn_ukernel_type_subconv2d) {
+      // Packed weights of each subkernel in the first group follow the packed weights of the previous subkernel.
+      struct subconvolution_params* subconvolution_params = deconvolution_op->subconvolution_buffer;
+      uintptr_t subconvolution_weights = (uintptr_t) deconvolution_op->packed_weights;
+      for (size_t offset_y = 0; offset_y < stride_height; offset_y++) {
+        for (size_t offset_x = 0; offset_x < stride_width; offset_x++) {
+          const size_t subkernel_height = divide_round_up(kernel_height - offset_y, stride_height);
+          const size_t subkernel_width = divide_round_up(kernel_width - offset_x, stride_width);
+          const size_t subkernel_size = subkernel_height * subkernel_width;
+
+          subconvolution_params->weights = (void*) subconvolution_weights;
+          subconvolution_weights +=
+            n_stride * (bias_element_size + (k_stride * subkernel_size << log2_filter_element_size));
+          subconvolution_params++;
+        }
+      }
+    }
+  } else {
+    deconvolution_op->packed_weights = xnn_allocate_simd_memory(packed_group_weights_size * groups);
+    if (deconvolution_op->packed_weights == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator packed weights",
+        packed_group_weights_size * groups, xnn_operator_type_to_string(operator_type));
+      goto error;
+    }
+    memset(deconvolution_op->packed_weights, packed_weights_padding_byte, packed_group_weights_size * groups);
+
+    switch (ukernel_type) {
+      case xnn_ukernel_type_igemm:
+        pack_conv_goki_w(
+          groups, group_output_channels, kernel_size, group_input_channels,
+          nr, kr, sr,
+          kernel, bias, deconvolution_op->packed_weights,
+          0 /* extra bytes */,
+          packing_params);
+        break;
+      case xnn_ukernel_type_subconv2d:
+        pack_deconv_goki_w(
+          groups, group_output_channels, kernel_height, kernel_width, group_input_channels,
+          stride_height, stride_width,
+          nr, kr, sr,
+          kernel, bias, deconvolution_op->packed_weights, deconvolution_op->subconvolution_buffer,
+          packing_params);
+        break;
+      default:
+        XNN_UNREACHABLE;
+    }
   }
 
   const size_t zero_size = (k_stride << log2_input_element_size) + XNN_EXTRA_BYTES;
@@ -290,6 +332,11 @@ static enum xnn_status create_deconvolution2d_nhwc(
 
   deconvolution_op->state = xnn_run_state_invalid;
 
+  status = xnn_weights_cache_insert_packed_weights(weights_cache, &weights_cache_key, deconvolution_op);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
   *deconvolution_op_out = deconvolution_op;
   return xnn_status_success;
 
@@ -384,14 +431,16 @@ enum xnn_status xnn_create_deconvolution2d_nhwc_qu8(
     sizeof(int32_t) /* sizeof(bias element) */,
     (xnn_pack_conv_goki_w_function) xnn_pack_qu8_conv_goki_w,
     (xnn_pack_deconv_goki_w_function) xnn_pack_qu8_deconv_goki_w,
-    &packing_params, input_zero_point /* input padding byte */, kernel_zero_point /* packed weights padding byte */,
+    &packing_params, sizeof(packing_params),
+    input_zero_point /* input padding byte */, kernel_zero_point /* packed weights padding byte */,
     &params, sizeof(params),
     &xnn_params.qu8.gemm, &xnn_params.qu8.gemm.minmax,
     xnn_operator_type_deconvolution_nhwc_qu8,
+    NULL /* weights cache */,
     deconvolution_op_out);
 }
 
-enum xnn_status xnn_create_deconvolution2d_nhwc_f32(
+enum xnn_status xnn_create_deconvolution2d_nhwc_f32_with_weights_cache(
     uint32_t output_padding_top,
     uint32_t output_padding_right,
     uint32_t output_padding_bottom,
@@ -412,6 +461,7 @@ enum xnn_status xnn_create_deconvolution2d_nhwc_f32(
     float output_min,
     float output_max,
     uint32_t flags,
+    xnn_weights_cache_t weights_cache,
     xnn_operator_t* deconvolution_op_out)
 {
   if (isnan(output_min)) {
@@ -462,10 +512,49 @@ enum xnn_status xnn_create_deconvolution2d_nhwc_f32(
     sizeof(float) /* sizeof(bias element) */,
     (xnn_pack_conv_goki_w_function) xnn_pack_f32_conv_goki_w,
     (xnn_pack_deconv_goki_w_function) xnn_pack_f32_deconv_goki_w,
-    NULL /* packing params */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
+    NULL /* packing params */, 0 /* packing params size */,
+    0 /* input padding byte */, 0 /* packed weights padding byte */,
     &params, sizeof(params),
     gemm_parameters, gemm_ukernels,
     xnn_operator_type_deconvolution_nhwc_f32,
+    weights_cache,
+    deconvolution_op_out);
+}
+
+enum xnn_status xnn_create_deconvolution2d_nhwc_f32(
+    uint32_t output_padding_top,
+    uint32_t output_padding_right,
+    uint32_t output_padding_bottom,
+    uint32_t output_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t stride_height,
+    uint32_t stride_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* deconvolution_op_out)
+{
+  return xnn_create_deconvolution2d_nhwc_f32_with_weights_cache(
+    output_padding_top, output_padding_right, output_padding_bottom, output_padding_left,
+    kernel_height, kernel_width,
+    stride_height, stride_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_pixel_stride, output_pixel_stride,
+    kernel, bias,
+    output_min, output_max,
+    flags,
+    NULL /* weights cache */,
     deconvolution_op_out);
 }
 
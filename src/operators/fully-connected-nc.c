@@ -21,6 +21,7 @@
 #include <xnnpack/pack.h>
 #include <xnnpack/params-init.h>
 #include <xnnpack/params.h>
+#include <xnnpack/weights-cache.h>
 
 
 static enum xnn_status create_fully_connected_nc(
@@ -36,13 +37,21 @@ static enum xnn_status create_fully_connected_nc(
     xnn_pack_gemm_io_w_function pack_gemm_io_w,
     xnn_pack_gemm_goi_w_function pack_gemm_goi_w,
     const void* packing_params,
+    size_t packing_params_size,
     int packed_weights_padding_byte,
+    size_t extra_weights_bytes,
+    xnn_init_qc8_scale_params_function init_scale_params,
+    const float* scale_params,
     const void* params,
     size_t params_size,
     const struct gemm_parameters* gemm_parameters,
+    const struct ppmm_parameters* ppmm_parameters,
+    const struct gemminc_parameters* gemminc_parameters,
     const struct gemm_fused_ukernels* gemm_ukernels,
     uint32_t datatype_init_flags,
     enum xnn_operator_type operator_type,
+    struct xnn_weights_cache* weights_cache,
+    pthreadpool_t threadpool,
     xnn_operator_t* fully_connected_op_out)
 {
   xnn_operator_t fully_connected_op = NULL;
@@ -112,30 +121,71 @@ static enum xnn_status create_fully_connected_nc(
   const size_t n_stride = round_up(output_channels, nr);
   const size_t k_stride = round_up_po2(input_channels, kr);
 
-  const size_t packed_weights_size = n_stride * (bias_element_size + (k_stride << log2_filter_element_size));
-  fully_connected_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
-  if (fully_connected_op->packed_weights == NULL) {
-    xnn_log_error(
-      "failed to allocate %zu bytes for %s operator packed weights",
-      packed_weights_size, xnn_operator_type_to_string(operator_type));
-    goto error;
+  struct xnn_weights_cache_key weights_cache_key = { { 0 } };
+  if (weights_cache != NULL) {
+    // Packed weights are looked up by the raw weights together with everything that determines their packed layout.
+    const size_t weights_cache_config[] = {
+      (size_t) operator_type, (size_t) (flags & XNN_FLAG_TRANSPOSE_WEIGHTS),
+      input_channels, output_channels,
+      nr, kr, sr,
+      (size_t) packed_weights_padding_byte,
+    };
+    weights_cache_key = xnn_weights_cache_compute_key(
+      weights_cache_config, sizeof(weights_cache_config),
+      packing_params, packing_params_size,
+      kernel, (output_channels * input_channels) << log2_filter_element_size,
+      bias, output_channels * bias_element_size);
+    if (scale_params != NULL) {
+      // Per-channel scales are stored in the packed weights too.
+      xnn_weights_cache_update_key(&weights_cache_key, scale_params, output_channels * sizeof(float));
+    }
   }
-  memset(fully_connected_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
 
-  if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
-    pack_gemm_io_w(
-      output_channels, input_channels,
-      nr, kr, sr,
-      kernel, bias,
-      fully_connected_op->packed_weights,
-      packing_params);
-  } else {
-    pack_gemm_goi_w(
-      1, output_channels, input_channels,
-      nr, kr, sr,
-      kernel, bias,
-      fully_connected_op->packed_weights,
-      packing_params);
+  const size_t packed_weights_size = n_stride * (bias_element_size + (k_stride << log2_filter_element_size) + extra_weights_bytes);
+  fully_connected_op->packed_weights_size = packed_weights_size;
+  if (!xnn_weights_cache_lookup_packed_weights(weights_cache, &weights_cache_key, fully_connected_op)) {
+    fully_connected_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+    if (fully_connected_op->packed_weights == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator packed weights",
+        packed_weights_size, xnn_operator_type_to_string(operator_type));
+      goto error;
+    }
+    memset(fully_connected_op->packed_weights, packed_weights_padding_byte, packed_weights_size);
+
+    if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+      pack_gemm_io_w(
+        output_channels, input_channels,
+        nr, kr, sr,
+        kernel, bias,
+        fully_connected_op->packed_weights,
+        nr * extra_weights_bytes,
+        packing_params);
+    } else {
+      xnn_parallelize_pack_gemm_goi_w(
+        pack_gemm_goi_w,
+        1, output_channels, input_channels,
+        nr, kr, sr,
+        kernel, bias,
+        fully_connected_op->packed_weights,
+        nr * extra_weights_bytes,
+        packing_params,
+        log2_filter_element_size, bias_element_size,
+        bias_element_size + (k_stride << log2_filter_element_size) + extra_weights_bytes,
+        threadpool);
+    }
+
+    if (scale_params != NULL) {
+      assert(init_scale_params != NULL);
+
+      // The per-channel scales follow the packed weights of each block of nr output channels.
+      const size_t weights_stride = bias_element_size + (k_stride << log2_filter_element_size);
+      init_scale_params(
+        output_channels, nr,
+        nr * (weights_stride + extra_weights_bytes),
+        scale_params,
+        (void*) ((uintptr_t) fully_connected_op->packed_weights + nr * weights_stride));
+    }
   }
 
   fully_connected_op->group_input_channels = input_channels;
@@ -145,6 +195,7 @@ static enum xnn_status create_fully_connected_nc(
 
   memcpy(&fully_connected_op->params, params, params_size);
   fully_connected_op->type = operator_type;
+  fully_connected_op->flags = flags;
 
   fully_connected_op->ukernel.type = xnn_ukernel_type_gemm;
   fully_connected_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
@@ -154,9 +205,27 @@ static enum xnn_status create_fully_connected_nc(
     .nr = nr,
     .kr = kr,
   };
+  if (ppmm_parameters != NULL && ppmm_parameters->ukernel != NULL && ppmm_parameters->nr == nr && kr == 1 && sr == 1) {
+    // PPMM micro-kernels consume the same packed weights as GEMM micro-kernels, and can be selected on setup.
+    fully_connected_op->ukernel.gemm.ppmm_function = ppmm_parameters->ukernel;
+    fully_connected_op->ukernel.gemm.packx_function = ppmm_parameters->packx;
+    fully_connected_op->ukernel.gemm.ppmm_mr = ppmm_parameters->mr;
+  }
+  if (gemminc_parameters != NULL && gemminc_parameters->ukernel != NULL && gemminc_parameters->nr == nr &&
+      kr == 1 && sr == 1)
+  {
+    // GEMMINC micro-kernel consumes the same packed weights as GEMM micro-kernels, skipping over the bias.
+    fully_connected_op->ukernel.gemm.gemminc_function = gemminc_parameters->ukernel;
+    fully_connected_op->ukernel.gemm.gemminc_mr = gemminc_parameters->mr;
+  }
 
   fully_connected_op->state = xnn_run_state_invalid;
 
+  status = xnn_weights_cache_insert_packed_weights(weights_cache, &weights_cache_key, fully_connected_op);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
   *fully_connected_op_out = fully_connected_op;
   return xnn_status_success;
 
@@ -207,6 +276,114 @@ static enum xnn_status setup_fully_connected_nc(
   uint32_t mr = fully_connected_op->ukernel.gemm.mr;
   const uint32_t nr = fully_connected_op->ukernel.gemm.nr;
 
+  if (fully_connected_op->ukernel.gemm.gemminc_function != NULL &&
+      batch_size >= XNN_GEMM_KBLOCK_MIN_M && divide_round_up(output_channels, nr) >= XNN_GEMM_KBLOCK_MIN_NR_TILES &&
+      input_channels >= XNN_GEMM_KBLOCK_MIN_K)
+  {
+    const uint32_t gemminc_mr = fully_connected_op->ukernel.gemm.gemminc_mr;
+    const size_t acc_stride = round_up(output_channels, nr) * sizeof(float);
+    const size_t acc_buffer_stride = round_up(batch_size, gemminc_mr) * acc_stride;
+    const size_t workspace_size = 2 * acc_buffer_stride;
+    if (workspace_size > fully_connected_op->workspace_size) {
+      xnn_release_simd_memory(fully_connected_op->workspace);
+      fully_connected_op->workspace_size = 0;
+      fully_connected_op->workspace = xnn_allocate_simd_memory(workspace_size);
+      if (fully_connected_op->workspace == NULL) {
+        xnn_log_error(
+          "failed to allocate %zu bytes for %s operator partial sums",
+          workspace_size, xnn_operator_type_to_string(fully_connected_op->type));
+        return xnn_status_out_of_memory;
+      }
+      fully_connected_op->workspace_size = workspace_size;
+    }
+
+    // Split K in blocks of equal size, as close to XNN_GEMM_MAX_KC as possible.
+    const size_t num_k_blocks = divide_round_up(input_channels, XNN_GEMM_MAX_KC);
+    const size_t kc = divide_round_up(input_channels, num_k_blocks);
+    fully_connected_op->context.kblocked_gemm = (struct kblocked_gemm_context) {
+      .k_scaled = input_channels << log2_input_element_size,
+      .kc_scaled = kc << log2_input_element_size,
+      .a = input,
+      .a_stride = fully_connected_op->input_pixel_stride << log2_input_element_size,
+      .packed_w = fully_connected_op->packed_weights,
+      .w_stride = (input_channels << log2_filter_element_size) + bias_element_size,
+      .c = output,
+      .cm_stride = fully_connected_op->output_pixel_stride << log2_output_element_size,
+      .acc = fully_connected_op->workspace,
+      .acc_stride = acc_stride,
+      .acc_buffer_stride = acc_buffer_stride,
+      .mr = gemminc_mr,
+      .nr = nr,
+      .ukernel = fully_connected_op->ukernel.gemm.gemminc_function,
+      .partial_params = xnn_init_f32_minmax_params(-INFINITY, INFINITY),
+    };
+    assert(params_size == sizeof(fully_connected_op->context.kblocked_gemm.params));
+    memcpy(&fully_connected_op->context.kblocked_gemm.params, params, params_size);
+
+    size_t nc = output_channels;
+    if (num_threads > 1) {
+      const size_t num_other_tiles = divide_round_up(batch_size, gemminc_mr);
+      const size_t target_tiles_per_thread = 5;
+      const size_t max_nc = divide_round_up(output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
+      if (max_nc < nc) {
+        nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+      }
+    }
+    fully_connected_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+    fully_connected_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_kblocked_gemm;
+    fully_connected_op->compute.range[0] = batch_size;
+    fully_connected_op->compute.range[1] = output_channels;
+    fully_connected_op->compute.tile[0] = gemminc_mr;
+    fully_connected_op->compute.tile[1] = nc;
+    fully_connected_op->state = xnn_run_state_ready;
+
+    return xnn_status_success;
+  }
+
+  if (fully_connected_op->ukernel.gemm.ppmm_function != NULL &&
+      batch_size >= XNN_PPMM_MIN_M && divide_round_up(output_channels, nr) >= XNN_PPMM_MIN_NR_TILES)
+  {
+    const uint32_t ppmm_mr = fully_connected_op->ukernel.gemm.ppmm_mr;
+    const size_t k_scaled = input_channels << log2_input_element_size;
+    const size_t workspace_size = round_up(batch_size, ppmm_mr) * k_scaled;
+    if (workspace_size > fully_connected_op->workspace_size) {
+      xnn_release_simd_memory(fully_connected_op->workspace);
+      fully_connected_op->workspace_size = 0;
+      fully_connected_op->workspace = xnn_allocate_simd_memory(workspace_size);
+      if (fully_connected_op->workspace == NULL) {
+        xnn_log_error(
+          "failed to allocate %zu bytes for %s operator packed input",
+          workspace_size, xnn_operator_type_to_string(fully_connected_op->type));
+        return xnn_status_out_of_memory;
+      }
+      fully_connected_op->workspace_size = workspace_size;
+    }
+
+    fully_connected_op->context.ppmm = (struct ppmm_context) {
+      .k_scaled = k_scaled,
+      .a = input,
+      .a_stride = fully_connected_op->input_pixel_stride << log2_input_element_size,
+      .packed_a = fully_connected_op->workspace,
+      .packed_w = fully_connected_op->packed_weights,
+      .n = output_channels,
+      .c = output,
+      .cm_stride = fully_connected_op->output_pixel_stride << log2_output_element_size,
+      .cn_stride = nr << log2_output_element_size,
+      .packx_ukernel = fully_connected_op->ukernel.gemm.packx_function,
+      .ppmm_ukernel = fully_connected_op->ukernel.gemm.ppmm_function,
+    };
+    assert(params_size == sizeof(fully_connected_op->context.ppmm.params));
+    memcpy(&fully_connected_op->context.ppmm.params, params, params_size);
+
+    fully_connected_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+    fully_connected_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_ppmm;
+    fully_connected_op->compute.range[0] = batch_size;
+    fully_connected_op->compute.tile[0] = ppmm_mr;
+    fully_connected_op->state = xnn_run_state_ready;
+
+    return xnn_status_success;
+  }
+
   struct xnn_hmp_gemm_ukernel gemm_ukernel = fully_connected_op->ukernel.gemm.general_case;
   if (batch_size == 1 && fully_connected_op->ukernel.gemm.mr1_case.function[XNN_UARCH_DEFAULT] != NULL) {
     gemm_ukernel = fully_connected_op->ukernel.gemm.mr1_case;
@@ -317,15 +494,18 @@ enum xnn_status xnn_create_fully_connected_nc_qu8(
     sizeof(int32_t) /* sizeof(bias element) */,
     (xnn_pack_gemm_io_w_function) xnn_pack_qu8_gemm_io_w,
     (xnn_pack_gemm_goi_w_function) xnn_pack_qu8_gemm_goi_w,
-    &packing_params, kernel_zero_point /* packed weights padding byte */,
+    &packing_params, sizeof(packing_params), kernel_zero_point /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */,
     &params, sizeof(params),
-    &xnn_params.qu8.gemm, &xnn_params.qu8.gemm.minmax,
+    &xnn_params.qu8.gemm, NULL /* ppmm parameters */, NULL /* gemminc parameters */, &xnn_params.qu8.gemm.minmax,
     XNN_INIT_FLAG_QU8,
     xnn_operator_type_fully_connected_nc_qu8,
+    NULL /* weights cache */,
+    NULL /* threadpool */,
     fully_connected_op_out);
 }
 
-enum xnn_status xnn_create_fully_connected_nc_qs8(
+enum xnn_status xnn_create_fully_connected_nc_qs8_with_weights_cache(
     size_t input_channels,
     size_t output_channels,
     size_t input_stride,
@@ -340,6 +520,8 @@ enum xnn_status xnn_create_fully_connected_nc_qs8(
     int8_t output_min,
     int8_t output_max,
     uint32_t flags,
+    xnn_weights_cache_t weights_cache,
+    pthreadpool_t threadpool,
     xnn_operator_t* fully_connected_op_out)
 {
   if (input_scale <= 0.0f || !isnormal(input_scale)) {
@@ -393,15 +575,487 @@ enum xnn_status xnn_create_fully_connected_nc_qs8(
     sizeof(int32_t) /* sizeof(bias element) */,
     (xnn_pack_gemm_io_w_function) xnn_pack_qs8_gemm_io_w,
     (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
-    &packing_params, 0 /* packed weights padding byte */,
+    &packing_params, sizeof(packing_params), 0 /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */,
     &params, sizeof(params),
-    &xnn_params.qs8.gemm, &xnn_params.qs8.gemm.minmax,
+    &xnn_params.qs8.gemm, NULL /* ppmm parameters */, NULL /* gemminc parameters */, &xnn_params.qs8.gemm.minmax,
     XNN_INIT_FLAG_QS8,
     xnn_operator_type_fully_connected_nc_qs8,
+    weights_cache,
+    threadpool,
     fully_connected_op_out);
 }
 
-enum xnn_status xnn_create_fully_connected_nc_f32(
+enum xnn_status xnn_create_fully_connected_nc_qs8(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    float kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  return xnn_create_fully_connected_nc_qs8_with_weights_cache(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    input_zero_point, input_scale,
+    kernel_scale, kernel, bias,
+    output_zero_point, output_scale, output_min, output_max,
+    flags,
+    NULL /* weights cache */,
+    NULL /* threadpool */,
+    fully_connected_op_out);
+}
+
+enum xnn_status xnn_create_fully_connected_nc_qc8(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    const float* kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qc8), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t output_channel = 0; output_channel < output_channels; output_channel++) {
+    if (kernel_scale[output_channel] <= 0.0f || !isnormal(kernel_scale[output_channel])) {
+      xnn_log_error(
+        "failed to create %s operator with %.7g kernel scale in output channel #%zu: "
+        "scale must be finite, normalized, and positive",
+        xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qc8), kernel_scale[output_channel],
+        output_channel);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qc8), output_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%" PRId8 ", %" PRId8 "] output range: range min must be below range max",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qc8), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  float* requantization_scale = xnn_allocate_memory(output_channels * sizeof(float));
+  if (requantization_scale == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator requantization scales",
+      output_channels * sizeof(float), xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qc8));
+    return xnn_status_out_of_memory;
+  }
+  for (size_t output_channel = 0; output_channel < output_channels; output_channel++) {
+    requantization_scale[output_channel] = input_scale * kernel_scale[output_channel] / output_scale;
+    if (requantization_scale[output_channel] >= 256.0f) {
+      xnn_log_error(
+        "failed to create %s operator with %.7g input scale, %.7g kernel scale, and %.7g output scale in output channel #%zu: "
+        "requantization scale %.7g is greater or equal to 256.0",
+        xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qc8),
+        input_scale, kernel_scale[output_channel], output_scale,
+        output_channel, requantization_scale[output_channel]);
+
+      xnn_release_memory(requantization_scale);
+      return xnn_status_unsupported_parameter;
+    }
+  }
+
+  const union xnn_qc8_gemm_params params = xnn_init_qc8_gemm_params(output_zero_point, output_min, output_max);
+  const struct xnn_qs8_packing_params packing_params = {
+    .input_zero_point = input_zero_point,
+  };
+  const enum xnn_status status = create_fully_connected_nc(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    kernel, bias, flags,
+    0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */,
+    sizeof(int32_t) /* sizeof(bias element) */,
+    (xnn_pack_gemm_io_w_function) xnn_pack_qs8_gemm_io_w,
+    (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
+    &packing_params, sizeof(packing_params), 0 /* packed weights padding byte */,
+    sizeof(float) /* extra weights bytes */, xnn_init_qc8_scale_fp32_params, requantization_scale,
+    &params, sizeof(params),
+    &xnn_params.qc8.gemm, NULL /* ppmm parameters */, NULL /* gemminc parameters */, &xnn_params.qc8.gemm.minmax,
+    XNN_INIT_FLAG_QC8,
+    xnn_operator_type_fully_connected_nc_qc8,
+    NULL /* weights cache */,
+    NULL /* threadpool */,
+    fully_connected_op_out);
+
+  xnn_release_memory(requantization_scale);
+  return status;
+}
+
+// Context for quantization of fp32 weights to signed 8-bit values with a symmetric scale per output channel.
+struct quantize_qc8w_context {
+  size_t input_channels;
+  size_t output_channels;
+  const float* kernel;
+  int8_t* quantized_kernel;
+  float* kernel_scale;
+};
+
+static void quantize_qc8w_goi(
+  const struct quantize_qc8w_context* context,
+  size_t output_channel_start,
+  size_t output_channel_block)
+{
+  const size_t input_channels = context->input_channels;
+  for (size_t oc = output_channel_start; oc < output_channel_start + output_channel_block; oc++) {
+    const float* k = context->kernel + oc * input_channels;
+    int8_t* q = context->quantized_kernel + oc * input_channels;
+    float max_abs = 0.0f;
+    for (size_t ic = 0; ic < input_channels; ic++) {
+      max_abs = math_max_f32(max_abs, fabsf(k[ic]));
+    }
+    const float scale = max_abs != 0.0f ? max_abs / 127.0f : 1.0f;
+    const float inv_scale = 1.0f / scale;
+    for (size_t ic = 0; ic < input_channels; ic++) {
+      q[ic] = (int8_t) lrintf(math_min_f32(math_max_f32(k[ic] * inv_scale, -127.0f), 127.0f));
+    }
+    context->kernel_scale[oc] = scale;
+  }
+}
+
+// Same as quantize_qc8w_goi, but for transposed weights, where the weights of an output channel are strided.
+static void quantize_qc8w_io(
+  const struct quantize_qc8w_context* context,
+  size_t output_channel_start,
+  size_t output_channel_block)
+{
+  const size_t input_channels = context->input_channels;
+  const size_t output_channels = context->output_channels;
+  for (size_t oc = output_channel_start; oc < output_channel_start + output_channel_block; oc++) {
+    float max_abs = 0.0f;
+    for (size_t ic = 0; ic < input_channels; ic++) {
+      max_abs = math_max_f32(max_abs, fabsf(context->kernel[ic * output_channels + oc]));
+    }
+    const float scale = max_abs != 0.0f ? max_abs / 127.0f : 1.0f;
+    const float inv_scale = 1.0f / scale;
+    for (size_t ic = 0; ic < input_channels; ic++) {
+      const float k = context->kernel[ic * output_channels + oc];
+      context->quantized_kernel[ic * output_channels + oc] =
+        (int8_t) lrintf(math_min_f32(math_max_f32(k * inv_scale, -127.0f), 127.0f));
+    }
+    context->kernel_scale[oc] = scale;
+  }
+}
+
+// Creates a Fully Connected operator with dynamically quantized inputs from either signed 8-bit weights with
+// per-channel scales, or fp32 weights (kernel_scale == NULL), which are quantized with a symmetric per-channel scale
+// only if the packed weights are not found in the weights cache.
+static enum xnn_status create_fully_connected_nc_qd8_f32_qc8w(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel_scale,
+    const void* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    struct xnn_weights_cache* weights_cache,
+    pthreadpool_t threadpool,
+    xnn_operator_t* fully_connected_op_out)
+{
+  const enum xnn_operator_type operator_type = xnn_operator_type_fully_connected_nc_qd8_f32_qc8w;
+  const struct qd8_gemm_parameters* gemm_parameters = &xnn_params.qd8_f32_qc8w.gemm;
+  xnn_operator_t fully_connected_op = NULL;
+  int8_t* quantized_kernel = NULL;
+  float* quantized_kernel_scale = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_QC8) == 0 || gemm_parameters->minmax == NULL) {
+    xnn_log_error(
+      "failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (input_channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu input channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(operator_type), input_channels);
+    goto error;
+  }
+
+  if (output_channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu output channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(operator_type), output_channels);
+    goto error;
+  }
+
+  if (input_stride < input_channels) {
+    xnn_log_error(
+      "failed to create %s operator with input element stride of %zu: "
+      "stride must be at least as large as the number of input channels (%zu)",
+      xnn_operator_type_to_string(operator_type), input_stride, input_channels);
+    goto error;
+  }
+
+  if (output_stride < output_channels) {
+    xnn_log_error(
+      "failed to create %s operator with output element stride of %zu: "
+      "stride must be at least as large as the number of output channels (%zu)",
+      xnn_operator_type_to_string(operator_type), output_stride, output_channels);
+    goto error;
+  }
+
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(operator_type), output_min, output_max);
+    goto error;
+  }
+
+  if (kernel_scale != NULL) {
+    for (size_t output_channel = 0; output_channel < output_channels; output_channel++) {
+      if (kernel_scale[output_channel] <= 0.0f || !isnormal(kernel_scale[output_channel])) {
+        xnn_log_error(
+          "failed to create %s operator with %.7g kernel scale in output channel #%zu: "
+          "scale must be finite, normalized, and positive",
+          xnn_operator_type_to_string(operator_type), kernel_scale[output_channel], output_channel);
+        goto error;
+      }
+    }
+  }
+
+  status = xnn_status_out_of_memory;
+
+  fully_connected_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (fully_connected_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  const uint32_t nr = gemm_parameters->nr;
+  const uint32_t kr = UINT32_C(1) << gemm_parameters->log2_kr;
+  const uint32_t sr = UINT32_C(1) << gemm_parameters->log2_sr;
+  const size_t n_stride = round_up(output_channels, nr);
+  const size_t k_stride = round_up_po2(input_channels, kr);
+  // Each block of NR output channels holds the sums of the weights, the weights, and then the fp32 scales and biases.
+  const size_t weights_stride = sizeof(int32_t) + k_stride * sizeof(int8_t);
+  const size_t extra_weights_bytes = 2 * sizeof(float);
+
+  // Packing with unit input zero point stores the negated sums of the weights of each output channel in place of the
+  // bias, and the micro-kernels multiply them by the zero point of each row of quantized inputs.
+  const struct xnn_qs8_packing_params packing_params = {
+    .input_zero_point = 1,
+  };
+
+  struct xnn_weights_cache_key weights_cache_key = { { 0 } };
+  if (weights_cache != NULL) {
+    // Packed weights are looked up by the raw weights (fp32 weights before quantization, or signed 8-bit weights and
+    // their scales) and fp32 biases, together with everything that determines their packed layout.
+    const size_t weights_cache_config[] = {
+      (size_t) operator_type, (size_t) (flags & XNN_FLAG_TRANSPOSE_WEIGHTS),
+      input_channels, output_channels,
+      nr, kr, sr,
+      kernel_scale != NULL ? sizeof(int8_t) : sizeof(float),
+    };
+    weights_cache_key = xnn_weights_cache_compute_key(
+      weights_cache_config, sizeof(weights_cache_config),
+      &packing_params, sizeof(packing_params),
+      kernel, output_channels * input_channels * (kernel_scale != NULL ? sizeof(int8_t) : sizeof(float)),
+      bias, output_channels * sizeof(float));
+    if (kernel_scale != NULL) {
+      xnn_weights_cache_update_key(&weights_cache_key, kernel_scale, output_channels * sizeof(float));
+    }
+  }
+
+  const size_t packed_weights_size = n_stride * (weights_stride + extra_weights_bytes);
+  fully_connected_op->packed_weights_size = packed_weights_size;
+  if (!xnn_weights_cache_lookup_packed_weights(weights_cache, &weights_cache_key, fully_connected_op)) {
+    fully_connected_op->packed_weights = xnn_allocate_simd_memory(packed_weights_size);
+    if (fully_connected_op->packed_weights == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator packed weights",
+        packed_weights_size, xnn_operator_type_to_string(operator_type));
+      goto error;
+    }
+    memset(fully_connected_op->packed_weights, 0, packed_weights_size);
+
+    if (kernel_scale == NULL) {
+      quantized_kernel = xnn_allocate_memory(output_channels * input_channels * sizeof(int8_t));
+      quantized_kernel_scale = xnn_allocate_memory(output_channels * sizeof(float));
+      if (quantized_kernel == NULL || quantized_kernel_scale == NULL) {
+        xnn_log_error(
+          "failed to allocate %zu bytes for %s operator quantized weights",
+          output_channels * (input_channels * sizeof(int8_t) + sizeof(float)),
+          xnn_operator_type_to_string(operator_type));
+        goto error;
+      }
+
+      struct quantize_qc8w_context quantize_context = {
+        .input_channels = input_channels,
+        .output_channels = output_channels,
+        .kernel = (const float*) kernel,
+        .quantized_kernel = quantized_kernel,
+        .kernel_scale = quantized_kernel_scale,
+      };
+      pthreadpool_parallelize_1d_tile_1d(
+        threadpool,
+        (pthreadpool_task_1d_tile_1d_t) ((flags & XNN_FLAG_TRANSPOSE_WEIGHTS) ? quantize_qc8w_io : quantize_qc8w_goi),
+        &quantize_context,
+        output_channels, nr,
+        0 /* flags */);
+      kernel = quantized_kernel;
+      kernel_scale = quantized_kernel_scale;
+    }
+
+    if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+      xnn_pack_qs8_gemm_io_w(
+        output_channels, input_channels,
+        nr, kr, sr,
+        kernel, NULL /* bias */,
+        fully_connected_op->packed_weights,
+        nr * extra_weights_bytes,
+        &packing_params);
+    } else {
+      xnn_parallelize_pack_gemm_goi_w(
+        (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
+        1, output_channels, input_channels,
+        nr, kr, sr,
+        kernel, NULL /* bias */,
+        fully_connected_op->packed_weights,
+        nr * extra_weights_bytes,
+        &packing_params,
+        0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */, sizeof(int32_t),
+        weights_stride + extra_weights_bytes,
+        threadpool);
+    }
+
+    // The per-channel scales and then the fp32 biases follow the packed weights of each block of NR output channels.
+    xnn_init_qc8_scale_fp32_params(
+      output_channels, nr,
+      nr * (weights_stride + extra_weights_bytes),
+      kernel_scale,
+      (void*) ((uintptr_t) fully_connected_op->packed_weights + nr * weights_stride));
+    if (bias != NULL) {
+      xnn_init_qc8_scale_fp32_params(
+        output_channels, nr,
+        nr * (weights_stride + extra_weights_bytes),
+        bias,
+        (void*) ((uintptr_t) fully_connected_op->packed_weights + nr * (weights_stride + sizeof(float))));
+    }
+  }
+
+  fully_connected_op->group_input_channels = input_channels;
+  fully_connected_op->group_output_channels = output_channels;
+  fully_connected_op->input_pixel_stride = input_stride;
+  fully_connected_op->output_pixel_stride = output_stride;
+
+  fully_connected_op->params.f32_minmax = xnn_init_f32_minmax_params(output_min, output_max);
+  fully_connected_op->type = operator_type;
+  fully_connected_op->flags = flags;
+
+  fully_connected_op->ukernel.type = xnn_ukernel_type_gemm;
+  fully_connected_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
+    .qd8_function = gemm_parameters->minmax,
+    .qd8_mr1_function = gemm_parameters->minmax1,
+    .qd8_vcvt_function = xnn_params.qd8_f32_qc8w.vcvt,
+    .mr = gemm_parameters->mr,
+    .nr = nr,
+    .kr = kr,
+  };
+
+  fully_connected_op->state = xnn_run_state_invalid;
+
+  status = xnn_weights_cache_insert_packed_weights(weights_cache, &weights_cache_key, fully_connected_op);
+  if (status != xnn_status_success) {
+    goto error;
+  }
+
+  xnn_release_memory(quantized_kernel_scale);
+  xnn_release_memory(quantized_kernel);
+  *fully_connected_op_out = fully_connected_op;
+  return xnn_status_success;
+
+error:
+  xnn_release_memory(quantized_kernel_scale);
+  xnn_release_memory(quantized_kernel);
+  xnn_delete_operator(fully_connected_op);
+  return status;
+}
+
+enum xnn_status xnn_create_fully_connected_nc_qd8_f32_qc8w(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel_scale,
+    const int8_t* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  return create_fully_connected_nc_qd8_f32_qc8w(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    kernel_scale, kernel, bias,
+    output_min, output_max, flags,
+    NULL /* weights cache */,
+    NULL /* threadpool */,
+    fully_connected_op_out);
+}
+
+enum xnn_status xnn_create_fully_connected_nc_qd8_f32_qc8w_from_f32_with_weights_cache(
     size_t input_channels,
     size_t output_channels,
     size_t input_stride,
@@ -411,6 +1065,31 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
     float output_min,
     float output_max,
     uint32_t flags,
+    xnn_weights_cache_t weights_cache,
+    pthreadpool_t threadpool,
+    xnn_operator_t* fully_connected_op_out)
+{
+  return create_fully_connected_nc_qd8_f32_qc8w(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    NULL /* kernel scale */, kernel, bias,
+    output_min, output_max, flags,
+    weights_cache, threadpool,
+    fully_connected_op_out);
+}
+
+enum xnn_status xnn_create_fully_connected_nc_f32_with_weights_cache(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_weights_cache_t weights_cache,
+    pthreadpool_t threadpool,
     xnn_operator_t* fully_connected_op_out)
 {
   if (isnan(output_min)) {
@@ -436,12 +1115,24 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
 
   const struct gemm_fused_ukernels* gemm_ukernels = &xnn_params.f32.gemm.minmax;
   const bool linear_activation = (output_max == INFINITY) && (output_min == -output_max);
-  if (linear_activation && xnn_params.f32.gemm.linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
+  const bool hswish_activation = (flags & XNN_FLAG_FUSED_HARDSWISH) != 0;
+  if (hswish_activation && !linear_activation) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: fused HardSwish requires unbounded output range",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  const bool fused_hswish = hswish_activation && xnn_params.f32.gemm.hswish.gemm.function[XNN_UARCH_DEFAULT] != NULL;
+  if (fused_hswish) {
+    gemm_ukernels = &xnn_params.f32.gemm.hswish;
+  } else if (linear_activation && xnn_params.f32.gemm.linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
     gemm_ukernels = &xnn_params.f32.gemm.linear;
   }
 
   const union xnn_f32_minmax_params params = xnn_init_f32_minmax_params(output_min, output_max);
-  return create_fully_connected_nc(
+  const union xnn_f32_hswish_params hswish_params = xnn_init_f32_hswish_params();
+  const enum xnn_status status = create_fully_connected_nc(
     input_channels, output_channels,
     input_stride, output_stride,
     kernel, bias, flags,
@@ -449,11 +1140,48 @@ enum xnn_status xnn_create_fully_connected_nc_f32(
     sizeof(float) /* sizeof(bias element) */,
     (xnn_pack_gemm_io_w_function) xnn_pack_f32_gemm_io_w,
     (xnn_pack_gemm_goi_w_function) xnn_pack_f32_gemm_goi_w,
-    NULL /* packing params */, 0 /* packed weights padding byte */,
-    &params, sizeof(params),
-    &xnn_params.f32.gemm, gemm_ukernels,
+    NULL /* packing params */, 0 /* packing params size */, 0 /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */,
+    fused_hswish ? (const void*) &hswish_params : (const void*) &params,
+    fused_hswish ? sizeof(hswish_params) : sizeof(params),
+    &xnn_params.f32.gemm,
+    fused_hswish ? NULL : &xnn_params.f32.ppmm,
+    fused_hswish ? NULL : &xnn_params.f32.gemminc,
+    gemm_ukernels,
     XNN_INIT_FLAG_F32,
     xnn_operator_type_fully_connected_nc_f32,
+    weights_cache,
+    threadpool,
+    fully_connected_op_out);
+  if (status == xnn_status_success && hswish_activation && !fused_hswish) {
+    // HardSwish is applied in a separate pass over the output, which is set up with the operator.
+    xnn_operator_t fully_connected_op = *fully_connected_op_out;
+    fully_connected_op->context2.ukernel = xnn_params.f32.hswish;
+    fully_connected_op->context2.params.f32_hswish = hswish_params;
+  }
+  return status;
+}
+
+enum xnn_status xnn_create_fully_connected_nc_f32(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* fully_connected_op_out)
+{
+  return xnn_create_fully_connected_nc_f32_with_weights_cache(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    kernel, bias,
+    output_min, output_max,
+    flags,
+    NULL /* weights cache */,
+    NULL /* threadpool */,
     fully_connected_op_out);
 }
 
@@ -513,6 +1241,142 @@ enum xnn_status xnn_setup_fully_connected_nc_qs8(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_fully_connected_nc_qc8(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  if (fully_connected_op->type != xnn_operator_type_fully_connected_nc_qc8) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qc8),
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_fully_connected_nc(
+    fully_connected_op,
+    batch_size,
+    input, output,
+    XNN_INIT_FLAG_QC8,
+    0 /* log2(sizeof(input element)) = log2(sizeof(int8_t)) */,
+    0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */,
+    sizeof(int32_t) + sizeof(float) /* sizeof(bias element) + sizeof(scale element) */,
+    0 /* log2(sizeof(output element)) = log2(sizeof(int8_t)) */,
+    &fully_connected_op->params.qc8_gemm,
+    sizeof(fully_connected_op->params.qc8_gemm),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_fully_connected_nc_qd8_f32_qc8w(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (fully_connected_op->type != xnn_operator_type_fully_connected_nc_qd8_f32_qc8w) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc8w),
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  fully_connected_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    fully_connected_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  fully_connected_op->batch_size = 1;
+  fully_connected_op->input_height = batch_size;
+  fully_connected_op->input_width = 1;
+  fully_connected_op->input = input;
+
+  fully_connected_op->output_height = batch_size;
+  fully_connected_op->output_width = 1;
+  fully_connected_op->output = output;
+
+  const size_t input_channels = fully_connected_op->group_input_channels;
+  const size_t output_channels = fully_connected_op->group_output_channels;
+
+  // Quantized inputs are followed by the quantization parameters of each row. GEMM micro-kernels may read up to
+  // XNN_EXTRA_BYTES past the last row of quantized inputs.
+  const size_t quantized_input_size =
+    round_up_po2(batch_size * input_channels * sizeof(int8_t) + XNN_EXTRA_BYTES, XNN_ALLOCATION_ALIGNMENT);
+  const size_t workspace_size = quantized_input_size + batch_size * sizeof(struct xnn_qd8_quantization_params);
+  if (workspace_size > fully_connected_op->workspace_size) {
+    xnn_release_simd_memory(fully_connected_op->workspace);
+    fully_connected_op->workspace_size = 0;
+    fully_connected_op->workspace = xnn_allocate_simd_memory(workspace_size);
+    if (fully_connected_op->workspace == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator quantized input",
+        workspace_size, xnn_operator_type_to_string(fully_connected_op->type));
+      return xnn_status_out_of_memory;
+    }
+    fully_connected_op->workspace_size = workspace_size;
+  }
+
+  uint32_t mr = fully_connected_op->ukernel.gemm.mr;
+  const uint32_t nr = fully_connected_op->ukernel.gemm.nr;
+
+  xnn_qd8_f32_qc8w_gemm_ukernel_function gemm_ukernel = fully_connected_op->ukernel.gemm.qd8_function;
+  if (batch_size == 1 && fully_connected_op->ukernel.gemm.qd8_mr1_function != NULL) {
+    gemm_ukernel = fully_connected_op->ukernel.gemm.qd8_mr1_function;
+    mr = 1;
+  }
+
+  fully_connected_op->context.qd8_gemm = (struct qd8_gemm_context) {
+    .k = input_channels,
+    .a = input,
+    .a_stride = fully_connected_op->input_pixel_stride * sizeof(float),
+    .quantized_a = fully_connected_op->workspace,
+    .quantization_params = (struct xnn_qd8_quantization_params*) ((uintptr_t) fully_connected_op->workspace + quantized_input_size),
+    .packed_w = fully_connected_op->packed_weights,
+    .w_stride = sizeof(int32_t) + round_up_po2(input_channels, fully_connected_op->ukernel.gemm.kr) * sizeof(int8_t) +
+      2 * sizeof(float),
+    .c = output,
+    .cm_stride = fully_connected_op->output_pixel_stride * sizeof(float),
+    .cn_stride = nr * sizeof(float),
+    .vcvt_ukernel = fully_connected_op->ukernel.gemm.qd8_vcvt_function,
+    .gemm_ukernel = gemm_ukernel,
+    .params = fully_connected_op->params.f32_minmax,
+  };
+
+  // Every row of inputs is quantized with its own scale and zero point before the multiplication.
+  fully_connected_op->compute0.type = xnn_parallelization_type_1d;
+  fully_connected_op->compute0.task_1d = (pthreadpool_task_1d_t) xnn_compute_qd8_quantize_a;
+  fully_connected_op->compute0.range[0] = batch_size;
+
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  size_t nc = output_channels;
+  if (num_threads > 1) {
+    const size_t num_other_tiles = divide_round_up(batch_size, mr);
+    const size_t target_tiles_per_thread = 5;
+    const size_t max_nc = divide_round_up(output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
+    if (max_nc < nc) {
+      nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+    }
+  }
+  fully_connected_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+  fully_connected_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_qd8_gemm;
+  fully_connected_op->compute.range[0] = batch_size;
+  fully_connected_op->compute.range[1] = output_channels;
+  fully_connected_op->compute.tile[0] = mr;
+  fully_connected_op->compute.tile[1] = nc;
+  fully_connected_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
 enum xnn_status xnn_setup_fully_connected_nc_f32(
     xnn_operator_t fully_connected_op,
     size_t batch_size,
@@ -527,7 +1391,9 @@ enum xnn_status xnn_setup_fully_connected_nc_f32(
     return xnn_status_invalid_parameter;
   }
 
-  return setup_fully_connected_nc(
+  const bool fused_hswish =
+    (fully_connected_op->flags & XNN_FLAG_FUSED_HARDSWISH) != 0 && fully_connected_op->context2.ukernel == NULL;
+  const enum xnn_status status = setup_fully_connected_nc(
     fully_connected_op,
     batch_size,
     input, output,
@@ -536,7 +1402,23 @@ enum xnn_status xnn_setup_fully_connected_nc_f32(
     2 /* log2(sizeof(filter element)) = log2(sizeof(float)) */,
     sizeof(float) /* sizeof(bias element) */,
     2 /* log2(sizeof(output element)) = log2(sizeof(float)) */,
-    &fully_connected_op->params.f32_minmax,
-    sizeof(fully_connected_op->params.f32_minmax),
+    &fully_connected_op->params,
+    fused_hswish ? sizeof(fully_connected_op->params.f32_hswish) : sizeof(fully_connected_op->params.f32_minmax),
     pthreadpool_get_threads_count(threadpool));
+  if (status != xnn_status_success || fully_connected_op->state != xnn_run_state_ready) {
+    return status;
+  }
+
+  if (fully_connected_op->context2.ukernel != NULL) {
+    fully_connected_op->context2.n = fully_connected_op->group_output_channels * sizeof(float);
+    fully_connected_op->context2.x = output;
+    fully_connected_op->context2.x_stride = fully_connected_op->output_pixel_stride * sizeof(float);
+    fully_connected_op->context2.y = output;
+    fully_connected_op->context2.y_stride = fully_connected_op->output_pixel_stride * sizeof(float);
+    fully_connected_op->compute2.type = xnn_parallelization_type_1d_tile_1d;
+    fully_connected_op->compute2.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_univector_strided;
+    fully_connected_op->compute2.range[0] = batch_size;
+    fully_connected_op->compute2.tile[0] = 1;
+  }
+  return xnn_status_success;
 }
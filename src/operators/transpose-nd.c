@@ -0,0 +1,334 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+static enum xnn_status create_transpose_nd(
+    uint32_t flags,
+    uint32_t datatype_init_flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* transpose_op_out)
+{
+  xnn_operator_t transpose_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  transpose_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (transpose_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  transpose_op->flags = flags;
+  transpose_op->type = operator_type;
+
+  transpose_op->state = xnn_run_state_invalid;
+
+  *transpose_op_out = transpose_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(transpose_op);
+  return status;
+}
+
+enum xnn_status xnn_create_transpose_nd_x8(
+  uint32_t flags,
+  xnn_operator_t* transpose_op_out)
+{
+  return create_transpose_nd(flags, XNN_INIT_FLAG_X8, xnn_operator_type_transpose_nd_x8, transpose_op_out);
+}
+
+enum xnn_status xnn_create_transpose_nd_x16(
+  uint32_t flags,
+  xnn_operator_t* transpose_op_out)
+{
+  return create_transpose_nd(flags, XNN_INIT_FLAG_X16, xnn_operator_type_transpose_nd_x16, transpose_op_out);
+}
+
+enum xnn_status xnn_create_transpose_nd_x32(
+  uint32_t flags,
+  xnn_operator_t* transpose_op_out)
+{
+  return create_transpose_nd(flags, XNN_INIT_FLAG_X32, xnn_operator_type_transpose_nd_x32, transpose_op_out);
+}
+
+static enum xnn_status setup_transpose_nd(
+    xnn_operator_t transpose_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* perm,
+    const void* input,
+    void* output,
+    uint32_t log2_element_size,
+    const struct transpose_parameters transpose[restrict XNN_MIN_ELEMENTS(1)])
+{
+  if (transpose_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(transpose_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  transpose_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(transpose_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (num_dims == 0 || num_dims > XNN_MAX_TENSOR_DIMS) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu dimensions in input shape: "
+      "the number of input dimensions must be between 1 and %d",
+      xnn_operator_type_to_string(transpose_op->type), num_dims, XNN_MAX_TENSOR_DIMS);
+    return xnn_status_unsupported_parameter;
+  }
+
+  for (size_t i = 0; i < num_dims; i++) {
+    if (input_shape[i] == 0) {
+      xnn_log_error(
+        "failed to setup %s operator: input shape dimension #%zu is zero",
+        xnn_operator_type_to_string(transpose_op->type), i);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  bool is_permuted_dim[XNN_MAX_TENSOR_DIMS] = { false };
+  for (size_t i = 0; i < num_dims; i++) {
+    if (perm[i] >= num_dims || is_permuted_dim[perm[i]]) {
+      xnn_log_error(
+        "failed to setup %s operator: permutation element #%zu (%zu) is out of range or repeated",
+        xnn_operator_type_to_string(transpose_op->type), i, perm[i]);
+      return xnn_status_invalid_parameter;
+    }
+    is_permuted_dim[perm[i]] = true;
+  }
+
+  // Remove the dimensions of size 1: they don't affect the order of the elements.
+  size_t squeezed_dim_index[XNN_MAX_TENSOR_DIMS];
+  size_t squeezed_shape[XNN_MAX_TENSOR_DIMS];
+  size_t num_squeezed_dims = 0;
+  for (size_t i = 0; i < num_dims; i++) {
+    if (input_shape[i] != 1) {
+      squeezed_dim_index[i] = num_squeezed_dims;
+      squeezed_shape[num_squeezed_dims++] = input_shape[i];
+    }
+  }
+  size_t squeezed_perm[XNN_MAX_TENSOR_DIMS];
+  size_t num_squeezed_perm_dims = 0;
+  for (size_t i = 0; i < num_dims; i++) {
+    if (input_shape[perm[i]] != 1) {
+      squeezed_perm[num_squeezed_perm_dims++] = squeezed_dim_index[perm[i]];
+    }
+  }
+  assert(num_squeezed_perm_dims == num_squeezed_dims);
+
+  // Merge the input dimensions which stay adjacent and in the same order in the output, so that the permutation is
+  // reduced to the minimal number of dimensions.
+  size_t group_start[XNN_MAX_TENSOR_DIMS];
+  size_t group_size[XNN_MAX_TENSOR_DIMS];
+  size_t num_groups = 0;
+  for (size_t i = 0; i < num_squeezed_dims; i++) {
+    if (i != 0 && squeezed_perm[i] == squeezed_perm[i - 1] + 1) {
+      group_size[num_groups - 1] *= squeezed_shape[squeezed_perm[i]];
+    } else {
+      group_start[num_groups] = squeezed_perm[i];
+      group_size[num_groups] = squeezed_shape[squeezed_perm[i]];
+      num_groups += 1;
+    }
+  }
+  size_t normalized_perm[XNN_MAX_TENSOR_DIMS];
+  size_t normalized_shape[XNN_MAX_TENSOR_DIMS];
+  for (size_t g = 0; g < num_groups; g++) {
+    // Merged input dimensions are ordered by their first squeezed dimension.
+    size_t input_dim = 0;
+    for (size_t h = 0; h < num_groups; h++) {
+      input_dim += (size_t) (group_start[h] < group_start[g]);
+    }
+    normalized_perm[g] = input_dim;
+    normalized_shape[input_dim] = group_size[g];
+  }
+  size_t num_normalized_dims = num_groups;
+  if (num_normalized_dims == 0) {
+    // All dimensions have size 1.
+    normalized_perm[0] = 0;
+    normalized_shape[0] = 1;
+    num_normalized_dims = 1;
+  }
+
+  // Strides, in bytes, of the input dimensions and of the output dimensions.
+  size_t normalized_input_stride[XNN_MAX_TENSOR_DIMS];
+  size_t normalized_output_stride[XNN_MAX_TENSOR_DIMS];
+  normalized_input_stride[num_normalized_dims - 1] = UINT32_C(1) << log2_element_size;
+  normalized_output_stride[num_normalized_dims - 1] = UINT32_C(1) << log2_element_size;
+  for (size_t i = num_normalized_dims - 1; i != 0; i--) {
+    normalized_input_stride[i - 1] = normalized_input_stride[i] * normalized_shape[i];
+    normalized_output_stride[i - 1] = normalized_output_stride[i] * normalized_shape[normalized_perm[i]];
+  }
+
+  transpose_op->context.transpose = (struct transpose_context) {
+    .input = input,
+    .output = output,
+    .transpose_ukernel = transpose->ukernel,
+    .copy_ukernel = xnn_params.xx.copy,
+  };
+  struct transpose_context* context = &transpose_op->context.transpose;
+
+  const size_t last_dim = num_normalized_dims - 1;
+  if (normalized_perm[last_dim] == last_dim) {
+    // The innermost dimension is not permuted: copy it contiguously, and iterate over the outer output dimensions.
+    context->copy_size = normalized_shape[last_dim] << log2_element_size;
+    size_t range[XNN_MAX_TENSOR_DIMS - 1];
+    const size_t num_outer_dims = XNN_MAX_TENSOR_DIMS - 1;
+    const size_t outer_dims_offset = num_outer_dims - last_dim;
+    for (size_t i = 0; i < outer_dims_offset; i++) {
+      range[i] = 1;
+      context->input_stride[i] = 0;
+      context->output_stride[i] = 0;
+    }
+    for (size_t i = 0; i < last_dim; i++) {
+      range[outer_dims_offset + i] = normalized_shape[normalized_perm[i]];
+      context->input_stride[outer_dims_offset + i] = normalized_input_stride[normalized_perm[i]];
+      context->output_stride[outer_dims_offset + i] = normalized_output_stride[i];
+    }
+
+    transpose_op->compute.type = xnn_parallelization_type_5d;
+    transpose_op->compute.task_5d = (pthreadpool_task_5d_t) xnn_compute_transpose_copy_5d;
+    transpose_op->compute.range[0] = range[0];
+    transpose_op->compute.range[1] = range[1];
+    transpose_op->compute.range[2] = range[2];
+    transpose_op->compute.range[3] = range[3];
+    transpose_op->compute.range[4] = range[4];
+  } else {
+    // Transpose 2D blocks between the innermost input dimension, which becomes output dimension #contiguous_dim, and
+    // the innermost output dimension. The other output dimensions are iterated in the output order.
+    size_t contiguous_dim = 0;
+    while (normalized_perm[contiguous_dim] != last_dim) {
+      contiguous_dim += 1;
+    }
+    size_t range[XNN_MAX_TENSOR_DIMS];
+    const size_t num_outer_dims = XNN_MAX_TENSOR_DIMS - 2;
+    const size_t outer_dims_offset = num_outer_dims - (num_normalized_dims - 2);
+    for (size_t i = 0; i < outer_dims_offset; i++) {
+      range[i] = 1;
+      context->input_stride[i] = 0;
+      context->output_stride[i] = 0;
+    }
+    size_t outer_dim = outer_dims_offset;
+    for (size_t i = 0; i < last_dim; i++) {
+      if (i != contiguous_dim) {
+        range[outer_dim] = normalized_shape[normalized_perm[i]];
+        context->input_stride[outer_dim] = normalized_input_stride[normalized_perm[i]];
+        context->output_stride[outer_dim] = normalized_output_stride[i];
+        outer_dim += 1;
+      }
+    }
+    assert(outer_dim == num_outer_dims);
+    range[4] = normalized_shape[last_dim];
+    context->input_stride[4] = normalized_input_stride[last_dim];
+    context->output_stride[4] = normalized_output_stride[contiguous_dim];
+    range[5] = normalized_shape[normalized_perm[last_dim]];
+    context->input_stride[5] = normalized_input_stride[normalized_perm[last_dim]];
+    context->output_stride[5] = normalized_output_stride[last_dim];
+
+    // Each task transposes up to 8x8 register tiles of the micro-kernel.
+    const size_t tile = (size_t) transpose->tile_size * 8;
+    transpose_op->compute.type = xnn_parallelization_type_6d_tile_2d;
+    transpose_op->compute.task_6d_tile_2d = (pthreadpool_task_6d_tile_2d_t) xnn_compute_transpose_6d_tile_2d;
+    transpose_op->compute.range[0] = range[0];
+    transpose_op->compute.range[1] = range[1];
+    transpose_op->compute.range[2] = range[2];
+    transpose_op->compute.range[3] = range[3];
+    transpose_op->compute.range[4] = range[4];
+    transpose_op->compute.range[5] = range[5];
+    transpose_op->compute.tile[0] = min(range[4], tile);
+    transpose_op->compute.tile[1] = min(range[5], tile);
+  }
+  transpose_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_transpose_nd_x8(
+    xnn_operator_t transpose_op,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* perm,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_transpose_nd(
+    transpose_op, xnn_operator_type_transpose_nd_x8,
+    num_dims, input_shape, perm,
+    input, output,
+    0 /* log2(sizeof(uint8_t)) */,
+    &xnn_params.x8.transpose);
+}
+
+enum xnn_status xnn_setup_transpose_nd_x16(
+    xnn_operator_t transpose_op,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* perm,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_transpose_nd(
+    transpose_op, xnn_operator_type_transpose_nd_x16,
+    num_dims, input_shape, perm,
+    input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    &xnn_params.x16.transpose);
+}
+
+enum xnn_status xnn_setup_transpose_nd_x32(
+    xnn_operator_t transpose_op,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* perm,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_transpose_nd(
+    transpose_op, xnn_operator_type_transpose_nd_x32,
+    num_dims, input_shape, perm,
+    input, output,
+    2 /* log2(sizeof(uint32_t)) */,
+    &xnn_params.x32.transpose);
+}
@@ -88,7 +88,8 @@ static enum xnn_status setup_unary_elementwise_nc(
     size_t batch_size,
     const void* input,
     void* output,
-    uint32_t log2_element_size,
+    uint32_t log2_input_size,
+    uint32_t log2_output_size,
     const void* params,
     size_t params_size)
 {
@@ -113,9 +114,9 @@ static enum xnn_status setup_unary_elementwise_nc(
     const size_t block_size = 4096;
     unary_elementwise_op->context.univector_contiguous = (struct univector_contiguous_context) {
       .x = input,
-      .x_stride = input_stride << log2_element_size,
       .y = output,
-      .y_stride = output_stride << log2_element_size,
+      .log2_xsize = log2_input_size,
+      .log2_ysize = log2_output_size,
       .ukernel = ukernel,
     };
     if (params_size != 0) {
@@ -123,15 +124,15 @@ static enum xnn_status setup_unary_elementwise_nc(
     }
     unary_elementwise_op->compute.type = xnn_parallelization_type_1d_tile_1d;
     unary_elementwise_op->compute.task_1d_tile_1d = (pthreadpool_task_1d_tile_1d_t) xnn_compute_univector_contiguous;
-    unary_elementwise_op->compute.range[0] = (batch_size * channels) << log2_element_size;
+    unary_elementwise_op->compute.range[0] = (batch_size * channels) << log2_input_size;
     unary_elementwise_op->compute.tile[0] = block_size;
   } else {
     unary_elementwise_op->context.univector_strided = (struct univector_strided_context) {
-      .n = channels << log2_element_size,
+      .n = channels << log2_input_size,
       .x = input,
-      .x_stride = input_stride << log2_element_size,
+      .x_stride = input_stride << log2_input_size,
       .y = output,
-      .y_stride = output_stride << log2_element_size,
+      .y_stride = output_stride << log2_output_size,
       .ukernel = ukernel,
     };
     if (params_size != 0) {
@@ -263,6 +264,159 @@ enum xnn_status xnn_create_ceiling_nc_f32(
     ceiling_op_out);
 }
 
+enum xnn_status xnn_create_convert_nc_f16_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* convert_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_f16_f32));
+    return xnn_status_uninitialized;
+  }
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_VCVT) != XNN_INIT_FLAG_VCVT) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_f16_f32));
+    return xnn_status_unsupported_hardware;
+  }
+
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    NULL, 0,
+    xnn_operator_type_convert_nc_f16_f32,
+    xnn_params.vcvt.f16_to_f32,
+    convert_op_out);
+}
+
+enum xnn_status xnn_create_convert_nc_f32_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* convert_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_f32_f16));
+    return xnn_status_uninitialized;
+  }
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_VCVT) != XNN_INIT_FLAG_VCVT) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_f32_f16));
+    return xnn_status_unsupported_hardware;
+  }
+
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    NULL, 0,
+    xnn_operator_type_convert_nc_f32_f16,
+    xnn_params.vcvt.f32_to_f16,
+    convert_op_out);
+}
+
+enum xnn_status xnn_create_convert_nc_f32_qs8(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float output_scale,
+    int8_t output_zero_point,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* convert_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_f32_qs8));
+    return xnn_status_uninitialized;
+  }
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_VCVT) != XNN_INIT_FLAG_VCVT) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_f32_qs8));
+    return xnn_status_unsupported_hardware;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale parameter: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_f32_qs8), output_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%" PRId8 ", %" PRId8 "] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_f32_qs8), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  const union xnn_f32_qs8_cvt_params params = xnn_init_f32_qs8_cvt_params(
+    1.0f / output_scale, output_zero_point, output_min, output_max);
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_convert_nc_f32_qs8,
+    xnn_params.vcvt.f32_to_qs8,
+    convert_op_out);
+}
+
+enum xnn_status xnn_create_convert_nc_qs8_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float input_scale,
+    int8_t input_zero_point,
+    uint32_t flags,
+    xnn_operator_t* convert_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_qs8_f32));
+    return xnn_status_uninitialized;
+  }
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_VCVT) != XNN_INIT_FLAG_VCVT) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_qs8_f32));
+    return xnn_status_unsupported_hardware;
+  }
+
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale parameter: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_qs8_f32), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  const union xnn_qs8_f32_cvt_params params = xnn_init_qs8_f32_cvt_params(input_scale, input_zero_point);
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_convert_nc_qs8_f32,
+    xnn_params.vcvt.qs8_to_f32,
+    convert_op_out);
+}
+
+enum xnn_status xnn_create_copy_nc_x8(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* copy_op_out)
+{
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    NULL, 0,
+    xnn_operator_type_copy_nc_x8,
+    xnn_params.xx.copy,
+    copy_op_out);
+}
+
 enum xnn_status xnn_create_copy_nc_x32(
     size_t channels,
     size_t input_stride,
@@ -484,6 +638,7 @@ enum xnn_status xnn_setup_abs_nc_f32(
     abs_op,
     batch_size, input, output,
     2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
     &abs_op->params.f32_abs, sizeof(abs_op->params.f32_abs));
 }
 
@@ -506,6 +661,7 @@ enum xnn_status xnn_setup_bankers_rounding_nc_f32(
     rounding_op,
     batch_size, input, output,
     2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
     &rounding_op->params.f32_rnd, sizeof(rounding_op->params.f32_rnd));
 }
 
@@ -528,6 +684,7 @@ enum xnn_status xnn_setup_ceiling_nc_f32(
     ceiling_op,
     batch_size, input, output,
     2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
     &ceiling_op->params.f32_rnd, sizeof(ceiling_op->params.f32_rnd));
 }
 
@@ -550,6 +707,7 @@ enum xnn_status xnn_setup_clamp_nc_u8(
     clamp_op,
     batch_size, input, output,
     0 /* log2(sizeof(uint8_t)) */,
+    0 /* log2(sizeof(uint8_t)) */,
     &clamp_op->params.u8_minmax, sizeof(clamp_op->params.u8_minmax));
 }
 
@@ -572,9 +730,125 @@ enum xnn_status xnn_setup_clamp_nc_f32(
     clamp_op,
     batch_size, input, output,
     2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
     &clamp_op->params.f32_minmax, sizeof(clamp_op->params.f32_minmax));
 }
 
+enum xnn_status xnn_setup_convert_nc_f16_f32(
+    xnn_operator_t convert_op,
+    size_t batch_size,
+    const void* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (convert_op->type != xnn_operator_type_convert_nc_f16_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_f16_f32),
+      xnn_operator_type_to_string(convert_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  convert_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    convert_op,
+    batch_size, input, output,
+    1 /* log2(sizeof(half)) */,
+    2 /* log2(sizeof(float)) */,
+    NULL, 0);
+}
+
+enum xnn_status xnn_setup_convert_nc_f32_f16(
+    xnn_operator_t convert_op,
+    size_t batch_size,
+    const float* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (convert_op->type != xnn_operator_type_convert_nc_f32_f16) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_f32_f16),
+      xnn_operator_type_to_string(convert_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  convert_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    convert_op,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    1 /* log2(sizeof(half)) */,
+    NULL, 0);
+}
+
+enum xnn_status xnn_setup_convert_nc_f32_qs8(
+    xnn_operator_t convert_op,
+    size_t batch_size,
+    const float* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  if (convert_op->type != xnn_operator_type_convert_nc_f32_qs8) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_f32_qs8),
+      xnn_operator_type_to_string(convert_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  convert_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    convert_op,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    0 /* log2(sizeof(int8_t)) */,
+    &convert_op->params.f32_qs8_cvt, sizeof(convert_op->params.f32_qs8_cvt));
+}
+
+enum xnn_status xnn_setup_convert_nc_qs8_f32(
+    xnn_operator_t convert_op,
+    size_t batch_size,
+    const int8_t* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (convert_op->type != xnn_operator_type_convert_nc_qs8_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_qs8_f32),
+      xnn_operator_type_to_string(convert_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  convert_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    convert_op,
+    batch_size, input, output,
+    0 /* log2(sizeof(int8_t)) */,
+    2 /* log2(sizeof(float)) */,
+    &convert_op->params.qs8_f32_cvt, sizeof(convert_op->params.qs8_f32_cvt));
+}
+
+enum xnn_status xnn_setup_copy_nc_x8(
+    xnn_operator_t copy_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (copy_op->type != xnn_operator_type_copy_nc_x8) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_copy_nc_x8),
+      xnn_operator_type_to_string(copy_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  copy_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    copy_op,
+    batch_size, input, output,
+    0 /* log2(sizeof(uint8_t)) */,
+    0 /* log2(sizeof(uint8_t)) */,
+    NULL, 0);
+}
+
 enum xnn_status xnn_setup_copy_nc_x32(
     xnn_operator_t copy_op,
     size_t batch_size,
@@ -594,6 +868,7 @@ enum xnn_status xnn_setup_copy_nc_x32(
     copy_op,
     batch_size, input, output,
     2 /* log2(sizeof(uint32_t)) */,
+    2 /* log2(sizeof(uint32_t)) */,
     NULL, 0);
 }
 
@@ -616,6 +891,7 @@ enum xnn_status xnn_setup_elu_nc_f32(
     elu_op,
     batch_size, input, output,
     2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
     &elu_op->params.f32_elu, sizeof(elu_op->params.f32_elu));
 }
 
@@ -638,6 +914,7 @@ enum xnn_status xnn_setup_floor_nc_f32(
     floor_op,
     batch_size, input, output,
     2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
     &floor_op->params.f32_rnd, sizeof(floor_op->params.f32_rnd));
 }
 
@@ -660,6 +937,7 @@ enum xnn_status xnn_setup_hardswish_nc_f16(
     hardswish_op,
     batch_size, input, output,
     1 /* log2(sizeof(half)) */,
+    1 /* log2(sizeof(half)) */,
     &hardswish_op->params.f16_hswish, sizeof(hardswish_op->params.f16_hswish));
 }
 
@@ -682,6 +960,7 @@ enum xnn_status xnn_setup_hardswish_nc_f32(
     hardswish_op,
     batch_size, input, output,
     2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
     &hardswish_op->params.f32_hswish, sizeof(hardswish_op->params.f32_hswish));
 }
 
@@ -704,6 +983,7 @@ enum xnn_status xnn_setup_leaky_relu_nc_f32(
     leaky_relu_op,
     batch_size, input, output,
     2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
     &leaky_relu_op->params.f32_lrelu, sizeof(leaky_relu_op->params.f32_lrelu));
 }
 
@@ -726,6 +1006,7 @@ enum xnn_status xnn_setup_negate_nc_f32(
     negate_op,
     batch_size, input, output,
     2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
     &negate_op->params.f32_neg, sizeof(negate_op->params.f32_neg));
 }
 
@@ -748,6 +1029,7 @@ enum xnn_status xnn_setup_sigmoid_nc_f32(
     sigmoid_op,
     batch_size, input, output,
     2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
     NULL, 0);
 }
 
@@ -770,6 +1052,7 @@ enum xnn_status xnn_setup_square_nc_f32(
     square_op,
     batch_size, input, output,
     2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
     NULL, 0);
 }
 
@@ -792,6 +1075,7 @@ enum xnn_status xnn_setup_square_root_nc_f32(
     sqrt_op,
     batch_size, input, output,
     2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
     NULL, 0);
 }
 
@@ -814,5 +1098,6 @@ enum xnn_status xnn_setup_truncation_nc_f32(
     truncation_op,
     batch_size, input, output,
     2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
     &truncation_op->params.f32_rnd, sizeof(truncation_op->params.f32_rnd));
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#include <pthreadpool.h>
+
 #include <xnnpack/math.h>
 #include <xnnpack/pack.h>
 
@@ -23,6 +25,7 @@ void xnn_pack_f32_gemm_goi_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
   const size_t skr = sr * kr;
@@ -59,6 +62,7 @@ void xnn_pack_f32_gemm_goi_w(
         }
         packed_w += (nr - nr_block_size) * kr;
       }
+      packed_w = (float*) ((uintptr_t) packed_w + extra_bytes);
     }
     k += nc * kc;
     if XNN_UNPREDICTABLE(b != NULL) {
@@ -77,6 +81,7 @@ void xnn_pack_f16_gemm_goi_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
   const size_t skr = sr * kr;
@@ -113,6 +118,7 @@ void xnn_pack_f16_gemm_goi_w(
         }
         packed_w += (nr - nr_block_size) * kr;
       }
+      packed_w = (uint16_t*) ((uintptr_t) packed_w + extra_bytes);
     }
     k += nc * kc;
     if XNN_UNPREDICTABLE(b != NULL) {
@@ -131,6 +137,7 @@ void xnn_pack_qu8_gemm_goi_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params)
 {
   assert(sr == 1);
@@ -168,6 +175,7 @@ void xnn_pack_qu8_gemm_goi_w(
         }
         packed_w = (void*) ((uintptr_t) packed_w + (nr - nr_block_size) * kr * sizeof(uint8_t));
       }
+      packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
     }
     k += nc * kc;
     if XNN_UNPREDICTABLE(b != NULL) {
@@ -186,6 +194,7 @@ void xnn_pack_qs8_gemm_goi_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params)
 {
   assert(sr == 1);
@@ -222,6 +231,7 @@ void xnn_pack_qs8_gemm_goi_w(
         }
         packed_w = (void*) ((uintptr_t) packed_w + (nr - nr_block_size) * kr * sizeof(int8_t));
       }
+      packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
     }
     k += nc * kc;
     if XNN_UNPREDICTABLE(b != NULL) {
@@ -240,6 +250,7 @@ void xnn_pack_qs8_gemm_xw_goi_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params)
 {
   assert(sr == 1);
@@ -276,6 +287,7 @@ void xnn_pack_qs8_gemm_xw_goi_w(
         }
         packed_w = (void*) ((uintptr_t) packed_w + (nr - nr_block_size) * kr * sizeof(int16_t));
       }
+      packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
     }
     k += nc * kc;
     if XNN_UNPREDICTABLE(b != NULL) {
@@ -293,6 +305,7 @@ void xnn_pack_f32_gemm_io_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
   const size_t skr = sr * kr;
@@ -328,9 +341,67 @@ void xnn_pack_f32_gemm_io_w(
       }
       packed_w += (nr - nr_block_size) * kr;
     }
+    packed_w = (float*) ((uintptr_t) packed_w + extra_bytes);
   }
 }
 
+void xnn_pack_f32_gemm_gio_w(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  size_t k_stride,
+  const float* k,
+  const float* b,
+  float* packed_w,
+  size_t extra_bytes,
+  const void* params)
+{
+  const size_t skr = sr * kr;
+  const size_t skc = round_down_po2(kc, skr);
+  const size_t sr_mask = (sr - 1) * kr;
+  do {
+    for (size_t nr_block_start = 0; nr_block_start < nc; nr_block_start += nr) {
+      const size_t nr_block_size = min(nc - nr_block_start, nr);
+      if XNN_LIKELY(b != NULL) {
+        for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+          packed_w[nr_block_offset] = b[nr_block_start + nr_block_offset];
+        }
+      }
+      packed_w += nr;
+
+      for (size_t kr_block_start = 0; kr_block_start < skc; kr_block_start += kr) {
+        for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+          for (size_t kr_block_offset = 0; kr_block_offset < kr; kr_block_offset++) {
+            *packed_w++ =
+              k[(round_down_po2(kr_block_start, skr) + ((kr_block_start + nr_block_offset * kr) & sr_mask) + kr_block_offset) * k_stride + (nr_block_start + nr_block_offset)];
+          }
+        }
+        packed_w += (nr - nr_block_size) * kr;
+      }
+
+      for (size_t kr_block_start = skc; kr_block_start < kc; kr_block_start += kr) {
+        const size_t kr_block_size = min(kc - kr_block_start, kr);
+        for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+          for (size_t kr_block_offset = 0; kr_block_offset < kr_block_size; kr_block_offset++) {
+            *packed_w++ =
+              k[(kr_block_start + kr_block_offset) * k_stride + (nr_block_start + nr_block_offset)];
+          }
+          packed_w += kr - kr_block_size;
+        }
+        packed_w += (nr - nr_block_size) * kr;
+      }
+      packed_w = (float*) ((uintptr_t) packed_w + extra_bytes);
+    }
+    k += nc;
+    if XNN_UNPREDICTABLE(b != NULL) {
+      b += nc;
+    }
+  } while (--g != 0);
+}
+
 void xnn_pack_f16_gemm_io_w(
   size_t nc,
   size_t kc,
@@ -340,6 +411,7 @@ void xnn_pack_f16_gemm_io_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
   const size_t skr = sr * kr;
@@ -375,6 +447,7 @@ void xnn_pack_f16_gemm_io_w(
       }
       packed_w += (nr - nr_block_size) * kr;
     }
+    packed_w = (uint16_t*) ((uintptr_t) packed_w + extra_bytes);
   }
 }
 
@@ -387,6 +460,7 @@ void xnn_pack_qu8_gemm_io_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params)
 {
   assert(sr == 1);
@@ -423,6 +497,7 @@ void xnn_pack_qu8_gemm_io_w(
       }
       packed_w = (void*) ((uintptr_t) packed_w + (nr - nr_block_size) * kr * sizeof(uint8_t));
     }
+    packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
   }
 }
 
@@ -435,6 +510,7 @@ void xnn_pack_qs8_gemm_io_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params)
 {
   assert(sr == 1);
@@ -470,6 +546,7 @@ void xnn_pack_qs8_gemm_io_w(
       }
       packed_w = (void*) ((uintptr_t) packed_w + (nr - nr_block_size) * kr * sizeof(int8_t));
     }
+    packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
   }
 }
 
@@ -484,6 +561,7 @@ void xnn_pack_f32_conv_goki_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
   const size_t skr = sr * kr;
@@ -522,6 +600,7 @@ void xnn_pack_f32_conv_goki_w(
           packed_w += (nr - nr_block_size) * kr;
         }
       }
+      packed_w = (float*) ((uintptr_t) packed_w + extra_bytes);
     }
     k += ks * kc * nc;
     if XNN_UNPREDICTABLE(b != NULL) {
@@ -541,6 +620,7 @@ void xnn_pack_f16_conv_goki_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
   const size_t skr = sr * kr;
@@ -579,6 +659,7 @@ void xnn_pack_f16_conv_goki_w(
           packed_w += (nr - nr_block_size) * kr;
         }
       }
+      packed_w = (uint16_t*) ((uintptr_t) packed_w + extra_bytes);
     }
     k += ks * kc * nc;
     if XNN_UNPREDICTABLE(b != NULL) {
@@ -598,6 +679,7 @@ void xnn_pack_qu8_conv_goki_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params)
 {
   assert(sr == 1);
@@ -638,6 +720,7 @@ void xnn_pack_qu8_conv_goki_w(
           packed_w = (void*) ((uintptr_t) packed_w + (nr - nr_block_size) * kr * sizeof(uint8_t));
         }
       }
+      packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
     }
     k += ks * kc * nc;
     if XNN_UNPREDICTABLE(b != NULL) {
@@ -657,6 +740,7 @@ void xnn_pack_qs8_conv_goki_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params)
 {
   assert(sr == 1);
@@ -696,6 +780,7 @@ void xnn_pack_qs8_conv_goki_w(
           packed_w = (void*) ((uintptr_t) packed_w + (nr - nr_block_size) * kr * sizeof(int8_t));
         }
       }
+      packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
     }
     k += ks * kc * nc;
     if XNN_UNPREDICTABLE(b != NULL) {
@@ -713,6 +798,7 @@ void xnn_pack_f32_conv_kgo_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
   for (size_t i = 0; i < g; i++) {
@@ -732,6 +818,7 @@ void xnn_pack_f32_conv_kgo_w(
         }
         packed_w += (nr - nr_block_size) * kr;
       }
+      packed_w = (float*) ((uintptr_t) packed_w + extra_bytes);
     }
     k += nc;
     if XNN_UNPREDICTABLE(b != NULL) {
@@ -749,6 +836,7 @@ void xnn_pack_f16_conv_kgo_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
   for (size_t i = 0; i < g; i++) {
@@ -768,6 +856,7 @@ void xnn_pack_f16_conv_kgo_w(
         }
         packed_w += (nr - nr_block_size) * kr;
       }
+      packed_w = (uint16_t*) ((uintptr_t) packed_w + extra_bytes);
     }
     k += nc;
     if XNN_UNPREDICTABLE(b != NULL) {
@@ -785,6 +874,7 @@ void xnn_pack_qu8_conv_kgo_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params)
 {
   const int32_t izp = (int32_t) params->input_zero_point;
@@ -816,6 +906,7 @@ void xnn_pack_qu8_conv_kgo_w(
         }
         packed_w = (void*) ((uintptr_t) packed_w + (nr - nr_block_size) * kr * sizeof(uint8_t));
       }
+      packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
     }
     k += nc;
     if XNN_UNPREDICTABLE(b != NULL) {
@@ -833,6 +924,7 @@ void xnn_pack_qs8_conv_kgo_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params)
 {
   const int32_t izp = (int32_t) params->input_zero_point;
@@ -863,6 +955,7 @@ void xnn_pack_qs8_conv_kgo_w(
         }
         packed_w = (void*) ((uintptr_t) packed_w + (nr - nr_block_size) * kr * sizeof(int8_t));
       }
+      packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
     }
     k += nc;
     if XNN_UNPREDICTABLE(b != NULL) {
@@ -1083,6 +1176,8 @@ void xnn_pack_qu8_deconv_goki_w(
 }
 
 void xnn_pack_f32_dwconv_ghw_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -1090,34 +1185,56 @@ void xnn_pack_f32_dwconv_ghw_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
-  for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
-    const size_t cr_block_size = min(c - cr_block_start, cr);
-    if XNN_LIKELY(b != NULL) {
-      for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
-        *packed_w++ = b[cr_block_start + cr_block_offset];
+  const size_t kernel_size = h * w;
+  assert(primary_tile != 0);
+  assert(kernel_size <= primary_tile || incremental_tile != 0);
+
+  size_t tap_start = 0;
+  size_t tap_tile = primary_tile;
+  do {
+    const size_t tap_end = min(tap_start + tap_tile, kernel_size);
+    for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
+      const size_t cr_block_size = min(c - cr_block_start, cr);
+      if (tap_start == 0) {
+        if XNN_LIKELY(b != NULL) {
+          for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
+            *packed_w++ = b[cr_block_start + cr_block_offset];
+          }
+        } else {
+          size_t n = cr_block_size;
+          do {
+            *packed_w++ = 0.0f;
+          } while (--n != 0);
+        }
+        packed_w += cr - cr_block_size;
       }
-    } else {
-      size_t n = cr_block_size;
-      do {
-        *packed_w++ = 0.0f;
-      } while (--n != 0);
-    }
-    packed_w += cr - cr_block_size;
-    for (size_t x = 0; x < w; x++) {
-      for (size_t y = 0; y < h; y++) {
+      for (size_t tap = tap_start; tap < tap_end; tap++) {
+        const size_t x = tap / h;
+        const size_t y = tap % h;
         for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
           const float kv = k[((cr_block_start + cr_block_offset) * h + y) * w + x];
           *packed_w++ = kv;
         }
         packed_w += cr - cr_block_size;
       }
+      // Skip the padding taps in the last pass.
+      packed_w += (tap_start + tap_tile - tap_end) * cr;
+      if (tap_end == kernel_size) {
+        // Leave room for the extra per-channel data after the last pass.
+        packed_w = (float*) ((uintptr_t) packed_w + extra_bytes);
+      }
     }
-  }
+    tap_start += tap_tile;
+    tap_tile = incremental_tile;
+  } while (tap_start < kernel_size);
 }
 
 void xnn_pack_f16_dwconv_ghw_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -1125,34 +1242,56 @@ void xnn_pack_f16_dwconv_ghw_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
-  for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
-    const size_t cr_block_size = min(c - cr_block_start, cr);
-    if XNN_LIKELY(b != NULL) {
-      for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
-        *packed_w++ = b[cr_block_start + cr_block_offset];
+  const size_t kernel_size = h * w;
+  assert(primary_tile != 0);
+  assert(kernel_size <= primary_tile || incremental_tile != 0);
+
+  size_t tap_start = 0;
+  size_t tap_tile = primary_tile;
+  do {
+    const size_t tap_end = min(tap_start + tap_tile, kernel_size);
+    for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
+      const size_t cr_block_size = min(c - cr_block_start, cr);
+      if (tap_start == 0) {
+        if XNN_LIKELY(b != NULL) {
+          for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
+            *packed_w++ = b[cr_block_start + cr_block_offset];
+          }
+        } else {
+          size_t n = cr_block_size;
+          do {
+            *packed_w++ = 0;
+          } while (--n != 0);
+        }
+        packed_w += cr - cr_block_size;
       }
-    } else {
-      size_t n = cr_block_size;
-      do {
-        *packed_w++ = 0;
-      } while (--n != 0);
-    }
-    packed_w += cr - cr_block_size;
-    for (size_t x = 0; x < w; x++) {
-      for (size_t y = 0; y < h; y++) {
+      for (size_t tap = tap_start; tap < tap_end; tap++) {
+        const size_t x = tap / h;
+        const size_t y = tap % h;
         for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
           const uint16_t kv = k[((cr_block_start + cr_block_offset) * h + y) * w + x];
           *packed_w++ = kv;
         }
         packed_w += cr - cr_block_size;
       }
+      // Skip the padding taps in the last pass.
+      packed_w += (tap_start + tap_tile - tap_end) * cr;
+      if (tap_end == kernel_size) {
+        // Leave room for the extra per-channel data after the last pass.
+        packed_w = (uint16_t*) ((uintptr_t) packed_w + extra_bytes);
+      }
     }
-  }
+    tap_start += tap_tile;
+    tap_tile = incremental_tile;
+  } while (tap_start < kernel_size);
 }
 
 void xnn_pack_qu8_dwconv_ghw_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -1160,41 +1299,71 @@ void xnn_pack_qu8_dwconv_ghw_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params)
 {
+  const size_t kernel_size = h * w;
+  assert(primary_tile != 0);
+  assert(kernel_size <= primary_tile || incremental_tile != 0);
+
   const int32_t izp = (int32_t) params->input_zero_point;
   const int32_t boff = (int32_t) h * (int32_t) w * izp * (int32_t) params->kernel_zero_point;
-  for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
-    const size_t cr_block_size = min(c - cr_block_start, cr);
-    int32_t* packed_b = (int32_t*) packed_w;
-    if XNN_LIKELY(b != NULL) {
-      for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
-        *((int32_t*) packed_w) = b[cr_block_start + cr_block_offset] + boff;
-        packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
+  size_t tap_start = 0;
+  size_t tap_tile = primary_tile;
+  do {
+    const size_t tap_end = min(tap_start + tap_tile, kernel_size);
+    for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
+      const size_t cr_block_size = min(c - cr_block_start, cr);
+      if (tap_start == 0) {
+        int32_t* packed_b = (int32_t*) packed_w;
+        if XNN_LIKELY(b != NULL) {
+          for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
+            *((int32_t*) packed_w) = b[cr_block_start + cr_block_offset] + boff;
+            packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
+          }
+        } else {
+          size_t n = cr_block_size;
+          do {
+            *((int32_t*) packed_w) = boff;
+            packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
+          } while (--n != 0);
+        }
+        packed_w = (void*) ((uintptr_t) packed_w + (cr - cr_block_size) * sizeof(int32_t));
+        // The bias accounts for the input zero point in all taps, including the taps of the subsequent passes.
+        for (size_t tap = 0; tap < kernel_size; tap++) {
+          const size_t x = tap / h;
+          const size_t y = tap % h;
+          for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
+            const uint8_t kv = k[((cr_block_start + cr_block_offset) * h + y) * w + x];
+            packed_b[cr_block_offset] -= (int32_t) kv * izp;
+          }
+        }
       }
-    } else {
-      size_t n = cr_block_size;
-      do {
-        *((int32_t*) packed_w) = boff;
-        packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
-      } while (--n != 0);
-    }
-    packed_w = (void*) ((uintptr_t) packed_w + (cr - cr_block_size) * sizeof(int32_t));
-    for (size_t x = 0; x < w; x++) {
-      for (size_t y = 0; y < h; y++) {
+      for (size_t tap = tap_start; tap < tap_end; tap++) {
+        const size_t x = tap / h;
+        const size_t y = tap % h;
         for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
           const uint8_t kv = k[((cr_block_start + cr_block_offset) * h + y) * w + x];
-          packed_b[cr_block_offset] -= (int32_t) kv * izp;
           *((uint8_t*) packed_w) = kv;
           packed_w = (void*) ((uintptr_t) packed_w + sizeof(uint8_t));
         }
         packed_w = (void*) ((uintptr_t) packed_w + (cr - cr_block_size) * sizeof(uint8_t));
       }
+      // Skip the padding taps in the last pass.
+      packed_w = (void*) ((uintptr_t) packed_w + (tap_start + tap_tile - tap_end) * cr * sizeof(uint8_t));
+      if (tap_end == kernel_size) {
+        // Leave room for the extra per-channel data after the last pass.
+        packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
+      }
     }
-  }
+    tap_start += tap_tile;
+    tap_tile = incremental_tile;
+  } while (tap_start < kernel_size);
 }
 
 void xnn_pack_qs8_dwconv_ghw_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -1202,40 +1371,70 @@ void xnn_pack_qs8_dwconv_ghw_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params)
 {
+  const size_t kernel_size = h * w;
+  assert(primary_tile != 0);
+  assert(kernel_size <= primary_tile || incremental_tile != 0);
+
   const int32_t izp = (int32_t) params->input_zero_point;
-  for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
-    const size_t cr_block_size = min(c - cr_block_start, cr);
-    int32_t* packed_b = (int32_t*) packed_w;
-    if XNN_LIKELY(b != NULL) {
-      for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
-        *((int32_t*) packed_w) = b[cr_block_start + cr_block_offset];
-        packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
+  size_t tap_start = 0;
+  size_t tap_tile = primary_tile;
+  do {
+    const size_t tap_end = min(tap_start + tap_tile, kernel_size);
+    for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
+      const size_t cr_block_size = min(c - cr_block_start, cr);
+      if (tap_start == 0) {
+        int32_t* packed_b = (int32_t*) packed_w;
+        if XNN_LIKELY(b != NULL) {
+          for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
+            *((int32_t*) packed_w) = b[cr_block_start + cr_block_offset];
+            packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
+          }
+        } else {
+          size_t n = cr_block_size;
+          do {
+            *((int32_t*) packed_w) = 0;
+            packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
+          } while (--n != 0);
+        }
+        packed_w = (void*) ((uintptr_t) packed_w + (cr - cr_block_size) * sizeof(int32_t));
+        // The bias accounts for the input zero point in all taps, including the taps of the subsequent passes.
+        for (size_t tap = 0; tap < kernel_size; tap++) {
+          const size_t x = tap / h;
+          const size_t y = tap % h;
+          for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
+            const int8_t kv = k[((cr_block_start + cr_block_offset) * h + y) * w + x];
+            packed_b[cr_block_offset] -= (int32_t) kv * izp;
+          }
+        }
       }
-    } else {
-      size_t n = cr_block_size;
-      do {
-        *((int32_t*) packed_w) = 0;
-        packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
-      } while (--n != 0);
-    }
-    packed_w = (void*) ((uintptr_t) packed_w + (cr - cr_block_size) * sizeof(int32_t));
-    for (size_t x = 0; x < w; x++) {
-      for (size_t y = 0; y < h; y++) {
+      for (size_t tap = tap_start; tap < tap_end; tap++) {
+        const size_t x = tap / h;
+        const size_t y = tap % h;
         for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
           const int8_t kv = k[((cr_block_start + cr_block_offset) * h + y) * w + x];
-          packed_b[cr_block_offset] -= (int32_t) kv * izp;
           *((int8_t*) packed_w) = kv;
           packed_w = (void*) ((uintptr_t) packed_w + sizeof(int8_t));
         }
         packed_w = (void*) ((uintptr_t) packed_w + (cr - cr_block_size) * sizeof(int8_t));
       }
+      // Skip the padding taps in the last pass.
+      packed_w = (void*) ((uintptr_t) packed_w + (tap_start + tap_tile - tap_end) * cr * sizeof(int8_t));
+      if (tap_end == kernel_size) {
+        // Leave room for the extra per-channel data after the last pass.
+        packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
+      }
     }
-  }
+    tap_start += tap_tile;
+    tap_tile = incremental_tile;
+  } while (tap_start < kernel_size);
 }
 
 void xnn_pack_f32_dwconv_hwg_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -1243,34 +1442,56 @@ void xnn_pack_f32_dwconv_hwg_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
-  for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
-    const size_t cr_block_size = min(c - cr_block_start, cr);
-    if XNN_LIKELY(b != NULL) {
-      for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
-        *packed_w++ = b[cr_block_start + cr_block_offset];
+  const size_t kernel_size = h * w;
+  assert(primary_tile != 0);
+  assert(kernel_size <= primary_tile || incremental_tile != 0);
+
+  size_t tap_start = 0;
+  size_t tap_tile = primary_tile;
+  do {
+    const size_t tap_end = min(tap_start + tap_tile, kernel_size);
+    for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
+      const size_t cr_block_size = min(c - cr_block_start, cr);
+      if (tap_start == 0) {
+        if XNN_LIKELY(b != NULL) {
+          for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
+            *packed_w++ = b[cr_block_start + cr_block_offset];
+          }
+        } else {
+          size_t n = cr_block_size;
+          do {
+            *packed_w++ = 0.0f;
+          } while (--n != 0);
+        }
+        packed_w += cr - cr_block_size;
       }
-    } else {
-      size_t n = cr_block_size;
-      do {
-        *packed_w++ = 0.0f;
-      } while (--n != 0);
-    }
-    packed_w += cr - cr_block_size;
-    for (size_t x = 0; x < w; x++) {
-      for (size_t y = 0; y < h; y++) {
+      for (size_t tap = tap_start; tap < tap_end; tap++) {
+        const size_t x = tap / h;
+        const size_t y = tap % h;
         for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
           const float kv = k[(y * w + x) * c + (cr_block_start + cr_block_offset)];
           *packed_w++ = kv;
         }
         packed_w += cr - cr_block_size;
       }
+      // Skip the padding taps in the last pass.
+      packed_w += (tap_start + tap_tile - tap_end) * cr;
+      if (tap_end == kernel_size) {
+        // Leave room for the extra per-channel data after the last pass.
+        packed_w = (float*) ((uintptr_t) packed_w + extra_bytes);
+      }
     }
-  }
+    tap_start += tap_tile;
+    tap_tile = incremental_tile;
+  } while (tap_start < kernel_size);
 }
 
 void xnn_pack_f16_dwconv_hwg_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -1278,34 +1499,56 @@ void xnn_pack_f16_dwconv_hwg_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
-  for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
-    const size_t cr_block_size = min(c - cr_block_start, cr);
-    if XNN_LIKELY(b != NULL) {
-      for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
-        *packed_w++ = b[cr_block_start + cr_block_offset];
+  const size_t kernel_size = h * w;
+  assert(primary_tile != 0);
+  assert(kernel_size <= primary_tile || incremental_tile != 0);
+
+  size_t tap_start = 0;
+  size_t tap_tile = primary_tile;
+  do {
+    const size_t tap_end = min(tap_start + tap_tile, kernel_size);
+    for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
+      const size_t cr_block_size = min(c - cr_block_start, cr);
+      if (tap_start == 0) {
+        if XNN_LIKELY(b != NULL) {
+          for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
+            *packed_w++ = b[cr_block_start + cr_block_offset];
+          }
+        } else {
+          size_t n = cr_block_size;
+          do {
+            *packed_w++ = 0;
+          } while (--n != 0);
+        }
+        packed_w += cr - cr_block_size;
       }
-    } else {
-      size_t n = cr_block_size;
-      do {
-        *packed_w++ = 0;
-      } while (--n != 0);
-    }
-    packed_w += cr - cr_block_size;
-    for (size_t x = 0; x < w; x++) {
-      for (size_t y = 0; y < h; y++) {
+      for (size_t tap = tap_start; tap < tap_end; tap++) {
+        const size_t x = tap / h;
+        const size_t y = tap % h;
         for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
           const uint16_t kv = k[(y * w + x) * c + (cr_block_start + cr_block_offset)];
           *packed_w++ = kv;
         }
         packed_w += cr - cr_block_size;
       }
+      // Skip the padding taps in the last pass.
+      packed_w += (tap_start + tap_tile - tap_end) * cr;
+      if (tap_end == kernel_size) {
+        // Leave room for the extra per-channel data after the last pass.
+        packed_w = (uint16_t*) ((uintptr_t) packed_w + extra_bytes);
+      }
     }
-  }
+    tap_start += tap_tile;
+    tap_tile = incremental_tile;
+  } while (tap_start < kernel_size);
 }
 
 void xnn_pack_qu8_dwconv_hwg_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -1313,41 +1556,71 @@ void xnn_pack_qu8_dwconv_hwg_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params)
 {
+  const size_t kernel_size = h * w;
+  assert(primary_tile != 0);
+  assert(kernel_size <= primary_tile || incremental_tile != 0);
+
   const int32_t izp = (int32_t) params->input_zero_point;
   const int32_t boff = (int32_t) h * (int32_t) w * izp * (int32_t) params->kernel_zero_point;
-  for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
-    const size_t cr_block_size = min(c - cr_block_start, cr);
-    int32_t* packed_b = (int32_t*) packed_w;
-    if XNN_LIKELY(b != NULL) {
-      for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
-        *((int32_t*) packed_w) = b[cr_block_start + cr_block_offset] + boff;
-        packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
+  size_t tap_start = 0;
+  size_t tap_tile = primary_tile;
+  do {
+    const size_t tap_end = min(tap_start + tap_tile, kernel_size);
+    for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
+      const size_t cr_block_size = min(c - cr_block_start, cr);
+      if (tap_start == 0) {
+        int32_t* packed_b = (int32_t*) packed_w;
+        if XNN_LIKELY(b != NULL) {
+          for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
+            *((int32_t*) packed_w) = b[cr_block_start + cr_block_offset] + boff;
+            packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
+          }
+        } else {
+          size_t n = cr_block_size;
+          do {
+            *((int32_t*) packed_w) = boff;
+            packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
+          } while (--n != 0);
+        }
+        packed_w = (void*) ((uintptr_t) packed_w + (cr - cr_block_size) * sizeof(int32_t));
+        // The bias accounts for the input zero point in all taps, including the taps of the subsequent passes.
+        for (size_t tap = 0; tap < kernel_size; tap++) {
+          const size_t x = tap / h;
+          const size_t y = tap % h;
+          for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
+            const uint8_t kv = k[(y * w + x) * c + (cr_block_start + cr_block_offset)];
+            packed_b[cr_block_offset] -= (int32_t) kv * izp;
+          }
+        }
       }
-    } else {
-      size_t n = cr_block_size;
-      do {
-        *((int32_t*) packed_w) = boff;
-        packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
-      } while (--n != 0);
-    }
-    packed_w = (void*) ((uintptr_t) packed_w + (cr - cr_block_size) * sizeof(int32_t));
-    for (size_t x = 0; x < w; x++) {
-      for (size_t y = 0; y < h; y++) {
+      for (size_t tap = tap_start; tap < tap_end; tap++) {
+        const size_t x = tap / h;
+        const size_t y = tap % h;
         for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
           const uint8_t kv = k[(y * w + x) * c + (cr_block_start + cr_block_offset)];
-          packed_b[cr_block_offset] -= (int32_t) kv * izp;
           *((uint8_t*) packed_w) = kv;
           packed_w = (void*) ((uintptr_t) packed_w + sizeof(uint8_t));
         }
         packed_w = (void*) ((uintptr_t) packed_w + (cr - cr_block_size) * sizeof(uint8_t));
       }
+      // Skip the padding taps in the last pass.
+      packed_w = (void*) ((uintptr_t) packed_w + (tap_start + tap_tile - tap_end) * cr * sizeof(uint8_t));
+      if (tap_end == kernel_size) {
+        // Leave room for the extra per-channel data after the last pass.
+        packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
+      }
     }
-  }
+    tap_start += tap_tile;
+    tap_tile = incremental_tile;
+  } while (tap_start < kernel_size);
 }
 
 void xnn_pack_qs8_dwconv_hwg_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -1355,37 +1628,65 @@ void xnn_pack_qs8_dwconv_hwg_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params)
 {
+  const size_t kernel_size = h * w;
+  assert(primary_tile != 0);
+  assert(kernel_size <= primary_tile || incremental_tile != 0);
+
   const int32_t izp = (int32_t) params->input_zero_point;
-  for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
-    const size_t cr_block_size = min(c - cr_block_start, cr);
-    int32_t* packed_b = (int32_t*) packed_w;
-    if XNN_LIKELY(b != NULL) {
-      for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
-        *((int32_t*) packed_w) = b[cr_block_start + cr_block_offset];
-        packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
+  size_t tap_start = 0;
+  size_t tap_tile = primary_tile;
+  do {
+    const size_t tap_end = min(tap_start + tap_tile, kernel_size);
+    for (size_t cr_block_start = 0; cr_block_start < c; cr_block_start += cr) {
+      const size_t cr_block_size = min(c - cr_block_start, cr);
+      if (tap_start == 0) {
+        int32_t* packed_b = (int32_t*) packed_w;
+        if XNN_LIKELY(b != NULL) {
+          for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
+            *((int32_t*) packed_w) = b[cr_block_start + cr_block_offset];
+            packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
+          }
+        } else {
+          size_t n = cr_block_size;
+          do {
+            *((int32_t*) packed_w) = 0;
+            packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
+          } while (--n != 0);
+        }
+        packed_w = (void*) ((uintptr_t) packed_w + (cr - cr_block_size) * sizeof(int32_t));
+        // The bias accounts for the input zero point in all taps, including the taps of the subsequent passes.
+        for (size_t tap = 0; tap < kernel_size; tap++) {
+          const size_t x = tap / h;
+          const size_t y = tap % h;
+          for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
+            const int8_t kv = k[(y * w + x) * c + (cr_block_start + cr_block_offset)];
+            packed_b[cr_block_offset] -= (int32_t) kv * izp;
+          }
+        }
       }
-    } else {
-      size_t n = cr_block_size;
-      do {
-        *((int32_t*) packed_w) = 0;
-        packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
-      } while (--n != 0);
-    }
-    packed_w = (void*) ((uintptr_t) packed_w + (cr - cr_block_size) * sizeof(int32_t));
-    for (size_t x = 0; x < w; x++) {
-      for (size_t y = 0; y < h; y++) {
+      for (size_t tap = tap_start; tap < tap_end; tap++) {
+        const size_t x = tap / h;
+        const size_t y = tap % h;
         for (size_t cr_block_offset = 0; cr_block_offset < cr_block_size; cr_block_offset++) {
           const int8_t kv = k[(y * w + x) * c + (cr_block_start + cr_block_offset)];
-          packed_b[cr_block_offset] -= (int32_t) kv * izp;
           *((int8_t*) packed_w) = kv;
           packed_w = (void*) ((uintptr_t) packed_w + sizeof(int8_t));
         }
         packed_w = (void*) ((uintptr_t) packed_w + (cr - cr_block_size) * sizeof(int8_t));
       }
+      // Skip the padding taps in the last pass.
+      packed_w = (void*) ((uintptr_t) packed_w + (tap_start + tap_tile - tap_end) * cr * sizeof(int8_t));
+      if (tap_end == kernel_size) {
+        // Leave room for the extra per-channel data after the last pass.
+        packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
+      }
     }
-  }
+    tap_start += tap_tile;
+    tap_tile = incremental_tile;
+  } while (tap_start < kernel_size);
 }
 
 void xnn_pack_f32_gemminc_goi_w(
@@ -1672,3 +1973,199 @@ void xnn_pack_f16_vmulcaddc_w(
     packed_w += cr - cr_block_size;
   }
 }
+
+void xnn_init_qc8_scale_fp32_params(
+  size_t channels,
+  size_t channels_tile,
+  size_t stride,
+  const float* scale,
+  void* packed_w)
+{
+  for (size_t tile_start = 0; tile_start < channels; tile_start += channels_tile) {
+    const size_t tile_size = min(channels - tile_start, channels_tile);
+    for (size_t tile_offset = 0; tile_offset < tile_size; tile_offset++) {
+      ((float*) packed_w)[tile_offset] = scale[tile_start + tile_offset];
+    }
+    packed_w = (void*) ((uintptr_t) packed_w + stride);
+  }
+}
+
+struct pack_weights_context {
+  union {
+    xnn_pack_gemm_goi_w_function gemm_goi;
+    xnn_pack_conv_goki_w_function conv_goki;
+  } pack;
+  size_t nc;
+  size_t ks;
+  size_t kc;
+  size_t nr;
+  size_t kr;
+  size_t sr;
+  const void* k;
+  // Stride, in bytes, between unpacked weights of adjacent output channels.
+  size_t k_stride;
+  const void* b;
+  size_t b_stride;
+  void* packed_w;
+  // Stride, in bytes, between packed weights of adjacent output channels.
+  size_t w_stride;
+  // Stride, in bytes, between packed weights of adjacent groups.
+  size_t w_group_stride;
+  size_t extra_bytes;
+  const void* params;
+};
+
+static void pack_gemm_goi_w_task(
+  const struct pack_weights_context* context,
+  size_t group_index,
+  size_t nr_block_start,
+  size_t nr_block_size)
+{
+  const size_t output_channel_start = group_index * context->nc + nr_block_start;
+  const void* b = context->b;
+  if (b != NULL) {
+    b = (const void*) ((uintptr_t) b + output_channel_start * context->b_stride);
+  }
+
+  context->pack.gemm_goi(
+    1, nr_block_size, context->kc,
+    context->nr, context->kr, context->sr,
+    (const void*) ((uintptr_t) context->k + output_channel_start * context->k_stride),
+    b,
+    (void*) ((uintptr_t) context->packed_w + group_index * context->w_group_stride + nr_block_start * context->w_stride),
+    context->extra_bytes,
+    context->params);
+}
+
+static void pack_conv_goki_w_task(
+  const struct pack_weights_context* context,
+  size_t group_index,
+  size_t nr_block_start,
+  size_t nr_block_size)
+{
+  const size_t output_channel_start = group_index * context->nc + nr_block_start;
+  const void* b = context->b;
+  if (b != NULL) {
+    b = (const void*) ((uintptr_t) b + output_channel_start * context->b_stride);
+  }
+
+  context->pack.conv_goki(
+    1, nr_block_size, context->ks, context->kc,
+    context->nr, context->kr, context->sr,
+    (const void*) ((uintptr_t) context->k + output_channel_start * context->k_stride),
+    b,
+    (void*) ((uintptr_t) context->packed_w + group_index * context->w_group_stride + nr_block_start * context->w_stride),
+    context->extra_bytes,
+    context->params);
+}
+
+// Number of output channels packed in one task: a multiple of nr, chosen to give each thread a few tasks.
+static size_t pack_weights_tile(size_t g, size_t nc, size_t nr, size_t num_threads)
+{
+  const size_t target_tiles_per_thread = 4;
+  const size_t num_nr_blocks = divide_round_up(nc, nr);
+  return nr * divide_round_up(g * num_nr_blocks, num_threads * target_tiles_per_thread);
+}
+
+void xnn_parallelize_pack_gemm_goi_w(
+  xnn_pack_gemm_goi_w_function pack_gemm_goi_w,
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const void* k,
+  const void* b,
+  void* packed_w,
+  size_t extra_bytes,
+  const void* params,
+  uint32_t log2_filter_element_size,
+  size_t bias_element_size,
+  size_t w_stride,
+  pthreadpool_t threadpool)
+{
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  if (num_threads <= 1) {
+    pack_gemm_goi_w(g, nc, kc, nr, kr, sr, k, b, packed_w, extra_bytes, params);
+    return;
+  }
+
+  struct pack_weights_context context = {
+    .pack.gemm_goi = pack_gemm_goi_w,
+    .nc = nc,
+    .ks = 1,
+    .kc = kc,
+    .nr = nr,
+    .kr = kr,
+    .sr = sr,
+    .k = k,
+    .k_stride = kc << log2_filter_element_size,
+    .b = b,
+    .b_stride = bias_element_size,
+    .packed_w = packed_w,
+    .w_stride = w_stride,
+    .w_group_stride = round_up(nc, nr) * w_stride,
+    .extra_bytes = extra_bytes,
+    .params = params,
+  };
+  pthreadpool_parallelize_2d_tile_1d(
+    threadpool,
+    (pthreadpool_task_2d_tile_1d_t) pack_gemm_goi_w_task,
+    &context,
+    g, nc,
+    pack_weights_tile(g, nc, nr, num_threads),
+    0 /* flags */);
+}
+
+void xnn_parallelize_pack_conv_goki_w(
+  xnn_pack_conv_goki_w_function pack_conv_goki_w,
+  size_t g,
+  size_t nc,
+  size_t ks,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const void* k,
+  const void* b,
+  void* packed_w,
+  size_t extra_bytes,
+  const void* params,
+  uint32_t log2_filter_element_size,
+  size_t bias_element_size,
+  size_t w_stride,
+  pthreadpool_t threadpool)
+{
+  const size_t num_threads = pthreadpool_get_threads_count(threadpool);
+  if (num_threads <= 1) {
+    pack_conv_goki_w(g, nc, ks, kc, nr, kr, sr, k, b, packed_w, extra_bytes, params);
+    return;
+  }
+
+  struct pack_weights_context context = {
+    .pack.conv_goki = pack_conv_goki_w,
+    .nc = nc,
+    .ks = ks,
+    .kc = kc,
+    .nr = nr,
+    .kr = kr,
+    .sr = sr,
+    .k = k,
+    .k_stride = (ks * kc) << log2_filter_element_size,
+    .b = b,
+    .b_stride = bias_element_size,
+    .packed_w = packed_w,
+    .w_stride = w_stride,
+    .w_group_stride = round_up(nc, nr) * w_stride,
+    .extra_bytes = extra_bytes,
+    .params = params,
+  };
+  pthreadpool_parallelize_2d_tile_1d(
+    threadpool,
+    (pthreadpool_task_2d_tile_1d_t) pack_conv_goki_w_task,
+    &context,
+    g, nc,
+    pack_weights_tile(g, nc, nr, num_threads),
+    0 /* flags */);
+}
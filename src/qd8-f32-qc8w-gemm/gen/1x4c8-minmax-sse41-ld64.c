@@ -0,0 +1,129 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qd8-f32-qc8w-gemm/MRx4c8-sse.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/math.h>
+
+
+void xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x4c8__sse41_ld64(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)],
+    const struct xnn_qd8_quantization_params quantization_params[restrict XNN_MIN_ELEMENTS(1)]) XNN_DISABLE_TSAN
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(int8_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8);
+  const int8_t* a0 = a;
+  float* c0 = c;
+  const struct xnn_qd8_quantization_params* q0 = quantization_params;
+
+  const int32_t vinput_zero_point0 = q0->zero_point;
+  const __m128 vinput_scale0 = _mm_load1_ps(&q0->scale);
+  do {
+    // Packed weights start with negated sums of the weights of each channel, which turn into the input zero point
+    // correction when multiplied by the zero point of the row.
+    const int32_t vksum0 = ((const int32_t*) w)[0];
+    const int32_t vksum1 = ((const int32_t*) w)[1];
+    const int32_t vksum2 = ((const int32_t*) w)[2];
+    const int32_t vksum3 = ((const int32_t*) w)[3];
+    __m128i vacc0x0 = _mm_cvtsi32_si128((int) (vksum0 * vinput_zero_point0));
+    __m128i vacc0x1 = _mm_cvtsi32_si128((int) (vksum1 * vinput_zero_point0));
+    __m128i vacc0x2 = _mm_cvtsi32_si128((int) (vksum2 * vinput_zero_point0));
+    __m128i vacc0x3 = _mm_cvtsi32_si128((int) (vksum3 * vinput_zero_point0));
+    w = (const void*) ((uintptr_t) w + 4 * sizeof(int32_t));
+
+    size_t k = 0;
+    while (k < kc) {
+      const __m128i va0 = _mm_loadl_epi64((const __m128i*) a0);
+      const __m128i vxa0 = _mm_cvtepi8_epi16(va0);
+      a0 += 8;
+
+      const __m128i vb0 = _mm_loadl_epi64((const __m128i*) w);
+      const __m128i vxb0 = _mm_cvtepi8_epi16(vb0);
+
+      vacc0x0 = _mm_add_epi32(vacc0x0, _mm_madd_epi16(vxa0, vxb0));
+      const __m128i vb1 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) w + 8 * sizeof(int8_t)));
+      const __m128i vxb1 = _mm_cvtepi8_epi16(vb1);
+
+      vacc0x1 = _mm_add_epi32(vacc0x1, _mm_madd_epi16(vxa0, vxb1));
+      const __m128i vb2 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) w + 16 * sizeof(int8_t)));
+      const __m128i vxb2 = _mm_cvtepi8_epi16(vb2);
+
+      vacc0x2 = _mm_add_epi32(vacc0x2, _mm_madd_epi16(vxa0, vxb2));
+      const __m128i vb3 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) w + 24 * sizeof(int8_t)));
+      const __m128i vxb3 = _mm_cvtepi8_epi16(vb3);
+
+      vacc0x3 = _mm_add_epi32(vacc0x3, _mm_madd_epi16(vxa0, vxb3));
+
+      w = (const void*) ((uintptr_t) w + 32 * sizeof(int8_t));
+      k += 8 * sizeof(int8_t);
+    }
+
+    const __m128i vacc0x01 = _mm_hadd_epi32(vacc0x0, vacc0x1);
+    const __m128i vacc0x23 = _mm_hadd_epi32(vacc0x2, vacc0x3);
+
+    const __m128i vacc0x0123 = _mm_hadd_epi32(vacc0x01, vacc0x23);
+
+    const __m128 vfilter_scale0123 = _mm_loadu_ps((const float*) w);
+    const __m128 vbias0123 = _mm_loadu_ps((const float*) w + 4);
+    w = (const void*) ((const float*) w + 8);
+
+    __m128 vout0x0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc0x0123), _mm_mul_ps(vfilter_scale0123, vinput_scale0));
+
+    vout0x0123 = _mm_add_ps(vout0x0123, vbias0123);
+
+    const __m128 vmin = _mm_load_ps(params->sse.min);
+    vout0x0123 = _mm_max_ps(vout0x0123, vmin);
+
+    const __m128 vmax = _mm_load_ps(params->sse.max);
+    vout0x0123 = _mm_min_ps(vout0x0123, vmax);
+
+    if XNN_LIKELY(nc >= 4) {
+      _mm_storeu_ps(c0, vout0x0123);
+
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const int8_t*) ((uintptr_t) a0 - kc);
+
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vout0x0123);
+
+        vout0x0123 = _mm_movehl_ps(vout0x0123, vout0x0123);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vout0x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
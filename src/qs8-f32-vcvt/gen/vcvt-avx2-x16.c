@@ -0,0 +1,85 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-f32-vcvt/avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_qs8_f32_vcvt_ukernel__avx2_x16(
+    size_t n,
+    const int8_t* input,
+    float* output,
+    const union xnn_qs8_f32_cvt_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m256i vminus_zero_point = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) params->sse2.minus_zero_point));
+  const __m256 vscale = _mm256_broadcast_ps((const __m128*) params->sse2.scale);
+  for (; n >= 16 * sizeof(int8_t); n -= 16 * sizeof(int8_t)) {
+    __m256i vx01234567 = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*) input));
+    __m256i vx89ABCDEF = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*) (input + 8)));
+    input += 16;
+
+    vx01234567 = _mm256_add_epi32(vx01234567, vminus_zero_point);
+    vx89ABCDEF = _mm256_add_epi32(vx89ABCDEF, vminus_zero_point);
+
+    __m256 vy01234567 = _mm256_cvtepi32_ps(vx01234567);
+    __m256 vy89ABCDEF = _mm256_cvtepi32_ps(vx89ABCDEF);
+
+    vy01234567 = _mm256_mul_ps(vy01234567, vscale);
+    vy89ABCDEF = _mm256_mul_ps(vy89ABCDEF, vscale);
+
+    _mm256_storeu_ps(output, vy01234567);
+    _mm256_storeu_ps(output + 8, vy89ABCDEF);
+    output += 16;
+  }
+  for (; n >= 8 * sizeof(int8_t); n -= 8 * sizeof(int8_t)) {
+    __m256i vx = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*) input));
+    vx = _mm256_add_epi32(vx, vminus_zero_point);
+    input += 8;
+
+    __m256 vy = _mm256_cvtepi32_ps(vx);
+    vy = _mm256_mul_ps(vy, vscale);
+
+    _mm256_storeu_ps(output, vy);
+    output += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(int8_t));
+    assert(n <= 7 * sizeof(int8_t));
+
+    __m256i vx = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*) input));
+    vx = _mm256_add_epi32(vx, vminus_zero_point);
+
+    __m256 vy = _mm256_cvtepi32_ps(vx);
+    vy = _mm256_mul_ps(vy, vscale);
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (n & (4 * sizeof(int8_t))) {
+      _mm_storeu_ps(output, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      output += 4;
+    }
+    if (n & (2 * sizeof(int8_t))) {
+      _mm_storel_pi((__m64*) output, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      output += 2;
+    }
+    if (n & (1 * sizeof(int8_t))) {
+      _mm_store_ss(output, vy_lo);
+    }
+  }
+}
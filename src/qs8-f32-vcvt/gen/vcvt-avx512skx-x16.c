@@ -0,0 +1,60 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-f32-vcvt/avx512skx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_qs8_f32_vcvt_ukernel__avx512skx_x16(
+    size_t n,
+    const int8_t* input,
+    float* output,
+    const union xnn_qs8_f32_cvt_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m512i vminus_zero_point = _mm512_broadcast_i32x4(_mm_load_si128((const __m128i*) params->sse2.minus_zero_point));
+  const __m512 vscale = _mm512_broadcast_f32x4(_mm_load_ps(params->sse2.scale));
+  for (; n >= 16 * sizeof(int8_t); n -= 16 * sizeof(int8_t)) {
+    __m512i vx0123456789ABCDEF = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*) input));
+    input += 16;
+
+    vx0123456789ABCDEF = _mm512_add_epi32(vx0123456789ABCDEF, vminus_zero_point);
+
+    __m512 vy0123456789ABCDEF = _mm512_cvtepi32_ps(vx0123456789ABCDEF);
+
+    vy0123456789ABCDEF = _mm512_mul_ps(vy0123456789ABCDEF, vscale);
+
+    _mm512_storeu_ps(output, vy0123456789ABCDEF);
+    output += 16;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(int8_t));
+    assert(n <= 15 * sizeof(int8_t));
+
+    // Prepare mask for valid elements (depends on n).
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << n) - UINT32_C(1)));
+
+    __m512i vx = _mm512_cvtepi8_epi32(_mm_maskz_loadu_epi8(vmask, input));
+    vx = _mm512_add_epi32(vx, vminus_zero_point);
+
+    __m512 vy = _mm512_cvtepi32_ps(vx);
+    vy = _mm512_mul_ps(vy, vscale);
+
+    _mm512_mask_storeu_ps(output, vmask, vy);
+  }
+}
@@ -0,0 +1,102 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-f32-vcvt/neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_qs8_f32_vcvt_ukernel__neon_x16(
+    size_t n,
+    const int8_t* input,
+    float* output,
+    const union xnn_qs8_f32_cvt_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const int16x8_t vminus_zero_point = vld1q_dup_s16(&params->neon.minus_zero_point);
+  const float32x4_t vscale = vld1q_dup_f32(&params->neon.scale);
+  for (; n >= 16 * sizeof(int8_t); n -= 16 * sizeof(int8_t)) {
+    const int8x16_t vx0 = vld1q_s8(input); input += 16;
+
+    const int16x8_t vhx0 = vaddw_s8(vminus_zero_point, vget_low_s8(vx0));
+    const int16x8_t vhx1 = vaddw_s8(vminus_zero_point, vget_high_s8(vx0));
+
+    const int32x4_t vwx0 = vmovl_s16(vget_low_s16(vhx0));
+    const int32x4_t vwx1 = vmovl_s16(vget_high_s16(vhx0));
+    const int32x4_t vwx2 = vmovl_s16(vget_low_s16(vhx1));
+    const int32x4_t vwx3 = vmovl_s16(vget_high_s16(vhx1));
+
+    float32x4_t vy0 = vcvtq_f32_s32(vwx0);
+    float32x4_t vy1 = vcvtq_f32_s32(vwx1);
+    float32x4_t vy2 = vcvtq_f32_s32(vwx2);
+    float32x4_t vy3 = vcvtq_f32_s32(vwx3);
+
+    vy0 = vmulq_f32(vy0, vscale);
+    vy1 = vmulq_f32(vy1, vscale);
+    vy2 = vmulq_f32(vy2, vscale);
+    vy3 = vmulq_f32(vy3, vscale);
+
+    vst1q_f32(output, vy0); output += 4;
+    vst1q_f32(output, vy1); output += 4;
+    vst1q_f32(output, vy2); output += 4;
+    vst1q_f32(output, vy3); output += 4;
+  }
+  for (; n >= 8 * sizeof(int8_t); n -= 8 * sizeof(int8_t)) {
+    const int8x8_t vx = vld1_s8(input); input += 8;
+
+    const int16x8_t vhx = vaddw_s8(vminus_zero_point, vx);
+
+    const int32x4_t vwx_lo = vmovl_s16(vget_low_s16(vhx));
+    const int32x4_t vwx_hi = vmovl_s16(vget_high_s16(vhx));
+
+    float32x4_t vy_lo = vcvtq_f32_s32(vwx_lo);
+    float32x4_t vy_hi = vcvtq_f32_s32(vwx_hi);
+
+    vy_lo = vmulq_f32(vy_lo, vscale);
+    vy_hi = vmulq_f32(vy_hi, vscale);
+
+    vst1q_f32(output, vy_lo); output += 4;
+    vst1q_f32(output, vy_hi); output += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(int8_t));
+    assert(n <= 7 * sizeof(int8_t));
+
+    const int8x8_t vx = vld1_s8(input);
+
+    const int16x8_t vhx = vaddw_s8(vminus_zero_point, vx);
+
+    const int32x4_t vwx_lo = vmovl_s16(vget_low_s16(vhx));
+    const int32x4_t vwx_hi = vmovl_s16(vget_high_s16(vhx));
+
+    float32x4_t vy = vcvtq_f32_s32(vwx_lo);
+    vy = vmulq_f32(vy, vscale);
+
+    if (n & (4 * sizeof(int8_t))) {
+      vst1q_f32(output, vy); output += 4;
+      vy = vcvtq_f32_s32(vwx_hi);
+      vy = vmulq_f32(vy, vscale);
+    }
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (n & (2 * sizeof(int8_t))) {
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (n & (1 * sizeof(int8_t))) {
+      vst1_lane_f32(output, vy_lo, 0);
+    }
+  }
+}
@@ -0,0 +1,40 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-f32-vcvt/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_qs8_f32_vcvt_ukernel__scalar_x1(
+    size_t n,
+    const int8_t* input,
+    float* output,
+    const union xnn_qs8_f32_cvt_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const int32_t vzero_point = params->scalar.zero_point;
+  const float vscale = params->scalar.scale;
+
+  do {
+    int32_t vx = *input++;
+    vx -= vzero_point;
+
+    float vy = (float) vx;
+    vy *= vscale;
+    *output++ = vy;
+
+    n -= sizeof(int8_t);
+  } while (n != 0);
+}
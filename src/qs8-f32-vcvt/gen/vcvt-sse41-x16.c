@@ -0,0 +1,90 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-f32-vcvt/sse.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_qs8_f32_vcvt_ukernel__sse41_x16(
+    size_t n,
+    const int8_t* input,
+    float* output,
+    const union xnn_qs8_f32_cvt_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const __m128i vminus_zero_point = _mm_load_si128((const __m128i*) params->sse2.minus_zero_point);
+  const __m128 vscale = _mm_load_ps(params->sse2.scale);
+  for (; n >= 16 * sizeof(int8_t); n -= 16 * sizeof(int8_t)) {
+    __m128i vx0123 = _mm_cvtepi8_epi32(_mm_loadu_si32(input));
+    __m128i vx4567 = _mm_cvtepi8_epi32(_mm_loadu_si32(input + 4));
+    __m128i vx89AB = _mm_cvtepi8_epi32(_mm_loadu_si32(input + 8));
+    __m128i vxCDEF = _mm_cvtepi8_epi32(_mm_loadu_si32(input + 12));
+    input += 16;
+
+    vx0123 = _mm_add_epi32(vx0123, vminus_zero_point);
+    vx4567 = _mm_add_epi32(vx4567, vminus_zero_point);
+    vx89AB = _mm_add_epi32(vx89AB, vminus_zero_point);
+    vxCDEF = _mm_add_epi32(vxCDEF, vminus_zero_point);
+
+    __m128 vy0123 = _mm_cvtepi32_ps(vx0123);
+    __m128 vy4567 = _mm_cvtepi32_ps(vx4567);
+    __m128 vy89AB = _mm_cvtepi32_ps(vx89AB);
+    __m128 vyCDEF = _mm_cvtepi32_ps(vxCDEF);
+
+    vy0123 = _mm_mul_ps(vy0123, vscale);
+    vy4567 = _mm_mul_ps(vy4567, vscale);
+    vy89AB = _mm_mul_ps(vy89AB, vscale);
+    vyCDEF = _mm_mul_ps(vyCDEF, vscale);
+
+    _mm_storeu_ps(output, vy0123);
+    _mm_storeu_ps(output + 4, vy4567);
+    _mm_storeu_ps(output + 8, vy89AB);
+    _mm_storeu_ps(output + 12, vyCDEF);
+    output += 16;
+  }
+  for (; n >= 4 * sizeof(int8_t); n -= 4 * sizeof(int8_t)) {
+    __m128i vx = _mm_cvtepi8_epi32(_mm_loadu_si32(input));
+    vx = _mm_add_epi32(vx, vminus_zero_point);
+    input += 4;
+
+    __m128 vy = _mm_cvtepi32_ps(vx);
+    vy = _mm_mul_ps(vy, vscale);
+
+    _mm_storeu_ps(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(int8_t));
+    assert(n <= 3 * sizeof(int8_t));
+
+    __m128i vx = _mm_cvtepi8_epi32(_mm_loadu_si32(input));
+    vx = _mm_add_epi32(vx, vminus_zero_point);
+
+    __m128 vy = _mm_cvtepi32_ps(vx);
+    vy = _mm_mul_ps(vy, vscale);
+
+    if (n & (2 * sizeof(int8_t))) {
+      _mm_storel_pi((__m64*) output, vy);
+      vy = _mm_movehl_ps(vy, vy);
+      output += 2;
+    }
+    if (n & (1 * sizeof(int8_t))) {
+      _mm_store_ss(output, vy);
+    }
+  }
+}
@@ -0,0 +1,104 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-f32-vcvt/wasmsimd.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <wasm_simd128.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_qs8_f32_vcvt_ukernel__wasmsimd_x16(
+    size_t n,
+    const int8_t* input,
+    float* output,
+    const union xnn_qs8_f32_cvt_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const v128_t vminus_zero_point = wasm_v128_load(params->wasmsimd.minus_zero_point);
+  const v128_t vscale = wasm_v128_load(params->wasmsimd.scale);
+  for (; n >= 16 * sizeof(int8_t); n -= 16 * sizeof(int8_t)) {
+    v128_t vx0 = wasm_i16x8_load_8x8(input);
+    v128_t vx1 = wasm_i16x8_load_8x8(input + 8);
+    input += 16;
+
+    vx0 = wasm_i16x8_add(vx0, vminus_zero_point);
+    vx1 = wasm_i16x8_add(vx1, vminus_zero_point);
+
+    v128_t vy0 = wasm_i32x4_widen_low_i16x8(vx0);
+    v128_t vy1 = wasm_i32x4_widen_high_i16x8(vx0);
+    v128_t vy2 = wasm_i32x4_widen_low_i16x8(vx1);
+    v128_t vy3 = wasm_i32x4_widen_high_i16x8(vx1);
+
+    vy0 = wasm_f32x4_convert_i32x4(vy0);
+    vy1 = wasm_f32x4_convert_i32x4(vy1);
+    vy2 = wasm_f32x4_convert_i32x4(vy2);
+    vy3 = wasm_f32x4_convert_i32x4(vy3);
+
+    vy0 = wasm_f32x4_mul(vy0, vscale);
+    vy1 = wasm_f32x4_mul(vy1, vscale);
+    vy2 = wasm_f32x4_mul(vy2, vscale);
+    vy3 = wasm_f32x4_mul(vy3, vscale);
+
+    wasm_v128_store(output, vy0);
+    wasm_v128_store(output + 4, vy1);
+    wasm_v128_store(output + 8, vy2);
+    wasm_v128_store(output + 12, vy3);
+    output += 16;
+  }
+  for (; n >= 8 * sizeof(int8_t); n -= 8 * sizeof(int8_t)) {
+    v128_t vx = wasm_i16x8_load_8x8(input);
+    vx = wasm_i16x8_add(vx, vminus_zero_point);
+    input += 8;
+
+    v128_t vy_lo = wasm_i32x4_widen_low_i16x8(vx);
+    v128_t vy_hi = wasm_i32x4_widen_high_i16x8(vx);
+
+    vy_lo = wasm_f32x4_convert_i32x4(vy_lo);
+    vy_hi = wasm_f32x4_convert_i32x4(vy_hi);
+
+    vy_lo = wasm_f32x4_mul(vy_lo, vscale);
+    vy_hi = wasm_f32x4_mul(vy_hi, vscale);
+
+    wasm_v128_store(output, vy_lo);
+    wasm_v128_store(output + 4, vy_hi);
+    output += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(int8_t));
+    assert(n <= 7 * sizeof(int8_t));
+
+    v128_t vx = wasm_i16x8_load_8x8(input);
+    vx = wasm_i16x8_add(vx, vminus_zero_point);
+
+    v128_t vy = wasm_i32x4_widen_low_i16x8(vx);
+    vy = wasm_f32x4_convert_i32x4(vy);
+    vy = wasm_f32x4_mul(vy, vscale);
+
+    if (n & (4 * sizeof(int8_t))) {
+      wasm_v128_store(output, vy); output += 4;
+      vy = wasm_i32x4_widen_high_i16x8(vx);
+      vy = wasm_f32x4_convert_i32x4(vy);
+      vy = wasm_f32x4_mul(vy, vscale);
+    }
+    if (n & (2 * sizeof(int8_t))) {
+      *((double*) output) = wasm_f64x2_extract_lane(vy, 0);
+      vy = wasm_v32x4_shuffle(vy, vy, 2, 3, 2, 3);
+      output += 2;
+    }
+    if (n & (1 * sizeof(int8_t))) {
+      *output = wasm_f32x4_extract_lane(vy, 0);
+    }
+  }
+}
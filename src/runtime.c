@@ -3,11 +3,14 @@
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
 
+#include <assert.h>
 #include <math.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
@@ -17,8 +20,44 @@
 #include <xnnpack/operator.h>
 #include <xnnpack/params.h>
 #include <xnnpack/subgraph.h>
+#include <xnnpack/timer.h>
+#include <xnnpack/weights-cache.h>
 
 
+enum xnn_status xnn_create_workspace(xnn_workspace_t* workspace_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create workspace: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  struct xnn_workspace* workspace = xnn_allocate_zero_memory(sizeof(struct xnn_workspace));
+  if (workspace == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for workspace descriptor", sizeof(struct xnn_workspace));
+    return xnn_status_out_of_memory;
+  }
+  workspace->ref_count = 1;
+  *workspace_out = workspace;
+  return xnn_status_success;
+}
+
+static void xnn_retain_workspace(xnn_workspace_t workspace)
+{
+  workspace->ref_count++;
+}
+
+enum xnn_status xnn_release_workspace(xnn_workspace_t workspace)
+{
+  if (workspace != NULL) {
+    assert(workspace->ref_count != 0);
+    if (--workspace->ref_count == 0) {
+      xnn_release_simd_memory(workspace->data);
+      xnn_release_memory(workspace);
+    }
+  }
+  return xnn_status_success;
+}
+
 enum xnn_status xnn_create_runtime(
   xnn_subgraph_t subgraph,
   xnn_runtime_t* runtime_out)
@@ -26,6 +65,15 @@ enum xnn_status xnn_create_runtime(
   return xnn_create_runtime_v2(subgraph, NULL /* threadpool */, 0 /* flags */, runtime_out);
 }
 
+enum xnn_status xnn_create_runtime_v2(
+  xnn_subgraph_t subgraph,
+  pthreadpool_t threadpool,
+  uint32_t flags,
+  xnn_runtime_t* runtime_out)
+{
+  return xnn_create_runtime_v3(subgraph, NULL /* workspace */, threadpool, flags, runtime_out);
+}
+
 // Product of all shape dimensions
 static size_t product_all_dims(
   const struct xnn_shape shape[restrict XNN_MIN_ELEMENTS(1)])
@@ -48,8 +96,645 @@ static size_t product_non_channel_dims(
   return batch_size;
 }
 
-enum xnn_status xnn_create_runtime_v2(
+// Size in bytes of a single element of the datatype.
+static size_t get_element_size(enum xnn_datatype datatype)
+{
+  switch (datatype) {
+    case xnn_datatype_fp16:
+      return 2;
+    case xnn_datatype_fp32:
+    case xnn_datatype_qint32:
+      return 4;
+    case xnn_datatype_qint8:
+      return 1;
+    case xnn_datatype_invalid:
+      break;
+  }
+  XNN_UNREACHABLE;
+}
+
+// Check if the value lives in the runtime workspace, i.e. it is neither static nor external to the runtime.
+static bool is_workspace_value(
+  const struct xnn_value value[restrict XNN_MIN_ELEMENTS(1)])
+{
+  return value->data == NULL && (value->flags & (XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT)) == 0;
+}
+
+// Output dimension of a Convolution or Pooling Node for the padded input dimension.
+static size_t compute_output_dimension(
+  size_t padded_input_dimension,
+  size_t kernel_dimension,
+  size_t dilation_dimension,
+  size_t stride_dimension)
+{
+  const size_t effective_kernel_dimension = (kernel_dimension - 1) * dilation_dimension + 1;
+  return doz(padded_input_dimension, effective_kernel_dimension) / stride_dimension + 1;
+}
+
+// Output dimension of a Deconvolution Node for the input dimension.
+static size_t compute_deconvolution_output_dimension(
+  size_t input_dimension,
+  size_t padding_dimension,
+  size_t adjustment_dimension,
+  size_t kernel_dimension,
+  size_t dilation_dimension,
+  size_t stride_dimension)
+{
+  const size_t effective_kernel_dimension = (kernel_dimension - 1) * dilation_dimension + 1;
+  return doz(stride_dimension * (input_dimension - 1) + adjustment_dimension + effective_kernel_dimension,
+    padding_dimension);
+}
+
+// Compute the shape of the output of a binary elementwise Node with broadcasting of the inputs.
+static enum xnn_status infer_broadcast_shape(
+  const struct xnn_node* node,
+  const struct xnn_shape* input1_shape,
+  const struct xnn_shape* input2_shape,
+  struct xnn_shape* output_shape)
+{
+  const size_t num_dims = max(input1_shape->num_dims, input2_shape->num_dims);
+  for (size_t i = 0; i < num_dims; i++) {
+    // Dimensions are aligned to the innermost one, and missing outer dimensions are broadcasted.
+    const size_t input1_dim = i < input1_shape->num_dims ? input1_shape->dim[input1_shape->num_dims - 1 - i] : 1;
+    const size_t input2_dim = i < input2_shape->num_dims ? input2_shape->dim[input2_shape->num_dims - 1 - i] : 1;
+    if (input1_dim != input2_dim && input1_dim != 1 && input2_dim != 1) {
+      xnn_log_error(
+        "failed to reshape %s operator: input dimensions %zu and %zu are incompatible",
+        xnn_node_type_to_string(node->type), input1_dim, input2_dim);
+      return xnn_status_invalid_parameter;
+    }
+    output_shape->dim[num_dims - 1 - i] = input1_dim == 1 ? input2_dim : input1_dim;
+  }
+  output_shape->num_dims = num_dims;
+  return xnn_status_success;
+}
+
+// Propagate the shapes of the Node inputs to the shapes of its outputs.
+static enum xnn_status infer_output_shapes(
+  const struct xnn_node* node,
+  struct xnn_value* values)
+{
+  if (node->type == xnn_node_type_invalid) {
+    // Node was fused
+    return xnn_status_success;
+  }
+
+  const struct xnn_shape* input_shape = &values[node->inputs[0]].shape;
+  struct xnn_shape* output_shape = &values[node->outputs[0]].shape;
+  switch (node->type) {
+    case xnn_node_type_abs:
+    case xnn_node_type_bankers_rounding:
+    case xnn_node_type_ceiling:
+    case xnn_node_type_clamp:
+    case xnn_node_type_convert:
+    case xnn_node_type_copy:
+    case xnn_node_type_elu:
+    case xnn_node_type_floor:
+    case xnn_node_type_hardswish:
+    case xnn_node_type_leaky_relu:
+    case xnn_node_type_negate:
+    case xnn_node_type_prelu:
+    case xnn_node_type_sigmoid:
+    case xnn_node_type_softmax:
+    case xnn_node_type_square:
+    case xnn_node_type_square_root:
+      *output_shape = *input_shape;
+      break;
+    case xnn_node_type_concatenate:
+      // Only the innermost (channel) dimension differs between the inputs and the output, and it doesn't change.
+      memcpy(output_shape->dim, input_shape->dim, (input_shape->num_dims - 1) * sizeof(size_t));
+      break;
+    case xnn_node_type_split:
+      for (uint32_t i = 0; i < node->num_outputs; i++) {
+        struct xnn_value* output_value = &values[node->outputs[i]];
+        if (output_value->type == xnn_value_type_invalid) {
+          // Output is not used.
+          continue;
+        }
+        memcpy(output_value->shape.dim, input_shape->dim, (input_shape->num_dims - 1) * sizeof(size_t));
+      }
+      break;
+    case xnn_node_type_add2:
+    case xnn_node_type_divide:
+    case xnn_node_type_maximum2:
+    case xnn_node_type_minimum2:
+    case xnn_node_type_multiply2:
+    case xnn_node_type_squared_difference:
+    case xnn_node_type_subtract:
+      return infer_broadcast_shape(node, input_shape, &values[node->inputs[1]].shape, output_shape);
+    case xnn_node_type_batch_matrix_multiply:
+    {
+      // Batch dimensions and M come from the first input, and N comes from the second input.
+      const struct xnn_shape* input2_shape = &values[node->inputs[1]].shape;
+      const size_t num_dims = input_shape->num_dims;
+      memcpy(output_shape->dim, input_shape->dim, (num_dims - 1) * sizeof(size_t));
+      output_shape->dim[num_dims - 1] =
+        (node->flags & XNN_FLAG_TRANSPOSE_B) ? input2_shape->dim[num_dims - 2] : input2_shape->dim[num_dims - 1];
+      break;
+    }
+    case xnn_node_type_argmax_pooling_2d:
+      output_shape->dim[0] = input_shape->dim[0];
+      if (node->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) {
+        output_shape->dim[1] = divide_round_up(input_shape->dim[1], node->params.pooling_2d.pooling_height);
+        output_shape->dim[2] = divide_round_up(input_shape->dim[2], node->params.pooling_2d.pooling_width);
+      } else {
+        output_shape->dim[1] =
+          (node->params.pooling_2d.padding_top + input_shape->dim[1] + node->params.pooling_2d.padding_bottom) /
+            node->params.pooling_2d.pooling_height;
+        output_shape->dim[2] =
+          (node->params.pooling_2d.padding_left + input_shape->dim[2] + node->params.pooling_2d.padding_right) /
+            node->params.pooling_2d.pooling_width;
+      }
+      // Index output has the same shape as the pooled output.
+      memcpy(values[node->outputs[1]].shape.dim, output_shape->dim, 3 * sizeof(size_t));
+      break;
+    case xnn_node_type_average_pooling_2d:
+    case xnn_node_type_max_pooling_2d:
+    {
+      const bool is_max_pooling = node->type == xnn_node_type_max_pooling_2d;
+      output_shape->dim[0] = input_shape->dim[0];
+      if (node->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) {
+        output_shape->dim[1] = divide_round_up(input_shape->dim[1], node->params.pooling_2d.stride_height);
+        output_shape->dim[2] = divide_round_up(input_shape->dim[2], node->params.pooling_2d.stride_width);
+      } else {
+        output_shape->dim[1] = compute_output_dimension(
+          node->params.pooling_2d.padding_top + input_shape->dim[1] + node->params.pooling_2d.padding_bottom,
+          node->params.pooling_2d.pooling_height,
+          is_max_pooling ? node->params.pooling_2d.dilation_height : 1,
+          node->params.pooling_2d.stride_height);
+        output_shape->dim[2] = compute_output_dimension(
+          node->params.pooling_2d.padding_left + input_shape->dim[2] + node->params.pooling_2d.padding_right,
+          node->params.pooling_2d.pooling_width,
+          is_max_pooling ? node->params.pooling_2d.dilation_width : 1,
+          node->params.pooling_2d.stride_width);
+      }
+      break;
+    }
+    case xnn_node_type_convolution_2d:
+      output_shape->dim[0] = input_shape->dim[0];
+      if (node->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) {
+        output_shape->dim[1] = divide_round_up(input_shape->dim[1], node->params.convolution_2d.subsampling_height);
+        output_shape->dim[2] = divide_round_up(input_shape->dim[2], node->params.convolution_2d.subsampling_width);
+      } else {
+        output_shape->dim[1] = compute_output_dimension(
+          node->params.convolution_2d.input_padding_top + input_shape->dim[1] +
+            node->params.convolution_2d.input_padding_bottom,
+          node->params.convolution_2d.kernel_height,
+          node->params.convolution_2d.dilation_height,
+          node->params.convolution_2d.subsampling_height);
+        output_shape->dim[2] = compute_output_dimension(
+          node->params.convolution_2d.input_padding_left + input_shape->dim[2] +
+            node->params.convolution_2d.input_padding_right,
+          node->params.convolution_2d.kernel_width,
+          node->params.convolution_2d.dilation_width,
+          node->params.convolution_2d.subsampling_width);
+      }
+      break;
+    case xnn_node_type_deconvolution_2d:
+    {
+      size_t padding_height = node->params.deconvolution_2d.padding_top + node->params.deconvolution_2d.padding_bottom;
+      size_t padding_width = node->params.deconvolution_2d.padding_left + node->params.deconvolution_2d.padding_right;
+      if (node->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) {
+        // Same as the padding computed in the setup of the Deconvolution operator.
+        padding_height = doz(
+          (node->params.deconvolution_2d.kernel_height - 1) * node->params.deconvolution_2d.dilation_height,
+          (input_shape->dim[1] - 1) % node->params.deconvolution_2d.upsampling_height);
+        padding_width = doz(
+          (node->params.deconvolution_2d.kernel_width - 1) * node->params.deconvolution_2d.dilation_width,
+          (input_shape->dim[2] - 1) % node->params.deconvolution_2d.upsampling_width);
+      }
+      output_shape->dim[0] = input_shape->dim[0];
+      output_shape->dim[1] = compute_deconvolution_output_dimension(
+        input_shape->dim[1], padding_height,
+        node->params.deconvolution_2d.adjustment_height,
+        node->params.deconvolution_2d.kernel_height,
+        node->params.deconvolution_2d.dilation_height,
+        node->params.deconvolution_2d.upsampling_height);
+      output_shape->dim[2] = compute_deconvolution_output_dimension(
+        input_shape->dim[2], padding_width,
+        node->params.deconvolution_2d.adjustment_width,
+        node->params.deconvolution_2d.kernel_width,
+        node->params.deconvolution_2d.dilation_width,
+        node->params.deconvolution_2d.upsampling_width);
+      break;
+    }
+    case xnn_node_type_depthwise_convolution_2d:
+      output_shape->dim[0] = input_shape->dim[0];
+      if (node->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) {
+        output_shape->dim[1] =
+          divide_round_up(input_shape->dim[1], node->params.depthwise_convolution_2d.subsampling_height);
+        output_shape->dim[2] =
+          divide_round_up(input_shape->dim[2], node->params.depthwise_convolution_2d.subsampling_width);
+      } else {
+        output_shape->dim[1] = compute_output_dimension(
+          node->params.depthwise_convolution_2d.input_padding_top + input_shape->dim[1] +
+            node->params.depthwise_convolution_2d.input_padding_bottom,
+          node->params.depthwise_convolution_2d.kernel_height,
+          node->params.depthwise_convolution_2d.dilation_height,
+          node->params.depthwise_convolution_2d.subsampling_height);
+        output_shape->dim[2] = compute_output_dimension(
+          node->params.depthwise_convolution_2d.input_padding_left + input_shape->dim[2] +
+            node->params.depthwise_convolution_2d.input_padding_right,
+          node->params.depthwise_convolution_2d.kernel_width,
+          node->params.depthwise_convolution_2d.dilation_width,
+          node->params.depthwise_convolution_2d.subsampling_width);
+      }
+      break;
+    case xnn_node_type_depth_to_space:
+      output_shape->dim[0] = input_shape->dim[0];
+      output_shape->dim[1] = input_shape->dim[1] * node->params.depth_to_space.block_size;
+      output_shape->dim[2] = input_shape->dim[2] * node->params.depth_to_space.block_size;
+      break;
+    case xnn_node_type_fully_connected:
+    {
+      const size_t num_input_elements = product_all_dims(input_shape);
+      const size_t input_channels = values[node->inputs[1]].shape.dim[1];
+      if (num_input_elements % input_channels != 0) {
+        xnn_log_error(
+          "failed to reshape %s operator: %zu input elements are not divisible by %zu input channels",
+          xnn_node_type_to_string(node->type), num_input_elements, input_channels);
+        return xnn_status_invalid_parameter;
+      }
+      // The last (output channel) dimension doesn't change.
+      if (output_shape->num_dims == input_shape->num_dims && input_shape->dim[input_shape->num_dims - 1] == input_channels) {
+        memcpy(output_shape->dim, input_shape->dim, (input_shape->num_dims - 1) * sizeof(size_t));
+      } else if (output_shape->num_dims == 2) {
+        output_shape->dim[0] = num_input_elements / input_channels;
+      } else {
+        xnn_log_error(
+          "failed to reshape %s operator: can't infer %zu-dimensional output shape from %zu-dimensional input shape",
+          xnn_node_type_to_string(node->type), output_shape->num_dims, input_shape->num_dims);
+        return xnn_status_unsupported_parameter;
+      }
+      break;
+    }
+    case xnn_node_type_global_average_pooling_2d:
+    case xnn_node_type_static_resize_bilinear_2d:
+      output_shape->dim[0] = input_shape->dim[0];
+      break;
+    case xnn_node_type_static_constant_pad:
+      for (size_t i = 0; i < input_shape->num_dims; i++) {
+        output_shape->dim[i] =
+          node->params.static_pad.pre_paddings[i] + input_shape->dim[i] + node->params.static_pad.post_paddings[i];
+      }
+      break;
+    case xnn_node_type_static_reshape:
+    {
+      // All output dimensions except for the first (batch) one are static.
+      const size_t num_input_elements = product_all_dims(input_shape);
+      const size_t num_non_batch_elements = product_all_dims(output_shape) / output_shape->dim[0];
+      if (num_input_elements % num_non_batch_elements != 0) {
+        xnn_log_error(
+          "failed to reshape %s operator: %zu input elements are not divisible by %zu elements in non-batch dimensions",
+          xnn_node_type_to_string(node->type), num_input_elements, num_non_batch_elements);
+        return xnn_status_invalid_parameter;
+      }
+      output_shape->dim[0] = num_input_elements / num_non_batch_elements;
+      break;
+    }
+    case xnn_node_type_static_transpose:
+      for (size_t i = 0; i < input_shape->num_dims; i++) {
+        output_shape->dim[i] = input_shape->dim[node->params.static_transpose.perm[i]];
+      }
+      break;
+    case xnn_node_type_unpooling_2d:
+      output_shape->dim[0] = input_shape->dim[0];
+      output_shape->dim[1] = doz(input_shape->dim[1] * node->params.pooling_2d.pooling_height,
+        node->params.pooling_2d.padding_top + node->params.pooling_2d.padding_bottom);
+      output_shape->dim[2] = doz(input_shape->dim[2] * node->params.pooling_2d.pooling_width,
+        node->params.pooling_2d.padding_left + node->params.pooling_2d.padding_right);
+      break;
+    case xnn_node_type_invalid:
+      XNN_UNREACHABLE;
+  }
+  return xnn_status_success;
+}
+
+// Initialize the shape parameters of the operator for the current shapes of the Node inputs and outputs.
+static void update_operator_shapes(
+  struct xnn_operator_data* opdata,
+  const struct xnn_node* node,
+  const struct xnn_value* values)
+{
+  switch (node->type) {
+    case xnn_node_type_abs:
+    case xnn_node_type_bankers_rounding:
+    case xnn_node_type_ceiling:
+    case xnn_node_type_clamp:
+    case xnn_node_type_convert:
+    case xnn_node_type_copy:
+    case xnn_node_type_elu:
+    case xnn_node_type_floor:
+    case xnn_node_type_hardswish:
+    case xnn_node_type_leaky_relu:
+    case xnn_node_type_negate:
+    case xnn_node_type_prelu:
+    case xnn_node_type_sigmoid:
+    case xnn_node_type_softmax:
+    case xnn_node_type_square:
+    case xnn_node_type_square_root:
+      opdata->batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
+      break;
+    case xnn_node_type_add2:
+    case xnn_node_type_multiply2:
+      opdata->shape1.num_dims = values[node->inputs[0]].shape.num_dims;
+      opdata->shape2.num_dims = values[node->inputs[1]].shape.num_dims;
+      if (values[node->outputs[0]].layout == xnn_layout_type_nchw) {
+        assert(values[node->inputs[0]].layout == xnn_layout_type_nchw);
+        assert(values[node->inputs[1]].layout == xnn_layout_type_nchw);
+        opdata->shape1.dim[0] = values[node->inputs[0]].shape.dim[0];
+        opdata->shape1.dim[1] = values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1];
+        if (values[node->inputs[0]].shape.num_dims > 2) {
+          memcpy(&opdata->shape1.dim[2], &values[node->inputs[0]].shape.dim[1], (values[node->inputs[0]].shape.num_dims - 2) * sizeof(size_t));
+        }
+        opdata->shape2.dim[0] = values[node->inputs[1]].shape.dim[0];
+        opdata->shape2.dim[1] = values[node->inputs[1]].shape.dim[values[node->inputs[0]].shape.num_dims - 1];
+        if (values[node->inputs[0]].shape.num_dims > 2) {
+          memcpy(&opdata->shape2.dim[2], &values[node->inputs[1]].shape.dim[1], (values[node->inputs[1]].shape.num_dims - 2) * sizeof(size_t));
+        }
+      } else {
+        assert(values[node->outputs[0]].layout == xnn_layout_type_nhwc);
+        assert(values[node->inputs[0]].layout == xnn_layout_type_nhwc);
+        assert(values[node->inputs[1]].layout == xnn_layout_type_nhwc);
+        memcpy(opdata->shape1.dim, values[node->inputs[0]].shape.dim, values[node->inputs[0]].shape.num_dims * sizeof(size_t));
+        memcpy(opdata->shape2.dim, values[node->inputs[1]].shape.dim, values[node->inputs[1]].shape.num_dims * sizeof(size_t));
+      }
+      break;
+    case xnn_node_type_divide:
+    case xnn_node_type_maximum2:
+    case xnn_node_type_minimum2:
+    case xnn_node_type_squared_difference:
+    case xnn_node_type_subtract:
+      opdata->shape1.num_dims = values[node->inputs[0]].shape.num_dims;
+      opdata->shape2.num_dims = values[node->inputs[1]].shape.num_dims;
+      memcpy(opdata->shape1.dim, values[node->inputs[0]].shape.dim, values[node->inputs[0]].shape.num_dims * sizeof(size_t));
+      memcpy(opdata->shape2.dim, values[node->inputs[1]].shape.dim, values[node->inputs[1]].shape.num_dims * sizeof(size_t));
+      break;
+    case xnn_node_type_argmax_pooling_2d:
+    case xnn_node_type_average_pooling_2d:
+    case xnn_node_type_convolution_2d:
+    case xnn_node_type_deconvolution_2d:
+    case xnn_node_type_depthwise_convolution_2d:
+    case xnn_node_type_max_pooling_2d:
+    case xnn_node_type_unpooling_2d:
+      opdata->batch_size = values[node->inputs[0]].shape.dim[0];
+      opdata->input_height = values[node->inputs[0]].shape.dim[1];
+      opdata->input_width = values[node->inputs[0]].shape.dim[2];
+      break;
+    case xnn_node_type_depth_to_space:
+    case xnn_node_type_static_resize_bilinear_2d:
+      opdata->batch_size = values[node->inputs[0]].shape.dim[0];
+      opdata->input_height = values[node->inputs[0]].shape.dim[1];
+      opdata->input_width = values[node->inputs[0]].shape.dim[2];
+      opdata->output_height = values[node->outputs[0]].shape.dim[1];
+      opdata->output_width = values[node->outputs[0]].shape.dim[2];
+      break;
+    case xnn_node_type_fully_connected:
+      opdata->batch_size = product_all_dims(&values[node->inputs[0]].shape) / values[node->inputs[1]].shape.dim[1];
+      break;
+    case xnn_node_type_global_average_pooling_2d:
+      opdata->batch_size = values[node->inputs[0]].shape.dim[0];
+      opdata->input_width = values[node->inputs[0]].shape.dim[1] * values[node->inputs[0]].shape.dim[2];
+      break;
+    case xnn_node_type_batch_matrix_multiply:
+    {
+      const struct xnn_shape* input1_shape = &values[node->inputs[0]].shape;
+      opdata->batch_size = 1;
+      for (size_t i = 0; i + 2 < input1_shape->num_dims; i++) {
+        opdata->batch_size *= input1_shape->dim[i];
+      }
+      opdata->shape1 = *input1_shape;
+      opdata->shape2 = values[node->inputs[1]].shape;
+      break;
+    }
+    case xnn_node_type_static_constant_pad:
+    case xnn_node_type_static_transpose:
+      opdata->shape1 = values[node->inputs[0]].shape;
+      break;
+    case xnn_node_type_static_reshape:
+      opdata->batch_size = product_all_dims(&values[node->inputs[0]].shape);
+      break;
+    case xnn_node_type_concatenate:
+    case xnn_node_type_invalid:
+    case xnn_node_type_split:
+      // Nodes without an operator.
+      XNN_UNREACHABLE;
+  }
+}
+
+// Assign each operator an execution level above the levels of the operators which produce its inputs, so that operators
+// on the same level are independent of each other, and group the operators by level.
+static enum xnn_status plan_operator_levels(
+  xnn_runtime_t runtime,
+  const struct xnn_subgraph* subgraph)
+{
+  const size_t num_ops = runtime->num_ops;
+  runtime->op_levels = xnn_allocate_zero_memory(sizeof(uint32_t) * num_ops);
+  runtime->level_ops = xnn_allocate_zero_memory(sizeof(uint32_t) * num_ops);
+  runtime->level_offsets = xnn_allocate_zero_memory(sizeof(uint32_t) * (num_ops + 1));
+  runtime->level_status = xnn_allocate_zero_memory(sizeof(enum xnn_status) * num_ops);
+  if (runtime->op_levels == NULL || runtime->level_ops == NULL || runtime->level_offsets == NULL ||
+      runtime->level_status == NULL)
+  {
+    xnn_log_error("failed to allocate %zu bytes for operator levels",
+      sizeof(uint32_t) * (num_ops * 3 + 1) + sizeof(enum xnn_status) * num_ops);
+    return xnn_status_out_of_memory;
+  }
+
+  uint32_t* op_levels = runtime->op_levels;
+  uint32_t num_levels = 0;
+  for (size_t i = 0; i < num_ops; i++) {
+    const struct xnn_node* node = subgraph->nodes + i;
+    uint32_t level = 0;
+    for (uint32_t j = 0; j < node->num_inputs; j++) {
+      const uint32_t producer_id = subgraph->values[node->inputs[j]].producer;
+      if (producer_id == XNN_INVALID_NODE_ID) {
+        // Static or external input.
+        continue;
+      }
+      assert(producer_id < i);
+      // Nodes without an operator, e.g. Static Reshape aliasing its input, produce their outputs on their own level.
+      const bool producer_has_operator = runtime->opdata[producer_id].operator_object != NULL;
+      const uint32_t input_level = op_levels[producer_id] + (uint32_t) producer_has_operator;
+      level = math_max_u32(level, input_level);
+    }
+    op_levels[i] = level;
+    if (runtime->opdata[i].operator_object != NULL) {
+      num_levels = math_max_u32(num_levels, level + 1);
+    }
+  }
+
+  // Counting sort of the operators by level.
+  uint32_t* level_offsets = runtime->level_offsets;
+  for (size_t i = 0; i < num_ops; i++) {
+    if (runtime->opdata[i].operator_object != NULL) {
+      level_offsets[op_levels[i] + 1] += 1;
+    }
+  }
+  for (uint32_t l = 1; l <= num_levels; l++) {
+    level_offsets[l] += level_offsets[l - 1];
+  }
+  for (size_t i = 0; i < num_ops; i++) {
+    if (runtime->opdata[i].operator_object != NULL) {
+      runtime->level_ops[level_offsets[op_levels[i]]++] = (uint32_t) i;
+    }
+  }
+  // Each level offset now points to the start of the next level: shift them back.
+  for (uint32_t l = num_levels; l != 0; l--) {
+    level_offsets[l] = level_offsets[l - 1];
+  }
+  level_offsets[0] = 0;
+  runtime->num_levels = num_levels;
+  return xnn_status_success;
+}
+
+// Compute the sizes of the Values, and plan the allocation of the internal Values in the workspace. The workspace
+// grows if it is smaller than needed.
+static enum xnn_status plan_workspace(
+  xnn_runtime_t runtime)
+{
+  const xnn_subgraph_t subgraph = runtime->subgraph;
+
+  struct xnn_value_allocation_tracker mem_alloc_tracker;
+  xnn_init_value_allocation_tracker(&mem_alloc_tracker, subgraph);
+  if (runtime->op_levels != NULL) {
+    // Operators on the same level may run concurrently and must not share memory.
+    xnn_assign_value_lifecycle_levels(&mem_alloc_tracker, runtime->op_levels);
+  }
+
+  for (uint32_t i = 0; i < subgraph->num_values; i++) {
+    const struct xnn_value* value = &subgraph->values[i];
+    struct xnn_blob* blob = &runtime->blobs[i];
+    if (value->datatype != xnn_datatype_invalid && value->type == xnn_value_type_dense_tensor) {
+      blob->size = xnn_tensor_get_size(subgraph, i);
+      if (blob->in_workspace) {
+        xnn_add_value_allocation_tracker(&mem_alloc_tracker, i, round_up_po2(blob->size, XNN_EXTRA_BYTES));
+      }
+    }
+  }
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    const struct xnn_node* node = subgraph->nodes + n;
+    if (node->type == xnn_node_type_static_reshape && runtime->opdata[n].operator_object == NULL) {
+      // Reshape without an operator: the output aliases the input, which must stay alive as long as the output.
+      xnn_mark_tensor_as_reuse(&mem_alloc_tracker, node->outputs[0], node->inputs[0],
+        mem_alloc_tracker.usage[node->outputs[0]].last_node);
+    }
+  }
+  for (uint32_t i = 0; i < subgraph->num_values; i++) {
+    const uint32_t view_of = runtime->blobs[i].view_of;
+    if (view_of != XNN_INVALID_VALUE_ID && runtime->blobs[view_of].in_workspace) {
+      // The sliced Value must stay alive as long as any of its views.
+      xnn_mark_tensor_as_view(&mem_alloc_tracker, i, view_of);
+    }
+  }
+  if (runtime->op_levels == NULL) {
+    // In-place execution relies on the sequential order of operators.
+    xnn_plan_in_place_operations(&mem_alloc_tracker);
+  }
+  xnn_plan_value_allocation_tracker(&mem_alloc_tracker);
+
+  if (mem_alloc_tracker.mem_arena_size != 0) {
+    // XNN_EXTRA_BYTES ensures that out-of-bound reads of intermediate values don't segfault.
+    const size_t mem_arena_size = mem_alloc_tracker.mem_arena_size + XNN_EXTRA_BYTES;
+    struct xnn_workspace* workspace = runtime->workspace;
+    if (workspace->size < mem_arena_size) {
+      // Grow the workspace. Its content doesn't need to be preserved, but other runtimes sharing the workspace must
+      // be set up again to rebind their internal Values to the new memory.
+      void* workspace_data = xnn_allocate_simd_memory(mem_arena_size);
+      if (workspace_data == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for runtime workspace", mem_arena_size);
+        xnn_release_value_allocation_tracker(&mem_alloc_tracker);
+        return xnn_status_out_of_memory;
+      }
+      xnn_release_simd_memory(workspace->data);
+      workspace->data = workspace_data;
+      workspace->size = mem_arena_size;
+    }
+  }
+  for (size_t i = 0; i < subgraph->num_values; i++) {
+    struct xnn_blob* blob = &runtime->blobs[i];
+    if (blob->in_workspace) {
+      // The data pointer is bound to the workspace memory in xnn_setup_runtime.
+      blob->workspace_offset = mem_alloc_tracker.usage[i].alloc_offset;
+    }
+  }
+  xnn_release_value_allocation_tracker(&mem_alloc_tracker);
+  return xnn_status_success;
+}
+
+// Make the inputs of Concatenate Nodes and the outputs of Split Nodes views of channel slices of the Concatenate
+// output and the Split input: the producers of the inputs write directly into the output, and the consumers of the
+// outputs read directly from the input, using the channel stride of the sliced Value.
+static void plan_channel_views(
+  xnn_runtime_t runtime,
+  const struct xnn_subgraph* subgraph)
+{
+  for (uint32_t i = 0; i < subgraph->num_values; i++) {
+    const struct xnn_value* value = &subgraph->values[i];
+    struct xnn_blob* blob = &runtime->blobs[i];
+    blob->channel_stride = value->shape.num_dims != 0 ? value->shape.dim[value->shape.num_dims - 1] : 1;
+    blob->view_of = XNN_INVALID_VALUE_ID;
+  }
+
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    const struct xnn_node* node = subgraph->nodes + n;
+    size_t slice_channels[XNN_MAX_INPUTS];
+    uint32_t sliced_id;
+    uint32_t num_slices;
+    const uint32_t* slice_ids;
+    switch (node->type) {
+      case xnn_node_type_concatenate:
+        sliced_id = node->outputs[0];
+        num_slices = node->num_inputs;
+        slice_ids = node->inputs;
+        for (uint32_t j = 0; j < num_slices; j++) {
+          const struct xnn_value* input_value = &subgraph->values[slice_ids[j]];
+          slice_channels[j] = input_value->shape.dim[input_value->shape.num_dims - 1];
+        }
+        break;
+      case xnn_node_type_split:
+        sliced_id = node->inputs[0];
+        num_slices = node->num_outputs;
+        slice_ids = node->outputs;
+        // Unused outputs are removed from the Subgraph, and don't keep their shapes.
+        memcpy(slice_channels, node->params.split.channels, num_slices * sizeof(size_t));
+        break;
+      default:
+        continue;
+    }
+
+    const struct xnn_value* sliced_value = &subgraph->values[sliced_id];
+    const size_t element_size = get_element_size(sliced_value->datatype);
+    const size_t channel_stride = sliced_value->shape.dim[sliced_value->shape.num_dims - 1];
+    size_t channel_offset = 0;
+    for (uint32_t j = 0; j < num_slices; j++) {
+      if (subgraph->values[slice_ids[j]].type != xnn_value_type_invalid) {
+        struct xnn_blob* blob = &runtime->blobs[slice_ids[j]];
+        assert(blob->in_workspace);
+        blob->in_workspace = false;
+        blob->view_of = sliced_id;
+        blob->view_offset = channel_offset * element_size;
+        blob->channel_stride = channel_stride;
+      }
+      channel_offset += slice_channels[j];
+    }
+  }
+}
+
+enum xnn_status xnn_create_runtime_v3(
   xnn_subgraph_t subgraph,
+  xnn_workspace_t workspace,
+  pthreadpool_t threadpool,
+  uint32_t flags,
+  xnn_runtime_t* runtime_out)
+{
+  return xnn_create_runtime_v4(subgraph, NULL /* weights cache */, workspace, threadpool, flags, runtime_out);
+}
+
+enum xnn_status xnn_create_runtime_v4(
+  xnn_subgraph_t subgraph,
+  xnn_weights_cache_t weights_cache,
+  xnn_workspace_t workspace,
   pthreadpool_t threadpool,
   uint32_t flags,
   xnn_runtime_t* runtime_out)
@@ -59,10 +744,23 @@ enum xnn_status xnn_create_runtime_v2(
 
   if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
     xnn_log_error("failed to create runtime: XNNPACK is not initialized");
-    goto error;
+    return xnn_status_uninitialized;
   }
 
-  xnn_subgraph_optimize(subgraph, flags & XNN_FLAG_SPARSE_INFERENCE);
+  if (workspace == NULL) {
+    // Runtime without a shared workspace gets a private one.
+    status = xnn_create_workspace(&workspace);
+    if (status != xnn_status_success) {
+      goto error;
+    }
+  } else {
+    xnn_retain_workspace(workspace);
+  }
+
+  status = xnn_subgraph_optimize(subgraph, flags & (XNN_FLAG_SPARSE_INFERENCE | XNN_FLAG_FP16_INFERENCE));
+  if (status != xnn_status_success) {
+    goto error;
+  }
 
   status = xnn_status_out_of_memory;
 
@@ -71,6 +769,9 @@ enum xnn_status xnn_create_runtime_v2(
     xnn_log_error("failed to allocate %zu bytes for runtime descriptor", sizeof(struct xnn_runtime));
     goto error;
   }
+  // Runtime takes over the reference to the workspace.
+  runtime->workspace = workspace;
+  workspace = NULL;
 
   runtime->opdata = xnn_allocate_zero_memory(sizeof(struct xnn_operator_data) * subgraph->num_nodes);
   if (runtime->opdata == NULL) {
@@ -80,6 +781,34 @@ enum xnn_status xnn_create_runtime_v2(
   }
   runtime->num_ops = subgraph->num_nodes;
 
+  runtime->blobs = xnn_allocate_zero_memory(sizeof(struct xnn_blob) * subgraph->num_values);
+  if (runtime->blobs == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for blob descriptors",
+      sizeof(struct xnn_blob) * subgraph->num_values);
+    goto error;
+  }
+  runtime->num_blobs = subgraph->num_values;
+
+  for (uint32_t i = 0; i < subgraph->num_values; i++) {
+    const struct xnn_value* value = &subgraph->values[i];
+    struct xnn_blob* blob = &runtime->blobs[i];
+    if (value->datatype != xnn_datatype_invalid && value->type == xnn_value_type_dense_tensor) {
+      blob->data = (void*) value->data;
+      if (blob->data == NULL) {
+        if ((value->flags & (XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT)) == 0) {
+          // Value is purely internal to the runtime, and must be allocated in its workspace.
+          blob->in_workspace = true;
+        } else {
+          // Value is non-static and external to the runtime: must be specified via a call to xnn_setup_runtime.
+          blob->external = true;
+        }
+      }
+    }
+  }
+
+  // Operators are created with the channel strides of the views.
+  plan_channel_views(runtime, subgraph);
+
   struct xnn_value* values = subgraph->values;
   for (size_t i = 0; i < subgraph->num_nodes; i++) {
     const struct xnn_node* node = subgraph->nodes + i;
@@ -97,7 +826,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -110,6 +838,15 @@ enum xnn_status xnn_create_runtime_v2(
               node->flags,
               &runtime->opdata[i].operator_object);
             break;
+#ifndef XNN_NO_F16_OPERATORS
+          case xnn_datatype_fp16:
+            status = xnn_create_add_nd_f16(
+              node->activation.output_min,
+              node->activation.output_max,
+              node->flags,
+              &runtime->opdata[i].operator_object);
+            break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
 #ifndef XNN_NO_QS8_OPERATORS
           case xnn_datatype_qint8:
           {
@@ -136,28 +873,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].shape1.num_dims = values[node->inputs[0]].shape.num_dims;
-        runtime->opdata[i].shape2.num_dims = values[node->inputs[1]].shape.num_dims;
-        if (values[node->outputs[0]].layout == xnn_layout_type_nchw) {
-          assert(values[node->inputs[0]].layout == xnn_layout_type_nchw);
-          assert(values[node->inputs[1]].layout == xnn_layout_type_nchw);
-          runtime->opdata[i].shape1.dim[0] = values[node->inputs[0]].shape.dim[0];
-          runtime->opdata[i].shape1.dim[1] = values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1];
-          if (values[node->inputs[0]].shape.num_dims > 2) {
-            memcpy(&runtime->opdata[i].shape1.dim[2], &values[node->inputs[0]].shape.dim[1], (values[node->inputs[0]].shape.num_dims - 2) * sizeof(size_t));
-          }
-          runtime->opdata[i].shape2.dim[0] = values[node->inputs[1]].shape.dim[0];
-          runtime->opdata[i].shape2.dim[1] = values[node->inputs[1]].shape.dim[values[node->inputs[0]].shape.num_dims - 1];
-          if (values[node->inputs[0]].shape.num_dims > 2) {
-            memcpy(&runtime->opdata[i].shape2.dim[2], &values[node->inputs[1]].shape.dim[1], (values[node->inputs[1]].shape.num_dims - 2) * sizeof(size_t));
-          }
-        } else {
-          assert(values[node->outputs[0]].layout == xnn_layout_type_nhwc);
-          assert(values[node->inputs[0]].layout == xnn_layout_type_nhwc);
-          assert(values[node->inputs[1]].layout == xnn_layout_type_nhwc);
-          memcpy(runtime->opdata[i].shape1.dim, values[node->inputs[0]].shape.dim, values[node->inputs[0]].shape.num_dims * sizeof(size_t));
-          memcpy(runtime->opdata[i].shape2.dim, values[node->inputs[1]].shape.dim, values[node->inputs[1]].shape.num_dims * sizeof(size_t));
-        }
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].inputs[1] = node->inputs[1];
         runtime->opdata[i].outputs[0] = node->outputs[0];
@@ -178,9 +893,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = values[node->inputs[0]].shape.dim[0];
-        runtime->opdata[i].input_height = values[node->inputs[0]].shape.dim[1];
-        runtime->opdata[i].input_width = values[node->inputs[0]].shape.dim[2];
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         runtime->opdata[i].outputs[1] = node->outputs[1];
@@ -196,8 +908,8 @@ enum xnn_status xnn_create_runtime_v2(
           node->params.pooling_2d.stride_height,
           node->params.pooling_2d.stride_width,
           values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
-          values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* input stride */,
-          values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* output stride */,
+          runtime->blobs[node->inputs[0]].channel_stride /* input stride */,
+          runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
           node->activation.output_min,
           node->activation.output_max,
           node->flags,
@@ -205,9 +917,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = values[node->inputs[0]].shape.dim[0];
-        runtime->opdata[i].input_height = values[node->inputs[0]].shape.dim[1];
-        runtime->opdata[i].input_width = values[node->inputs[0]].shape.dim[2];
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -221,10 +930,20 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
+      case xnn_node_type_batch_matrix_multiply:
+        status = xnn_create_batch_matrix_multiply_nc_f32(
+          node->flags,
+          &runtime->opdata[i].operator_object);
+        if (status != xnn_status_success) {
+          goto error;
+        }
+        runtime->opdata[i].inputs[0] = node->inputs[0];
+        runtime->opdata[i].inputs[1] = node->inputs[1];
+        runtime->opdata[i].outputs[0] = node->outputs[0];
+        break;
       case xnn_node_type_ceiling:
         status = xnn_create_ceiling_nc_f32(
           values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
@@ -235,7 +954,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -270,7 +988,7 @@ enum xnn_status xnn_create_runtime_v2(
           assert(values[node->outputs[0]].layout == xnn_layout_type_nhwc);
           switch (values[node->outputs[0]].datatype) {
             case xnn_datatype_fp32:
-              status = xnn_create_convolution2d_nhwc_f32(
+              status = xnn_create_convolution2d_nhwc_f32_with_weights_cache(
                 node->params.convolution_2d.input_padding_top,
                 node->params.convolution_2d.input_padding_right,
                 node->params.convolution_2d.input_padding_bottom,
@@ -284,15 +1002,43 @@ enum xnn_status xnn_create_runtime_v2(
                 node->params.convolution_2d.groups,
                 node->params.convolution_2d.group_input_channels,
                 node->params.convolution_2d.group_output_channels,
-                node->params.convolution_2d.group_input_channels * node->params.convolution_2d.groups /* input_pixel_stride */,
-                node->params.convolution_2d.group_output_channels * node->params.convolution_2d.groups /* output_pixel_stride */,
+                runtime->blobs[node->inputs[0]].channel_stride /* input_pixel_stride */,
+                runtime->blobs[node->outputs[0]].channel_stride /* output_pixel_stride */,
                 values[node->inputs[1]].data,
                 values[node->inputs[2]].data,
                 node->activation.output_min,
                 node->activation.output_max,
                 node->flags,
+                weights_cache,
+                threadpool,
                 &runtime->opdata[i].operator_object);
               break;
+#ifndef XNN_NO_F16_OPERATORS
+            case xnn_datatype_fp16:
+              status = xnn_create_convolution2d_nhwc_f16(
+                node->params.convolution_2d.input_padding_top,
+                node->params.convolution_2d.input_padding_right,
+                node->params.convolution_2d.input_padding_bottom,
+                node->params.convolution_2d.input_padding_left,
+                node->params.convolution_2d.kernel_height,
+                node->params.convolution_2d.kernel_width,
+                node->params.convolution_2d.subsampling_height,
+                node->params.convolution_2d.subsampling_width,
+                node->params.convolution_2d.dilation_height,
+                node->params.convolution_2d.dilation_width,
+                node->params.convolution_2d.groups,
+                node->params.convolution_2d.group_input_channels,
+                node->params.convolution_2d.group_output_channels,
+                runtime->blobs[node->inputs[0]].channel_stride /* input_pixel_stride */,
+                runtime->blobs[node->outputs[0]].channel_stride /* output_pixel_stride */,
+                values[node->inputs[1]].data,
+                values[node->inputs[2]].data,
+                node->activation.output_min,
+                node->activation.output_max,
+                node->flags,
+                &runtime->opdata[i].operator_object);
+              break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
 #ifndef XNN_NO_QS8_OPERATORS
             case xnn_datatype_qint8:
             {
@@ -302,7 +1048,7 @@ enum xnn_status xnn_create_runtime_v2(
                 (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
               const int8_t output_max =
                 (int8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, -128.0f), 127.0f));
-              status = xnn_create_convolution2d_nhwc_qs8(
+              status = xnn_create_convolution2d_nhwc_qs8_with_weights_cache(
                 node->params.convolution_2d.input_padding_top,
                 node->params.convolution_2d.input_padding_right,
                 node->params.convolution_2d.input_padding_bottom,
@@ -316,8 +1062,8 @@ enum xnn_status xnn_create_runtime_v2(
                 node->params.convolution_2d.groups,
                 node->params.convolution_2d.group_input_channels,
                 node->params.convolution_2d.group_output_channels,
-                node->params.convolution_2d.group_input_channels * node->params.convolution_2d.groups /* input_pixel_stride */,
-                node->params.convolution_2d.group_output_channels * node->params.convolution_2d.groups /* output_pixel_stride */,
+                runtime->blobs[node->inputs[0]].channel_stride /* input_pixel_stride */,
+                runtime->blobs[node->outputs[0]].channel_stride /* output_pixel_stride */,
                 (int8_t) values[node->inputs[0]].quantization.zero_point,
                 values[node->inputs[0]].quantization.scale,
                 values[node->inputs[1]].quantization.scale,
@@ -326,6 +1072,8 @@ enum xnn_status xnn_create_runtime_v2(
                 (int8_t) output_zero_point,
                 output_scale, output_min, output_max, 
                 node->flags,
+                weights_cache,
+                threadpool,
                 &runtime->opdata[i].operator_object);
               break;
             }
@@ -337,17 +1085,14 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = values[node->inputs[0]].shape.dim[0];
-        runtime->opdata[i].input_height = values[node->inputs[0]].shape.dim[1];
-        runtime->opdata[i].input_width = values[node->inputs[0]].shape.dim[2];
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
       case xnn_node_type_clamp:
         status = xnn_create_clamp_nc_f32(
           values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
-          values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* input stride */,
-          values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* output stride */,
+          runtime->blobs[node->inputs[0]].channel_stride /* input stride */,
+          runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
           node->activation.output_min,
           node->activation.output_max,
           node->flags,
@@ -355,14 +1100,103 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
+        runtime->opdata[i].inputs[0] = node->inputs[0];
+        runtime->opdata[i].outputs[0] = node->outputs[0];
+        break;
+      case xnn_node_type_concatenate:
+        // The inputs are views of slices of the output, and the Node doesn't need an operator.
+        break;
+      case xnn_node_type_convert:
+        switch (values[node->inputs[0]].datatype) {
+#ifndef XNN_NO_VCVT_OPERATORS
+          case xnn_datatype_fp16:
+            assert(values[node->outputs[0]].datatype == xnn_datatype_fp32);
+            status = xnn_create_convert_nc_f16_f32(
+              values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
+              runtime->blobs[node->inputs[0]].channel_stride /* input stride */,
+              runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
+              node->flags,
+              &runtime->opdata[i].operator_object);
+            break;
+          case xnn_datatype_fp32:
+            switch (values[node->outputs[0]].datatype) {
+              case xnn_datatype_fp16:
+                status = xnn_create_convert_nc_f32_f16(
+                  values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
+                  runtime->blobs[node->inputs[0]].channel_stride /* input stride */,
+                  runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
+                  node->flags,
+                  &runtime->opdata[i].operator_object);
+                break;
+              case xnn_datatype_qint8:
+                status = xnn_create_convert_nc_f32_qs8(
+                  values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
+                  runtime->blobs[node->inputs[0]].channel_stride /* input stride */,
+                  runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
+                  values[node->outputs[0]].quantization.scale,
+                  (int8_t) values[node->outputs[0]].quantization.zero_point,
+                  INT8_MIN, INT8_MAX,
+                  node->flags,
+                  &runtime->opdata[i].operator_object);
+                break;
+              default:
+                XNN_UNREACHABLE;
+            }
+            break;
+          case xnn_datatype_qint8:
+            assert(values[node->outputs[0]].datatype == xnn_datatype_fp32);
+            status = xnn_create_convert_nc_qs8_f32(
+              values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
+              runtime->blobs[node->inputs[0]].channel_stride /* input stride */,
+              runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
+              values[node->inputs[0]].quantization.scale,
+              (int8_t) values[node->inputs[0]].quantization.zero_point,
+              node->flags,
+              &runtime->opdata[i].operator_object);
+            break;
+#endif  // !defined(XNN_NO_VCVT_OPERATORS)
+          default:
+            XNN_UNREACHABLE;
+        }
+        if (status != xnn_status_success) {
+          goto error;
+        }
+        runtime->opdata[i].inputs[0] = node->inputs[0];
+        runtime->opdata[i].outputs[0] = node->outputs[0];
+        break;
+      case xnn_node_type_copy:
+        switch (values[node->inputs[0]].datatype) {
+          case xnn_datatype_fp32:
+            status = xnn_create_copy_nc_x32(
+              values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
+              runtime->blobs[node->inputs[0]].channel_stride /* input stride */,
+              runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
+              node->flags,
+              &runtime->opdata[i].operator_object);
+            break;
+#ifndef XNN_NO_QS8_OPERATORS
+          case xnn_datatype_qint8:
+            status = xnn_create_copy_nc_x8(
+              values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
+              runtime->blobs[node->inputs[0]].channel_stride /* input stride */,
+              runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
+              node->flags,
+              &runtime->opdata[i].operator_object);
+            break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+          default:
+            XNN_UNREACHABLE;
+        }
+        if (status != xnn_status_success) {
+          goto error;
+        }
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
       case xnn_node_type_deconvolution_2d:
         assert(values[node->inputs[1]].data != NULL);
         assert(values[node->inputs[2]].data != NULL);
-        status = xnn_create_deconvolution2d_nhwc_f32(
+        status = xnn_create_deconvolution2d_nhwc_f32_with_weights_cache(
           node->params.deconvolution_2d.padding_top,
           node->params.deconvolution_2d.padding_right,
           node->params.deconvolution_2d.padding_bottom,
@@ -383,13 +1217,11 @@ enum xnn_status xnn_create_runtime_v2(
           node->activation.output_min,
           node->activation.output_max,
           node->flags,
+          weights_cache,
           &runtime->opdata[i].operator_object);
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = values[node->inputs[0]].shape.dim[0];
-        runtime->opdata[i].input_height = values[node->inputs[0]].shape.dim[1];
-        runtime->opdata[i].input_width = values[node->inputs[0]].shape.dim[2];
         runtime->opdata[i].adjustment_height = node->params.deconvolution_2d.adjustment_height;
         runtime->opdata[i].adjustment_width = node->params.deconvolution_2d.adjustment_width;
         runtime->opdata[i].inputs[0] = node->inputs[0];
@@ -427,7 +1259,34 @@ enum xnn_status xnn_create_runtime_v2(
           assert(values[node->outputs[0]].layout == xnn_layout_type_nhwc);
           switch (values[node->outputs[0]].datatype) {
             case xnn_datatype_fp32:
-              status = xnn_create_convolution2d_nhwc_f32(
+              status = xnn_create_convolution2d_nhwc_f32_with_weights_cache(
+                node->params.depthwise_convolution_2d.input_padding_top,
+                node->params.depthwise_convolution_2d.input_padding_right,
+                node->params.depthwise_convolution_2d.input_padding_bottom,
+                node->params.depthwise_convolution_2d.input_padding_left,
+                node->params.depthwise_convolution_2d.kernel_height,
+                node->params.depthwise_convolution_2d.kernel_width,
+                node->params.depthwise_convolution_2d.subsampling_height,
+                node->params.depthwise_convolution_2d.subsampling_width,
+                node->params.depthwise_convolution_2d.dilation_height,
+                node->params.depthwise_convolution_2d.dilation_width,
+                node->params.depthwise_convolution_2d.input_channels /* groups */,
+                1 /* group_input_channels */,
+                node->params.depthwise_convolution_2d.depth_multiplier /* group_output_channels */,
+                runtime->blobs[node->inputs[0]].channel_stride /* input_channel_stride */,
+                runtime->blobs[node->outputs[0]].channel_stride /* output_channel_stride */,
+                values[node->inputs[1]].data,
+                values[node->inputs[2]].data,
+                node->activation.output_min,
+                node->activation.output_max,
+                node->flags | XNN_FLAG_DEPTHWISE_CONVOLUTION,
+                weights_cache,
+                threadpool,
+                &runtime->opdata[i].operator_object);
+              break;
+#ifndef XNN_NO_F16_OPERATORS
+            case xnn_datatype_fp16:
+              status = xnn_create_convolution2d_nhwc_f16(
                 node->params.depthwise_convolution_2d.input_padding_top,
                 node->params.depthwise_convolution_2d.input_padding_right,
                 node->params.depthwise_convolution_2d.input_padding_bottom,
@@ -441,8 +1300,8 @@ enum xnn_status xnn_create_runtime_v2(
                 node->params.depthwise_convolution_2d.input_channels /* groups */,
                 1 /* group_input_channels */,
                 node->params.depthwise_convolution_2d.depth_multiplier /* group_output_channels */,
-                node->params.depthwise_convolution_2d.input_channels /* input_channel_stride */,
-                node->params.depthwise_convolution_2d.input_channels * node->params.depthwise_convolution_2d.depth_multiplier /* output_channel_stride */,
+                runtime->blobs[node->inputs[0]].channel_stride /* input_channel_stride */,
+                runtime->blobs[node->outputs[0]].channel_stride /* output_channel_stride */,
                 values[node->inputs[1]].data,
                 values[node->inputs[2]].data,
                 node->activation.output_min,
@@ -450,6 +1309,7 @@ enum xnn_status xnn_create_runtime_v2(
                 node->flags | XNN_FLAG_DEPTHWISE_CONVOLUTION,
                 &runtime->opdata[i].operator_object);
               break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
 #ifndef XNN_NO_QS8_OPERATORS
             case xnn_datatype_qint8:
             {
@@ -459,7 +1319,7 @@ enum xnn_status xnn_create_runtime_v2(
                 (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
               const int8_t output_max =
                 (int8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, -128.0f), 127.0f));
-              status = xnn_create_convolution2d_nhwc_qs8(
+              status = xnn_create_convolution2d_nhwc_qs8_with_weights_cache(
                 node->params.depthwise_convolution_2d.input_padding_top,
                 node->params.depthwise_convolution_2d.input_padding_right,
                 node->params.depthwise_convolution_2d.input_padding_bottom,
@@ -473,8 +1333,8 @@ enum xnn_status xnn_create_runtime_v2(
                 node->params.depthwise_convolution_2d.input_channels /* groups */,
                 1 /* group_input_channels */,
                 node->params.depthwise_convolution_2d.depth_multiplier /* group_output_channels */,
-                node->params.depthwise_convolution_2d.input_channels /* input_channel_stride */,
-                node->params.depthwise_convolution_2d.input_channels * node->params.depthwise_convolution_2d.depth_multiplier /* output_channel_stride */,
+                runtime->blobs[node->inputs[0]].channel_stride /* input_channel_stride */,
+                runtime->blobs[node->outputs[0]].channel_stride /* output_channel_stride */,
                 (int8_t) values[node->inputs[0]].quantization.zero_point,
                 values[node->inputs[0]].quantization.scale,
                 values[node->inputs[1]].quantization.scale,
@@ -483,6 +1343,8 @@ enum xnn_status xnn_create_runtime_v2(
                 (int8_t) output_zero_point,
                 output_scale, output_min, output_max, 
                 node->flags | XNN_FLAG_DEPTHWISE_CONVOLUTION,
+                weights_cache,
+                threadpool,
                 &runtime->opdata[i].operator_object);
               break;
             }
@@ -494,10 +1356,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = values[node->inputs[0]].shape.dim[0];
-        runtime->opdata[i].input_height = values[node->inputs[0]].shape.dim[1];
-        runtime->opdata[i].input_width = values[node->inputs[0]].shape.dim[2];
-
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -526,11 +1384,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = values[node->inputs[0]].shape.dim[0];
-        runtime->opdata[i].input_height = values[node->inputs[0]].shape.dim[1];
-        runtime->opdata[i].input_width = values[node->inputs[0]].shape.dim[2];
-        runtime->opdata[i].output_height = values[node->outputs[0]].shape.dim[1];
-        runtime->opdata[i].output_width = values[node->outputs[0]].shape.dim[2];
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -543,10 +1396,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].shape1.num_dims = values[node->inputs[0]].shape.num_dims;
-        runtime->opdata[i].shape2.num_dims = values[node->inputs[1]].shape.num_dims;
-        memcpy(runtime->opdata[i].shape1.dim, values[node->inputs[0]].shape.dim, values[node->inputs[0]].shape.num_dims * sizeof(size_t));
-        memcpy(runtime->opdata[i].shape2.dim, values[node->inputs[1]].shape.dim, values[node->inputs[1]].shape.num_dims * sizeof(size_t));
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].inputs[1] = node->inputs[1];
         runtime->opdata[i].outputs[0] = node->outputs[0];
@@ -562,30 +1411,90 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
       case xnn_node_type_fully_connected:
       {
-        const size_t num_input_elements = product_all_dims(&values[node->inputs[0]].shape);
         const size_t output_channels = values[node->inputs[1]].shape.dim[0];
         const size_t input_channels = values[node->inputs[1]].shape.dim[1];
-        status = xnn_create_fully_connected_nc_f32(
-          input_channels,
-          output_channels,
-          input_channels /* input stride */,
-          output_channels /* output stride */,
-          values[node->inputs[1]].data,
-          values[node->inputs[2]].data,
-          node->activation.output_min,
-          node->activation.output_max,
-          0 /* flags */,
-          &runtime->opdata[i].operator_object);
+        // Fully Connected operator flattens the input into rows of input_channels elements, which can differ from the
+        // last dimension of the input. Only a view of a channel slice is read with the channel stride of the sliced
+        // Value, and such a view is never flattened.
+        const size_t input_stride = runtime->blobs[node->inputs[0]].view_of != XNN_INVALID_VALUE_ID ?
+          runtime->blobs[node->inputs[0]].channel_stride : input_channels;
+        switch (values[node->outputs[0]].datatype) {
+          case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+            if ((flags & XNN_FLAG_DYNAMIC_RANGE_QUANTIZATION) != 0 &&
+                (node->flags & XNN_FLAG_FUSED_HARDSWISH) == 0 &&
+                (xnn_params.init_flags & XNN_INIT_FLAG_QC8) != 0 &&
+                (xnn_params.init_flags & XNN_INIT_FLAG_QD8_OPT) != 0)
+            {
+              status = xnn_create_fully_connected_nc_qd8_f32_qc8w_from_f32_with_weights_cache(
+                input_channels,
+                output_channels,
+                input_stride,
+                runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
+                values[node->inputs[1]].data,
+                values[node->inputs[2]].data,
+                node->activation.output_min,
+                node->activation.output_max,
+                0 /* flags */,
+                weights_cache,
+                threadpool,
+                &runtime->opdata[i].operator_object);
+              break;
+            }
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+            status = xnn_create_fully_connected_nc_f32_with_weights_cache(
+              input_channels,
+              output_channels,
+              input_stride,
+              runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
+              values[node->inputs[1]].data,
+              values[node->inputs[2]].data,
+              node->activation.output_min,
+              node->activation.output_max,
+              node->flags & XNN_FLAG_FUSED_HARDSWISH,
+              weights_cache,
+              threadpool,
+              &runtime->opdata[i].operator_object);
+            break;
+#ifndef XNN_NO_QS8_OPERATORS
+          case xnn_datatype_qint8:
+          {
+            const float output_scale = values[node->outputs[0]].quantization.scale;
+            const int32_t output_zero_point = values[node->outputs[0]].quantization.zero_point;
+            const int8_t output_min =
+              (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
+            const int8_t output_max =
+              (int8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, -128.0f), 127.0f));
+            status = xnn_create_fully_connected_nc_qs8_with_weights_cache(
+              input_channels,
+              output_channels,
+              input_stride,
+              runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
+              (int8_t) values[node->inputs[0]].quantization.zero_point,
+              values[node->inputs[0]].quantization.scale,
+              values[node->inputs[1]].quantization.scale,
+              values[node->inputs[1]].data,
+              values[node->inputs[2]].data,
+              (int8_t) output_zero_point,
+              output_scale, output_min, output_max,
+              0 /* flags */,
+              weights_cache,
+              threadpool,
+              &runtime->opdata[i].operator_object);
+            break;
+          }
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+          default:
+            XNN_UNREACHABLE;
+        }
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = num_input_elements / input_channels;
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -600,7 +1509,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -615,34 +1523,65 @@ enum xnn_status xnn_create_runtime_v2(
         } else {
           assert(values[node->inputs[0]].layout == xnn_layout_type_nhwc);
           assert(values[node->outputs[0]].layout == xnn_layout_type_nhwc);
-          status = xnn_create_global_average_pooling_nwc_f32(
-            values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
-            values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* input stride */,
-            values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* output stride */,
-            node->activation.output_min,
-            node->activation.output_max,
-            node->flags,
-            &runtime->opdata[i].operator_object);
+          switch (values[node->outputs[0]].datatype) {
+            case xnn_datatype_fp32:
+              status = xnn_create_global_average_pooling_nwc_f32(
+                values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
+                values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* input stride */,
+                values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* output stride */,
+                node->activation.output_min,
+                node->activation.output_max,
+                node->flags,
+                &runtime->opdata[i].operator_object);
+              break;
+#ifndef XNN_NO_F16_OPERATORS
+            case xnn_datatype_fp16:
+              status = xnn_create_global_average_pooling_nwc_f16(
+                values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
+                values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* input stride */,
+                values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* output stride */,
+                node->activation.output_min,
+                node->activation.output_max,
+                node->flags,
+                &runtime->opdata[i].operator_object);
+              break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+            default:
+              XNN_UNREACHABLE;
+          }
         }
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = values[node->inputs[0]].shape.dim[0];
-        runtime->opdata[i].input_width = values[node->inputs[0]].shape.dim[1] * values[node->inputs[0]].shape.dim[2];
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
       case xnn_node_type_hardswish:
-        status = xnn_create_hardswish_nc_f32(
-          values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
-          values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* input stride */,
-          values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* output stride */,
-          node->flags,
-          &runtime->opdata[i].operator_object);
+        switch (values[node->inputs[0]].datatype) {
+          case xnn_datatype_fp32:
+            status = xnn_create_hardswish_nc_f32(
+              values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
+              runtime->blobs[node->inputs[0]].channel_stride /* input stride */,
+              runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
+              node->flags,
+              &runtime->opdata[i].operator_object);
+            break;
+#ifndef XNN_NO_F16_OPERATORS
+          case xnn_datatype_fp16:
+            status = xnn_create_hardswish_nc_f16(
+              values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
+              runtime->blobs[node->inputs[0]].channel_stride /* input stride */,
+              runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
+              node->flags,
+              &runtime->opdata[i].operator_object);
+            break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+          default:
+            XNN_UNREACHABLE;
+        }
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -657,7 +1596,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -674,8 +1612,8 @@ enum xnn_status xnn_create_runtime_v2(
           node->params.pooling_2d.dilation_height,
           node->params.pooling_2d.dilation_width,
           values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* channels */,
-          values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* input stride */,
-          values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1] /* output stride */,
+          runtime->blobs[node->inputs[0]].channel_stride /* input stride */,
+          runtime->blobs[node->outputs[0]].channel_stride /* output stride */,
           node->activation.output_min,
           node->activation.output_max,
           node->flags,
@@ -683,9 +1621,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = values[node->inputs[0]].shape.dim[0];
-        runtime->opdata[i].input_height = values[node->inputs[0]].shape.dim[1];
-        runtime->opdata[i].input_width = values[node->inputs[0]].shape.dim[2];
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -696,10 +1631,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].shape1.num_dims = values[node->inputs[0]].shape.num_dims;
-        runtime->opdata[i].shape2.num_dims = values[node->inputs[1]].shape.num_dims;
-        memcpy(runtime->opdata[i].shape1.dim, values[node->inputs[0]].shape.dim, values[node->inputs[0]].shape.num_dims * sizeof(size_t));
-        memcpy(runtime->opdata[i].shape2.dim, values[node->inputs[1]].shape.dim, values[node->inputs[1]].shape.num_dims * sizeof(size_t));
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].inputs[1] = node->inputs[1];
         runtime->opdata[i].outputs[0] = node->outputs[0];
@@ -711,45 +1642,34 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].shape1.num_dims = values[node->inputs[0]].shape.num_dims;
-        runtime->opdata[i].shape2.num_dims = values[node->inputs[1]].shape.num_dims;
-        memcpy(runtime->opdata[i].shape1.dim, values[node->inputs[0]].shape.dim, values[node->inputs[0]].shape.num_dims * sizeof(size_t));
-        memcpy(runtime->opdata[i].shape2.dim, values[node->inputs[1]].shape.dim, values[node->inputs[1]].shape.num_dims * sizeof(size_t));
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].inputs[1] = node->inputs[1];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
       case xnn_node_type_multiply2:
-        status = xnn_create_multiply_nd_f32(
-          node->activation.output_min,
-          node->activation.output_max,
-          node->flags,
-          &runtime->opdata[i].operator_object);
+        switch (values[node->outputs[0]].datatype) {
+          case xnn_datatype_fp32:
+            status = xnn_create_multiply_nd_f32(
+              node->activation.output_min,
+              node->activation.output_max,
+              node->flags,
+              &runtime->opdata[i].operator_object);
+            break;
+#ifndef XNN_NO_F16_OPERATORS
+          case xnn_datatype_fp16:
+            status = xnn_create_multiply_nd_f16(
+              node->activation.output_min,
+              node->activation.output_max,
+              node->flags,
+              &runtime->opdata[i].operator_object);
+            break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+          default:
+            XNN_UNREACHABLE;
+        }
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].shape1.num_dims = values[node->inputs[0]].shape.num_dims;
-        runtime->opdata[i].shape2.num_dims = values[node->inputs[1]].shape.num_dims;
-        if (values[node->outputs[0]].layout == xnn_layout_type_nchw) {
-          assert(values[node->inputs[0]].layout == xnn_layout_type_nchw);
-          assert(values[node->inputs[1]].layout == xnn_layout_type_nchw);
-          runtime->opdata[i].shape1.dim[0] = values[node->inputs[0]].shape.dim[0];
-          runtime->opdata[i].shape1.dim[1] = values[node->inputs[0]].shape.dim[values[node->inputs[0]].shape.num_dims - 1];
-          if (values[node->inputs[0]].shape.num_dims > 2) {
-            memcpy(&runtime->opdata[i].shape1.dim[2], &values[node->inputs[0]].shape.dim[1], (values[node->inputs[0]].shape.num_dims - 2) * sizeof(size_t));
-          }
-          runtime->opdata[i].shape2.dim[0] = values[node->inputs[1]].shape.dim[0];
-          runtime->opdata[i].shape2.dim[1] = values[node->inputs[1]].shape.dim[values[node->inputs[0]].shape.num_dims - 1];
-          if (values[node->inputs[0]].shape.num_dims > 2) {
-            memcpy(&runtime->opdata[i].shape2.dim[2], &values[node->inputs[1]].shape.dim[1], (values[node->inputs[1]].shape.num_dims - 2) * sizeof(size_t));
-          }
-        } else {
-          assert(values[node->outputs[0]].layout == xnn_layout_type_nhwc);
-          assert(values[node->inputs[0]].layout == xnn_layout_type_nhwc);
-          assert(values[node->inputs[1]].layout == xnn_layout_type_nhwc);
-          memcpy(runtime->opdata[i].shape1.dim, values[node->inputs[0]].shape.dim, values[node->inputs[0]].shape.num_dims * sizeof(size_t));
-          memcpy(runtime->opdata[i].shape2.dim, values[node->inputs[1]].shape.dim, values[node->inputs[1]].shape.num_dims * sizeof(size_t));
-        }
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].inputs[1] = node->inputs[1];
         runtime->opdata[i].outputs[0] = node->outputs[0];
@@ -764,7 +1684,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -779,7 +1698,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -793,7 +1711,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -807,10 +1724,12 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
+      case xnn_node_type_split:
+        // The outputs are views of slices of the input, and the Node doesn't need an operator.
+        break;
       case xnn_node_type_static_constant_pad:
         status = xnn_create_constant_pad_nd_x32(
           &node->params.static_pad.padding_value,
@@ -819,13 +1738,16 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].shape1 = values[node->inputs[0]].shape;
         memcpy(runtime->opdata[i].pre_paddings, node->params.static_pad.pre_paddings, sizeof(size_t) * XNN_MAX_TENSOR_DIMS);
         memcpy(runtime->opdata[i].post_paddings, node->params.static_pad.post_paddings, sizeof(size_t) * XNN_MAX_TENSOR_DIMS);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
       case xnn_node_type_static_reshape:
+        if (is_workspace_value(&values[node->inputs[0]]) && is_workspace_value(&values[node->outputs[0]])) {
+          // Output shares the workspace memory of the input, and the Node doesn't need an operator.
+          break;
+        }
         status = xnn_create_copy_nc_x32(
           1 /* channels */,
           1 /* input stride */,
@@ -835,7 +1757,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_all_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -860,11 +1781,30 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = values[node->inputs[0]].shape.dim[0];
-        runtime->opdata[i].input_height = values[node->inputs[0]].shape.dim[1];
-        runtime->opdata[i].input_width = values[node->inputs[0]].shape.dim[2];
-        runtime->opdata[i].output_height = values[node->outputs[0]].shape.dim[1];
-        runtime->opdata[i].output_width = values[node->outputs[0]].shape.dim[2];
+        runtime->opdata[i].inputs[0] = node->inputs[0];
+        runtime->opdata[i].outputs[0] = node->outputs[0];
+        break;
+      case xnn_node_type_static_transpose:
+        switch (values[node->outputs[0]].datatype) {
+          case xnn_datatype_fp32:
+            status = xnn_create_transpose_nd_x32(
+              node->flags,
+              &runtime->opdata[i].operator_object);
+            break;
+#ifndef XNN_NO_QS8_OPERATORS
+          case xnn_datatype_qint8:
+            status = xnn_create_transpose_nd_x8(
+              node->flags,
+              &runtime->opdata[i].operator_object);
+            break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+          default:
+            XNN_UNREACHABLE;
+        }
+        if (status != xnn_status_success) {
+          goto error;
+        }
+        memcpy(runtime->opdata[i].perm, node->params.static_transpose.perm, sizeof(size_t) * XNN_MAX_TENSOR_DIMS);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -878,7 +1818,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -892,7 +1831,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = product_non_channel_dims(&values[node->inputs[0]].shape);
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].outputs[0] = node->outputs[0];
         break;
@@ -903,10 +1841,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].shape1.num_dims = values[node->inputs[0]].shape.num_dims;
-        runtime->opdata[i].shape2.num_dims = values[node->inputs[1]].shape.num_dims;
-        memcpy(runtime->opdata[i].shape1.dim, values[node->inputs[0]].shape.dim, values[node->inputs[0]].shape.num_dims * sizeof(size_t));
-        memcpy(runtime->opdata[i].shape2.dim, values[node->inputs[1]].shape.dim, values[node->inputs[1]].shape.num_dims * sizeof(size_t));
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].inputs[1] = node->inputs[1];
         runtime->opdata[i].outputs[0] = node->outputs[0];
@@ -920,10 +1854,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].shape1.num_dims = values[node->inputs[0]].shape.num_dims;
-        runtime->opdata[i].shape2.num_dims = values[node->inputs[1]].shape.num_dims;
-        memcpy(runtime->opdata[i].shape1.dim, values[node->inputs[0]].shape.dim, values[node->inputs[0]].shape.num_dims * sizeof(size_t));
-        memcpy(runtime->opdata[i].shape2.dim, values[node->inputs[1]].shape.dim, values[node->inputs[1]].shape.num_dims * sizeof(size_t));
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].inputs[1] = node->inputs[1];
         runtime->opdata[i].outputs[0] = node->outputs[0];
@@ -944,9 +1874,6 @@ enum xnn_status xnn_create_runtime_v2(
         if (status != xnn_status_success) {
           goto error;
         }
-        runtime->opdata[i].batch_size = values[node->inputs[0]].shape.dim[0];
-        runtime->opdata[i].input_height = values[node->inputs[0]].shape.dim[1];
-        runtime->opdata[i].input_width = values[node->inputs[0]].shape.dim[2];
         runtime->opdata[i].inputs[0] = node->inputs[0];
         runtime->opdata[i].inputs[1] = node->inputs[1];
         runtime->opdata[i].outputs[0] = node->outputs[0];
@@ -954,68 +1881,130 @@ enum xnn_status xnn_create_runtime_v2(
     }
   }
 
-  runtime->blobs = xnn_allocate_zero_memory(sizeof(struct xnn_blob) * subgraph->num_values);
-  if (runtime->blobs == NULL) {
-    xnn_log_error("failed to allocate %zu bytes for blob descriptors",
-      sizeof(struct xnn_blob) * subgraph->num_values);
+  // Runtime keeps its own copy of the Values and Nodes to propagate new shapes in xnn_reshape_runtime.
+  status = xnn_subgraph_clone(subgraph, &runtime->subgraph);
+  if (status != xnn_status_success) {
     goto error;
   }
-  runtime->num_blobs = subgraph->num_values;
 
-  struct xnn_value_allocation_tracker mem_alloc_tracker;
-  xnn_init_value_allocation_tracker(&mem_alloc_tracker, subgraph);
-
-  for (uint32_t i = 0; i < subgraph->num_values; i++) {
-    const struct xnn_value* value = &subgraph->values[i];
-    struct xnn_blob* blob = &runtime->blobs[i];
-    if (value->datatype != xnn_datatype_invalid && value->type == xnn_value_type_dense_tensor) {
-      blob->size = xnn_tensor_get_size(subgraph, i);
-      blob->data = (void*) value->data;
-      if (blob->data == NULL) {
-        if ((value->flags & (XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT)) == 0) {
-          // Value is purely internal to the runtime, and must be allocated in its workspace.
-          xnn_add_value_allocation_tracker(&mem_alloc_tracker, i, round_up_po2(blob->size, XNN_EXTRA_BYTES));
-        } else {
-          // Value is non-static and external to the runtime: must be specified via a call to xnn_setup_runtime.
-          blob->external = true;
-        }
-      }
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    if (runtime->opdata[i].operator_object != NULL) {
+      update_operator_shapes(&runtime->opdata[i], &subgraph->nodes[i], subgraph->values);
     }
   }
-  xnn_plan_value_allocation_tracker(&mem_alloc_tracker);
 
-  if (mem_alloc_tracker.mem_arena_size != 0) {
-    // XNN_EXTRA_BYTES ensures that out-of-bound reads of intermediate values don't segfault.
-    const size_t mem_arena_size = mem_alloc_tracker.mem_arena_size + XNN_EXTRA_BYTES;
-    runtime->workspace = xnn_allocate_simd_memory(mem_arena_size);
-    if (runtime->workspace == NULL) {
-      xnn_log_error("failed to allocate %zu bytes for runtime workspace", mem_arena_size);
-      xnn_release_value_allocation_tracker(&mem_alloc_tracker);
+  if (flags & XNN_FLAG_INTER_OPERATOR_PARALLELISM) {
+    status = plan_operator_levels(runtime, subgraph);
+    if (status != xnn_status_success) {
       goto error;
     }
-    for (size_t i = 0; i < subgraph->num_values; i++) {
-      const struct xnn_value* value = &subgraph->values[i];
-      struct xnn_blob* blob = &runtime->blobs[i];
-      if (value->datatype != xnn_datatype_invalid && value->type == xnn_value_type_dense_tensor) {
-        if (value->data == NULL && !blob->external) {
-          // Value is purely internal to the runtime, allocate it in the workspace.
-          blob->data = (void*) ((uintptr_t) runtime->workspace + mem_alloc_tracker.usage[i].alloc_offset);
-        }
-      }
-    }
   }
-  xnn_release_value_allocation_tracker(&mem_alloc_tracker);
+
+  status = plan_workspace(runtime);
+  if (status != xnn_status_success) {
+    goto error;
+  }
 
   runtime->threadpool = threadpool;
+  runtime->profiling = (flags & XNN_FLAG_BASIC_PROFILING) != 0;
 
   *runtime_out = runtime;
   return xnn_status_success;
 
 error:
+  xnn_release_workspace(workspace);
   xnn_delete_runtime(runtime);
   return status;
 }
 
+enum xnn_status xnn_reshape_external_value(
+  xnn_runtime_t runtime,
+  uint32_t external_id,
+  size_t num_dims,
+  const size_t* dims)
+{
+  if (external_id >= runtime->subgraph->num_values) {
+    xnn_log_error("failed to reshape runtime: out-of-bounds ID %" PRIu32, external_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_value* value = &runtime->subgraph->values[external_id];
+  if ((value->flags & XNN_VALUE_FLAG_EXTERNAL_INPUT) == 0) {
+    xnn_log_error("failed to reshape runtime: Value %" PRIu32 " is not an external input", external_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (num_dims != value->shape.num_dims) {
+    xnn_log_error(
+      "failed to reshape external Value %" PRIu32 ": number of dimensions %zu doesn't match the original %zu",
+      external_id, num_dims, value->shape.num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_dims; i++) {
+    if (dims[i] == 0) {
+      xnn_log_error(
+        "failed to reshape external Value %" PRIu32 ": shape dimension #%zu must be non-zero", external_id, i);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  // Operators are created for a fixed number of channels.
+  if (num_dims != 0 && dims[num_dims - 1] != value->shape.dim[num_dims - 1]) {
+    xnn_log_error(
+      "failed to reshape external Value %" PRIu32 ": number of channels %zu doesn't match the original %zu",
+      external_id, dims[num_dims - 1], value->shape.dim[num_dims - 1]);
+    return xnn_status_invalid_parameter;
+  }
+
+  memcpy(value->shape.dim, dims, num_dims * sizeof(size_t));
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_get_external_value_shape(
+  xnn_runtime_t runtime,
+  uint32_t external_id,
+  size_t* num_dims,
+  size_t* dims)
+{
+  if (external_id >= runtime->subgraph->num_values) {
+    xnn_log_error("failed to get shape of external Value: out-of-bounds ID %" PRIu32, external_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* value = &runtime->subgraph->values[external_id];
+  if ((value->flags & (XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT)) == 0) {
+    xnn_log_error("failed to get shape of external Value: Value %" PRIu32 " is not external", external_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  *num_dims = value->shape.num_dims;
+  memcpy(dims, value->shape.dim, value->shape.num_dims * sizeof(size_t));
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_reshape_runtime(
+  xnn_runtime_t runtime)
+{
+  struct xnn_subgraph* subgraph = runtime->subgraph;
+  for (uint32_t i = 0; i < subgraph->num_nodes; i++) {
+    const enum xnn_status status = infer_output_shapes(&subgraph->nodes[i], subgraph->values);
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+
+  // Operators and their packed weights are reused, only their setup parameters change.
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    if (runtime->opdata[i].operator_object != NULL) {
+      update_operator_shapes(&runtime->opdata[i], &subgraph->nodes[i], subgraph->values);
+    }
+  }
+  runtime->has_been_setup = false;
+
+  return plan_workspace(runtime);
+}
+
 enum xnn_status xnn_setup_runtime(
   xnn_runtime_t runtime,
   size_t num_external_values,
@@ -1047,6 +2036,23 @@ enum xnn_status xnn_setup_runtime(
     blob->data = external_value->data;
   }
 
+  // Bind internal Values to the current workspace memory, which could have been reallocated by another runtime.
+  void* workspace_data = runtime->workspace->data;
+  for (size_t i = 0; i < runtime->num_blobs; i++) {
+    struct xnn_blob* blob = &runtime->blobs[i];
+    if (blob->in_workspace) {
+      blob->data = (void*) ((uintptr_t) workspace_data + blob->workspace_offset);
+    }
+  }
+  // Views are bound after the internal and external Values they slice.
+  for (size_t i = 0; i < runtime->num_blobs; i++) {
+    struct xnn_blob* blob = &runtime->blobs[i];
+    if (blob->view_of != XNN_INVALID_VALUE_ID) {
+      blob->data = (void*) ((uintptr_t) runtime->blobs[blob->view_of].data + blob->view_offset);
+    }
+  }
+  runtime->has_been_setup = false;
+
   for (size_t i = 0; i < runtime->num_ops; i++) {
     const struct xnn_operator_data* opdata = &runtime->opdata[i];
     if (opdata->operator_object == NULL) {
@@ -1081,6 +2087,23 @@ enum xnn_status xnn_setup_runtime(
           runtime->blobs[opdata->outputs[0]].data,
           runtime->threadpool);
         break;
+#ifndef XNN_NO_F16_OPERATORS
+      case xnn_operator_type_add_nd_f16:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->inputs[1]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_add_nd_f16(
+          opdata->operator_object,
+          opdata->shape1.num_dims,
+          opdata->shape1.dim,
+          opdata->shape2.num_dims,
+          opdata->shape2.dim,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->inputs[1]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
 #ifndef XNN_NO_QS8_OPERATORS
       case xnn_operator_type_add_nd_qs8:
         assert(runtime->blobs[opdata->inputs[0]].data != NULL);
@@ -1134,6 +2157,25 @@ enum xnn_status xnn_setup_runtime(
           runtime->blobs[opdata->outputs[0]].data,
           runtime->threadpool);
         break;
+      case xnn_operator_type_batch_matrix_multiply_nc_f32:
+      {
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->inputs[1]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        const size_t num_dims = opdata->shape1.num_dims;
+        const bool transpose_b = (opdata->operator_object->flags & XNN_FLAG_TRANSPOSE_B) != 0;
+        status = xnn_setup_batch_matrix_multiply_nc_f32(
+          opdata->operator_object,
+          opdata->batch_size,
+          opdata->shape1.dim[num_dims - 2] /* m */,
+          opdata->shape1.dim[num_dims - 1] /* k */,
+          opdata->shape2.dim[transpose_b ? num_dims - 2 : num_dims - 1] /* n */,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->inputs[1]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+      }
       case xnn_operator_type_ceiling_nc_f32:
         assert(runtime->blobs[opdata->inputs[0]].data != NULL);
         assert(runtime->blobs[opdata->outputs[0]].data != NULL);
@@ -1181,6 +2223,20 @@ enum xnn_status xnn_setup_runtime(
           runtime->blobs[opdata->outputs[0]].data,
           runtime->threadpool);
         break;
+#ifndef XNN_NO_F16_OPERATORS
+      case xnn_operator_type_convolution_nhwc_f16:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_convolution2d_nhwc_f16(
+          opdata->operator_object,
+          opdata->batch_size,
+          opdata->input_height,
+          opdata->input_width,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
 #ifndef XNN_NO_QS8_OPERATORS
       case xnn_operator_type_convolution_nhwc_qs8:
         assert(runtime->blobs[opdata->inputs[0]].data != NULL);
@@ -1195,6 +2251,48 @@ enum xnn_status xnn_setup_runtime(
           runtime->threadpool);
         break;
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_VCVT_OPERATORS
+      case xnn_operator_type_convert_nc_f16_f32:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_convert_nc_f16_f32(
+          opdata->operator_object,
+          opdata->batch_size,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+      case xnn_operator_type_convert_nc_f32_f16:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_convert_nc_f32_f16(
+          opdata->operator_object,
+          opdata->batch_size,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+      case xnn_operator_type_convert_nc_f32_qs8:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_convert_nc_f32_qs8(
+          opdata->operator_object,
+          opdata->batch_size,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+      case xnn_operator_type_convert_nc_qs8_f32:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_convert_nc_qs8_f32(
+          opdata->operator_object,
+          opdata->batch_size,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+#endif  // !defined(XNN_NO_VCVT_OPERATORS)
       case xnn_operator_type_copy_nc_x32:
         assert(runtime->blobs[opdata->inputs[0]].data != NULL);
         assert(runtime->blobs[opdata->outputs[0]].data != NULL);
@@ -1205,6 +2303,18 @@ enum xnn_status xnn_setup_runtime(
           runtime->blobs[opdata->outputs[0]].data,
           runtime->threadpool);
         break;
+#ifndef XNN_NO_QS8_OPERATORS
+      case xnn_operator_type_copy_nc_x8:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_copy_nc_x8(
+          opdata->operator_object,
+          opdata->batch_size,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
       case xnn_operator_type_clamp_nc_f32:
         assert(runtime->blobs[opdata->inputs[0]].data != NULL);
         assert(runtime->blobs[opdata->outputs[0]].data != NULL);
@@ -1288,6 +2398,28 @@ enum xnn_status xnn_setup_runtime(
           runtime->blobs[opdata->outputs[0]].data,
           runtime->threadpool);
         break;
+#ifndef XNN_NO_QS8_OPERATORS
+      case xnn_operator_type_fully_connected_nc_qd8_f32_qc8w:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_fully_connected_nc_qd8_f32_qc8w(
+          opdata->operator_object,
+          opdata->batch_size,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+      case xnn_operator_type_fully_connected_nc_qs8:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_fully_connected_nc_qs8(
+          opdata->operator_object,
+          opdata->batch_size,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
       case xnn_operator_type_floor_nc_f32:
         assert(runtime->blobs[opdata->inputs[0]].data != NULL);
         assert(runtime->blobs[opdata->outputs[0]].data != NULL);
@@ -1320,6 +2452,19 @@ enum xnn_status xnn_setup_runtime(
           runtime->blobs[opdata->outputs[0]].data,
           runtime->threadpool);
         break;
+#ifndef XNN_NO_F16_OPERATORS
+      case xnn_operator_type_global_average_pooling_nwc_f16:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_global_average_pooling_nwc_f16(
+          opdata->operator_object,
+          opdata->batch_size,
+          opdata->input_width,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
       case xnn_operator_type_hardswish_nc_f32:
         assert(runtime->blobs[opdata->inputs[0]].data != NULL);
         assert(runtime->blobs[opdata->outputs[0]].data != NULL);
@@ -1330,6 +2475,18 @@ enum xnn_status xnn_setup_runtime(
           runtime->blobs[opdata->outputs[0]].data,
           runtime->threadpool);
         break;
+#ifndef XNN_NO_F16_OPERATORS
+      case xnn_operator_type_hardswish_nc_f16:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_hardswish_nc_f16(
+          opdata->operator_object,
+          opdata->batch_size,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
       case xnn_operator_type_leaky_relu_nc_f32:
         assert(runtime->blobs[opdata->inputs[0]].data != NULL);
         assert(runtime->blobs[opdata->outputs[0]].data != NULL);
@@ -1397,6 +2554,23 @@ enum xnn_status xnn_setup_runtime(
           runtime->blobs[opdata->outputs[0]].data,
           runtime->threadpool);
         break;
+#ifndef XNN_NO_F16_OPERATORS
+      case xnn_operator_type_multiply_nd_f16:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->inputs[1]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_multiply_nd_f16(
+          opdata->operator_object,
+          opdata->shape1.num_dims,
+          opdata->shape1.dim,
+          opdata->shape2.num_dims,
+          opdata->shape2.dim,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->inputs[1]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
       case xnn_operator_type_negate_nc_f32:
         assert(runtime->blobs[opdata->inputs[0]].data != NULL);
         assert(runtime->blobs[opdata->outputs[0]].data != NULL);
@@ -1515,6 +2689,32 @@ enum xnn_status xnn_setup_runtime(
           runtime->blobs[opdata->outputs[0]].data,
           runtime->threadpool);
         break;
+#ifndef XNN_NO_QS8_OPERATORS
+      case xnn_operator_type_transpose_nd_x8:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_transpose_nd_x8(
+          opdata->operator_object,
+          opdata->shape1.num_dims,
+          opdata->shape1.dim,
+          opdata->perm,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+      case xnn_operator_type_transpose_nd_x32:
+        assert(runtime->blobs[opdata->inputs[0]].data != NULL);
+        assert(runtime->blobs[opdata->outputs[0]].data != NULL);
+        status = xnn_setup_transpose_nd_x32(
+          opdata->operator_object,
+          opdata->shape1.num_dims,
+          opdata->shape1.dim,
+          opdata->perm,
+          runtime->blobs[opdata->inputs[0]].data,
+          runtime->blobs[opdata->outputs[0]].data,
+          runtime->threadpool);
+        break;
       case xnn_operator_type_unpooling_nhwc_x32:
         assert(runtime->blobs[opdata->inputs[0]].data != NULL);
         assert(runtime->blobs[opdata->inputs[1]].data != NULL);
@@ -1540,19 +2740,141 @@ enum xnn_status xnn_setup_runtime(
     }
   }
 
+  runtime->workspace_data = workspace_data;
+  runtime->has_been_setup = true;
+  return xnn_status_success;
+}
+
+// Run the operator, and record its wall time if the runtime profiles operators.
+static enum xnn_status run_operator(
+  struct xnn_operator_data* opdata,
+  pthreadpool_t threadpool,
+  bool profiling)
+{
+  if (!profiling) {
+    return xnn_run_operator(opdata->operator_object, threadpool);
+  }
+
+  const uint64_t start_ns = xnn_read_timer_ns();
+  const enum xnn_status status = xnn_run_operator(opdata->operator_object, threadpool);
+  const uint64_t time_ns = xnn_read_timer_ns() - start_ns;
+  opdata->num_runs += 1;
+  opdata->last_time_ns = time_ns;
+  opdata->total_time_ns += time_ns;
+  return status;
+}
+
+// Whether the operator is small enough to run single-threaded, concurrently with the other operators on its level.
+static bool is_concurrent_operator(
+  const struct xnn_runtime* runtime,
+  const struct xnn_operator_data* opdata)
+{
+  return runtime->blobs[opdata->outputs[0]].size <= XNN_MAX_CONCURRENT_OPERATOR_OUTPUT_SIZE;
+}
+
+struct level_context {
+  const struct xnn_runtime* runtime;
+  struct xnn_operator_data* opdata;
+  const uint32_t* level_ops;
+  // Status of each operator on the level. Each element is written only by the thread which runs the operator.
+  enum xnn_status* level_status;
+  bool profiling;
+};
+
+static void run_level_operator(
+  const struct level_context* context,
+  size_t index)
+{
+  struct xnn_operator_data* opdata = &context->opdata[context->level_ops[index]];
+  if (!is_concurrent_operator(context->runtime, opdata)) {
+    // Operator already ran on the whole thread pool.
+    return;
+  }
+
+  // Operator runs single-threaded, concurrently with the other small operators on the same level.
+  context->level_status[index] = run_operator(opdata, NULL, context->profiling);
+}
+
+static enum xnn_status invoke_runtime_by_levels(
+  xnn_runtime_t runtime)
+{
+  for (uint32_t l = 0; l < runtime->num_levels; l++) {
+    const uint32_t* level_ops = runtime->level_ops + runtime->level_offsets[l];
+    const size_t level_size = runtime->level_offsets[l + 1] - runtime->level_offsets[l];
+    if (level_size == 1) {
+      // Single operator on the level gets the whole thread pool.
+      const enum xnn_status status =
+        run_operator(&runtime->opdata[level_ops[0]], runtime->threadpool, runtime->profiling);
+      if (status != xnn_status_success) {
+        return status;
+      }
+      continue;
+    }
+
+    // Large operators have enough parallel work for the whole thread pool, and run one after another on all threads.
+    // Only the small operators on the level run concurrently, each on a single thread.
+    enum xnn_status* level_status = runtime->level_status + runtime->level_offsets[l];
+    size_t num_concurrent_ops = 0;
+    size_t last_concurrent_op = 0;
+    for (size_t i = 0; i < level_size; i++) {
+      struct xnn_operator_data* opdata = &runtime->opdata[level_ops[i]];
+      if (is_concurrent_operator(runtime, opdata)) {
+        num_concurrent_ops += 1;
+        last_concurrent_op = i;
+      } else {
+        level_status[i] = run_operator(opdata, runtime->threadpool, runtime->profiling);
+      }
+    }
+    if (num_concurrent_ops == 1) {
+      level_status[last_concurrent_op] =
+        run_operator(&runtime->opdata[level_ops[last_concurrent_op]], runtime->threadpool, runtime->profiling);
+    } else if (num_concurrent_ops > 1) {
+      struct level_context context = {
+        .runtime = runtime,
+        .opdata = runtime->opdata,
+        .level_ops = level_ops,
+        .level_status = level_status,
+        .profiling = runtime->profiling,
+      };
+      pthreadpool_parallelize_1d(
+        runtime->threadpool,
+        (pthreadpool_task_1d_t) run_level_operator,
+        &context,
+        level_size,
+        PTHREADPOOL_FLAG_DISABLE_DENORMALS /* flags */);
+    }
+
+    // Report the failure of the first operator on the level in execution order. The other operators on the level ran
+    // to completion, but the operators on the following levels don't run.
+    for (size_t i = 0; i < level_size; i++) {
+      if (level_status[i] != xnn_status_success) {
+        xnn_log_error("failed to invoke runtime: error in operator #%" PRIu32, level_ops[i]);
+        return level_status[i];
+      }
+    }
+  }
   return xnn_status_success;
 }
 
 enum xnn_status xnn_invoke_runtime(
   xnn_runtime_t runtime)
 {
+  if (!runtime->has_been_setup || runtime->workspace_data != runtime->workspace->data) {
+    xnn_log_error("failed to invoke runtime: runtime must be set up after creation, reshape, or workspace reallocation");
+    return xnn_status_invalid_state;
+  }
+
+  if (runtime->op_levels != NULL && pthreadpool_get_threads_count(runtime->threadpool) > 1) {
+    return invoke_runtime_by_levels(runtime);
+  }
+
   for (size_t i = 0; i < runtime->num_ops; i++) {
     if (runtime->opdata[i].operator_object == NULL) {
       // Operator was removed after fusion
       continue;
     }
 
-    const enum xnn_status status = xnn_run_operator(runtime->opdata[i].operator_object, runtime->threadpool);
+    const enum xnn_status status = run_operator(&runtime->opdata[i], runtime->threadpool, runtime->profiling);
     if (status != xnn_status_success) {
       return status;
     }
@@ -1560,6 +2882,64 @@ enum xnn_status xnn_invoke_runtime(
   return xnn_status_success;
 }
 
+enum xnn_status xnn_get_runtime_profile(
+  xnn_runtime_t runtime,
+  size_t max_operators,
+  struct xnn_operator_profile* operator_profiles,
+  size_t* num_operators_out)
+{
+  if (!runtime->profiling) {
+    xnn_log_error("failed to get runtime profile: runtime was created without XNN_FLAG_BASIC_PROFILING");
+    return xnn_status_invalid_state;
+  }
+
+  size_t num_operators = 0;
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    if (runtime->opdata[i].operator_object != NULL) {
+      num_operators += 1;
+    }
+  }
+  *num_operators_out = num_operators;
+  if (operator_profiles == NULL) {
+    return xnn_status_success;
+  }
+  if (max_operators < num_operators) {
+    xnn_log_error(
+      "failed to get runtime profile: space for %zu operators is insufficient for %zu operators in the runtime",
+      max_operators, num_operators);
+    return xnn_status_invalid_parameter;
+  }
+
+  const xnn_subgraph_t subgraph = runtime->subgraph;
+  struct xnn_operator_profile* profile = operator_profiles;
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    const struct xnn_operator_data* opdata = &runtime->opdata[i];
+    if (opdata->operator_object == NULL) {
+      continue;
+    }
+
+    const struct xnn_node* node = &subgraph->nodes[i];
+    memset(profile, 0, sizeof(struct xnn_operator_profile));
+    profile->operator_name = xnn_operator_type_to_string(opdata->operator_object->type);
+    profile->node_id = node->original_id;
+    if (node->num_inputs != 0) {
+      const struct xnn_shape* input_shape = &subgraph->values[node->inputs[0]].shape;
+      profile->num_input_dims = input_shape->num_dims;
+      memcpy(profile->input_dims, input_shape->dim, input_shape->num_dims * sizeof(size_t));
+    }
+    if (node->num_outputs != 0) {
+      const struct xnn_shape* output_shape = &subgraph->values[node->outputs[0]].shape;
+      profile->num_output_dims = output_shape->num_dims;
+      memcpy(profile->output_dims, output_shape->dim, output_shape->num_dims * sizeof(size_t));
+    }
+    profile->num_runs = opdata->num_runs;
+    profile->last_time_ns = opdata->last_time_ns;
+    profile->total_time_ns = opdata->total_time_ns;
+    profile++;
+  }
+  return xnn_status_success;
+}
+
 enum xnn_status xnn_delete_runtime(
   xnn_runtime_t runtime)
 {
@@ -1569,10 +2949,15 @@ enum xnn_status xnn_delete_runtime(
         xnn_delete_operator(runtime->opdata[i].operator_object);
       }
       xnn_release_memory(runtime->opdata);
+      xnn_release_memory(runtime->op_levels);
+      xnn_release_memory(runtime->level_ops);
+      xnn_release_memory(runtime->level_offsets);
+      xnn_release_memory(runtime->level_status);
 
       xnn_release_memory(runtime->blobs);
-      xnn_release_simd_memory(runtime->workspace);
     }
+    xnn_delete_subgraph(runtime->subgraph);
+    xnn_release_workspace(runtime->workspace);
     xnn_release_memory(runtime);
   }
   return xnn_status_success;
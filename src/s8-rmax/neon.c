@@ -0,0 +1,46 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/rmax.h>
+
+
+void xnn_s8_rmax_ukernel__neon(
+    size_t n,
+    const int8_t* x,
+    int8_t* y)
+{
+  assert(n != 0);
+
+  if XNN_LIKELY(n >= 16) {
+    int8x16_t vmax = vmovq_n_s8(INT8_MIN);
+    do {
+      const int8x16_t vx = vld1q_s8(x); x += 16;
+      vmax = vmaxq_s8(vmax, vx);
+      n -= 16;
+    } while (n >= 16);
+    if (n != 0) {
+      const size_t x_increment = n - 16;
+      x = (const int8_t*) ((uintptr_t) x + x_increment);
+      const int8x16_t vx = vld1q_s8(x);
+      vmax = vmaxq_s8(vmax, vx);
+    }
+    int8x8_t vmax8 = vmax_s8(vget_low_s8(vmax), vget_high_s8(vmax));
+    const int8x8_t vmax4 = vpmax_s8(vmax8, vmax8);
+    const int8x8_t vmax2 = vpmax_s8(vmax4, vmax4);
+    const int8x8_t vmax1 = vpmax_s8(vmax2, vmax2);
+    vst1_lane_s8(y, vmax1, 0);
+  } else {
+    int8x8_t vmax = vmov_n_s8(INT8_MIN);
+    do {
+      const int8x8_t vx = vld1_dup_s8(x); x += 1;
+      vmax = vmax_s8(vmax, vx);
+    } while (--n != 0);
+    vst1_lane_s8(y, vmax, 0);
+  }
+}
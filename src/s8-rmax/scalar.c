@@ -0,0 +1,34 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/rmax.h>
+
+
+void xnn_s8_rmax_ukernel__scalar(
+    size_t n,
+    const int8_t* x,
+    int8_t* y)
+{
+  assert(n != 0);
+
+  int8_t vmax0 = INT8_MIN;
+  int8_t vmax1 = INT8_MIN;
+  for (; n >= 2 * sizeof(int8_t); n -= 2 * sizeof(int8_t)) {
+    const int8_t vt0 = x[0];
+    const int8_t vt1 = x[1];
+    x += 2;
+
+    vmax0 = vt0 > vmax0 ? vt0 : vmax0;
+    vmax1 = vt1 > vmax1 ? vt1 : vmax1;
+  }
+  int8_t vmax = vmax0 > vmax1 ? vmax0 : vmax1;
+  if (n != 0) {
+    const int8_t vt = *x++;
+    vmax = vt > vmax ? vt : vmax;
+  }
+  *y = vmax;
+}
@@ -0,0 +1,50 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/rmax.h>
+
+
+void xnn_s8_rmax_ukernel__sse2(
+    size_t n,
+    const int8_t* x,
+    int8_t* y)
+{
+  assert(n != 0);
+
+  if XNN_LIKELY(n >= 16) {
+    // SSE2 lacks signed 8-bit maximum: flip the sign bit to map signed order onto unsigned order, and use PMAXUB.
+    const __m128i vsign = _mm_set1_epi8(INT8_MIN);
+    __m128i vmax = _mm_setzero_si128();
+    do {
+      const __m128i vx = _mm_xor_si128(_mm_loadu_si128((const __m128i*) x), vsign);
+      x += 16;
+      vmax = _mm_max_epu8(vmax, vx);
+      n -= 16;
+    } while (n >= 16);
+    if (n != 0) {
+      const size_t x_increment = n - 16;
+      x = (const int8_t*) ((uintptr_t) x + x_increment);
+      const __m128i vx = _mm_xor_si128(_mm_loadu_si128((const __m128i*) x), vsign);
+      vmax = _mm_max_epu8(vmax, vx);
+    }
+    vmax = _mm_max_epu8(vmax, _mm_unpackhi_epi64(vmax, vmax));
+    vmax = _mm_max_epu8(vmax, _mm_srli_epi64(vmax, 32));
+    vmax = _mm_max_epu8(vmax, _mm_srli_epi32(vmax, 16));
+    vmax = _mm_max_epu8(vmax, _mm_srli_epi16(vmax, 8));
+    vmax = _mm_xor_si128(vmax, vsign);
+    *y = (int8_t) _mm_cvtsi128_si32(vmax);
+  } else {
+    int8_t vmax = INT8_MIN;
+    do {
+      const int8_t vx = *x++;
+      vmax = vx > vmax ? vx : vmax;
+    } while (--n != 0);
+    *y = vmax;
+  }
+}
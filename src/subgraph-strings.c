@@ -28,12 +28,20 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Average Pooling 2D";
     case xnn_node_type_bankers_rounding:
       return "Bankers Rounding";
+    case xnn_node_type_batch_matrix_multiply:
+      return "Batch Matrix Multiply";
     case xnn_node_type_ceiling:
       return "Ceiling";
     case xnn_node_type_clamp:
       return "Clamp";
+    case xnn_node_type_concatenate:
+      return "Concatenate";
+    case xnn_node_type_convert:
+      return "Convert";
     case xnn_node_type_convolution_2d:
       return "Convolution 2D";
+    case xnn_node_type_copy:
+      return "Copy";
     case xnn_node_type_deconvolution_2d:
       return "Deconvolution 2D";
     case xnn_node_type_depthwise_convolution_2d:
@@ -70,12 +78,16 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Sigmoid";
     case xnn_node_type_softmax:
       return "Softmax";
+    case xnn_node_type_split:
+      return "Split";
     case xnn_node_type_static_constant_pad:
       return "Static Constant Pad";
     case xnn_node_type_static_reshape:
       return "Static Reshape";
     case xnn_node_type_static_resize_bilinear_2d:
       return "Static Resize Bilinear 2D";
+    case xnn_node_type_static_transpose:
+      return "Static Transpose";
     case xnn_node_type_square:
       return "Square";
     case xnn_node_type_square_root:
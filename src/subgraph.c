@@ -7,6 +7,9 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+
+#include <fp16.h>
 
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
@@ -119,6 +122,7 @@ struct xnn_node* xnn_subgraph_new_node(xnn_subgraph_t subgraph)
   subgraph->num_nodes = size + 1;
   struct xnn_node* new_node = nodes + size;
   new_node->id = size;
+  new_node->original_id = size;
   return new_node;
 }
 
@@ -128,6 +132,10 @@ struct xnn_node* xnn_subgraph_new_node(xnn_subgraph_t subgraph)
 #define XNN_LAYOUT_FLAG_INCOMPATIBLE_CLUSTER 8
 
 uint32_t xnn_check_nchw_compatibility(xnn_subgraph_t subgraph, struct xnn_node* node) {
+  if (node->flags & XNN_FLAG_FUSED_HARDSWISH) {
+    // NCHW operators don't support fused HardSwish activation.
+    return 0;
+  }
   switch (node->type) {
     case xnn_node_type_convolution_2d:
       // Supported cases:
@@ -486,9 +494,343 @@ void xnn_subgraph_rewrite_for_nchw(xnn_subgraph_t subgraph)
   }
 }
 
-enum xnn_status xnn_subgraph_optimize(
+static float* allocate_static_data(xnn_subgraph_t subgraph, size_t size)
+{
+  void** static_data = xnn_reallocate_memory(subgraph->static_data, (subgraph->num_static_data + 1) * sizeof(void*));
+  if (static_data == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for subgraph static data descriptors",
+      (subgraph->num_static_data + 1) * sizeof(void*));
+    return NULL;
+  }
+  subgraph->static_data = static_data;
+
+  void* data = xnn_allocate_memory(size);
+  if (data == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for subgraph static data", size);
+    return NULL;
+  }
+  static_data[subgraph->num_static_data++] = data;
+  return data;
+}
+
+// Checks if a static F32 Value can be broadcasted as per-channel parameters to a tensor with the specified number of
+// dimensions and channels in the last dimension.
+static bool is_per_channel_static_value(const struct xnn_value* value, size_t num_dims, size_t channels)
+{
+  if (value->data == NULL || value->datatype != xnn_datatype_fp32) {
+    return false;
+  }
+  if (value->shape.num_dims > num_dims) {
+    return false;
+  }
+  for (size_t i = 0; i + 1 < value->shape.num_dims; i++) {
+    if (value->shape.dim[i] != 1) {
+      return false;
+    }
+  }
+  return value->shape.num_dims == 0 ||
+    value->shape.dim[value->shape.num_dims - 1] == 1 || value->shape.dim[value->shape.num_dims - 1] == channels;
+}
+
+// Fold Multiply2 or Add2 consumer Node with a static per-channel operand into the filter and bias of the producer F32
+// [Depthwise] Convolution 2D or Fully Connected Node. Returns true if the consumer Node was folded.
+static bool fold_per_channel_multiply_add(
   xnn_subgraph_t subgraph,
-  uint32_t flags)
+  uint32_t producer_id,
+  uint32_t consumer_id,
+  uint32_t value_id)
+{
+  struct xnn_node* producer = &subgraph->nodes[producer_id];
+  struct xnn_node* consumer = &subgraph->nodes[consumer_id];
+  struct xnn_value* value = &subgraph->values[value_id];
+  assert(consumer->type == xnn_node_type_multiply2 || consumer->type == xnn_node_type_add2);
+
+  // Output channels of the producer, and the number of consecutive filter elements of one output channel.
+  size_t channels = 0;
+  size_t filter_channel_size = 0;
+  switch (producer->type) {
+    case xnn_node_type_convolution_2d:
+      channels = producer->params.convolution_2d.groups * producer->params.convolution_2d.group_output_channels;
+      filter_channel_size = producer->params.convolution_2d.kernel_height *
+        producer->params.convolution_2d.kernel_width * producer->params.convolution_2d.group_input_channels;
+      break;
+    case xnn_node_type_depthwise_convolution_2d:
+      channels = producer->params.depthwise_convolution_2d.input_channels *
+        producer->params.depthwise_convolution_2d.depth_multiplier;
+      filter_channel_size = 1;
+      break;
+    case xnn_node_type_fully_connected:
+      channels = subgraph->values[producer->inputs[1]].shape.dim[0];
+      filter_channel_size = subgraph->values[producer->inputs[1]].shape.dim[1];
+      break;
+    default:
+      return false;
+  }
+  if (value->datatype != xnn_datatype_fp32 || value->shape.num_dims == 0 ||
+      value->shape.dim[value->shape.num_dims - 1] != channels)
+  {
+    return false;
+  }
+
+  // Filter and bias are modified in place, and must not be shared with other Nodes.
+  assert(producer->num_inputs == 3);
+  struct xnn_value* filter = &subgraph->values[producer->inputs[1]];
+  struct xnn_value* bias = &subgraph->values[producer->inputs[2]];
+  if (filter->datatype != xnn_datatype_fp32 || filter->data == NULL || filter->num_consumers != 1 ||
+      bias->datatype != xnn_datatype_fp32 || bias->data == NULL || bias->num_consumers != 1)
+  {
+    return false;
+  }
+
+  assert(consumer->num_inputs == 2);
+  const uint32_t parameter_id = consumer->inputs[0] == value_id ? consumer->inputs[1] : consumer->inputs[0];
+  const struct xnn_value* parameter = &subgraph->values[parameter_id];
+  if (parameter_id == value_id || !is_per_channel_static_value(parameter, value->shape.num_dims, channels)) {
+    return false;
+  }
+  const float* parameter_data = (const float*) parameter->data;
+  const size_t parameter_stride = xnn_tensor_get_size(subgraph, parameter_id) == sizeof(float) ? 0 : 1;
+
+  const size_t bias_size = channels * sizeof(float);
+  float* new_bias = allocate_static_data(subgraph, bias_size);
+  if (new_bias == NULL) {
+    return false;
+  }
+  const float* old_bias = (const float*) bias->data;
+  if (consumer->type == xnn_node_type_multiply2) {
+    const size_t filter_size = xnn_tensor_get_size(subgraph, producer->inputs[1]);
+    float* new_filter = allocate_static_data(subgraph, filter_size);
+    if (new_filter == NULL) {
+      return false;
+    }
+    const float* old_filter = (const float*) filter->data;
+    for (size_t i = 0; i < filter_size / sizeof(float); i++) {
+      new_filter[i] = old_filter[i] * parameter_data[(i / filter_channel_size) % channels * parameter_stride];
+    }
+    for (size_t c = 0; c < channels; c++) {
+      new_bias[c] = old_bias[c] * parameter_data[c * parameter_stride];
+    }
+    filter->data = new_filter;
+  } else {
+    for (size_t c = 0; c < channels; c++) {
+      new_bias[c] = old_bias[c] + parameter_data[c * parameter_stride];
+    }
+  }
+  bias->data = new_bias;
+
+  xnn_log_info("fold %s Node #%"PRIu32" into upstream Node #%"PRIu32,
+    xnn_node_type_to_string(consumer->type), consumer_id, producer_id);
+  assert(producer->num_outputs == 1);
+  assert(consumer->num_outputs == 1);
+
+  const uint32_t fused_output_id = consumer->outputs[0];
+  assert(fused_output_id < subgraph->num_values);
+  subgraph->values[fused_output_id].producer = producer_id;
+  producer->outputs[0] = fused_output_id;
+  producer->activation.output_min = consumer->activation.output_min;
+  producer->activation.output_max = consumer->activation.output_max;
+
+  subgraph->values[parameter_id].num_consumers -= 1;
+  xnn_node_clear(consumer);
+  xnn_value_clear(value);
+  return true;
+}
+
+// Check if the runtime creates the operator of the Node with a configurable channel stride of its first input and its
+// output, so that it can read its input from, or write its output to, a slice of the channels of a larger tensor.
+static bool supports_channel_stride(const xnn_subgraph_t subgraph, const struct xnn_node* node)
+{
+  switch (node->type) {
+    case xnn_node_type_average_pooling_2d:
+    case xnn_node_type_clamp:
+    case xnn_node_type_convert:
+    case xnn_node_type_convolution_2d:
+    case xnn_node_type_copy:
+    case xnn_node_type_depthwise_convolution_2d:
+    case xnn_node_type_fully_connected:
+    case xnn_node_type_hardswish:
+    case xnn_node_type_max_pooling_2d:
+      break;
+    default:
+      return false;
+  }
+  assert(node->num_inputs >= 1);
+  assert(node->num_outputs == 1);
+  return subgraph->values[node->inputs[0]].layout == xnn_layout_type_nhwc &&
+    subgraph->values[node->outputs[0]].layout == xnn_layout_type_nhwc;
+}
+
+// Check if all Nodes which consume the Value can read it as a slice of the channels of a larger tensor.
+static bool consumers_support_channel_stride(const xnn_subgraph_t subgraph, uint32_t value_id)
+{
+  const struct xnn_value* value = &subgraph->values[value_id];
+  if (value->flags & XNN_VALUE_FLAG_EXTERNAL_OUTPUT) {
+    return false;
+  }
+  for (uint32_t n = value->first_consumer; n < subgraph->num_nodes; n++) {
+    const struct xnn_node* node = &subgraph->nodes[n];
+    for (uint32_t i = 0; i < node->num_inputs; i++) {
+      if (node->inputs[i] != value_id) {
+        continue;
+      }
+      if (i != 0 || !supports_channel_stride(subgraph, node)) {
+        return false;
+      }
+      if (node->type == xnn_node_type_fully_connected &&
+          value->shape.dim[value->shape.num_dims - 1] != subgraph->values[node->inputs[1]].shape.dim[1])
+      {
+        // Fully Connected operator flattens the input to a different number of channels.
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Insert an empty Node before the Node at index 'node_index', and update the Node indices of the Values and Nodes.
+static struct xnn_node* insert_node(xnn_subgraph_t subgraph, uint32_t node_index)
+{
+  if (xnn_subgraph_new_node(subgraph) == NULL) {
+    return NULL;
+  }
+
+  struct xnn_node* nodes = subgraph->nodes;
+  const uint32_t num_nodes = subgraph->num_nodes;
+  memmove(nodes + node_index + 1, nodes + node_index, (num_nodes - 1 - node_index) * sizeof(struct xnn_node));
+  for (uint32_t n = node_index + 1; n < num_nodes; n++) {
+    nodes[n].id = n;
+  }
+  for (uint32_t i = 0; i < subgraph->num_values; i++) {
+    struct xnn_value* value = &subgraph->values[i];
+    if (value->producer != XNN_INVALID_NODE_ID && value->producer >= node_index) {
+      value->producer += 1;
+    }
+    if (value->first_consumer != XNN_INVALID_NODE_ID && value->first_consumer >= node_index) {
+      value->first_consumer += 1;
+    }
+  }
+
+  struct xnn_node* node = &nodes[node_index];
+  memset(node, 0, sizeof(struct xnn_node));
+  node->id = node_index;
+  return node;
+}
+
+// Insert a Copy Node from Value 'input_id' to a new internal Value with the same shape before the Node at index
+// 'node_index', and return the ID of the new Value, or XNN_INVALID_VALUE_ID if memory allocation failed. The Copy Node
+// takes the original ID of the Node it is inserted for.
+static uint32_t insert_copy_node(
+  xnn_subgraph_t subgraph,
+  uint32_t node_index,
+  uint32_t input_id,
+  uint32_t original_id)
+{
+  struct xnn_node* copy_node = insert_node(subgraph, node_index);
+  if (copy_node == NULL) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  struct xnn_value* output_value = xnn_subgraph_new_internal_value(subgraph);
+  if (output_value == NULL) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  const uint32_t output_id = output_value->id;
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  *output_value = *input_value;
+  output_value->id = output_id;
+  output_value->flags = 0;
+  output_value->data = NULL;
+  output_value->producer = node_index;
+  output_value->first_consumer = XNN_INVALID_NODE_ID;
+  output_value->num_consumers = 0;
+  output_value->num_nchw_compatible_consumers = 0;
+
+  copy_node = &subgraph->nodes[node_index];
+  copy_node->original_id = original_id;
+  copy_node->type = xnn_node_type_copy;
+  copy_node->activation.output_min = -INFINITY;
+  copy_node->activation.output_max = +INFINITY;
+  copy_node->num_inputs = 1;
+  copy_node->inputs[0] = input_id;
+  copy_node->num_outputs = 1;
+  copy_node->outputs[0] = output_id;
+  return output_id;
+}
+
+// Make every input of Concatenate Nodes and every output of Split Nodes a view of a slice of the channels of the Node
+// output or input. The producer of a Concatenate input then writes directly into the Concatenate output, and the
+// consumers of a Split output read directly from the Split input. Where the producer or the consumers can't access the
+// Value with a channel stride, a Copy Node between the view and the Value is inserted.
+static enum xnn_status insert_copies_for_channel_views(xnn_subgraph_t subgraph)
+{
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    switch (subgraph->nodes[n].type) {
+      case xnn_node_type_concatenate:
+        for (uint32_t i = 0; i < subgraph->nodes[n].num_inputs; i++) {
+          const uint32_t input_id = subgraph->nodes[n].inputs[i];
+          const struct xnn_value* input_value = &subgraph->values[input_id];
+          // External outputs are written to the buffers of the user, and can't be views of the Concatenate output.
+          if (input_value->producer != XNN_INVALID_NODE_ID && input_value->num_consumers == 1 &&
+              (input_value->flags & XNN_VALUE_FLAG_EXTERNAL_OUTPUT) == 0 &&
+              supports_channel_stride(subgraph, &subgraph->nodes[input_value->producer]))
+          {
+            continue;
+          }
+
+          // The Copy Node takes the index of the Concatenate Node, which moves to the next index.
+          xnn_log_info("insert Copy Node for input #%"PRIu32" of Concatenate Node #%"PRIu32, i, n);
+          const uint32_t view_id = insert_copy_node(subgraph, n, input_id, subgraph->nodes[n].original_id);
+          if (view_id == XNN_INVALID_VALUE_ID) {
+            return xnn_status_out_of_memory;
+          }
+          n += 1;
+          struct xnn_value* input = &subgraph->values[input_id];
+          if (input->first_consumer == n) {
+            input->first_consumer = n - 1;
+          }
+          struct xnn_value* view = &subgraph->values[view_id];
+          view->first_consumer = n;
+          view->num_consumers = 1;
+          subgraph->nodes[n].inputs[i] = view_id;
+        }
+        break;
+      case xnn_node_type_split:
+        for (uint32_t o = 0; o < subgraph->nodes[n].num_outputs; o++) {
+          const uint32_t output_id = subgraph->nodes[n].outputs[o];
+          if (subgraph->values[output_id].type == xnn_value_type_invalid) {
+            // Output is not used.
+            continue;
+          }
+          if (consumers_support_channel_stride(subgraph, output_id)) {
+            continue;
+          }
+
+          // The Copy Node is inserted right after the Split Node, and becomes the producer of the output.
+          xnn_log_info("insert Copy Node for output #%"PRIu32" of Split Node #%"PRIu32, o, n);
+          const uint32_t view_id = insert_copy_node(subgraph, n + 1, output_id, subgraph->nodes[n].original_id);
+          if (view_id == XNN_INVALID_VALUE_ID) {
+            return xnn_status_out_of_memory;
+          }
+          struct xnn_node* copy_node = &subgraph->nodes[n + 1];
+          copy_node->inputs[0] = view_id;
+          copy_node->outputs[0] = output_id;
+          struct xnn_value* view = &subgraph->values[view_id];
+          view->producer = n;
+          view->first_consumer = n + 1;
+          view->num_consumers = 1;
+          subgraph->values[output_id].producer = n + 1;
+          subgraph->nodes[n].outputs[o] = view_id;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  return xnn_status_success;
+}
+
+// Initialize producer and consumer fields of the Values from the inputs and outputs of the Nodes, and remove Values
+// which are not referenced by any Node.
+static void analyze_subgraph(xnn_subgraph_t subgraph)
 {
   // Initialize producer/consumer fields to safe defaults.
   for (uint32_t i = 0; i < subgraph->num_values; i++) {
@@ -536,6 +878,352 @@ enum xnn_status xnn_subgraph_optimize(
       xnn_value_clear(value);
     }
   }
+}
+
+// Check if an F16 operator can clamp to the output range of the Node after rounding the range to half precision.
+static bool supports_fp16_output_range(const struct xnn_node* node)
+{
+  return fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(node->activation.output_min)) <
+    fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(node->activation.output_max));
+}
+
+// Check if the runtime can create an F16 operator for the F32 Node.
+static bool is_fp16_compatible_node(const xnn_subgraph_t subgraph, const struct xnn_node* node)
+{
+  bool packs_static_inputs = false;
+  switch (node->type) {
+    case xnn_node_type_convolution_2d:
+    case xnn_node_type_depthwise_convolution_2d:
+      if ((node->flags & XNN_FLAG_FUSED_HARDSWISH) != 0 || !supports_fp16_output_range(node)) {
+        return false;
+      }
+      packs_static_inputs = true;
+      break;
+    case xnn_node_type_add2:
+    case xnn_node_type_global_average_pooling_2d:
+    case xnn_node_type_multiply2:
+      if (!supports_fp16_output_range(node)) {
+        return false;
+      }
+      break;
+    case xnn_node_type_hardswish:
+      break;
+    default:
+      return false;
+  }
+
+  for (uint32_t i = 0; i < node->num_inputs; i++) {
+    const struct xnn_value* value = &subgraph->values[node->inputs[i]];
+    if (value->datatype != xnn_datatype_fp32 || value->layout != xnn_layout_type_nhwc || value->shape.num_dims == 0) {
+      return false;
+    }
+    // Convolution operators pack the static filter and bias when they are created, but other operators read static
+    // inputs when they run, after the subgraph which owns the half-precision copy of static data may be deleted.
+    if (value->data != NULL && (i == 0 || !packs_static_inputs)) {
+      return false;
+    }
+  }
+  for (uint32_t o = 0; o < node->num_outputs; o++) {
+    const struct xnn_value* value = &subgraph->values[node->outputs[o]];
+    if (value->datatype != xnn_datatype_fp32 || value->layout != xnn_layout_type_nhwc || value->shape.num_dims == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Create an internal F16 Value with the same shape and layout as the F32 Value 'fp32_id', and return its ID, or
+// XNN_INVALID_VALUE_ID if memory allocation failed.
+static uint32_t new_fp16_value(xnn_subgraph_t subgraph, uint32_t fp32_id)
+{
+  struct xnn_value* fp16_value = xnn_subgraph_new_internal_value(subgraph);
+  if (fp16_value == NULL) {
+    return XNN_INVALID_VALUE_ID;
+  }
+  const uint32_t fp16_id = fp16_value->id;
+  *fp16_value = subgraph->values[fp32_id];
+  fp16_value->id = fp16_id;
+  fp16_value->datatype = xnn_datatype_fp16;
+  fp16_value->flags = 0;
+  fp16_value->data = NULL;
+  return fp16_id;
+}
+
+// Replace input 'old_id' of the F16 Nodes with 'new_id'.
+static void replace_fp16_consumers_input(
+  xnn_subgraph_t subgraph,
+  const bool* fp16_nodes,
+  uint32_t num_nodes,
+  uint32_t old_id,
+  uint32_t new_id)
+{
+  for (uint32_t n = subgraph->values[old_id].first_consumer; n < num_nodes; n++) {
+    if (!fp16_nodes[n]) {
+      continue;
+    }
+    struct xnn_node* node = &subgraph->nodes[n];
+    for (uint32_t i = 0; i < node->num_inputs; i++) {
+      if (node->inputs[i] == old_id) {
+        node->inputs[i] = new_id;
+      }
+    }
+  }
+}
+
+enum xnn_status xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
+{
+  const uint32_t num_nodes = subgraph->num_nodes;
+  const uint32_t num_values = subgraph->num_values;
+  if (num_nodes == 0) {
+    return xnn_status_success;
+  }
+
+  analyze_subgraph(subgraph);
+
+  enum xnn_status status = xnn_status_out_of_memory;
+  // Convert Nodes to insert, and their positions: 2 * N before Node #N, and 2 * N + 1 after Node #N. Every Value gets
+  // at most one Convert Node.
+  struct xnn_node* convert_nodes = NULL;
+  uint32_t* convert_positions = NULL;
+  uint32_t num_convert_nodes = 0;
+  bool* fp16_nodes = xnn_allocate_zero_memory(num_nodes * sizeof(bool));
+  if (fp16_nodes == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for F16 Node markers", num_nodes * sizeof(bool));
+    goto cleanup;
+  }
+
+  size_t num_fp16_nodes = 0;
+  for (uint32_t n = 0; n < num_nodes; n++) {
+    const struct xnn_node* node = &subgraph->nodes[n];
+    if (node->type != xnn_node_type_invalid && is_fp16_compatible_node(subgraph, node)) {
+      xnn_log_info("run %s Node #%"PRIu32" in half precision", xnn_node_type_to_string(node->type), n);
+      fp16_nodes[n] = true;
+      num_fp16_nodes += 1;
+    }
+  }
+  if (num_fp16_nodes == 0) {
+    status = xnn_status_success;
+    goto cleanup;
+  }
+
+  convert_nodes = xnn_allocate_zero_memory(num_values * sizeof(struct xnn_node));
+  convert_positions = xnn_allocate_zero_memory(num_values * sizeof(uint32_t));
+  if (convert_nodes == NULL || convert_positions == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for Convert Nodes",
+      num_values * (sizeof(struct xnn_node) + sizeof(uint32_t)));
+    goto cleanup;
+  }
+
+  for (uint32_t i = 0; i < num_values; i++) {
+    struct xnn_value* value = &subgraph->values[i];
+    if (value->type == xnn_value_type_invalid || value->datatype != xnn_datatype_fp32) {
+      continue;
+    }
+
+    // External outputs count as F32 consumers.
+    uint32_t num_fp16_consumers = 0;
+    uint32_t num_fp32_consumers = (value->flags & XNN_VALUE_FLAG_EXTERNAL_OUTPUT) ? 1 : 0;
+    uint32_t first_fp16_consumer = XNN_INVALID_NODE_ID;
+    for (uint32_t n = value->first_consumer; n < num_nodes; n++) {
+      const struct xnn_node* node = &subgraph->nodes[n];
+      for (uint32_t k = 0; k < node->num_inputs; k++) {
+        if (node->inputs[k] != i) {
+          continue;
+        }
+        if (fp16_nodes[n]) {
+          if (num_fp16_consumers++ == 0) {
+            first_fp16_consumer = n;
+          }
+        } else {
+          num_fp32_consumers += 1;
+        }
+      }
+    }
+    const bool fp16_producer = value->producer != XNN_INVALID_NODE_ID && fp16_nodes[value->producer];
+    if (!fp16_producer && num_fp16_consumers == 0) {
+      continue;
+    }
+
+    if (value->data != NULL) {
+      // Static filter and bias of F16 Convolution Nodes are converted once, and the operators pack the converted data.
+      const size_t num_elements = xnn_tensor_get_size(subgraph, i) / sizeof(float);
+      uint16_t* fp16_data = (uint16_t*) allocate_static_data(subgraph, num_elements * sizeof(uint16_t));
+      if (fp16_data == NULL) {
+        goto cleanup;
+      }
+      const float* fp32_data = (const float*) value->data;
+      for (size_t e = 0; e < num_elements; e++) {
+        fp16_data[e] = fp16_ieee_from_fp32_value(fp32_data[e]);
+      }
+      if (num_fp32_consumers == 0) {
+        value->datatype = xnn_datatype_fp16;
+        value->data = fp16_data;
+      } else {
+        const uint32_t fp16_id = new_fp16_value(subgraph, i);
+        if (fp16_id == XNN_INVALID_VALUE_ID) {
+          goto cleanup;
+        }
+        subgraph->values[fp16_id].data = fp16_data;
+        replace_fp16_consumers_input(subgraph, fp16_nodes, num_nodes, i, fp16_id);
+      }
+      continue;
+    }
+
+    if (fp16_producer && num_fp32_consumers == 0) {
+      value->datatype = xnn_datatype_fp16;
+      continue;
+    }
+
+    const uint32_t fp16_id = new_fp16_value(subgraph, i);
+    if (fp16_id == XNN_INVALID_VALUE_ID) {
+      goto cleanup;
+    }
+    replace_fp16_consumers_input(subgraph, fp16_nodes, num_nodes, i, fp16_id);
+
+    struct xnn_node* convert_node = &convert_nodes[num_convert_nodes];
+    convert_node->type = xnn_node_type_convert;
+    convert_node->activation.output_min = -INFINITY;
+    convert_node->activation.output_max = +INFINITY;
+    convert_node->num_inputs = 1;
+    convert_node->num_outputs = 1;
+    if (fp16_producer) {
+      // F16 producer writes the new Value, and a Convert Node after it converts to F32 for the F32 consumers.
+      struct xnn_node* producer = &subgraph->nodes[subgraph->values[i].producer];
+      convert_node->original_id = producer->original_id;
+      for (uint32_t o = 0; o < producer->num_outputs; o++) {
+        if (producer->outputs[o] == i) {
+          producer->outputs[o] = fp16_id;
+        }
+      }
+      convert_node->inputs[0] = fp16_id;
+      convert_node->outputs[0] = i;
+      convert_positions[num_convert_nodes++] = 2 * subgraph->values[i].producer + 1;
+    } else {
+      // F32 Value is converted right before its first F16 consumer.
+      convert_node->original_id = subgraph->nodes[first_fp16_consumer].original_id;
+      convert_node->inputs[0] = i;
+      convert_node->outputs[0] = fp16_id;
+      convert_positions[num_convert_nodes++] = 2 * first_fp16_consumer;
+    }
+  }
+
+  if (num_convert_nodes != 0) {
+    const uint32_t num_new_nodes = num_nodes + num_convert_nodes;
+    struct xnn_node* new_nodes = xnn_allocate_zero_memory(num_new_nodes * sizeof(struct xnn_node));
+    if (new_nodes == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for subgraph nodes", num_new_nodes * sizeof(struct xnn_node));
+      goto cleanup;
+    }
+    uint32_t new_node_id = 0;
+    for (uint32_t n = 0; n < num_nodes; n++) {
+      for (uint32_t c = 0; c < num_convert_nodes; c++) {
+        if (convert_positions[c] == 2 * n) {
+          new_nodes[new_node_id++] = convert_nodes[c];
+        }
+      }
+      new_nodes[new_node_id++] = subgraph->nodes[n];
+      for (uint32_t c = 0; c < num_convert_nodes; c++) {
+        if (convert_positions[c] == 2 * n + 1) {
+          new_nodes[new_node_id++] = convert_nodes[c];
+        }
+      }
+    }
+    assert(new_node_id == num_new_nodes);
+    for (uint32_t n = 0; n < num_new_nodes; n++) {
+      new_nodes[n].id = n;
+    }
+    xnn_release_memory(subgraph->nodes);
+    subgraph->nodes = new_nodes;
+    subgraph->num_nodes = num_new_nodes;
+    subgraph->num_reserved_nodes = num_new_nodes;
+    xnn_log_info("insert %"PRIu32" Convert Nodes for half-precision inference", num_convert_nodes);
+  }
+
+  analyze_subgraph(subgraph);
+  status = xnn_status_success;
+
+cleanup:
+  xnn_release_memory(convert_positions);
+  xnn_release_memory(convert_nodes);
+  xnn_release_memory(fp16_nodes);
+  return status;
+}
+
+// Check if the F32 operator for the [Depthwise] Convolution 2D or Fully Connected Node would use a micro-kernel with
+// fused HardSwish. Otherwise the operator applies HardSwish in a separate pass over its output, which is no faster than
+// a separate HardSwish Node, and keeping the Node leaves the producer free for other fusions.
+// Mirrors the micro-kernel selection in xnn_create_convolution2d_nhwc_f32 and xnn_create_fully_connected_nc_f32.
+static bool has_fused_hardswish_ukernel(const struct xnn_node* node)
+{
+  const bool has_gemm_hswish = xnn_params.f32.gemm.hswish.gemm.function[XNN_UARCH_DEFAULT] != NULL;
+  size_t group_input_channels, group_output_channels, kernel_size;
+  uint32_t subsampling, padding;
+  switch (node->type) {
+    case xnn_node_type_convolution_2d:
+      group_input_channels = node->params.convolution_2d.group_input_channels;
+      group_output_channels = node->params.convolution_2d.group_output_channels;
+      kernel_size = node->params.convolution_2d.kernel_height * node->params.convolution_2d.kernel_width;
+      subsampling = node->params.convolution_2d.subsampling_height | node->params.convolution_2d.subsampling_width;
+      padding = node->params.convolution_2d.input_padding_top | node->params.convolution_2d.input_padding_right |
+        node->params.convolution_2d.input_padding_bottom | node->params.convolution_2d.input_padding_left;
+      break;
+    case xnn_node_type_depthwise_convolution_2d:
+      group_input_channels = 1;
+      group_output_channels = node->params.depthwise_convolution_2d.depth_multiplier;
+      kernel_size =
+        node->params.depthwise_convolution_2d.kernel_height * node->params.depthwise_convolution_2d.kernel_width;
+      subsampling =
+        node->params.depthwise_convolution_2d.subsampling_height | node->params.depthwise_convolution_2d.subsampling_width;
+      padding = node->params.depthwise_convolution_2d.input_padding_top |
+        node->params.depthwise_convolution_2d.input_padding_right |
+        node->params.depthwise_convolution_2d.input_padding_bottom |
+        node->params.depthwise_convolution_2d.input_padding_left;
+      break;
+    case xnn_node_type_fully_connected:
+      return has_gemm_hswish;
+    default:
+      return false;
+  }
+  if (group_input_channels != 1 || group_output_channels != 1) {
+    return has_gemm_hswish;
+  }
+  if (kernel_size == 1 && subsampling == 1 && padding == 0 && xnn_params.f32.vmulcaddc.ukernel != NULL) {
+    // VMULCADDC micro-kernels don't fuse HardSwish.
+    return false;
+  }
+  // DWCONV micro-kernels fuse HardSwish only in the unipass variants. Find the unipass micro-kernel with the smallest
+  // primary tile which covers the whole kernel, or the multipass micro-kernel, like the operator does.
+  const struct dwconv_parameters* best_ukernel = NULL;
+  for (size_t i = 0; i < XNN_MAX_F32_DWCONV_UKERNELS; i++) {
+    const struct dwconv_parameters* ukernel = &xnn_params.f32.dwconv[i];
+    if (ukernel->primary_tile != 0) {
+      if (ukernel->incremental_tile == 0) {
+        if (ukernel->primary_tile >= kernel_size &&
+            (best_ukernel == NULL || best_ukernel->incremental_tile != 0 || ukernel->primary_tile < best_ukernel->primary_tile))
+        {
+          best_ukernel = ukernel;
+        }
+      } else if (best_ukernel == NULL && ukernel->primary_tile < kernel_size) {
+        best_ukernel = ukernel;
+      }
+    }
+  }
+  if (best_ukernel == NULL) {
+    // The operator falls back to GEMM or IGEMM micro-kernels.
+    return has_gemm_hswish;
+  }
+  return best_ukernel->incremental_tile == 0 && best_ukernel->hswish.unipass != NULL;
+}
+
+enum xnn_status xnn_subgraph_optimize(
+  xnn_subgraph_t subgraph,
+  uint32_t flags)
+{
+  analyze_subgraph(subgraph);
+
+  // Half-precision inference needs both F16 operators and micro-kernels for conversion between F32 and F16.
+  const bool fp16_inference = (flags & XNN_FLAG_FP16_INFERENCE) &&
+    (xnn_params.init_flags & XNN_INIT_FLAG_F16) && (xnn_params.init_flags & XNN_INIT_FLAG_VCVT);
 
   // Fuse Nodes where possible
   for (uint32_t i = 0; i < subgraph->num_values; i++) {
@@ -559,7 +1247,8 @@ enum xnn_status xnn_subgraph_optimize(
       assert(consumer->type != xnn_node_type_invalid);
 
       // Try to fuse Clamp Node upstream into producer Node
-      if (consumer->type == xnn_node_type_clamp) {
+      // Clamp can't be fused into a Node with fused HardSwish, because the producer would clamp before HardSwish.
+      if (consumer->type == xnn_node_type_clamp && (producer->flags & XNN_FLAG_FUSED_HARDSWISH) == 0) {
         switch (producer->type) {
           case xnn_node_type_add2:
           case xnn_node_type_average_pooling_2d:
@@ -594,6 +1283,43 @@ enum xnn_status xnn_subgraph_optimize(
             break;
         }
       }
+      // Try to fuse HardSwish Node upstream into F32 [Depthwise] Convolution 2D or Fully Connected Node
+      // F16 operators don't fuse HardSwish, so HardSwish stays a separate Node in half-precision inference, and so it
+      // does when the F32 operator has no micro-kernel with fused HardSwish.
+      if (consumer->type == xnn_node_type_hardswish && value->datatype == xnn_datatype_fp32 && !fp16_inference &&
+          producer->activation.output_min == -INFINITY && producer->activation.output_max == +INFINITY &&
+          (producer->flags & XNN_FLAG_FUSED_HARDSWISH) == 0 && has_fused_hardswish_ukernel(producer))
+      {
+        switch (producer->type) {
+          case xnn_node_type_convolution_2d:
+          case xnn_node_type_depthwise_convolution_2d:
+          case xnn_node_type_fully_connected:
+            xnn_log_info("fuse HardSwish Node #%"PRIu32" into upstream Node #%"PRIu32, consumer_id, producer_id);
+            assert(producer->num_outputs == 1);
+            assert(consumer->num_inputs == 1);
+            assert(consumer->num_outputs == 1);
+
+            const uint32_t fused_output_id = consumer->outputs[0];
+            assert(fused_output_id < subgraph->num_values);
+            subgraph->values[fused_output_id].producer = producer_id;
+            producer->outputs[0] = fused_output_id;
+            producer->flags |= XNN_FLAG_FUSED_HARDSWISH;
+
+            xnn_node_clear(consumer);
+            xnn_value_clear(value);
+            break;
+          default:
+            break;
+        }
+      }
+      // Try to fold Multiply2 or Add2 Node with static per-channel parameters into the filter and bias of upstream
+      // F32 [Depthwise] Convolution 2D or Fully Connected Node
+      if ((consumer->type == xnn_node_type_multiply2 || consumer->type == xnn_node_type_add2) &&
+          producer->activation.output_min == -INFINITY && producer->activation.output_max == +INFINITY &&
+          (producer->flags & XNN_FLAG_FUSED_HARDSWISH) == 0)
+      {
+        fold_per_channel_multiply_add(subgraph, producer_id, consumer_id, i);
+      }
       // Try to fuse Constant Pad node downstream into [Depthwise] Convolution 2D Node
       if (producer->type == xnn_node_type_static_constant_pad) {
         assert(producer->num_inputs == 1);
@@ -668,7 +1394,52 @@ enum xnn_status xnn_subgraph_optimize(
     }
   #endif
 
+  if (fp16_inference) {
+    const enum xnn_status status = xnn_subgraph_rewrite_for_fp16(subgraph);
+    if (status != xnn_status_success) {
+      return status;
+    }
+  }
+
+  return insert_copies_for_channel_views(subgraph);
+}
+
+enum xnn_status xnn_subgraph_clone(
+  xnn_subgraph_t subgraph,
+  xnn_subgraph_t* subgraph_out)
+{
+  struct xnn_subgraph* clone = xnn_allocate_zero_memory(sizeof(struct xnn_subgraph));
+  if (clone == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for subgraph descriptor", sizeof(struct xnn_subgraph));
+    goto error;
+  }
+
+  clone->external_value_ids = subgraph->external_value_ids;
+
+  clone->values = xnn_allocate_memory(subgraph->num_values * sizeof(struct xnn_value));
+  if (clone->values == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for subgraph values", subgraph->num_values * sizeof(struct xnn_value));
+    goto error;
+  }
+  memcpy(clone->values, subgraph->values, subgraph->num_values * sizeof(struct xnn_value));
+  clone->num_values = subgraph->num_values;
+  clone->num_reserved_values = subgraph->num_values;
+
+  clone->nodes = xnn_allocate_memory(subgraph->num_nodes * sizeof(struct xnn_node));
+  if (clone->nodes == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for subgraph nodes", subgraph->num_nodes * sizeof(struct xnn_node));
+    goto error;
+  }
+  memcpy(clone->nodes, subgraph->nodes, subgraph->num_nodes * sizeof(struct xnn_node));
+  clone->num_nodes = subgraph->num_nodes;
+  clone->num_reserved_nodes = subgraph->num_nodes;
+
+  *subgraph_out = clone;
   return xnn_status_success;
+
+error:
+  xnn_delete_subgraph(clone);
+  return xnn_status_out_of_memory;
 }
 
 enum xnn_status xnn_delete_subgraph(
@@ -681,6 +1452,11 @@ enum xnn_status xnn_delete_subgraph(
     memset(subgraph->values, 0, sizeof(struct xnn_value) * subgraph->num_values);
     xnn_release_memory(subgraph->values);
 
+    for (uint32_t i = 0; i < subgraph->num_static_data; i++) {
+      xnn_release_memory(subgraph->static_data[i]);
+    }
+    xnn_release_memory(subgraph->static_data);
+
     memset(subgraph, 0, sizeof(struct xnn_subgraph));
     xnn_release_memory(subgraph);
   }
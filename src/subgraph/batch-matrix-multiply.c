@@ -0,0 +1,195 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+
+
+enum xnn_status xnn_define_batch_matrix_multiply(
+  xnn_subgraph_t subgraph,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to define %s operator: XNNPACK is not initialized",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply));
+    return xnn_status_uninitialized;
+  }
+
+  if (input1_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with the first input ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input1_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* input1_value = &subgraph->values[input1_id];
+  if (input1_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with the first input ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input1_id, input1_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (input1_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with the first input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input1_id,
+        xnn_datatype_to_string(input1_value->datatype), input1_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (input1_value->shape.num_dims < 2) {
+    xnn_log_error(
+      "failed to define %s operator with the first input ID #%" PRIu32 ": unsupported number of dimensions %zu "
+      "(expected at least 2)",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input1_id, input1_value->shape.num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (input2_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with the second input ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input2_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* input2_value = &subgraph->values[input2_id];
+  if (input2_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with the second input ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input2_id, input2_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (input2_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with the second input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input2_id,
+        xnn_datatype_to_string(input2_value->datatype), input2_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  const size_t num_dims = input1_value->shape.num_dims;
+  if (input2_value->shape.num_dims != num_dims) {
+    xnn_log_error(
+      "failed to define %s operator with the second input ID #%" PRIu32 ": number of dimensions %zu doesn't match "
+      "the number of dimensions %zu of the first input",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input2_id,
+      input2_value->shape.num_dims, num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i + 2 < num_dims; i++) {
+    if (input2_value->shape.dim[i] != input1_value->shape.dim[i]) {
+      xnn_log_error(
+        "failed to define %s operator with the second input ID #%" PRIu32 ": batch dimension #%zu (%zu) doesn't match "
+        "the batch dimension of the first input (%zu)",
+        xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input2_id,
+        i, input2_value->shape.dim[i], input1_value->shape.dim[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  const size_t m = input1_value->shape.dim[num_dims - 2];
+  const size_t k = input1_value->shape.dim[num_dims - 1];
+  size_t input2_k = input2_value->shape.dim[num_dims - 2];
+  size_t n = input2_value->shape.dim[num_dims - 1];
+  if (flags & XNN_FLAG_TRANSPOSE_B) {
+    input2_k = input2_value->shape.dim[num_dims - 1];
+    n = input2_value->shape.dim[num_dims - 2];
+  }
+  if (input2_k != k) {
+    xnn_log_error(
+      "failed to define %s operator with the second input ID #%" PRIu32 ": K dimension (%zu) doesn't match "
+      "the K dimension of the first input (%zu)",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), input2_id, input2_k, k);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), output_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  if (output_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), output_id, output_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (output_value->shape.num_dims != num_dims) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": number of output dimensions %zu doesn't match "
+      "the number of input dimensions %zu",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), output_id,
+      output_value->shape.num_dims, num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i + 2 < num_dims; i++) {
+    if (output_value->shape.dim[i] != input1_value->shape.dim[i]) {
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": batch dimension #%zu (%zu) doesn't match "
+        "the batch dimension of the inputs (%zu)",
+        xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), output_id,
+        i, output_value->shape.dim[i], input1_value->shape.dim[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  if (output_value->shape.dim[num_dims - 2] != m || output_value->shape.dim[num_dims - 1] != n) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": output matrix dimensions %zux%zu don't match "
+      "the expected %zux%zu",
+      xnn_node_type_to_string(xnn_node_type_batch_matrix_multiply), output_id,
+      output_value->shape.dim[num_dims - 2], output_value->shape.dim[num_dims - 1], m, n);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_batch_matrix_multiply;
+  node->num_inputs = 2;
+  node->inputs[0] = input1_id;
+  node->inputs[1] = input2_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  return xnn_status_success;
+}
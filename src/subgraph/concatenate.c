@@ -0,0 +1,190 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+
+
+static enum xnn_status define_concatenate_n(
+  xnn_subgraph_t subgraph,
+  size_t num_inputs,
+  const uint32_t* input_ids,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to define %s operator: XNNPACK is not initialized",
+      xnn_node_type_to_string(xnn_node_type_concatenate));
+    return xnn_status_uninitialized;
+  }
+
+  if (output_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_concatenate), output_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  if (output_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_concatenate), output_id, output_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_concatenate), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  const size_t num_dims = output_value->shape.num_dims;
+  if (num_dims == 0) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": output must have at least one dimension",
+      xnn_node_type_to_string(xnn_node_type_concatenate), output_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  size_t channels = 0;
+  for (size_t i = 0; i < num_inputs; i++) {
+    const uint32_t input_id = input_ids[i];
+    if (input_id >= subgraph->num_values) {
+      xnn_log_error(
+        "failed to define %s operator with input #%zu ID #%" PRIu32 ": invalid Value ID",
+        xnn_node_type_to_string(xnn_node_type_concatenate), i + 1, input_id);
+      return xnn_status_invalid_parameter;
+    }
+
+    const struct xnn_value* input_value = &subgraph->values[input_id];
+    if (input_value->type != xnn_value_type_dense_tensor) {
+      xnn_log_error(
+        "failed to define %s operator with input #%zu ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+        xnn_node_type_to_string(xnn_node_type_concatenate), i + 1, input_id, input_value->type);
+      return xnn_status_invalid_parameter;
+    }
+
+    if (input_value->datatype != output_value->datatype) {
+      xnn_log_error(
+        "failed to define %s operator with input #%zu ID #%" PRIu32 " and output ID #%" PRIu32
+        ": mismatching datatypes across the input (%s) and output (%s)",
+        xnn_node_type_to_string(xnn_node_type_concatenate), i + 1, input_id, output_id,
+        xnn_datatype_to_string(input_value->datatype),
+        xnn_datatype_to_string(output_value->datatype));
+      return xnn_status_invalid_parameter;
+    }
+
+#ifndef XNN_NO_QS8_OPERATORS
+    if (output_value->datatype == xnn_datatype_qint8 &&
+        (input_value->quantization.zero_point != output_value->quantization.zero_point ||
+         input_value->quantization.scale != output_value->quantization.scale))
+    {
+      xnn_log_error(
+        "failed to define %s operator with input #%zu ID #%" PRIu32 " and output ID #%" PRIu32
+        ": mismatching quantization parameters across the input (zero point %" PRId32 ", scale %.7g) "
+        "and output (zero point %" PRId32 ", scale %.7g)",
+        xnn_node_type_to_string(xnn_node_type_concatenate), i + 1, input_id, output_id,
+        input_value->quantization.zero_point, input_value->quantization.scale,
+        output_value->quantization.zero_point, output_value->quantization.scale);
+      return xnn_status_invalid_parameter;
+    }
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+
+    if (input_value->shape.num_dims != num_dims) {
+      xnn_log_error(
+        "failed to define %s operator with input #%zu ID #%" PRIu32 ": number of input dimensions %zu doesn't match "
+        "the number of output dimensions %zu",
+        xnn_node_type_to_string(xnn_node_type_concatenate), i + 1, input_id, input_value->shape.num_dims, num_dims);
+      return xnn_status_invalid_parameter;
+    }
+
+    for (size_t d = 0; d + 1 < num_dims; d++) {
+      if (input_value->shape.dim[d] != output_value->shape.dim[d]) {
+        xnn_log_error(
+          "failed to define %s operator with input #%zu ID #%" PRIu32 ": input dimension #%zu (%zu) doesn't match "
+          "the output dimension (%zu)",
+          xnn_node_type_to_string(xnn_node_type_concatenate), i + 1, input_id, d,
+          input_value->shape.dim[d], output_value->shape.dim[d]);
+        return xnn_status_invalid_parameter;
+      }
+    }
+    channels += input_value->shape.dim[num_dims - 1];
+  }
+
+  if (channels != output_value->shape.dim[num_dims - 1]) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": %zu output channels don't match the sum of "
+      "input channels (%zu)",
+      xnn_node_type_to_string(xnn_node_type_concatenate), output_id, output_value->shape.dim[num_dims - 1], channels);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_concatenate;
+  node->num_inputs = (uint32_t) num_inputs;
+  for (size_t i = 0; i < num_inputs; i++) {
+    node->inputs[i] = input_ids[i];
+  }
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_concatenate2(
+  xnn_subgraph_t subgraph,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  const uint32_t input_ids[2] = { input1_id, input2_id };
+  return define_concatenate_n(subgraph, 2, input_ids, output_id, flags);
+}
+
+enum xnn_status xnn_define_concatenate3(
+  xnn_subgraph_t subgraph,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t input3_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  const uint32_t input_ids[3] = { input1_id, input2_id, input3_id };
+  return define_concatenate_n(subgraph, 3, input_ids, output_id, flags);
+}
+
+enum xnn_status xnn_define_concatenate4(
+  xnn_subgraph_t subgraph,
+  uint32_t input1_id,
+  uint32_t input2_id,
+  uint32_t input3_id,
+  uint32_t input4_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  const uint32_t input_ids[4] = { input1_id, input2_id, input3_id, input4_id };
+  return define_concatenate_n(subgraph, 4, input_ids, output_id, flags);
+}
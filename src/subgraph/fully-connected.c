@@ -4,6 +4,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <math.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -13,6 +14,26 @@
 #include <xnnpack/subgraph.h>
 
 
+static inline bool check_datatypes(
+  enum xnn_datatype input_datatype,
+  enum xnn_datatype filter_datatype,
+  enum xnn_datatype bias_datatype,
+  enum xnn_datatype output_datatype)
+{
+  switch (output_datatype) {
+    case xnn_datatype_fp32:
+      return input_datatype == xnn_datatype_fp32 &&
+        filter_datatype == xnn_datatype_fp32 && bias_datatype == xnn_datatype_fp32;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      return input_datatype == xnn_datatype_qint8 &&
+        filter_datatype == xnn_datatype_qint8 && bias_datatype == xnn_datatype_qint32;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
 enum xnn_status xnn_define_fully_connected(
   xnn_subgraph_t subgraph,
   float output_min,
@@ -67,6 +88,9 @@ enum xnn_status xnn_define_fully_connected(
 
   switch (input_value->datatype) {
     case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
       break;
     default:
       xnn_log_error(
@@ -101,6 +125,17 @@ enum xnn_status xnn_define_fully_connected(
   switch (filter_value->datatype) {
     case xnn_datatype_fp32:
       break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      if (filter_value->quantization.zero_point != 0) {
+        xnn_log_error(
+          "failed to define %s operator with filter ID #%" PRIu32 ": unsupported quantization zero point %" PRId32 " for datatype %s",
+          xnn_node_type_to_string(xnn_node_type_fully_connected), filter_id,
+          filter_value->quantization.zero_point, xnn_datatype_to_string(filter_value->datatype));
+        return xnn_status_invalid_parameter;
+      }
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
     default:
       xnn_log_error(
         "failed to define %s operator with filter ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
@@ -133,6 +168,9 @@ enum xnn_status xnn_define_fully_connected(
 
   switch (bias_value->datatype) {
     case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint32:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
       break;
     default:
       xnn_log_error(
@@ -159,6 +197,9 @@ enum xnn_status xnn_define_fully_connected(
 
   switch (output_value->datatype) {
     case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
       break;
     default:
       xnn_log_error(
@@ -168,6 +209,18 @@ enum xnn_status xnn_define_fully_connected(
       return xnn_status_invalid_parameter;
   }
 
+  if (!check_datatypes(input_value->datatype, filter_value->datatype, bias_value->datatype, output_value->datatype)) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ", filter ID #%" PRIu32 ", bias ID #%" PRIu32 ", and output ID #%" PRIu32
+      ": mismatching datatypes across input (%s), filter (%s), bias (%s), and output (%s)",
+      xnn_node_type_to_string(xnn_node_type_fully_connected), input_id, filter_id, bias_id, output_id,
+      xnn_datatype_to_string(input_value->datatype),
+      xnn_datatype_to_string(filter_value->datatype),
+      xnn_datatype_to_string(bias_value->datatype),
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
   struct xnn_node* node = xnn_subgraph_new_node(subgraph);
   if (node == NULL) {
     return xnn_status_out_of_memory;
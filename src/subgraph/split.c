@@ -0,0 +1,191 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+
+
+static enum xnn_status define_split_n(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  size_t num_outputs,
+  const uint32_t* output_ids,
+  uint32_t flags)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to define %s operator: XNNPACK is not initialized",
+      xnn_node_type_to_string(xnn_node_type_split));
+    return xnn_status_uninitialized;
+  }
+
+  if (input_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_split), input_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  if (input_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_split), input_id, input_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_split), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  const size_t num_dims = input_value->shape.num_dims;
+  if (num_dims == 0) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": input must have at least one dimension",
+      xnn_node_type_to_string(xnn_node_type_split), input_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  size_t channels = 0;
+  for (size_t i = 0; i < num_outputs; i++) {
+    const uint32_t output_id = output_ids[i];
+    if (output_id >= subgraph->num_values) {
+      xnn_log_error(
+        "failed to define %s operator with output #%zu ID #%" PRIu32 ": invalid Value ID",
+        xnn_node_type_to_string(xnn_node_type_split), i + 1, output_id);
+      return xnn_status_invalid_parameter;
+    }
+
+    const struct xnn_value* output_value = &subgraph->values[output_id];
+    if (output_value->type != xnn_value_type_dense_tensor) {
+      xnn_log_error(
+        "failed to define %s operator with output #%zu ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+        xnn_node_type_to_string(xnn_node_type_split), i + 1, output_id, output_value->type);
+      return xnn_status_invalid_parameter;
+    }
+
+    if (output_value->datatype != input_value->datatype) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 " and output #%zu ID #%" PRIu32
+        ": mismatching datatypes across the input (%s) and output (%s)",
+        xnn_node_type_to_string(xnn_node_type_split), input_id, i + 1, output_id,
+        xnn_datatype_to_string(input_value->datatype),
+        xnn_datatype_to_string(output_value->datatype));
+      return xnn_status_invalid_parameter;
+    }
+
+#ifndef XNN_NO_QS8_OPERATORS
+    if (input_value->datatype == xnn_datatype_qint8 &&
+        (output_value->quantization.zero_point != input_value->quantization.zero_point ||
+         output_value->quantization.scale != input_value->quantization.scale))
+    {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 " and output #%zu ID #%" PRIu32
+        ": mismatching quantization parameters across the input (zero point %" PRId32 ", scale %.7g) "
+        "and output (zero point %" PRId32 ", scale %.7g)",
+        xnn_node_type_to_string(xnn_node_type_split), input_id, i + 1, output_id,
+        input_value->quantization.zero_point, input_value->quantization.scale,
+        output_value->quantization.zero_point, output_value->quantization.scale);
+      return xnn_status_invalid_parameter;
+    }
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+
+    if (output_value->shape.num_dims != num_dims) {
+      xnn_log_error(
+        "failed to define %s operator with output #%zu ID #%" PRIu32 ": number of output dimensions %zu doesn't "
+        "match the number of input dimensions %zu",
+        xnn_node_type_to_string(xnn_node_type_split), i + 1, output_id, output_value->shape.num_dims, num_dims);
+      return xnn_status_invalid_parameter;
+    }
+
+    for (size_t d = 0; d + 1 < num_dims; d++) {
+      if (output_value->shape.dim[d] != input_value->shape.dim[d]) {
+        xnn_log_error(
+          "failed to define %s operator with output #%zu ID #%" PRIu32 ": output dimension #%zu (%zu) doesn't "
+          "match the input dimension (%zu)",
+          xnn_node_type_to_string(xnn_node_type_split), i + 1, output_id, d,
+          output_value->shape.dim[d], input_value->shape.dim[d]);
+        return xnn_status_invalid_parameter;
+      }
+    }
+    channels += output_value->shape.dim[num_dims - 1];
+  }
+
+  if (channels != input_value->shape.dim[num_dims - 1]) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": %zu input channels don't match the sum of "
+      "output channels (%zu)",
+      xnn_node_type_to_string(xnn_node_type_split), input_id, input_value->shape.dim[num_dims - 1], channels);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_split;
+  node->num_inputs = 1;
+  node->inputs[0] = input_id;
+  node->num_outputs = (uint32_t) num_outputs;
+  for (size_t i = 0; i < num_outputs; i++) {
+    node->outputs[i] = output_ids[i];
+    node->params.split.channels[i] = subgraph->values[output_ids[i]].shape.dim[num_dims - 1];
+  }
+  node->flags = flags;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_split2(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output1_id,
+  uint32_t output2_id,
+  uint32_t flags)
+{
+  const uint32_t output_ids[2] = { output1_id, output2_id };
+  return define_split_n(subgraph, input_id, 2, output_ids, flags);
+}
+
+enum xnn_status xnn_define_split3(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output1_id,
+  uint32_t output2_id,
+  uint32_t output3_id,
+  uint32_t flags)
+{
+  const uint32_t output_ids[3] = { output1_id, output2_id, output3_id };
+  return define_split_n(subgraph, input_id, 3, output_ids, flags);
+}
+
+enum xnn_status xnn_define_split4(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output1_id,
+  uint32_t output2_id,
+  uint32_t output3_id,
+  uint32_t output4_id,
+  uint32_t flags)
+{
+  const uint32_t output_ids[4] = { output1_id, output2_id, output3_id, output4_id };
+  return define_split_n(subgraph, input_id, 4, output_ids, flags);
+}
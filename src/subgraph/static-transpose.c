@@ -0,0 +1,163 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+
+
+enum xnn_status xnn_define_static_transpose(
+  xnn_subgraph_t subgraph,
+  size_t num_dims,
+  const size_t* perm,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to define %s operator: XNNPACK is not initialized",
+      xnn_node_type_to_string(xnn_node_type_static_transpose));
+    return xnn_status_uninitialized;
+  }
+
+  if (num_dims == 0 || num_dims > XNN_MAX_TENSOR_DIMS) {
+    xnn_log_error(
+      "failed to define %s operator with %zu dimensions: number of dimensions must be in [1, %zu] range",
+      xnn_node_type_to_string(xnn_node_type_static_transpose), num_dims, (size_t) XNN_MAX_TENSOR_DIMS);
+    return xnn_status_invalid_parameter;
+  }
+
+  bool is_permuted_dim[XNN_MAX_TENSOR_DIMS] = { false };
+  for (size_t i = 0; i < num_dims; i++) {
+    if (perm[i] >= num_dims || is_permuted_dim[perm[i]]) {
+      xnn_log_error(
+        "failed to define %s operator: invalid permutation: element #%zu (%zu) is out of [0, %zu) range or repeated",
+        xnn_node_type_to_string(xnn_node_type_static_transpose), i, perm[i], num_dims);
+      return xnn_status_invalid_parameter;
+    }
+    is_permuted_dim[perm[i]] = true;
+  }
+
+  if (input_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_static_transpose), input_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  if (input_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_static_transpose), input_id, input_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_static_transpose), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (input_value->shape.num_dims != num_dims) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": number of input dimensions %zu doesn't match "
+      "the number of permuted dimensions %zu",
+      xnn_node_type_to_string(xnn_node_type_static_transpose), input_id, input_value->shape.num_dims, num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_static_transpose), output_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  if (output_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_static_transpose), output_id, output_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (input_value->datatype != output_value->datatype) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": mismatching datatypes across the input (%s) and output (%s)",
+      xnn_node_type_to_string(xnn_node_type_static_transpose), input_id, output_id,
+      xnn_datatype_to_string(input_value->datatype),
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
+#ifndef XNN_NO_QS8_OPERATORS
+  if (output_value->datatype == xnn_datatype_qint8 &&
+      (input_value->quantization.zero_point != output_value->quantization.zero_point ||
+       input_value->quantization.scale != output_value->quantization.scale))
+  {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": mismatching quantization parameters across the input (zero point %" PRId32 ", scale %.7g) "
+      "and output (zero point %" PRId32 ", scale %.7g)",
+      xnn_node_type_to_string(xnn_node_type_static_transpose), input_id, output_id,
+      input_value->quantization.zero_point, input_value->quantization.scale,
+      output_value->quantization.zero_point, output_value->quantization.scale);
+    return xnn_status_invalid_parameter;
+  }
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+
+  if (output_value->shape.num_dims != num_dims) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": number of output dimensions %zu doesn't match "
+      "the number of permuted dimensions %zu",
+      xnn_node_type_to_string(xnn_node_type_static_transpose), output_id, output_value->shape.num_dims, num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_dims; i++) {
+    if (output_value->shape.dim[i] != input_value->shape.dim[perm[i]]) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+        ": output dimension #%zu (%zu) doesn't match input dimension #%zu (%zu)",
+        xnn_node_type_to_string(xnn_node_type_static_transpose), input_id, output_id,
+        i, output_value->shape.dim[i], perm[i], input_value->shape.dim[perm[i]]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->params.static_transpose.num_dims = num_dims;
+  memcpy(node->params.static_transpose.perm, perm, num_dims * sizeof(size_t));
+
+  node->type = xnn_node_type_static_transpose;
+  node->num_inputs = 1;
+  node->inputs[0] = input_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  return xnn_status_success;
+}
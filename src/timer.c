@@ -0,0 +1,54 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef _WIN32
+  // clock_gettime and CLOCK_MONOTONIC are POSIX extensions to C99.
+  #define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdint.h>
+
+#ifdef _WIN32
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <time.h>
+#endif
+
+#include <xnnpack/timer.h>
+
+
+#ifdef _WIN32
+// Frequency of the performance counter is fixed at system boot. Concurrent first calls store the same value.
+static volatile LONGLONG timer_frequency = 0;
+#endif
+
+uint64_t xnn_read_timer_ns(void)
+{
+#ifdef _WIN32
+  LONGLONG frequency = timer_frequency;
+  if (frequency == 0) {
+    LARGE_INTEGER query_frequency;
+    QueryPerformanceFrequency(&query_frequency);
+    frequency = query_frequency.QuadPart;
+    timer_frequency = frequency;
+  }
+  LARGE_INTEGER counter;
+  QueryPerformanceCounter(&counter);
+  // Split the counter into seconds and the remainder to avoid overflow in the conversion to nanoseconds.
+  const uint64_t seconds = (uint64_t) (counter.QuadPart / frequency);
+  const uint64_t remainder = (uint64_t) (counter.QuadPart % frequency);
+  return seconds * UINT64_C(1000000000) + remainder * UINT64_C(1000000000) / (uint64_t) frequency;
+#else
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t) time.tv_sec * UINT64_C(1000000000) + (uint64_t) time.tv_nsec;
+#endif
+}
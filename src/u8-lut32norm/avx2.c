@@ -0,0 +1,122 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <fxdiv.h>
+
+#include <xnnpack/lut.h>
+#include <xnnpack/common.h>
+
+
+void xnn_u8_lut32norm_ukernel__avx2(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t t[restrict XNN_MIN_ELEMENTS(256)],
+    uint8_t* y)
+{
+  assert(n != 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  // First pass: sum the looked up entries with 32-bit accumulation. Scalar loads are cheaper than VPGATHERDD.
+  const uint8_t* i = x;
+  size_t k = n;
+  uint32_t vsum0 = 0;
+  uint32_t vsum1 = 0;
+  uint32_t vsum2 = 0;
+  uint32_t vsum3 = 0;
+  for (; k >= 4; k -= 4) {
+    vsum0 += t[i[0]];
+    vsum1 += t[i[1]];
+    vsum2 += t[i[2]];
+    vsum3 += t[i[3]];
+    i += 4;
+  }
+  uint32_t vsum = (vsum0 + vsum1) + (vsum2 + vsum3);
+  for (; k != 0; k--) {
+    vsum += t[*i++];
+  }
+  assert(vsum != 0);
+
+  const struct fxdiv_divisor_uint32_t vsum_divisor = fxdiv_init_uint32_t(vsum);
+  const uint32_t vrounding = (vsum >> 1);
+  if XNN_LIKELY(n >= 32) {
+    // See the SSE4.1 micro-kernel for the normalization of the table entries.
+    const __m256i vmultiplier = _mm256_set1_epi32((int) vsum_divisor.m);
+    const __m128i vshift1 = _mm_cvtsi32_si128((int) vsum_divisor.s1);
+    const __m128i vshift2 = _mm_cvtsi32_si128((int) vsum_divisor.s2);
+    const __m256i vrounding_vec = _mm256_set1_epi32((int) vrounding);
+    const __m256i vmax = _mm256_set1_epi32(255);
+    const __m256i vpermute_mask = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    XNN_ALIGN(32) uint8_t vtable[256];
+    for (size_t j = 0; j < 256; j += 32) {
+      const __m256i vn0 = _mm256_add_epi32(_mm256_slli_epi32(_mm256_loadu_si256((const __m256i*) (t + j)), 8), vrounding_vec);
+      const __m256i vn1 = _mm256_add_epi32(_mm256_slli_epi32(_mm256_loadu_si256((const __m256i*) (t + j + 8)), 8), vrounding_vec);
+      const __m256i vn2 = _mm256_add_epi32(_mm256_slli_epi32(_mm256_loadu_si256((const __m256i*) (t + j + 16)), 8), vrounding_vec);
+      const __m256i vn3 = _mm256_add_epi32(_mm256_slli_epi32(_mm256_loadu_si256((const __m256i*) (t + j + 24)), 8), vrounding_vec);
+
+      const __m256i vhi0 = _mm256_blend_epi32(
+        _mm256_srli_epi64(_mm256_mul_epu32(vn0, vmultiplier), 32), _mm256_mul_epu32(_mm256_srli_epi64(vn0, 32), vmultiplier), 0xAA);
+      const __m256i vhi1 = _mm256_blend_epi32(
+        _mm256_srli_epi64(_mm256_mul_epu32(vn1, vmultiplier), 32), _mm256_mul_epu32(_mm256_srli_epi64(vn1, 32), vmultiplier), 0xAA);
+      const __m256i vhi2 = _mm256_blend_epi32(
+        _mm256_srli_epi64(_mm256_mul_epu32(vn2, vmultiplier), 32), _mm256_mul_epu32(_mm256_srli_epi64(vn2, 32), vmultiplier), 0xAA);
+      const __m256i vhi3 = _mm256_blend_epi32(
+        _mm256_srli_epi64(_mm256_mul_epu32(vn3, vmultiplier), 32), _mm256_mul_epu32(_mm256_srli_epi64(vn3, 32), vmultiplier), 0xAA);
+
+      __m256i vq0 = _mm256_srl_epi32(_mm256_add_epi32(vhi0, _mm256_srl_epi32(_mm256_sub_epi32(vn0, vhi0), vshift1)), vshift2);
+      __m256i vq1 = _mm256_srl_epi32(_mm256_add_epi32(vhi1, _mm256_srl_epi32(_mm256_sub_epi32(vn1, vhi1), vshift1)), vshift2);
+      __m256i vq2 = _mm256_srl_epi32(_mm256_add_epi32(vhi2, _mm256_srl_epi32(_mm256_sub_epi32(vn2, vhi2), vshift1)), vshift2);
+      __m256i vq3 = _mm256_srl_epi32(_mm256_add_epi32(vhi3, _mm256_srl_epi32(_mm256_sub_epi32(vn3, vhi3), vshift1)), vshift2);
+
+      vq0 = _mm256_min_epu32(vq0, vmax);
+      vq1 = _mm256_min_epu32(vq1, vmax);
+      vq2 = _mm256_min_epu32(vq2, vmax);
+      vq3 = _mm256_min_epu32(vq3, vmax);
+
+      // Packing works within 128-bit lanes, and leaves the 32-bit groups of the results interleaved between lanes.
+      __m256i vq = _mm256_packus_epi16(_mm256_packus_epi32(vq0, vq1), _mm256_packus_epi32(vq2, vq3));
+      vq = _mm256_permutevar8x32_epi32(vq, vpermute_mask);
+      _mm256_store_si256((__m256i*) &vtable[j], vq);
+    }
+
+    // Second pass: look up the normalized values. Scalar lookups in a 256-byte table are faster than VPSHUFB.
+    for (; n >= 4; n -= 4) {
+      const size_t vx0 = x[0];
+      const size_t vx1 = x[1];
+      const size_t vx2 = x[2];
+      const size_t vx3 = x[3];
+      x += 4;
+
+      const uint8_t vy0 = vtable[vx0];
+      const uint8_t vy1 = vtable[vx1];
+      const uint8_t vy2 = vtable[vx2];
+      const uint8_t vy3 = vtable[vx3];
+
+      y[0] = vy0;
+      y[1] = vy1;
+      y[2] = vy2;
+      y[3] = vy3;
+      y += 4;
+    }
+    if XNN_UNLIKELY(n != 0) {
+      do {
+        const size_t vx = *x++;
+        *y++ = vtable[vx];
+      } while (--n != 0);
+    }
+  } else {
+    // For short rows, normalizing the whole table costs more than normalizing each element.
+    do {
+      const size_t vx = *x++;
+      const uint32_t vq = fxdiv_quotient_uint32_t((t[vx] << 8) + vrounding, vsum_divisor);
+      *y++ = vq > 255 ? UINT8_C(255) : (uint8_t) vq;
+    } while (--n != 0);
+  }
+}
@@ -0,0 +1,117 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <fxdiv.h>
+
+#include <xnnpack/lut.h>
+#include <xnnpack/common.h>
+
+
+void xnn_u8_lut32norm_ukernel__neon(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t t[restrict XNN_MIN_ELEMENTS(256)],
+    uint8_t* y)
+{
+  assert(n != 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  // First pass: sum the looked up entries with 32-bit accumulation.
+  const uint8_t* i = x;
+  size_t k = n;
+  uint32_t vsum0 = 0;
+  uint32_t vsum1 = 0;
+  uint32_t vsum2 = 0;
+  uint32_t vsum3 = 0;
+  for (; k >= 4; k -= 4) {
+    vsum0 += t[i[0]];
+    vsum1 += t[i[1]];
+    vsum2 += t[i[2]];
+    vsum3 += t[i[3]];
+    i += 4;
+  }
+  uint32_t vsum = (vsum0 + vsum1) + (vsum2 + vsum3);
+  for (; k != 0; k--) {
+    vsum += t[*i++];
+  }
+  assert(vsum != 0);
+
+  const struct fxdiv_divisor_uint32_t vsum_divisor = fxdiv_init_uint32_t(vsum);
+  const uint32_t vrounding = (vsum >> 1);
+  if XNN_LIKELY(n >= 64) {
+    // Normalize all 256 table entries with vectorized fixed-point division and saturate them to 8 bits. Then the
+    // second pass reduces to byte table lookups, with neither 32-bit loads nor divisions per element.
+    const uint32x2_t vmultiplier = vdup_n_u32(vsum_divisor.m);
+    const int32x4_t vshift1 = vdupq_n_s32(-(int32_t) vsum_divisor.s1);
+    const int32x4_t vshift2 = vdupq_n_s32(-(int32_t) vsum_divisor.s2);
+    const uint32x4_t vrounding_vec = vdupq_n_u32(vrounding);
+
+    XNN_ALIGN(16) uint8_t vtable[256];
+    for (size_t j = 0; j < 256; j += 16) {
+      const uint32x4_t vn0 = vaddq_u32(vshlq_n_u32(vld1q_u32(t + j), 8), vrounding_vec);
+      const uint32x4_t vn1 = vaddq_u32(vshlq_n_u32(vld1q_u32(t + j + 4), 8), vrounding_vec);
+      const uint32x4_t vn2 = vaddq_u32(vshlq_n_u32(vld1q_u32(t + j + 8), 8), vrounding_vec);
+      const uint32x4_t vn3 = vaddq_u32(vshlq_n_u32(vld1q_u32(t + j + 12), 8), vrounding_vec);
+
+      const uint32x4_t vhi0 = vcombine_u32(
+        vshrn_n_u64(vmull_u32(vget_low_u32(vn0), vmultiplier), 32), vshrn_n_u64(vmull_u32(vget_high_u32(vn0), vmultiplier), 32));
+      const uint32x4_t vhi1 = vcombine_u32(
+        vshrn_n_u64(vmull_u32(vget_low_u32(vn1), vmultiplier), 32), vshrn_n_u64(vmull_u32(vget_high_u32(vn1), vmultiplier), 32));
+      const uint32x4_t vhi2 = vcombine_u32(
+        vshrn_n_u64(vmull_u32(vget_low_u32(vn2), vmultiplier), 32), vshrn_n_u64(vmull_u32(vget_high_u32(vn2), vmultiplier), 32));
+      const uint32x4_t vhi3 = vcombine_u32(
+        vshrn_n_u64(vmull_u32(vget_low_u32(vn3), vmultiplier), 32), vshrn_n_u64(vmull_u32(vget_high_u32(vn3), vmultiplier), 32));
+
+      const uint32x4_t vq0 = vshlq_u32(vaddq_u32(vhi0, vshlq_u32(vsubq_u32(vn0, vhi0), vshift1)), vshift2);
+      const uint32x4_t vq1 = vshlq_u32(vaddq_u32(vhi1, vshlq_u32(vsubq_u32(vn1, vhi1), vshift1)), vshift2);
+      const uint32x4_t vq2 = vshlq_u32(vaddq_u32(vhi2, vshlq_u32(vsubq_u32(vn2, vhi2), vshift1)), vshift2);
+      const uint32x4_t vq3 = vshlq_u32(vaddq_u32(vhi3, vshlq_u32(vsubq_u32(vn3, vhi3), vshift1)), vshift2);
+
+      // Unsigned saturating narrowing clamps the quotients to 255 in two steps.
+      const uint8x16_t vq = vcombine_u8(
+        vqmovn_u16(vcombine_u16(vqmovn_u32(vq0), vqmovn_u32(vq1))),
+        vqmovn_u16(vcombine_u16(vqmovn_u32(vq2), vqmovn_u32(vq3))));
+      vst1q_u8(&vtable[j], vq);
+    }
+
+    // Second pass: look up the normalized values.
+    for (; n >= 4; n -= 4) {
+      const size_t vx0 = x[0];
+      const size_t vx1 = x[1];
+      const size_t vx2 = x[2];
+      const size_t vx3 = x[3];
+      x += 4;
+
+      const uint8_t vy0 = vtable[vx0];
+      const uint8_t vy1 = vtable[vx1];
+      const uint8_t vy2 = vtable[vx2];
+      const uint8_t vy3 = vtable[vx3];
+
+      y[0] = vy0;
+      y[1] = vy1;
+      y[2] = vy2;
+      y[3] = vy3;
+      y += 4;
+    }
+    if XNN_UNLIKELY(n != 0) {
+      do {
+        const size_t vx = *x++;
+        *y++ = vtable[vx];
+      } while (--n != 0);
+    }
+  } else {
+    // For short rows, normalizing the whole table costs more than normalizing each element.
+    do {
+      const size_t vx = *x++;
+      const uint32_t vq = fxdiv_quotient_uint32_t((t[vx] << 8) + vrounding, vsum_divisor);
+      *y++ = vq > 255 ? UINT8_C(255) : (uint8_t) vq;
+    } while (--n != 0);
+  }
+}
@@ -0,0 +1,121 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <fxdiv.h>
+
+#include <xnnpack/lut.h>
+#include <xnnpack/common.h>
+
+
+void xnn_u8_lut32norm_ukernel__sse41(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t t[restrict XNN_MIN_ELEMENTS(256)],
+    uint8_t* y)
+{
+  assert(n != 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  // First pass: sum the looked up entries with 32-bit accumulation. Scalar loads are cheaper than gathering them.
+  const uint8_t* i = x;
+  size_t k = n;
+  uint32_t vsum0 = 0;
+  uint32_t vsum1 = 0;
+  uint32_t vsum2 = 0;
+  uint32_t vsum3 = 0;
+  for (; k >= 4; k -= 4) {
+    vsum0 += t[i[0]];
+    vsum1 += t[i[1]];
+    vsum2 += t[i[2]];
+    vsum3 += t[i[3]];
+    i += 4;
+  }
+  uint32_t vsum = (vsum0 + vsum1) + (vsum2 + vsum3);
+  for (; k != 0; k--) {
+    vsum += t[*i++];
+  }
+  assert(vsum != 0);
+
+  const struct fxdiv_divisor_uint32_t vsum_divisor = fxdiv_init_uint32_t(vsum);
+  const uint32_t vrounding = (vsum >> 1);
+  if XNN_LIKELY(n >= 64) {
+    // Normalize all 256 table entries with vectorized fixed-point division and saturate them to 8 bits. Then the
+    // second pass reduces to byte table lookups, with neither 32-bit loads nor divisions per element.
+    const __m128i vmultiplier = _mm_set1_epi32((int) vsum_divisor.m);
+    const __m128i vshift1 = _mm_cvtsi32_si128((int) vsum_divisor.s1);
+    const __m128i vshift2 = _mm_cvtsi32_si128((int) vsum_divisor.s2);
+    const __m128i vrounding_vec = _mm_set1_epi32((int) vrounding);
+    const __m128i vmax = _mm_set1_epi32(255);
+
+    XNN_ALIGN(16) uint8_t vtable[256];
+    for (size_t j = 0; j < 256; j += 16) {
+      const __m128i vn0 = _mm_add_epi32(_mm_slli_epi32(_mm_loadu_si128((const __m128i*) (t + j)), 8), vrounding_vec);
+      const __m128i vn1 = _mm_add_epi32(_mm_slli_epi32(_mm_loadu_si128((const __m128i*) (t + j + 4)), 8), vrounding_vec);
+      const __m128i vn2 = _mm_add_epi32(_mm_slli_epi32(_mm_loadu_si128((const __m128i*) (t + j + 8)), 8), vrounding_vec);
+      const __m128i vn3 = _mm_add_epi32(_mm_slli_epi32(_mm_loadu_si128((const __m128i*) (t + j + 12)), 8), vrounding_vec);
+
+      const __m128i vhi0 = _mm_blend_epi16(
+        _mm_srli_epi64(_mm_mul_epu32(vn0, vmultiplier), 32), _mm_mul_epu32(_mm_srli_epi64(vn0, 32), vmultiplier), 0xCC);
+      const __m128i vhi1 = _mm_blend_epi16(
+        _mm_srli_epi64(_mm_mul_epu32(vn1, vmultiplier), 32), _mm_mul_epu32(_mm_srli_epi64(vn1, 32), vmultiplier), 0xCC);
+      const __m128i vhi2 = _mm_blend_epi16(
+        _mm_srli_epi64(_mm_mul_epu32(vn2, vmultiplier), 32), _mm_mul_epu32(_mm_srli_epi64(vn2, 32), vmultiplier), 0xCC);
+      const __m128i vhi3 = _mm_blend_epi16(
+        _mm_srli_epi64(_mm_mul_epu32(vn3, vmultiplier), 32), _mm_mul_epu32(_mm_srli_epi64(vn3, 32), vmultiplier), 0xCC);
+
+      __m128i vq0 = _mm_srl_epi32(_mm_add_epi32(vhi0, _mm_srl_epi32(_mm_sub_epi32(vn0, vhi0), vshift1)), vshift2);
+      __m128i vq1 = _mm_srl_epi32(_mm_add_epi32(vhi1, _mm_srl_epi32(_mm_sub_epi32(vn1, vhi1), vshift1)), vshift2);
+      __m128i vq2 = _mm_srl_epi32(_mm_add_epi32(vhi2, _mm_srl_epi32(_mm_sub_epi32(vn2, vhi2), vshift1)), vshift2);
+      __m128i vq3 = _mm_srl_epi32(_mm_add_epi32(vhi3, _mm_srl_epi32(_mm_sub_epi32(vn3, vhi3), vshift1)), vshift2);
+
+      // PACKUSDW saturates signed inputs, so quotients are clamped as unsigned numbers first.
+      vq0 = _mm_min_epu32(vq0, vmax);
+      vq1 = _mm_min_epu32(vq1, vmax);
+      vq2 = _mm_min_epu32(vq2, vmax);
+      vq3 = _mm_min_epu32(vq3, vmax);
+
+      const __m128i vq = _mm_packus_epi16(_mm_packus_epi32(vq0, vq1), _mm_packus_epi32(vq2, vq3));
+      _mm_store_si128((__m128i*) &vtable[j], vq);
+    }
+
+    // Second pass: look up the normalized values. Scalar lookups in a 256-byte table are faster than PSHUFB.
+    for (; n >= 4; n -= 4) {
+      const size_t vx0 = x[0];
+      const size_t vx1 = x[1];
+      const size_t vx2 = x[2];
+      const size_t vx3 = x[3];
+      x += 4;
+
+      const uint8_t vy0 = vtable[vx0];
+      const uint8_t vy1 = vtable[vx1];
+      const uint8_t vy2 = vtable[vx2];
+      const uint8_t vy3 = vtable[vx3];
+
+      y[0] = vy0;
+      y[1] = vy1;
+      y[2] = vy2;
+      y[3] = vy3;
+      y += 4;
+    }
+    if XNN_UNLIKELY(n != 0) {
+      do {
+        const size_t vx = *x++;
+        *y++ = vtable[vx];
+      } while (--n != 0);
+    }
+  } else {
+    // For short rows, normalizing the whole table costs more than normalizing each element.
+    do {
+      const size_t vx = *x++;
+      const uint32_t vq = fxdiv_quotient_uint32_t((t[vx] << 8) + vrounding, vsum_divisor);
+      *y++ = vq > 255 ? UINT8_C(255) : (uint8_t) vq;
+    } while (--n != 0);
+  }
+}
@@ -0,0 +1,630 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/weights-cache.h>
+
+
+// Weights cache file layout:
+//   struct weights_cache_file_header header;
+//   struct weights_cache_file_entry entries[header.num_entries];
+//   packed weights of the entries, each aligned on XNN_ALLOCATION_ALIGNMENT bytes from the start of the file.
+#define XNN_WEIGHTS_CACHE_FILE_MAGIC UINT32_C(0x43574E58)  // "XNWC" in little-endian byte order
+#define XNN_WEIGHTS_CACHE_FILE_VERSION UINT32_C(2)
+
+struct weights_cache_file_header {
+  uint32_t magic;
+  uint32_t version;
+  // Digest of the micro-kernel configuration the packed weights were produced with.
+  uint64_t config_key[2];
+  uint64_t num_entries;
+};
+
+struct weights_cache_file_entry {
+  uint64_t key[2];
+  uint64_t size;
+  uint64_t offset;
+};
+
+static void lock_weights_cache(struct xnn_weights_cache* cache)
+{
+  #ifdef _WIN32
+    AcquireSRWLockExclusive(&cache->lock);
+  #else
+    pthread_mutex_lock(&cache->mutex);
+  #endif
+}
+
+static void unlock_weights_cache(struct xnn_weights_cache* cache)
+{
+  #ifdef _WIN32
+    ReleaseSRWLockExclusive(&cache->lock);
+  #else
+    pthread_mutex_unlock(&cache->mutex);
+  #endif
+}
+
+enum xnn_status xnn_create_weights_cache(xnn_weights_cache_t* weights_cache_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create weights cache: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  struct xnn_weights_cache* cache = xnn_allocate_zero_memory(sizeof(struct xnn_weights_cache));
+  if (cache == NULL) {
+    xnn_log_error("failed to allocate %zu bytes for weights cache descriptor", sizeof(struct xnn_weights_cache));
+    return xnn_status_out_of_memory;
+  }
+
+  #ifdef _WIN32
+    InitializeSRWLock(&cache->lock);
+  #else
+    if (pthread_mutex_init(&cache->mutex, NULL) != 0) {
+      xnn_log_error("failed to initialize weights cache mutex");
+      xnn_release_memory(cache);
+      return xnn_status_out_of_memory;
+    }
+  #endif
+  cache->ref_count = 1;
+  *weights_cache_out = cache;
+  return xnn_status_success;
+}
+
+static void unmap_weights_cache_file(void* mapping, size_t mapping_size)
+{
+  #ifdef _WIN32
+    (void) mapping_size;
+    UnmapViewOfFile(mapping);
+  #else
+    munmap(mapping, mapping_size);
+  #endif
+}
+
+// Must be called without the lock held: the last reference destroys the lock.
+static void unref_weights_cache(struct xnn_weights_cache* cache)
+{
+  lock_weights_cache(cache);
+  assert(cache->ref_count != 0);
+  const bool last_reference = --cache->ref_count == 0;
+  unlock_weights_cache(cache);
+
+  if (last_reference) {
+    // Operators hold a reference to the cache while using its packed weights, so only the memory-mapped entries are
+    // left by now.
+    for (size_t i = 0; i < cache->num_entries; i++) {
+      assert(cache->entries[i].mapped);
+      assert(cache->entries[i].ref_count == 0);
+    }
+    xnn_release_memory(cache->entries);
+    if (cache->mapping != NULL) {
+      unmap_weights_cache_file(cache->mapping, cache->mapping_size);
+    }
+    #ifndef _WIN32
+      pthread_mutex_destroy(&cache->mutex);
+    #endif
+    xnn_release_memory(cache);
+  }
+}
+
+enum xnn_status xnn_release_weights_cache(xnn_weights_cache_t weights_cache)
+{
+  if (weights_cache != NULL) {
+    unref_weights_cache(weights_cache);
+  }
+  return xnn_status_success;
+}
+
+static inline uint64_t rotl64(uint64_t x, uint32_t r)
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t fmix64(uint64_t k)
+{
+  k ^= k >> 33;
+  k *= UINT64_C(0xFF51AFD7ED558CCD);
+  k ^= k >> 33;
+  k *= UINT64_C(0xC4CEB9FE1A85EC53);
+  k ^= k >> 33;
+  return k;
+}
+
+// MurmurHash3 x64 128-bit digest of the data, seeded with the 128-bit digest of the preceding data.
+static void hash_bytes(struct xnn_weights_cache_key* key, const void* data, size_t size)
+{
+  const uint64_t c1 = UINT64_C(0x87C37B91114253D5);
+  const uint64_t c2 = UINT64_C(0x4CF5AD432745937F);
+  uint64_t h1 = key->hash[0];
+  uint64_t h2 = key->hash[1];
+
+  const uint8_t* bytes = (const uint8_t*) data;
+  size_t n = size;
+  for (; n >= 2 * sizeof(uint64_t); n -= 2 * sizeof(uint64_t)) {
+    uint64_t k1, k2;
+    memcpy(&k1, bytes, sizeof(k1));
+    memcpy(&k2, bytes + sizeof(k1), sizeof(k2));
+    bytes += 2 * sizeof(uint64_t);
+
+    k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+    h1 = rotl64(h1, 27); h1 += h2; h1 = h1 * 5 + UINT32_C(0x52DCE729);
+    k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+    h2 = rotl64(h2, 31); h2 += h1; h2 = h2 * 5 + UINT32_C(0x38495AB5);
+  }
+  if (n != 0) {
+    uint8_t tail[2 * sizeof(uint64_t)] = { 0 };
+    memcpy(tail, bytes, n);
+    uint64_t k1, k2;
+    memcpy(&k1, tail, sizeof(k1));
+    memcpy(&k2, tail + sizeof(k1), sizeof(k2));
+    k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+    k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+  }
+
+  h1 ^= (uint64_t) size;
+  h2 ^= (uint64_t) size;
+  h1 += h2;
+  h2 += h1;
+  h1 = fmix64(h1);
+  h2 = fmix64(h2);
+  h1 += h2;
+  h2 += h1;
+  key->hash[0] = h1;
+  key->hash[1] = h2;
+}
+
+static const struct xnn_weights_cache_key hash_seed = {
+  .hash = { UINT64_C(0x6A09E667F3BCC908), UINT64_C(0xBB67AE8584CAA73B) },
+};
+
+static bool equal_keys(const struct xnn_weights_cache_key* a, const struct xnn_weights_cache_key* b)
+{
+  return a->hash[0] == b->hash[0] && a->hash[1] == b->hash[1];
+}
+
+struct xnn_weights_cache_key xnn_weights_cache_compute_key(
+  const void* config,
+  size_t config_size,
+  const void* packing_params,
+  size_t packing_params_size,
+  const void* kernel,
+  size_t kernel_size,
+  const void* bias,
+  size_t bias_size)
+{
+  struct xnn_weights_cache_key key = hash_seed;
+  hash_bytes(&key, config, config_size);
+  hash_bytes(&key, packing_params, packing_params_size);
+  hash_bytes(&key, kernel, kernel_size);
+  if (bias != NULL) {
+    hash_bytes(&key, bias, bias_size);
+  } else {
+    // Distinguish missing bias from an all-zeroes bias.
+    key.hash[0] = ~key.hash[0];
+    key.hash[1] = ~key.hash[1];
+  }
+  return key;
+}
+
+void xnn_weights_cache_update_key(
+  struct xnn_weights_cache_key* key,
+  const void* data,
+  size_t size)
+{
+  hash_bytes(key, data, size);
+}
+
+// Digest of the micro-kernel configuration which determines the layout of packed weights on this processor.
+static struct xnn_weights_cache_key compute_config_key(void)
+{
+  const uint32_t config[] = {
+    (uint32_t) sizeof(void*),
+    (uint32_t) XNN_ALLOCATION_ALIGNMENT,
+    xnn_params.f32.gemm.mr, xnn_params.f32.gemm.nr, xnn_params.f32.gemm.log2_kr, xnn_params.f32.gemm.log2_sr,
+    xnn_params.f32.gemm2.mr, xnn_params.f32.gemm2.nr, xnn_params.f32.gemm2.log2_kr, xnn_params.f32.gemm2.log2_sr,
+    xnn_params.qs8.gemm.mr, xnn_params.qs8.gemm.nr, xnn_params.qs8.gemm.log2_kr, xnn_params.qs8.gemm.log2_sr,
+    xnn_params.qu8.gemm.mr, xnn_params.qu8.gemm.nr, xnn_params.qu8.gemm.log2_kr, xnn_params.qu8.gemm.log2_sr,
+    xnn_params.f32.dwconv[0].channel_tile, xnn_params.f32.dwconv[0].primary_tile,
+    xnn_params.f32.dwconv[1].channel_tile, xnn_params.f32.dwconv[1].primary_tile,
+    xnn_params.f32.dwconv[2].channel_tile, xnn_params.f32.dwconv[2].primary_tile,
+    xnn_params.qs8.dwconv[0].channel_tile, xnn_params.qs8.dwconv[0].primary_tile,
+    xnn_params.qu8.dwconv[0].channel_tile, xnn_params.qu8.dwconv[0].primary_tile,
+    xnn_params.f32.vmulcaddc.channel_tile,
+  };
+  struct xnn_weights_cache_key key = hash_seed;
+  hash_bytes(&key, config, sizeof(config));
+  return key;
+}
+
+// Make room for one more entry. Must be called with the lock held.
+static enum xnn_status reserve_entry(struct xnn_weights_cache* cache)
+{
+  if (cache->num_entries == cache->num_reserved_entries) {
+    const size_t num_reserved_entries = cache->num_reserved_entries == 0 ? 16 : cache->num_reserved_entries * 2;
+    struct xnn_weights_cache_entry* entries =
+      xnn_reallocate_memory(cache->entries, num_reserved_entries * sizeof(struct xnn_weights_cache_entry));
+    if (entries == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for weights cache entries",
+        num_reserved_entries * sizeof(struct xnn_weights_cache_entry));
+      return xnn_status_out_of_memory;
+    }
+    cache->entries = entries;
+    cache->num_reserved_entries = num_reserved_entries;
+  }
+  return xnn_status_success;
+}
+
+// Rebase the pointers into the packed weights after they were replaced with a copy at a different address.
+static void rebase_packed_weights_pointers(
+  xnn_operator_t op,
+  const void* old_packed_weights)
+{
+  if (op->ukernel.type == xnn_ukernel_type_subconv2d) {
+    const size_t subkernels = (size_t) op->stride_height * (size_t) op->stride_width;
+    struct subconvolution_params* subconvolution_params = op->subconvolution_buffer;
+    for (size_t i = 0; i < subkernels; i++) {
+      const size_t offset = (size_t) ((uintptr_t) subconvolution_params[i].weights - (uintptr_t) old_packed_weights);
+      subconvolution_params[i].weights = (void*) ((uintptr_t) op->packed_weights + offset);
+    }
+  }
+}
+
+// Find the entry with the key and retain a reference to it. Must be called with the lock held.
+static void* retain_entry(
+  struct xnn_weights_cache* cache,
+  const struct xnn_weights_cache_key* key,
+  size_t size)
+{
+  for (size_t i = 0; i < cache->num_entries; i++) {
+    struct xnn_weights_cache_entry* entry = &cache->entries[i];
+    if (equal_keys(&entry->key, key) && entry->size == size) {
+      entry->ref_count++;
+      cache->ref_count++;
+      return entry->packed_weights;
+    }
+  }
+  return NULL;
+}
+
+bool xnn_weights_cache_lookup_packed_weights(
+  struct xnn_weights_cache* cache,
+  const struct xnn_weights_cache_key* key,
+  xnn_operator_t op)
+{
+  assert(op->packed_weights == NULL);
+  assert(op->weights_cache == NULL);
+  if (cache == NULL) {
+    return false;
+  }
+
+  lock_weights_cache(cache);
+  void* packed_weights = retain_entry(cache, key, op->packed_weights_size);
+  unlock_weights_cache(cache);
+  if (packed_weights == NULL) {
+    return false;
+  }
+
+  op->packed_weights = packed_weights;
+  op->weights_cache = cache;
+  return true;
+}
+
+enum xnn_status xnn_weights_cache_insert_packed_weights(
+  struct xnn_weights_cache* cache,
+  const struct xnn_weights_cache_key* key,
+  xnn_operator_t op)
+{
+  if (cache == NULL || op->weights_cache != NULL) {
+    return xnn_status_success;
+  }
+  assert(op->packed_weights != NULL);
+
+  lock_weights_cache(cache);
+  void* packed_weights = retain_entry(cache, key, op->packed_weights_size);
+  if (packed_weights != NULL) {
+    // Another operator added the same packed weights after the lookup.
+    unlock_weights_cache(cache);
+
+    void* old_packed_weights = op->packed_weights;
+    op->packed_weights = packed_weights;
+    op->weights_cache = cache;
+    rebase_packed_weights_pointers(op, old_packed_weights);
+    xnn_release_simd_memory(old_packed_weights);
+    return xnn_status_success;
+  }
+
+  const enum xnn_status status = reserve_entry(cache);
+  if (status != xnn_status_success) {
+    unlock_weights_cache(cache);
+    return status;
+  }
+  cache->entries[cache->num_entries++] = (struct xnn_weights_cache_entry) {
+    .key = *key,
+    .size = op->packed_weights_size,
+    .packed_weights = op->packed_weights,
+    .ref_count = 1,
+  };
+  cache->ref_count++;
+  unlock_weights_cache(cache);
+
+  op->weights_cache = cache;
+  return xnn_status_success;
+}
+
+void xnn_weights_cache_release_packed_weights(
+  struct xnn_weights_cache* cache,
+  void* packed_weights)
+{
+  lock_weights_cache(cache);
+  for (size_t i = 0; i < cache->num_entries; i++) {
+    struct xnn_weights_cache_entry* entry = &cache->entries[i];
+    if (entry->packed_weights == packed_weights) {
+      assert(entry->ref_count != 0);
+      if (--entry->ref_count == 0 && !entry->mapped) {
+        xnn_release_simd_memory(entry->packed_weights);
+        // Entries are unordered: move the last entry into the vacated slot.
+        *entry = cache->entries[--cache->num_entries];
+      }
+      break;
+    }
+  }
+  unlock_weights_cache(cache);
+
+  unref_weights_cache(cache);
+}
+
+// Check if the file is the one the weights cache was loaded from.
+static bool is_weights_cache_file(const struct xnn_weights_cache* cache, const char* filename)
+{
+  #ifdef _WIN32
+    HANDLE file = CreateFileA(
+      filename, 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+      NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+      return false;
+    }
+    BY_HANDLE_FILE_INFORMATION file_info;
+    const bool success = GetFileInformationByHandle(file, &file_info) != 0;
+    CloseHandle(file);
+    return success && (uint64_t) file_info.dwVolumeSerialNumber == cache->file_device &&
+      (((uint64_t) file_info.nFileIndexHigh << 32) | (uint64_t) file_info.nFileIndexLow) == cache->file_index;
+  #else
+    struct stat file_stat;
+    return stat(filename, &file_stat) == 0 &&
+      (uint64_t) file_stat.st_dev == cache->file_device && (uint64_t) file_stat.st_ino == cache->file_index;
+  #endif
+}
+
+static bool write_weights_cache_file(FILE* file, const void* data, size_t size)
+{
+  return size == 0 || fwrite(data, 1, size, file) == size;
+}
+
+enum xnn_status xnn_save_weights_cache(
+  xnn_weights_cache_t weights_cache,
+  const char* filename)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to save weights cache: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+
+  if (weights_cache->mapping != NULL && is_weights_cache_file(weights_cache, filename)) {
+    // Truncating the file would invalidate the packed weights mapped from it.
+    xnn_log_error("failed to save weights cache: %s is the file the weights cache was loaded from", filename);
+    return xnn_status_invalid_parameter;
+  }
+
+  FILE* file = fopen(filename, "wb");
+  if (file == NULL) {
+    xnn_log_error("failed to save weights cache: failed to open %s for writing", filename);
+    return xnn_status_invalid_parameter;
+  }
+
+  enum xnn_status status = xnn_status_success;
+  lock_weights_cache(weights_cache);
+
+  const struct xnn_weights_cache_key config_key = compute_config_key();
+  const struct weights_cache_file_header header = {
+    .magic = XNN_WEIGHTS_CACHE_FILE_MAGIC,
+    .version = XNN_WEIGHTS_CACHE_FILE_VERSION,
+    .config_key = { config_key.hash[0], config_key.hash[1] },
+    .num_entries = (uint64_t) weights_cache->num_entries,
+  };
+  bool success = write_weights_cache_file(file, &header, sizeof(header));
+
+  size_t offset = round_up_po2(
+    sizeof(struct weights_cache_file_header) + weights_cache->num_entries * sizeof(struct weights_cache_file_entry),
+    XNN_ALLOCATION_ALIGNMENT);
+  for (size_t i = 0; success && i < weights_cache->num_entries; i++) {
+    const struct xnn_weights_cache_entry* entry = &weights_cache->entries[i];
+    const struct weights_cache_file_entry file_entry = {
+      .key = { entry->key.hash[0], entry->key.hash[1] },
+      .size = (uint64_t) entry->size,
+      .offset = (uint64_t) offset,
+    };
+    success = write_weights_cache_file(file, &file_entry, sizeof(file_entry));
+    offset = round_up_po2(offset + entry->size, XNN_ALLOCATION_ALIGNMENT);
+  }
+
+  static const uint8_t padding[XNN_ALLOCATION_ALIGNMENT] = { 0 };
+  size_t file_size =
+    sizeof(struct weights_cache_file_header) + weights_cache->num_entries * sizeof(struct weights_cache_file_entry);
+  for (size_t i = 0; success && i < weights_cache->num_entries; i++) {
+    const struct xnn_weights_cache_entry* entry = &weights_cache->entries[i];
+    const size_t padding_size = round_up_po2(file_size, XNN_ALLOCATION_ALIGNMENT) - file_size;
+    success = write_weights_cache_file(file, padding, padding_size) &&
+      write_weights_cache_file(file, entry->packed_weights, entry->size);
+    file_size += padding_size + entry->size;
+  }
+  unlock_weights_cache(weights_cache);
+
+  if (fclose(file) != 0) {
+    success = false;
+  }
+  if (!success) {
+    xnn_log_error("failed to save weights cache: failed to write %s", filename);
+    status = xnn_status_invalid_state;
+  }
+  return status;
+}
+
+// Map the whole file read-only. Returns NULL on failure.
+static void* map_weights_cache_file(
+  const char* filename,
+  size_t* mapping_size_out,
+  uint64_t* file_device_out,
+  uint64_t* file_index_out)
+{
+  #ifdef _WIN32
+    HANDLE file = CreateFileA(
+      filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+      return NULL;
+    }
+    LARGE_INTEGER file_size;
+    BY_HANDLE_FILE_INFORMATION file_info;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0 || !GetFileInformationByHandle(file, &file_info)) {
+      CloseHandle(file);
+      return NULL;
+    }
+    HANDLE file_mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (file_mapping == NULL) {
+      return NULL;
+    }
+    void* mapping = MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+    // The view keeps the file mapping alive.
+    CloseHandle(file_mapping);
+    *mapping_size_out = (size_t) file_size.QuadPart;
+    *file_device_out = (uint64_t) file_info.dwVolumeSerialNumber;
+    *file_index_out = ((uint64_t) file_info.nFileIndexHigh << 32) | (uint64_t) file_info.nFileIndexLow;
+    return mapping;
+  #else
+    const int fd = open(filename, O_RDONLY);
+    if (fd == -1) {
+      return NULL;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+      close(fd);
+      return NULL;
+    }
+    void* mapping = mmap(NULL, (size_t) file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps the file alive.
+    close(fd);
+    if (mapping == MAP_FAILED) {
+      return NULL;
+    }
+    *mapping_size_out = (size_t) file_stat.st_size;
+    *file_device_out = (uint64_t) file_stat.st_dev;
+    *file_index_out = (uint64_t) file_stat.st_ino;
+    return mapping;
+  #endif
+}
+
+enum xnn_status xnn_load_weights_cache(
+  const char* filename,
+  xnn_weights_cache_t* weights_cache_out)
+{
+  struct xnn_weights_cache* cache = NULL;
+  enum xnn_status status = xnn_create_weights_cache(&cache);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  status = xnn_status_invalid_parameter;
+  size_t mapping_size = 0;
+  cache->mapping = map_weights_cache_file(filename, &mapping_size, &cache->file_device, &cache->file_index);
+  if (cache->mapping == NULL) {
+    xnn_log_error("failed to load weights cache: failed to map %s", filename);
+    goto error;
+  }
+  cache->mapping_size = mapping_size;
+
+  const struct weights_cache_file_header* header = (const struct weights_cache_file_header*) cache->mapping;
+  if (mapping_size < sizeof(struct weights_cache_file_header) || header->magic != XNN_WEIGHTS_CACHE_FILE_MAGIC) {
+    xnn_log_error("failed to load weights cache: %s is not a weights cache file", filename);
+    goto error;
+  }
+
+  status = xnn_status_unsupported_parameter;
+  if (header->version != XNN_WEIGHTS_CACHE_FILE_VERSION) {
+    xnn_log_error(
+      "failed to load weights cache: %s has version %" PRIu32 " of the file format, expected version %" PRIu32,
+      filename, header->version, XNN_WEIGHTS_CACHE_FILE_VERSION);
+    goto error;
+  }
+
+  const struct xnn_weights_cache_key config_key = compute_config_key();
+  if (header->config_key[0] != config_key.hash[0] || header->config_key[1] != config_key.hash[1]) {
+    xnn_log_error(
+      "failed to load weights cache: %s was produced with a different micro-kernel configuration", filename);
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+  const size_t max_entries =
+    (mapping_size - sizeof(struct weights_cache_file_header)) / sizeof(struct weights_cache_file_entry);
+  if (header->num_entries > (uint64_t) max_entries) {
+    xnn_log_error("failed to load weights cache: %s is truncated", filename);
+    goto error;
+  }
+
+  const size_t num_entries = (size_t) header->num_entries;
+  if (num_entries != 0) {
+    cache->entries = xnn_allocate_zero_memory(num_entries * sizeof(struct xnn_weights_cache_entry));
+    if (cache->entries == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for weights cache entries",
+        num_entries * sizeof(struct xnn_weights_cache_entry));
+      status = xnn_status_out_of_memory;
+      goto error;
+    }
+    cache->num_reserved_entries = num_entries;
+  }
+
+  const struct weights_cache_file_entry* file_entries = (const struct weights_cache_file_entry*) (header + 1);
+  for (size_t i = 0; i < num_entries; i++) {
+    const struct weights_cache_file_entry* file_entry = &file_entries[i];
+    if (file_entry->offset % XNN_ALLOCATION_ALIGNMENT != 0 ||
+        file_entry->offset > (uint64_t) mapping_size || file_entry->size > (uint64_t) mapping_size - file_entry->offset)
+    {
+      xnn_log_error("failed to load weights cache: %s is truncated or corrupted", filename);
+      goto error;
+    }
+    cache->entries[cache->num_entries++] = (struct xnn_weights_cache_entry) {
+      .key = { .hash = { file_entry->key[0], file_entry->key[1] } },
+      .size = (size_t) file_entry->size,
+      .packed_weights = (void*) ((uintptr_t) cache->mapping + (size_t) file_entry->offset),
+      .mapped = true,
+    };
+  }
+
+  *weights_cache_out = cache;
+  return xnn_status_success;
+
+error:
+  xnn_release_weights_cache(cache);
+  return status;
+}
@@ -0,0 +1,115 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/transpose.h>
+
+
+void xnn_x16_transpose_ukernel__8x8_neon(
+    const uint16_t* input,
+    uint16_t* output,
+    size_t input_stride,
+    size_t output_stride,
+    size_t block_width,
+    size_t block_height)
+{
+  assert(block_width != 0);
+  assert(block_height != 0);
+  assert(input_stride >= block_width * sizeof(uint16_t));
+  assert(output_stride >= block_height * sizeof(uint16_t));
+
+  // Each group of 8 input rows is written to 8 output columns.
+  for (; block_height >= 8; block_height -= 8) {
+    const uint16_t* i0 = input;
+    const uint16_t* i1 = (const uint16_t*) ((uintptr_t) i0 + input_stride);
+    const uint16_t* i2 = (const uint16_t*) ((uintptr_t) i1 + input_stride);
+    const uint16_t* i3 = (const uint16_t*) ((uintptr_t) i2 + input_stride);
+    const uint16_t* i4 = (const uint16_t*) ((uintptr_t) i3 + input_stride);
+    const uint16_t* i5 = (const uint16_t*) ((uintptr_t) i4 + input_stride);
+    const uint16_t* i6 = (const uint16_t*) ((uintptr_t) i5 + input_stride);
+    const uint16_t* i7 = (const uint16_t*) ((uintptr_t) i6 + input_stride);
+    uint16_t* o = output;
+
+    size_t bw = block_width;
+    for (; bw >= 8; bw -= 8) {
+      const uint16x8_t v0 = vld1q_u16(i0);
+      const uint16x8_t v1 = vld1q_u16(i1);
+      const uint16x8_t v2 = vld1q_u16(i2);
+      const uint16x8_t v3 = vld1q_u16(i3);
+      const uint16x8_t v4 = vld1q_u16(i4);
+      const uint16x8_t v5 = vld1q_u16(i5);
+      const uint16x8_t v6 = vld1q_u16(i6);
+      const uint16x8_t v7 = vld1q_u16(i7);
+
+      // a0 b0 a2 b2 a4 b4 a6 b6, and a1 b1 a3 b3 a5 b5 a7 b7.
+      const uint16x8x2_t t01 = vtrnq_u16(v0, v1);
+      const uint16x8x2_t t23 = vtrnq_u16(v2, v3);
+      const uint16x8x2_t t45 = vtrnq_u16(v4, v5);
+      const uint16x8x2_t t67 = vtrnq_u16(v6, v7);
+
+      // a0 b0 c0 d0 a4 b4 c4 d4, and a2 b2 c2 d2 a6 b6 c6 d6.
+      const uint32x4x2_t u02 = vtrnq_u32(vreinterpretq_u32_u16(t01.val[0]), vreinterpretq_u32_u16(t23.val[0]));
+      const uint32x4x2_t u13 = vtrnq_u32(vreinterpretq_u32_u16(t01.val[1]), vreinterpretq_u32_u16(t23.val[1]));
+      const uint32x4x2_t u46 = vtrnq_u32(vreinterpretq_u32_u16(t45.val[0]), vreinterpretq_u32_u16(t67.val[0]));
+      const uint32x4x2_t u57 = vtrnq_u32(vreinterpretq_u32_u16(t45.val[1]), vreinterpretq_u32_u16(t67.val[1]));
+
+      uint16_t* o0 = o;
+      uint16_t* o1 = (uint16_t*) ((uintptr_t) o0 + output_stride);
+      uint16_t* o2 = (uint16_t*) ((uintptr_t) o1 + output_stride);
+      uint16_t* o3 = (uint16_t*) ((uintptr_t) o2 + output_stride);
+      uint16_t* o4 = (uint16_t*) ((uintptr_t) o3 + output_stride);
+      uint16_t* o5 = (uint16_t*) ((uintptr_t) o4 + output_stride);
+      uint16_t* o6 = (uint16_t*) ((uintptr_t) o5 + output_stride);
+      uint16_t* o7 = (uint16_t*) ((uintptr_t) o6 + output_stride);
+      vst1q_u16(o0, vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u02.val[0]), vget_low_u32(u46.val[0]))));
+      vst1q_u16(o1, vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u13.val[0]), vget_low_u32(u57.val[0]))));
+      vst1q_u16(o2, vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u02.val[1]), vget_low_u32(u46.val[1]))));
+      vst1q_u16(o3, vreinterpretq_u16_u32(vcombine_u32(vget_low_u32(u13.val[1]), vget_low_u32(u57.val[1]))));
+      vst1q_u16(o4, vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u02.val[0]), vget_high_u32(u46.val[0]))));
+      vst1q_u16(o5, vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u13.val[0]), vget_high_u32(u57.val[0]))));
+      vst1q_u16(o6, vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u02.val[1]), vget_high_u32(u46.val[1]))));
+      vst1q_u16(o7, vreinterpretq_u16_u32(vcombine_u32(vget_high_u32(u13.val[1]), vget_high_u32(u57.val[1]))));
+
+      i0 += 8;
+      i1 += 8;
+      i2 += 8;
+      i3 += 8;
+      i4 += 8;
+      i5 += 8;
+      i6 += 8;
+      i7 += 8;
+      o = (uint16_t*) ((uintptr_t) o7 + output_stride);
+    }
+    for (; bw != 0; bw -= 1) {
+      o[0] = *i0++;
+      o[1] = *i1++;
+      o[2] = *i2++;
+      o[3] = *i3++;
+      o[4] = *i4++;
+      o[5] = *i5++;
+      o[6] = *i6++;
+      o[7] = *i7++;
+      o = (uint16_t*) ((uintptr_t) o + output_stride);
+    }
+
+    input = (const uint16_t*) ((uintptr_t) input + input_stride * 8);
+    output += 8;
+  }
+  for (; block_height != 0; block_height -= 1) {
+    const uint16_t* i = input;
+    uint16_t* o = output;
+    size_t bw = block_width;
+    do {
+      *o = *i++;
+      o = (uint16_t*) ((uintptr_t) o + output_stride);
+    } while (--bw != 0);
+
+    input = (const uint16_t*) ((uintptr_t) input + input_stride);
+    output += 1;
+  }
+}
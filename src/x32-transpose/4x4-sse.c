@@ -0,0 +1,85 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/transpose.h>
+
+
+void xnn_x32_transpose_ukernel__4x4_sse(
+    const uint32_t* input,
+    uint32_t* output,
+    size_t input_stride,
+    size_t output_stride,
+    size_t block_width,
+    size_t block_height)
+{
+  assert(block_width != 0);
+  assert(block_height != 0);
+  assert(input_stride >= block_width * sizeof(uint32_t));
+  assert(output_stride >= block_height * sizeof(uint32_t));
+
+  // Each group of 4 input rows is written to 4 output columns.
+  for (; block_height >= 4; block_height -= 4) {
+    const uint32_t* i0 = input;
+    const uint32_t* i1 = (const uint32_t*) ((uintptr_t) i0 + input_stride);
+    const uint32_t* i2 = (const uint32_t*) ((uintptr_t) i1 + input_stride);
+    const uint32_t* i3 = (const uint32_t*) ((uintptr_t) i2 + input_stride);
+    uint32_t* o = output;
+
+    size_t bw = block_width;
+    for (; bw >= 4; bw -= 4) {
+      const __m128 v0 = _mm_loadu_ps((const float*) i0);
+      const __m128 v1 = _mm_loadu_ps((const float*) i1);
+      const __m128 v2 = _mm_loadu_ps((const float*) i2);
+      const __m128 v3 = _mm_loadu_ps((const float*) i3);
+
+      // a0 b0 a1 b1, a2 b2 a3 b3, c0 d0 c1 d1, c2 d2 c3 d3
+      const __m128 v01lo = _mm_unpacklo_ps(v0, v1);
+      const __m128 v01hi = _mm_unpackhi_ps(v0, v1);
+      const __m128 v23lo = _mm_unpacklo_ps(v2, v3);
+      const __m128 v23hi = _mm_unpackhi_ps(v2, v3);
+
+      uint32_t* o0 = o;
+      uint32_t* o1 = (uint32_t*) ((uintptr_t) o0 + output_stride);
+      uint32_t* o2 = (uint32_t*) ((uintptr_t) o1 + output_stride);
+      uint32_t* o3 = (uint32_t*) ((uintptr_t) o2 + output_stride);
+      _mm_storeu_ps((float*) o0, _mm_movelh_ps(v01lo, v23lo));
+      _mm_storeu_ps((float*) o1, _mm_movehl_ps(v23lo, v01lo));
+      _mm_storeu_ps((float*) o2, _mm_movelh_ps(v01hi, v23hi));
+      _mm_storeu_ps((float*) o3, _mm_movehl_ps(v23hi, v01hi));
+
+      i0 += 4;
+      i1 += 4;
+      i2 += 4;
+      i3 += 4;
+      o = (uint32_t*) ((uintptr_t) o3 + output_stride);
+    }
+    for (; bw != 0; bw -= 1) {
+      o[0] = *i0++;
+      o[1] = *i1++;
+      o[2] = *i2++;
+      o[3] = *i3++;
+      o = (uint32_t*) ((uintptr_t) o + output_stride);
+    }
+
+    input = (const uint32_t*) ((uintptr_t) input + input_stride * 4);
+    output += 4;
+  }
+  for (; block_height != 0; block_height -= 1) {
+    const uint32_t* i = input;
+    uint32_t* o = output;
+    size_t bw = block_width;
+    do {
+      *o = *i++;
+      o = (uint32_t*) ((uintptr_t) o + output_stride);
+    } while (--bw != 0);
+
+    input = (const uint32_t*) ((uintptr_t) input + input_stride);
+    output += 1;
+  }
+}
@@ -0,0 +1,123 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/transpose.h>
+
+
+void xnn_x32_transpose_ukernel__8x8_avx(
+    const uint32_t* input,
+    uint32_t* output,
+    size_t input_stride,
+    size_t output_stride,
+    size_t block_width,
+    size_t block_height)
+{
+  assert(block_width != 0);
+  assert(block_height != 0);
+  assert(input_stride >= block_width * sizeof(uint32_t));
+  assert(output_stride >= block_height * sizeof(uint32_t));
+
+  // Each group of 8 input rows is written to 8 output columns.
+  for (; block_height >= 8; block_height -= 8) {
+    const uint32_t* i0 = input;
+    const uint32_t* i1 = (const uint32_t*) ((uintptr_t) i0 + input_stride);
+    const uint32_t* i2 = (const uint32_t*) ((uintptr_t) i1 + input_stride);
+    const uint32_t* i3 = (const uint32_t*) ((uintptr_t) i2 + input_stride);
+    const uint32_t* i4 = (const uint32_t*) ((uintptr_t) i3 + input_stride);
+    const uint32_t* i5 = (const uint32_t*) ((uintptr_t) i4 + input_stride);
+    const uint32_t* i6 = (const uint32_t*) ((uintptr_t) i5 + input_stride);
+    const uint32_t* i7 = (const uint32_t*) ((uintptr_t) i6 + input_stride);
+    uint32_t* o = output;
+
+    size_t bw = block_width;
+    for (; bw >= 8; bw -= 8) {
+      const __m256 v0 = _mm256_loadu_ps((const float*) i0);
+      const __m256 v1 = _mm256_loadu_ps((const float*) i1);
+      const __m256 v2 = _mm256_loadu_ps((const float*) i2);
+      const __m256 v3 = _mm256_loadu_ps((const float*) i3);
+      const __m256 v4 = _mm256_loadu_ps((const float*) i4);
+      const __m256 v5 = _mm256_loadu_ps((const float*) i5);
+      const __m256 v6 = _mm256_loadu_ps((const float*) i6);
+      const __m256 v7 = _mm256_loadu_ps((const float*) i7);
+
+      // Interleave pairs of rows: a0 b0 a1 b1 | a4 b4 a5 b5, and a2 b2 a3 b3 | a6 b6 a7 b7.
+      const __m256 t0 = _mm256_unpacklo_ps(v0, v1);
+      const __m256 t1 = _mm256_unpackhi_ps(v0, v1);
+      const __m256 t2 = _mm256_unpacklo_ps(v2, v3);
+      const __m256 t3 = _mm256_unpackhi_ps(v2, v3);
+      const __m256 t4 = _mm256_unpacklo_ps(v4, v5);
+      const __m256 t5 = _mm256_unpackhi_ps(v4, v5);
+      const __m256 t6 = _mm256_unpacklo_ps(v6, v7);
+      const __m256 t7 = _mm256_unpackhi_ps(v6, v7);
+
+      // Gather 4 rows: a0 b0 c0 d0 | a4 b4 c4 d4, etc.
+      const __m256 u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+      const __m256 u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+      const __m256 u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+      const __m256 u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+      const __m256 u4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+      const __m256 u5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+      const __m256 u6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+      const __m256 u7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+      uint32_t* o0 = o;
+      uint32_t* o1 = (uint32_t*) ((uintptr_t) o0 + output_stride);
+      uint32_t* o2 = (uint32_t*) ((uintptr_t) o1 + output_stride);
+      uint32_t* o3 = (uint32_t*) ((uintptr_t) o2 + output_stride);
+      uint32_t* o4 = (uint32_t*) ((uintptr_t) o3 + output_stride);
+      uint32_t* o5 = (uint32_t*) ((uintptr_t) o4 + output_stride);
+      uint32_t* o6 = (uint32_t*) ((uintptr_t) o5 + output_stride);
+      uint32_t* o7 = (uint32_t*) ((uintptr_t) o6 + output_stride);
+      _mm256_storeu_ps((float*) o0, _mm256_permute2f128_ps(u0, u4, 0x20));
+      _mm256_storeu_ps((float*) o1, _mm256_permute2f128_ps(u1, u5, 0x20));
+      _mm256_storeu_ps((float*) o2, _mm256_permute2f128_ps(u2, u6, 0x20));
+      _mm256_storeu_ps((float*) o3, _mm256_permute2f128_ps(u3, u7, 0x20));
+      _mm256_storeu_ps((float*) o4, _mm256_permute2f128_ps(u0, u4, 0x31));
+      _mm256_storeu_ps((float*) o5, _mm256_permute2f128_ps(u1, u5, 0x31));
+      _mm256_storeu_ps((float*) o6, _mm256_permute2f128_ps(u2, u6, 0x31));
+      _mm256_storeu_ps((float*) o7, _mm256_permute2f128_ps(u3, u7, 0x31));
+
+      i0 += 8;
+      i1 += 8;
+      i2 += 8;
+      i3 += 8;
+      i4 += 8;
+      i5 += 8;
+      i6 += 8;
+      i7 += 8;
+      o = (uint32_t*) ((uintptr_t) o7 + output_stride);
+    }
+    for (; bw != 0; bw -= 1) {
+      o[0] = *i0++;
+      o[1] = *i1++;
+      o[2] = *i2++;
+      o[3] = *i3++;
+      o[4] = *i4++;
+      o[5] = *i5++;
+      o[6] = *i6++;
+      o[7] = *i7++;
+      o = (uint32_t*) ((uintptr_t) o + output_stride);
+    }
+
+    input = (const uint32_t*) ((uintptr_t) input + input_stride * 8);
+    output += 8;
+  }
+  for (; block_height != 0; block_height -= 1) {
+    const uint32_t* i = input;
+    uint32_t* o = output;
+    size_t bw = block_width;
+    do {
+      *o = *i++;
+      o = (uint32_t*) ((uintptr_t) o + output_stride);
+    } while (--bw != 0);
+
+    input = (const uint32_t*) ((uintptr_t) input + input_stride);
+    output += 1;
+  }
+}
@@ -0,0 +1,129 @@
+// Auto-generated file. Do not edit!
+//   Template: src/x8-lut/neon-tbx128x4.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/lut.h>
+#include <xnnpack/common.h>
+
+
+void xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x48(
+    size_t n,
+    const uint8_t* x,
+    const uint8_t t[restrict XNN_MIN_ELEMENTS(256)],
+    uint8_t* y)
+{
+  assert(n != 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  // TBL/TBX look up 64-entry tables in 4 registers. TBX leaves the destination unchanged for out-of-range indexes,
+  // so the 4 quarters of the 256-entry table are looked up with indexes decremented by 64 after each lookup.
+  uint8x16x4_t vtable0123;
+  vtable0123.val[0] = vld1q_u8(t);
+  vtable0123.val[1] = vld1q_u8(t + 16);
+  vtable0123.val[2] = vld1q_u8(t + 32);
+  vtable0123.val[3] = vld1q_u8(t + 48);
+  uint8x16x4_t vtable4567;
+  vtable4567.val[0] = vld1q_u8(t + 64);
+  vtable4567.val[1] = vld1q_u8(t + 80);
+  vtable4567.val[2] = vld1q_u8(t + 96);
+  vtable4567.val[3] = vld1q_u8(t + 112);
+  uint8x16x4_t vtable89AB;
+  vtable89AB.val[0] = vld1q_u8(t + 128);
+  vtable89AB.val[1] = vld1q_u8(t + 144);
+  vtable89AB.val[2] = vld1q_u8(t + 160);
+  vtable89AB.val[3] = vld1q_u8(t + 176);
+  uint8x16x4_t vtableCDEF;
+  vtableCDEF.val[0] = vld1q_u8(t + 192);
+  vtableCDEF.val[1] = vld1q_u8(t + 208);
+  vtableCDEF.val[2] = vld1q_u8(t + 224);
+  vtableCDEF.val[3] = vld1q_u8(t + 240);
+
+  const uint8x16_t voffset = vmovq_n_u8(64);
+  for (; n >= 48; n -= 48) {
+    uint8x16_t vx0 = vld1q_u8(x); x += 16;
+    uint8x16_t vx1 = vld1q_u8(x); x += 16;
+    uint8x16_t vx2 = vld1q_u8(x); x += 16;
+
+    uint8x16_t vy0 = vqtbl4q_u8(vtable0123, vx0);
+    uint8x16_t vy1 = vqtbl4q_u8(vtable0123, vx1);
+    uint8x16_t vy2 = vqtbl4q_u8(vtable0123, vx2);
+
+    vx0 = vsubq_u8(vx0, voffset);
+    vx1 = vsubq_u8(vx1, voffset);
+    vx2 = vsubq_u8(vx2, voffset);
+    vy0 = vqtbx4q_u8(vy0, vtable4567, vx0);
+    vy1 = vqtbx4q_u8(vy1, vtable4567, vx1);
+    vy2 = vqtbx4q_u8(vy2, vtable4567, vx2);
+    vx0 = vsubq_u8(vx0, voffset);
+    vx1 = vsubq_u8(vx1, voffset);
+    vx2 = vsubq_u8(vx2, voffset);
+    vy0 = vqtbx4q_u8(vy0, vtable89AB, vx0);
+    vy1 = vqtbx4q_u8(vy1, vtable89AB, vx1);
+    vy2 = vqtbx4q_u8(vy2, vtable89AB, vx2);
+    vx0 = vsubq_u8(vx0, voffset);
+    vx1 = vsubq_u8(vx1, voffset);
+    vx2 = vsubq_u8(vx2, voffset);
+    vy0 = vqtbx4q_u8(vy0, vtableCDEF, vx0);
+    vy1 = vqtbx4q_u8(vy1, vtableCDEF, vx1);
+    vy2 = vqtbx4q_u8(vy2, vtableCDEF, vx2);
+
+    vst1q_u8(y, vy0); y += 16;
+    vst1q_u8(y, vy1); y += 16;
+    vst1q_u8(y, vy2); y += 16;
+  }
+  for (; n >= 16; n -= 16) {
+    uint8x16_t vx = vld1q_u8(x); x += 16;
+
+    uint8x16_t vy = vqtbl4q_u8(vtable0123, vx);
+
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vtable4567, vx);
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vtable89AB, vx);
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vtableCDEF, vx);
+
+    vst1q_u8(y, vy); y += 16;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1);
+    assert(n <= 15);
+    uint8x16_t vx = vld1q_u8(x);
+
+    uint8x16_t vy = vqtbl4q_u8(vtable0123, vx);
+
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vtable4567, vx);
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vtable89AB, vx);
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vtableCDEF, vx);
+
+    uint8x8_t vy_lo = vget_low_u8(vy);
+    if (n & 8) {
+      vst1_u8(y, vy_lo); y += 8;
+      vy_lo = vget_high_u8(vy);
+    }
+    if (n & 4) {
+      vst1_lane_u32(__builtin_assume_aligned(y, 1), vreinterpret_u32_u8(vy_lo), 0); y += 4;
+      vy_lo = vext_u8(vy_lo, vy_lo, 4);
+    }
+    if (n & 2) {
+      vst1_lane_u16(__builtin_assume_aligned(y, 1), vreinterpret_u16_u8(vy_lo), 0); y += 2;
+      vy_lo = vext_u8(vy_lo, vy_lo, 2);
+    }
+    if (n & 1) {
+      vst1_lane_u8(y, vy_lo, 0);
+    }
+  }
+}
@@ -0,0 +1,61 @@
+// Auto-generated file. Do not edit!
+//   Template: src/x8-lut/avx512vbmi-vpermx2b.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/lut.h>
+#include <xnnpack/common.h>
+
+
+void xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x64(
+    size_t n,
+    const uint8_t* x,
+    const uint8_t t[restrict XNN_MIN_ELEMENTS(256)],
+    uint8_t* y)
+{
+  assert(n != 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  // VPERMT2B looks up a 128-entry table in a pair of registers using the low 7 bits of the index. Both halves of the
+  // 256-entry table are looked up, and the high bit of the index selects between them.
+  const __m512i vtable0 = _mm512_loadu_si512(t);
+  const __m512i vtable1 = _mm512_loadu_si512(t + 64);
+  const __m512i vtable2 = _mm512_loadu_si512(t + 128);
+  const __m512i vtable3 = _mm512_loadu_si512(t + 192);
+  for (; n >= 64; n -= 64) {
+    const __m512i vx0 = _mm512_loadu_si512(x);
+    x += 64;
+
+    const __m512i vy0_lo = _mm512_permutex2var_epi8(vtable0, vx0, vtable1);
+    const __m512i vy0_hi = _mm512_permutex2var_epi8(vtable2, vx0, vtable3);
+    const __mmask64 vhi0 = _mm512_movepi8_mask(vx0);
+
+    const __m512i vy0 = _mm512_mask_blend_epi8(vhi0, vy0_lo, vy0_hi);
+
+    _mm512_storeu_si512(y, vy0);
+    y += 64;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1);
+    assert(n <= 63);
+    const __mmask64 vmask = _cvtu64_mask64((uint64_t) ((UINT64_C(1) << n) - UINT64_C(1)));
+
+    const __m512i vx = _mm512_maskz_loadu_epi8(vmask, x);
+
+    const __m512i vy_lo = _mm512_permutex2var_epi8(vtable0, vx, vtable1);
+    const __m512i vy_hi = _mm512_permutex2var_epi8(vtable2, vx, vtable3);
+    const __mmask64 vhi = _mm512_movepi8_mask(vx);
+    const __m512i vy = _mm512_mask_blend_epi8(vhi, vy_lo, vy_hi);
+
+    _mm512_mask_storeu_epi8(y, vmask, vy);
+  }
+}
@@ -0,0 +1,34 @@
+// Auto-generated file. Do not edit!
+//   Template: src/x8-lut/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright (c) Facebook, Inc. and its affiliates.
+// All rights reserved.
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/lut.h>
+#include <xnnpack/common.h>
+
+
+void xnn_x8_lut_ukernel__scalar_x1(
+    size_t n,
+    const uint8_t* x,
+    const uint8_t t[restrict XNN_MIN_ELEMENTS(256)],
+    uint8_t* y)
+{
+  assert(n != 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  do {
+    const size_t vx = (size_t) *x++;
+    const uint8_t vt = t[vx];
+    *y++ = vt;
+  } while (--n != 0);
+}
@@ -0,0 +1,90 @@
+// Auto-generated file. Do not edit!
+//   Template: src/x8-lut/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright (c) Facebook, Inc. and its affiliates.
+// All rights reserved.
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/lut.h>
+#include <xnnpack/common.h>
+
+
+void xnn_x8_lut_ukernel__scalar_x16(
+    size_t n,
+    const uint8_t* x,
+    const uint8_t t[restrict XNN_MIN_ELEMENTS(256)],
+    uint8_t* y)
+{
+  assert(n != 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  for (; n >= 16; n -= 16) {
+    const size_t vx0 = (size_t) x[0];
+    const size_t vx1 = (size_t) x[1];
+    const size_t vx2 = (size_t) x[2];
+    const size_t vx3 = (size_t) x[3];
+    const size_t vx4 = (size_t) x[4];
+    const size_t vx5 = (size_t) x[5];
+    const size_t vx6 = (size_t) x[6];
+    const size_t vx7 = (size_t) x[7];
+    const size_t vx8 = (size_t) x[8];
+    const size_t vx9 = (size_t) x[9];
+    const size_t vx10 = (size_t) x[10];
+    const size_t vx11 = (size_t) x[11];
+    const size_t vx12 = (size_t) x[12];
+    const size_t vx13 = (size_t) x[13];
+    const size_t vx14 = (size_t) x[14];
+    const size_t vx15 = (size_t) x[15];
+    x += 16;
+
+    const uint8_t vt0 = t[vx0];
+    const uint8_t vt1 = t[vx1];
+    const uint8_t vt2 = t[vx2];
+    const uint8_t vt3 = t[vx3];
+    const uint8_t vt4 = t[vx4];
+    const uint8_t vt5 = t[vx5];
+    const uint8_t vt6 = t[vx6];
+    const uint8_t vt7 = t[vx7];
+    const uint8_t vt8 = t[vx8];
+    const uint8_t vt9 = t[vx9];
+    const uint8_t vt10 = t[vx10];
+    const uint8_t vt11 = t[vx11];
+    const uint8_t vt12 = t[vx12];
+    const uint8_t vt13 = t[vx13];
+    const uint8_t vt14 = t[vx14];
+    const uint8_t vt15 = t[vx15];
+
+    y[0] = vt0;
+    y[1] = vt1;
+    y[2] = vt2;
+    y[3] = vt3;
+    y[4] = vt4;
+    y[5] = vt5;
+    y[6] = vt6;
+    y[7] = vt7;
+    y[8] = vt8;
+    y[9] = vt9;
+    y[10] = vt10;
+    y[11] = vt11;
+    y[12] = vt12;
+    y[13] = vt13;
+    y[14] = vt14;
+    y[15] = vt15;
+    y += 16;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const size_t vx = (size_t) *x++;
+      const uint8_t vt = t[vx];
+      *y++ = vt;
+    } while (--n != 0);
+  }
+}
@@ -0,0 +1,48 @@
+// Auto-generated file. Do not edit!
+//   Template: src/x8-lut/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright (c) Facebook, Inc. and its affiliates.
+// All rights reserved.
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/lut.h>
+#include <xnnpack/common.h>
+
+
+void xnn_x8_lut_ukernel__scalar_x2(
+    size_t n,
+    const uint8_t* x,
+    const uint8_t t[restrict XNN_MIN_ELEMENTS(256)],
+    uint8_t* y)
+{
+  assert(n != 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  for (; n >= 2; n -= 2) {
+    const size_t vx0 = (size_t) x[0];
+    const size_t vx1 = (size_t) x[1];
+    x += 2;
+
+    const uint8_t vt0 = t[vx0];
+    const uint8_t vt1 = t[vx1];
+
+    y[0] = vt0;
+    y[1] = vt1;
+    y += 2;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const size_t vx = (size_t) *x++;
+      const uint8_t vt = t[vx];
+      *y++ = vt;
+    } while (--n != 0);
+  }
+}
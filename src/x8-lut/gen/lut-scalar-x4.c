@@ -1,3 +1,7 @@
+// Auto-generated file. Do not edit!
+//   Template: src/x8-lut/scalar.c.in
+//   Generator: tools/xngen
+//
 // Copyright (c) Facebook, Inc. and its affiliates.
 // All rights reserved.
 //
@@ -9,21 +13,24 @@
 #include <assert.h>
 
 #include <xnnpack/lut.h>
+#include <xnnpack/common.h>
 
 
-void xnn_x8_lut_ukernel__scalar(
+void xnn_x8_lut_ukernel__scalar_x4(
     size_t n,
     const uint8_t* x,
     const uint8_t t[restrict XNN_MIN_ELEMENTS(256)],
     uint8_t* y)
 {
   assert(n != 0);
-
-  while (n >= 4) {
-    const size_t vx0 = x[0];
-    const size_t vx1 = x[1];
-    const size_t vx2 = x[2];
-    const size_t vx3 = x[3];
+  assert(x != NULL);
+  assert(y != NULL);
+
+  for (; n >= 4; n -= 4) {
+    const size_t vx0 = (size_t) x[0];
+    const size_t vx1 = (size_t) x[1];
+    const size_t vx2 = (size_t) x[2];
+    const size_t vx3 = (size_t) x[3];
     x += 4;
 
     const uint8_t vt0 = t[vx0];
@@ -36,14 +43,12 @@ void xnn_x8_lut_ukernel__scalar(
     y[2] = vt2;
     y[3] = vt3;
     y += 4;
-
-    n -= 4;
   }
-  while (n != 0) {
-    const size_t vx = *x++;
-    const uint8_t vt = t[vx];
-    *y++ = vt;
-
-    n--;
-  };
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const size_t vx = (size_t) *x++;
+      const uint8_t vt = t[vx];
+      *y++ = vt;
+    } while (--n != 0);
+  }
 }
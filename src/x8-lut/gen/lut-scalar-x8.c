@@ -0,0 +1,66 @@
+// Auto-generated file. Do not edit!
+//   Template: src/x8-lut/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright (c) Facebook, Inc. and its affiliates.
+// All rights reserved.
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/lut.h>
+#include <xnnpack/common.h>
+
+
+void xnn_x8_lut_ukernel__scalar_x8(
+    size_t n,
+    const uint8_t* x,
+    const uint8_t t[restrict XNN_MIN_ELEMENTS(256)],
+    uint8_t* y)
+{
+  assert(n != 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  for (; n >= 8; n -= 8) {
+    const size_t vx0 = (size_t) x[0];
+    const size_t vx1 = (size_t) x[1];
+    const size_t vx2 = (size_t) x[2];
+    const size_t vx3 = (size_t) x[3];
+    const size_t vx4 = (size_t) x[4];
+    const size_t vx5 = (size_t) x[5];
+    const size_t vx6 = (size_t) x[6];
+    const size_t vx7 = (size_t) x[7];
+    x += 8;
+
+    const uint8_t vt0 = t[vx0];
+    const uint8_t vt1 = t[vx1];
+    const uint8_t vt2 = t[vx2];
+    const uint8_t vt3 = t[vx3];
+    const uint8_t vt4 = t[vx4];
+    const uint8_t vt5 = t[vx5];
+    const uint8_t vt6 = t[vx6];
+    const uint8_t vt7 = t[vx7];
+
+    y[0] = vt0;
+    y[1] = vt1;
+    y[2] = vt2;
+    y[3] = vt3;
+    y[4] = vt4;
+    y[5] = vt5;
+    y[6] = vt6;
+    y[7] = vt7;
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const size_t vx = (size_t) *x++;
+      const uint8_t vt = t[vx];
+      *y++ = vt;
+    } while (--n != 0);
+  }
+}
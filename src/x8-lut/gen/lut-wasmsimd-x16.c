@@ -0,0 +1,145 @@
+// Auto-generated file. Do not edit!
+//   Template: src/x8-lut/wasmsimd.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <wasm_simd128.h>
+
+#include <xnnpack/lut.h>
+#include <xnnpack/common.h>
+
+
+void xnn_x8_lut_ukernel__wasmsimd_x16(
+    size_t n,
+    const uint8_t* x,
+    const uint8_t t[restrict XNN_MIN_ELEMENTS(256)],
+    uint8_t* y)
+{
+  assert(n != 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  // SWIZZLE looks up 16-entry tables, and produces zero for indexes outside of [0, 16). The 16 sub-tables of the
+  // 256-entry table are looked up with indexes decremented by 16 after each lookup, and exactly one of them produces
+  // a non-zero result.
+  const v128_t vtable0 = wasm_v128_load(t);
+  const v128_t vtable1 = wasm_v128_load(t + 16);
+  const v128_t vtable2 = wasm_v128_load(t + 32);
+  const v128_t vtable3 = wasm_v128_load(t + 48);
+  const v128_t vtable4 = wasm_v128_load(t + 64);
+  const v128_t vtable5 = wasm_v128_load(t + 80);
+  const v128_t vtable6 = wasm_v128_load(t + 96);
+  const v128_t vtable7 = wasm_v128_load(t + 112);
+  const v128_t vtable8 = wasm_v128_load(t + 128);
+  const v128_t vtable9 = wasm_v128_load(t + 144);
+  const v128_t vtableA = wasm_v128_load(t + 160);
+  const v128_t vtableB = wasm_v128_load(t + 176);
+  const v128_t vtableC = wasm_v128_load(t + 192);
+  const v128_t vtableD = wasm_v128_load(t + 208);
+  const v128_t vtableE = wasm_v128_load(t + 224);
+  const v128_t vtableF = wasm_v128_load(t + 240);
+  const v128_t voffset = wasm_i8x16_splat(16);
+  for (; n >= 16; n -= 16) {
+    v128_t vx = wasm_v128_load(x);
+    x += 16;
+
+    v128_t vy = wasm_v8x16_swizzle(vtable0, vx);
+
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable1, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable2, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable3, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable4, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable5, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable6, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable7, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable8, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable9, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtableA, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtableB, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtableC, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtableD, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtableE, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtableF, vx));
+
+    wasm_v128_store(y, vy);
+    y += 16;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1);
+    assert(n <= 15);
+    v128_t vx = wasm_v128_load(x);
+
+    v128_t vy = wasm_v8x16_swizzle(vtable0, vx);
+
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable1, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable2, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable3, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable4, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable5, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable6, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable7, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable8, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtable9, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtableA, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtableB, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtableC, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtableD, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtableE, vx));
+    vx = wasm_i8x16_sub(vx, voffset);
+    vy = wasm_v128_or(vy, wasm_v8x16_swizzle(vtableF, vx));
+
+    if (n & 8) {
+      *((double*) y) = wasm_f64x2_extract_lane(vy, 0);
+      vy = wasm_v64x2_shuffle(vy, vy, 1, 1);
+      y += 8;
+    }
+    if (n & 4) {
+      *((uint32_t*) y) = (uint32_t) wasm_i32x4_extract_lane(vy, 0);
+      vy = wasm_u64x2_shr(vy, 32);
+      y += 4;
+    }
+    if (n & 2) {
+      *((uint16_t*) y) = (uint16_t) wasm_i16x8_extract_lane(vy, 0);
+      vy = wasm_u32x4_shr(vy, 16);
+      y += 2;
+    }
+    if (n & 1) {
+      *y = (uint8_t) wasm_i8x16_extract_lane(vy, 0);
+    }
+  }
+}
@@ -0,0 +1,101 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/transpose.h>
+
+
+void xnn_x8_transpose_ukernel__4x4_scalar(
+    const uint8_t* input,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_stride,
+    size_t block_width,
+    size_t block_height)
+{
+  assert(block_width != 0);
+  assert(block_height != 0);
+  assert(input_stride >= block_width * sizeof(uint8_t));
+  assert(output_stride >= block_height * sizeof(uint8_t));
+
+  // Each group of 4 input rows is written to 4 output columns.
+  for (; block_height >= 4; block_height -= 4) {
+    const uint8_t* i0 = input;
+    const uint8_t* i1 = (const uint8_t*) ((uintptr_t) i0 + input_stride);
+    const uint8_t* i2 = (const uint8_t*) ((uintptr_t) i1 + input_stride);
+    const uint8_t* i3 = (const uint8_t*) ((uintptr_t) i2 + input_stride);
+    uint8_t* o = output;
+
+    size_t bw = block_width;
+    for (; bw >= 4; bw -= 4) {
+      const uint8_t v0_0 = i0[0];
+      const uint8_t v0_1 = i0[1];
+      const uint8_t v0_2 = i0[2];
+      const uint8_t v0_3 = i0[3];
+      const uint8_t v1_0 = i1[0];
+      const uint8_t v1_1 = i1[1];
+      const uint8_t v1_2 = i1[2];
+      const uint8_t v1_3 = i1[3];
+      const uint8_t v2_0 = i2[0];
+      const uint8_t v2_1 = i2[1];
+      const uint8_t v2_2 = i2[2];
+      const uint8_t v2_3 = i2[3];
+      const uint8_t v3_0 = i3[0];
+      const uint8_t v3_1 = i3[1];
+      const uint8_t v3_2 = i3[2];
+      const uint8_t v3_3 = i3[3];
+
+      uint8_t* o0 = o;
+      uint8_t* o1 = (uint8_t*) ((uintptr_t) o0 + output_stride);
+      uint8_t* o2 = (uint8_t*) ((uintptr_t) o1 + output_stride);
+      uint8_t* o3 = (uint8_t*) ((uintptr_t) o2 + output_stride);
+      o0[0] = v0_0;
+      o0[1] = v1_0;
+      o0[2] = v2_0;
+      o0[3] = v3_0;
+      o1[0] = v0_1;
+      o1[1] = v1_1;
+      o1[2] = v2_1;
+      o1[3] = v3_1;
+      o2[0] = v0_2;
+      o2[1] = v1_2;
+      o2[2] = v2_2;
+      o2[3] = v3_2;
+      o3[0] = v0_3;
+      o3[1] = v1_3;
+      o3[2] = v2_3;
+      o3[3] = v3_3;
+
+      i0 += 4;
+      i1 += 4;
+      i2 += 4;
+      i3 += 4;
+      o = (uint8_t*) ((uintptr_t) o3 + output_stride);
+    }
+    for (; bw != 0; bw -= 1) {
+      o[0] = *i0++;
+      o[1] = *i1++;
+      o[2] = *i2++;
+      o[3] = *i3++;
+      o = (uint8_t*) ((uintptr_t) o + output_stride);
+    }
+
+    input = (const uint8_t*) ((uintptr_t) input + input_stride * 4);
+    output += 4;
+  }
+  for (; block_height != 0; block_height -= 1) {
+    const uint8_t* i = input;
+    uint8_t* o = output;
+    size_t bw = block_width;
+    do {
+      *o = *i++;
+      o = (uint8_t*) ((uintptr_t) o + output_stride);
+    } while (--bw != 0);
+
+    input = (const uint8_t*) ((uintptr_t) input + input_stride);
+    output += 1;
+  }
+}
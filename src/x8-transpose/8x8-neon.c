@@ -0,0 +1,121 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/transpose.h>
+
+
+void xnn_x8_transpose_ukernel__8x8_neon(
+    const uint8_t* input,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_stride,
+    size_t block_width,
+    size_t block_height)
+{
+  assert(block_width != 0);
+  assert(block_height != 0);
+  assert(input_stride >= block_width * sizeof(uint8_t));
+  assert(output_stride >= block_height * sizeof(uint8_t));
+
+  // Each group of 8 input rows is written to 8 output columns.
+  for (; block_height >= 8; block_height -= 8) {
+    const uint8_t* i0 = input;
+    const uint8_t* i1 = (const uint8_t*) ((uintptr_t) i0 + input_stride);
+    const uint8_t* i2 = (const uint8_t*) ((uintptr_t) i1 + input_stride);
+    const uint8_t* i3 = (const uint8_t*) ((uintptr_t) i2 + input_stride);
+    const uint8_t* i4 = (const uint8_t*) ((uintptr_t) i3 + input_stride);
+    const uint8_t* i5 = (const uint8_t*) ((uintptr_t) i4 + input_stride);
+    const uint8_t* i6 = (const uint8_t*) ((uintptr_t) i5 + input_stride);
+    const uint8_t* i7 = (const uint8_t*) ((uintptr_t) i6 + input_stride);
+    uint8_t* o = output;
+
+    size_t bw = block_width;
+    for (; bw >= 8; bw -= 8) {
+      const uint8x8_t v0 = vld1_u8(i0);
+      const uint8x8_t v1 = vld1_u8(i1);
+      const uint8x8_t v2 = vld1_u8(i2);
+      const uint8x8_t v3 = vld1_u8(i3);
+      const uint8x8_t v4 = vld1_u8(i4);
+      const uint8x8_t v5 = vld1_u8(i5);
+      const uint8x8_t v6 = vld1_u8(i6);
+      const uint8x8_t v7 = vld1_u8(i7);
+
+      // a0 b0 a2 b2 a4 b4 a6 b6, and a1 b1 a3 b3 a5 b5 a7 b7.
+      const uint8x8x2_t t01 = vtrn_u8(v0, v1);
+      const uint8x8x2_t t23 = vtrn_u8(v2, v3);
+      const uint8x8x2_t t45 = vtrn_u8(v4, v5);
+      const uint8x8x2_t t67 = vtrn_u8(v6, v7);
+
+      // a0 b0 c0 d0 a4 b4 c4 d4, and a2 b2 c2 d2 a6 b6 c6 d6.
+      const uint16x4x2_t u02 = vtrn_u16(vreinterpret_u16_u8(t01.val[0]), vreinterpret_u16_u8(t23.val[0]));
+      const uint16x4x2_t u13 = vtrn_u16(vreinterpret_u16_u8(t01.val[1]), vreinterpret_u16_u8(t23.val[1]));
+      const uint16x4x2_t u46 = vtrn_u16(vreinterpret_u16_u8(t45.val[0]), vreinterpret_u16_u8(t67.val[0]));
+      const uint16x4x2_t u57 = vtrn_u16(vreinterpret_u16_u8(t45.val[1]), vreinterpret_u16_u8(t67.val[1]));
+
+      // a0 ... h0, and a4 ... h4.
+      const uint32x2x2_t w04 = vtrn_u32(vreinterpret_u32_u16(u02.val[0]), vreinterpret_u32_u16(u46.val[0]));
+      const uint32x2x2_t w26 = vtrn_u32(vreinterpret_u32_u16(u02.val[1]), vreinterpret_u32_u16(u46.val[1]));
+      const uint32x2x2_t w15 = vtrn_u32(vreinterpret_u32_u16(u13.val[0]), vreinterpret_u32_u16(u57.val[0]));
+      const uint32x2x2_t w37 = vtrn_u32(vreinterpret_u32_u16(u13.val[1]), vreinterpret_u32_u16(u57.val[1]));
+
+      uint8_t* o0 = o;
+      uint8_t* o1 = (uint8_t*) ((uintptr_t) o0 + output_stride);
+      uint8_t* o2 = (uint8_t*) ((uintptr_t) o1 + output_stride);
+      uint8_t* o3 = (uint8_t*) ((uintptr_t) o2 + output_stride);
+      uint8_t* o4 = (uint8_t*) ((uintptr_t) o3 + output_stride);
+      uint8_t* o5 = (uint8_t*) ((uintptr_t) o4 + output_stride);
+      uint8_t* o6 = (uint8_t*) ((uintptr_t) o5 + output_stride);
+      uint8_t* o7 = (uint8_t*) ((uintptr_t) o6 + output_stride);
+      vst1_u8(o0, vreinterpret_u8_u32(w04.val[0]));
+      vst1_u8(o1, vreinterpret_u8_u32(w15.val[0]));
+      vst1_u8(o2, vreinterpret_u8_u32(w26.val[0]));
+      vst1_u8(o3, vreinterpret_u8_u32(w37.val[0]));
+      vst1_u8(o4, vreinterpret_u8_u32(w04.val[1]));
+      vst1_u8(o5, vreinterpret_u8_u32(w15.val[1]));
+      vst1_u8(o6, vreinterpret_u8_u32(w26.val[1]));
+      vst1_u8(o7, vreinterpret_u8_u32(w37.val[1]));
+
+      i0 += 8;
+      i1 += 8;
+      i2 += 8;
+      i3 += 8;
+      i4 += 8;
+      i5 += 8;
+      i6 += 8;
+      i7 += 8;
+      o = (uint8_t*) ((uintptr_t) o7 + output_stride);
+    }
+    for (; bw != 0; bw -= 1) {
+      o[0] = *i0++;
+      o[1] = *i1++;
+      o[2] = *i2++;
+      o[3] = *i3++;
+      o[4] = *i4++;
+      o[5] = *i5++;
+      o[6] = *i6++;
+      o[7] = *i7++;
+      o = (uint8_t*) ((uintptr_t) o + output_stride);
+    }
+
+    input = (const uint8_t*) ((uintptr_t) input + input_stride * 8);
+    output += 8;
+  }
+  for (; block_height != 0; block_height -= 1) {
+    const uint8_t* i = input;
+    uint8_t* o = output;
+    size_t bw = block_width;
+    do {
+      *o = *i++;
+      o = (uint8_t*) ((uintptr_t) o + output_stride);
+    } while (--bw != 0);
+
+    input = (const uint8_t*) ((uintptr_t) input + input_stride);
+    output += 1;
+  }
+}
@@ -0,0 +1,121 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/transpose.h>
+
+
+void xnn_x8_transpose_ukernel__8x8_sse2(
+    const uint8_t* input,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_stride,
+    size_t block_width,
+    size_t block_height)
+{
+  assert(block_width != 0);
+  assert(block_height != 0);
+  assert(input_stride >= block_width * sizeof(uint8_t));
+  assert(output_stride >= block_height * sizeof(uint8_t));
+
+  // Each group of 8 input rows is written to 8 output columns.
+  for (; block_height >= 8; block_height -= 8) {
+    const uint8_t* i0 = input;
+    const uint8_t* i1 = (const uint8_t*) ((uintptr_t) i0 + input_stride);
+    const uint8_t* i2 = (const uint8_t*) ((uintptr_t) i1 + input_stride);
+    const uint8_t* i3 = (const uint8_t*) ((uintptr_t) i2 + input_stride);
+    const uint8_t* i4 = (const uint8_t*) ((uintptr_t) i3 + input_stride);
+    const uint8_t* i5 = (const uint8_t*) ((uintptr_t) i4 + input_stride);
+    const uint8_t* i6 = (const uint8_t*) ((uintptr_t) i5 + input_stride);
+    const uint8_t* i7 = (const uint8_t*) ((uintptr_t) i6 + input_stride);
+    uint8_t* o = output;
+
+    size_t bw = block_width;
+    for (; bw >= 8; bw -= 8) {
+      const __m128i v0 = _mm_loadl_epi64((const __m128i*) i0);
+      const __m128i v1 = _mm_loadl_epi64((const __m128i*) i1);
+      const __m128i v2 = _mm_loadl_epi64((const __m128i*) i2);
+      const __m128i v3 = _mm_loadl_epi64((const __m128i*) i3);
+      const __m128i v4 = _mm_loadl_epi64((const __m128i*) i4);
+      const __m128i v5 = _mm_loadl_epi64((const __m128i*) i5);
+      const __m128i v6 = _mm_loadl_epi64((const __m128i*) i6);
+      const __m128i v7 = _mm_loadl_epi64((const __m128i*) i7);
+
+      // Interleave pairs of rows: a0 b0 a1 b1 ... a7 b7.
+      const __m128i t0 = _mm_unpacklo_epi8(v0, v1);
+      const __m128i t1 = _mm_unpacklo_epi8(v2, v3);
+      const __m128i t2 = _mm_unpacklo_epi8(v4, v5);
+      const __m128i t3 = _mm_unpacklo_epi8(v6, v7);
+
+      // Interleave pairs of pairs of rows: a0 b0 c0 d0 a1 b1 c1 d1 ... a3 b3 c3 d3.
+      const __m128i u0 = _mm_unpacklo_epi16(t0, t1);
+      const __m128i u1 = _mm_unpackhi_epi16(t0, t1);
+      const __m128i u2 = _mm_unpacklo_epi16(t2, t3);
+      const __m128i u3 = _mm_unpackhi_epi16(t2, t3);
+
+      // Two output rows in each vector: a0 ... h0 a1 ... h1.
+      const __m128i w01 = _mm_unpacklo_epi32(u0, u2);
+      const __m128i w23 = _mm_unpackhi_epi32(u0, u2);
+      const __m128i w45 = _mm_unpacklo_epi32(u1, u3);
+      const __m128i w67 = _mm_unpackhi_epi32(u1, u3);
+
+      uint8_t* o0 = o;
+      uint8_t* o1 = (uint8_t*) ((uintptr_t) o0 + output_stride);
+      uint8_t* o2 = (uint8_t*) ((uintptr_t) o1 + output_stride);
+      uint8_t* o3 = (uint8_t*) ((uintptr_t) o2 + output_stride);
+      uint8_t* o4 = (uint8_t*) ((uintptr_t) o3 + output_stride);
+      uint8_t* o5 = (uint8_t*) ((uintptr_t) o4 + output_stride);
+      uint8_t* o6 = (uint8_t*) ((uintptr_t) o5 + output_stride);
+      uint8_t* o7 = (uint8_t*) ((uintptr_t) o6 + output_stride);
+      _mm_storel_epi64((__m128i*) o0, w01);
+      _mm_storel_epi64((__m128i*) o1, _mm_unpackhi_epi64(w01, w01));
+      _mm_storel_epi64((__m128i*) o2, w23);
+      _mm_storel_epi64((__m128i*) o3, _mm_unpackhi_epi64(w23, w23));
+      _mm_storel_epi64((__m128i*) o4, w45);
+      _mm_storel_epi64((__m128i*) o5, _mm_unpackhi_epi64(w45, w45));
+      _mm_storel_epi64((__m128i*) o6, w67);
+      _mm_storel_epi64((__m128i*) o7, _mm_unpackhi_epi64(w67, w67));
+
+      i0 += 8;
+      i1 += 8;
+      i2 += 8;
+      i3 += 8;
+      i4 += 8;
+      i5 += 8;
+      i6 += 8;
+      i7 += 8;
+      o = (uint8_t*) ((uintptr_t) o7 + output_stride);
+    }
+    for (; bw != 0; bw -= 1) {
+      o[0] = *i0++;
+      o[1] = *i1++;
+      o[2] = *i2++;
+      o[3] = *i3++;
+      o[4] = *i4++;
+      o[5] = *i5++;
+      o[6] = *i6++;
+      o[7] = *i7++;
+      o = (uint8_t*) ((uintptr_t) o + output_stride);
+    }
+
+    input = (const uint8_t*) ((uintptr_t) input + input_stride * 8);
+    output += 8;
+  }
+  for (; block_height != 0; block_height -= 1) {
+    const uint8_t* i = input;
+    uint8_t* o = output;
+    size_t bw = block_width;
+    do {
+      *o = *i++;
+      o = (uint8_t*) ((uintptr_t) o + output_stride);
+    } while (--bw != 0);
+
+    input = (const uint8_t*) ((uintptr_t) input + input_stride);
+    output += 1;
+  }
+}
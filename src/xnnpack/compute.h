@@ -6,6 +6,7 @@
 #pragma once
 
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -65,6 +66,7 @@ struct gemm_context {
   size_t k_scaled;
   const void* a;
   size_t a_stride;
+  size_t ga_stride;
   const void* packed_w;
   size_t w_stride;
   size_t wg_stride;
@@ -75,10 +77,12 @@ struct gemm_context {
   uint32_t log2_csize;
   struct xnn_hmp_gemm_ukernel ukernel;
   union {
+    union xnn_qc8_gemm_params qc8;
     union xnn_qs8_gemm_params qs8;
     union xnn_qu8_gemm_params qu8;
     struct xnn_f16_scaleminmax_params f16;
     union xnn_f32_minmax_params f32;
+    union xnn_f32_hswish_params f32_hswish;
   } params;
 };
 
@@ -118,6 +122,158 @@ struct gemm_context {
   #endif  // XNN_MAX_UARCH_TYPES > 1
 #endif
 
+// Context for Batch Matrix Multiplication, where both input matrices are computed at run time.
+// C[g] [MxN] := A[g] [MxK] * B[g] [KxN]
+// B matrices are first packed, with zero bias, into the layout of GEMM weights, and then the grouped GEMM runs over the
+// packed matrices. The GEMM context goes first, so that the context can be passed to the GEMM compute functions.
+struct batch_matrix_multiply_context {
+  struct gemm_context gemm;
+  // K dimension of the A and B matrices.
+  size_t k;
+  // N dimension of the B and C matrices.
+  size_t n;
+  // Input matrices B, either as K rows of N elements, or, if transposed, as N rows of K elements.
+  const void* b;
+  // Stride, in bytes, between adjacent B matrices.
+  size_t gb_stride;
+  bool transpose_b;
+  uint32_t nr;
+  uint32_t kr;
+  uint32_t sr;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_batch_matrix_multiply_pack_b(
+      const struct batch_matrix_multiply_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t group_index,
+      size_t nr_block_start,
+      size_t nr_block_size);
+#endif
+
+// Context for Pre-packed Matrix-Matrix Multiplication.
+// C [MxN] := A [MxK] * B [KxN] + bias [N]
+// Rows of A are packed with the PACKX micro-kernel into panels of MR interleaved rows before the multiplication.
+struct ppmm_context {
+  // K dimension of the A and B matrices, pre-scaled by sizeof(float).
+  size_t k_scaled;
+  // Input matrix A.
+  const void* a;
+  // Stride, in bytes, between adjacent rows of A matrix.
+  size_t a_stride;
+  // Buffer for packed panels of A matrix. Each panel holds MR rows and takes MR * k_scaled bytes.
+  void* packed_a;
+  // Packed bias elements and filter elements, in the same layout as for GEMM micro-kernels with KR = SR = 1.
+  const void* packed_w;
+  // N dimension of the B and C matrices.
+  size_t n;
+  // Output matrix C.
+  void* c;
+  // Stride, in bytes, between adjacent rows of C matrix.
+  size_t cm_stride;
+  // Stride, in bytes, between adjacent NR-sized tiles within a row of C matrix.
+  size_t cn_stride;
+  xnn_x32_packx_ukernel_function packx_ukernel;
+  xnn_f32_ppmm_minmax_ukernel_function ppmm_ukernel;
+  union xnn_f32_minmax_params params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_ppmm(
+      const struct ppmm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t mr_block_start,
+      size_t mr_block_size);
+#endif
+
+// Context for GEMM with dynamically quantized inputs (QD8).
+// C [MxN] := dequantize(quantize(A [MxK]) * B [KxN]) + bias [N]
+// Each row of A is first quantized to int8 with its own scale and zero point by the VCVT micro-kernel, and the
+// quantized rows are multiplied with int8 weights, which have per-channel scales packed after them.
+struct qd8_gemm_context {
+  // K dimension of the A and B matrices.
+  size_t k;
+  // Input matrix A, in fp32.
+  const void* a;
+  // Stride, in bytes, between adjacent rows of A matrix.
+  size_t a_stride;
+  // Buffer for the quantized A matrix, with rows of K int8 elements.
+  void* quantized_a;
+  // Quantization parameters for each row of A matrix.
+  struct xnn_qd8_quantization_params* quantization_params;
+  // Packed negated sums of filter elements, filter elements, filter scales, and bias elements.
+  const void* packed_w;
+  // Stride, in bytes, between packed weights for adjacent output channels.
+  size_t w_stride;
+  // Output matrix C.
+  void* c;
+  // Stride, in bytes, between adjacent rows of C matrix.
+  size_t cm_stride;
+  // Stride, in bytes, between adjacent NR-sized tiles within a row of C matrix.
+  size_t cn_stride;
+  xnn_f32_qd8_vcvt_ukernel_function vcvt_ukernel;
+  xnn_qd8_f32_qc8w_gemm_ukernel_function gemm_ukernel;
+  union xnn_f32_minmax_params params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_qd8_quantize_a(
+      const struct qd8_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t m_index);
+
+  XNN_PRIVATE void xnn_compute_qd8_gemm(
+      const struct qd8_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+#endif
+
+// Context for GEMM with the K dimension split in blocks.
+// C [MxN] := A [MxK] * B [KxN] + bias [N]
+// Each block of K is multiplied with GEMMINC micro-kernels, which accumulate on top of partial sums for the previous
+// blocks. Partial sums are kept in MR x NR tiles, and only the last block of K writes C and applies output clamping.
+struct kblocked_gemm_context {
+  // K dimension of the A and B matrices, pre-scaled by sizeof(float).
+  size_t k_scaled;
+  // Maximum size of a block of K, pre-scaled by sizeof(float).
+  size_t kc_scaled;
+  // Input matrix A.
+  const void* a;
+  // Stride, in bytes, between adjacent rows of A matrix.
+  size_t a_stride;
+  // Packed bias elements and filter elements, in the same layout as for GEMM micro-kernels with KR = SR = 1.
+  const void* packed_w;
+  // Stride, in bytes, between packed weights for adjacent output channels.
+  size_t w_stride;
+  // Output matrix C.
+  void* c;
+  // Stride, in bytes, between adjacent rows of C matrix.
+  size_t cm_stride;
+  // Buffer for partial sums. It consists of two halves, which alternate between the source and the destination of
+  // partial sums for adjacent blocks of K. Each half holds round_up(M, MR) rows of partial sums, stored in MR x NR
+  // tiles: the tile for rows starting at m and output channels starting at n is located at
+  // m * acc_stride + n * MR * sizeof(float) bytes into the half.
+  void* acc;
+  // Stride, in bytes, between adjacent rows of partial sums (NR-rounded N dimension, pre-scaled by sizeof(float)).
+  size_t acc_stride;
+  // Stride, in bytes, between the two halves of the buffer for partial sums.
+  size_t acc_buffer_stride;
+  uint32_t mr;
+  uint32_t nr;
+  xnn_f32_gemminc_minmax_ukernel_function ukernel;
+  union xnn_f32_minmax_params params;
+  // Parameters without output clamping, for all blocks of K except the last one.
+  union xnn_f32_minmax_params partial_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_kblocked_gemm(
+      const struct kblocked_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+#endif
+
 // Context for Sparse Matrix-Dense Matrix Multiplication.
 // C [MxN] := A [MxK] * B [KxN] + bias [N]
 // A and C are dense matrices with row-major storage, B is a sparse matrix.
@@ -178,10 +334,12 @@ struct igemm_context {
   uint32_t log2_csize;
   struct xnn_hmp_igemm_ukernel ukernel;
   union {
+    union xnn_qc8_gemm_params qc8;
     union xnn_qs8_gemm_params qs8;
     union xnn_qu8_gemm_params qu8;
     struct xnn_f16_scaleminmax_params f16;
     union xnn_f32_minmax_params f32;
+    union xnn_f32_hswish_params f32_hswish;
   } params;
 };
 
@@ -274,6 +432,7 @@ struct subgemm_context {
   uint32_t log2_csize;
   struct xnn_hmp_gemm_ukernel ukernel;
   union {
+    union xnn_qc8_gemm_params qc8;
     union xnn_qs8_gemm_params qs8;
     union xnn_qu8_gemm_params qu8;
     struct xnn_f16_scaleminmax_params f16;
@@ -320,6 +479,7 @@ struct subconv_context {
   uint32_t log2_csize;
   struct xnn_hmp_igemm_ukernel ukernel;
   union {
+    union xnn_qc8_gemm_params qc8;
     union xnn_qs8_gemm_params qs8;
     union xnn_qu8_gemm_params qu8;
     struct xnn_f16_scaleminmax_params f16;
@@ -393,14 +553,21 @@ struct dwconv_context {
   size_t groups;
   const void* zero;
   size_t output_increment;
+  // Number of kernel elements and size of the per-row accumulation buffer in bytes. Only used by multipass
+  // micro-kernels.
+  size_t kernel_size;
+  size_t buffer_size;
   union {
+    union xnn_qc8_gemm_params qc8;
     union xnn_qs8_gemm_params qs8;
     union xnn_qu8_gemm_params qu8;
     struct xnn_f16_minmax_params f16;
     union xnn_f32_minmax_params f32;
+    union xnn_f32_hswish_params f32_hswish;
   } params;
   union {
     xnn_dwconv_unipass_ukernel_function unipass_ukernel;
+    xnn_dwconv_multipass_ukernel_function multipass_ukernel;
   };
 };
 
@@ -409,6 +576,11 @@ struct dwconv_context {
       const struct dwconv_context context[restrict XNN_MIN_ELEMENTS(1)],
       size_t batch_index,
       size_t output_y);
+
+  XNN_PRIVATE void xnn_compute_dwconv_multipass(
+      const struct dwconv_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t output_y);
 #endif
 
 struct dwconv2d_context {
@@ -847,6 +1019,8 @@ struct univector_strided_context {
     union xnn_u8_minmax_params u8_output;
     union xnn_f32_minmax_params f32_output;
     union xnn_f32_hswish_params f32_hswish;
+    union xnn_f32_qs8_cvt_params f32_qs8_cvt;
+    union xnn_qs8_f32_cvt_params qs8_f32_cvt;
   } params;
 };
 
@@ -859,14 +1033,17 @@ struct univector_strided_context {
 
 struct univector_contiguous_context {
   const void* x;
-  size_t x_stride;
   void* y;
-  size_t y_stride;
+  // Log2 of the sizes of input and output elements, which differ in conversion operators.
+  uint16_t log2_xsize;
+  uint16_t log2_ysize;
   xnn_univector_ukernel_function ukernel;
   union {
     union xnn_u8_minmax_params u8_output;
     union xnn_f32_minmax_params f32_output;
     union xnn_f32_hswish_params f32_hswish;
+    union xnn_f32_qs8_cvt_params f32_qs8_cvt;
+    union xnn_qs8_f32_cvt_params qs8_f32_cvt;
   } params;
 };
 
@@ -935,6 +1112,29 @@ struct pad_context {
       size_t i, size_t j, size_t k, size_t l, size_t m);
 #endif
 
+struct transpose_context {
+  const void* input;
+  void* output;
+  // Strides, in bytes, of the input and the output along the iterated dimensions, outermost first.
+  size_t input_stride[XNN_MAX_TENSOR_DIMS];
+  size_t output_stride[XNN_MAX_TENSOR_DIMS];
+  // Number of bytes copied contiguously when the innermost dimension is not permuted.
+  size_t copy_size;
+  xnn_transpose_ukernel_function transpose_ukernel;
+  xnn_univector_ukernel_function copy_ukernel;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_transpose_6d_tile_2d(
+      const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t i, size_t j, size_t k, size_t l, size_t m, size_t n,
+      size_t tile_m, size_t tile_n);
+
+  XNN_PRIVATE void xnn_compute_transpose_copy_5d(
+      const struct transpose_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t i, size_t j, size_t k, size_t l, size_t m);
+#endif
+
 struct u8_softmax_context {
   size_t n;
   const uint8_t* x;
@@ -952,6 +1152,23 @@ struct u8_softmax_context {
       size_t batch_index);
 #endif
 
+struct s8_softmax_context {
+  size_t n;
+  const int8_t* x;
+  size_t x_stride;
+  const uint32_t* t;
+  int8_t* y;
+  size_t y_stride;
+  xnn_s8_rmax_ukernel_function rmax_ukernel;
+  xnn_u8_lut32norm_ukernel_function lut_norm_ukernel;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_s8_softmax(
+      const struct s8_softmax_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index);
+#endif
+
 struct f32_three_pass_softmax_context {
   size_t n;
   const void* x;
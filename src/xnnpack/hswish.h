@@ -26,6 +26,9 @@ extern "C" {
 DECLARE_F16_HSWISH_UKERNEL_FUNCTION(xnn_f16_hswish_ukernel__neonfp16arith_x8)
 DECLARE_F16_HSWISH_UKERNEL_FUNCTION(xnn_f16_hswish_ukernel__neonfp16arith_x16)
 
+DECLARE_F16_HSWISH_UKERNEL_FUNCTION(xnn_f16_hswish_ukernel__f16c_x8)
+DECLARE_F16_HSWISH_UKERNEL_FUNCTION(xnn_f16_hswish_ukernel__f16c_x16)
+
 #define DECLARE_F32_HSWISH_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                         \
       size_t n,                                      \
@@ -64,6 +64,21 @@ extern "C" {
       const float* zero,                                   \
       const union xnn_f32_minmax_params* params);
 
+#define DECLARE_F32_IGEMM_HSWISH_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                               \
+      size_t mr,                                           \
+      size_t nr,                                           \
+      size_t kc,                                           \
+      size_t ks,                                           \
+      const float** a,                                     \
+      const float* w,                                      \
+      float* c,                                            \
+      size_t cm_stride,                                    \
+      size_t cn_stride,                                    \
+      size_t a_offset,                                     \
+      const float* zero,                                   \
+      const union xnn_f32_hswish_params* params);
+
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_4x2__neon_lane_ld64)
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_4x4__neon_lane_ld64)
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_1x8__neon_lane_ld64)
@@ -132,6 +147,9 @@ DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_3x8__sse_
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_4x8__sse_load1)
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_5x8__sse_load1)
 
+DECLARE_F32_IGEMM_HSWISH_UKERNEL_FUNCTION(xnn_f32_igemm_hswish_ukernel_1x8__sse_load1)
+DECLARE_F32_IGEMM_HSWISH_UKERNEL_FUNCTION(xnn_f32_igemm_hswish_ukernel_4x8__sse_load1)
+
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_1x8__sse_dup)
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_3x8__sse_dup)
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_4x8__sse_dup)
@@ -159,6 +177,9 @@ DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_3x16__avx
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_4x16__avx_broadcast)
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_5x16__avx_broadcast)
 
+DECLARE_F32_IGEMM_HSWISH_UKERNEL_FUNCTION(xnn_f32_igemm_hswish_ukernel_1x16__avx_broadcast)
+DECLARE_F32_IGEMM_HSWISH_UKERNEL_FUNCTION(xnn_f32_igemm_hswish_ukernel_5x16__avx_broadcast)
+
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_1x8__fma3_broadcast)
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_4x8__fma3_broadcast)
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_5x8__fma3_broadcast)
@@ -170,6 +191,9 @@ DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_3x16__fma
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_4x16__fma3_broadcast)
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_5x16__fma3_broadcast)
 
+DECLARE_F32_IGEMM_HSWISH_UKERNEL_FUNCTION(xnn_f32_igemm_hswish_ukernel_1x16__fma3_broadcast)
+DECLARE_F32_IGEMM_HSWISH_UKERNEL_FUNCTION(xnn_f32_igemm_hswish_ukernel_5x16__fma3_broadcast)
+
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_1x16s4__fma3_broadcast)
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_3x16s4__fma3_broadcast)
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_4x16s4__fma3_broadcast)
@@ -248,6 +272,10 @@ DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_2x4__wasm
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_4x2__wasm)
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_4x4__wasm)
 
+DECLARE_F32_IGEMM_HSWISH_UKERNEL_FUNCTION(xnn_f32_igemm_hswish_ukernel_1x4__wasm)
+DECLARE_F32_IGEMM_HSWISH_UKERNEL_FUNCTION(xnn_f32_igemm_hswish_ukernel_2x4__wasm)
+DECLARE_F32_IGEMM_HSWISH_UKERNEL_FUNCTION(xnn_f32_igemm_hswish_ukernel_4x4__wasm)
+
 DECLARE_F32_IGEMM_UKERNEL_FUNCTION(xnn_f32_igemm_ukernel_4x2__scalar)
 DECLARE_F32_IGEMM_UKERNEL_FUNCTION(xnn_f32_igemm_ukernel_1x4__scalar)
 DECLARE_F32_IGEMM_UKERNEL_FUNCTION(xnn_f32_igemm_ukernel_2x4__scalar)
@@ -263,6 +291,10 @@ DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_1x4__scal
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_2x4__scalar)
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_4x4__scalar)
 
+DECLARE_F32_IGEMM_HSWISH_UKERNEL_FUNCTION(xnn_f32_igemm_hswish_ukernel_1x4__scalar)
+DECLARE_F32_IGEMM_HSWISH_UKERNEL_FUNCTION(xnn_f32_igemm_hswish_ukernel_2x4__scalar)
+DECLARE_F32_IGEMM_HSWISH_UKERNEL_FUNCTION(xnn_f32_igemm_hswish_ukernel_4x4__scalar)
+
 
 #define DECLARE_F16_IGEMM_MINMAX_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                               \
@@ -288,6 +320,13 @@ DECLARE_F16_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f16_igemm_minmax_ukernel_4x16__neo
 DECLARE_F16_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f16_igemm_minmax_ukernel_6x16__neonfp16arith_ld64)
 DECLARE_F16_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f16_igemm_minmax_ukernel_8x16__neonfp16arith_ld64)
 
+DECLARE_F16_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f16_igemm_minmax_ukernel_1x8__fma3_broadcast)
+DECLARE_F16_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f16_igemm_minmax_ukernel_4x8__fma3_broadcast)
+DECLARE_F16_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f16_igemm_minmax_ukernel_1x16__fma3_broadcast)
+DECLARE_F16_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f16_igemm_minmax_ukernel_3x16__fma3_broadcast)
+DECLARE_F16_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f16_igemm_minmax_ukernel_4x16__fma3_broadcast)
+DECLARE_F16_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f16_igemm_minmax_ukernel_5x16__fma3_broadcast)
+
 
 #define DECLARE_QU8_IGEMM_MINMAX_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                               \
@@ -523,6 +562,38 @@ DECLARE_QS8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qs8_igemm_minmax_ukernel_2x4c8__wa
 DECLARE_QS8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qs8_igemm_minmax_ukernel_3x4c8__wasmsimd_ld128)
 
 
+#define DECLARE_QC8_IGEMM_MINMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                               \
+      size_t mr,                                           \
+      size_t nr,                                           \
+      size_t kc,                                           \
+      size_t ks,                                           \
+      const int8_t** a,                                    \
+      const void* w,                                       \
+      int8_t* c,                                           \
+      size_t cm_stride,                                    \
+      size_t cn_stride,                                    \
+      size_t a_offset,                                     \
+      const int8_t* zero,                                  \
+      const union xnn_qc8_gemm_params* params);
+
+DECLARE_QC8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qc8_igemm_minmax_ukernel_1x8c2__neon_mlal_padal_dup)
+DECLARE_QC8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qc8_igemm_minmax_ukernel_2x8c2__neon_mlal_padal_dup)
+
+DECLARE_QC8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qc8_igemm_minmax_ukernel_1x8c4__neondot)
+DECLARE_QC8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qc8_igemm_minmax_ukernel_4x8c4__neondot)
+DECLARE_QC8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qc8_igemm_minmax_ukernel_1x16c4__neondot)
+DECLARE_QC8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qc8_igemm_minmax_ukernel_4x16c4__neondot)
+
+DECLARE_QC8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qc8_igemm_minmax_ukernel_1x4c8__sse2_ld64)
+DECLARE_QC8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qc8_igemm_minmax_ukernel_2x4c8__sse2_ld64)
+DECLARE_QC8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qc8_igemm_minmax_ukernel_3x4c8__sse2_ld64)
+
+DECLARE_QC8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qc8_igemm_minmax_ukernel_1x4c8__sse41_ld64)
+DECLARE_QC8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qc8_igemm_minmax_ukernel_2x4c8__sse41_ld64)
+DECLARE_QC8_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_qc8_igemm_minmax_ukernel_3x4c8__sse41_ld64)
+
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
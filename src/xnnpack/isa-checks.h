@@ -48,6 +48,13 @@
     } \
   } while (0)
 
+#define TEST_REQUIRES_X86_F16C \
+  do { \
+    if (!cpuinfo_initialize() || !cpuinfo_has_x86_f16c()) { \
+      GTEST_SKIP(); \
+    } \
+  } while (0)
+
 #define TEST_REQUIRES_X86_XOP \
   do { \
     if (!cpuinfo_initialize() || !cpuinfo_has_x86_xop()) { \
@@ -83,6 +90,13 @@
     } \
   } while (0)
 
+#define TEST_REQUIRES_X86_AVX512VBMI \
+  do { \
+    if (!cpuinfo_initialize() || !cpuinfo_has_x86_avx512bw() || !cpuinfo_has_x86_avx512vbmi()) { \
+      GTEST_SKIP(); \
+    } \
+  } while (0)
+
 #define TEST_REQUIRES_ARM_NEON \
   do { \
     if (!cpuinfo_initialize() || !cpuinfo_has_arm_neon()) { \
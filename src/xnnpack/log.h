@@ -37,16 +37,14 @@ extern "C" {
   inline static const char* xnn_node_type_to_string(enum xnn_node_type type) {
     return "Unknown";
   }
-
-  inline static const char* xnn_operator_type_to_string(enum xnn_operator_type type) {
-    return "Unknown";
-  }
 #else
   const char* xnn_datatype_to_string(enum xnn_datatype type);
   const char* xnn_node_type_to_string(enum xnn_node_type type);
-  const char* xnn_operator_type_to_string(enum xnn_operator_type type);
 #endif
 
+// Operator type names are also reported by runtime profiling, and are available regardless of logging.
+const char* xnn_operator_type_to_string(enum xnn_operator_type type);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
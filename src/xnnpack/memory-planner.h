@@ -26,6 +26,8 @@ struct xnn_value_usage {
   size_t tensor_size;
   // The memory offset of this xnn_value from the beginning of a memory buffer.
   size_t alloc_offset;
+  // The id of the xnn_value whose memory this xnn_value reuses, or XNN_INVALID_VALUE_ID if it gets its own memory.
+  uint32_t reuse_value_id;
 };
 
 // Track the memory allocation in a memory arena for a subgraph.
@@ -47,12 +49,34 @@ inline static void xnn_release_value_allocation_tracker(struct xnn_value_allocat
   xnn_release_memory(tracker->usage);
 }
 
+// Replace the Node indices in the lifecycles of xnn_values with the execution levels of the Nodes in 'node_levels'.
+// Nodes on the same level may run concurrently, so xnn_values used on the same level never share memory. Must be called
+// before any other planning, and excludes in-place planning with xnn_plan_in_place_operations.
+XNN_INTERNAL void xnn_assign_value_lifecycle_levels(struct xnn_value_allocation_tracker* tracker,
+                                                    const uint32_t* node_levels);
+
 // Add a to-be-allocated xnn_value (referred by 'value_id') of size 'tensor_size' to the allocation tracker.
 // Note: this function assumes 'value_id's added in increasing order for simplicity as it's called inside a loop
 // iterating over 'subgraph->values'.
 XNN_INTERNAL void xnn_add_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker,
                                                    uint32_t value_id, size_t tensor_size);
 
+// Make the to-be-allocated xnn_value (referred by 'value_id') share the memory of another to-be-allocated xnn_value
+// (referred by 'reuse_value_id'). The lifecycle of the reused xnn_value is extended up to 'new_last_node', which must
+// cover the last use of 'value_id'.
+XNN_INTERNAL void xnn_mark_tensor_as_reuse(struct xnn_value_allocation_tracker* tracker,
+                                           uint32_t value_id, uint32_t reuse_value_id, uint32_t new_last_node);
+
+// Make the to-be-allocated xnn_value (referred by 'value_id') own the memory of an xnn_value (referred by 'view_id')
+// which is a view of a part of it, e.g. a slice of its channels. The view is not allocated on its own, and the
+// lifecycle of 'value_id' is extended on both ends to cover the lifecycle of the view.
+XNN_INTERNAL void xnn_mark_tensor_as_view(struct xnn_value_allocation_tracker* tracker,
+                                          uint32_t view_id, uint32_t value_id);
+
+// Let elementwise Nodes write their output over an input which is not used by any subsequent Node, so that they are
+// executed in-place. Must be called after all to-be-allocated xnn_values were added to the tracker.
+XNN_INTERNAL void xnn_plan_in_place_operations(struct xnn_value_allocation_tracker* tracker);
+
 // Plan the exact the memory allocation for intermediate tensors according to the xnn_value allocation tracker.
 XNN_INTERNAL void xnn_plan_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker);
 
@@ -40,17 +40,24 @@ enum xnn_operator_type {
   xnn_operator_type_average_pooling_nhwc_f32,
   xnn_operator_type_average_pooling_nhwc_qu8,
   xnn_operator_type_bankers_rounding_nc_f32,
+  xnn_operator_type_batch_matrix_multiply_nc_f32,
   xnn_operator_type_channel_shuffle_nc_x32,
   xnn_operator_type_channel_shuffle_nc_x8,
   xnn_operator_type_clamp_nc_f32,
   xnn_operator_type_clamp_nc_u8,
   xnn_operator_type_ceiling_nc_f32,
   xnn_operator_type_constant_pad_nd_x32,
+  xnn_operator_type_convert_nc_f16_f32,
+  xnn_operator_type_convert_nc_f32_f16,
+  xnn_operator_type_convert_nc_f32_qs8,
+  xnn_operator_type_convert_nc_qs8_f32,
   xnn_operator_type_convolution_nchw_f32,
   xnn_operator_type_convolution_nhwc_f16,
   xnn_operator_type_convolution_nhwc_f32,
+  xnn_operator_type_convolution_nhwc_qc8,
   xnn_operator_type_convolution_nhwc_qs8,
   xnn_operator_type_convolution_nhwc_qu8,
+  xnn_operator_type_copy_nc_x8,
   xnn_operator_type_copy_nc_x32,
   xnn_operator_type_deconvolution_nhwc_f32,
   xnn_operator_type_deconvolution_nhwc_qu8,
@@ -59,6 +66,8 @@ enum xnn_operator_type {
   xnn_operator_type_divide_nd_f32,
   xnn_operator_type_elu_nc_f32,
   xnn_operator_type_fully_connected_nc_f32,
+  xnn_operator_type_fully_connected_nc_qc8,
+  xnn_operator_type_fully_connected_nc_qd8_f32_qc8w,
   xnn_operator_type_fully_connected_nc_qs8,
   xnn_operator_type_fully_connected_nc_qu8,
   xnn_operator_type_floor_nc_f32,
@@ -84,12 +93,16 @@ enum xnn_operator_type {
   xnn_operator_type_sigmoid_nc_f32,
   xnn_operator_type_sigmoid_nc_qu8,
   xnn_operator_type_softmax_nc_f32,
+  xnn_operator_type_softmax_nc_qs8,
   xnn_operator_type_softmax_nc_qu8,
   xnn_operator_type_square_nc_f32,
   xnn_operator_type_square_root_nc_f32,
   xnn_operator_type_squared_difference_nd_f32,
   xnn_operator_type_subtract_nd_f32,
   xnn_operator_type_truncation_nc_f32,
+  xnn_operator_type_transpose_nd_x8,
+  xnn_operator_type_transpose_nd_x16,
+  xnn_operator_type_transpose_nd_x32,
   xnn_operator_type_unpooling_nhwc_x32,
 };
 
@@ -107,6 +120,7 @@ struct xnn_ukernel_dwconv {
     xnn_dwconv_unipass_ukernel_function unipass_function;
     xnn_dwconv_multipass_ukernel_function multipass_function;
   };
+  uint8_t channel_tile;
   uint8_t primary_tile;
   uint8_t incremental_tile;
 };
@@ -122,11 +136,39 @@ struct xnn_ukernel_dwconv2d {
 struct xnn_ukernel_gemm {
   struct xnn_hmp_gemm_ukernel general_case;
   struct xnn_hmp_gemm_ukernel mr1_case;
+  // Optional PPMM micro-kernels which consume the same packed weights. NULL if PPMM can't be used with the operator.
+  xnn_f32_ppmm_minmax_ukernel_function ppmm_function;
+  xnn_x32_packx_ukernel_function packx_function;
+  // Optional GEMMINC micro-kernel which consumes the same packed weights. NULL if K can't be split in blocks.
+  xnn_f32_gemminc_minmax_ukernel_function gemminc_function;
+  // GEMM micro-kernels with dynamically quantized inputs, used instead of general_case and mr1_case, and the VCVT
+  // micro-kernel which quantizes rows of fp32 inputs for them.
+  xnn_qd8_f32_qc8w_gemm_ukernel_function qd8_function;
+  xnn_qd8_f32_qc8w_gemm_ukernel_function qd8_mr1_function;
+  xnn_f32_qd8_vcvt_ukernel_function qd8_vcvt_function;
   uint8_t mr;
   uint8_t nr;
   uint8_t kr;
+  uint8_t ppmm_mr;
+  uint8_t gemminc_mr;
 };
 
+// GEMM-based operators switch to PPMM micro-kernels when the GEMM has at least XNN_PPMM_MIN_M rows and at least
+// XNN_PPMM_MIN_NR_TILES tiles of output channels: packing rows of A pays off only when each packed panel is reused
+// across many output channel tiles, and there must be enough panels to keep all threads busy.
+#define XNN_PPMM_MIN_M 64
+#define XNN_PPMM_MIN_NR_TILES 8
+
+// GEMM-based operators split the K dimension in blocks of at most XNN_GEMM_MAX_KC elements when the GEMM has at least
+// XNN_GEMM_KBLOCK_MIN_M rows, XNN_GEMM_KBLOCK_MIN_NR_TILES tiles of output channels, and XNN_GEMM_KBLOCK_MIN_K input
+// channels, so that the block of A rows processed by the micro-kernel stays in L1 cache while it is multiplied by all
+// tiles of output channels. With fewer rows all of A fits in L1 cache anyway, and with fewer tiles of output channels
+// the block is reused too few times to pay for reading and writing the partial sums.
+#define XNN_GEMM_KBLOCK_MIN_M 8
+#define XNN_GEMM_KBLOCK_MIN_NR_TILES 4
+#define XNN_GEMM_KBLOCK_MIN_K 1024
+#define XNN_GEMM_MAX_KC 256
+
 struct xnn_ukernel_igemm {
   struct xnn_hmp_igemm_ukernel general_case;
   struct xnn_hmp_igemm_ukernel mr1_case;
@@ -225,6 +267,10 @@ struct xnn_operator {
   void* output;
 
   void* packed_weights;
+  // Size of the packed weights in bytes, or 0 if the operator can't keep its packed weights in a weights cache.
+  size_t packed_weights_size;
+  // Weights cache which owns the packed weights, or NULL if the operator owns the packed weights.
+  struct xnn_weights_cache* weights_cache;
   // Total number of non-zero kernel elements when weights use sparse representation.
   size_t num_nonzero_values;
   // Total number of non-zero kernel blocks when weights use sparse representation.
@@ -255,6 +301,9 @@ struct xnn_operator {
   void* lookup_table;
   void* pixelwise_buffer;
   struct subconvolution_params* subconvolution_buffer;
+  // Scratch memory allocated on setup, e.g. for the packed input of PPMM micro-kernels.
+  void* workspace;
+  size_t workspace_size;
   uint32_t flags;
 
   union {
@@ -278,6 +327,9 @@ struct xnn_operator {
       union xnn_f32_scaleminmax_params f32_scaleminmax;
     };
     union xnn_f32_chw_params f32_chw;
+    union xnn_f32_qs8_cvt_params f32_qs8_cvt;
+    union xnn_qs8_f32_cvt_params qs8_f32_cvt;
+    union xnn_qc8_gemm_params qc8_gemm;
     union xnn_qs8_gemm_params qs8_gemm;
     // Average Pooling normally use qs8_avgpool_params, but also initialize qs8_gavgpool_params in case it needs to switch
     // to Global Average Pooling operation.
@@ -303,11 +355,15 @@ struct xnn_operator {
   enum xnn_operator_type type;
   struct xnn_ukernel ukernel;
 
+  // Optional pass which runs before the main computation and packs or quantizes an operand computed at run time into
+  // the layout expected by the micro-kernels. Shares the context of the main computation.
+  struct compute_parameters compute0;
   struct compute_parameters compute;
   struct compute_parameters compute2;
   union {
     struct argmax_pooling_context argmax_pooling;
     struct average_pooling_context average_pooling;
+    struct batch_matrix_multiply_context batch_matrix_multiply;
     struct channel_shuffle_context channel_shuffle;
     struct conv2d_context conv2d;
     struct dwconv2d_context dwconv2d;
@@ -324,19 +380,27 @@ struct xnn_operator {
     struct max_pooling_context max_pooling;
     struct pad_context pad;
     struct pixelwise_average_pooling_context pixelwise_average_pooling;
+    struct ppmm_context ppmm;
+    struct qd8_gemm_context qd8_gemm;
+    struct kblocked_gemm_context kblocked_gemm;
     struct prelu_context prelu;
     struct resize_bilinear_context resize_bilinear;
     struct resize_bilinear_chw_context resize_bilinear_chw;
     struct spmm_context spmm;
     struct subconv_context subconv;
     struct subgemm_context subgemm;
+    struct transpose_context transpose;
     struct f32_three_pass_softmax_context f32_three_pass_softmax;
+    struct s8_softmax_context s8_softmax;
     struct u8_softmax_context u8_softmax;
     struct univector_contiguous_context univector_contiguous;
     struct univector_strided_context univector_strided;
     struct unpooling_context unpooling;
     struct vmulcaddc_context vmulcaddc;
   } context;
+  // Context of the optional second pass over the output, which applies the activation function when it could not be
+  // fused into the micro-kernels. Used only if compute2 is valid.
+  struct univector_strided_context context2;
 
   enum xnn_run_state state;
 };
@@ -30,6 +30,9 @@ struct xnn_qs8_packing_params {
 };
 
 
+// GEMM/IGEMM packing functions leave extra_bytes after the packed weights of each block of nr output channels, and
+// DWCONV packing functions leave extra_bytes after the last pass of each block of cr channels. Micro-kernels which need
+// per-channel data besides the bias (e.g. per-channel quantization scales) read it from this space.
 typedef void (*xnn_pack_gemm_goi_w_function)(
   size_t g,
   size_t nc,
@@ -40,6 +43,7 @@ typedef void (*xnn_pack_gemm_goi_w_function)(
   const void* k,
   const void* b,
   void* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f32_gemm_goi_w(
@@ -52,6 +56,7 @@ XNN_INTERNAL void xnn_pack_f32_gemm_goi_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f16_gemm_goi_w(
@@ -64,6 +69,7 @@ XNN_INTERNAL void xnn_pack_f16_gemm_goi_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_qu8_gemm_goi_w(
@@ -76,6 +82,7 @@ XNN_INTERNAL void xnn_pack_qu8_gemm_goi_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params);
 
 XNN_INTERNAL void xnn_pack_qs8_gemm_goi_w(
@@ -88,6 +95,7 @@ XNN_INTERNAL void xnn_pack_qs8_gemm_goi_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params);
 
 XNN_INTERNAL void xnn_pack_qs8_gemm_xw_goi_w(
@@ -100,6 +108,7 @@ XNN_INTERNAL void xnn_pack_qs8_gemm_xw_goi_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params);
 
 
@@ -112,6 +121,7 @@ typedef void (*xnn_pack_gemm_io_w_function)(
   const void* k,
   const void* b,
   void* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f32_gemm_io_w(
@@ -123,6 +133,7 @@ XNN_INTERNAL void xnn_pack_f32_gemm_io_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f16_gemm_io_w(
@@ -134,6 +145,7 @@ XNN_INTERNAL void xnn_pack_f16_gemm_io_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_qu8_gemm_io_w(
@@ -145,6 +157,7 @@ XNN_INTERNAL void xnn_pack_qu8_gemm_io_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params);
 
 XNN_INTERNAL void xnn_pack_qs8_gemm_io_w(
@@ -156,9 +169,27 @@ XNN_INTERNAL void xnn_pack_qs8_gemm_io_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params);
 
 
+// Same as the IO layout, but the g groups of nc output channels are adjacent within each row of k, and rows are
+// k_stride elements apart. Packs a subset of output channels when k points into the middle of a row.
+XNN_INTERNAL void xnn_pack_f32_gemm_gio_w(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  size_t k_stride,
+  const float* k,
+  const float* b,
+  float* packed_w,
+  size_t extra_bytes,
+  const void* params);
+
+
 typedef void (*xnn_pack_conv_goki_w_function)(
   size_t g,
   size_t nc,
@@ -170,6 +201,7 @@ typedef void (*xnn_pack_conv_goki_w_function)(
   const void* k,
   const void* b,
   void* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f32_conv_goki_w(
@@ -183,6 +215,7 @@ XNN_INTERNAL void xnn_pack_f32_conv_goki_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f16_conv_goki_w(
@@ -196,6 +229,7 @@ XNN_INTERNAL void xnn_pack_f16_conv_goki_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_qu8_conv_goki_w(
@@ -209,6 +243,7 @@ XNN_INTERNAL void xnn_pack_qu8_conv_goki_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params);
 
 XNN_INTERNAL void xnn_pack_qs8_conv_goki_w(
@@ -222,6 +257,7 @@ XNN_INTERNAL void xnn_pack_qs8_conv_goki_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params);
 
 
@@ -234,6 +270,7 @@ typedef void (*xnn_pack_conv_kgo_w_function)(
   const void* k,
   const void* b,
   void* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f32_conv_kgo_w(
@@ -245,6 +282,7 @@ XNN_INTERNAL void xnn_pack_f32_conv_kgo_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f16_conv_kgo_w(
@@ -256,6 +294,7 @@ XNN_INTERNAL void xnn_pack_f16_conv_kgo_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_qu8_conv_kgo_w(
@@ -267,6 +306,7 @@ XNN_INTERNAL void xnn_pack_qu8_conv_kgo_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params);
 
 XNN_INTERNAL void xnn_pack_qs8_conv_kgo_w(
@@ -278,6 +318,7 @@ XNN_INTERNAL void xnn_pack_qs8_conv_kgo_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params);
 
 
@@ -350,7 +391,13 @@ XNN_INTERNAL void xnn_pack_qu8_deconv_goki_w(
   const struct xnn_qu8_packing_params* params);
 
 
+// Depthwise convolution weights are packed in passes over the kernel taps. The first pass holds the bias and the
+// first primary_tile taps for each tile of cr channels, and each subsequent pass holds the next incremental_tile taps
+// for each tile of channels. Taps past the end of the kernel are left as padding. Unipass micro-kernels use
+// incremental_tile = 0 and a primary_tile not smaller than the kernel size.
 typedef void (*xnn_pack_dwconv_ghw_w_function)(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -358,9 +405,12 @@ typedef void (*xnn_pack_dwconv_ghw_w_function)(
   const void* k,
   const void* b,
   void* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f32_dwconv_ghw_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -368,9 +418,12 @@ XNN_INTERNAL void xnn_pack_f32_dwconv_ghw_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f16_dwconv_ghw_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -378,9 +431,12 @@ XNN_INTERNAL void xnn_pack_f16_dwconv_ghw_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_qu8_dwconv_ghw_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -388,9 +444,12 @@ XNN_INTERNAL void xnn_pack_qu8_dwconv_ghw_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params);
 
 XNN_INTERNAL void xnn_pack_qs8_dwconv_ghw_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -398,10 +457,13 @@ XNN_INTERNAL void xnn_pack_qs8_dwconv_ghw_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params);
 
 
 typedef void (*xnn_pack_dwconv_hwg_w_function)(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -409,9 +471,12 @@ typedef void (*xnn_pack_dwconv_hwg_w_function)(
   const void* k,
   const void* b,
   void* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f32_dwconv_hwg_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -419,9 +484,12 @@ XNN_INTERNAL void xnn_pack_f32_dwconv_hwg_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f16_dwconv_hwg_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -429,9 +497,12 @@ XNN_INTERNAL void xnn_pack_f16_dwconv_hwg_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_qu8_dwconv_hwg_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -439,9 +510,12 @@ XNN_INTERNAL void xnn_pack_qu8_dwconv_hwg_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params);
 
 XNN_INTERNAL void xnn_pack_qs8_dwconv_hwg_w(
+  size_t primary_tile,
+  size_t incremental_tile,
   size_t h,
   size_t w,
   size_t c,
@@ -449,6 +523,7 @@ XNN_INTERNAL void xnn_pack_qs8_dwconv_hwg_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params);
 
 
@@ -548,6 +623,64 @@ XNN_INTERNAL void xnn_pack_f16_vmulcaddc_w(
   uint16_t* packed_w,
   const void* params);
 
+// Writes per-channel requantization scales into the extra_bytes space left by the packing functions: scales for each
+// tile of channels_tile channels are written at packed_w, and packed_w advances by stride bytes between tiles.
+typedef void (*xnn_init_qc8_scale_params_function)(
+  size_t channels,
+  size_t channels_tile,
+  size_t stride,
+  const float* scale,
+  void* packed_w);
+
+XNN_INTERNAL void xnn_init_qc8_scale_fp32_params(
+  size_t channels,
+  size_t channels_tile,
+  size_t stride,
+  const float* scale,
+  void* packed_w);
+
+// Packs weights with the given GEMM (GOI layout) or CONV (GOKI layout) packing function, parallelized on the thread
+// pool over groups and tiles of nr output channels. The packing function is called on subsets of output channels of a
+// single group. w_stride is the size, in bytes, of packed weights for one output channel, including the bias and
+// extra bytes. Packing runs on the calling thread if the thread pool is NULL or has a single thread.
+
+XNN_INTERNAL void xnn_parallelize_pack_gemm_goi_w(
+  xnn_pack_gemm_goi_w_function pack_gemm_goi_w,
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const void* k,
+  const void* b,
+  void* packed_w,
+  size_t extra_bytes,
+  const void* params,
+  uint32_t log2_filter_element_size,
+  size_t bias_element_size,
+  size_t w_stride,
+  pthreadpool_t threadpool);
+
+XNN_INTERNAL void xnn_parallelize_pack_conv_goki_w(
+  xnn_pack_conv_goki_w_function pack_conv_goki_w,
+  size_t g,
+  size_t nc,
+  size_t ks,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const void* k,
+  const void* b,
+  void* packed_w,
+  size_t extra_bytes,
+  const void* params,
+  uint32_t log2_filter_element_size,
+  size_t bias_element_size,
+  size_t w_stride,
+  pthreadpool_t threadpool);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -287,6 +287,47 @@ static inline union xnn_qs8_gemm_xw_params xnn_init_qs8_gemm_xw_params(
   return params.gemm_xw;
 }
 
+static inline union xnn_qc8_gemm_params xnn_init_scalar_qc8_gemm_params(
+  int8_t output_zero_point,
+  int8_t output_min,
+  int8_t output_max)
+{
+  union xnn_qc8_gemm_params params;
+  params.scalar.output_min_less_zero_point = (float) ((int32_t) output_min - (int32_t) output_zero_point);
+  params.scalar.output_max_less_zero_point = (float) ((int32_t) output_max - (int32_t) output_zero_point);
+  params.scalar.magic_bias = 12582912.0f;
+  params.scalar.magic_bias_less_output_zero_point = INT32_C(0x4B400000) - (int32_t) output_zero_point;
+  return params;
+}
+
+static inline union xnn_qc8_gemm_params xnn_init_qc8_gemm_params(
+  int8_t output_zero_point,
+  int8_t output_min,
+  int8_t output_max)
+{
+  union xnn_qc8_gemm_params params;
+  #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+    const float output_max_less_zero_point = (float) ((int32_t) output_max - (int32_t) output_zero_point);
+    for (uint32_t i = 0; i < 4; i++) {
+      params.sse2.output_max_less_zero_point[i] = output_max_less_zero_point;
+    }
+    for (uint32_t i = 0; i < 8; i++) {
+      params.sse2.output_zero_point[i] = (int16_t) output_zero_point;
+      params.sse2.output_min[i] = (int16_t) output_min;
+    }
+  #elif XNN_ARCH_ARM || XNN_ARCH_ARM64
+    // Adding 1.5 * 2**23 to a float value in [-2**22, 2**22] range puts the value rounded to the nearest integer into
+    // the low bits of the float representation.
+    params.neon.magic_bias = 12582912.0f;
+    params.neon.magic_bias_less_output_zero_point = INT32_C(0x4B400000) - (int32_t) output_zero_point;
+    params.neon.output_min = output_min;
+    params.neon.output_max = output_max;
+  #else
+    params = xnn_init_scalar_qc8_gemm_params(output_zero_point, output_min, output_max);
+  #endif
+  return params;
+}
+
 static inline union xnn_qu8_avgpool_params xnn_init_qu8_avgpool_params(
   int32_t bias,
   float scale,
@@ -1444,6 +1485,115 @@ static inline union xnn_qs8_add_params xnn_init_scalar_qs8_add_params(
   return params;
 }
 
+static inline union xnn_f32_qs8_cvt_params xnn_init_f32_qs8_cvt_params(
+  float scale,
+  int8_t output_zero_point,
+  int8_t output_min,
+  int8_t output_max)
+{
+  assert(scale >= 0x1.0p-32f);
+  assert(output_min < output_max);
+
+  const float output_min_less_zero_point = (float) ((int32_t) output_min - (int32_t) output_zero_point);
+  const float output_max_less_zero_point = (float) ((int32_t) output_max - (int32_t) output_zero_point);
+  union xnn_f32_qs8_cvt_params params;
+  #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+    for (uint32_t i = 0; i < 4; i++) {
+      params.sse2.scale[i] = scale;
+      params.sse2.output_min_less_zero_point[i] = output_min_less_zero_point;
+      params.sse2.output_max_less_zero_point[i] = output_max_less_zero_point;
+    }
+    for (uint32_t i = 0; i < 8; i++) {
+      params.sse2.output_zero_point[i] = (int16_t) output_zero_point;
+    }
+  #elif XNN_ARCH_ARM || XNN_ARCH_ARM64
+    params.neon.scale = scale;
+    params.neon.output_min_less_zero_point = output_min_less_zero_point;
+    params.neon.output_max_less_zero_point = output_max_less_zero_point;
+    params.neon.magic_bias = 12582912.0f;
+    params.neon.magic_bias_less_zero_point = INT32_C(0x4B400000) - (int32_t) output_zero_point;
+    params.neon.output_zero_point = (int16_t) output_zero_point;
+    params.neon.output_min = output_min;
+    params.neon.output_max = output_max;
+  #elif XNN_ARCH_WASMSIMD
+    params.wasmsimd.scale = scale;
+    params.wasmsimd.output_min_less_zero_point = output_min_less_zero_point;
+    params.wasmsimd.output_max_less_zero_point = output_max_less_zero_point;
+    params.wasmsimd.magic_bias = 12582912.0f;
+    params.wasmsimd.magic_bias_less_zero_point = INT32_C(0x4B400000) - (int32_t) output_zero_point;
+  #else
+    params.scalar.scale = scale;
+    params.scalar.output_min_less_zero_point = output_min_less_zero_point;
+    params.scalar.output_max_less_zero_point = output_max_less_zero_point;
+    params.scalar.magic_bias = 12582912.0f;
+    params.scalar.magic_bias_less_zero_point = INT32_C(0x4B400000) - (int32_t) output_zero_point;
+  #endif
+  return params;
+}
+
+static inline union xnn_f32_qs8_cvt_params xnn_init_scalar_f32_qs8_cvt_params(
+  float scale,
+  int8_t output_zero_point,
+  int8_t output_min,
+  int8_t output_max)
+{
+  assert(scale >= 0x1.0p-32f);
+  assert(output_min < output_max);
+
+  union xnn_f32_qs8_cvt_params params;
+  params.scalar.scale = scale;
+  params.scalar.output_min_less_zero_point = (float) ((int32_t) output_min - (int32_t) output_zero_point);
+  params.scalar.output_max_less_zero_point = (float) ((int32_t) output_max - (int32_t) output_zero_point);
+  params.scalar.magic_bias = 12582912.0f;
+  params.scalar.magic_bias_less_zero_point = INT32_C(0x4B400000) - (int32_t) output_zero_point;
+  return params;
+}
+
+static inline union xnn_qs8_f32_cvt_params xnn_init_qs8_f32_cvt_params(
+  float scale,
+  int8_t zero_point)
+{
+  union xnn_qs8_f32_cvt_params params;
+  #if XNN_ARCH_X86 || XNN_ARCH_X86_64
+    for (uint32_t i = 0; i < 16; i++) {
+      params.sse2.sign_mask[i] = INT8_C(-128);
+    }
+    for (uint32_t i = 0; i < 8; i++) {
+      params.sse2.magic_exp[i] = INT16_C(0x4B00);
+    }
+    const float magic_bias = (float) (INT32_C(0x00800080) + (int32_t) zero_point);
+    for (uint32_t i = 0; i < 4; i++) {
+      params.sse2.magic_bias[i] = magic_bias;
+      params.sse2.minus_zero_point[i] = -(int32_t) zero_point;
+      params.sse2.scale[i] = scale;
+    }
+  #elif XNN_ARCH_ARM || XNN_ARCH_ARM64
+    params.neon.minus_zero_point = -(int16_t) zero_point;
+    params.neon.scale = scale;
+  #elif XNN_ARCH_WASMSIMD
+    for (uint32_t i = 0; i < 8; i++) {
+      params.wasmsimd.minus_zero_point[i] = -(int16_t) zero_point;
+    }
+    for (uint32_t i = 0; i < 4; i++) {
+      params.wasmsimd.scale[i] = scale;
+    }
+  #else
+    params.scalar.zero_point = (int32_t) zero_point;
+    params.scalar.scale = scale;
+  #endif
+  return params;
+}
+
+static inline union xnn_qs8_f32_cvt_params xnn_init_scalar_qs8_f32_cvt_params(
+  float scale,
+  int8_t zero_point)
+{
+  union xnn_qs8_f32_cvt_params params;
+  params.scalar.zero_point = (int32_t) zero_point;
+  params.scalar.scale = scale;
+  return params;
+}
+
 static inline union xnn_qu8_requantization_params xnn_init_scalar_qu8_requantization_params(
   float scale,
   uint8_t zero_point,
@@ -367,6 +367,39 @@ union xnn_qs8_gemm_xw_params {
 #endif  // XNN_ARCH_WASMSIMD
 };
 
+// Parameters for QS8 micro-kernels with per-channel quantized weights (QC8). The per-channel requantization scales are
+// not part of the parameters: they are packed together with the weights, after the weights of each tile of channels.
+union xnn_qc8_gemm_params {
+  struct {
+    float output_min_less_zero_point;
+    float output_max_less_zero_point;
+    float magic_bias;
+    int32_t magic_bias_less_output_zero_point;
+  } scalar;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  struct {
+    float magic_bias;
+    int32_t magic_bias_less_output_zero_point;
+    int8_t output_min;
+    int8_t output_max;
+  } neon;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) float output_max_less_zero_point[4];
+    XNN_ALIGN(16) int16_t output_zero_point[8];
+    XNN_ALIGN(16) int16_t output_min[8];
+  } sse2;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+// Quantization parameters of a row of dynamically quantized (QD8) inputs. Each row of fp32 inputs is quantized to int8
+// at run time with its own scale and zero point, which the GEMM micro-kernels use to dequantize the accumulators.
+struct xnn_qd8_quantization_params {
+  int32_t zero_point;
+  float scale;
+};
+
 union xnn_qu8_add_params {
   struct {
     int32_t zero_point_product;
@@ -543,6 +576,73 @@ union xnn_qs8_avgpool_params {
 #endif  // XNN_ARCH_WASMSIMD
 };
 
+union xnn_f32_qs8_cvt_params {
+  struct {
+    float scale;
+    float output_min_less_zero_point;
+    float output_max_less_zero_point;
+    float magic_bias;
+    int32_t magic_bias_less_zero_point;
+  } scalar;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  struct {
+    float scale;
+    float output_min_less_zero_point;
+    float output_max_less_zero_point;
+    float magic_bias;
+    int32_t magic_bias_less_zero_point;
+    int16_t output_zero_point;
+    int8_t output_min;
+    int8_t output_max;
+  } neon;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) float scale[4];
+    XNN_ALIGN(16) float output_min_less_zero_point[4];
+    XNN_ALIGN(16) float output_max_less_zero_point[4];
+    XNN_ALIGN(16) int16_t output_zero_point[8];
+  } sse2;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+#if XNN_ARCH_WASMSIMD
+  struct {
+    float scale;
+    float output_min_less_zero_point;
+    float output_max_less_zero_point;
+    float magic_bias;
+    int32_t magic_bias_less_zero_point;
+  } wasmsimd;
+#endif  // XNN_ARCH_WASMSIMD
+};
+
+union xnn_qs8_f32_cvt_params {
+  struct {
+    int32_t zero_point;
+    float scale;
+  } scalar;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  struct {
+    int16_t minus_zero_point;
+    float scale;
+  } neon;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) int8_t sign_mask[16];
+    XNN_ALIGN(16) int16_t magic_exp[8];
+    XNN_ALIGN(16) float magic_bias[4];
+    XNN_ALIGN(16) int32_t minus_zero_point[4];
+    XNN_ALIGN(16) float scale[4];
+  } sse2;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+#if XNN_ARCH_WASMSIMD
+  struct {
+    XNN_ALIGN(16) int16_t minus_zero_point[8];
+    XNN_ALIGN(16) float scale[4];
+  } wasmsimd;
+#endif  // XNN_ARCH_WASMSIMD
+};
+
 union xnn_qu8_requantization_params {
   struct {
     int32_t multiplier;
@@ -648,6 +748,18 @@ typedef void (*xnn_f32_gemm_minmax_ukernel_function)(
     size_t cn_stride,
     const union xnn_f32_minmax_params* params);
 
+typedef void (*xnn_f32_gemm_hswish_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const float* a,
+    size_t a_stride,
+    const float* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_hswish_params* params);
+
 typedef void (*xnn_f32_gemminc_minmax_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -723,6 +835,31 @@ typedef void (*xnn_qs8_gemm_xw_ukernel_function)(
     size_t cn_stride,
     const union xnn_qs8_gemm_xw_params* params);
 
+typedef void (*xnn_qc8_gemm_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const int8_t* a,
+    size_t a_stride,
+    const void* w,
+    int8_t* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_qc8_gemm_params* params);
+
+typedef void (*xnn_qd8_f32_qc8w_gemm_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const int8_t* a,
+    size_t a_stride,
+    const void* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params* params,
+    const struct xnn_qd8_quantization_params* quantization_params);
+
 typedef void (*xnn_igemm_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -779,6 +916,20 @@ typedef void (*xnn_f32_igemm_minmax_ukernel_function)(
     const float* zero,
     const union xnn_f32_minmax_params* params);
 
+typedef void (*xnn_f32_igemm_hswish_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t kc,
+    size_t ks,
+    const float** a,
+    const float* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    size_t a_offset,
+    const float* zero,
+    const union xnn_f32_hswish_params* params);
+
 typedef void (*xnn_qu8_igemm_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -807,6 +958,20 @@ typedef void (*xnn_qs8_igemm_ukernel_function)(
     const int8_t* zero,
     const union xnn_qs8_gemm_params* params);
 
+typedef void (*xnn_qc8_igemm_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t kc,
+    size_t ks,
+    const int8_t** a,
+    const void* w,
+    int8_t* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    size_t a_offset,
+    const int8_t* zero,
+    const union xnn_qc8_gemm_params* params);
+
 typedef void (*xnn_conv_hwc_ukernel_function)(
     size_t input_height,
     size_t input_width,
@@ -1017,6 +1182,38 @@ typedef void (*xnn_x32_zipv_ukernel_function)(
     const uint32_t* x,
     uint32_t* y);
 
+typedef void (*xnn_transpose_ukernel_function)(
+    const void* input,
+    void* output,
+    size_t input_stride,
+    size_t output_stride,
+    size_t block_width,
+    size_t block_height);
+
+typedef void (*xnn_x8_transpose_ukernel_function)(
+    const uint8_t* input,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_stride,
+    size_t block_width,
+    size_t block_height);
+
+typedef void (*xnn_x16_transpose_ukernel_function)(
+    const uint16_t* input,
+    uint16_t* output,
+    size_t input_stride,
+    size_t output_stride,
+    size_t block_width,
+    size_t block_height);
+
+typedef void (*xnn_x32_transpose_ukernel_function)(
+    const uint32_t* input,
+    uint32_t* output,
+    size_t input_stride,
+    size_t output_stride,
+    size_t block_width,
+    size_t block_height);
+
 typedef void (*xnn_x8_lut_ukernel_function)(
     size_t n,
     const uint8_t* x,
@@ -1079,6 +1276,18 @@ typedef void (*xnn_f32_dwconv_minmax_unipass_ukernel_function)(
     const float* zero,
     const union xnn_f32_minmax_params* params);
 
+typedef void (*xnn_f32_dwconv_hswish_unipass_ukernel_function)(
+    size_t channels,
+    size_t output_width,
+    const float** input,
+    const float* weights,
+    float* output,
+    size_t input_stride,
+    size_t output_increment,
+    size_t input_offset,
+    const float* zero,
+    const union xnn_f32_hswish_params* params);
+
 typedef void (*xnn_f16_dwconv_minmax_unipass_ukernel_function)(
     size_t channels,
     size_t output_width,
@@ -1115,9 +1324,22 @@ typedef void (*xnn_qs8_dwconv_minmax_unipass_ukernel_function)(
     const int8_t* zero,
     const union xnn_qs8_gemm_params* params);
 
+typedef void (*xnn_qc8_dwconv_minmax_unipass_ukernel_function)(
+    size_t channels,
+    size_t output_width,
+    const int8_t** input,
+    const void* weights,
+    int8_t* output,
+    size_t input_stride,
+    size_t output_increment,
+    size_t input_offset,
+    const int8_t* zero,
+    const union xnn_qc8_gemm_params* params);
+
 typedef void (*xnn_dwconv_multipass_ukernel_function)(
     size_t channels,
     size_t output_width,
+    size_t kernel_size,
     const void** input,
     const void* weights,
     void* buffer,
@@ -1128,6 +1350,62 @@ typedef void (*xnn_dwconv_multipass_ukernel_function)(
     const void* zero,
     const void* params);
 
+typedef void (*xnn_f32_dwconv_multipass_ukernel_function)(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const float** input,
+    const float* weights,
+    float* buffer,
+    float* output,
+    size_t input_stride,
+    size_t output_increment,
+    size_t input_offset,
+    const float* zero,
+    const union xnn_f32_default_params* params);
+
+typedef void (*xnn_f32_dwconv_minmax_multipass_ukernel_function)(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const float** input,
+    const float* weights,
+    float* buffer,
+    float* output,
+    size_t input_stride,
+    size_t output_increment,
+    size_t input_offset,
+    const float* zero,
+    const union xnn_f32_minmax_params* params);
+
+typedef void (*xnn_f16_dwconv_minmax_multipass_ukernel_function)(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const void** input,
+    const void* weights,
+    void* buffer,
+    void* output,
+    size_t input_stride,
+    size_t output_increment,
+    size_t input_offset,
+    const void* zero,
+    const struct xnn_f16_minmax_params* params);
+
+typedef void (*xnn_qs8_dwconv_minmax_multipass_ukernel_function)(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const int8_t** input,
+    const void* weights,
+    int32_t* buffer,
+    int8_t* output,
+    size_t input_stride,
+    size_t output_increment,
+    size_t input_offset,
+    const int8_t* zero,
+    const union xnn_qs8_gemm_params* params);
+
 typedef void (*xnn_f32_ibilinear_ukernel_function)(
     size_t output_pixels,
     size_t channels,
@@ -1541,11 +1819,46 @@ typedef void (*xnn_u8_rmax_ukernel_function)(
     const uint8_t* x,
     uint8_t* y);
 
+typedef void (*xnn_s8_rmax_ukernel_function)(
+    size_t n,
+    const int8_t* x,
+    int8_t* y);
+
 typedef void (*xnn_f32_rmax_ukernel_function)(
     size_t n,
     const float* x,
     float* y);
 
+typedef void (*xnn_f16_f32_vcvt_ukernel_function)(
+    size_t n,
+    const void* input,
+    float* output,
+    const void* params);
+
+typedef void (*xnn_f32_f16_vcvt_ukernel_function)(
+    size_t n,
+    const float* input,
+    void* output,
+    const void* params);
+
+typedef void (*xnn_f32_qd8_vcvt_ukernel_function)(
+    size_t n,
+    const float* x,
+    int8_t* y,
+    struct xnn_qd8_quantization_params* quantization_params);
+
+typedef void (*xnn_f32_qs8_vcvt_ukernel_function)(
+    size_t n,
+    const float* input,
+    int8_t* output,
+    const union xnn_f32_qs8_cvt_params* params);
+
+typedef void (*xnn_qs8_f32_vcvt_ukernel_function)(
+    size_t n,
+    const int8_t* input,
+    float* output,
+    const union xnn_qs8_f32_cvt_params* params);
+
 typedef void (*xnn_u8_lut32norm_ukernel_function)(
     size_t n,
     const uint8_t* x,
@@ -1798,6 +2111,41 @@ struct gemm_parameters {
   struct gemm_fused_ukernels minmax;
   struct gemm_fused_ukernels relu;
   struct gemm_fused_ukernels linear;
+  // Optional micro-kernels with a fused HardSwish activation. Only used for F32, where NULL micro-kernel pointers
+  // mean that HardSwish must be applied in a separate pass over the output.
+  struct gemm_fused_ukernels hswish;
+  uint8_t mr;
+  uint8_t nr;
+  uint8_t log2_kr;
+  uint8_t log2_sr;
+};
+
+// Pre-packed-A GEMM (PPMM): rows of A are first packed with the PACKX micro-kernel into MR-interleaved panels, which
+// are then multiplied by the packed weights in the same layout as GEMM micro-kernels with the same NR and KR = SR = 1.
+struct ppmm_parameters {
+  xnn_f32_ppmm_minmax_ukernel_function ukernel;
+  xnn_x32_packx_ukernel_function packx;
+  // Number of rows of A in a packed panel. Must match the number of rows packed by the PACKX micro-kernel.
+  uint8_t mr;
+  // Number of output channels in a tile of packed weights.
+  uint8_t nr;
+};
+
+// GEMM with accumulation (GEMMINC): micro-kernels initialize accumulators from MR x NR tiles of partial sums rather
+// than from the bias. Packed weights must have the same layout as for GEMM micro-kernels with the same NR and
+// KR = SR = 1, but without the bias.
+struct gemminc_parameters {
+  xnn_f32_gemminc_minmax_ukernel_function ukernel;
+  uint8_t mr;
+  uint8_t nr;
+};
+
+// GEMM with dynamically quantized inputs (QD8): rows of fp32 inputs are quantized with their own scale and zero point,
+// and micro-kernels dequantize the products with per-channel quantized weights to fp32 outputs.
+struct qd8_gemm_parameters {
+  xnn_qd8_f32_qc8w_gemm_ukernel_function minmax;
+  // Optional micro-kernel with MR=1 and the same NR and KR parameters.
+  xnn_qd8_f32_qc8w_gemm_ukernel_function minmax1;
   uint8_t mr;
   uint8_t nr;
   uint8_t log2_kr;
@@ -1864,6 +2212,8 @@ union dwconv_fused_ukernels {
 struct dwconv_parameters {
   union dwconv_fused_ukernels minmax;
   union dwconv_fused_ukernels linear;
+  // Optional micro-kernel with a fused HardSwish activation. Only used for F32.
+  union dwconv_fused_ukernels hswish;
   uint8_t channel_tile;
   uint8_t primary_tile;
   uint8_t incremental_tile;
@@ -1941,6 +2291,13 @@ struct zip_parameters {
   xnn_zipv_ukernel_function xm;
 };
 
+struct transpose_parameters {
+  xnn_transpose_ukernel_function ukernel;
+  // Number of rows and columns in a block of elements transposed in registers.
+  // For best efficiency, micro-kernel must process a multiple of this number of rows and columns in each call.
+  uint8_t tile_size;
+};
+
 struct prelu_parameters {
   xnn_prelu_ukernel_function ukernel;
   uint16_t row_tile;
@@ -1967,10 +2324,11 @@ struct vmulcaddc_parameters {
   uint8_t row_tile;
 };
 
-#define XNN_MAX_QS8_DWCONV_UKERNELS 1
+#define XNN_MAX_QC8_DWCONV_UKERNELS 2
+#define XNN_MAX_QS8_DWCONV_UKERNELS 2
 #define XNN_MAX_QU8_DWCONV_UKERNELS 1
-#define XNN_MAX_F16_DWCONV_UKERNELS 3
-#define XNN_MAX_F32_DWCONV_UKERNELS 3
+#define XNN_MAX_F16_DWCONV_UKERNELS 4
+#define XNN_MAX_F32_DWCONV_UKERNELS 4
 #define XNN_MAX_F32_ARGMAXPOOL_UKERNELS 3
 
 // Indicates that XNNPACK as a whole has initialized.
@@ -1996,6 +2354,15 @@ struct vmulcaddc_parameters {
 #define XNN_INIT_FLAG_XX      0x00000200
 // Indicates that CHW XNNPACK microkernels are optimized for the host platform.
 #define XNN_INIT_FLAG_CHW_OPT 0x00000400
+// Indicates that QC8 XNNPACK microkernels are available for use.
+#define XNN_INIT_FLAG_QC8     0x00000800
+// Indicates that VCVT XNNPACK microkernels are available for use.
+#define XNN_INIT_FLAG_VCVT    0x00001000
+// Indicates that S8 XNNPACK microkernels are available for use.
+#define XNN_INIT_FLAG_S8      0x00002000
+// Indicates that QD8 XNNPACK microkernels are optimized for the host platform, rather than scalar fallbacks which are
+// slower than F32 microkernels.
+#define XNN_INIT_FLAG_QD8_OPT 0x00004000
 
 struct xnn_parameters {
   // Bitwise combination of XNN_INIT_FLAG_* flags
@@ -2004,6 +2371,15 @@ struct xnn_parameters {
   struct {
     xnn_univector_ukernel_function copy;
   } xx;
+  struct {
+    struct gemm_parameters gemm;
+    struct dwconv_parameters dwconv[XNN_MAX_QC8_DWCONV_UKERNELS];
+  } qc8;
+  // Dynamically quantized inputs (QD8) with per-channel quantized weights (QC8W) and fp32 outputs.
+  struct {
+    struct qd8_gemm_parameters gemm;
+    xnn_f32_qd8_vcvt_ukernel_function vcvt;
+  } qd8_f32_qc8w;
   struct {
     struct gemm_parameters gemm;
     struct dwconv_parameters dwconv[XNN_MAX_QS8_DWCONV_UKERNELS];
@@ -2017,6 +2393,9 @@ struct xnn_parameters {
     struct gavgpool_parameters gavgpool;
     xnn_vadd_ukernel_function vadd;
   } qu8;
+  struct {
+    xnn_s8_rmax_ukernel_function rmax;
+  } s8;
   struct {
     struct maxpool_parameters maxpool;
     xnn_univector_ukernel_function clamp;
@@ -2025,8 +2404,12 @@ struct xnn_parameters {
   } u8;
   struct {
     xnn_x8_lut_ukernel_function lut;
+    struct transpose_parameters transpose;
     struct zip_parameters zip;
   } x8;
+  struct {
+    struct transpose_parameters transpose;
+  } x16;
   struct {
     struct gavgpool_parameters gavgpool;
     struct gemm_parameters gemm;
@@ -2040,6 +2423,10 @@ struct xnn_parameters {
   struct {
     struct gemm_parameters gemm;
     struct gemm_parameters gemm2;
+    // Optional PPMM micro-kernels for GEMMs with many rows. NULL micro-kernel pointer means PPMM is not supported.
+    struct ppmm_parameters ppmm;
+    // Optional GEMMINC micro-kernel for GEMMs with large K. NULL micro-kernel pointer means K can't be split in blocks.
+    struct gemminc_parameters gemminc;
     struct dwconv_parameters dwconv[XNN_MAX_F32_DWCONV_UKERNELS];
     struct avgpool_parameters avgpool;
     struct pavgpool_parameters pavgpool;
@@ -2098,10 +2485,18 @@ struct xnn_parameters {
     struct pad_parameters pad;
     struct fill_parameters fill;
     xnn_unpool_ukernel_function unpool;
+    struct transpose_parameters transpose;
     struct zip_parameters zip;
     // Depth To Space 2D with CHW->HWC layout conversion.
     struct depthtospace2d_chw2hwc_parameters depthtospace2d_chw2hwc;
   } x32;
+  // Conversions between data types.
+  struct {
+    xnn_univector_ukernel_function f16_to_f32;
+    xnn_univector_ukernel_function f32_to_f16;
+    xnn_univector_ukernel_function f32_to_qs8;
+    xnn_univector_ukernel_function qs8_to_f32;
+  } vcvt;
 };
 
 #ifdef __cplusplus
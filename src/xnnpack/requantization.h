@@ -159,6 +159,31 @@ inline static int8_t xnn_qs8_requantize_precise(
   return biased_value;
 }
 
+// Requantization in single-precision floating-point, with rounding to nearest-even. Used with per-channel scales.
+inline static int8_t xnn_qs8_requantize_fp32(
+  int32_t value,
+  float scale,
+  int8_t zero_point,
+  int8_t qmin,
+  int8_t qmax)
+{
+  assert(scale < 256.0f);
+  assert(scale >= 0x1.0p-32f);
+
+  float scaled_value = (float) value * scale;
+
+  const float fmin = (float) ((int32_t) qmin - (int32_t) zero_point);
+  if (scaled_value < fmin) {
+    scaled_value = fmin;
+  }
+  const float fmax = (float) ((int32_t) qmax - (int32_t) zero_point);
+  if (scaled_value > fmax) {
+    scaled_value = fmax;
+  }
+
+  return (int8_t) ((int32_t) lrintf(scaled_value) + (int32_t) zero_point);
+}
+
 static inline uint8_t xnn_qu8_quantize_avgpool(
   int32_t n,
   union xnn_qu8_avgpool_params params)
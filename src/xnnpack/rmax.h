@@ -44,6 +44,17 @@ DECLARE_U8_RMAX_UKERNEL_FUNCTION(xnn_u8_rmax_ukernel__sse2)
 DECLARE_U8_RMAX_UKERNEL_FUNCTION(xnn_u8_rmax_ukernel__scalar)
 
 
+#define DECLARE_S8_RMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                      \
+      size_t n,                                   \
+      const int8_t* x,                            \
+      int8_t* y);
+
+DECLARE_S8_RMAX_UKERNEL_FUNCTION(xnn_s8_rmax_ukernel__neon)
+DECLARE_S8_RMAX_UKERNEL_FUNCTION(xnn_s8_rmax_ukernel__sse2)
+DECLARE_S8_RMAX_UKERNEL_FUNCTION(xnn_s8_rmax_ukernel__scalar)
+
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -5,13 +5,14 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
 #include <xnnpack.h>
 
-#define XNN_MAX_INPUTS 3
-#define XNN_MAX_OUTPUTS 2
+#define XNN_MAX_INPUTS 4
+#define XNN_MAX_OUTPUTS 4
 
 #define XNN_MAX_RUNTIME_INPUTS 2
 #define XNN_MAX_RUNTIME_OUTPUTS 2
@@ -82,6 +83,18 @@ struct xnn_blob {
   /// Data pointer.
   void* data;
   bool external;
+  /// Whether the Value is purely internal to the runtime and allocated in its workspace.
+  bool in_workspace;
+  /// Offset of the Value data from the beginning of the workspace memory. Valid only if in_workspace is true.
+  size_t workspace_offset;
+  /// Number of elements between consecutive pixels of the Value, i.e. the stride of its innermost dimension.
+  size_t channel_stride;
+  /// ID of the Value whose memory holds this Value as a slice of its channels, or XNN_INVALID_VALUE_ID if the Value
+  /// has its own memory. Inputs of Concatenate Nodes and outputs of Split Nodes are such views.
+  uint32_t view_of;
+  /// Offset in bytes of the first channel of the view from the data of the Value it views. Valid only if view_of is
+  /// not XNN_INVALID_VALUE_ID.
+  size_t view_offset;
 };
 
 enum xnn_node_type {
@@ -91,9 +104,13 @@ enum xnn_node_type {
   xnn_node_type_argmax_pooling_2d,
   xnn_node_type_average_pooling_2d,
   xnn_node_type_bankers_rounding,
+  xnn_node_type_batch_matrix_multiply,
   xnn_node_type_ceiling,
   xnn_node_type_clamp,
+  xnn_node_type_concatenate,
+  xnn_node_type_convert,
   xnn_node_type_convolution_2d,
+  xnn_node_type_copy,
   xnn_node_type_deconvolution_2d,
   xnn_node_type_depthwise_convolution_2d,
   xnn_node_type_depth_to_space,
@@ -112,9 +129,11 @@ enum xnn_node_type {
   xnn_node_type_prelu,
   xnn_node_type_sigmoid,
   xnn_node_type_softmax,
+  xnn_node_type_split,
   xnn_node_type_static_constant_pad,
   xnn_node_type_static_reshape,
   xnn_node_type_static_resize_bilinear_2d,
+  xnn_node_type_static_transpose,
   xnn_node_type_square,
   xnn_node_type_square_root,
   xnn_node_type_squared_difference,
@@ -125,6 +144,9 @@ enum xnn_node_type {
 struct xnn_node {
   enum xnn_node_type type;
   uint32_t id;
+  /// ID of the Node when it was defined in the subgraph, before subgraph optimization inserted other Nodes. Nodes
+  /// inserted by subgraph optimization take the original ID of the Node they were inserted for.
+  uint32_t original_id;
   /// Static parameters of the operator node.
   union {
     struct {
@@ -194,6 +216,10 @@ struct xnn_node {
     struct {
       float negative_slope;
     } leaky_relu;
+    struct {
+      // Number of channels in each output, kept for the outputs which are removed as unused.
+      size_t channels[XNN_MAX_OUTPUTS];
+    } split;
     struct {
       size_t pre_paddings[XNN_MAX_TENSOR_DIMS];
       size_t post_paddings[XNN_MAX_TENSOR_DIMS];
@@ -206,6 +232,10 @@ struct xnn_node {
       size_t new_height;
       size_t new_width;
     } static_resize;
+    struct {
+      size_t perm[XNN_MAX_TENSOR_DIMS];
+      size_t num_dims;
+    } static_transpose;
   } params;
   struct {
     float output_min;
@@ -239,10 +269,16 @@ struct xnn_operator_data {
   struct xnn_shape shape2;
   size_t pre_paddings[XNN_MAX_TENSOR_DIMS];
   size_t post_paddings[XNN_MAX_TENSOR_DIMS];
+  size_t perm[XNN_MAX_TENSOR_DIMS];
   uint32_t adjustment_height;
   uint32_t adjustment_width;
   uint32_t inputs[XNN_MAX_RUNTIME_INPUTS];
   uint32_t outputs[XNN_MAX_RUNTIME_OUTPUTS];
+  // Number of runs, and the last and the cumulative wall time of the runs of the operator, if the runtime profiles
+  // operators.
+  uint64_t num_runs;
+  uint64_t last_time_ns;
+  uint64_t total_time_ns;
 };
 
 struct xnn_subgraph {
@@ -257,8 +293,29 @@ struct xnn_subgraph {
   uint32_t num_reserved_nodes;
   uint32_t num_nodes;
   struct xnn_node* nodes;
+
+  /// Static data allocated in subgraph optimization, e.g. filters and biases with folded per-channel scale and shift.
+  /// Released together with the subgraph: clones of the subgraph refer to the same data, but don't own it.
+  uint32_t num_static_data;
+  void** static_data;
 };
 
+/// Workspace is a memory arena for the internal Values of one or more runtimes.
+struct xnn_workspace {
+  /// Workspace memory, shared by all runtimes which use this workspace.
+  void* data;
+  /// Size of the workspace memory in bytes.
+  size_t size;
+  /// Number of references to the workspace: one from its creator, plus one from each runtime using it. Not atomic:
+  /// runtimes sharing a workspace are created and deleted on one thread.
+  uint32_t ref_count;
+};
+
+/// Operators on an execution level run concurrently, each on a single thread, only if their output is at most
+/// XNN_MAX_CONCURRENT_OPERATOR_OUTPUT_SIZE bytes. Larger operators have enough work to keep all threads of the thread
+/// pool busy, and run one after another with the whole thread pool.
+#define XNN_MAX_CONCURRENT_OPERATOR_OUTPUT_SIZE 65536
+
 /// Runtime is a combination of an execution plan for subgraph Nodes and a memory manager for subgraph Values.
 struct xnn_runtime {
   uint32_t num_external_values;
@@ -267,13 +324,34 @@ struct xnn_runtime {
   struct xnn_operator_data* opdata;
   /// Number of operators in the execution plan.
   size_t num_ops;
+  /// Execution level of each operator, or NULL if operators run sequentially in execution order. Operators on the same
+  /// level don't depend on each other, and may run concurrently.
+  uint32_t* op_levels;
+  /// Indices of the operators, sorted by execution level.
+  uint32_t* level_ops;
+  /// Start of each execution level in level_ops, followed by the number of operators in level_ops.
+  uint32_t* level_offsets;
+  /// Status of the last run of each operator in level_ops, when the operators of a level run concurrently.
+  enum xnn_status* level_status;
+  /// Number of execution levels.
+  uint32_t num_levels;
 
   struct xnn_blob* blobs;
   size_t num_blobs;
 
-  void* workspace;
+  /// Private copy of the Values and Nodes of the subgraph, with the current shapes of the Values.
+  struct xnn_subgraph* subgraph;
+
+  struct xnn_workspace* workspace;
+  /// Workspace memory which the internal Values were bound to in the last successful setup. Runtime can't be invoked
+  /// if the workspace memory was reallocated since then.
+  void* workspace_data;
+  /// Whether the runtime was successfully set up since its creation or the last reshape.
+  bool has_been_setup;
 
   pthreadpool_t threadpool;
+  /// Whether the runtime records the wall time of each operator run.
+  bool profiling;
 };
 
 struct xnn_value* xnn_subgraph_new_internal_value(xnn_subgraph_t subgraph);
@@ -286,8 +364,14 @@ size_t xnn_tensor_get_size(
 
 enum xnn_status xnn_subgraph_optimize(xnn_subgraph_t subgraph, uint32_t flags);
 
+/// Create a copy of the Values and Nodes of a subgraph. The copy refers to the same static data as the original.
+enum xnn_status xnn_subgraph_clone(xnn_subgraph_t subgraph, xnn_subgraph_t* subgraph_out);
+
 void xnn_subgraph_rewrite_for_nchw(xnn_subgraph_t subgraph);
 
+/// Run eligible F32 Nodes in half precision, and insert Convert Nodes on the boundaries between F16 and F32 Values.
+enum xnn_status xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph);
+
 void xnn_node_clear(struct xnn_node* node);
 void xnn_value_clear(struct xnn_value* value);
 
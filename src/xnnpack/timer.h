@@ -0,0 +1,21 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <xnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Read a monotonic clock in nanoseconds. Only differences between two readings are meaningful.
+XNN_INTERNAL uint64_t xnn_read_timer_ns(void);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -0,0 +1,237 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <pthread.h>
+#endif
+
+#include <xnnpack.h>
+#include <xnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 128-bit digest which identifies packed weights in the weights cache. Keyed entries are matched by the digest alone,
+// so it must be wide enough to make accidental collisions between different weights negligible.
+struct xnn_weights_cache_key {
+  uint64_t hash[2];
+};
+
+struct xnn_weights_cache_entry {
+  // Key of the raw weights and packing configuration.
+  struct xnn_weights_cache_key key;
+  // Size of the packed weights in bytes.
+  size_t size;
+  // Packed weights, shared by all operators which reference this entry.
+  void* packed_weights;
+  // Number of operators which use the packed weights.
+  uint32_t ref_count;
+  // Whether the packed weights live in the memory-mapped weights cache file. Such entries are not released when
+  // unused, and the memory is unmapped together with the cache.
+  bool mapped;
+};
+
+// Weights cache deduplicates packed weights of operators by the key of their raw weights and packing configuration.
+struct xnn_weights_cache {
+#ifdef _WIN32
+  SRWLOCK lock;
+#else
+  pthread_mutex_t mutex;
+#endif
+  struct xnn_weights_cache_entry* entries;
+  size_t num_entries;
+  size_t num_reserved_entries;
+  // Number of references to the cache: one from its creator, plus one from each operator using its packed weights.
+  uint32_t ref_count;
+  // Read-only mapping of the weights cache file, if the cache was loaded from a file.
+  void* mapping;
+  size_t mapping_size;
+  // Device and file index of the weights cache file, which must not be overwritten while it is mapped.
+  uint64_t file_device;
+  uint64_t file_index;
+};
+
+// Compute the key of the packed weights from the packing configuration (micro-kernel tiles, weights shapes, zero
+// points, etc), the packing parameters, and the raw weights.
+XNN_INTERNAL struct xnn_weights_cache_key xnn_weights_cache_compute_key(
+  const void* config,
+  size_t config_size,
+  const void* packing_params,
+  size_t packing_params_size,
+  const void* kernel,
+  size_t kernel_size,
+  const void* bias,
+  size_t bias_size);
+
+// Mix additional data which ends up in the packed weights (e.g. per-channel scales) into the key.
+XNN_INTERNAL void xnn_weights_cache_update_key(
+  struct xnn_weights_cache_key* key,
+  const void* data,
+  size_t size);
+
+// Look up packed weights of op->packed_weights_size bytes by key, and make the operator use them. Returns false if the
+// cache is NULL or has no such packed weights, in which case the operator must pack its weights.
+XNN_INTERNAL bool xnn_weights_cache_lookup_packed_weights(
+  struct xnn_weights_cache* cache,
+  const struct xnn_weights_cache_key* key,
+  xnn_operator_t op);
+
+// Add the packed weights of the operator to the cache under the key, unless the operator already uses packed weights
+// from the cache. If identical packed weights were added concurrently under the same key, the operator switches to
+// them and releases its own. Does nothing if the cache is NULL.
+XNN_INTERNAL enum xnn_status xnn_weights_cache_insert_packed_weights(
+  struct xnn_weights_cache* cache,
+  const struct xnn_weights_cache_key* key,
+  xnn_operator_t op);
+
+// Release the reference of an operator to the packed weights in the cache, and to the cache itself.
+XNN_INTERNAL void xnn_weights_cache_release_packed_weights(
+  struct xnn_weights_cache* cache,
+  void* packed_weights);
+
+// Variants of the operator creation functions which look up the packed weights in the weights cache, and add the packed
+// weights to the weights cache if they are not found. The weights cache may be NULL. Convolution and Fully Connected
+// operators also take a thread pool to pack the weights in parallel; the thread pool may be NULL.
+
+XNN_INTERNAL enum xnn_status xnn_create_convolution2d_nhwc_qs8_with_weights_cache(
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t kernel_height,
+  uint32_t kernel_width,
+  uint32_t subsampling_height,
+  uint32_t subsampling_width,
+  uint32_t dilation_height,
+  uint32_t dilation_width,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  float kernel_scale,
+  const int8_t* kernel,
+  const int32_t* bias,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_weights_cache_t weights_cache,
+  pthreadpool_t threadpool,
+  xnn_operator_t* convolution_op_out);
+
+XNN_INTERNAL enum xnn_status xnn_create_convolution2d_nhwc_f32_with_weights_cache(
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t kernel_height,
+  uint32_t kernel_width,
+  uint32_t subsampling_height,
+  uint32_t subsampling_width,
+  uint32_t dilation_height,
+  uint32_t dilation_width,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  const float* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_weights_cache_t weights_cache,
+  pthreadpool_t threadpool,
+  xnn_operator_t* convolution_op_out);
+
+XNN_INTERNAL enum xnn_status xnn_create_deconvolution2d_nhwc_f32_with_weights_cache(
+  uint32_t output_padding_top,
+  uint32_t output_padding_right,
+  uint32_t output_padding_bottom,
+  uint32_t output_padding_left,
+  uint32_t kernel_height,
+  uint32_t kernel_width,
+  uint32_t stride_height,
+  uint32_t stride_width,
+  uint32_t dilation_height,
+  uint32_t dilation_width,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  const float* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_weights_cache_t weights_cache,
+  xnn_operator_t* deconvolution_op_out);
+
+XNN_INTERNAL enum xnn_status xnn_create_fully_connected_nc_qs8_with_weights_cache(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  float kernel_scale,
+  const int8_t* kernel,
+  const int32_t* bias,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_weights_cache_t weights_cache,
+  pthreadpool_t threadpool,
+  xnn_operator_t* fully_connected_op_out);
+
+XNN_INTERNAL enum xnn_status xnn_create_fully_connected_nc_f32_with_weights_cache(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  const float* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_weights_cache_t weights_cache,
+  pthreadpool_t threadpool,
+  xnn_operator_t* fully_connected_op_out);
+
+// Quantizes fp32 weights to signed 8-bit values with a symmetric per-channel scale, unless the packed weights are found
+// in the weights cache, and quantizes rows of fp32 inputs when the operator runs.
+XNN_INTERNAL enum xnn_status xnn_create_fully_connected_nc_qd8_f32_qc8w_from_f32_with_weights_cache(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  const float* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_weights_cache_t weights_cache,
+  pthreadpool_t threadpool,
+  xnn_operator_t* fully_connected_op_out);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -0,0 +1,141 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "batch-matrix-multiply-operator-tester.h"
+
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, unit_batch) {
+  BatchMatrixMultiplyOperatorTester()
+    .batch_size(1)
+    .m(13)
+    .k(23)
+    .n(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, unit_batch_transpose_b) {
+  BatchMatrixMultiplyOperatorTester()
+    .batch_size(1)
+    .m(13)
+    .k(23)
+    .n(19)
+    .transpose_b(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, small_batch) {
+  BatchMatrixMultiplyOperatorTester()
+    .batch_size(3)
+    .m(13)
+    .k(23)
+    .n(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, small_batch_transpose_b) {
+  BatchMatrixMultiplyOperatorTester()
+    .batch_size(3)
+    .m(13)
+    .k(23)
+    .n(19)
+    .transpose_b(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, unit_m) {
+  for (size_t n = 1; n <= 33; n += 4) {
+    BatchMatrixMultiplyOperatorTester()
+      .batch_size(4)
+      .m(1)
+      .k(17)
+      .n(n)
+      .TestF32();
+  }
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, unit_m_transpose_b) {
+  for (size_t n = 1; n <= 33; n += 4) {
+    BatchMatrixMultiplyOperatorTester()
+      .batch_size(4)
+      .m(1)
+      .k(17)
+      .n(n)
+      .transpose_b(true)
+      .TestF32();
+  }
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, varying_k) {
+  for (size_t k = 1; k <= 32; k++) {
+    BatchMatrixMultiplyOperatorTester()
+      .batch_size(2)
+      .m(7)
+      .k(k)
+      .n(11)
+      .TestF32();
+  }
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, varying_k_transpose_b) {
+  for (size_t k = 1; k <= 32; k++) {
+    BatchMatrixMultiplyOperatorTester()
+      .batch_size(2)
+      .m(7)
+      .k(k)
+      .n(11)
+      .transpose_b(true)
+      .TestF32();
+  }
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, varying_m_and_n) {
+  for (size_t m = 1; m <= 9; m++) {
+    for (size_t n = 1; n <= 17; n += 2) {
+      BatchMatrixMultiplyOperatorTester()
+        .batch_size(2)
+        .m(m)
+        .k(13)
+        .n(n)
+        .TestF32();
+    }
+  }
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, varying_m_and_n_transpose_b) {
+  for (size_t m = 1; m <= 9; m++) {
+    for (size_t n = 1; n <= 17; n += 2) {
+      BatchMatrixMultiplyOperatorTester()
+        .batch_size(2)
+        .m(m)
+        .k(13)
+        .n(n)
+        .transpose_b(true)
+        .TestF32();
+    }
+  }
+}
+
+TEST(BATCH_MATRIX_MULTIPLY_NC_F32, attention_shapes) {
+  // Query x Key^T and scores x Value products of a small multi-head attention block.
+  BatchMatrixMultiplyOperatorTester()
+    .batch_size(8)
+    .m(49)
+    .k(64)
+    .n(49)
+    .transpose_b(true)
+    .TestF32();
+  BatchMatrixMultiplyOperatorTester()
+    .batch_size(8)
+    .m(49)
+    .k(49)
+    .n(64)
+    .TestF32();
+}
@@ -0,0 +1,155 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class BatchMatrixMultiplyOperatorTester {
+ public:
+  inline BatchMatrixMultiplyOperatorTester& batch_size(size_t batch_size) {
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline BatchMatrixMultiplyOperatorTester& m(size_t m) {
+    assert(m >= 1);
+    this->m_ = m;
+    return *this;
+  }
+
+  inline size_t m() const {
+    return this->m_;
+  }
+
+  inline BatchMatrixMultiplyOperatorTester& k(size_t k) {
+    assert(k >= 1);
+    this->k_ = k;
+    return *this;
+  }
+
+  inline size_t k() const {
+    return this->k_;
+  }
+
+  inline BatchMatrixMultiplyOperatorTester& n(size_t n) {
+    assert(n >= 1);
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline BatchMatrixMultiplyOperatorTester& transpose_b(bool transpose_b) {
+    this->transpose_b_ = transpose_b;
+    return *this;
+  }
+
+  inline bool transpose_b() const {
+    return this->transpose_b_;
+  }
+
+  inline BatchMatrixMultiplyOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+
+    std::vector<float> input_a(XNN_EXTRA_BYTES / sizeof(float) + batch_size() * m() * k());
+    std::vector<float> input_b(batch_size() * k() * n());
+    std::vector<float> output(batch_size() * m() * n());
+    std::vector<double> output_ref(batch_size() * m() * n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input_a.begin(), input_a.end(), std::ref(f32rng));
+      std::generate(input_b.begin(), input_b.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      // Compute reference results.
+      std::fill(output_ref.begin(), output_ref.end(), 0.0);
+      for (size_t b = 0; b < batch_size(); b++) {
+        for (size_t i = 0; i < m(); i++) {
+          for (size_t j = 0; j < n(); j++) {
+            for (size_t l = 0; l < k(); l++) {
+              const size_t b_index = transpose_b() ? (b * n() + j) * k() + l : (b * k() + l) * n() + j;
+              output_ref[(b * m() + i) * n() + j] +=
+                double(input_a[(b * m() + i) * k() + l]) * double(input_b[b_index]);
+            }
+          }
+        }
+      }
+
+      // Create, setup, run, and destroy Batch Matrix Multiply operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t batch_matrix_multiply_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_batch_matrix_multiply_nc_f32(
+          transpose_b() ? XNN_FLAG_TRANSPOSE_B : 0,
+          &batch_matrix_multiply_op));
+      ASSERT_NE(nullptr, batch_matrix_multiply_op);
+
+      // Smart pointer to automatically delete batch_matrix_multiply_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_batch_matrix_multiply_op(
+        batch_matrix_multiply_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_batch_matrix_multiply_nc_f32(
+          batch_matrix_multiply_op,
+          batch_size(), m(), k(), n(),
+          input_a.data(), input_b.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(batch_matrix_multiply_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t b = 0; b < batch_size(); b++) {
+        for (size_t i = 0; i < m(); i++) {
+          for (size_t j = 0; j < n(); j++) {
+            const size_t index = (b * m() + i) * n() + j;
+            ASSERT_NEAR(output[index], output_ref[index], 1.0e-5 * std::max(1.0, std::abs(output_ref[index])))
+              << "batch index = " << b << ", row = " << i << ", column = " << j
+              << ", M = " << m() << ", K = " << k() << ", N = " << n();
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  size_t batch_size_{1};
+  size_t m_{1};
+  size_t k_{1};
+  size_t n_{1};
+  bool transpose_b_{false};
+  size_t iterations_{1};
+};
@@ -0,0 +1,424 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include <gtest/gtest.h>
+
+static std::vector<float> random_data(size_t size)
+{
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  std::vector<float> data(size);
+  std::generate(data.begin(), data.end(), std::ref(f32rng));
+  return data;
+}
+
+static uint32_t define_tensor(xnn_subgraph_t subgraph, const std::vector<size_t>& dims, const float* data,
+  uint32_t external_id = XNN_INVALID_VALUE_ID, uint32_t flags = 0)
+{
+  uint32_t id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success,
+    xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(), data, external_id, flags, &id));
+  return id;
+}
+
+static void define_fully_connected(xnn_subgraph_t subgraph, uint32_t input_id, uint32_t output_id,
+  const std::vector<float>& filter, const std::vector<float>& bias)
+{
+  const size_t output_channels = bias.size();
+  const size_t input_channels = filter.size() / output_channels;
+  const uint32_t filter_id = define_tensor(subgraph, {output_channels, input_channels}, filter.data());
+  const uint32_t bias_id = define_tensor(subgraph, {output_channels}, bias.data());
+  EXPECT_EQ(xnn_status_success,
+    xnn_define_fully_connected(subgraph, -INFINITY, INFINITY, input_id, filter_id, bias_id, output_id, 0 /* flags */));
+}
+
+static void define_convolution_1x1(xnn_subgraph_t subgraph, uint32_t input_id, uint32_t output_id,
+  const std::vector<float>& filter, const std::vector<float>& bias)
+{
+  const size_t output_channels = bias.size();
+  const size_t input_channels = filter.size() / output_channels;
+  const uint32_t filter_id = define_tensor(subgraph, {output_channels, 1, 1, input_channels}, filter.data());
+  const uint32_t bias_id = define_tensor(subgraph, {output_channels}, bias.data());
+  EXPECT_EQ(xnn_status_success, xnn_define_convolution_2d(subgraph, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+    input_channels, output_channels, -INFINITY, INFINITY, input_id, filter_id, bias_id, output_id, 0 /* flags */));
+}
+
+// Reference Fully Connected (and 1x1 Convolution) on rows of input_channels elements with the given input stride.
+static std::vector<float> reference_fully_connected(const float* input, size_t batch_size, size_t input_stride,
+  const std::vector<float>& filter, const std::vector<float>& bias)
+{
+  const size_t output_channels = bias.size();
+  const size_t input_channels = filter.size() / output_channels;
+  std::vector<float> output(batch_size * output_channels);
+  for (size_t b = 0; b < batch_size; b++) {
+    for (size_t oc = 0; oc < output_channels; oc++) {
+      float acc = bias[oc];
+      for (size_t ic = 0; ic < input_channels; ic++) {
+        acc += input[b * input_stride + ic] * filter[oc * input_channels + ic];
+      }
+      output[b * output_channels + oc] = acc;
+    }
+  }
+  return output;
+}
+
+static void verify_near(const std::vector<float>& reference, const std::vector<float>& output)
+{
+  ASSERT_EQ(reference.size(), output.size());
+  for (size_t i = 0; i < reference.size(); i++) {
+    ASSERT_NEAR(reference[i], output[i], 1.0e-5f * std::max(1.0f, std::abs(reference[i]))) << "at " << i;
+  }
+}
+
+static uint32_t count_copy_nodes(xnn_runtime_t runtime)
+{
+  uint32_t num_copy_nodes = 0;
+  for (uint32_t n = 0; n < runtime->subgraph->num_nodes; n++) {
+    if (runtime->subgraph->nodes[n].type == xnn_node_type_copy) {
+      num_copy_nodes += 1;
+    }
+  }
+  return num_copy_nodes;
+}
+
+static xnn_runtime_t create_runtime(xnn_subgraph_t subgraph)
+{
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success,
+    xnn_create_runtime_v3(subgraph, nullptr /* workspace */, nullptr /* threadpool */, 0 /* flags */, &runtime));
+  xnn_delete_subgraph(subgraph);
+  return runtime;
+}
+
+TEST(CHANNEL_VIEWS, fully_connected_flattened_4d_input) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  // [1, 2, 2, 4] input is flattened into a [1, 16] matrix.
+  const std::vector<float> filter = random_data(5 * 16);
+  const std::vector<float> bias = random_data(5);
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph));
+  const uint32_t input_id = define_tensor(subgraph, {1, 2, 2, 4}, nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output_id = define_tensor(subgraph, {1, 5}, nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  define_fully_connected(subgraph, input_id, output_id, filter, bias);
+  xnn_runtime_t runtime = create_runtime(subgraph);
+  ASSERT_NE(nullptr, runtime);
+
+  std::vector<float> input = random_data(1 * 2 * 2 * 4);
+  std::vector<float> output(1 * 5, std::nanf(""));
+  const std::array<xnn_external_value, 2> external = {{
+    xnn_external_value{0, input.data()}, xnn_external_value{1, output.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  verify_near(reference_fully_connected(input.data(), 1, 16, filter, bias), output);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(CHANNEL_VIEWS, fully_connected_flattened_3d_input) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  // [2, 3, 4] input is flattened into a [2, 12] matrix.
+  const std::vector<float> filter = random_data(7 * 12);
+  const std::vector<float> bias = random_data(7);
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph));
+  const uint32_t input_id = define_tensor(subgraph, {2, 3, 4}, nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output_id = define_tensor(subgraph, {2, 7}, nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  define_fully_connected(subgraph, input_id, output_id, filter, bias);
+  xnn_runtime_t runtime = create_runtime(subgraph);
+  ASSERT_NE(nullptr, runtime);
+
+  std::vector<float> input = random_data(2 * 3 * 4);
+  std::vector<float> output(2 * 7, std::nanf(""));
+  const std::array<xnn_external_value, 2> external = {{
+    xnn_external_value{0, input.data()}, xnn_external_value{1, output.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  verify_near(reference_fully_connected(input.data(), 2, 12, filter, bias), output);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(CHANNEL_VIEWS, concatenate_strided_producers) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  // output = -concatenate(conv1x1(input), clamp(input))
+  const std::vector<float> filter = random_data(5 * 3);
+  const std::vector<float> bias = random_data(5);
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph));
+  const uint32_t input_id = define_tensor(subgraph, {1, 4, 4, 3}, nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output_id = define_tensor(subgraph, {1, 4, 4, 8}, nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t conv_id = define_tensor(subgraph, {1, 4, 4, 5}, nullptr);
+  const uint32_t clamp_id = define_tensor(subgraph, {1, 4, 4, 3}, nullptr);
+  const uint32_t concat_id = define_tensor(subgraph, {1, 4, 4, 8}, nullptr);
+  define_convolution_1x1(subgraph, input_id, conv_id, filter, bias);
+  ASSERT_EQ(xnn_status_success, xnn_define_clamp(subgraph, -0.5f, 0.5f, input_id, clamp_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success, xnn_define_concatenate2(subgraph, conv_id, clamp_id, concat_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success, xnn_define_negate(subgraph, concat_id, output_id, 0 /* flags */));
+  xnn_runtime_t runtime = create_runtime(subgraph);
+  ASSERT_NE(nullptr, runtime);
+
+  // Both producers write directly into their slices of the Concatenate output.
+  ASSERT_EQ(0, count_copy_nodes(runtime));
+  ASSERT_EQ(concat_id, runtime->blobs[conv_id].view_of);
+  ASSERT_EQ(concat_id, runtime->blobs[clamp_id].view_of);
+  ASSERT_EQ(8, runtime->blobs[conv_id].channel_stride);
+  ASSERT_EQ(8, runtime->blobs[clamp_id].channel_stride);
+
+  std::vector<float> input = random_data(1 * 4 * 4 * 3);
+  std::vector<float> output(1 * 4 * 4 * 8, std::nanf(""));
+  const std::array<xnn_external_value, 2> external = {{
+    xnn_external_value{0, input.data()}, xnn_external_value{1, output.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  const std::vector<float> conv = reference_fully_connected(input.data(), 4 * 4, 3, filter, bias);
+  for (size_t p = 0; p < 4 * 4; p++) {
+    for (size_t c = 0; c < 5; c++) {
+      ASSERT_NEAR(-conv[p * 5 + c], output[p * 8 + c], 1.0e-5f * std::max(1.0f, std::abs(conv[p * 5 + c])))
+        << "pixel " << p << ", channel " << c;
+    }
+    for (size_t c = 0; c < 3; c++) {
+      ASSERT_EQ(-std::min(std::max(input[p * 3 + c], -0.5f), 0.5f), output[p * 8 + 5 + c])
+        << "pixel " << p << ", channel " << 5 + c;
+    }
+  }
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(CHANNEL_VIEWS, concatenate_external_values) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  // output = concatenate(input1, input2, negate(input1))
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph));
+  const uint32_t input1_id = define_tensor(subgraph, {1, 2, 2, 3}, nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t input2_id = define_tensor(subgraph, {1, 2, 2, 5}, nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output_id = define_tensor(subgraph, {1, 2, 2, 11}, nullptr, 2, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t negate_id = define_tensor(subgraph, {1, 2, 2, 3}, nullptr);
+  ASSERT_EQ(xnn_status_success, xnn_define_negate(subgraph, input1_id, negate_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success,
+    xnn_define_concatenate3(subgraph, input1_id, input2_id, negate_id, output_id, 0 /* flags */));
+  xnn_runtime_t runtime = create_runtime(subgraph);
+  ASSERT_NE(nullptr, runtime);
+
+  // External inputs have no producers which could write into the output, and Negate can't write with a channel
+  // stride: all three inputs are copied.
+  ASSERT_EQ(3, count_copy_nodes(runtime));
+
+  std::vector<float> input1 = random_data(1 * 2 * 2 * 3);
+  std::vector<float> input2 = random_data(1 * 2 * 2 * 5);
+  std::vector<float> output(1 * 2 * 2 * 11, std::nanf(""));
+  const std::array<xnn_external_value, 3> external = {{
+    xnn_external_value{0, input1.data()}, xnn_external_value{1, input2.data()},
+    xnn_external_value{2, output.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  for (size_t p = 0; p < 2 * 2; p++) {
+    for (size_t c = 0; c < 3; c++) {
+      ASSERT_EQ(input1[p * 3 + c], output[p * 11 + c]) << "pixel " << p << ", channel " << c;
+      ASSERT_EQ(-input1[p * 3 + c], output[p * 11 + 8 + c]) << "pixel " << p << ", channel " << 8 + c;
+    }
+    for (size_t c = 0; c < 5; c++) {
+      ASSERT_EQ(input2[p * 5 + c], output[p * 11 + 3 + c]) << "pixel " << p << ", channel " << 3 + c;
+    }
+  }
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(CHANNEL_VIEWS, concatenate_external_output) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  // output1 = conv1x1(input), output2 = concatenate(output1, clamp(input))
+  const std::vector<float> filter = random_data(5 * 3);
+  const std::vector<float> bias = random_data(5);
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph));
+  const uint32_t input_id = define_tensor(subgraph, {1, 4, 4, 3}, nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output1_id = define_tensor(subgraph, {1, 4, 4, 5}, nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t output2_id = define_tensor(subgraph, {1, 4, 4, 8}, nullptr, 2, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t clamp_id = define_tensor(subgraph, {1, 4, 4, 3}, nullptr);
+  define_convolution_1x1(subgraph, input_id, output1_id, filter, bias);
+  ASSERT_EQ(xnn_status_success, xnn_define_clamp(subgraph, -0.5f, 0.5f, input_id, clamp_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success, xnn_define_concatenate2(subgraph, output1_id, clamp_id, output2_id, 0 /* flags */));
+  xnn_runtime_t runtime = create_runtime(subgraph);
+  ASSERT_NE(nullptr, runtime);
+
+  // The Convolution writes into the external output, which is copied into the Concatenate output. Clamp writes directly
+  // into its slice of the Concatenate output.
+  ASSERT_EQ(1, count_copy_nodes(runtime));
+  ASSERT_EQ(XNN_INVALID_VALUE_ID, runtime->blobs[output1_id].view_of);
+  ASSERT_EQ(output2_id, runtime->blobs[clamp_id].view_of);
+
+  std::vector<float> input = random_data(1 * 4 * 4 * 3);
+  std::vector<float> output1(1 * 4 * 4 * 5, std::nanf(""));
+  std::vector<float> output2(1 * 4 * 4 * 8, std::nanf(""));
+  const std::array<xnn_external_value, 3> external = {{
+    xnn_external_value{0, input.data()}, xnn_external_value{1, output1.data()},
+    xnn_external_value{2, output2.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  const std::vector<float> conv = reference_fully_connected(input.data(), 4 * 4, 3, filter, bias);
+  verify_near(conv, output1);
+  for (size_t p = 0; p < 4 * 4; p++) {
+    for (size_t c = 0; c < 5; c++) {
+      ASSERT_EQ(output1[p * 5 + c], output2[p * 8 + c]) << "pixel " << p << ", channel " << c;
+    }
+    for (size_t c = 0; c < 3; c++) {
+      ASSERT_EQ(std::min(std::max(input[p * 3 + c], -0.5f), 0.5f), output2[p * 8 + 5 + c])
+        << "pixel " << p << ", channel " << 5 + c;
+    }
+  }
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(CHANNEL_VIEWS, split_strided_consumers) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  // [output1, output2] = [clamp(slice1), conv1x1(slice2)], where [slice1, slice2] = split(-input)
+  const std::vector<float> filter = random_data(2 * 5);
+  const std::vector<float> bias = random_data(2);
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph));
+  const uint32_t input_id = define_tensor(subgraph, {1, 4, 4, 8}, nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output1_id = define_tensor(subgraph, {1, 4, 4, 3}, nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t output2_id = define_tensor(subgraph, {1, 4, 4, 2}, nullptr, 2, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t negate_id = define_tensor(subgraph, {1, 4, 4, 8}, nullptr);
+  const uint32_t slice1_id = define_tensor(subgraph, {1, 4, 4, 3}, nullptr);
+  const uint32_t slice2_id = define_tensor(subgraph, {1, 4, 4, 5}, nullptr);
+  ASSERT_EQ(xnn_status_success, xnn_define_negate(subgraph, input_id, negate_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success, xnn_define_split2(subgraph, negate_id, slice1_id, slice2_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success, xnn_define_clamp(subgraph, -0.5f, 0.5f, slice1_id, output1_id, 0 /* flags */));
+  define_convolution_1x1(subgraph, slice2_id, output2_id, filter, bias);
+  xnn_runtime_t runtime = create_runtime(subgraph);
+  ASSERT_NE(nullptr, runtime);
+
+  // Both consumers read directly from their slices of the Split input.
+  ASSERT_EQ(0, count_copy_nodes(runtime));
+  ASSERT_EQ(negate_id, runtime->blobs[slice1_id].view_of);
+  ASSERT_EQ(negate_id, runtime->blobs[slice2_id].view_of);
+
+  std::vector<float> input = random_data(1 * 4 * 4 * 8);
+  std::vector<float> output1(1 * 4 * 4 * 3, std::nanf(""));
+  std::vector<float> output2(1 * 4 * 4 * 2, std::nanf(""));
+  const std::array<xnn_external_value, 3> external = {{
+    xnn_external_value{0, input.data()}, xnn_external_value{1, output1.data()},
+    xnn_external_value{2, output2.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  std::vector<float> negated(input.size());
+  std::transform(input.cbegin(), input.cend(), negated.begin(), [](float x) { return -x; });
+  for (size_t p = 0; p < 4 * 4; p++) {
+    for (size_t c = 0; c < 3; c++) {
+      ASSERT_EQ(std::min(std::max(negated[p * 8 + c], -0.5f), 0.5f), output1[p * 3 + c])
+        << "pixel " << p << ", channel " << c;
+    }
+  }
+  verify_near(reference_fully_connected(negated.data() + 3, 4 * 4, 8, filter, bias), output2);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(CHANNEL_VIEWS, split_copies) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  // [output1, output2] = [slice1, abs(slice2)], where [slice1, slice2] = split(input)
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph));
+  const uint32_t input_id = define_tensor(subgraph, {1, 2, 2, 7}, nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output1_id = define_tensor(subgraph, {1, 2, 2, 4}, nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t output2_id = define_tensor(subgraph, {1, 2, 2, 3}, nullptr, 2, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t slice2_id = define_tensor(subgraph, {1, 2, 2, 3}, nullptr);
+  ASSERT_EQ(xnn_status_success, xnn_define_split2(subgraph, input_id, output1_id, slice2_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success, xnn_define_abs(subgraph, slice2_id, output2_id, 0 /* flags */));
+  xnn_runtime_t runtime = create_runtime(subgraph);
+  ASSERT_NE(nullptr, runtime);
+
+  // External output must be dense, and Abs can't read with a channel stride: both outputs are copied.
+  ASSERT_EQ(2, count_copy_nodes(runtime));
+
+  std::vector<float> input = random_data(1 * 2 * 2 * 7);
+  std::vector<float> output1(1 * 2 * 2 * 4, std::nanf(""));
+  std::vector<float> output2(1 * 2 * 2 * 3, std::nanf(""));
+  const std::array<xnn_external_value, 3> external = {{
+    xnn_external_value{0, input.data()}, xnn_external_value{1, output1.data()},
+    xnn_external_value{2, output2.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  for (size_t p = 0; p < 2 * 2; p++) {
+    for (size_t c = 0; c < 4; c++) {
+      ASSERT_EQ(input[p * 7 + c], output1[p * 4 + c]) << "pixel " << p << ", channel " << c;
+    }
+    for (size_t c = 0; c < 3; c++) {
+      ASSERT_EQ(std::abs(input[p * 7 + 4 + c]), output2[p * 3 + c]) << "pixel " << p << ", channel " << c;
+    }
+  }
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(CHANNEL_VIEWS, split_flattening_fully_connected) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  // [output1, output2] = [fc(flatten(slice1)), fc(slice2)], where [slice1, slice2] = split(input)
+  const std::vector<float> filter1 = random_data(3 * 16);
+  const std::vector<float> bias1 = random_data(3);
+  const std::vector<float> filter2 = random_data(2 * 4);
+  const std::vector<float> bias2 = random_data(2);
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph));
+  const uint32_t input_id = define_tensor(subgraph, {1, 2, 2, 8}, nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  const uint32_t output1_id = define_tensor(subgraph, {1, 3}, nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t output2_id = define_tensor(subgraph, {1, 2, 2, 2}, nullptr, 2, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  const uint32_t slice1_id = define_tensor(subgraph, {1, 2, 2, 4}, nullptr);
+  const uint32_t slice2_id = define_tensor(subgraph, {1, 2, 2, 4}, nullptr);
+  ASSERT_EQ(xnn_status_success, xnn_define_split2(subgraph, input_id, slice1_id, slice2_id, 0 /* flags */));
+  define_fully_connected(subgraph, slice1_id, output1_id, filter1, bias1);
+  define_fully_connected(subgraph, slice2_id, output2_id, filter2, bias2);
+  xnn_runtime_t runtime = create_runtime(subgraph);
+  ASSERT_NE(nullptr, runtime);
+
+  // The flattening Fully Connected reads a dense copy of its slice, while the other one reads its slice in place.
+  ASSERT_EQ(1, count_copy_nodes(runtime));
+  ASSERT_EQ(input_id, runtime->blobs[slice2_id].view_of);
+
+  std::vector<float> input = random_data(1 * 2 * 2 * 8);
+  std::vector<float> output1(1 * 3, std::nanf(""));
+  std::vector<float> output2(1 * 2 * 2 * 2, std::nanf(""));
+  const std::array<xnn_external_value, 3> external = {{
+    xnn_external_value{0, input.data()}, xnn_external_value{1, output1.data()},
+    xnn_external_value{2, output2.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  std::vector<float> slice1(1 * 2 * 2 * 4);
+  for (size_t p = 0; p < 2 * 2; p++) {
+    std::copy(input.cbegin() + p * 8, input.cbegin() + p * 8 + 4, slice1.begin() + p * 4);
+  }
+  verify_near(reference_fully_connected(slice1.data(), 1, 16, filter1, bias1), output1);
+  verify_near(reference_fully_connected(input.data() + 4, 2 * 2, 8, filter2, bias2), output2);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
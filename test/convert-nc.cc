@@ -0,0 +1,301 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "convert-operator-tester.h"
+
+
+TEST(CONVERT_NC_F16_F32, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    ConvertOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestF16toF32();
+  }
+}
+
+TEST(CONVERT_NC_F16_F32, small_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestF16toF32();
+  }
+}
+
+TEST(CONVERT_NC_F16_F32, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestF16toF32();
+  }
+}
+
+TEST(CONVERT_NC_F16_F32, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestF16toF32();
+  }
+}
+
+TEST(CONVERT_NC_F16_F32, small_batch_with_input_and_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .output_stride(117)
+      .iterations(3)
+      .TestF16toF32();
+  }
+}
+
+TEST(CONVERT_NC_F32_F16, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    ConvertOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestF32toF16();
+  }
+}
+
+TEST(CONVERT_NC_F32_F16, small_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestF32toF16();
+  }
+}
+
+TEST(CONVERT_NC_F32_F16, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestF32toF16();
+  }
+}
+
+TEST(CONVERT_NC_F32_F16, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestF32toF16();
+  }
+}
+
+TEST(CONVERT_NC_F32_F16, small_batch_with_input_and_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .output_stride(117)
+      .iterations(3)
+      .TestF32toF16();
+  }
+}
+
+TEST(CONVERT_NC_F32_QS8, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    ConvertOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestF32toQS8();
+  }
+}
+
+TEST(CONVERT_NC_F32_QS8, small_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestF32toQS8();
+  }
+}
+
+TEST(CONVERT_NC_F32_QS8, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestF32toQS8();
+  }
+}
+
+TEST(CONVERT_NC_F32_QS8, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestF32toQS8();
+  }
+}
+
+TEST(CONVERT_NC_F32_QS8, small_batch_with_input_and_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .output_stride(117)
+      .iterations(3)
+      .TestF32toQS8();
+  }
+}
+
+TEST(CONVERT_NC_F32_QS8, scale) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .scale(0.002f)
+      .iterations(3)
+      .TestF32toQS8();
+  }
+}
+
+TEST(CONVERT_NC_F32_QS8, zero_point) {
+  for (int16_t zero_point = std::numeric_limits<int8_t>::min();
+       zero_point <= std::numeric_limits<int8_t>::max();
+       zero_point += 51)
+  {
+    for (size_t channels = 1; channels < 100; channels += 15) {
+      ConvertOperatorTester()
+        .batch_size(3)
+        .channels(channels)
+        .zero_point(zero_point)
+        .iterations(3)
+        .TestF32toQS8();
+    }
+  }
+}
+
+TEST(CONVERT_NC_F32_QS8, qmin) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .qmin(-64)
+      .iterations(3)
+      .TestF32toQS8();
+  }
+}
+
+TEST(CONVERT_NC_F32_QS8, qmax) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .qmax(64)
+      .iterations(3)
+      .TestF32toQS8();
+  }
+}
+
+TEST(CONVERT_NC_QS8_F32, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    ConvertOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestQS8toF32();
+  }
+}
+
+TEST(CONVERT_NC_QS8_F32, small_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestQS8toF32();
+  }
+}
+
+TEST(CONVERT_NC_QS8_F32, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestQS8toF32();
+  }
+}
+
+TEST(CONVERT_NC_QS8_F32, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestQS8toF32();
+  }
+}
+
+TEST(CONVERT_NC_QS8_F32, small_batch_with_input_and_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .output_stride(117)
+      .iterations(3)
+      .TestQS8toF32();
+  }
+}
+
+TEST(CONVERT_NC_QS8_F32, scale) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConvertOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .scale(500.0f)
+      .iterations(3)
+      .TestQS8toF32();
+  }
+}
+
+TEST(CONVERT_NC_QS8_F32, zero_point) {
+  for (int16_t zero_point = std::numeric_limits<int8_t>::min();
+       zero_point <= std::numeric_limits<int8_t>::max();
+       zero_point += 51)
+  {
+    for (size_t channels = 1; channels < 100; channels += 15) {
+      ConvertOperatorTester()
+        .batch_size(3)
+        .channels(channels)
+        .zero_point(zero_point)
+        .iterations(3)
+        .TestQS8toF32();
+    }
+  }
+}
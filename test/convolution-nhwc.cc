@@ -11,6 +11,203 @@
 #include "convolution-operator-tester.h"
 
 
+TEST(CONVOLUTION_NHWC_QC8, 1x1) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, 1x1_with_qmin) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, 1x1_with_qmax) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, 1x1_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .input_channel_stride(28)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, 1x1_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .output_channel_stride(29)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, 1x1_without_bias) {
+  ConvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(13, 14)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, 1x1_with_batch) {
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_size(13, 14)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, grouped_1x1) {
+  ConvolutionOperatorTester()
+    .input_size(24, 25)
+    .kernel_size(1, 1)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(19)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, 3x3) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, 3x3_without_bias) {
+  ConvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, 3x3s2) {
+  ConvolutionOperatorTester()
+    .input_size(14, 13)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(17)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, grouped_3x3) {
+  ConvolutionOperatorTester()
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(14)
+    .group_output_channels(13)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, depthwise_3x3) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(27)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, depthwise_3x3_without_bias) {
+  ConvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(27)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, depthwise_3x3s2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .groups(27)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, depthwise_3x3d2) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(2, 2)
+    .kernel_size(3, 3)
+    .dilation(2)
+    .groups(27)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, depthwise_5x5) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(2, 2)
+    .kernel_size(5, 5)
+    .groups(27)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
+TEST(CONVOLUTION_NHWC_QC8, depthwise_7x7) {
+  ConvolutionOperatorTester()
+    .input_size(15, 14)
+    .padding(3, 3)
+    .kernel_size(7, 7)
+    .groups(27)
+    .iterations(3)
+    .TestNHWCxQC8();
+}
+
 TEST(CONVOLUTION_NHWC_QS8, 1x1) {
   ConvolutionOperatorTester()
     .input_size(27, 29)
@@ -2337,6 +2534,49 @@ TEST(CONVOLUTION_NHWC_F32, 1x1_with_batch) {
     .TestNHWCxF32();
 }
 
+TEST(CONVOLUTION_NHWC_F32, 1x1_many_output_channels) {
+  ConvolutionOperatorTester()
+    .input_size(13, 14)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(77)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 1x1_many_output_channels_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(13, 14)
+    .kernel_size(1, 1)
+    .input_channel_stride(28)
+    .group_input_channels(23)
+    .group_output_channels(77)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 1x1_many_output_channels_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(13, 14)
+    .kernel_size(1, 1)
+    .output_channel_stride(83)
+    .group_input_channels(23)
+    .group_output_channels(77)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 1x1_many_output_channels_with_batch) {
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_size(13, 14)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(77)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
 TEST(CONVOLUTION_NHWC_F32, grouped_1x1) {
   ConvolutionOperatorTester()
     .input_size(24, 25)
@@ -2814,6 +3054,45 @@ TEST(CONVOLUTION_NHWC_F32, grouped_3x3_with_batch) {
     .TestNHWCxF32();
 }
 
+TEST(CONVOLUTION_NHWC_F32, grouped_1x1_multithreaded) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .groups(3)
+    .group_input_channels(23)
+    .group_output_channels(37)
+    .num_threads(4)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, grouped_3x3_multithreaded) {
+  ConvolutionOperatorTester()
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(3)
+    .group_input_channels(14)
+    .group_output_channels(37)
+    .num_threads(4)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, grouped_3x3_multithreaded_without_bias) {
+  ConvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(10, 11)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(3)
+    .group_input_channels(14)
+    .group_output_channels(37)
+    .num_threads(4)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
 TEST(CONVOLUTION_NHWC_F32, 3x3s2) {
   ConvolutionOperatorTester()
     .input_size(14, 13)
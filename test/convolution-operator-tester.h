@@ -21,8 +21,10 @@
 #include <vector>
 
 #include <fp16.h>
+#include <pthreadpool.h>
 
 #include <xnnpack.h>
+#include <xnnpack/weights-cache.h>
 
 
 class ConvolutionOperatorTester {
@@ -497,6 +499,15 @@ class ConvolutionOperatorTester {
     return this->has_bias_;
   }
 
+  inline ConvolutionOperatorTester& num_threads(size_t num_threads) {
+    this->num_threads_ = num_threads;
+    return *this;
+  }
+
+  inline size_t num_threads() const {
+    return this->num_threads_;
+  }
+
   inline ConvolutionOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -674,6 +685,182 @@ class ConvolutionOperatorTester {
     }
   }
 
+  void TestNHWCxQC8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()), rng);
+    auto scalerng = std::bind(std::uniform_real_distribution<float>(0.25f, 1.0f), rng);
+
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) +
+      batch_size() * ((input_height() * input_width() - 1) * input_channel_stride() + groups() * group_input_channels()) + 8);
+    std::vector<int8_t> kernel(groups() * group_output_channels() * kernel_height() * kernel_width() * group_input_channels());
+    std::vector<int32_t> bias(groups() * group_output_channels());
+    std::vector<float> kernel_scale(groups() * group_output_channels());
+    std::vector<int8_t> output(batch_size() * ((output_height() * output_width() - 1) * output_channel_stride() + groups() * group_output_channels()));
+    std::vector<double> accumulators(batch_size() * output_height() * output_width() * groups() * group_output_channels());
+    std::vector<double> output_ref(batch_size() * output_height() * output_width() * groups() * group_output_channels());
+
+    const int8_t input_zero_point = -1;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(i8rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(i8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(i32rng));
+      std::generate(kernel_scale.begin(), kernel_scale.end(), std::ref(scalerng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      // Compute reference results, without renormalization.
+      if (has_bias()) {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oy = 0; oy < output_height(); oy++) {
+            for (size_t ox = 0; ox < output_width(); ox++) {
+              for (size_t g = 0; g < groups(); g++) {
+                for (size_t oc = 0; oc < group_output_channels(); oc++) {
+                  accumulators[(((i * output_height() + oy) * output_width() + ox) * groups() + g) * group_output_channels() + oc] =
+                    double(bias[g * group_output_channels() + oc]);
+                }
+              }
+            }
+          }
+        }
+      } else {
+        std::fill(accumulators.begin(), accumulators.end(), 0);
+      }
+      if (depthwise_layout()) {
+        ASSERT_EQ(group_input_channels(), 1);
+
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oy = 0; oy < output_height(); oy++) {
+            for (size_t ox = 0; ox < output_width(); ox++) {
+              for (size_t ky = 0; ky < kernel_height(); ky++) {
+                const size_t iy = oy * subsampling_height() + ky * dilation_height() - padding_top();
+                if (iy < input_height()) {
+                  for (size_t kx = 0; kx < kernel_width(); kx++) {
+                    const size_t ix = ox * subsampling_width() + kx * dilation_width() - padding_left();
+                    if (ix < input_width()) {
+                      for (size_t g = 0; g < groups(); g++) {
+                        for (size_t oc = 0; oc < group_output_channels(); oc++) {
+                          accumulators[(((i * output_height() + oy) * output_width() + ox) * groups() + g) * group_output_channels() + oc] +=
+                            (int32_t(input[((i * input_height() + iy) * input_width() + ix) * input_channel_stride() + g]) - int32_t(input_zero_point)) *
+                            int32_t(kernel[((ky * kernel_width() + kx) * groups() + g) * group_output_channels() + oc]);
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      } else {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oy = 0; oy < output_height(); oy++) {
+            for (size_t ox = 0; ox < output_width(); ox++) {
+              for (size_t ky = 0; ky < kernel_height(); ky++) {
+                const size_t iy = oy * subsampling_height() + ky * dilation_height() - padding_top();
+                if (iy < input_height()) {
+                  for (size_t kx = 0; kx < kernel_width(); kx++) {
+                    const size_t ix = ox * subsampling_width() + kx * dilation_width() - padding_left();
+                    if (ix < input_width()) {
+                      for (size_t g = 0; g < groups(); g++) {
+                        for (size_t oc = 0; oc < group_output_channels(); oc++) {
+                          for (size_t ic = 0; ic < group_input_channels(); ic++) {
+                            accumulators[(((i * output_height() + oy) * output_width() + ox) * groups() + g) * group_output_channels() + oc] +=
+                              (int32_t(input[((i * input_height() + iy) * input_width() + ix) * input_channel_stride() + g * group_input_channels() + ic]) - int32_t(input_zero_point)) *
+                              int32_t(kernel[(((g * group_output_channels() + oc) * kernel_height() + ky) * kernel_width() + kx) * group_input_channels() + ic]);
+                          }
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+
+      // Apply per-channel kernel scales.
+      for (size_t i = 0; i < accumulators.size(); i++) {
+        accumulators[i] *= double(kernel_scale[i % (groups() * group_output_channels())]);
+      }
+
+      // Compute renormalization parameters.
+      const double accumulated_min = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const double accumulated_max = *std::max_element(accumulators.cbegin(), accumulators.cend());
+
+      const double output_scale = (accumulated_max - accumulated_min) / 255.0;
+      const int8_t output_zero_point = int8_t(std::max(std::min(
+        lrint(-0.5 - 0.5 * (accumulated_min + accumulated_max) / output_scale),
+        long(std::numeric_limits<int8_t>::max())), long(std::numeric_limits<int8_t>::min())));
+
+      // Renormalize reference results.
+      std::transform(accumulators.cbegin(), accumulators.cend(), output_ref.begin(),
+        [this, output_scale, output_zero_point](double x) -> double {
+          return std::max<double>(std::min<double>(x / output_scale, double(qmax() - 0x80) - output_zero_point), double(qmin() - 0x80) - output_zero_point);
+        });
+
+      // Create, setup, run, and destroy Convolution operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t convolution_op = nullptr;
+
+      xnn_status status = xnn_create_convolution2d_nhwc_qc8(
+          padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+          padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+          kernel_height(), kernel_width(),
+          subsampling_height(), subsampling_width(),
+          dilation_height(), dilation_width(),
+          groups(), group_input_channels(), group_output_channels(),
+          input_channel_stride(), output_channel_stride(),
+          input_zero_point, 1.0f /* input scale */, kernel_scale.data(),
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_zero_point, output_scale, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+          (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0),
+          &convolution_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, convolution_op);
+
+      // Smart pointer to automatically delete convolution_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_convolution2d_nhwc_qc8(
+          convolution_op,
+          batch_size(), input_height(), input_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(convolution_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t y = 0; y < output_height(); y++) {
+          for (size_t x = 0; x < output_width(); x++) {
+            for (size_t g = 0; g < groups(); g++) {
+              for (size_t c = 0; c < group_output_channels(); c++) {
+                ASSERT_LE(int32_t(output[((i * output_height() + y) * output_width() + x) * output_channel_stride() + g * group_output_channels() + c]), int32_t(qmax() - 0x80))
+                  << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+                ASSERT_GE(int32_t(output[((i * output_height() + y) * output_width() + x) * output_channel_stride() + g * group_output_channels() + c]), int32_t(qmin() - 0x80))
+                  << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+                ASSERT_NEAR(
+                    output_ref[(((i * output_height() + y) * output_width() + x) * groups() + g) * group_output_channels() + c],
+                    double(output[((i * output_height() + y) * output_width() + x) * output_channel_stride() + g * group_output_channels() + c]) - double(output_zero_point),
+                    0.9)
+                  << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
   void TestNHWCxQU8() const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -944,22 +1131,47 @@ class ConvolutionOperatorTester {
         value = std::max(std::min(value, output_max), output_min);
       }
 
+      // Thread pool is used both for packing of weights and for computation.
+      std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+      if (num_threads() > 1) {
+        auto_threadpool.reset(pthreadpool_create(num_threads()));
+        ASSERT_NE(nullptr, auto_threadpool.get());
+      }
+
       // Create, setup, run, and destroy Convolution operator.
       ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
       xnn_operator_t convolution_op = nullptr;
 
-      xnn_status status = xnn_create_convolution2d_nhwc_f32(
-          padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
-          padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
-          kernel_height(), kernel_width(),
-          subsampling_height(), subsampling_width(),
-          dilation_height(), dilation_width(),
-          groups(), group_input_channels(), group_output_channels(),
-          input_channel_stride(), output_channel_stride(),
-          kernel.data(), has_bias() ? bias.data() : nullptr,
-          output_min, output_max,
-          (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0),
-          &convolution_op);
+      xnn_status status = xnn_status_success;
+      if (num_threads() > 1) {
+        // Only the internal creation function takes a thread pool to pack the weights.
+        status = xnn_create_convolution2d_nhwc_f32_with_weights_cache(
+            padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+            padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+            kernel_height(), kernel_width(),
+            subsampling_height(), subsampling_width(),
+            dilation_height(), dilation_width(),
+            groups(), group_input_channels(), group_output_channels(),
+            input_channel_stride(), output_channel_stride(),
+            kernel.data(), has_bias() ? bias.data() : nullptr,
+            output_min, output_max,
+            (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0),
+            nullptr /* weights cache */, auto_threadpool.get(),
+            &convolution_op);
+      } else {
+        status = xnn_create_convolution2d_nhwc_f32(
+            padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+            padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+            kernel_height(), kernel_width(),
+            subsampling_height(), subsampling_width(),
+            dilation_height(), dilation_width(),
+            groups(), group_input_channels(), group_output_channels(),
+            input_channel_stride(), output_channel_stride(),
+            kernel.data(), has_bias() ? bias.data() : nullptr,
+            output_min, output_max,
+            (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0),
+            &convolution_op);
+      }
       if (status == xnn_status_unsupported_hardware) {
         GTEST_SKIP();
       }
@@ -974,10 +1186,10 @@ class ConvolutionOperatorTester {
           convolution_op,
           batch_size(), input_height(), input_width(),
           input.data(), output.data(),
-          nullptr /* thread pool */));
+          auto_threadpool.get()));
 
       ASSERT_EQ(xnn_status_success,
-        xnn_run_operator(convolution_op, nullptr /* thread pool */));
+        xnn_run_operator(convolution_op, auto_threadpool.get()));
 
       // Verify results.
       for (size_t i = 0; i < batch_size(); i++) {
@@ -2271,5 +2483,6 @@ class ConvolutionOperatorTester {
   bool depthwise_layout_{false};
   bool force_nhwc_input_{false};
   bool has_bias_{true};
+  size_t num_threads_{1};
   size_t iterations_{1};
 };
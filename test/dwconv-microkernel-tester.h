@@ -87,6 +87,33 @@ class DWConvMicrokernelTester {
     return this->kr_;
   }
 
+  inline DWConvMicrokernelTester& primary_tile(uint32_t primary_tile) {
+    assert(primary_tile != 0);
+    this->primary_tile_ = primary_tile;
+    return *this;
+  }
+
+  inline uint32_t primary_tile() const {
+    return this->primary_tile_;
+  }
+
+  inline DWConvMicrokernelTester& incremental_tile(uint32_t incremental_tile) {
+    assert(incremental_tile != 0);
+    this->incremental_tile_ = incremental_tile;
+    return *this;
+  }
+
+  inline uint32_t incremental_tile() const {
+    return this->incremental_tile_;
+  }
+
+  // Number of kernel taps read by a multipass micro-kernel: the primary tile plus a whole number of incremental tiles.
+  inline uint32_t tiled_kr() const {
+    assert(kr() > primary_tile());
+    assert(incremental_tile() != 0);
+    return primary_tile() + (kr() - primary_tile() + incremental_tile() - 1) / incremental_tile() * incremental_tile();
+  }
+
   inline uint32_t packed_channels() const {
     return (channels() / cr() + !!(channels() % cr())) * cr();
   }
@@ -199,8 +226,8 @@ class DWConvMicrokernelTester {
       std::fill(packed_weights.begin(), packed_weights.end(), 0);
       const xnn_qu8_packing_params packing_params = { input_zero_point(), kernel_zero_point() };
       xnn_pack_qu8_dwconv_ghw_w(
-        kr(), 1, channels(), cr(),
-        kernel.data(), bias.data(), packed_weights.data(), &packing_params);
+        kr(), 0 /* incremental tile */, kr(), 1, channels(), cr(),
+        kernel.data(), bias.data(), packed_weights.data(), 0, &packing_params);
       for (size_t i = 0; i < indirection.size(); i++) {
         indirection[i] = input.data() + i * channels() - input_offset();
       }
@@ -312,8 +339,8 @@ class DWConvMicrokernelTester {
       std::fill(packed_weights.begin(), packed_weights.end(), 0);
       const xnn_qs8_packing_params packing_params = { int8_t(input_zero_point() - 0x80) };
       xnn_pack_qs8_dwconv_ghw_w(
-        kr(), 1, channels(), cr(),
-        kernel.data(), bias.data(), packed_weights.data(), &packing_params);
+        kr(), 0 /* incremental tile */, kr(), 1, channels(), cr(),
+        kernel.data(), bias.data(), packed_weights.data(), 0, &packing_params);
       for (size_t i = 0; i < indirection.size(); i++) {
         indirection[i] = input.data() + i * channels() - input_offset();
       }
@@ -394,6 +421,127 @@ class DWConvMicrokernelTester {
     }
   }
 
+  void Test(xnn_qc8_dwconv_minmax_unipass_ukernel_function dwconv_minmax, Variant variant = Variant::Native) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<uint32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()), rng);
+    auto scalerng = std::bind(std::uniform_real_distribution<float>(0.5f, 2.0f), rng);
+
+    std::vector<const int8_t*> indirection((width() - 1) * step() + kr());
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) + indirection.size() * channels());
+    std::vector<int8_t> kernel(channels() * kr());
+    std::vector<int32_t> bias(channels());
+    std::vector<float> scale(channels());
+    std::vector<int8_t, AlignedAllocator<int8_t, 64>> packed_weights((kr() + (sizeof(int32_t) + sizeof(float)) / sizeof(int8_t)) * packed_channels());
+    std::vector<int8_t> zero(channels() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<int8_t> output((width() - 1) * output_stride() + channels());
+    std::vector<int32_t> accumulators(width() * channels());
+    std::vector<int8_t> output_ref(width() * channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      do {
+        std::generate(input.begin(), input.end(), std::ref(i8rng));
+      } while (input.size() > 1 && *std::max_element(input.cbegin(), input.cend()) == *std::min_element(input.cbegin(), input.cend()));
+      do {
+        std::generate(kernel.begin(), kernel.end(), std::ref(i8rng));
+      } while (kernel.size() > 1 && *std::max_element(kernel.cbegin(), kernel.cend()) == *std::min_element(kernel.cbegin(), kernel.cend()));
+      std::generate(bias.begin(), bias.end(), std::ref(i32rng));
+      std::fill(zero.begin(), zero.end(), int8_t(input_zero_point() - 0x80));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      std::fill(packed_weights.begin(), packed_weights.end(), 0);
+      const xnn_qs8_packing_params packing_params = { int8_t(input_zero_point() - 0x80) };
+      xnn_pack_qs8_dwconv_ghw_w(
+        kr(), 0 /* incremental tile */, kr(), 1, channels(), cr(),
+        kernel.data(), bias.data(), packed_weights.data(), cr() * sizeof(float), &packing_params);
+      for (size_t i = 0; i < indirection.size(); i++) {
+        indirection[i] = input.data() + i * channels() - input_offset();
+      }
+      std::shuffle(indirection.begin(), indirection.end(), rng);
+      if (zero_index() != SIZE_MAX) {
+        for (size_t i = 0; i < indirection.size(); i += kr()) {
+          indirection[i + zero_index()] = zero.data();
+        }
+      }
+
+      // Compute reference results, without renormalization.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          float acc = bias[c];
+          for (size_t k = 0; k < kr(); k++) {
+            if (indirection[x * step() + k] != zero.data()) {
+              acc +=
+                (int32_t(indirection[x * step() + k][c + input_offset()]) - int32_t(input_zero_point() - 0x80)) *
+                int32_t(kernel[c * kr() + k]);
+            }
+          }
+          accumulators[x * channels() + c] = acc;
+        }
+      }
+
+      // Compute renormalization parameters.
+      const int32_t accumulated_min = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const int32_t accumulated_max = *std::max_element(accumulators.cbegin(), accumulators.cend());
+      const uint32_t accumulated_range = uint32_t(accumulated_max) - uint32_t(accumulated_min);
+      const double output_scale = accumulated_range >= 256 ? double(accumulated_range) / 255.0 : 1.00001;
+      const int8_t output_zero_point = int8_t(std::max(std::min(
+        lrint(-0.5 - 0.5 * double(accumulated_min + accumulated_max) / output_scale),
+        long(std::numeric_limits<int8_t>::max())), long(std::numeric_limits<int8_t>::min())));
+
+      // Prepare parameters: perturb the common requantization scale to get a distinct scale for every channel.
+      const float requantization_scale = 1.0f / float(output_scale);
+      for (size_t c = 0; c < channels(); c++) {
+        scale[c] = requantization_scale * scalerng();
+      }
+      xnn_init_qc8_scale_fp32_params(
+        channels(), cr(), cr() * (kr() * sizeof(int8_t) + sizeof(int32_t) + sizeof(float)), scale.data(),
+        (void*) ((uintptr_t) packed_weights.data() + cr() * (kr() * sizeof(int8_t) + sizeof(int32_t))));
+
+      union xnn_qc8_gemm_params quantization_params = { };
+      switch (variant) {
+        case Variant::Native:
+          quantization_params = xnn_init_qc8_gemm_params(
+            output_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+          break;
+        case Variant::Scalar:
+          quantization_params = xnn_init_scalar_qc8_gemm_params(
+            output_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+          break;
+      }
+
+      // Renormalize reference results.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          output_ref[x * channels() + c] = xnn_qs8_requantize_fp32(
+            accumulators[x * channels() + c], scale[c], output_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+        }
+      }
+
+      // Call optimized micro-kernel.
+      dwconv_minmax(
+        channels(), width(),
+        indirection.data(), packed_weights.data(), output.data(),
+        step() * sizeof(void*),
+        (output_stride() - channels()) * sizeof(int8_t),
+        input_offset() * sizeof(int8_t), zero.data(),
+        &quantization_params);
+
+      // Verify results.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_GE(int32_t(output[x * output_stride() + c]), int32_t(qmin()) - 0x80)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_LE(int32_t(output[x * output_stride() + c]), int32_t(qmax()) - 0x80)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_EQ(int32_t(output[x * output_stride() + c]), int32_t(output_ref[x * channels() + c]))
+            << "x = " << x << ", channel = " << c << ", accumulator = " << accumulators[x * channels() + c];
+        }
+      }
+    }
+  }
+
   void Test(xnn_f16_dwconv_minmax_unipass_ukernel_function dwconv_minmax, Variant variant = Variant::Native) const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -419,8 +567,8 @@ class DWConvMicrokernelTester {
 
       std::fill(packed_weights.begin(), packed_weights.end(), 0);
       xnn_pack_f16_dwconv_ghw_w(
-        kr(), 1, channels(), cr(),
-        kernel.data(), bias.data(), packed_weights.data(), nullptr);
+        kr(), 0 /* incremental tile */, kr(), 1, channels(), cr(),
+        kernel.data(), bias.data(), packed_weights.data(), 0, nullptr);
       for (size_t i = 0; i < indirection.size(); i++) {
         indirection[i] = input.data() + i * channels() - input_offset();
       }
@@ -508,8 +656,8 @@ class DWConvMicrokernelTester {
 
       std::fill(packed_weights.begin(), packed_weights.end(), 0.0f);
       xnn_pack_f32_dwconv_ghw_w(
-        kr(), 1, channels(), cr(),
-        kernel.data(), bias.data(), packed_weights.data(), nullptr);
+        kr(), 0 /* incremental tile */, kr(), 1, channels(), cr(),
+        kernel.data(), bias.data(), packed_weights.data(), 0, nullptr);
       for (size_t i = 0; i < indirection.size(); i++) {
         indirection[i] = input.data() + i * channels() - input_offset();
       }
@@ -579,8 +727,8 @@ class DWConvMicrokernelTester {
 
       std::fill(packed_weights.begin(), packed_weights.end(), 0.0f);
       xnn_pack_f32_dwconv_ghw_w(
-        kr(), 1, channels(), cr(),
-        kernel.data(), bias.data(), packed_weights.data(), nullptr);
+        kr(), 0 /* incremental tile */, kr(), 1, channels(), cr(),
+        kernel.data(), bias.data(), packed_weights.data(), 0, nullptr);
       for (size_t i = 0; i < indirection.size(); i++) {
         indirection[i] = input.data() + i * channels() - input_offset();
       }
@@ -653,10 +801,470 @@ class DWConvMicrokernelTester {
     }
   }
 
+  void Test(xnn_f32_dwconv_hswish_unipass_ukernel_function dwconv_hswish, Variant variant = Variant::Native) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+
+    std::vector<const float*> indirection((width() - 1) * step() + kr());
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) + indirection.size() * channels());
+    std::vector<float> kernel(channels() * kr());
+    std::vector<float> bias(channels());
+    std::vector<float, AlignedAllocator<float, 64>> packed_weights((kr() + 1) * packed_channels());
+    std::vector<float> zero(channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> output((width() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(width() * channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+      std::fill(zero.begin(), zero.end(), 0.0f);
+      std::fill(output_ref.begin(), output_ref.end(), nanf(""));
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      std::fill(packed_weights.begin(), packed_weights.end(), 0.0f);
+      xnn_pack_f32_dwconv_ghw_w(
+        kr(), 0 /* incremental tile */, kr(), 1, channels(), cr(),
+        kernel.data(), bias.data(), packed_weights.data(), 0, nullptr);
+      for (size_t i = 0; i < indirection.size(); i++) {
+        indirection[i] = input.data() + i * channels() - input_offset();
+      }
+      std::shuffle(indirection.begin(), indirection.end(), rng);
+      if (zero_index() != SIZE_MAX) {
+        for (size_t i = 0; i < indirection.size(); i += kr()) {
+          indirection[i + zero_index()] = zero.data();
+        }
+      }
+
+      // Compute reference results.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          float acc = bias[c];
+          for (size_t k = 0; k < kr(); k++) {
+            if (indirection[x * step() + k] != zero.data()) {
+              acc += indirection[x * step() + k][c + input_offset()] * kernel[c * kr() + k];
+            }
+          }
+          output_ref[x * channels() + c] = acc * std::min(std::max(acc + 3.0f, 0.0f), 6.0f) / 6.0f;
+        }
+      }
+
+      // Prepare parameters.
+      xnn_f32_hswish_params params = { };
+      switch (variant) {
+        case Variant::Native:
+          params = xnn_init_f32_hswish_params();
+          break;
+        case Variant::Scalar:
+          params = xnn_init_scalar_f32_hswish_params();
+          break;
+      }
+
+      // Call optimized micro-kernel.
+      dwconv_hswish(
+        channels(), width(),
+        indirection.data(), packed_weights.data(), output.data(),
+        step() * sizeof(void*),
+        (output_stride() - channels()) * sizeof(float),
+        input_offset() * sizeof(float), zero.data(),
+        &params);
+
+      // Verify results.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(
+              output_ref[x * channels() + c],
+              output[x * output_stride() + c],
+              std::max(1.0e-6, std::abs(output_ref[x * channels() + c]) * 1.0e-5))
+            << "x = " << x << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void Test(xnn_qs8_dwconv_minmax_multipass_ukernel_function dwconv_minmax, Variant variant = Variant::Native) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<uint32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()), rng);
+
+    std::vector<const int8_t*> indirection((width() - 1) * step() + tiled_kr());
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) + indirection.size() * channels());
+    std::vector<int8_t> kernel(channels() * kr());
+    std::vector<int32_t> bias(channels());
+    std::vector<int8_t, AlignedAllocator<int8_t, 64>> packed_weights((tiled_kr() + sizeof(int32_t) / sizeof(int8_t)) * packed_channels());
+    std::vector<int32_t, AlignedAllocator<int32_t, 64>> buffer(packed_channels() + XNN_EXTRA_BYTES / sizeof(int32_t));
+    std::vector<int8_t> zero(channels() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<int8_t> output((width() - 1) * output_stride() + channels());
+    std::vector<int32_t> accumulators(width() * channels());
+    std::vector<int8_t> output_ref(width() * channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      do {
+        std::generate(input.begin(), input.end(), std::ref(i8rng));
+      } while (input.size() > 1 && *std::max_element(input.cbegin(), input.cend()) == *std::min_element(input.cbegin(), input.cend()));
+      do {
+        std::generate(kernel.begin(), kernel.end(), std::ref(i8rng));
+      } while (kernel.size() > 1 && *std::max_element(kernel.cbegin(), kernel.cend()) == *std::min_element(kernel.cbegin(), kernel.cend()));
+      std::generate(bias.begin(), bias.end(), std::ref(i32rng));
+      std::fill(zero.begin(), zero.end(), int8_t(input_zero_point() - 0x80));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      std::fill(packed_weights.begin(), packed_weights.end(), 0);
+      const xnn_qs8_packing_params packing_params = { int8_t(input_zero_point() - 0x80) };
+      xnn_pack_qs8_dwconv_ghw_w(
+        primary_tile(), incremental_tile(), kr(), 1, channels(), cr(),
+        kernel.data(), bias.data(), packed_weights.data(), 0, &packing_params);
+      for (size_t i = 0; i < indirection.size(); i++) {
+        indirection[i] = input.data() + i * channels() - input_offset();
+      }
+      std::shuffle(indirection.begin(), indirection.end(), rng);
+      if (zero_index() != SIZE_MAX) {
+        for (size_t x = 0; x < width(); x++) {
+          indirection[x * step() + zero_index()] = zero.data();
+        }
+      }
+
+      // Compute reference results, without renormalization.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          float acc = bias[c];
+          for (size_t k = 0; k < kr(); k++) {
+            if (indirection[x * step() + k] != zero.data()) {
+              acc +=
+                (int32_t(indirection[x * step() + k][c + input_offset()]) - int32_t(input_zero_point() - 0x80)) *
+                int32_t(kernel[c * kr() + k]);
+            }
+          }
+          accumulators[x * channels() + c] = acc;
+        }
+      }
+
+      // Compute renormalization parameters.
+      const int32_t accumulated_min = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const int32_t accumulated_max = *std::max_element(accumulators.cbegin(), accumulators.cend());
+      const uint32_t accumulated_range = uint32_t(accumulated_max) - uint32_t(accumulated_min);
+      const double output_scale = accumulated_range >= 256 ? double(accumulated_range) / 255.0 : 1.00001;
+      const int8_t output_zero_point = int8_t(std::max(std::min(
+        lrint(-0.5 - 0.5 * double(accumulated_min + accumulated_max) / output_scale),
+        long(std::numeric_limits<int8_t>::max())), long(std::numeric_limits<int8_t>::min())));
+
+      // Prepare parameters.
+      const float requantization_scale = 1.0f / float(output_scale);
+      union xnn_qs8_gemm_params quantization_params = { };
+      switch (variant) {
+        case Variant::Native:
+          quantization_params = xnn_init_qs8_gemm_params(
+            requantization_scale, output_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+          break;
+        case Variant::Scalar:
+          quantization_params = xnn_init_scalar_qs8_gemm_params(
+            requantization_scale, output_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+          break;
+      }
+      const union xnn_qs8_requantization_params scalar_requantization_params =
+        xnn_init_scalar_qs8_requantization_params(requantization_scale, output_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+
+      // Renormalize reference results.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          output_ref[x * channels() + c] = xnn_qs8_requantize_q31(accumulators[x * channels() + c], scalar_requantization_params);
+        }
+      }
+
+      // Call optimized micro-kernel.
+      dwconv_minmax(
+        channels(), width(), kr(),
+        indirection.data(), packed_weights.data(), buffer.data(), output.data(),
+        step() * sizeof(void*),
+        (output_stride() - channels()) * sizeof(int8_t),
+        input_offset() * sizeof(int8_t), zero.data(),
+        &quantization_params);
+
+      // Verify results.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_GE(int32_t(output[x * output_stride() + c]), int32_t(qmin()) - 0x80)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_LE(int32_t(output[x * output_stride() + c]), int32_t(qmax()) - 0x80)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_EQ(int32_t(output[x * output_stride() + c]), int32_t(output_ref[x * channels() + c]))
+            << "x = " << x << ", channel = " << c << ", accumulator = " << accumulators[x * channels() + c];
+        }
+      }
+    }
+  }
+
+  void Test(xnn_f16_dwconv_minmax_multipass_ukernel_function dwconv_minmax, Variant variant = Variant::Native) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 1.0f), rng);
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+    std::vector<const uint16_t*> indirection((width() - 1) * step() + tiled_kr());
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) + indirection.size() * channels());
+    std::vector<uint16_t> kernel(channels() * kr());
+    std::vector<uint16_t> bias(channels());
+    std::vector<uint16_t, AlignedAllocator<uint16_t, 64>> packed_weights((tiled_kr() + 1) * packed_channels());
+    std::vector<uint16_t, AlignedAllocator<uint16_t, 64>> buffer(packed_channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> zero(channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> output((width() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(width() * channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f16rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(f16rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f16rng));
+      std::fill(zero.begin(), zero.end(), 0);
+      std::fill(output_ref.begin(), output_ref.end(), 0.0f);
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      std::fill(packed_weights.begin(), packed_weights.end(), 0);
+      xnn_pack_f16_dwconv_ghw_w(
+        primary_tile(), incremental_tile(), kr(), 1, channels(), cr(),
+        kernel.data(), bias.data(), packed_weights.data(), 0, nullptr);
+      for (size_t i = 0; i < indirection.size(); i++) {
+        indirection[i] = input.data() + i * channels() - input_offset();
+      }
+      std::shuffle(indirection.begin(), indirection.end(), rng);
+      if (zero_index() != SIZE_MAX) {
+        for (size_t x = 0; x < width(); x++) {
+          indirection[x * step() + zero_index()] = zero.data();
+        }
+      }
+
+      // Compute reference results, without clamping.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          float acc = fp16_ieee_to_fp32_value(bias[c]);
+          for (size_t k = 0; k < kr(); k++) {
+            if (indirection[x * step() + k] != zero.data()) {
+              acc += fp16_ieee_to_fp32_value(indirection[x * step() + k][c + input_offset()]) * fp16_ieee_to_fp32_value(kernel[c * kr() + k]);
+            }
+          }
+          output_ref[x * channels() + c] = acc;
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_min + accumulated_range / 255.0f * float(qmin())));
+      const float output_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(accumulated_max - accumulated_range / 255.0f * float(255 - qmax())));
+
+      // Prepare parameters.
+      xnn_f16_minmax_params params = xnn_init_f16_minmax_params(
+        fp16_ieee_from_fp32_value(output_min),
+        fp16_ieee_from_fp32_value(output_max));
+
+      // Clamp reference results.
+      for (float& output_val : output_ref) {
+        output_val = std::max(std::min(output_val, output_max), output_min);
+      }
+
+      // Call optimized micro-kernel.
+      dwconv_minmax(
+        channels(), width(), kr(),
+        reinterpret_cast<const void**>(indirection.data()), packed_weights.data(), buffer.data(), output.data(),
+        step() * sizeof(void*),
+        (output_stride() - channels()) * sizeof(uint16_t),
+        input_offset() * sizeof(uint16_t), zero.data(),
+        &params);
+
+      // Verify results.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_GE(fp16_ieee_to_fp32_value(output[x * output_stride() + c]), output_min)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_LE(fp16_ieee_to_fp32_value(output[x * output_stride() + c]), output_max)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_NEAR(output_ref[x * channels() + c], fp16_ieee_to_fp32_value(output[x * output_stride() + c]), std::max(1.0e-4f, std::abs(output_ref[x * channels() + c]) * 1.0e-2f))
+            << "x = " << x << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void Test(xnn_f32_dwconv_multipass_ukernel_function dwconv) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 1.0f), rng);
+
+    std::vector<const float*> indirection((width() - 1) * step() + tiled_kr());
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) + indirection.size() * channels());
+    std::vector<float> kernel(channels() * kr());
+    std::vector<float> bias(channels());
+    std::vector<float, AlignedAllocator<float, 64>> packed_weights((tiled_kr() + 1) * packed_channels());
+    std::vector<float, AlignedAllocator<float, 64>> buffer(packed_channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> zero(channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> output((width() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(width() * channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+      std::fill(zero.begin(), zero.end(), 0.0f);
+      std::fill(output_ref.begin(), output_ref.end(), nanf(""));
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      std::fill(packed_weights.begin(), packed_weights.end(), 0.0f);
+      xnn_pack_f32_dwconv_ghw_w(
+        primary_tile(), incremental_tile(), kr(), 1, channels(), cr(),
+        kernel.data(), bias.data(), packed_weights.data(), 0, nullptr);
+      for (size_t i = 0; i < indirection.size(); i++) {
+        indirection[i] = input.data() + i * channels() - input_offset();
+      }
+      std::shuffle(indirection.begin(), indirection.end(), rng);
+      if (zero_index() != SIZE_MAX) {
+        for (size_t x = 0; x < width(); x++) {
+          indirection[x * step() + zero_index()] = zero.data();
+        }
+      }
+
+      // Compute reference results, without clamping.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          float acc = bias[c];
+          for (size_t k = 0; k < kr(); k++) {
+            if (indirection[x * step() + k] != zero.data()) {
+              acc += indirection[x * step() + k][c + input_offset()] * kernel[c * kr() + k];
+            }
+          }
+          output_ref[x * channels() + c] = acc;
+        }
+      }
+
+      // Call optimized micro-kernel.
+      dwconv(
+        channels(), width(), kr(),
+        indirection.data(), packed_weights.data(), buffer.data(), output.data(),
+        step() * sizeof(void*),
+        (output_stride() - channels()) * sizeof(float),
+        input_offset() * sizeof(float), zero.data(),
+        nullptr);
+
+      // Verify results.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(
+              output_ref[x * channels() + c],
+              output[x * output_stride() + c],
+              std::abs(output_ref[x * channels() + c]) * 1.0e-5)
+            << "x = " << x << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void Test(xnn_f32_dwconv_minmax_multipass_ukernel_function dwconv_minmax, Variant variant = Variant::Native) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 1.0f), rng);
+
+    std::vector<const float*> indirection((width() - 1) * step() + tiled_kr());
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) + indirection.size() * channels());
+    std::vector<float> kernel(channels() * kr());
+    std::vector<float> bias(channels());
+    std::vector<float, AlignedAllocator<float, 64>> packed_weights((tiled_kr() + 1) * packed_channels());
+    std::vector<float, AlignedAllocator<float, 64>> buffer(packed_channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> zero(channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> output((width() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(width() * channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(f32rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+      std::fill(zero.begin(), zero.end(), 0.0f);
+      std::fill(output_ref.begin(), output_ref.end(), nanf(""));
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      std::fill(packed_weights.begin(), packed_weights.end(), 0.0f);
+      xnn_pack_f32_dwconv_ghw_w(
+        primary_tile(), incremental_tile(), kr(), 1, channels(), cr(),
+        kernel.data(), bias.data(), packed_weights.data(), 0, nullptr);
+      for (size_t i = 0; i < indirection.size(); i++) {
+        indirection[i] = input.data() + i * channels() - input_offset();
+      }
+      std::shuffle(indirection.begin(), indirection.end(), rng);
+      if (zero_index() != SIZE_MAX) {
+        for (size_t x = 0; x < width(); x++) {
+          indirection[x * step() + zero_index()] = zero.data();
+        }
+      }
+
+      // Compute reference results, without clamping.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          float acc = bias[c];
+          for (size_t k = 0; k < kr(); k++) {
+            if (indirection[x * step() + k] != zero.data()) {
+              acc += indirection[x * step() + k][c + input_offset()] * kernel[c * kr() + k];
+            }
+          }
+          output_ref[x * channels() + c] = acc;
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = accumulated_min + accumulated_range / 255.0f * float(qmin());
+      const float output_max = accumulated_max - accumulated_range / 255.0f * float(255 - qmax());
+
+      // Prepare parameters.
+      xnn_f32_minmax_params params = { };
+      switch (variant) {
+        case Variant::Native:
+          params = xnn_init_f32_minmax_params(output_min, output_max);
+          break;
+        case Variant::Scalar:
+          params = xnn_init_scalar_f32_minmax_params(output_min, output_max);
+          break;
+      }
+
+      // Clamp reference results.
+      for (float& output_val : output_ref) {
+        output_val = std::max(std::min(output_val, output_max), output_min);
+      }
+
+      // Call optimized micro-kernel.
+      dwconv_minmax(
+        channels(), width(), kr(),
+        indirection.data(), packed_weights.data(), buffer.data(), output.data(),
+        step() * sizeof(void*),
+        (output_stride() - channels()) * sizeof(float),
+        input_offset() * sizeof(float), zero.data(),
+        &params);
+
+      // Verify results.
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_GE(output[x * output_stride() + c], output_min)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_LE(output[x * output_stride() + c], output_max)
+            << "x = " << x << ", channel = " << c;
+          ASSERT_NEAR(
+              output_ref[x * channels() + c],
+              output[x * output_stride() + c],
+              std::abs(output_ref[x * channels() + c]) * 1.0e-5)
+            << "x = " << x << ", channel = " << c;
+        }
+      }
+    }
+  }
+
  private:
   uint32_t channels_{1};
   uint32_t cr_{1};
   uint32_t kr_{1};
+  uint32_t primary_tile_{1};
+  uint32_t incremental_tile_{0};
   uint32_t width_{1};
   uint32_t step_{1};
   uint32_t output_stride_{0};
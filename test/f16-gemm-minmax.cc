@@ -6860,3 +6860,2127 @@
       .Test(xnn_f16_gemm_minmax_ukernel_8x8__aarch64_neonfp16arith_ld64);
   }
 #endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .cn_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(8)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_gt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(8)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(8)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_div_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(8)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, n_div_8_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(11)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .qmin(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .qmax(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_1X8__FMA3_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .cm_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x8__fma3_broadcast);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .cn_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 4; m++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(8)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(8)
+        .k(k)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_gt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(8)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(8)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_div_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(8)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, n_div_8_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(11)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .qmin(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .qmax(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_4X8__FMA3_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .cm_stride(11)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x8__fma3_broadcast);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .cn_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(16)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(16)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(16)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, n_div_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .qmin(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .qmax(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_1X16__FMA3_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .cm_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_1x16__fma3_broadcast);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(3)
+      .n(16)
+      .k(1)
+      .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(3)
+      .n(16)
+      .k(1)
+      .cn_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(3)
+      .n(16)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 3; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 3; m++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(3)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(3)
+        .n(16)
+        .k(k)
+        .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(3)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 3; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(3)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(3)
+          .n(16)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(3)
+          .n(16)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(3)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 3; m++) {
+          GemmMicrokernelTester()
+            .mr(3)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(3)
+          .n(16)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(3)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(3)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, n_div_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 3; m++) {
+          GemmMicrokernelTester()
+            .mr(3)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 3; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(3)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(3)
+      .n(16)
+      .k(1)
+      .qmin(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(3)
+      .n(16)
+      .k(1)
+      .qmax(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_3X16__FMA3_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(3)
+      .n(16)
+      .k(1)
+      .cm_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_3x16__fma3_broadcast);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(1)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(1)
+      .cn_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 4; m++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(16)
+        .k(k)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, n_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(16)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(16)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, n_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(16)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, n_div_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(1)
+      .qmin(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(1)
+      .qmax(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_4X16__FMA3_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(1)
+      .cm_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_4x16__fma3_broadcast);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .cn_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 5; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 5; m++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(16)
+        .k(k)
+        .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, n_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(16)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(16)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, n_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(16)
+          .k(k)
+          .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, n_div_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .qmin(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .qmax(128)
+      .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+  }
+
+  TEST(F16_GEMM_MINMAX_5X16__FMA3_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .cm_stride(19)
+      .Test(xnn_f16_gemm_minmax_ukernel_5x16__fma3_broadcast);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
@@ -0,0 +1,1518 @@
+// Copyright (c) Facebook, Inc. and its affiliates.
+// All rights reserved.
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f32-dwconv-hswish.yaml
+//   Generator: tools/generate-dwconv-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/dwconv.h>
+#include "dwconv-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_HSWISH_UP8X4__SSE, c_eq_8) {
+    TEST_REQUIRES_X86_SSE;
+    DWConvMicrokernelTester()
+      .cr(8)
+      .kr(4)
+      .channels(8)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up8x4__sse);
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X4__SSE, c_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x4__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X4__SSE, c_lt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 1; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x4__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X4__SSE, c_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x4__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X4__SSE, multipixel) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(4)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x4__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X4__SSE, multipixel_with_step) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 4; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(4)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up8x4__sse);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X4__SSE, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(4)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x4__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X4__SSE, input_offset) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(4)
+        .channels(channels)
+        .input_offset(176)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x4__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X4__SSE, zero) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t mz = 0; mz < 4; mz++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(4)
+          .channels(channels)
+          .input_offset(176)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up8x4__sse);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_HSWISH_UP8X9__SSE, c_eq_8) {
+    TEST_REQUIRES_X86_SSE;
+    DWConvMicrokernelTester()
+      .cr(8)
+      .kr(9)
+      .channels(8)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up8x9__sse);
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X9__SSE, c_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X9__SSE, c_lt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 1; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X9__SSE, c_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X9__SSE, multipixel) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X9__SSE, multipixel_with_step) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 9; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(9)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up8x9__sse);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X9__SSE, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X9__SSE, input_offset) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .input_offset(176)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x9__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X9__SSE, zero) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t mz = 0; mz < 9; mz++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(9)
+          .channels(channels)
+          .input_offset(176)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up8x9__sse);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_HSWISH_UP8X25__SSE, c_eq_8) {
+    TEST_REQUIRES_X86_SSE;
+    DWConvMicrokernelTester()
+      .cr(8)
+      .kr(25)
+      .channels(8)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__sse);
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__SSE, c_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__SSE, c_lt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 1; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__SSE, c_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__SSE, multipixel) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__SSE, multipixel_with_step) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 25; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(25)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__sse);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__SSE, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__SSE, input_offset) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .input_offset(176)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__SSE, zero) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t mz = 0; mz < 25; mz++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(25)
+          .channels(channels)
+          .input_offset(176)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__sse);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_HSWISH_UP16X4__AVX, c_eq_16) {
+    TEST_REQUIRES_X86_AVX;
+    DWConvMicrokernelTester()
+      .cr(16)
+      .kr(4)
+      .channels(16)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__avx);
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__AVX, c_div_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 32; channels < 256; channels += 48) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__AVX, c_lt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 1; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__AVX, c_gt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 17; channels < 32; channels++) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__AVX, multipixel) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(4)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__AVX, multipixel_with_step) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      for (size_t step = 2; step <= 4; step++) {
+        DWConvMicrokernelTester()
+          .cr(16)
+          .kr(4)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__avx);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__AVX, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(4)
+        .channels(16)
+        .width(5)
+        .output_stride(83)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__AVX, input_offset) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 32; channels < 256; channels += 48) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(4)
+        .channels(channels)
+        .input_offset(304)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__AVX, zero) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t mz = 0; mz < 4; mz++) {
+      for (uint32_t channels = 32; channels < 256; channels += 48) {
+        DWConvMicrokernelTester()
+          .cr(16)
+          .kr(4)
+          .channels(channels)
+          .input_offset(304)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__avx);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_HSWISH_UP16X9__AVX, c_eq_16) {
+    TEST_REQUIRES_X86_AVX;
+    DWConvMicrokernelTester()
+      .cr(16)
+      .kr(9)
+      .channels(16)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__avx);
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__AVX, c_div_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 32; channels < 256; channels += 48) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__AVX, c_lt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 1; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__AVX, c_gt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 17; channels < 32; channels++) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__AVX, multipixel) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__AVX, multipixel_with_step) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      for (size_t step = 2; step <= 9; step++) {
+        DWConvMicrokernelTester()
+          .cr(16)
+          .kr(9)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__avx);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__AVX, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(9)
+        .channels(16)
+        .width(5)
+        .output_stride(83)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__AVX, input_offset) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 32; channels < 256; channels += 48) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(9)
+        .channels(channels)
+        .input_offset(304)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__AVX, zero) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t mz = 0; mz < 9; mz++) {
+      for (uint32_t channels = 32; channels < 256; channels += 48) {
+        DWConvMicrokernelTester()
+          .cr(16)
+          .kr(9)
+          .channels(channels)
+          .input_offset(304)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__avx);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_HSWISH_UP8X25__AVX, c_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    DWConvMicrokernelTester()
+      .cr(8)
+      .kr(25)
+      .channels(8)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__avx);
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__AVX, c_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__AVX, c_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 1; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__AVX, c_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__AVX, multipixel) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__AVX, multipixel_with_step) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 25; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(25)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__avx);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__AVX, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__AVX, input_offset) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .input_offset(176)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__avx);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__AVX, zero) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t mz = 0; mz < 25; mz++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(25)
+          .channels(channels)
+          .input_offset(176)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__avx);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_HSWISH_UP16X4__FMA3, c_eq_16) {
+    TEST_REQUIRES_X86_FMA3;
+    DWConvMicrokernelTester()
+      .cr(16)
+      .kr(4)
+      .channels(16)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__fma3);
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__FMA3, c_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t channels = 32; channels < 256; channels += 48) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__FMA3, c_lt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t channels = 1; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__FMA3, c_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t channels = 17; channels < 32; channels++) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__FMA3, multipixel) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(4)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__FMA3, multipixel_with_step) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      for (size_t step = 2; step <= 4; step++) {
+        DWConvMicrokernelTester()
+          .cr(16)
+          .kr(4)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__fma3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__FMA3, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(4)
+        .channels(16)
+        .width(5)
+        .output_stride(83)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__FMA3, input_offset) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t channels = 32; channels < 256; channels += 48) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(4)
+        .channels(channels)
+        .input_offset(304)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X4__FMA3, zero) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t mz = 0; mz < 4; mz++) {
+      for (uint32_t channels = 32; channels < 256; channels += 48) {
+        DWConvMicrokernelTester()
+          .cr(16)
+          .kr(4)
+          .channels(channels)
+          .input_offset(304)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up16x4__fma3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_HSWISH_UP16X9__FMA3, c_eq_16) {
+    TEST_REQUIRES_X86_FMA3;
+    DWConvMicrokernelTester()
+      .cr(16)
+      .kr(9)
+      .channels(16)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__fma3);
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__FMA3, c_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t channels = 32; channels < 256; channels += 48) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__FMA3, c_lt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t channels = 1; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__FMA3, c_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t channels = 17; channels < 32; channels++) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__FMA3, multipixel) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__FMA3, multipixel_with_step) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      for (size_t step = 2; step <= 9; step++) {
+        DWConvMicrokernelTester()
+          .cr(16)
+          .kr(9)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__fma3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__FMA3, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t channels = 1; channels <= 80; channels += 15) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(9)
+        .channels(16)
+        .width(5)
+        .output_stride(83)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__FMA3, input_offset) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t channels = 32; channels < 256; channels += 48) {
+      DWConvMicrokernelTester()
+        .cr(16)
+        .kr(9)
+        .channels(channels)
+        .input_offset(304)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP16X9__FMA3, zero) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t mz = 0; mz < 9; mz++) {
+      for (uint32_t channels = 32; channels < 256; channels += 48) {
+        DWConvMicrokernelTester()
+          .cr(16)
+          .kr(9)
+          .channels(channels)
+          .input_offset(304)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up16x9__fma3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_HSWISH_UP8X25__FMA3, c_eq_8) {
+    TEST_REQUIRES_X86_FMA3;
+    DWConvMicrokernelTester()
+      .cr(8)
+      .kr(25)
+      .channels(8)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__fma3);
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__FMA3, c_div_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__FMA3, c_lt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t channels = 1; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__FMA3, c_gt_8) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__FMA3, multipixel) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__FMA3, multipixel_with_step) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 25; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(25)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__fma3);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__FMA3, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__FMA3, input_offset) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(25)
+        .channels(channels)
+        .input_offset(176)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__fma3);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP8X25__FMA3, zero) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t mz = 0; mz < 25; mz++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(25)
+          .channels(channels)
+          .input_offset(176)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up8x25__fma3);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+  TEST(F32_DWCONV_HSWISH_UP1X4__WASM_ACC2, c_eq_1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(4)
+      .channels(1)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__wasm_acc2);
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X4__WASM_ACC2, c_gt_1) {
+    for (uint32_t channels = 2; channels < 10; channels++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(4)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__wasm_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X4__WASM_ACC2, multipixel) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(4)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__wasm_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X4__WASM_ACC2, multipixel_with_step) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      for (size_t step = 2; step <= 4; step++) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .kr(4)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__wasm_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X4__WASM_ACC2, multipixel_with_output_stride) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(4)
+        .channels(1)
+        .width(5)
+        .output_stride(7)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__wasm_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X4__WASM_ACC2, input_offset) {
+    for (uint32_t channels = 2; channels < 16; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(4)
+        .channels(channels)
+        .input_offset(48)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__wasm_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X4__WASM_ACC2, zero) {
+    for (uint32_t mz = 0; mz < 4; mz++) {
+      for (uint32_t channels = 2; channels < 16; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .kr(4)
+          .channels(channels)
+          .input_offset(48)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__wasm_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+
+
+#if XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+  TEST(F32_DWCONV_HSWISH_UP1X9__WASM_ACC2, c_eq_1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(1)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__wasm_acc2);
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X9__WASM_ACC2, c_gt_1) {
+    for (uint32_t channels = 2; channels < 10; channels++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(9)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__wasm_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X9__WASM_ACC2, multipixel) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__wasm_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X9__WASM_ACC2, multipixel_with_step) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      for (size_t step = 2; step <= 9; step++) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .kr(9)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__wasm_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X9__WASM_ACC2, multipixel_with_output_stride) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(9)
+        .channels(1)
+        .width(5)
+        .output_stride(7)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__wasm_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X9__WASM_ACC2, input_offset) {
+    for (uint32_t channels = 2; channels < 16; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(9)
+        .channels(channels)
+        .input_offset(48)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__wasm_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X9__WASM_ACC2, zero) {
+    for (uint32_t mz = 0; mz < 9; mz++) {
+      for (uint32_t channels = 2; channels < 16; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .kr(9)
+          .channels(channels)
+          .input_offset(48)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__wasm_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+
+
+#if XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+  TEST(F32_DWCONV_HSWISH_UP1X25__WASM_ACC2, c_eq_1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(25)
+      .channels(1)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__wasm_acc2);
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X25__WASM_ACC2, c_gt_1) {
+    for (uint32_t channels = 2; channels < 10; channels++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(25)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__wasm_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X25__WASM_ACC2, multipixel) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(25)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__wasm_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X25__WASM_ACC2, multipixel_with_step) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      for (size_t step = 2; step <= 25; step++) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .kr(25)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__wasm_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X25__WASM_ACC2, multipixel_with_output_stride) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(25)
+        .channels(1)
+        .width(5)
+        .output_stride(7)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__wasm_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X25__WASM_ACC2, input_offset) {
+    for (uint32_t channels = 2; channels < 16; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(25)
+        .channels(channels)
+        .input_offset(48)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__wasm_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_HSWISH_UP1X25__WASM_ACC2, zero) {
+    for (uint32_t mz = 0; mz < 25; mz++) {
+      for (uint32_t channels = 2; channels < 16; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .kr(25)
+          .channels(channels)
+          .input_offset(48)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__wasm_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+
+
+TEST(F32_DWCONV_HSWISH_UP1X4__SCALAR_ACC2, c_eq_1) {
+  DWConvMicrokernelTester()
+    .cr(1)
+    .kr(4)
+    .channels(1)
+    .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X4__SCALAR_ACC2, c_gt_1) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(4)
+      .channels(channels)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X4__SCALAR_ACC2, multipixel) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(4)
+      .channels(channels)
+      .width(3)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X4__SCALAR_ACC2, multipixel_with_step) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    for (size_t step = 2; step <= 4; step++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(4)
+        .channels(channels)
+        .width(3)
+        .step(step)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X4__SCALAR_ACC2, multipixel_with_output_stride) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(4)
+      .channels(1)
+      .width(5)
+      .output_stride(7)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X4__SCALAR_ACC2, input_offset) {
+  for (uint32_t channels = 2; channels < 16; channels += 3) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(4)
+      .channels(channels)
+      .input_offset(48)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X4__SCALAR_ACC2, zero) {
+  for (uint32_t mz = 0; mz < 4; mz++) {
+    for (uint32_t channels = 2; channels < 16; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(4)
+        .channels(channels)
+        .input_offset(48)
+        .zero_index(mz)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x4__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X9__SCALAR_ACC2, c_eq_1) {
+  DWConvMicrokernelTester()
+    .cr(1)
+    .kr(9)
+    .channels(1)
+    .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X9__SCALAR_ACC2, c_gt_1) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X9__SCALAR_ACC2, multipixel) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .width(3)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X9__SCALAR_ACC2, multipixel_with_step) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    for (size_t step = 2; step <= 9; step++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .step(step)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X9__SCALAR_ACC2, multipixel_with_output_stride) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(1)
+      .width(5)
+      .output_stride(7)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X9__SCALAR_ACC2, input_offset) {
+  for (uint32_t channels = 2; channels < 16; channels += 3) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(9)
+      .channels(channels)
+      .input_offset(48)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X9__SCALAR_ACC2, zero) {
+  for (uint32_t mz = 0; mz < 9; mz++) {
+    for (uint32_t channels = 2; channels < 16; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(9)
+        .channels(channels)
+        .input_offset(48)
+        .zero_index(mz)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x9__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X25__SCALAR_ACC2, c_eq_1) {
+  DWConvMicrokernelTester()
+    .cr(1)
+    .kr(25)
+    .channels(1)
+    .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X25__SCALAR_ACC2, c_gt_1) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(25)
+      .channels(channels)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X25__SCALAR_ACC2, multipixel) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(25)
+      .channels(channels)
+      .width(3)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X25__SCALAR_ACC2, multipixel_with_step) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    for (size_t step = 2; step <= 25; step++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(25)
+        .channels(channels)
+        .width(3)
+        .step(step)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X25__SCALAR_ACC2, multipixel_with_output_stride) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(25)
+      .channels(1)
+      .width(5)
+      .output_stride(7)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X25__SCALAR_ACC2, input_offset) {
+  for (uint32_t channels = 2; channels < 16; channels += 3) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .kr(25)
+      .channels(channels)
+      .input_offset(48)
+      .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_HSWISH_UP1X25__SCALAR_ACC2, zero) {
+  for (uint32_t mz = 0; mz < 25; mz++) {
+    for (uint32_t channels = 2; channels < 16; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .kr(25)
+        .channels(channels)
+        .input_offset(48)
+        .zero_index(mz)
+        .Test(xnn_f32_dwconv_hswish_ukernel_up1x25__scalar_acc2, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
\ No newline at end of file
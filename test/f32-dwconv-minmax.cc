@@ -1889,6 +1889,204 @@
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEONFMA, c_eq_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(kernel_size)
+        .channels(4)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEONFMA, c_div_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 8; channels < 64; channels += 12) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEONFMA, c_lt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 1; channels < 4; channels++) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEONFMA, c_gt_4) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 5; channels < 8; channels++) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEONFMA, c_gt_4_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEONFMA, c_gt_4_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEONFMA, multipixel) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size += 7) {
+      for (size_t channels = 1; channels <= 20; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .width(3)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEONFMA, multipixel_with_step) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      for (size_t step = 2; step <= 18; step++) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEONFMA, multipixel_with_output_stride) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(4)
+        .width(5)
+        .output_stride(23)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEONFMA, multipixel_with_qmin) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEONFMA, multipixel_with_qmax) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEONFMA, input_offset) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .input_offset(112)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEONFMA, zero) {
+    TEST_REQUIRES_ARM_NEON_FMA;
+    for (uint32_t mz = 0; mz < 18; mz++) {
+      for (uint32_t channels = 8; channels < 64; channels += 12) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .input_offset(112)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neonfma);
+      }
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
   TEST(F32_DWCONV_MINMAX_UP4X4__NEONFMA, c_eq_4) {
     TEST_REQUIRES_ARM_NEON_FMA;
@@ -4121,6 +4319,204 @@
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEON, c_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(kernel_size)
+        .channels(4)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEON, c_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 8; channels < 64; channels += 12) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEON, c_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 1; channels < 4; channels++) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEON, c_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 5; channels < 8; channels++) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEON, c_gt_4_with_qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEON, c_gt_4_with_qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEON, multipixel) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size += 7) {
+      for (size_t channels = 1; channels <= 20; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .width(3)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEON, multipixel_with_step) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      for (size_t step = 2; step <= 18; step++) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEON, multipixel_with_output_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(4)
+        .width(5)
+        .output_stride(23)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEON, multipixel_with_qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEON, multipixel_with_qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEON, input_offset) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .input_offset(112)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__NEON, zero) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t mz = 0; mz < 18; mz++) {
+      for (uint32_t channels = 8; channels < 64; channels += 12) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .input_offset(112)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__neon);
+      }
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
   TEST(F32_DWCONV_MINMAX_UP4X4__NEON, c_eq_4) {
     TEST_REQUIRES_ARM_NEON;
@@ -6254,99 +6650,297 @@
         .kr(9)
         .channels(channels)
         .qmax(128)
-        .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+        .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, multipixel) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, multipixel_with_step) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 9; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(9)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, multipixel_with_qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, multipixel_with_qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, input_offset) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .kr(9)
+        .channels(channels)
+        .input_offset(176)
+        .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, zero) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t mz = 0; mz < 9; mz++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .kr(9)
+          .channels(channels)
+          .input_offset(176)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__SSE, c_eq_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(kernel_size)
+        .channels(4)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__SSE, c_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 8; channels < 64; channels += 12) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__SSE, c_lt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 1; channels < 4; channels++) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__SSE, c_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 5; channels < 8; channels++) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__SSE, c_gt_4_with_qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__SSE, c_gt_4_with_qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t channels = 5; channels < 8; channels++) {
+      DWConvMicrokernelTester()
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse);
     }
   }
 
-  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, multipixel) {
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__SSE, multipixel) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t channels = 1; channels <= 40; channels += 7) {
-      DWConvMicrokernelTester()
-        .cr(8)
-        .kr(9)
-        .channels(channels)
-        .width(3)
-        .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size += 7) {
+      for (size_t channels = 1; channels <= 20; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .width(3)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse);
+      }
     }
   }
 
-  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, multipixel_with_step) {
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__SSE, multipixel_with_step) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t channels = 1; channels <= 40; channels += 7) {
-      for (size_t step = 2; step <= 9; step++) {
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      for (size_t step = 2; step <= 18; step++) {
         DWConvMicrokernelTester()
-          .cr(8)
-          .kr(9)
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
           .channels(channels)
           .width(3)
           .step(step)
-          .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse);
       }
     }
   }
 
-  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, multipixel_with_output_stride) {
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__SSE, multipixel_with_output_stride) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t channels = 1; channels <= 40; channels += 7) {
+    for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
-        .cr(8)
-        .kr(9)
-        .channels(8)
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(4)
         .width(5)
-        .output_stride(43)
-        .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+        .output_stride(23)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse);
     }
   }
 
-  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, multipixel_with_qmin) {
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__SSE, multipixel_with_qmin) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t channels = 1; channels <= 40; channels += 7) {
+    for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
-        .cr(8)
-        .kr(9)
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
         .channels(channels)
         .width(3)
         .qmin(128)
-        .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse);
     }
   }
 
-  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, multipixel_with_qmax) {
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__SSE, multipixel_with_qmax) {
     TEST_REQUIRES_X86_SSE;
-    for (size_t channels = 1; channels <= 40; channels += 7) {
+    for (size_t channels = 1; channels <= 20; channels += 3) {
       DWConvMicrokernelTester()
-        .cr(8)
-        .kr(9)
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
         .channels(channels)
         .width(3)
         .qmax(128)
-        .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse);
     }
   }
 
-  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, input_offset) {
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__SSE, input_offset) {
     TEST_REQUIRES_X86_SSE;
-    for (uint32_t channels = 16; channels < 128; channels += 24) {
+    for (uint32_t channels = 8; channels < 64; channels += 12) {
       DWConvMicrokernelTester()
-        .cr(8)
-        .kr(9)
+        .cr(4)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
         .channels(channels)
-        .input_offset(176)
-        .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+        .input_offset(112)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse);
     }
   }
 
-  TEST(F32_DWCONV_MINMAX_UP8X9__SSE_ACC2, zero) {
+  TEST(F32_DWCONV_MINMAX_MP4X9P8__SSE, zero) {
     TEST_REQUIRES_X86_SSE;
-    for (uint32_t mz = 0; mz < 9; mz++) {
-      for (uint32_t channels = 16; channels < 128; channels += 24) {
+    for (uint32_t mz = 0; mz < 18; mz++) {
+      for (uint32_t channels = 8; channels < 64; channels += 12) {
         DWConvMicrokernelTester()
-          .cr(8)
-          .kr(9)
+          .cr(4)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
           .channels(channels)
-          .input_offset(176)
+          .input_offset(112)
           .zero_index(mz)
-          .Test(xnn_f32_dwconv_minmax_ukernel_up8x9__sse_acc2);
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp4x9p8__sse);
       }
     }
   }
@@ -19097,6 +19691,163 @@
 #endif  // XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
 
 
+#if XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+  TEST(F32_DWCONV_MINMAX_MP1X9P8__WASM, c_eq_1) {
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(kernel_size)
+        .channels(1)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP1X9P8__WASM, c_gt_1) {
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 2; channels < 10; channels++) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP1X9P8__WASM, c_gt_1_with_qmin) {
+    for (uint32_t channels = 2; channels < 10; channels++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP1X9P8__WASM, c_gt_1_with_qmax) {
+    for (uint32_t channels = 2; channels < 10; channels++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP1X9P8__WASM, multipixel) {
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size += 7) {
+      for (size_t channels = 1; channels <= 5; channels += 1) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .width(3)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP1X9P8__WASM, multipixel_with_step) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      for (size_t step = 2; step <= 18; step++) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP1X9P8__WASM, multipixel_with_output_stride) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(1)
+        .width(5)
+        .output_stride(7)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP1X9P8__WASM, multipixel_with_qmin) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP1X9P8__WASM, multipixel_with_qmax) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP1X9P8__WASM, input_offset) {
+    for (uint32_t channels = 2; channels < 16; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .input_offset(48)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm);
+    }
+  }
+
+  TEST(F32_DWCONV_MINMAX_MP1X9P8__WASM, zero) {
+    for (uint32_t mz = 0; mz < 18; mz++) {
+      for (uint32_t channels = 2; channels < 16; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .input_offset(48)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__wasm);
+      }
+    }
+  }
+#endif  // XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+
+
 #if XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
   TEST(F32_DWCONV_MINMAX_UP1X25__WASM, c_eq_1) {
     DWConvMicrokernelTester()
@@ -20873,6 +21624,160 @@ TEST(F32_DWCONV_MINMAX_UP2X9__SCALAR_ACC2, zero) {
   }
 }
 
+TEST(F32_DWCONV_MINMAX_MP1X9P8__SCALAR, c_eq_1) {
+  for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .primary_tile(9)
+      .incremental_tile(8)
+      .kr(kernel_size)
+      .channels(1)
+      .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MINMAX_MP1X9P8__SCALAR, c_gt_1) {
+  for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+    for (uint32_t channels = 2; channels < 10; channels++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(kernel_size)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__scalar, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_MINMAX_MP1X9P8__SCALAR, c_gt_1_with_qmin) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .primary_tile(9)
+      .incremental_tile(8)
+      .kr(18)
+      .channels(channels)
+      .qmin(128)
+      .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MINMAX_MP1X9P8__SCALAR, c_gt_1_with_qmax) {
+  for (uint32_t channels = 2; channels < 10; channels++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .primary_tile(9)
+      .incremental_tile(8)
+      .kr(18)
+      .channels(channels)
+      .qmax(128)
+      .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MINMAX_MP1X9P8__SCALAR, multipixel) {
+  for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size += 7) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(kernel_size)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__scalar, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_MINMAX_MP1X9P8__SCALAR, multipixel_with_step) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    for (size_t step = 2; step <= 18; step++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .step(step)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__scalar, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_MINMAX_MP1X9P8__SCALAR, multipixel_with_output_stride) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .primary_tile(9)
+      .incremental_tile(8)
+      .kr(18)
+      .channels(1)
+      .width(5)
+      .output_stride(7)
+      .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MINMAX_MP1X9P8__SCALAR, multipixel_with_qmin) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .primary_tile(9)
+      .incremental_tile(8)
+      .kr(18)
+      .channels(channels)
+      .width(3)
+      .qmin(128)
+      .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MINMAX_MP1X9P8__SCALAR, multipixel_with_qmax) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .primary_tile(9)
+      .incremental_tile(8)
+      .kr(18)
+      .channels(channels)
+      .width(3)
+      .qmax(128)
+      .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MINMAX_MP1X9P8__SCALAR, input_offset) {
+  for (uint32_t channels = 2; channels < 16; channels += 3) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .primary_tile(9)
+      .incremental_tile(8)
+      .kr(18)
+      .channels(channels)
+      .input_offset(48)
+      .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__scalar, DWConvMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_DWCONV_MINMAX_MP1X9P8__SCALAR, zero) {
+  for (uint32_t mz = 0; mz < 18; mz++) {
+    for (uint32_t channels = 2; channels < 16; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .input_offset(48)
+        .zero_index(mz)
+        .Test(xnn_f32_dwconv_minmax_ukernel_mp1x9p8__scalar, DWConvMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
 TEST(F32_DWCONV_MINMAX_UP1X25__SCALAR, c_eq_1) {
   DWConvMicrokernelTester()
     .cr(1)
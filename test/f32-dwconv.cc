@@ -1382,6 +1382,109 @@
 #endif  // XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
 
 
+#if XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+  TEST(F32_DWCONV_MP1X9P8__WASM, c_eq_1) {
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(kernel_size)
+        .channels(1)
+        .Test(xnn_f32_dwconv_ukernel_mp1x9p8__wasm);
+    }
+  }
+
+  TEST(F32_DWCONV_MP1X9P8__WASM, c_gt_1) {
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 2; channels < 10; channels++) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_f32_dwconv_ukernel_mp1x9p8__wasm);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP1X9P8__WASM, multipixel) {
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size += 7) {
+      for (size_t channels = 1; channels <= 5; channels += 1) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .width(3)
+          .Test(xnn_f32_dwconv_ukernel_mp1x9p8__wasm);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP1X9P8__WASM, multipixel_with_step) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      for (size_t step = 2; step <= 18; step++) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_f32_dwconv_ukernel_mp1x9p8__wasm);
+      }
+    }
+  }
+
+  TEST(F32_DWCONV_MP1X9P8__WASM, multipixel_with_output_stride) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(1)
+        .width(5)
+        .output_stride(7)
+        .Test(xnn_f32_dwconv_ukernel_mp1x9p8__wasm);
+    }
+  }
+
+  TEST(F32_DWCONV_MP1X9P8__WASM, input_offset) {
+    for (uint32_t channels = 2; channels < 16; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .input_offset(48)
+        .Test(xnn_f32_dwconv_ukernel_mp1x9p8__wasm);
+    }
+  }
+
+  TEST(F32_DWCONV_MP1X9P8__WASM, zero) {
+    for (uint32_t mz = 0; mz < 18; mz++) {
+      for (uint32_t channels = 2; channels < 16; channels += 3) {
+        DWConvMicrokernelTester()
+          .cr(1)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .input_offset(48)
+          .zero_index(mz)
+          .Test(xnn_f32_dwconv_ukernel_mp1x9p8__wasm);
+      }
+    }
+  }
+#endif  // XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+
+
 #if XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
   TEST(F32_DWCONV_UP1X25__WASM, c_eq_1) {
     DWConvMicrokernelTester()
@@ -2474,6 +2577,106 @@ TEST(F32_DWCONV_UP2X9__SCALAR_ACC2, zero) {
   }
 }
 
+TEST(F32_DWCONV_MP1X9P8__SCALAR, c_eq_1) {
+  for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .primary_tile(9)
+      .incremental_tile(8)
+      .kr(kernel_size)
+      .channels(1)
+      .Test(xnn_f32_dwconv_ukernel_mp1x9p8__scalar);
+  }
+}
+
+TEST(F32_DWCONV_MP1X9P8__SCALAR, c_gt_1) {
+  for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+    for (uint32_t channels = 2; channels < 10; channels++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(kernel_size)
+        .channels(channels)
+        .Test(xnn_f32_dwconv_ukernel_mp1x9p8__scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_MP1X9P8__SCALAR, multipixel) {
+  for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size += 7) {
+    for (size_t channels = 1; channels <= 5; channels += 1) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(kernel_size)
+        .channels(channels)
+        .width(3)
+        .Test(xnn_f32_dwconv_ukernel_mp1x9p8__scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_MP1X9P8__SCALAR, multipixel_with_step) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    for (size_t step = 2; step <= 18; step++) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .step(step)
+        .Test(xnn_f32_dwconv_ukernel_mp1x9p8__scalar);
+    }
+  }
+}
+
+TEST(F32_DWCONV_MP1X9P8__SCALAR, multipixel_with_output_stride) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .primary_tile(9)
+      .incremental_tile(8)
+      .kr(18)
+      .channels(1)
+      .width(5)
+      .output_stride(7)
+      .Test(xnn_f32_dwconv_ukernel_mp1x9p8__scalar);
+  }
+}
+
+TEST(F32_DWCONV_MP1X9P8__SCALAR, input_offset) {
+  for (uint32_t channels = 2; channels < 16; channels += 3) {
+    DWConvMicrokernelTester()
+      .cr(1)
+      .primary_tile(9)
+      .incremental_tile(8)
+      .kr(18)
+      .channels(channels)
+      .input_offset(48)
+      .Test(xnn_f32_dwconv_ukernel_mp1x9p8__scalar);
+  }
+}
+
+TEST(F32_DWCONV_MP1X9P8__SCALAR, zero) {
+  for (uint32_t mz = 0; mz < 18; mz++) {
+    for (uint32_t channels = 2; channels < 16; channels += 3) {
+      DWConvMicrokernelTester()
+        .cr(1)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .input_offset(48)
+        .zero_index(mz)
+        .Test(xnn_f32_dwconv_ukernel_mp1x9p8__scalar);
+    }
+  }
+}
+
 TEST(F32_DWCONV_UP1X25__SCALAR, c_eq_1) {
   DWConvMicrokernelTester()
     .cr(1)
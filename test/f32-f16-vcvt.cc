@@ -0,0 +1,649 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f32-f16-vcvt.yaml
+//   Generator: tools/generate-vcvt-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/vcvt.h>
+#include "vcvt-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_F16_VCVT__NEON_X8, batch_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    VCvtMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_f16_vcvt_ukernel__neon_x8);
+  }
+
+  TEST(F32_F16_VCVT__NEON_X8, batch_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__neon_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__NEON_X8, batch_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__neon_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__NEON_X8, batch_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__neon_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__NEON_X8, large_inputs) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100000.0f)
+        .input_max(100000.0f)
+        .Test(xnn_f32_f16_vcvt_ukernel__neon_x8);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_F16_VCVT__NEON_X16, batch_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    VCvtMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_f16_vcvt_ukernel__neon_x16);
+  }
+
+  TEST(F32_F16_VCVT__NEON_X16, batch_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__neon_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__NEON_X16, batch_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__neon_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__NEON_X16, batch_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__neon_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__NEON_X16, large_inputs) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100000.0f)
+        .input_max(100000.0f)
+        .Test(xnn_f32_f16_vcvt_ukernel__neon_x16);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_F16_VCVT__SSE2_X8, batch_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    VCvtMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_f16_vcvt_ukernel__sse2_x8);
+  }
+
+  TEST(F32_F16_VCVT__SSE2_X8, batch_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse2_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__SSE2_X8, batch_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse2_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__SSE2_X8, batch_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse2_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__SSE2_X8, large_inputs) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100000.0f)
+        .input_max(100000.0f)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse2_x8);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_F16_VCVT__SSE2_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE2;
+    VCvtMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_f16_vcvt_ukernel__sse2_x16);
+  }
+
+  TEST(F32_F16_VCVT__SSE2_X16, batch_div_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse2_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__SSE2_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse2_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__SSE2_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse2_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__SSE2_X16, large_inputs) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100000.0f)
+        .input_max(100000.0f)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse2_x16);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_F16_VCVT__SSE41_X8, batch_eq_8) {
+    TEST_REQUIRES_X86_SSE41;
+    VCvtMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_f16_vcvt_ukernel__sse41_x8);
+  }
+
+  TEST(F32_F16_VCVT__SSE41_X8, batch_div_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse41_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__SSE41_X8, batch_lt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse41_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__SSE41_X8, batch_gt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse41_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__SSE41_X8, large_inputs) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100000.0f)
+        .input_max(100000.0f)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse41_x8);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_F16_VCVT__SSE41_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE41;
+    VCvtMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_f16_vcvt_ukernel__sse41_x16);
+  }
+
+  TEST(F32_F16_VCVT__SSE41_X16, batch_div_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse41_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__SSE41_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse41_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__SSE41_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse41_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__SSE41_X16, large_inputs) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100000.0f)
+        .input_max(100000.0f)
+        .Test(xnn_f32_f16_vcvt_ukernel__sse41_x16);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_F16_VCVT__F16C_X8, batch_eq_8) {
+    TEST_REQUIRES_X86_F16C;
+    VCvtMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_f16_vcvt_ukernel__f16c_x8);
+  }
+
+  TEST(F32_F16_VCVT__F16C_X8, batch_div_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__f16c_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__F16C_X8, batch_lt_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__f16c_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__F16C_X8, batch_gt_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__f16c_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__F16C_X8, large_inputs) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100000.0f)
+        .input_max(100000.0f)
+        .Test(xnn_f32_f16_vcvt_ukernel__f16c_x8);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_F16_VCVT__F16C_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_F16C;
+    VCvtMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_f16_vcvt_ukernel__f16c_x16);
+  }
+
+  TEST(F32_F16_VCVT__F16C_X16, batch_div_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__f16c_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__F16C_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__f16c_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__F16C_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__f16c_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__F16C_X16, large_inputs) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100000.0f)
+        .input_max(100000.0f)
+        .Test(xnn_f32_f16_vcvt_ukernel__f16c_x16);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_F16_VCVT__AVX512SKX_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    VCvtMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_f16_vcvt_ukernel__avx512skx_x16);
+  }
+
+  TEST(F32_F16_VCVT__AVX512SKX_X16, batch_div_16) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__avx512skx_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__AVX512SKX_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__avx512skx_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__AVX512SKX_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__avx512skx_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__AVX512SKX_X16, large_inputs) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100000.0f)
+        .input_max(100000.0f)
+        .Test(xnn_f32_f16_vcvt_ukernel__avx512skx_x16);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_F16_VCVT__AVX512SKX_X32, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    VCvtMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_f16_vcvt_ukernel__avx512skx_x32);
+  }
+
+  TEST(F32_F16_VCVT__AVX512SKX_X32, batch_div_32) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__avx512skx_x32);
+    }
+  }
+
+  TEST(F32_F16_VCVT__AVX512SKX_X32, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__avx512skx_x32);
+    }
+  }
+
+  TEST(F32_F16_VCVT__AVX512SKX_X32, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__avx512skx_x32);
+    }
+  }
+
+  TEST(F32_F16_VCVT__AVX512SKX_X32, large_inputs) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 1; batch_size <= 160; batch_size += 31) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100000.0f)
+        .input_max(100000.0f)
+        .Test(xnn_f32_f16_vcvt_ukernel__avx512skx_x32);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_WASMSIMD
+  TEST(F32_F16_VCVT__WASMSIMD_X8, batch_eq_8) {
+    VCvtMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_f16_vcvt_ukernel__wasmsimd_x8);
+  }
+
+  TEST(F32_F16_VCVT__WASMSIMD_X8, batch_div_8) {
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__wasmsimd_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__WASMSIMD_X8, batch_lt_8) {
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__wasmsimd_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__WASMSIMD_X8, batch_gt_8) {
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__wasmsimd_x8);
+    }
+  }
+
+  TEST(F32_F16_VCVT__WASMSIMD_X8, large_inputs) {
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100000.0f)
+        .input_max(100000.0f)
+        .Test(xnn_f32_f16_vcvt_ukernel__wasmsimd_x8);
+    }
+  }
+#endif  // XNN_ARCH_WASMSIMD
+
+
+#if XNN_ARCH_WASMSIMD
+  TEST(F32_F16_VCVT__WASMSIMD_X16, batch_eq_16) {
+    VCvtMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_f16_vcvt_ukernel__wasmsimd_x16);
+  }
+
+  TEST(F32_F16_VCVT__WASMSIMD_X16, batch_div_16) {
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__wasmsimd_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__WASMSIMD_X16, batch_lt_16) {
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__wasmsimd_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__WASMSIMD_X16, batch_gt_16) {
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_f16_vcvt_ukernel__wasmsimd_x16);
+    }
+  }
+
+  TEST(F32_F16_VCVT__WASMSIMD_X16, large_inputs) {
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100000.0f)
+        .input_max(100000.0f)
+        .Test(xnn_f32_f16_vcvt_ukernel__wasmsimd_x16);
+    }
+  }
+#endif  // XNN_ARCH_WASMSIMD
+
+
+TEST(F32_F16_VCVT__SCALAR_X1, batch_eq_1) {
+  VCvtMicrokernelTester()
+    .batch_size(1)
+    .Test(xnn_f32_f16_vcvt_ukernel__scalar_x1);
+}
+
+TEST(F32_F16_VCVT__SCALAR_X1, batch_gt_1) {
+  for (size_t batch_size = 2; batch_size < 10; batch_size++) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_f16_vcvt_ukernel__scalar_x1);
+  }
+}
+
+TEST(F32_F16_VCVT__SCALAR_X1, large_inputs) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .input_min(-100000.0f)
+      .input_max(100000.0f)
+      .Test(xnn_f32_f16_vcvt_ukernel__scalar_x1);
+  }
+}
+
+
+TEST(F32_F16_VCVT__SCALAR_X4, batch_eq_4) {
+  VCvtMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_f32_f16_vcvt_ukernel__scalar_x4);
+}
+
+TEST(F32_F16_VCVT__SCALAR_X4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_f16_vcvt_ukernel__scalar_x4);
+  }
+}
+
+TEST(F32_F16_VCVT__SCALAR_X4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_f16_vcvt_ukernel__scalar_x4);
+  }
+}
+
+TEST(F32_F16_VCVT__SCALAR_X4, batch_gt_4) {
+  for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_f16_vcvt_ukernel__scalar_x4);
+  }
+}
+
+TEST(F32_F16_VCVT__SCALAR_X4, large_inputs) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .input_min(-100000.0f)
+      .input_max(100000.0f)
+      .Test(xnn_f32_f16_vcvt_ukernel__scalar_x4);
+  }
+}
@@ -0,0 +1,3814 @@
+// Copyright (c) Facebook, Inc. and its affiliates.
+// All rights reserved.
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f32-gemm-hswish.yaml
+//   Generator: tools/generate-gemm-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/igemm.h>
+#include <xnnpack/ppmm.h>
+#include "gemm-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, k_eq_1) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, strided_cn) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .cn_stride(11)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(8)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, k_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, n_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(8)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(8)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, n_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(8)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, n_div_8_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, strided_cm_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(11)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X8__SSE_LOAD1, strided_cm) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(1)
+      .cm_stride(11)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x8__sse_load1);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, k_eq_1) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, strided_cn) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .cn_stride(11)
+      .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 1; m <= 4; m++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(8)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, k_gt_1) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, n_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(8)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(8)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, n_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(8)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, n_div_8_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, strided_cm_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(11)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X8__SSE_LOAD1, strided_cm) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(8)
+      .k(1)
+      .cm_stride(11)
+      .Test(xnn_f32_gemm_hswish_ukernel_4x8__sse_load1);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .cn_stride(19)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, n_gt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(16)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(16)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, n_div_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(16)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, n_div_16_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__AVX_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .cm_stride(19)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x16__avx_broadcast);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .cn_stride(19)
+      .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t m = 1; m <= 5; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t m = 1; m <= 5; m++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, n_gt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(16)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(16)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, n_div_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(16)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, n_div_16_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__AVX_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .cm_stride(19)
+      .Test(xnn_f32_gemm_hswish_ukernel_5x16__avx_broadcast);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .cn_stride(19)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, n_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(16)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(16)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, n_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(16)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, n_div_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X16__FMA3_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .cm_stride(19)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x16__fma3_broadcast);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .cn_stride(19)
+      .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 5; m++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 5; m++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(5)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(5)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, n_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(16)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(16)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, n_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(16)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(5)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(5)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, n_div_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 5; m++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 5; m++) {
+        for (uint32_t n = 1; n <= 16; n++) {
+          GemmMicrokernelTester()
+            .mr(5)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_5X16__FMA3_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(5)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(5)
+      .n(16)
+      .k(1)
+      .cm_stride(19)
+      .Test(xnn_f32_gemm_hswish_ukernel_5x16__fma3_broadcast);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+  TEST(F32_GEMM_HSWISH_1X4__WASM, k_eq_1) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, strided_cn) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(1)
+      .cn_stride(7)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, k_eq_1_strided_a) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, k_eq_1_subtile) {
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, k_eq_1_subtile_m) {
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(4)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, k_eq_1_subtile_n) {
+    for (uint32_t n = 1; n <= 4; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, k_gt_1) {
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, k_gt_1_strided_a) {
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, k_gt_1_subtile) {
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 4; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(4)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, n_gt_4) {
+    for (uint32_t n = 5; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(4)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, n_gt_4_strided_cn) {
+    for (uint32_t n = 5; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(4)
+          .k(k)
+          .cn_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, n_gt_4_strided_a) {
+    for (uint32_t n = 5; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, n_gt_4_subtile) {
+    for (uint32_t n = 5; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(4)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, n_div_4) {
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(4)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, n_div_4_strided_cn) {
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, n_div_4_strided_a) {
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, n_div_4_subtile) {
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(4)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, strided_cm_subtile) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        for (uint32_t n = 1; n <= 4; n++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(4)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(7)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_1X4__WASM, strided_cm) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(1)
+      .cm_stride(7)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x4__wasm);
+  }
+#endif  // XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+
+
+#if XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+  TEST(F32_GEMM_HSWISH_2X4__WASM, k_eq_1) {
+    GemmMicrokernelTester()
+      .mr(2)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(2)
+      .n(4)
+      .k(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, strided_cn) {
+    GemmMicrokernelTester()
+      .mr(2)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(2)
+      .n(4)
+      .k(1)
+      .cn_stride(7)
+      .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, k_eq_1_strided_a) {
+    GemmMicrokernelTester()
+      .mr(2)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(2)
+      .n(4)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, k_eq_1_subtile) {
+    for (uint32_t m = 1; m <= 2; m++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        GemmMicrokernelTester()
+          .mr(2)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, k_eq_1_subtile_m) {
+    for (uint32_t m = 1; m <= 2; m++) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(4)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, k_eq_1_subtile_n) {
+    for (uint32_t n = 1; n <= 4; n++) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(2)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, k_gt_1) {
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(2)
+        .n(4)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, k_gt_1_strided_a) {
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(2)
+        .n(4)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, k_gt_1_subtile) {
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 2; m++) {
+        for (uint32_t n = 1; n <= 4; n++) {
+          GemmMicrokernelTester()
+            .mr(2)
+            .nr(4)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, n_gt_4) {
+    for (uint32_t n = 5; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(2)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(2)
+          .n(4)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, n_gt_4_strided_cn) {
+    for (uint32_t n = 5; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(2)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(2)
+          .n(4)
+          .k(k)
+          .cn_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, n_gt_4_strided_a) {
+    for (uint32_t n = 5; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(2)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(2)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, n_gt_4_subtile) {
+    for (uint32_t n = 5; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 2; m++) {
+          GemmMicrokernelTester()
+            .mr(2)
+            .nr(4)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, n_div_4) {
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(2)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(2)
+          .n(4)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, n_div_4_strided_cn) {
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(2)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(2)
+          .n(n)
+          .k(k)
+          .cn_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, n_div_4_strided_a) {
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(2)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(2)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, n_div_4_subtile) {
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 2; m++) {
+          GemmMicrokernelTester()
+            .mr(2)
+            .nr(4)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, strided_cm_subtile) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 2; m++) {
+        for (uint32_t n = 1; n <= 4; n++) {
+          GemmMicrokernelTester()
+            .mr(2)
+            .nr(4)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(7)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_2X4__WASM, strided_cm) {
+    GemmMicrokernelTester()
+      .mr(2)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(2)
+      .n(4)
+      .k(1)
+      .cm_stride(7)
+      .Test(xnn_f32_gemm_hswish_ukernel_2x4__wasm);
+  }
+#endif  // XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+
+
+#if XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+  TEST(F32_GEMM_HSWISH_4X4__WASM, k_eq_1) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(4)
+      .k(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, strided_cn) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(4)
+      .k(1)
+      .cn_stride(7)
+      .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, k_eq_1_strided_a) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(4)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, k_eq_1_subtile) {
+    for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, k_eq_1_subtile_m) {
+    for (uint32_t m = 1; m <= 4; m++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(4)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, k_eq_1_subtile_n) {
+    for (uint32_t n = 1; n <= 4; n++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, k_gt_1) {
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(4)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, k_gt_1_strided_a) {
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(4)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, k_gt_1_subtile) {
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 4; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(4)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, n_gt_4) {
+    for (uint32_t n = 5; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(4)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, n_gt_4_strided_cn) {
+    for (uint32_t n = 5; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(4)
+          .k(k)
+          .cn_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, n_gt_4_strided_a) {
+    for (uint32_t n = 5; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, n_gt_4_subtile) {
+    for (uint32_t n = 5; n < 8; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(4)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, n_div_4) {
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(4)
+          .k(k)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, n_div_4_strided_cn) {
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .cn_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, n_div_4_strided_a) {
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, n_div_4_subtile) {
+    for (uint32_t n = 8; n <= 12; n += 4) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(4)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, strided_cm_subtile) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 4; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(4)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(7)
+            .iterations(1)
+            .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMM_HSWISH_4X4__WASM, strided_cm) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(4)
+      .k(1)
+      .cm_stride(7)
+      .Test(xnn_f32_gemm_hswish_ukernel_4x4__wasm);
+  }
+#endif  // XNN_ARCH_WASM || XNN_ARCH_WASMSIMD
+
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, k_eq_1) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, strided_cn) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .cn_stride(7)
+    .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, k_eq_1_strided_a) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .a_stride(3)
+    .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, k_eq_1_subtile) {
+  for (uint32_t m = 1; m <= 1; m++) {
+    for (uint32_t n = 1; n <= 4; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, k_eq_1_subtile_m) {
+  for (uint32_t m = 1; m <= 1; m++) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(m)
+      .n(4)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, k_eq_1_subtile_n) {
+  for (uint32_t n = 1; n <= 4; n++) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(n)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, k_gt_1) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(k)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, k_gt_1_strided_a) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(k)
+      .a_stride(11)
+      .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, k_gt_1_subtile) {
+  for (size_t k = 2; k < 10; k++) {
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, n_gt_4) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, n_gt_4_strided_cn) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, n_gt_4_strided_a) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, n_gt_4_subtile) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, n_div_4) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, n_div_4_strided_cn) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, n_div_4_strided_a) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, n_div_4_subtile) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, strided_cm_subtile) {
+  for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .cm_stride(7)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_1X4__SCALAR, strided_cm) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .cm_stride(7)
+    .Test(xnn_f32_gemm_hswish_ukernel_1x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, k_eq_1) {
+  GemmMicrokernelTester()
+    .mr(2)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(2)
+    .n(4)
+    .k(1)
+    .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, strided_cn) {
+  GemmMicrokernelTester()
+    .mr(2)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(2)
+    .n(4)
+    .k(1)
+    .cn_stride(7)
+    .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, k_eq_1_strided_a) {
+  GemmMicrokernelTester()
+    .mr(2)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(2)
+    .n(4)
+    .k(1)
+    .a_stride(3)
+    .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, k_eq_1_subtile) {
+  for (uint32_t m = 1; m <= 2; m++) {
+    for (uint32_t n = 1; n <= 4; n++) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, k_eq_1_subtile_m) {
+  for (uint32_t m = 1; m <= 2; m++) {
+    GemmMicrokernelTester()
+      .mr(2)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(m)
+      .n(4)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, k_eq_1_subtile_n) {
+  for (uint32_t n = 1; n <= 4; n++) {
+    GemmMicrokernelTester()
+      .mr(2)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(2)
+      .n(n)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, k_gt_1) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(2)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(2)
+      .n(4)
+      .k(k)
+      .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, k_gt_1_strided_a) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(2)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(2)
+      .n(4)
+      .k(k)
+      .a_stride(11)
+      .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, k_gt_1_subtile) {
+  for (size_t k = 2; k < 10; k++) {
+    for (uint32_t m = 1; m <= 2; m++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        GemmMicrokernelTester()
+          .mr(2)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, n_gt_4) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(2)
+        .n(4)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, n_gt_4_strided_cn) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(2)
+        .n(4)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, n_gt_4_strided_a) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(2)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, n_gt_4_subtile) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 2; m++) {
+        GemmMicrokernelTester()
+          .mr(2)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, n_div_4) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(2)
+        .n(4)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, n_div_4_strided_cn) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(2)
+        .n(n)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, n_div_4_strided_a) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(2)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, n_div_4_subtile) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 2; m++) {
+        GemmMicrokernelTester()
+          .mr(2)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, strided_cm_subtile) {
+  for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t m = 1; m <= 2; m++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        GemmMicrokernelTester()
+          .mr(2)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .cm_stride(7)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_2X4__SCALAR, strided_cm) {
+  GemmMicrokernelTester()
+    .mr(2)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(2)
+    .n(4)
+    .k(1)
+    .cm_stride(7)
+    .Test(xnn_f32_gemm_hswish_ukernel_2x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, k_eq_1) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, strided_cn) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .cn_stride(7)
+    .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, k_eq_1_strided_a) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .a_stride(3)
+    .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, k_eq_1_subtile) {
+  for (uint32_t m = 1; m <= 4; m++) {
+    for (uint32_t n = 1; n <= 4; n++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, k_eq_1_subtile_m) {
+  for (uint32_t m = 1; m <= 4; m++) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(m)
+      .n(4)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, k_eq_1_subtile_n) {
+  for (uint32_t n = 1; n <= 4; n++) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(n)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, k_gt_1) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(4)
+      .k(k)
+      .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, k_gt_1_strided_a) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(4)
+      .k(k)
+      .a_stride(11)
+      .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, k_gt_1_subtile) {
+  for (size_t k = 2; k < 10; k++) {
+    for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, n_gt_4) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(4)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, n_gt_4_strided_cn) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(4)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, n_gt_4_strided_a) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, n_gt_4_subtile) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, n_div_4) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(4)
+        .k(k)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, n_div_4_strided_cn) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, n_div_4_strided_a) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, n_div_4_subtile) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, strided_cm_subtile) {
+  for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t m = 1; m <= 4; m++) {
+      for (uint32_t n = 1; n <= 4; n++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .cm_stride(7)
+          .iterations(1)
+          .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+      }
+    }
+  }
+}
+
+TEST(F32_GEMM_HSWISH_4X4__SCALAR, strided_cm) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .cm_stride(7)
+    .Test(xnn_f32_gemm_hswish_ukernel_4x4__scalar, GemmMicrokernelTester::Variant::Scalar);
+}
@@ -0,0 +1,143 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/vcvt.h>
+#include "vcvt-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_QD8_VCVT__SSE2, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE2;
+    VCvtMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_qd8_vcvt_ukernel__sse2);
+  }
+
+  TEST(F32_QD8_VCVT__SSE2, batch_div_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_qd8_vcvt_ukernel__sse2);
+    }
+  }
+
+  TEST(F32_QD8_VCVT__SSE2, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_qd8_vcvt_ukernel__sse2);
+    }
+  }
+
+  TEST(F32_QD8_VCVT__SSE2, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_qd8_vcvt_ukernel__sse2);
+    }
+  }
+
+  TEST(F32_QD8_VCVT__SSE2, positive_inputs) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(0.5f)
+        .input_max(100.0f)
+        .Test(xnn_f32_qd8_vcvt_ukernel__sse2);
+    }
+  }
+
+  TEST(F32_QD8_VCVT__SSE2, negative_inputs) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100.0f)
+        .input_max(-0.5f)
+        .Test(xnn_f32_qd8_vcvt_ukernel__sse2);
+    }
+  }
+
+  TEST(F32_QD8_VCVT__SSE2, zero_inputs) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(0.0f)
+        .input_max(0.0f)
+        .Test(xnn_f32_qd8_vcvt_ukernel__sse2);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F32_QD8_VCVT__SCALAR, batch_eq_1) {
+  VCvtMicrokernelTester()
+    .batch_size(1)
+    .Test(xnn_f32_qd8_vcvt_ukernel__scalar);
+}
+
+TEST(F32_QD8_VCVT__SCALAR, batch_div_1) {
+  for (size_t batch_size = 2; batch_size < 10; batch_size += 1) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_qd8_vcvt_ukernel__scalar);
+  }
+}
+
+TEST(F32_QD8_VCVT__SCALAR, batch_lt_1) {
+  for (size_t batch_size = 1; batch_size < 1; batch_size++) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_qd8_vcvt_ukernel__scalar);
+  }
+}
+
+TEST(F32_QD8_VCVT__SCALAR, batch_gt_1) {
+  for (size_t batch_size = 2; batch_size < 10; batch_size++) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_qd8_vcvt_ukernel__scalar);
+  }
+}
+
+TEST(F32_QD8_VCVT__SCALAR, positive_inputs) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .input_min(0.5f)
+      .input_max(100.0f)
+      .Test(xnn_f32_qd8_vcvt_ukernel__scalar);
+  }
+}
+
+TEST(F32_QD8_VCVT__SCALAR, negative_inputs) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .input_min(-100.0f)
+      .input_max(-0.5f)
+      .Test(xnn_f32_qd8_vcvt_ukernel__scalar);
+  }
+}
+
+TEST(F32_QD8_VCVT__SCALAR, zero_inputs) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .input_min(0.0f)
+      .input_max(0.0f)
+      .Test(xnn_f32_qd8_vcvt_ukernel__scalar);
+  }
+}
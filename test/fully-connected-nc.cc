@@ -11,6 +11,282 @@
 #include "fully-connected-operator-tester.h"
 
 
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
 TEST(FULLY_CONNECTED_NC_QS8, unit_batch) {
   FullyConnectedOperatorTester()
     .batch_size(1)
@@ -149,6 +425,38 @@ TEST(FULLY_CONNECTED_NC_QS8, small_batch_without_bias) {
     .TestQS8();
 }
 
+TEST(FULLY_CONNECTED_NC_QS8, multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(77)
+    .num_threads(4)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8, multithreaded_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(77)
+    .num_threads(4)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8, multithreaded_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(77)
+    .num_threads(4)
+    .iterations(3)
+    .TestQS8();
+}
+
 TEST(FULLY_CONNECTED_NC_QU8, unit_batch) {
   FullyConnectedOperatorTester()
     .batch_size(1)
@@ -424,3 +732,170 @@ TEST(FULLY_CONNECTED_NC_F32, small_batch_without_bias) {
     .iterations(3)
     .TestF32();
 }
+
+TEST(FULLY_CONNECTED_NC_F32, large_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(67)
+    .input_channels(23)
+    .output_channels(77)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(67)
+    .input_channels(23)
+    .output_channels(77)
+    .qmin(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(67)
+    .input_channels(23)
+    .output_channels(77)
+    .qmax(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(67)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(77)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(67)
+    .input_channels(23)
+    .output_channels(77)
+    .output_stride(83)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(67)
+    .input_channels(23)
+    .output_channels(77)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, many_input_channels) {
+  FullyConnectedOperatorTester()
+    .batch_size(8)
+    .input_channels(1100)
+    .output_channels(67)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, many_input_channels_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(8)
+    .input_channels(1100)
+    .output_channels(67)
+    .qmin(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, many_input_channels_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(8)
+    .input_channels(1100)
+    .output_channels(67)
+    .qmax(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, many_input_channels_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(8)
+    .input_channels(1100)
+    .input_stride(1107)
+    .output_channels(67)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, many_input_channels_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(8)
+    .input_channels(1100)
+    .output_channels(67)
+    .output_stride(73)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, many_input_channels_small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(7)
+    .input_channels(1100)
+    .output_channels(67)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, many_input_channels_few_output_channels) {
+  FullyConnectedOperatorTester()
+    .batch_size(8)
+    .input_channels(1100)
+    .output_channels(3)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, many_input_channels_large_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(67)
+    .input_channels(1100)
+    .output_channels(77)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(77)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, multithreaded_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(77)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, multithreaded_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(77)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32();
+}
@@ -19,7 +19,10 @@
 #include <random>
 #include <vector>
 
+#include <pthreadpool.h>
+
 #include <xnnpack.h>
+#include <xnnpack/weights-cache.h>
 
 
 class FullyConnectedOperatorTester {
@@ -120,6 +123,15 @@ class FullyConnectedOperatorTester {
     return this->has_bias_;
   }
 
+  inline FullyConnectedOperatorTester& num_threads(size_t num_threads) {
+    this->num_threads_ = num_threads;
+    return *this;
+  }
+
+  inline size_t num_threads() const {
+    return this->num_threads_;
+  }
+
   inline FullyConnectedOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -129,6 +141,242 @@ class FullyConnectedOperatorTester {
     return this->iterations_;
   }
 
+  void TestQC8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto i8rng = std::bind(std::uniform_int_distribution<int32_t>(
+      -std::numeric_limits<int8_t>::max(), std::numeric_limits<int8_t>::max()), rng);
+    auto scalerng = std::bind(std::uniform_real_distribution<float>(0.25f, 1.0f), rng);
+
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    std::vector<int8_t> kernel(output_channels() * input_channels());
+    std::vector<int32_t> bias(output_channels());
+    std::vector<float> kernel_scale(output_channels());
+    std::vector<int8_t> output((batch_size() - 1) * output_stride() + output_channels());
+    std::vector<double> accumulators(batch_size() * output_channels());
+    std::vector<double> output_ref(batch_size() * output_channels());
+
+    const int8_t input_zero_point = 127;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(i8rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(i8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(i32rng));
+      std::generate(kernel_scale.begin(), kernel_scale.end(), std::ref(scalerng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      // Compute reference results, without renormalization.
+      if (has_bias()) {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oc = 0; oc < output_channels(); oc++) {
+            accumulators[i * output_channels() + oc] = double(bias[oc]);
+          }
+        }
+      } else {
+        std::fill(accumulators.begin(), accumulators.end(), 0);
+      }
+      if (transpose_weights()) {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oc = 0; oc < output_channels(); oc++) {
+            for (size_t ic = 0; ic < input_channels(); ic++) {
+              accumulators[i * output_channels() + oc] +=
+                (int32_t(input[i * input_stride() + ic]) - int32_t(input_zero_point)) *
+                int32_t(kernel[ic * output_channels() + oc]);
+            }
+          }
+        }
+      } else {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oc = 0; oc < output_channels(); oc++) {
+            for (size_t ic = 0; ic < input_channels(); ic++) {
+              accumulators[i * output_channels() + oc] +=
+                (int32_t(input[i * input_stride() + ic]) - int32_t(input_zero_point)) *
+                int32_t(kernel[oc * input_channels() + ic]);
+            }
+          }
+        }
+      }
+
+      // Apply per-channel kernel scales.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          accumulators[i * output_channels() + oc] *= double(kernel_scale[oc]);
+        }
+      }
+
+      // Compute renormalization parameters.
+      const double accumulated_min = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const double accumulated_max = *std::max_element(accumulators.cbegin(), accumulators.cend());
+
+      const double output_scale = (accumulated_max - accumulated_min) / 255.0;
+      const int8_t output_zero_point = int8_t(std::max(std::min(
+        lrint(-0.5 - 0.5 * (accumulated_min + accumulated_max) / output_scale),
+        long(std::numeric_limits<int8_t>::max())), long(std::numeric_limits<int8_t>::min())));
+
+      // Renormalize reference results.
+      std::transform(accumulators.cbegin(), accumulators.cend(), output_ref.begin(),
+        [this, output_scale, output_zero_point](double x) -> double {
+          return std::max<double>(std::min<double>(x / output_scale, double(qmax() - 0x80) - output_zero_point), double(qmin() - 0x80) - output_zero_point);
+        });
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t fully_connected_op = nullptr;
+
+      const xnn_status status = xnn_create_fully_connected_nc_qc8(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          input_zero_point, 1.0f /* input scale */,
+          kernel_scale.data(),
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_zero_point, output_scale, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+          transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
+          &fully_connected_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, fully_connected_op);
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_nc_qc8(
+          fully_connected_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_LE(int32_t(output[i * output_stride() + c]), int32_t(qmax() - 0x80))
+            << "batch index = " << i << ", channel = " << c;
+          ASSERT_GE(int32_t(output[i * output_stride() + c]), int32_t(qmin() - 0x80))
+            << "batch index = " << i << ", channel = " << c;
+          ASSERT_NEAR(
+              output_ref[i * output_channels() + c],
+              double(output[i * output_stride() + c]) - double(output_zero_point),
+              0.9)
+            << "batch index = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void TestQD8F32QC8W() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+    auto i8rng = std::bind(std::uniform_int_distribution<int32_t>(
+      -std::numeric_limits<int8_t>::max(), std::numeric_limits<int8_t>::max()), rng);
+    auto scalerng = std::bind(std::uniform_real_distribution<float>(0.25f, 1.0f), rng);
+
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    std::vector<int8_t> kernel(output_channels() * input_channels());
+    std::vector<float> bias(output_channels());
+    std::vector<float> kernel_scale(output_channels());
+    std::vector<float> output((batch_size() - 1) * output_stride() + output_channels());
+    std::vector<double> output_ref(batch_size() * output_channels());
+    std::vector<double> output_tolerance(batch_size() * output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(i8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+      std::generate(kernel_scale.begin(), kernel_scale.end(), std::ref(scalerng));
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      // Compute reference results on unquantized inputs. Quantization of every input row to 8 bits perturbs each input
+      // element by at most half of the quantization step of the row.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const float* input_row = input.data() + i * input_stride();
+        const float row_min = std::min(*std::min_element(input_row, input_row + input_channels()), 0.0f);
+        const float row_max = std::max(*std::max_element(input_row, input_row + input_channels()), 0.0f);
+        const double input_scale = (double(row_max) - double(row_min)) / 255.0;
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          double acc = has_bias() ? double(bias[oc]) : 0.0;
+          double abs_kernel_sum = 0.0;
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            const int8_t k = transpose_weights() ?
+              kernel[ic * output_channels() + oc] : kernel[oc * input_channels() + ic];
+            acc += double(input_row[ic]) * double(k) * double(kernel_scale[oc]);
+            abs_kernel_sum += std::abs(double(k) * double(kernel_scale[oc]));
+          }
+          output_ref[i * output_channels() + oc] = acc;
+          output_tolerance[i * output_channels() + oc] = 0.51 * input_scale * abs_kernel_sum + 1.0e-5 * std::abs(acc);
+        }
+      }
+
+      // Compute clamping parameters.
+      const double accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+
+      const float output_min = qmin() == 0 ? -std::numeric_limits<float>::infinity() :
+        float(accumulated_min + (accumulated_max - accumulated_min) / 255.0 * double(qmin()));
+      const float output_max = qmax() == 255 ? std::numeric_limits<float>::infinity() :
+        float(accumulated_max - (accumulated_max - accumulated_min) / 255.0 * double(255 - qmax()));
+
+      // Clamp reference results.
+      for (double& value : output_ref) {
+        value = std::max(std::min(value, double(output_max)), double(output_min));
+      }
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t fully_connected_op = nullptr;
+
+      const xnn_status status = xnn_create_fully_connected_nc_qd8_f32_qc8w(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          kernel_scale.data(),
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_min, output_max,
+          transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
+          &fully_connected_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, fully_connected_op);
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_nc_qd8_f32_qc8w(
+          fully_connected_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_LE(output[i * output_stride() + c], output_max)
+            << "batch index = " << i << ", channel = " << c;
+          ASSERT_GE(output[i * output_stride() + c], output_min)
+            << "batch index = " << i << ", channel = " << c;
+          ASSERT_NEAR(
+              output_ref[i * output_channels() + c],
+              double(output[i * output_stride() + c]),
+              output_tolerance[i * output_channels() + c])
+            << "batch index = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
   void TestQS8() const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -199,6 +447,13 @@ class FullyConnectedOperatorTester {
           return std::max<double>(std::min<double>(double(x) / output_scale, double(qmax() - 0x80) - output_zero_point), double(qmin() - 0x80) - output_zero_point);
         });
 
+      // Thread pool is used both for packing of weights and for computation.
+      std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+      if (num_threads() > 1) {
+        auto_threadpool.reset(pthreadpool_create(num_threads()));
+        ASSERT_NE(nullptr, auto_threadpool.get());
+      }
+
       // Create, setup, run, and destroy Fully Connected operator.
       ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
       xnn_operator_t fully_connected_op = nullptr;
@@ -226,10 +481,51 @@ class FullyConnectedOperatorTester {
           fully_connected_op,
           batch_size(),
           input.data(), output.data(),
-          nullptr /* thread pool */));
+          auto_threadpool.get()));
 
       ASSERT_EQ(xnn_status_success,
-        xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
+        xnn_run_operator(fully_connected_op, auto_threadpool.get()));
+
+      if (num_threads() > 1) {
+        // Create, setup, run, and destroy Fully Connected operator with weights packed on the thread pool, and check that
+        // it produces exactly the same results as the operator with weights packed on the calling thread.
+        xnn_operator_t threadpool_packed_op = nullptr;
+        ASSERT_EQ(xnn_status_success,
+          xnn_create_fully_connected_nc_qs8_with_weights_cache(
+            input_channels(), output_channels(),
+            input_stride(), output_stride(),
+            input_zero_point, 1.0f /* input scale */,
+            1.0f /* kernel scale */,
+            kernel.data(), has_bias() ? bias.data() : nullptr,
+            output_zero_point, output_scale, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+            transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
+            nullptr /* weights cache */, auto_threadpool.get(),
+            &threadpool_packed_op));
+        ASSERT_NE(nullptr, threadpool_packed_op);
+
+        // Smart pointer to automatically delete threadpool_packed_op.
+        std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_threadpool_packed_op(threadpool_packed_op, xnn_delete_operator);
+
+        std::vector<int8_t> threadpool_packed_output(output.size(), INT8_C(0xA5));
+        ASSERT_EQ(xnn_status_success,
+          xnn_setup_fully_connected_nc_qs8(
+            threadpool_packed_op,
+            batch_size(),
+            input.data(), threadpool_packed_output.data(),
+            auto_threadpool.get()));
+
+        ASSERT_EQ(xnn_status_success,
+          xnn_run_operator(threadpool_packed_op, auto_threadpool.get()));
+
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t c = 0; c < output_channels(); c++) {
+            ASSERT_EQ(
+                int32_t(output[i * output_stride() + c]),
+                int32_t(threadpool_packed_output[i * output_stride() + c]))
+              << "batch index = " << i << ", channel = " << c;
+          }
+        }
+      }
 
       // Verify results.
       for (size_t i = 0; i < batch_size(); i++) {
@@ -429,17 +725,37 @@ class FullyConnectedOperatorTester {
         value = std::max(std::min(value, output_max), output_min);
       }
 
+      // Thread pool is used both for packing of weights and for computation.
+      std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+      if (num_threads() > 1) {
+        auto_threadpool.reset(pthreadpool_create(num_threads()));
+        ASSERT_NE(nullptr, auto_threadpool.get());
+      }
+
       // Create, setup, run, and destroy Fully Connected operator.
       ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
       xnn_operator_t fully_connected_op = nullptr;
 
-      const xnn_status status = xnn_create_fully_connected_nc_f32(
-          input_channels(), output_channels(),
-          input_stride(), output_stride(),
-          kernel.data(), has_bias() ? bias.data() : nullptr,
-          output_min, output_max,
-          transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
-          &fully_connected_op);
+      xnn_status status = xnn_status_success;
+      if (num_threads() > 1) {
+        // Only the internal creation function takes a thread pool to pack the weights.
+        status = xnn_create_fully_connected_nc_f32_with_weights_cache(
+            input_channels(), output_channels(),
+            input_stride(), output_stride(),
+            kernel.data(), has_bias() ? bias.data() : nullptr,
+            output_min, output_max,
+            transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
+            nullptr /* weights cache */, auto_threadpool.get(),
+            &fully_connected_op);
+      } else {
+        status = xnn_create_fully_connected_nc_f32(
+            input_channels(), output_channels(),
+            input_stride(), output_stride(),
+            kernel.data(), has_bias() ? bias.data() : nullptr,
+            output_min, output_max,
+            transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
+            &fully_connected_op);
+      }
       if (status == xnn_status_unsupported_hardware) {
         GTEST_SKIP();
       }
@@ -454,10 +770,10 @@ class FullyConnectedOperatorTester {
           fully_connected_op,
           batch_size(),
           input.data(), output.data(),
-          nullptr /* thread pool */));
+          auto_threadpool.get()));
 
       ASSERT_EQ(xnn_status_success,
-        xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
+        xnn_run_operator(fully_connected_op, auto_threadpool.get()));
 
       // Verify results.
       for (size_t i = 0; i < batch_size(); i++) {
@@ -486,5 +802,6 @@ class FullyConnectedOperatorTester {
   uint8_t qmax_{255};
   bool transpose_weights_{false};
   bool has_bias_{true};
+  size_t num_threads_{1};
   size_t iterations_{1};
 };
@@ -0,0 +1,380 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/subgraph.h>
+
+#include <pthreadpool.h>
+
+#include <gtest/gtest.h>
+
+static const int8_t kInputZeroPoint = -3;
+static const float kInputScale = 0.5f;
+static const float kFilterScale = 0.125f;
+
+// Quantized Fully Connected with a [batch_dims..., input_channels] input, which is flattened into rows of
+// filter_input_channels elements, and a [output_channels, filter_input_channels] filter.
+class QS8FullyConnected {
+ public:
+  QS8FullyConnected(std::vector<size_t> input_dims, size_t output_channels, size_t filter_input_channels)
+    : input_dims_(input_dims), output_channels_(output_channels), input_channels_(filter_input_channels)
+  {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::bind(std::uniform_int_distribution<int32_t>(-127, 127), std::ref(rng));
+    auto i32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), std::ref(rng));
+
+    size_t num_input_elements = 1;
+    for (size_t dim : input_dims_) {
+      num_input_elements *= dim;
+    }
+    batch_size_ = num_input_elements / input_channels_;
+    input_.resize(num_input_elements);
+    filter_.resize(output_channels_ * input_channels_);
+    bias_.resize(output_channels_);
+    std::generate(input_.begin(), input_.end(), [&]() { return (int8_t) i8rng(); });
+    std::generate(filter_.begin(), filter_.end(), [&]() { return (int8_t) i8rng(); });
+    std::generate(bias_.begin(), bias_.end(), std::ref(i32rng));
+
+    // Choose output quantization to cover the range of the accumulators.
+    accumulators_.resize(batch_size_ * output_channels_);
+    for (size_t b = 0; b < batch_size_; b++) {
+      for (size_t oc = 0; oc < output_channels_; oc++) {
+        int32_t acc = bias_[oc];
+        for (size_t ic = 0; ic < input_channels_; ic++) {
+          acc += (int32_t(input_[b * input_channels_ + ic]) - int32_t(kInputZeroPoint)) *
+            int32_t(filter_[oc * input_channels_ + ic]);
+        }
+        accumulators_[b * output_channels_ + oc] = acc;
+      }
+    }
+    const int32_t accumulated_min = *std::min_element(accumulators_.cbegin(), accumulators_.cend());
+    const int32_t accumulated_max = *std::max_element(accumulators_.cbegin(), accumulators_.cend());
+    const double accumulated_scale = double(kInputScale) * double(kFilterScale);
+    output_scale_ = float(double(uint32_t(accumulated_max - accumulated_min)) * accumulated_scale / 255.0);
+    output_zero_point_ = int8_t(std::max(std::min(
+      lrint(-128.0 - double(accumulated_min) * accumulated_scale / double(output_scale_)), 127l), -128l));
+  }
+
+  xnn_runtime_t CreateRuntime(xnn_weights_cache_t weights_cache, pthreadpool_t threadpool) const {
+    xnn_subgraph_t subgraph = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph));
+    const std::array<size_t, 2> filter_dims = {{output_channels_, input_channels_}};
+    const std::array<size_t, 1> bias_dims = {{output_channels_}};
+    const std::array<size_t, 2> output_dims = {{batch_size_, output_channels_}};
+    uint32_t input_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(subgraph, xnn_datatype_qint8, kInputZeroPoint,
+      kInputScale, input_dims_.size(), input_dims_.data(), nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    uint32_t filter_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(subgraph, xnn_datatype_qint8, 0, kFilterScale,
+      filter_dims.size(), filter_dims.data(), filter_.data(), XNN_INVALID_VALUE_ID, 0 /* flags */, &filter_id));
+    uint32_t bias_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(subgraph, xnn_datatype_qint32, 0,
+      kInputScale * kFilterScale, bias_dims.size(), bias_dims.data(), bias_.data(), XNN_INVALID_VALUE_ID,
+      0 /* flags */, &bias_id));
+    uint32_t output_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(subgraph, xnn_datatype_qint8, output_zero_point_,
+      output_scale_, output_dims.size(), output_dims.data(), nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_fully_connected(subgraph, -INFINITY, INFINITY,
+      input_id, filter_id, bias_id, output_id, 0 /* flags */));
+
+    xnn_runtime_t runtime = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph, weights_cache, nullptr /* workspace */,
+      threadpool, 0 /* flags */, &runtime));
+    xnn_delete_subgraph(subgraph);
+    return runtime;
+  }
+
+  void Run(xnn_runtime_t runtime) const {
+    std::vector<int8_t> output(batch_size_ * output_channels_, INT8_C(0x5A));
+    const std::array<xnn_external_value, 2> external = {{
+      xnn_external_value{0, const_cast<int8_t*>(input_.data())}, xnn_external_value{1, output.data()}}};
+    ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+    ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+    const double requantization_scale = double(kInputScale) * double(kFilterScale) / double(output_scale_);
+    for (size_t i = 0; i < accumulators_.size(); i++) {
+      const double reference = std::max(std::min(
+        double(accumulators_[i]) * requantization_scale + double(output_zero_point_), 127.0), -128.0);
+      ASSERT_NEAR(reference, double(output[i]), 0.9)
+        << "batch " << i / output_channels_ << ", output channel " << i % output_channels_;
+    }
+  }
+
+ private:
+  std::vector<size_t> input_dims_;
+  size_t output_channels_;
+  size_t input_channels_;
+  size_t batch_size_;
+  std::vector<int8_t> input_;
+  std::vector<int8_t> filter_;
+  std::vector<int32_t> bias_;
+  std::vector<int32_t> accumulators_;
+  float output_scale_;
+  int8_t output_zero_point_;
+};
+
+static uint32_t define_value(xnn_subgraph_t subgraph, xnn_datatype datatype, int32_t zero_point,
+  const std::vector<size_t>& dims, const void* data)
+{
+  uint32_t id = XNN_INVALID_VALUE_ID;
+  if (datatype == xnn_datatype_fp32) {
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, datatype, dims.size(), dims.data(), data,
+      XNN_INVALID_VALUE_ID, 0 /* flags */, &id));
+  } else {
+    EXPECT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(subgraph, datatype, zero_point, 1.0f,
+      dims.size(), dims.data(), data, XNN_INVALID_VALUE_ID, 0 /* flags */, &id));
+  }
+  return id;
+}
+
+// Defines the Values of a Fully Connected Node with the given datatypes, and returns the status of its definition.
+static xnn_status define_fully_connected(
+  xnn_datatype input_datatype, xnn_datatype filter_datatype, xnn_datatype bias_datatype,
+  xnn_datatype output_datatype, int32_t filter_zero_point)
+{
+  xnn_subgraph_t subgraph = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_subgraph(0, 0 /* flags */, &subgraph));
+  std::vector<int32_t> static_data(7 * 5, 0);
+  const uint32_t input_id = define_value(subgraph, input_datatype, 0, {3, 5}, nullptr);
+  const uint32_t filter_id = define_value(subgraph, filter_datatype, filter_zero_point, {7, 5}, static_data.data());
+  const uint32_t bias_id = define_value(subgraph, bias_datatype, 0, {7}, static_data.data());
+  const uint32_t output_id = define_value(subgraph, output_datatype, 0, {3, 7}, nullptr);
+  const xnn_status status = xnn_define_fully_connected(subgraph, -INFINITY, INFINITY,
+    input_id, filter_id, bias_id, output_id, 0 /* flags */);
+  if (status == xnn_status_success) {
+    EXPECT_EQ(1, subgraph->num_nodes);
+    EXPECT_EQ(xnn_node_type_fully_connected, subgraph->nodes[0].type);
+  } else {
+    EXPECT_EQ(0, subgraph->num_nodes);
+  }
+  xnn_delete_subgraph(subgraph);
+  return status;
+}
+
+TEST(FULLY_CONNECTED_QS8, define) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  ASSERT_EQ(xnn_status_success,
+    define_fully_connected(xnn_datatype_qint8, xnn_datatype_qint8, xnn_datatype_qint32, xnn_datatype_qint8, 0));
+}
+
+TEST(FULLY_CONNECTED_QS8, define_with_mixed_datatypes) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  ASSERT_EQ(xnn_status_invalid_parameter,
+    define_fully_connected(xnn_datatype_fp32, xnn_datatype_qint8, xnn_datatype_qint32, xnn_datatype_qint8, 0));
+  ASSERT_EQ(xnn_status_invalid_parameter,
+    define_fully_connected(xnn_datatype_qint8, xnn_datatype_fp32, xnn_datatype_qint32, xnn_datatype_qint8, 0));
+  ASSERT_EQ(xnn_status_invalid_parameter,
+    define_fully_connected(xnn_datatype_qint8, xnn_datatype_qint8, xnn_datatype_fp32, xnn_datatype_qint8, 0));
+  ASSERT_EQ(xnn_status_invalid_parameter,
+    define_fully_connected(xnn_datatype_qint8, xnn_datatype_qint8, xnn_datatype_qint32, xnn_datatype_fp32, 0));
+}
+
+TEST(FULLY_CONNECTED_QS8, define_with_filter_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  ASSERT_EQ(xnn_status_invalid_parameter,
+    define_fully_connected(xnn_datatype_qint8, xnn_datatype_qint8, xnn_datatype_qint32, xnn_datatype_qint8, 1));
+}
+
+TEST(FULLY_CONNECTED_QS8, runtime_2d_input) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const QS8FullyConnected fc({3, 5}, 7, 5);
+  xnn_runtime_t runtime = fc.CreateRuntime(nullptr /* weights cache */, nullptr /* threadpool */);
+  ASSERT_NE(nullptr, runtime);
+  ASSERT_EQ(xnn_operator_type_fully_connected_nc_qs8, runtime->opdata[0].operator_object->type);
+  fc.Run(runtime);
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(FULLY_CONNECTED_QS8, runtime_flattened_input) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  // [2, 3, 5] input is flattened into a [2, 15] matrix.
+  const QS8FullyConnected fc({2, 3, 5}, 7, 15);
+  xnn_runtime_t runtime = fc.CreateRuntime(nullptr /* weights cache */, nullptr /* threadpool */);
+  ASSERT_NE(nullptr, runtime);
+  ASSERT_EQ(xnn_operator_type_fully_connected_nc_qs8, runtime->opdata[0].operator_object->type);
+  fc.Run(runtime);
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(FULLY_CONNECTED_QS8, runtime_with_weights_cache) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  pthreadpool_t threadpool = pthreadpool_create(2);
+  ASSERT_NE(nullptr, threadpool);
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+
+  const QS8FullyConnected fc({4, 16}, 9, 16);
+  xnn_runtime_t runtime1 = fc.CreateRuntime(weights_cache, threadpool);
+  ASSERT_NE(nullptr, runtime1);
+  xnn_runtime_t runtime2 = fc.CreateRuntime(weights_cache, threadpool);
+  ASSERT_NE(nullptr, runtime2);
+
+  // Both runtimes use the same packed weights from the cache.
+  ASSERT_EQ(runtime1->opdata[0].operator_object->packed_weights, runtime2->opdata[0].operator_object->packed_weights);
+  fc.Run(runtime1);
+  fc.Run(runtime2);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime1));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime2));
+  ASSERT_EQ(xnn_status_success, xnn_release_weights_cache(weights_cache));
+  pthreadpool_destroy(threadpool);
+}
+
+// Runtime with a fp32 Fully Connected Node over a [batch_size, input_channels] input, created with dynamic range
+// quantization.
+static xnn_runtime_t create_dynamic_range_quantized_runtime(
+  size_t batch_size, size_t input_channels, size_t output_channels,
+  const std::vector<float>& filter, const std::vector<float>& bias,
+  xnn_weights_cache_t weights_cache, pthreadpool_t threadpool)
+{
+  xnn_subgraph_t subgraph = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph));
+  const uint32_t filter_id = define_value(subgraph, xnn_datatype_fp32, 0, {output_channels, input_channels},
+    filter.data());
+  const uint32_t bias_id = define_value(subgraph, xnn_datatype_fp32, 0, {output_channels}, bias.data());
+  const std::array<size_t, 2> input_dims = {{batch_size, input_channels}};
+  const std::array<size_t, 2> output_dims = {{batch_size, output_channels}};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, input_dims.size(),
+    input_dims.data(), nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, output_dims.size(),
+    output_dims.data(), nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  EXPECT_EQ(xnn_status_success, xnn_define_fully_connected(subgraph, -INFINITY, INFINITY,
+    input_id, filter_id, bias_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph, weights_cache, nullptr /* workspace */,
+    threadpool, XNN_FLAG_DYNAMIC_RANGE_QUANTIZATION, &runtime));
+  xnn_delete_subgraph(subgraph);
+  return runtime;
+}
+
+// Runs the runtime, and compares the outputs with the fp32 reference, up to quantization errors of inputs and weights.
+static void run_dynamic_range_quantized_runtime(
+  xnn_runtime_t runtime, size_t batch_size, size_t input_channels, size_t output_channels,
+  const std::vector<float>& input, const std::vector<float>& filter, const std::vector<float>& bias)
+{
+  std::vector<float> output(batch_size * output_channels, std::nanf(""));
+  const std::array<xnn_external_value, 2> external = {{
+    xnn_external_value{0, const_cast<float*>(input.data())}, xnn_external_value{1, output.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  for (size_t b = 0; b < batch_size; b++) {
+    for (size_t oc = 0; oc < output_channels; oc++) {
+      double reference = double(bias[oc]);
+      for (size_t ic = 0; ic < input_channels; ic++) {
+        reference += double(input[b * input_channels + ic]) * double(filter[oc * input_channels + ic]);
+      }
+      ASSERT_NEAR(reference, double(output[b * output_channels + oc]), 0.01 * double(input_channels))
+        << "batch " << b << ", output channel " << oc;
+    }
+  }
+}
+
+TEST(FULLY_CONNECTED_QD8_F32_QC8W, runtime_with_weights_cache) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  pthreadpool_t threadpool = pthreadpool_create(2);
+  ASSERT_NE(nullptr, threadpool);
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+
+  const size_t batch_size = 5;
+  const size_t input_channels = 16;
+  const size_t output_channels = 9;
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  std::vector<float> input(batch_size * input_channels);
+  std::vector<float> filter(output_channels * input_channels);
+  std::vector<float> bias(output_channels);
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  std::generate(filter.begin(), filter.end(), std::ref(f32rng));
+  std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+  std::vector<float> other_bias(bias);
+  other_bias[output_channels - 1] += 1.0f;
+
+  xnn_runtime_t runtime1 = create_dynamic_range_quantized_runtime(
+    batch_size, input_channels, output_channels, filter, bias, weights_cache, threadpool);
+  ASSERT_NE(nullptr, runtime1);
+  if (runtime1->opdata[0].operator_object->type != xnn_operator_type_fully_connected_nc_qd8_f32_qc8w) {
+    // No micro-kernels for dynamically quantized inputs on this hardware.
+    ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime1));
+    ASSERT_EQ(xnn_status_success, xnn_release_weights_cache(weights_cache));
+    pthreadpool_destroy(threadpool);
+    GTEST_SKIP();
+  }
+  xnn_runtime_t runtime2 = create_dynamic_range_quantized_runtime(
+    batch_size, input_channels, output_channels, filter, bias, weights_cache, threadpool);
+  ASSERT_NE(nullptr, runtime2);
+  xnn_runtime_t runtime3 = create_dynamic_range_quantized_runtime(
+    batch_size, input_channels, output_channels, filter, other_bias, weights_cache, threadpool);
+  ASSERT_NE(nullptr, runtime3);
+
+  // Runtimes with the same weights use the same packed weights from the cache, and biases are part of the key.
+  ASSERT_EQ(runtime1->opdata[0].operator_object->packed_weights, runtime2->opdata[0].operator_object->packed_weights);
+  ASSERT_NE(runtime1->opdata[0].operator_object->packed_weights, runtime3->opdata[0].operator_object->packed_weights);
+  run_dynamic_range_quantized_runtime(runtime1, batch_size, input_channels, output_channels, input, filter, bias);
+  run_dynamic_range_quantized_runtime(runtime2, batch_size, input_channels, output_channels, input, filter, bias);
+  run_dynamic_range_quantized_runtime(
+    runtime3, batch_size, input_channels, output_channels, input, filter, other_bias);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime1));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime2));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime3));
+  ASSERT_EQ(xnn_status_success, xnn_release_weights_cache(weights_cache));
+  pthreadpool_destroy(threadpool);
+}
+
+TEST(FULLY_CONNECTED_QD8_F32_QC8W, runtime_only_with_optimized_micro_kernels) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const size_t batch_size = 5;
+  const size_t input_channels = 16;
+  const size_t output_channels = 9;
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  std::vector<float> input(batch_size * input_channels);
+  std::vector<float> filter(output_channels * input_channels);
+  std::vector<float> bias(output_channels);
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  std::generate(filter.begin(), filter.end(), std::ref(f32rng));
+  std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+
+  xnn_runtime_t runtime = create_dynamic_range_quantized_runtime(
+    batch_size, input_channels, output_channels, filter, bias, nullptr /* weights cache */, nullptr /* thread pool */);
+  ASSERT_NE(nullptr, runtime);
+
+  // Scalar QD8 micro-kernels are slower than F32 micro-kernels, and the Runtime keeps the fp32 operator without
+  // optimized QD8 micro-kernels.
+  const bool qd8_opt = (xnn_params.init_flags & XNN_INIT_FLAG_QC8) != 0 &&
+    (xnn_params.init_flags & XNN_INIT_FLAG_QD8_OPT) != 0;
+  ASSERT_EQ(qd8_opt ? xnn_operator_type_fully_connected_nc_qd8_f32_qc8w : xnn_operator_type_fully_connected_nc_f32,
+    runtime->opdata[0].operator_object->type);
+  run_dynamic_range_quantized_runtime(runtime, batch_size, input_channels, output_channels, input, filter, bias);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
@@ -241,7 +241,7 @@ class GemmMicrokernelTester {
       std::fill(packed_w.begin(), packed_w.end(), b_zero_point());
       const xnn_qu8_packing_params packing_params = { a_zero_point(), b_zero_point() };
       xnn_pack_qu8_gemm_goi_w(1, n(), k(), nr(), kr(), sr(),
-        b.data(), bias.data(), packed_w.data(), &packing_params);
+        b.data(), bias.data(), packed_w.data(), 0, &packing_params);
 
       // Compute 32-bit results and output quantization arguments.
       std::fill(acc.begin(), acc.end(), 0);
@@ -340,7 +340,7 @@ class GemmMicrokernelTester {
       const xnn_qu8_packing_params packing_params = { a_zero_point(), b_zero_point() };
       xnn_pack_qu8_conv_goki_w(
         1, n(), ks(), k(), nr(), kr(), sr(),
-        b.data(), bias.data(), packed_w.data(), &packing_params);
+        b.data(), bias.data(), packed_w.data(), 0, &packing_params);
 
       for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
         for (size_t m_index = 0; m_index < mr(); m_index++) {
@@ -463,7 +463,7 @@ class GemmMicrokernelTester {
       std::fill(packed_w.begin(), packed_w.end(), 0);
       const xnn_qs8_packing_params packing_params = { int8_t(a_zero_point() - 0x80) };
       xnn_pack_qs8_gemm_goi_w(1, n(), k(), nr(), kr(), sr(),
-        b.data(), bias.data(), packed_w.data(), &packing_params);
+        b.data(), bias.data(), packed_w.data(), 0, &packing_params);
 
       // Compute 32-bit results and output quantization arguments.
       std::fill(acc.begin(), acc.end(), 0);
@@ -526,6 +526,214 @@ class GemmMicrokernelTester {
     }
   }
 
+  void Test(xnn_qc8_gemm_ukernel_function gemm, Variant variant = Variant::Native) const {
+    ASSERT_LE(m(), mr());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(-127, std::numeric_limits<int8_t>::max()), rng);
+    auto scalerng = std::bind(std::uniform_real_distribution<float>(0.5f, 2.0f), rng);
+
+    std::vector<int8_t> a((m() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<int8_t> b(n() * k());
+    std::vector<int32_t> bias(n());
+    std::vector<float> scale(n());
+    std::vector<int8_t, AlignedAllocator<int8_t, 64>> packed_w(packed_n() * packed_k() + bias_n() * (sizeof(int32_t) + sizeof(float)) / sizeof(int8_t));
+    std::vector<int8_t> c((mr() - 1) * cm_stride() + ((n() - 1) / nr()) * cn_stride() + (n() - 1) % nr() + 1);
+    std::vector<int32_t> acc(m() * n());
+    std::vector<int8_t> c_ref(m() * n());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      do {
+        std::generate(a.begin(), a.end(), std::ref(i8rng));
+      } while (a.size() > 1 && *std::max_element(a.cbegin(), a.cend()) == *std::min_element(a.cbegin(), a.cend()));
+      do {
+        std::generate(b.begin(), b.end(), std::ref(i8rng));
+      } while (b.size() > 1 && *std::max_element(b.cbegin(), b.cend()) == *std::min_element(b.cbegin(), b.cend()));
+      std::generate(bias.begin(), bias.end(), std::ref(i32rng));
+      std::fill(c.begin(), c.end(), 0xA5);
+
+      std::fill(packed_w.begin(), packed_w.end(), 0);
+      const xnn_qs8_packing_params packing_params = { int8_t(a_zero_point() - 0x80) };
+      xnn_pack_qs8_gemm_goi_w(1, n(), k(), nr(), kr(), sr(),
+        b.data(), bias.data(), packed_w.data(), nr() * sizeof(float), &packing_params);
+
+      // Compute 32-bit results and output quantization arguments.
+      std::fill(acc.begin(), acc.end(), 0);
+      for (size_t m_index = 0; m_index < m(); m_index++) {
+        for (size_t n_index = 0; n_index < n(); n_index++) {
+          for (size_t k_index = 0; k_index < k(); k_index++) {
+            acc[m_index * n() + n_index] +=
+                (int32_t(a[m_index * a_stride() + k_index]) - int32_t(a_zero_point() - 0x80)) *
+                int32_t(b[n_index * k() + k_index]);
+          }
+          acc[m_index * n() + n_index] += bias[n_index];
+        }
+      }
+
+      const int32_t accumulated_min = *std::min_element(acc.cbegin(), acc.cend());
+      const int32_t accumulated_max = *std::max_element(acc.cbegin(), acc.cend());
+      const double c_scale = uint32_t(accumulated_max - accumulated_min) >= 256 ? double(uint32_t(accumulated_max - accumulated_min)) / 255.0 : 1.00001;
+      const int8_t c_zero_point = int8_t(std::max(std::min(
+        lrint(-0.5 - 0.5 * double(accumulated_min + accumulated_max) / c_scale),
+        long(std::numeric_limits<int8_t>::max())), long(std::numeric_limits<int8_t>::min())));
+
+      // Perturb the common requantization scale to get a distinct scale for every output channel.
+      const float requantization_scale = 1.0f / float(c_scale);
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        scale[n_index] = requantization_scale * scalerng();
+      }
+      xnn_init_qc8_scale_fp32_params(
+        n(), nr(), nr() * (packed_k() * sizeof(int8_t) + sizeof(int32_t) + sizeof(float)), scale.data(),
+        (void*) ((uintptr_t) packed_w.data() + nr() * (packed_k() * sizeof(int8_t) + sizeof(int32_t))));
+
+      union xnn_qc8_gemm_params quantization_params = { };
+      switch (variant) {
+        case Variant::Native:
+          quantization_params = xnn_init_qc8_gemm_params(c_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+          break;
+        case Variant::Scalar:
+          quantization_params = xnn_init_scalar_qc8_gemm_params(c_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+          break;
+      }
+
+      gemm(
+        m(), n(), k(),
+        a.data(), a_stride() * sizeof(int8_t),
+        packed_w.data(),
+        c.data(), cm_stride() * sizeof(int8_t), cn_stride() * sizeof(int8_t),
+        &quantization_params);
+
+      for (size_t m_index = 0; m_index < m(); m_index++) {
+        for (size_t n_index = 0; n_index < n(); n_index++) {
+          c_ref[m_index * n() + n_index] = xnn_qs8_requantize_fp32(
+            acc[m_index * n() + n_index], scale[n_index], c_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+        }
+      }
+
+      for (size_t i = 0; i < m(); i++) {
+        for (size_t j = 0; j < n(); j++) {
+          ASSERT_LE(int32_t(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()]), int32_t(qmax()) - 0x80);
+          ASSERT_GE(int32_t(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()]), int32_t(qmin()) - 0x80);
+          ASSERT_EQ(int32_t(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()]), int32_t(c_ref[i * n() + j]))
+              << "at " << i << ", " << j << ": reference = " << int32_t(c_ref[i * n() + j])
+              << " (accumulator = " << acc[i * n() + j]
+              << "), optimized = " << int32_t(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()]) << ", Mr x Nr x Kr = " << mr() << " x "
+              << nr() << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k()
+              << ", requantization scale = " << scale[j] << ", output zero point = " << int32_t(c_zero_point);
+        }
+      }
+    }
+  }
+
+  void Test(xnn_qd8_f32_qc8w_gemm_ukernel_function gemm, Variant variant = Variant::Native) const {
+    ASSERT_LE(m(), mr());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(-127, std::numeric_limits<int8_t>::max()), rng);
+    auto zprng = std::bind(std::uniform_int_distribution<int32_t>(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()), rng);
+    auto scalerng = std::bind(std::uniform_real_distribution<float>(0.5f, 2.0f), rng);
+
+    std::vector<int8_t> a((m() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<xnn_qd8_quantization_params> quantization_params(mr());
+    std::vector<int8_t> b(n() * k());
+    std::vector<float> bias(n());
+    std::vector<float> scale(n());
+    std::vector<int8_t, AlignedAllocator<int8_t, 64>> packed_w(packed_n() * packed_k() + bias_n() * (sizeof(int32_t) + 2 * sizeof(float)) / sizeof(int8_t));
+    std::vector<float> c((mr() - 1) * cm_stride() + ((n() - 1) / nr()) * cn_stride() + (n() - 1) % nr() + 1);
+    std::vector<float> c_ref(m() * n());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), std::ref(i8rng));
+      std::generate(b.begin(), b.end(), std::ref(i8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+      for (size_t m_index = 0; m_index < mr(); m_index++) {
+        quantization_params[m_index].zero_point = zprng();
+        quantization_params[m_index].scale = scalerng() / 128.0f;
+      }
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        scale[n_index] = scalerng() / 128.0f;
+      }
+      std::fill(c.begin(), c.end(), nanf(""));
+
+      // Packing with unit input zero point stores negated sums of weights in place of the bias.
+      std::fill(packed_w.begin(), packed_w.end(), 0);
+      const xnn_qs8_packing_params packing_params = { 1 };
+      xnn_pack_qs8_gemm_goi_w(1, n(), k(), nr(), kr(), sr(),
+        b.data(), nullptr, packed_w.data(), nr() * 2 * sizeof(float), &packing_params);
+      const size_t weights_stride = packed_k() * sizeof(int8_t) + sizeof(int32_t);
+      xnn_init_qc8_scale_fp32_params(
+        n(), nr(), nr() * (weights_stride + 2 * sizeof(float)), scale.data(),
+        (void*) ((uintptr_t) packed_w.data() + nr() * weights_stride));
+      xnn_init_qc8_scale_fp32_params(
+        n(), nr(), nr() * (weights_stride + 2 * sizeof(float)), bias.data(),
+        (void*) ((uintptr_t) packed_w.data() + nr() * (weights_stride + sizeof(float))));
+
+      for (size_t m_index = 0; m_index < m(); m_index++) {
+        for (size_t n_index = 0; n_index < n(); n_index++) {
+          int32_t acc = 0;
+          for (size_t k_index = 0; k_index < k(); k_index++) {
+            acc +=
+                (int32_t(a[m_index * a_stride() + k_index]) - quantization_params[m_index].zero_point) *
+                int32_t(b[n_index * k() + k_index]);
+          }
+          c_ref[m_index * n() + n_index] =
+            float(acc) * (scale[n_index] * quantization_params[m_index].scale) + bias[n_index];
+        }
+      }
+
+      const float accumulated_min = *std::min_element(c_ref.cbegin(), c_ref.cend());
+      const float accumulated_max = *std::max_element(c_ref.cbegin(), c_ref.cend());
+      const float c_min = accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+      const float c_max = accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+      // Prepare parameters.
+      xnn_f32_minmax_params params = { };
+      switch (variant) {
+        case Variant::Native:
+          params = xnn_init_f32_minmax_params(c_min, c_max);
+          break;
+        case Variant::Scalar:
+          params = xnn_init_scalar_f32_minmax_params(c_min, c_max);
+          break;
+      }
+
+      for (size_t m_index = 0; m_index < m(); m_index++) {
+        for (size_t n_index = 0; n_index < n(); n_index++) {
+          c_ref[m_index * n() + n_index] = std::max(std::min(c_ref[m_index * n() + n_index], c_max), c_min);
+        }
+      }
+
+      gemm(
+        m(), n(), k(),
+        a.data(), a_stride() * sizeof(int8_t),
+        packed_w.data(),
+        c.data(), cm_stride() * sizeof(float), cn_stride() * sizeof(float),
+        &params, quantization_params.data());
+
+      for (size_t i = 0; i < m(); i++) {
+        for (size_t j = 0; j < n(); j++) {
+          ASSERT_LE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_max);
+          ASSERT_GE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_min);
+          ASSERT_NEAR(
+              c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()],
+              c_ref[i * n() + j],
+              std::max(std::abs(c_ref[i * n() + j]), 1.0f) * 1.0e-5f)
+              << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+              << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x "
+              << nr() << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k()
+              << ", input zero point = " << quantization_params[i].zero_point;
+        }
+      }
+    }
+  }
+
   void Test(xnn_qs8_gemm_xw_ukernel_function gemm, Variant variant = Variant::Native) const {
     ASSERT_LE(m(), mr());
 
@@ -556,7 +764,7 @@ class GemmMicrokernelTester {
       std::fill(packed_w.begin(), packed_w.end(), 0);
       const xnn_qs8_packing_params packing_params = { int8_t(a_zero_point() - 0x80) };
       xnn_pack_qs8_gemm_xw_goi_w(1, n(), k(), nr(), kr(), sr(),
-        b.data(), bias.data(), packed_w.data(), &packing_params);
+        b.data(), bias.data(), packed_w.data(), 0, &packing_params);
 
       // Compute 32-bit results and output quantization arguments.
       std::fill(acc.begin(), acc.end(), 0);
@@ -654,7 +862,7 @@ class GemmMicrokernelTester {
       const xnn_qs8_packing_params packing_params = { int8_t(a_zero_point() - 0x80) };
       xnn_pack_qs8_conv_goki_w(
         1, n(), ks(), k(), nr(), kr(), sr(),
-        b.data(), bias.data(), packed_w.data(), &packing_params);
+        b.data(), bias.data(), packed_w.data(), 0, &packing_params);
 
       for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
         for (size_t m_index = 0; m_index < mr(); m_index++) {
@@ -745,6 +953,141 @@ class GemmMicrokernelTester {
     }
   }
 
+  void Test(xnn_qc8_igemm_ukernel_function igemm, Variant variant = Variant::Native) const {
+    ASSERT_LE(m(), mr());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()), rng);
+    auto scalerng = std::bind(std::uniform_real_distribution<float>(0.5f, 2.0f), rng);
+
+    std::vector<int8_t> a((mr() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(uint8_t));
+    std::vector<int8_t> b(n() * ks() * k());
+    std::vector<int8_t, AlignedAllocator<int8_t, 64>> packed_w(ks() * packed_n() * packed_k() + bias_n() * (sizeof(int32_t) + sizeof(float)) / sizeof(int8_t));
+    std::vector<int32_t> bias(n());
+    std::vector<float> scale(n());
+    std::vector<int8_t> c((mr() - 1) * cm_stride() + ((n() - 1) / nr()) * cn_stride() + (n() - 1) % nr() + 1);
+    std::vector<int32_t> acc(m() * n());
+    std::vector<int8_t> c_ref(m() * n());
+    std::vector<int8_t> junk(k() + 8);
+    std::vector<const int8_t*> im2col(mr() * ks());
+
+    std::fill(junk.begin(), junk.end(), 0xA5);
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      do {
+        std::generate(a.begin(), a.end(), std::ref(i8rng));
+      } while (a.size() > 1 && *std::max_element(a.cbegin(), a.cend()) == *std::min_element(a.cbegin(), a.cend()));
+      do {
+        std::generate(b.begin(), b.end(), std::ref(i8rng));
+      } while (b.size() > 1 && *std::max_element(b.cbegin(), b.cend()) == *std::min_element(b.cbegin(), b.cend()));
+      std::generate(bias.begin(), bias.end(), std::ref(i32rng));
+      std::fill(c.begin(), c.end(), 0xA5);
+
+      std::fill(packed_w.begin(), packed_w.end(), 0);
+      const xnn_qs8_packing_params packing_params = { int8_t(a_zero_point() - 0x80) };
+      xnn_pack_qs8_conv_goki_w(
+        1, n(), ks(), k(), nr(), kr(), sr(),
+        b.data(), bias.data(), packed_w.data(), nr() * sizeof(float), &packing_params);
+
+      for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
+        for (size_t m_index = 0; m_index < mr(); m_index++) {
+          im2col[ks_index * mr() + m_index] = a.data() + a_stride() * m_index - a_offset();
+        }
+
+      }
+      std::shuffle(im2col.begin(), im2col.end(), rng);
+      if (zero_index() != SIZE_MAX) {
+        for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
+          im2col[ks_index * mr() + zero_index()] = a.data();
+        }
+      }
+      for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
+        for (size_t m_index = m(); m_index < mr(); m_index++) {
+          im2col[ks_index * mr() + m_index] = junk.data();
+        }
+      }
+
+      // Compute 32-bit results and output quantization arguments.
+      std::fill(acc.begin(), acc.end(), 0);
+      for (size_t m_index = 0; m_index < m(); m_index++) {
+        for (size_t n_index = 0; n_index < n(); n_index++) {
+          for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
+            for (size_t k_index = 0; k_index < k(); k_index++) {
+              if (im2col[ks_index * mr() + m_index] == a.data()) {
+                acc[m_index * n() + n_index] +=
+                  (int32_t(im2col[ks_index * mr() + m_index][k_index]) - int32_t(a_zero_point() - 0x80)) *
+                  int32_t(b[(n_index * ks() + ks_index) * k() + k_index]);
+              } else {
+                acc[m_index * n() + n_index] +=
+                  (int32_t(im2col[ks_index * mr() + m_index][k_index + a_offset()]) - int32_t(a_zero_point() - 0x80)) *
+                  int32_t(b[(n_index * ks() + ks_index) * k() + k_index]);
+              }
+            }
+          }
+          acc[m_index * n() + n_index] += bias[n_index];
+        }
+      }
+
+      const int32_t accumulated_min = *std::min_element(acc.cbegin(), acc.cend());
+      const int32_t accumulated_max = *std::max_element(acc.cbegin(), acc.cend());
+      const double c_scale = uint32_t(accumulated_max - accumulated_min) >= 256 ? double(uint32_t(accumulated_max - accumulated_min)) / 255.0 : 1.00001;
+      const int8_t c_zero_point = int8_t(std::max(std::min(
+        lrint(-0.5 - 0.5 * double(accumulated_min + accumulated_max) / c_scale),
+        long(std::numeric_limits<int8_t>::max())), long(std::numeric_limits<int8_t>::min())));
+
+      // Perturb the common requantization scale to get a distinct scale for every output channel.
+      const float requantization_scale = 1.0f / float(c_scale);
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        scale[n_index] = requantization_scale * scalerng();
+      }
+      xnn_init_qc8_scale_fp32_params(
+        n(), nr(), nr() * (ks() * packed_k() * sizeof(int8_t) + sizeof(int32_t) + sizeof(float)), scale.data(),
+        (void*) ((uintptr_t) packed_w.data() + nr() * (ks() * packed_k() * sizeof(int8_t) + sizeof(int32_t))));
+
+      union xnn_qc8_gemm_params quantization_params = { };
+      switch (variant) {
+        case Variant::Native:
+          quantization_params = xnn_init_qc8_gemm_params(c_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+          break;
+        case Variant::Scalar:
+          quantization_params = xnn_init_scalar_qc8_gemm_params(c_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+          break;
+      }
+
+      const int8_t* zero_pointer = (zero_index() != SIZE_MAX) ? a.data() : NULL;
+
+      igemm(
+        m(), n(), k(), ks() * mr() * sizeof(void*),
+        im2col.data(), packed_w.data(),
+        c.data(), cm_stride() * sizeof(int8_t), cn_stride() * sizeof(int8_t),
+        a_offset() * sizeof(uint8_t), zero_pointer,
+        &quantization_params);
+
+      for (size_t m_index = 0; m_index < m(); m_index++) {
+        for (size_t n_index = 0; n_index < n(); n_index++) {
+          c_ref[m_index * n() + n_index] = xnn_qs8_requantize_fp32(
+            acc[m_index * n() + n_index], scale[n_index], c_zero_point, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+        }
+      }
+
+      for (size_t i = 0; i < m(); i++) {
+        for (size_t j = 0; j < n(); j++) {
+          ASSERT_LE(int32_t(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()]), int32_t(qmax()) - 0x80);
+          ASSERT_GE(int32_t(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()]), int32_t(qmin()) - 0x80);
+          ASSERT_EQ(int32_t(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()]), int32_t(c_ref[i * n() + j]))
+              << "at " << i << ", " << j << ": reference = " << int32_t(c_ref[i * n() + j])
+              << " (accumulator = " << acc[i * n() + j]
+              << "), optimized = " << int32_t(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()]) << ", Mr x Nr x Kr = " << mr() << " x "
+              << nr() << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k()
+              << ", requantization scale = " << scale[j] << ", output zero point = " << int32_t(c_zero_point);
+        }
+      }
+    }
+  }
+
   void Test(xnn_f16_gemm_minmax_ukernel_function gemm_minmax, Variant variant = Variant::Native) const
   {
     ASSERT_LE(m(), mr());
@@ -771,7 +1114,7 @@ class GemmMicrokernelTester {
       std::fill(c_ref.begin(), c_ref.end(), 0.0f);
 
       std::fill(packed_w.begin(), packed_w.end(), 0);
-      xnn_pack_f16_gemm_goi_w(1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(), packed_w.data(), nullptr);
+      xnn_pack_f16_gemm_goi_w(1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(), packed_w.data(), 0, nullptr);
 
       for (size_t m_index = 0; m_index < m(); m_index++) {
         for (size_t n_index = 0; n_index < n(); n_index++) {
@@ -848,7 +1191,7 @@ class GemmMicrokernelTester {
       std::fill(packed_w.begin(), packed_w.end(), 0);
       xnn_pack_f16_conv_goki_w(
         1, n(), ks(), k(), nr(), kr(), sr(),
-        b.data(), bias.data(), packed_w.data(), nullptr);
+        b.data(), bias.data(), packed_w.data(), 0, nullptr);
 
       for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
         for (size_t m_index = 0; m_index < mr(); m_index++) {
@@ -962,7 +1305,7 @@ class GemmMicrokernelTester {
       std::fill(c_ref.begin(), c_ref.end(), 0.0f);
 
       std::fill(packed_w.begin(), packed_w.end(), 0.0f);
-      xnn_pack_f32_gemm_goi_w(1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(), packed_w.data(), nullptr);
+      xnn_pack_f32_gemm_goi_w(1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(), packed_w.data(), 0, nullptr);
 
       for (size_t i = m(); i < mr(); i++) {
         for (size_t l = 0; l < k(); l++) {
@@ -1045,7 +1388,7 @@ class GemmMicrokernelTester {
       std::fill(c_ref.begin(), c_ref.end(), 0.0f);
 
       std::fill(packed_w.begin(), packed_w.end(), 0.0f);
-      xnn_pack_f32_gemm_goi_w(1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(), packed_w.data(), nullptr);
+      xnn_pack_f32_gemm_goi_w(1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(), packed_w.data(), 0, nullptr);
 
       for (size_t m_index = 0; m_index < m(); m_index++) {
         for (size_t n_index = 0; n_index < n(); n_index++) {
@@ -1105,7 +1448,7 @@ class GemmMicrokernelTester {
       std::fill(c_ref.begin(), c_ref.end(), 0.0f);
 
       std::fill(packed_w.begin(), packed_w.end(), 0.0f);
-      xnn_pack_f32_gemm_goi_w(1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(), packed_w.data(), nullptr);
+      xnn_pack_f32_gemm_goi_w(1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(), packed_w.data(), 0, nullptr);
 
       for (size_t m_index = 0; m_index < m(); m_index++) {
         for (size_t n_index = 0; n_index < n(); n_index++) {
@@ -1169,7 +1512,7 @@ class GemmMicrokernelTester {
       std::fill(c_ref.begin(), c_ref.end(), 0.0f);
 
       std::fill(packed_w.begin(), packed_w.end(), 0.0f);
-      xnn_pack_f32_gemm_goi_w(1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(), packed_w.data(), nullptr);
+      xnn_pack_f32_gemm_goi_w(1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(), packed_w.data(), 0, nullptr);
 
       for (size_t m_index = 0; m_index < m(); m_index++) {
         for (size_t n_index = 0; n_index < n(); n_index++) {
@@ -1235,6 +1578,83 @@ class GemmMicrokernelTester {
     }
   }
 
+  void Test(xnn_f32_gemm_hswish_ukernel_function gemm_hswish, Variant variant = Variant::Native) const {
+    ASSERT_LE(m(), mr());
+    ASSERT_GE(a_stride(), k());
+    ASSERT_GE(cm_stride(), n());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+
+    std::vector<float> a((m() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> b(n() * k());
+    std::vector<float> bias(n());
+    std::vector<float, AlignedAllocator<float, 64>> packed_w(packed_n() * packed_k() + bias_n());
+    std::vector<float> c((mr() - 1) * cm_stride() + ((n() - 1) / nr()) * cn_stride() + (n() - 1) % nr() + 1);
+    std::vector<float> c_ref(m() * n());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), std::ref(f32rng));
+      std::generate(b.begin(), b.end(), std::ref(f32rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+      std::fill(c.begin(), c.end(), nanf(""));
+      std::fill(c_ref.begin(), c_ref.end(), 0.0f);
+
+      std::fill(packed_w.begin(), packed_w.end(), 0.0f);
+      xnn_pack_f32_gemm_goi_w(1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(), packed_w.data(), 0, nullptr);
+
+      for (size_t m_index = 0; m_index < m(); m_index++) {
+        for (size_t n_index = 0; n_index < n(); n_index++) {
+          for (size_t k_index = 0; k_index < k(); k_index++) {
+            ASSERT_LE(n(), packed_n());
+            ASSERT_LT(m_index * n() + n_index, c_ref.size());
+            c_ref[m_index * n() + n_index] +=
+              a[m_index * a_stride() + k_index] *
+              b[n_index * k() + k_index];
+          }
+          c_ref[m_index * n() + n_index] += bias[n_index];
+        }
+      }
+      for (size_t m_index = 0; m_index < m(); m_index++) {
+        for (size_t n_index = 0; n_index < n(); n_index++) {
+          const float x = c_ref[m_index * n() + n_index];
+          c_ref[m_index * n() + n_index] = x * std::min(std::max(x + 3.0f, 0.0f), 6.0f) / 6.0f;
+        }
+      }
+
+      // Prepare parameters.
+      xnn_f32_hswish_params params = { };
+      switch (variant) {
+        case Variant::Native:
+          params = xnn_init_f32_hswish_params();
+          break;
+        case Variant::Scalar:
+          params = xnn_init_scalar_f32_hswish_params();
+          break;
+      }
+
+      gemm_hswish(m(), n(), k() * sizeof(float),
+        a.data(), a_stride() * sizeof(float),
+        packed_w.data(),
+        c.data(), cm_stride() * sizeof(float), cn_stride() * sizeof(float),
+        &params);
+
+      // Validate micro-kernel outputs.
+      for (size_t i = 0; i < m(); i++) {
+        for (size_t j = 0; j < n(); j++) {
+          ASSERT_NEAR(
+              c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()],
+              c_ref[i * n() + j],
+              std::max(1.0e-6f, std::abs(c_ref[i * n() + j]) * 1.0e-5f))
+              << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+              << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+              << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        }
+      }
+    }
+  }
+
   void Test(xnn_f32_gemminc_minmax_ukernel_function gemminc, Variant variant = Variant::Native) const {
     ASSERT_LE(m(), mr());
     ASSERT_GE(a_stride(), k());
@@ -1354,7 +1774,7 @@ class GemmMicrokernelTester {
       std::fill(packed_w.begin(), packed_w.end(), 0.0f);
       xnn_pack_f32_conv_goki_w(
         1, n(), ks(), k(), nr(), kr(), sr(),
-        b.data(), bias.data(), packed_w.data(), nullptr);
+        b.data(), bias.data(), packed_w.data(), 0, nullptr);
 
       for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
         for (size_t m_index = 0; m_index < mr(); m_index++) {
@@ -1446,7 +1866,7 @@ class GemmMicrokernelTester {
       std::fill(packed_w.begin(), packed_w.end(), 0.0f);
       xnn_pack_f32_conv_goki_w(
         1, n(), ks(), k(), nr(), kr(), sr(),
-        b.data(), bias.data(), packed_w.data(), nullptr);
+        b.data(), bias.data(), packed_w.data(), 0, nullptr);
 
       for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
         for (size_t m_index = 0; m_index < mr(); m_index++) {
@@ -1542,7 +1962,7 @@ class GemmMicrokernelTester {
       std::fill(packed_w.begin(), packed_w.end(), 0.0f);
       xnn_pack_f32_conv_goki_w(
         1, n(), ks(), k(), nr(), kr(), sr(),
-        b.data(), bias.data(), packed_w.data(), nullptr);
+        b.data(), bias.data(), packed_w.data(), 0, nullptr);
 
       for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
         for (size_t m_index = 0; m_index < mr(); m_index++) {
@@ -1637,6 +2057,115 @@ class GemmMicrokernelTester {
     }
   }
 
+  void Test(xnn_f32_igemm_hswish_ukernel_function igemm_hswish, Variant variant = Variant::Native) const {
+    ASSERT_LE(m(), mr());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+
+    std::vector<float> a((mr() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> b(n() * ks() * k());
+    std::vector<float, AlignedAllocator<float, 64>> packed_w(ks() * packed_k() * packed_n() + bias_n());
+    std::vector<float> bias(n());
+    std::vector<float> c((mr() - 1) * cm_stride() + ((n() - 1) / nr()) * cn_stride() + (n() - 1) % nr() + 1);
+    std::vector<float> c_ref(m() * n());
+    std::vector<float> junk(k() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<const float*> im2col(mr() * ks());
+    std::fill(junk.begin(), junk.end(), nanf(""));
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), std::ref(f32rng));
+      std::generate(b.begin(), b.end(), std::ref(f32rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+      std::fill(c.begin(), c.end(), nanf(""));
+      std::fill(c_ref.begin(), c_ref.end(), 0.0f);
+
+      std::fill(packed_w.begin(), packed_w.end(), 0.0f);
+      xnn_pack_f32_conv_goki_w(
+        1, n(), ks(), k(), nr(), kr(), sr(),
+        b.data(), bias.data(), packed_w.data(), 0, nullptr);
+
+      for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
+        for (size_t m_index = 0; m_index < mr(); m_index++) {
+          im2col[ks_index * mr() + m_index] = a.data() + a_stride() * m_index - a_offset();
+        }
+      }
+      std::shuffle(im2col.begin(), im2col.end(), rng);
+      if (zero_index() != SIZE_MAX) {
+        for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
+          im2col[ks_index * mr() + zero_index()] = a.data();
+        }
+      }
+      for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
+        for (size_t m_index = m(); m_index < mr(); m_index++) {
+          im2col[ks_index * mr() + m_index] = junk.data();
+        }
+      }
+
+      std::fill(c_ref.begin(), c_ref.end(), 0.0);
+      for (size_t m_index = 0; m_index < m(); m_index++) {
+        for (size_t n_index = 0; n_index < n(); n_index++) {
+          for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
+            for (size_t k_index = 0; k_index < k(); k_index++) {
+              ASSERT_LT(ks_index * mr() + m_index, im2col.size());
+              ASSERT_LT(k_index, k());
+              ASSERT_LT(k_index, a_stride());
+              if (im2col[ks_index * mr() + m_index] == a.data()) {
+                c_ref[m_index * n() + n_index] +=
+                  (im2col[ks_index * mr() + m_index][k_index]) *
+                  (b[(n_index * ks() + ks_index) * k() + k_index]);
+              } else {
+                c_ref[m_index * n() + n_index] +=
+                  (im2col[ks_index * mr() + m_index][k_index + a_offset()]) *
+                  (b[(n_index * ks() + ks_index) * k() + k_index]);
+              }
+            }
+          }
+          c_ref[m_index * n() + n_index] += bias[n_index];
+        }
+      }
+      for (size_t m_index = 0; m_index < m(); m_index++) {
+        for (size_t n_index = 0; n_index < n(); n_index++) {
+          const float x = c_ref[m_index * n() + n_index];
+          c_ref[m_index * n() + n_index] = x * std::min(std::max(x + 3.0f, 0.0f), 6.0f) / 6.0f;
+        }
+      }
+
+      // Prepare parameters.
+      xnn_f32_hswish_params params = { };
+      switch (variant) {
+        case Variant::Native:
+          params = xnn_init_f32_hswish_params();
+          break;
+        case Variant::Scalar:
+          params = xnn_init_scalar_f32_hswish_params();
+          break;
+      }
+
+      const float* zero_pointer = (zero_index() != SIZE_MAX) ? a.data() : NULL;
+
+      igemm_hswish(
+        m(), n(), k() * sizeof(float), ks() * mr() * sizeof(void*),
+        im2col.data(), packed_w.data(),
+        c.data(), cm_stride() * sizeof(float), cn_stride() * sizeof(float),
+        a_offset() * sizeof(float), zero_pointer,
+        &params);
+
+      for (size_t i = 0; i < m(); i++) {
+        for (size_t j = 0; j < n(); j++) {
+          ASSERT_NEAR(
+              c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()],
+              c_ref[i * n() + j],
+              std::max(1.0e-6f, std::abs(c_ref[i * n() + j]) * 1.0e-5f))
+              << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+              << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+              << " x " << kr() << ", M x N x KC x KS = " << m() << " x " << n() << " x " << k() << " x " << ks();
+        }
+      }
+    }
+  }
+
  private:
   size_t mr_{1};
   size_t nr_{1};
@@ -19,6 +19,7 @@
 #include <random>
 #include <vector>
 
+#include <xnnpack.h>
 #include <xnnpack/params.h>
 
 
@@ -57,9 +58,9 @@ class LUTMicrokernelTester {
     auto rng = std::mt19937(random_device());
     auto u8rng = std::bind(std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<uint8_t>::max()), rng);
 
-    std::vector<uint8_t> x(n());
+    std::vector<uint8_t> x(n() + XNN_EXTRA_BYTES / sizeof(uint8_t));
     std::vector<uint8_t> t(256);
-    std::vector<uint8_t> y(n());
+    std::vector<uint8_t> y(n() + (inplace() ? XNN_EXTRA_BYTES / sizeof(uint8_t) : 0));
     std::vector<uint8_t> y_ref(n());
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
       std::generate(x.begin(), x.end(), std::ref(u8rng));
@@ -164,3 +164,225 @@ TEST(MemoryPlanner, GeneralPlanning) {
 
   xnn_release_value_allocation_tracker(&tracker);
 }
+
+TEST(MemoryPlanner, TensorReuse) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  struct xnn_subgraph subgraph;
+  subgraph.num_nodes = 0;
+  subgraph.num_values = 4;
+  struct xnn_value_allocation_tracker tracker;
+  xnn_init_value_allocation_tracker(&tracker, &subgraph);
+  // As this is an empty subgraph, we create the following xnn_value_usage stub.
+  tracker.usage[0].first_node = 0,
+  tracker.usage[0].last_node = 1,
+  xnn_add_value_allocation_tracker(&tracker, 0, 64);
+
+  tracker.usage[1].first_node = 1,
+  tracker.usage[1].last_node = 2,
+  xnn_add_value_allocation_tracker(&tracker, 1, 64);
+
+  tracker.usage[2].first_node = 2,
+  tracker.usage[2].last_node = 3,
+  xnn_add_value_allocation_tracker(&tracker, 2, 32);
+
+  tracker.usage[3].first_node = 3,
+  tracker.usage[3].last_node = 3,
+  xnn_add_value_allocation_tracker(&tracker, 3, 64);
+
+  // Value 1 aliases value 0, which must then stay alive until node 2.
+  xnn_mark_tensor_as_reuse(&tracker, 1, 0, tracker.usage[1].last_node);
+  EXPECT_EQ(2, tracker.usage[0].last_node);
+
+  xnn_plan_value_allocation_tracker(&tracker);
+
+#if XNN_ENABLE_MEMOPT
+  EXPECT_EQ(96, tracker.mem_arena_size);
+  EXPECT_EQ(0, tracker.usage[0].alloc_offset);
+  EXPECT_EQ(0, tracker.usage[1].alloc_offset);
+  EXPECT_EQ(64, tracker.usage[2].alloc_offset);
+  EXPECT_EQ(0, tracker.usage[3].alloc_offset);
+#else
+  EXPECT_EQ(160, tracker.mem_arena_size);
+  EXPECT_EQ(0, tracker.usage[0].alloc_offset);
+  EXPECT_EQ(0, tracker.usage[1].alloc_offset);
+  EXPECT_EQ(64, tracker.usage[2].alloc_offset);
+  EXPECT_EQ(96, tracker.usage[3].alloc_offset);
+#endif
+
+  xnn_release_value_allocation_tracker(&tracker);
+}
+
+TEST(MemoryPlanner, TensorViews) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  struct xnn_subgraph subgraph;
+  subgraph.num_nodes = 0;
+  subgraph.num_values = 3;
+  struct xnn_value_allocation_tracker tracker;
+  xnn_init_value_allocation_tracker(&tracker, &subgraph);
+  // As this is an empty subgraph, we create the following xnn_value_usage stub.
+  tracker.usage[0].first_node = 2,
+  tracker.usage[0].last_node = 3,
+  xnn_add_value_allocation_tracker(&tracker, 0, 64);
+
+  // Value 1 is a view of a slice of value 0, and is not allocated in the memory arena.
+  tracker.usage[1].first_node = 0;
+  tracker.usage[1].last_node = 2;
+
+  tracker.usage[2].first_node = 0,
+  tracker.usage[2].last_node = 1,
+  xnn_add_value_allocation_tracker(&tracker, 2, 64);
+
+  // Value 0 must be alive as soon as its view is written by node 0.
+  xnn_mark_tensor_as_view(&tracker, 1, 0);
+  EXPECT_EQ(0, tracker.usage[0].first_node);
+  EXPECT_EQ(3, tracker.usage[0].last_node);
+
+  xnn_plan_value_allocation_tracker(&tracker);
+
+  EXPECT_EQ(128, tracker.mem_arena_size);
+  EXPECT_NE(tracker.usage[0].alloc_offset, tracker.usage[2].alloc_offset);
+
+  xnn_release_value_allocation_tracker(&tracker);
+}
+
+TEST(MemoryPlanner, InPlaceElementwise) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  // Create subgraph with 4 elementwise nodes and 5 tensors of the same shape as illustrated below:
+  // T0 ----> N0 (HardSwish) ----> T1 ----> N1 (Sigmoid) ----> T2
+  // T1, T2 ----> N2 (Multiply) ----> T3 ----> N3 (Clamp) ----> T4
+  struct xnn_value values[5] = {};
+  for (uint32_t i = 0; i < 5; i++) {
+    values[i].id = i;
+    values[i].type = xnn_value_type_dense_tensor;
+    values[i].datatype = xnn_datatype_fp32;
+    values[i].shape.num_dims = 2;
+    values[i].shape.dim[0] = 1;
+    values[i].shape.dim[1] = 8;
+  }
+  struct xnn_node nodes[4] = {};
+  nodes[0].type = xnn_node_type_hardswish;
+  nodes[0].num_inputs = 1;
+  nodes[0].inputs[0] = 0;
+  nodes[0].num_outputs = 1;
+  nodes[0].outputs[0] = 1;
+
+  nodes[1].type = xnn_node_type_sigmoid;
+  nodes[1].num_inputs = 1;
+  nodes[1].inputs[0] = 1;
+  nodes[1].num_outputs = 1;
+  nodes[1].outputs[0] = 2;
+
+  nodes[2].type = xnn_node_type_multiply2;
+  nodes[2].num_inputs = 2;
+  nodes[2].inputs[0] = 1;
+  nodes[2].inputs[1] = 2;
+  nodes[2].num_outputs = 1;
+  nodes[2].outputs[0] = 3;
+
+  nodes[3].type = xnn_node_type_clamp;
+  nodes[3].num_inputs = 1;
+  nodes[3].inputs[0] = 3;
+  nodes[3].num_outputs = 1;
+  nodes[3].outputs[0] = 4;
+
+  struct xnn_subgraph subgraph;
+  subgraph.num_values = 5;
+  subgraph.values = values;
+  subgraph.num_nodes = 4;
+  subgraph.nodes = nodes;
+
+  struct xnn_value_allocation_tracker tracker;
+  xnn_init_value_allocation_tracker(&tracker, &subgraph);
+  // T0 is an external input, and is not allocated in the memory arena.
+  for (uint32_t i = 1; i < 5; i++) {
+    xnn_add_value_allocation_tracker(&tracker, i, 32);
+  }
+  xnn_plan_in_place_operations(&tracker);
+  xnn_plan_value_allocation_tracker(&tracker);
+
+#if XNN_ENABLE_MEMOPT
+  // T1 is still used by N2, so N1 can't run in-place.
+  EXPECT_EQ(XNN_INVALID_VALUE_ID, tracker.usage[2].reuse_value_id);
+  EXPECT_EQ(1, tracker.usage[3].reuse_value_id);
+  EXPECT_EQ(3, tracker.usage[4].reuse_value_id);
+  EXPECT_EQ(3, tracker.usage[1].last_node);
+
+  EXPECT_EQ(64, tracker.mem_arena_size);
+  EXPECT_NE(tracker.usage[1].alloc_offset, tracker.usage[2].alloc_offset);
+  EXPECT_EQ(tracker.usage[1].alloc_offset, tracker.usage[3].alloc_offset);
+  EXPECT_EQ(tracker.usage[1].alloc_offset, tracker.usage[4].alloc_offset);
+#else
+  EXPECT_EQ(128, tracker.mem_arena_size);
+#endif
+
+  xnn_release_value_allocation_tracker(&tracker);
+}
+
+TEST(MemoryPlanner, LifecycleLevels) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  // Create subgraph with 2 independent branches as illustrated below, where N0 and N2 run on level 0, N1 on level 1,
+  // and N3 on level 2:
+  // T0 ----> N0 ----> T1 ----> N1 ----> T2
+  // T0 ----> N2 ----> T3
+  // T2, T3 ----> N3 ----> T4
+  struct xnn_node nodes[4] = {};
+  nodes[0].num_inputs = 1;
+  nodes[0].inputs[0] = 0;
+  nodes[0].num_outputs = 1;
+  nodes[0].outputs[0] = 1;
+
+  nodes[1].num_inputs = 1;
+  nodes[1].inputs[0] = 1;
+  nodes[1].num_outputs = 1;
+  nodes[1].outputs[0] = 2;
+
+  nodes[2].num_inputs = 1;
+  nodes[2].inputs[0] = 0;
+  nodes[2].num_outputs = 1;
+  nodes[2].outputs[0] = 3;
+
+  nodes[3].num_inputs = 2;
+  nodes[3].inputs[0] = 2;
+  nodes[3].inputs[1] = 3;
+  nodes[3].num_outputs = 1;
+  nodes[3].outputs[0] = 4;
+
+  struct xnn_subgraph subgraph;
+  subgraph.num_values = 5;
+  subgraph.num_nodes = 4;
+  subgraph.nodes = nodes;
+
+  const uint32_t node_levels[4] = {0, 1, 0, 2};
+  struct xnn_value_allocation_tracker tracker;
+  xnn_init_value_allocation_tracker(&tracker, &subgraph);
+  xnn_assign_value_lifecycle_levels(&tracker, node_levels);
+  // T0 is an external input, and is not allocated in the memory arena.
+  for (uint32_t i = 1; i < 5; i++) {
+    xnn_add_value_allocation_tracker(&tracker, i, 32);
+  }
+  xnn_plan_value_allocation_tracker(&tracker);
+
+#if XNN_ENABLE_MEMOPT
+  EXPECT_EQ(0, tracker.usage[0].first_node);
+  EXPECT_EQ(0, tracker.usage[0].last_node);
+
+  EXPECT_EQ(0, tracker.usage[1].first_node);
+  EXPECT_EQ(1, tracker.usage[1].last_node);
+
+  EXPECT_EQ(1, tracker.usage[2].first_node);
+  EXPECT_EQ(2, tracker.usage[2].last_node);
+
+  EXPECT_EQ(0, tracker.usage[3].first_node);
+  EXPECT_EQ(2, tracker.usage[3].last_node);
+
+  EXPECT_EQ(2, tracker.usage[4].first_node);
+  EXPECT_EQ(2, tracker.usage[4].last_node);
+
+  // In execution order T1 is dead before T3 is produced, but N0 and N2 may run concurrently.
+  EXPECT_NE(tracker.usage[1].alloc_offset, tracker.usage[3].alloc_offset);
+#else
+  EXPECT_EQ(128, tracker.mem_arena_size);
+#endif
+
+  xnn_release_value_allocation_tracker(&tracker);
+}
@@ -764,6 +764,204 @@
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 
 
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__NEON_MUL16, c_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(kernel_size)
+        .channels(8)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__NEON_MUL16, c_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__NEON_MUL16, c_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 1; channels < 8; channels++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__NEON_MUL16, c_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 9; channels < 16; channels++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__NEON_MUL16, c_gt_8_with_qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__NEON_MUL16, c_gt_8_with_qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__NEON_MUL16, multipixel) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size += 7) {
+      for (size_t channels = 1; channels <= 40; channels += 7) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .width(3)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__NEON_MUL16, multipixel_with_step) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 18; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__NEON_MUL16, multipixel_with_output_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__NEON_MUL16, multipixel_with_qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__NEON_MUL16, multipixel_with_qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__NEON_MUL16, input_offset) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .input_offset(176)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__NEON_MUL16, zero) {
+    TEST_REQUIRES_ARM_NEON;
+    for (uint32_t mz = 0; mz < 18; mz++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .input_offset(176)
+          .zero_index(mz)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__neon_mul16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
   TEST(QS8_DWCONV_MINMAX_UP8X9__SSE2_MUL16, c_eq_8) {
     TEST_REQUIRES_X86_SSE2;
@@ -1322,6 +1520,204 @@
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE2_MUL16, c_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(kernel_size)
+        .channels(8)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE2_MUL16, c_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE2_MUL16, c_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 1; channels < 8; channels++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE2_MUL16, c_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 9; channels < 16; channels++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE2_MUL16, c_gt_8_with_qmin) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE2_MUL16, c_gt_8_with_qmax) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE2_MUL16, multipixel) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size += 7) {
+      for (size_t channels = 1; channels <= 40; channels += 7) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .width(3)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE2_MUL16, multipixel_with_step) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 18; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE2_MUL16, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE2_MUL16, multipixel_with_qmin) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE2_MUL16, multipixel_with_qmax) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE2_MUL16, input_offset) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .input_offset(176)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE2_MUL16, zero) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t mz = 0; mz < 18; mz++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .input_offset(176)
+          .zero_index(mz)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse2_mul16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
   TEST(QS8_DWCONV_MINMAX_UP8X9__SSSE3_MUL16, c_eq_8) {
     TEST_REQUIRES_X86_SSSE3;
@@ -1880,6 +2276,204 @@
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSSE3_MUL16, c_eq_8) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(kernel_size)
+        .channels(8)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSSE3_MUL16, c_div_8) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSSE3_MUL16, c_lt_8) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 1; channels < 8; channels++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSSE3_MUL16, c_gt_8) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 9; channels < 16; channels++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSSE3_MUL16, c_gt_8_with_qmin) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSSE3_MUL16, c_gt_8_with_qmax) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSSE3_MUL16, multipixel) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size += 7) {
+      for (size_t channels = 1; channels <= 40; channels += 7) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .width(3)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSSE3_MUL16, multipixel_with_step) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 18; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSSE3_MUL16, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSSE3_MUL16, multipixel_with_qmin) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSSE3_MUL16, multipixel_with_qmax) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSSE3_MUL16, input_offset) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .input_offset(176)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSSE3_MUL16, zero) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (uint32_t mz = 0; mz < 18; mz++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .input_offset(176)
+          .zero_index(mz)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__ssse3_mul16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
   TEST(QS8_DWCONV_MINMAX_UP8X9__SSE41_MUL16, c_eq_8) {
     TEST_REQUIRES_X86_SSE41;
@@ -2438,6 +3032,204 @@
 #endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 
 
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE41_MUL16, c_eq_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(kernel_size)
+        .channels(8)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE41_MUL16, c_div_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE41_MUL16, c_lt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 1; channels < 8; channels++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE41_MUL16, c_gt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size++) {
+      for (uint32_t channels = 9; channels < 16; channels++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE41_MUL16, c_gt_8_with_qmin) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE41_MUL16, c_gt_8_with_qmax) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE41_MUL16, multipixel) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t kernel_size = 10; kernel_size <= 26; kernel_size += 7) {
+      for (size_t channels = 1; channels <= 40; channels += 7) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(kernel_size)
+          .channels(channels)
+          .width(3)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE41_MUL16, multipixel_with_step) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      for (size_t step = 2; step <= 18; step++) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .width(3)
+          .step(step)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16);
+      }
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE41_MUL16, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(8)
+        .width(5)
+        .output_stride(43)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE41_MUL16, multipixel_with_qmin) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE41_MUL16, multipixel_with_qmax) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t channels = 1; channels <= 40; channels += 7) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE41_MUL16, input_offset) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DWConvMicrokernelTester()
+        .cr(8)
+        .primary_tile(9)
+        .incremental_tile(8)
+        .kr(18)
+        .channels(channels)
+        .input_offset(176)
+        .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16);
+    }
+  }
+
+  TEST(QS8_DWCONV_MINMAX_MP8X9P8__SSE41_MUL16, zero) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t mz = 0; mz < 18; mz++) {
+      for (uint32_t channels = 16; channels < 128; channels += 24) {
+        DWConvMicrokernelTester()
+          .cr(8)
+          .primary_tile(9)
+          .incremental_tile(8)
+          .kr(18)
+          .channels(channels)
+          .input_offset(176)
+          .zero_index(mz)
+          .Test(xnn_qs8_dwconv_minmax_ukernel_mp8x9p8__sse41_mul16);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
   TEST(QS8_DWCONV_MINMAX_UP8X9__AVX_MUL16, c_eq_8) {
     TEST_REQUIRES_X86_AVX;
@@ -67,6 +67,32 @@ class RMaxMicrokernelTester {
     }
   }
 
+  void Test(xnn_s8_rmax_ukernel_function rmax) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+      rng);
+
+    std::vector<int8_t> x(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(i8rng));
+
+      // Compute reference results.
+      int8_t y_ref = std::numeric_limits<int8_t>::min();
+      for (size_t i = 0; i < n(); i++) {
+        y_ref = std::max(y_ref, x[i]);
+      }
+
+      // Call optimized micro-kernel.
+      int8_t y = i8rng();
+      rmax(n() * sizeof(int8_t), x.data(), &y);
+
+      // Verify results.
+      ASSERT_EQ(int32_t(y_ref), int32_t(y)) << "n = " << n();
+    }
+  }
+
   void Test(xnn_f32_rmax_ukernel_function rmax) const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -0,0 +1,235 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/subgraph.h>
+
+#include <pthreadpool.h>
+
+#include <gtest/gtest.h>
+
+// Operators with these dimensions run concurrently with the other operators on their level.
+static const std::array<size_t, 4> kSmallDims = {{1, 8, 8, 4}};
+// Operators with these dimensions run one after another on the whole thread pool.
+static const std::array<size_t, 4> kLargeDims = {{1, 64, 64, 16}};
+
+// Runtime with three independent branches on the first level:
+//   output1 = -input
+//   output2 = abs(input) + clamp(input, -0.5, 0.5)
+static xnn_runtime_t create_branches_runtime(pthreadpool_t threadpool, uint32_t flags,
+  const std::array<size_t, 4>& dims = kSmallDims)
+{
+  xnn_subgraph_t subgraph = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph));
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+    nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t output1_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+    nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output1_id));
+  uint32_t output2_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+    nullptr, 2, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output2_id));
+  uint32_t abs_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+    nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */, &abs_id));
+  uint32_t clamp_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+    nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */, &clamp_id));
+  EXPECT_EQ(xnn_status_success, xnn_define_abs(subgraph, input_id, abs_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_success, xnn_define_negate(subgraph, input_id, output1_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_success, xnn_define_clamp(subgraph, -0.5f, 0.5f, input_id, clamp_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_success,
+    xnn_define_add2(subgraph, -INFINITY, INFINITY, abs_id, clamp_id, output2_id, 0 /* flags */));
+
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success,
+    xnn_create_runtime_v3(subgraph, nullptr /* workspace */, threadpool, flags, &runtime));
+  xnn_delete_subgraph(subgraph);
+  return runtime;
+}
+
+static std::vector<float> random_input(const std::array<size_t, 4>& dims = kSmallDims)
+{
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  std::vector<float> input(dims[0] * dims[1] * dims[2] * dims[3]);
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  return input;
+}
+
+static void verify_outputs(const std::vector<float>& input, const std::vector<float>& output1,
+  const std::vector<float>& output2)
+{
+  for (size_t i = 0; i < input.size(); i++) {
+    ASSERT_EQ(-input[i], output1[i]) << "at " << i;
+    ASSERT_EQ(std::abs(input[i]) + std::min(std::max(input[i], -0.5f), 0.5f), output2[i]) << "at " << i;
+  }
+}
+
+TEST(RUNTIME_LEVELS, independent_branches) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  pthreadpool_t threadpool = pthreadpool_create(4);
+  ASSERT_NE(nullptr, threadpool);
+  xnn_runtime_t runtime = create_branches_runtime(threadpool, XNN_FLAG_INTER_OPERATOR_PARALLELISM);
+  ASSERT_NE(nullptr, runtime);
+
+  // Abs, Negate, and Clamp form the first level, Add the second one.
+  ASSERT_EQ(2, runtime->num_levels);
+  ASSERT_EQ(0, runtime->level_offsets[0]);
+  ASSERT_EQ(3, runtime->level_offsets[1]);
+  ASSERT_EQ(4, runtime->level_offsets[2]);
+
+  const std::vector<float> input = random_input();
+  std::vector<float> output1(input.size(), std::nanf(""));
+  std::vector<float> output2(input.size(), std::nanf(""));
+  const std::array<xnn_external_value, 3> external = {{
+    xnn_external_value{0, const_cast<float*>(input.data())},
+    xnn_external_value{1, output1.data()},
+    xnn_external_value{2, output2.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  for (size_t iteration = 0; iteration < 10; iteration++) {
+    ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+    verify_outputs(input, output1, output2);
+  }
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+  pthreadpool_destroy(threadpool);
+}
+
+TEST(RUNTIME_LEVELS, matches_sequential_runtime) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  pthreadpool_t threadpool = pthreadpool_create(4);
+  ASSERT_NE(nullptr, threadpool);
+  xnn_runtime_t levels_runtime = create_branches_runtime(threadpool, XNN_FLAG_INTER_OPERATOR_PARALLELISM);
+  ASSERT_NE(nullptr, levels_runtime);
+  xnn_runtime_t sequential_runtime = create_branches_runtime(threadpool, 0 /* flags */);
+  ASSERT_NE(nullptr, sequential_runtime);
+  ASSERT_EQ(nullptr, sequential_runtime->op_levels);
+
+  const std::vector<float> input = random_input();
+  std::vector<float> levels_output1(input.size(), std::nanf(""));
+  std::vector<float> levels_output2(input.size(), std::nanf(""));
+  std::vector<float> sequential_output1(input.size(), std::nanf(""));
+  std::vector<float> sequential_output2(input.size(), std::nanf(""));
+  const std::array<xnn_external_value, 3> levels_external = {{
+    xnn_external_value{0, const_cast<float*>(input.data())},
+    xnn_external_value{1, levels_output1.data()},
+    xnn_external_value{2, levels_output2.data()}}};
+  const std::array<xnn_external_value, 3> sequential_external = {{
+    xnn_external_value{0, const_cast<float*>(input.data())},
+    xnn_external_value{1, sequential_output1.data()},
+    xnn_external_value{2, sequential_output2.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(levels_runtime, levels_external.size(), levels_external.data()));
+  ASSERT_EQ(xnn_status_success,
+    xnn_setup_runtime(sequential_runtime, sequential_external.size(), sequential_external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(levels_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(sequential_runtime));
+  ASSERT_EQ(sequential_output1, levels_output1);
+  ASSERT_EQ(sequential_output2, levels_output2);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(levels_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(sequential_runtime));
+  pthreadpool_destroy(threadpool);
+}
+
+TEST(RUNTIME_LEVELS, operator_failure) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  pthreadpool_t threadpool = pthreadpool_create(4);
+  ASSERT_NE(nullptr, threadpool);
+  xnn_runtime_t runtime = create_branches_runtime(threadpool, XNN_FLAG_INTER_OPERATOR_PARALLELISM);
+  ASSERT_NE(nullptr, runtime);
+  ASSERT_EQ(2, runtime->num_levels);
+
+  const std::vector<float> input = random_input();
+  std::vector<float> output1(input.size(), std::nanf(""));
+  std::vector<float> output2(input.size(), std::nanf(""));
+  const std::array<xnn_external_value, 3> external = {{
+    xnn_external_value{0, const_cast<float*>(input.data())},
+    xnn_external_value{1, output1.data()},
+    xnn_external_value{2, output2.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+
+  // Failure of an operator on the first level is reported, and the operators on the second level don't run.
+  xnn_operator_t failing_operator = runtime->opdata[runtime->level_ops[2]].operator_object;
+  failing_operator->state = xnn_run_state_invalid;
+  ASSERT_EQ(xnn_status_invalid_state, xnn_invoke_runtime(runtime));
+  for (size_t i = 0; i < output2.size(); i++) {
+    ASSERT_TRUE(std::isnan(output2[i])) << "at " << i;
+  }
+
+  // The runtime succeeds again once the operator is set up.
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  verify_outputs(input, output1, output2);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+  pthreadpool_destroy(threadpool);
+}
+
+TEST(RUNTIME_LEVELS, large_operators) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  pthreadpool_t threadpool = pthreadpool_create(4);
+  ASSERT_NE(nullptr, threadpool);
+  xnn_runtime_t levels_runtime = create_branches_runtime(threadpool, XNN_FLAG_INTER_OPERATOR_PARALLELISM, kLargeDims);
+  ASSERT_NE(nullptr, levels_runtime);
+  xnn_runtime_t sequential_runtime = create_branches_runtime(threadpool, 0 /* flags */, kLargeDims);
+  ASSERT_NE(nullptr, sequential_runtime);
+  ASSERT_EQ(2, levels_runtime->num_levels);
+  for (uint32_t i = levels_runtime->level_offsets[0]; i < levels_runtime->level_offsets[1]; i++) {
+    const xnn_operator_data& opdata = levels_runtime->opdata[levels_runtime->level_ops[i]];
+    ASSERT_GT(levels_runtime->blobs[opdata.outputs[0]].size, XNN_MAX_CONCURRENT_OPERATOR_OUTPUT_SIZE);
+  }
+
+  const std::vector<float> input = random_input(kLargeDims);
+  std::vector<float> levels_output1(input.size(), std::nanf(""));
+  std::vector<float> levels_output2(input.size(), std::nanf(""));
+  std::vector<float> sequential_output1(input.size(), std::nanf(""));
+  std::vector<float> sequential_output2(input.size(), std::nanf(""));
+  const std::array<xnn_external_value, 3> levels_external = {{
+    xnn_external_value{0, const_cast<float*>(input.data())},
+    xnn_external_value{1, levels_output1.data()},
+    xnn_external_value{2, levels_output2.data()}}};
+  const std::array<xnn_external_value, 3> sequential_external = {{
+    xnn_external_value{0, const_cast<float*>(input.data())},
+    xnn_external_value{1, sequential_output1.data()},
+    xnn_external_value{2, sequential_output2.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(levels_runtime, levels_external.size(), levels_external.data()));
+  ASSERT_EQ(xnn_status_success,
+    xnn_setup_runtime(sequential_runtime, sequential_external.size(), sequential_external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(levels_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(sequential_runtime));
+  verify_outputs(input, levels_output1, levels_output2);
+  ASSERT_EQ(sequential_output1, levels_output1);
+  ASSERT_EQ(sequential_output2, levels_output2);
+
+  // Failure of a large operator is reported, and the operators on the second level don't run.
+  std::fill(levels_output2.begin(), levels_output2.end(), std::nanf(""));
+  xnn_operator_t failing_operator = levels_runtime->opdata[levels_runtime->level_ops[0]].operator_object;
+  failing_operator->state = xnn_run_state_invalid;
+  ASSERT_EQ(xnn_status_invalid_state, xnn_invoke_runtime(levels_runtime));
+  for (size_t i = 0; i < levels_output2.size(); i++) {
+    ASSERT_TRUE(std::isnan(levels_output2[i])) << "at " << i;
+  }
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(levels_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(sequential_runtime));
+  pthreadpool_destroy(threadpool);
+}
@@ -0,0 +1,205 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <xnnpack.h>
+
+#include <gtest/gtest.h>
+
+static const size_t kNumElements = 1 * 4 * 4 * 8;
+
+// Runtime computing output = abs(-input) for a [1, 4, 4, 8] input.
+static xnn_runtime_t create_negate_abs_runtime(uint32_t flags)
+{
+  xnn_subgraph_t subgraph = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph));
+  const std::array<size_t, 4> dims = {{1, 4, 4, 8}};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+    nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t negated_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+    nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */, &negated_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+    nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  EXPECT_EQ(xnn_status_success, xnn_define_negate(subgraph, input_id, negated_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_success, xnn_define_abs(subgraph, negated_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success,
+    xnn_create_runtime_v3(subgraph, nullptr /* workspace */, nullptr /* threadpool */, flags, &runtime));
+  xnn_delete_subgraph(subgraph);
+  return runtime;
+}
+
+static void setup_runtime(xnn_runtime_t runtime, std::vector<float>& input, std::vector<float>& output)
+{
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  input.resize(kNumElements);
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  output.assign(kNumElements, std::nanf(""));
+
+  const std::array<xnn_external_value, 2> external = {{
+    xnn_external_value{0, input.data()}, xnn_external_value{1, output.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+}
+
+TEST(RUNTIME_PROFILE, without_profiling_flag) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_runtime_t runtime = create_negate_abs_runtime(0 /* flags */);
+  ASSERT_NE(nullptr, runtime);
+  std::vector<float> input, output;
+  setup_runtime(runtime, input, output);
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+
+  std::array<xnn_operator_profile, 2> profiles;
+  size_t num_operators = 0;
+  ASSERT_EQ(xnn_status_invalid_state,
+    xnn_get_runtime_profile(runtime, profiles.size(), profiles.data(), &num_operators));
+  ASSERT_EQ(xnn_status_invalid_state, xnn_get_runtime_profile(runtime, 0, nullptr, &num_operators));
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(RUNTIME_PROFILE, query_number_of_operators) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_runtime_t runtime = create_negate_abs_runtime(XNN_FLAG_BASIC_PROFILING);
+  ASSERT_NE(nullptr, runtime);
+
+  size_t num_operators = 0;
+  ASSERT_EQ(xnn_status_success, xnn_get_runtime_profile(runtime, 0, nullptr, &num_operators));
+  ASSERT_EQ(2, num_operators);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(RUNTIME_PROFILE, insufficient_max_operators) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_runtime_t runtime = create_negate_abs_runtime(XNN_FLAG_BASIC_PROFILING);
+  ASSERT_NE(nullptr, runtime);
+
+  std::array<xnn_operator_profile, 1> profiles;
+  size_t num_operators = 0;
+  ASSERT_EQ(xnn_status_invalid_parameter,
+    xnn_get_runtime_profile(runtime, profiles.size(), profiles.data(), &num_operators));
+  // The number of operators is reported even when the array is too small.
+  ASSERT_EQ(2, num_operators);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(RUNTIME_PROFILE, operator_runs) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_runtime_t runtime = create_negate_abs_runtime(XNN_FLAG_BASIC_PROFILING);
+  ASSERT_NE(nullptr, runtime);
+
+  std::array<xnn_operator_profile, 3> profiles;
+  size_t num_operators = 0;
+  ASSERT_EQ(xnn_status_success, xnn_get_runtime_profile(runtime, profiles.size(), profiles.data(), &num_operators));
+  ASSERT_EQ(2, num_operators);
+  for (size_t i = 0; i < num_operators; i++) {
+    ASSERT_EQ(0, profiles[i].num_runs);
+    ASSERT_EQ(0, profiles[i].total_time_ns);
+  }
+
+  std::vector<float> input, output;
+  setup_runtime(runtime, input, output);
+  const size_t num_invocations = 5;
+  for (size_t iteration = 0; iteration < num_invocations; iteration++) {
+    ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  }
+  for (size_t i = 0; i < input.size(); i++) {
+    ASSERT_EQ(std::abs(input[i]), output[i]) << "at " << i;
+  }
+
+  ASSERT_EQ(xnn_status_success, xnn_get_runtime_profile(runtime, profiles.size(), profiles.data(), &num_operators));
+  ASSERT_EQ(2, num_operators);
+  ASSERT_EQ(std::string("Negate (NC, F32)"), profiles[0].operator_name);
+  ASSERT_EQ(std::string("Abs (NC, F32)"), profiles[1].operator_name);
+  for (size_t i = 0; i < num_operators; i++) {
+    ASSERT_EQ(i, profiles[i].node_id);
+    ASSERT_EQ(num_invocations, profiles[i].num_runs);
+    ASSERT_GE(profiles[i].total_time_ns, profiles[i].last_time_ns);
+    ASSERT_EQ(4, profiles[i].num_input_dims);
+    ASSERT_EQ(4, profiles[i].num_output_dims);
+    ASSERT_EQ(8, profiles[i].input_dims[3]);
+    ASSERT_EQ(8, profiles[i].output_dims[3]);
+  }
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(RUNTIME_PROFILE, inserted_operators) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  // Runtime computing output = -concatenate(abs(input1), input2). The external input of the Concatenate Node gets a
+  // Copy Node inserted before the Concatenate Node, which shifts the index of the Negate Node in the runtime.
+  xnn_subgraph_t subgraph = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph));
+  const std::array<size_t, 4> input_dims = {{1, 4, 4, 8}};
+  const std::array<size_t, 4> output_dims = {{1, 4, 4, 16}};
+  uint32_t input1_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, input_dims.size(),
+    input_dims.data(), nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input1_id));
+  uint32_t input2_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, input_dims.size(),
+    input_dims.data(), nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input2_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, output_dims.size(),
+    output_dims.data(), nullptr, 2, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  uint32_t abs_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, input_dims.size(),
+    input_dims.data(), nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */, &abs_id));
+  uint32_t concat_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, output_dims.size(),
+    output_dims.data(), nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */, &concat_id));
+  ASSERT_EQ(xnn_status_success, xnn_define_abs(subgraph, input1_id, abs_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success, xnn_define_concatenate2(subgraph, abs_id, input2_id, concat_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success, xnn_define_negate(subgraph, concat_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph, nullptr /* workspace */, nullptr /* threadpool */,
+    XNN_FLAG_BASIC_PROFILING, &runtime));
+  xnn_delete_subgraph(subgraph);
+
+  std::array<xnn_operator_profile, 8> profiles;
+  size_t num_operators = 0;
+  ASSERT_EQ(xnn_status_success, xnn_get_runtime_profile(runtime, profiles.size(), profiles.data(), &num_operators));
+  ASSERT_GE(num_operators, 3);
+  size_t num_copy_operators = 0;
+  for (size_t i = 0; i < num_operators; i++) {
+    const std::string operator_name = profiles[i].operator_name;
+    if (operator_name == "Abs (NC, F32)") {
+      ASSERT_EQ(0, profiles[i].node_id);
+    } else if (operator_name == "Copy (NC, X32)") {
+      // Copy operators report the ID of the Concatenate Node they were inserted for.
+      ASSERT_EQ(1, profiles[i].node_id);
+      num_copy_operators += 1;
+    } else {
+      ASSERT_EQ(std::string("Negate (NC, F32)"), operator_name);
+      ASSERT_EQ(2, profiles[i].node_id);
+    }
+  }
+  ASSERT_GE(num_copy_operators, 1);
+  ASSERT_EQ(2 + num_copy_operators, num_operators);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
@@ -0,0 +1,222 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+#include <gtest/gtest.h>
+
+static const size_t kInputChannels = 16;
+static const size_t kOutputChannels = 8;
+
+// Runtime computing output = -(input * filter^T + bias) with a [batch, 16] input and a [8, 16] filter.
+class FullyConnectedRuntime {
+ public:
+  FullyConnectedRuntime(size_t batch_size, xnn_workspace_t workspace)
+    : filter_(kOutputChannels * kInputChannels), bias_(kOutputChannels)
+  {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+    std::generate(filter_.begin(), filter_.end(), std::ref(f32rng));
+    std::generate(bias_.begin(), bias_.end(), std::ref(f32rng));
+
+    xnn_subgraph_t subgraph = nullptr;
+    EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph));
+    const std::array<size_t, 2> input_dims = {{batch_size, kInputChannels}};
+    const std::array<size_t, 2> filter_dims = {{kOutputChannels, kInputChannels}};
+    const std::array<size_t, 1> bias_dims = {{kOutputChannels}};
+    const std::array<size_t, 2> output_dims = {{batch_size, kOutputChannels}};
+    uint32_t input_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, input_dims.size(),
+      input_dims.data(), nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+    uint32_t filter_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, filter_dims.size(),
+      filter_dims.data(), filter_.data(), XNN_INVALID_VALUE_ID, 0 /* flags */, &filter_id));
+    uint32_t bias_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, bias_dims.size(),
+      bias_dims.data(), bias_.data(), XNN_INVALID_VALUE_ID, 0 /* flags */, &bias_id));
+    uint32_t fc_output_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, output_dims.size(),
+      output_dims.data(), nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */, &fc_output_id));
+    uint32_t output_id = XNN_INVALID_VALUE_ID;
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, output_dims.size(),
+      output_dims.data(), nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_fully_connected(subgraph, -INFINITY, INFINITY,
+      input_id, filter_id, bias_id, fc_output_id, 0 /* flags */));
+    EXPECT_EQ(xnn_status_success, xnn_define_negate(subgraph, fc_output_id, output_id, 0 /* flags */));
+
+    EXPECT_EQ(xnn_status_success,
+      xnn_create_runtime_v3(subgraph, workspace, nullptr /* threadpool */, 0 /* flags */, &runtime_));
+    xnn_delete_subgraph(subgraph);
+  }
+
+  ~FullyConnectedRuntime() {
+    xnn_delete_runtime(runtime_);
+  }
+
+  xnn_runtime_t runtime() const {
+    return runtime_;
+  }
+
+  // Runs the runtime on a random input, and checks the output against the reference results.
+  void Run(size_t batch_size) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+    std::vector<float> input(batch_size * kInputChannels);
+    std::generate(input.begin(), input.end(), std::ref(f32rng));
+    std::vector<float> output(batch_size * kOutputChannels, std::nanf(""));
+
+    const std::array<xnn_external_value, 2> external = {{
+      xnn_external_value{0, input.data()}, xnn_external_value{1, output.data()}}};
+    ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime_, external.size(), external.data()));
+    ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime_));
+
+    for (size_t b = 0; b < batch_size; b++) {
+      for (size_t oc = 0; oc < kOutputChannels; oc++) {
+        float reference = bias_[oc];
+        for (size_t ic = 0; ic < kInputChannels; ic++) {
+          reference += input[b * kInputChannels + ic] * filter_[oc * kInputChannels + ic];
+        }
+        ASSERT_NEAR(-reference, output[b * kOutputChannels + oc], 1.0e-5f * std::max(1.0f, std::abs(reference)))
+          << "batch " << b << ", output channel " << oc;
+      }
+    }
+  }
+
+ private:
+  std::vector<float> filter_;
+  std::vector<float> bias_;
+  xnn_runtime_t runtime_ = nullptr;
+};
+
+static void reshape_batch(xnn_runtime_t runtime, size_t batch_size)
+{
+  const std::array<size_t, 2> input_dims = {{batch_size, kInputChannels}};
+  ASSERT_EQ(xnn_status_success, xnn_reshape_external_value(runtime, 0, input_dims.size(), input_dims.data()));
+  ASSERT_EQ(xnn_status_success, xnn_reshape_runtime(runtime));
+
+  size_t num_dims = 0;
+  std::array<size_t, XNN_MAX_TENSOR_DIMS> dims;
+  ASSERT_EQ(xnn_status_success, xnn_get_external_value_shape(runtime, 0, &num_dims, dims.data()));
+  ASSERT_EQ(2, num_dims);
+  ASSERT_EQ(batch_size, dims[0]);
+  ASSERT_EQ(kInputChannels, dims[1]);
+  ASSERT_EQ(xnn_status_success, xnn_get_external_value_shape(runtime, 1, &num_dims, dims.data()));
+  ASSERT_EQ(2, num_dims);
+  ASSERT_EQ(batch_size, dims[0]);
+  ASSERT_EQ(kOutputChannels, dims[1]);
+}
+
+TEST(RUNTIME_RESHAPE, larger_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  FullyConnectedRuntime fc(3, nullptr /* workspace */);
+  ASSERT_NE(nullptr, fc.runtime());
+  fc.Run(3);
+
+  reshape_batch(fc.runtime(), 17);
+  fc.Run(17);
+}
+
+TEST(RUNTIME_RESHAPE, smaller_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  FullyConnectedRuntime fc(11, nullptr /* workspace */);
+  ASSERT_NE(nullptr, fc.runtime());
+  fc.Run(11);
+
+  reshape_batch(fc.runtime(), 2);
+  fc.Run(2);
+}
+
+TEST(RUNTIME_RESHAPE, larger_then_smaller_batch) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  FullyConnectedRuntime fc(4, nullptr /* workspace */);
+  ASSERT_NE(nullptr, fc.runtime());
+  reshape_batch(fc.runtime(), 32);
+  fc.Run(32);
+  reshape_batch(fc.runtime(), 1);
+  fc.Run(1);
+  reshape_batch(fc.runtime(), 4);
+  fc.Run(4);
+}
+
+TEST(RUNTIME_RESHAPE, requires_setup) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  FullyConnectedRuntime fc(4, nullptr /* workspace */);
+  ASSERT_NE(nullptr, fc.runtime());
+  fc.Run(4);
+
+  reshape_batch(fc.runtime(), 4);
+  ASSERT_EQ(xnn_status_invalid_state, xnn_invoke_runtime(fc.runtime()));
+}
+
+TEST(RUNTIME_RESHAPE, invalid_shape) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  FullyConnectedRuntime fc(4, nullptr /* workspace */);
+  ASSERT_NE(nullptr, fc.runtime());
+
+  const std::array<size_t, 2> channels_mismatch_dims = {{4, kInputChannels + 1}};
+  ASSERT_EQ(xnn_status_invalid_parameter,
+    xnn_reshape_external_value(fc.runtime(), 0, channels_mismatch_dims.size(), channels_mismatch_dims.data()));
+  const std::array<size_t, 3> rank_mismatch_dims = {{1, 4, kInputChannels}};
+  ASSERT_EQ(xnn_status_invalid_parameter,
+    xnn_reshape_external_value(fc.runtime(), 0, rank_mismatch_dims.size(), rank_mismatch_dims.data()));
+  const std::array<size_t, 2> zero_dims = {{0, kInputChannels}};
+  ASSERT_EQ(xnn_status_invalid_parameter,
+    xnn_reshape_external_value(fc.runtime(), 0, zero_dims.size(), zero_dims.data()));
+  // Outputs are reshaped by propagation of the input shapes.
+  const std::array<size_t, 2> output_dims = {{4, kOutputChannels}};
+  ASSERT_EQ(xnn_status_invalid_parameter,
+    xnn_reshape_external_value(fc.runtime(), 1, output_dims.size(), output_dims.data()));
+
+  // The shape is unchanged after a failed reshape.
+  size_t num_dims = 0;
+  std::array<size_t, XNN_MAX_TENSOR_DIMS> dims;
+  ASSERT_EQ(xnn_status_success, xnn_get_external_value_shape(fc.runtime(), 0, &num_dims, dims.data()));
+  ASSERT_EQ(2, num_dims);
+  ASSERT_EQ(4, dims[0]);
+  fc.Run(4);
+}
+
+TEST(RUNTIME_RESHAPE, shared_workspace) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_workspace_t workspace = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_workspace(&workspace));
+  {
+    FullyConnectedRuntime fc1(2, workspace);
+    FullyConnectedRuntime fc2(2, workspace);
+    ASSERT_NE(nullptr, fc1.runtime());
+    ASSERT_NE(nullptr, fc2.runtime());
+    fc1.Run(2);
+    fc2.Run(2);
+
+    // Reshape to a larger batch grows the shared workspace, and invalidates the setup of the other runtime.
+    reshape_batch(fc1.runtime(), 64);
+    ASSERT_EQ(xnn_status_invalid_state, xnn_invoke_runtime(fc2.runtime()));
+    fc1.Run(64);
+    fc2.Run(2);
+
+    // Reshape to a smaller batch keeps the workspace.
+    reshape_batch(fc1.runtime(), 1);
+    ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(fc2.runtime()));
+    fc1.Run(1);
+  }
+  ASSERT_EQ(xnn_status_success, xnn_release_workspace(workspace));
+}
@@ -178,6 +178,72 @@ class SoftMaxOperatorTester {
     }
   }
 
+  void TestQS8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::bind(std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()), rng);
+
+    std::vector<int8_t> input((batch_size() - 1) * input_stride() + channels());
+    std::vector<int8_t> output((batch_size() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(i8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const int32_t max_input = *std::max_element(
+          input.data() + i * input_stride(),
+          input.data() + i * input_stride() + channels());
+        float sum_exp = 0.0f;
+        for (size_t c = 0; c < channels(); c++) {
+          sum_exp +=
+              std::exp((int32_t(input[i * input_stride() + c]) - max_input) *
+                       input_scale());
+        }
+        for (size_t c = 0; c < channels(); c++) {
+          output_ref[i * channels() + c] =
+              std::exp((int32_t(input[i * input_stride() + c]) - max_input) *
+                       input_scale()) /
+              (sum_exp * output_scale());
+          output_ref[i * channels() + c] = std::min(output_ref[i * channels() + c], 255.0f);
+        }
+      }
+
+      // Create, setup, run, and destroy SoftMax operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t softmax_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_softmax_nc_qs8(
+          channels(), input_stride(), output_stride(),
+          input_scale(),
+          int8_t(output_zero_point() - 0x80), output_scale(),
+          0, &softmax_op));
+      ASSERT_NE(nullptr, softmax_op);
+
+      // Smart pointer to automatically delete softmax_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_softmax_op(softmax_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_softmax_nc_qs8(
+          softmax_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(softmax_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(float(int32_t(output[i * output_stride() + c]) + 0x80), output_ref[i * channels() + c], 0.6f);
+        }
+      }
+    }
+  }
+
   void TestF32() const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -0,0 +1,115 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <xnnpack.h>
+#include <xnnpack/params.h>
+
+#include "subgraph-tester.h"
+#include <gtest/gtest.h>
+
+static bool fp16_inference_supported() {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  return (xnn_params.init_flags & XNN_INIT_FLAG_F16) != 0 && (xnn_params.init_flags & XNN_INIT_FLAG_VCVT) != 0;
+}
+
+TEST(SUBGRAPH_FP16, disabled_without_flag) {
+  auto tester = SubgraphTester(4);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 3, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 2, 3)
+    .optimize();
+
+  ASSERT_EQ(tester.get_num_nodes(), 1);
+  ASSERT_EQ(tester.get_datatype(1), xnn_datatype_fp32);
+  ASSERT_EQ(tester.get_datatype(2), xnn_datatype_fp32);
+}
+
+TEST(SUBGRAPH_FP16, single_conv) {
+  if (!fp16_inference_supported()) {
+    GTEST_SKIP();
+  }
+  auto tester = SubgraphTester(4);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 3, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 2, 3)
+    .optimize(XNN_FLAG_FP16_INFERENCE);
+
+  // External Values stay F32, and Convert Nodes surround the F16 Convolution.
+  ASSERT_EQ(tester.get_num_nodes(), 3);
+  ASSERT_EQ(tester.get_node(0)->type, xnn_node_type_convert);
+  ASSERT_EQ(tester.get_node(1)->type, xnn_node_type_convolution_2d);
+  ASSERT_EQ(tester.get_node(2)->type, xnn_node_type_convert);
+  ASSERT_EQ(tester.get_datatype(0), xnn_datatype_fp32);
+  ASSERT_EQ(tester.get_datatype(1), xnn_datatype_fp16);
+  ASSERT_EQ(tester.get_datatype(2), xnn_datatype_fp16);
+  ASSERT_EQ(tester.get_datatype(3), xnn_datatype_fp32);
+  ASSERT_EQ(tester.get_node(0)->inputs[0], 0);
+  ASSERT_EQ(tester.get_node(2)->outputs[0], 3);
+  ASSERT_EQ(tester.get_datatype(tester.get_node(1)->inputs[0]), xnn_datatype_fp16);
+  ASSERT_EQ(tester.get_datatype(tester.get_node(1)->outputs[0]), xnn_datatype_fp16);
+}
+
+TEST(SUBGRAPH_FP16, conv_hardswish_global_average_pooling) {
+  if (!fp16_inference_supported()) {
+    GTEST_SKIP();
+  }
+  auto tester = SubgraphTester(6);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 3)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 4)
+    .add_tensor({1, 1, 1, 8}, kDynamic, 5, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 2, 3)
+    .add_hardswish(3, 4)
+    .add_global_average_pooling(4, 5)
+    .optimize(XNN_FLAG_FP16_INFERENCE);
+
+  // HardSwish is not fused into the Convolution, and intermediate Values are converted in place.
+  ASSERT_EQ(tester.get_num_nodes(), 5);
+  ASSERT_EQ(tester.get_node(0)->type, xnn_node_type_convert);
+  ASSERT_EQ(tester.get_node(1)->type, xnn_node_type_convolution_2d);
+  ASSERT_EQ(tester.get_node(2)->type, xnn_node_type_hardswish);
+  ASSERT_EQ(tester.get_node(3)->type, xnn_node_type_global_average_pooling_2d);
+  ASSERT_EQ(tester.get_node(4)->type, xnn_node_type_convert);
+  ASSERT_EQ(tester.get_datatype(3), xnn_datatype_fp16);
+  ASSERT_EQ(tester.get_datatype(4), xnn_datatype_fp16);
+  ASSERT_EQ(tester.get_datatype(5), xnn_datatype_fp32);
+}
+
+TEST(SUBGRAPH_FP16, add_with_static_operand_stays_fp32) {
+  if (!fp16_inference_supported()) {
+    GTEST_SKIP();
+  }
+  auto tester = SubgraphTester(6);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 3)
+    .add_tensor({1, 8, 8, 8}, kStaticDense, 4)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 5, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 2, 3)
+    .add_addition(3, 4, 5)
+    .optimize(XNN_FLAG_FP16_INFERENCE);
+
+  // Convolution output is converted back to F32 for the Add Node.
+  ASSERT_EQ(tester.get_num_nodes(), 4);
+  ASSERT_EQ(tester.get_node(0)->type, xnn_node_type_convert);
+  ASSERT_EQ(tester.get_node(1)->type, xnn_node_type_convolution_2d);
+  ASSERT_EQ(tester.get_node(2)->type, xnn_node_type_convert);
+  ASSERT_EQ(tester.get_node(3)->type, xnn_node_type_add2);
+  ASSERT_EQ(tester.get_node(2)->outputs[0], 3);
+  ASSERT_EQ(tester.get_datatype(3), xnn_datatype_fp32);
+  ASSERT_EQ(tester.get_datatype(4), xnn_datatype_fp32);
+  ASSERT_EQ(tester.get_datatype(5), xnn_datatype_fp32);
+}
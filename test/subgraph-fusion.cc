@@ -0,0 +1,475 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/params.h>
+
+#include "subgraph-tester.h"
+#include <gtest/gtest.h>
+
+static bool fp16_inference_supported() {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  return (xnn_params.init_flags & XNN_INIT_FLAG_F16) != 0 && (xnn_params.init_flags & XNN_INIT_FLAG_VCVT) != 0;
+}
+
+static bool gemm_hardswish_supported() {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  return xnn_params.f32.gemm.hswish.gemm.function[XNN_UARCH_DEFAULT] != nullptr;
+}
+
+static bool dwconv_hardswish_supported(size_t kernel_size) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const dwconv_parameters* best_ukernel = nullptr;
+  for (const dwconv_parameters& ukernel : xnn_params.f32.dwconv) {
+    if (ukernel.primary_tile >= kernel_size && ukernel.incremental_tile == 0 &&
+        (best_ukernel == nullptr || ukernel.primary_tile < best_ukernel->primary_tile))
+    {
+      best_ukernel = &ukernel;
+    }
+  }
+  return best_ukernel != nullptr && best_ukernel->hswish.unipass != nullptr;
+}
+
+static bool has_multipass_dwconv() {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  return std::any_of(std::begin(xnn_params.f32.dwconv), std::end(xnn_params.f32.dwconv),
+    [](const dwconv_parameters& ukernel) { return ukernel.primary_tile != 0 && ukernel.incremental_tile != 0; });
+}
+
+TEST(SUBGRAPH_FUSION, conv_hardswish) {
+  if (!gemm_hardswish_supported()) {
+    GTEST_SKIP();
+  }
+
+  auto tester = SubgraphTester(5);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 3)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 4, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 2, 3)
+    .add_hardswish(3, 4)
+    .optimize();
+
+  ASSERT_EQ(tester.get_node(0)->type, xnn_node_type_convolution_2d);
+  ASSERT_NE(tester.get_node(0)->flags & XNN_FLAG_FUSED_HARDSWISH, 0);
+  ASSERT_EQ(tester.get_node(0)->outputs[0], 4);
+  ASSERT_EQ(tester.get_node(1)->type, xnn_node_type_invalid);
+}
+
+TEST(SUBGRAPH_FUSION, depthwise_conv_hardswish) {
+  if (!dwconv_hardswish_supported(9)) {
+    GTEST_SKIP();
+  }
+
+  auto tester = SubgraphTester(5);
+  tester
+    .add_tensor({1, 16, 16, 8}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({1, 3, 3, 8}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 3)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 4, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_depthwise_conv(1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 8, 0, 1, 2, 3)
+    .add_hardswish(3, 4)
+    .optimize();
+
+  ASSERT_EQ(tester.get_node(0)->type, xnn_node_type_depthwise_convolution_2d);
+  ASSERT_NE(tester.get_node(0)->flags & XNN_FLAG_FUSED_HARDSWISH, 0);
+  ASSERT_EQ(tester.get_node(0)->outputs[0], 4);
+  ASSERT_EQ(tester.get_node(1)->type, xnn_node_type_invalid);
+}
+
+TEST(SUBGRAPH_FUSION, fully_connected_hardswish) {
+  if (!gemm_hardswish_supported()) {
+    GTEST_SKIP();
+  }
+
+  auto tester = SubgraphTester(5);
+  tester
+    .add_tensor({4, 16}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 16}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({4, 8}, kDynamic, 3)
+    .add_tensor({4, 8}, kDynamic, 4, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_fully_connected(0, 1, 2, 3)
+    .add_hardswish(3, 4)
+    .optimize();
+
+  ASSERT_EQ(tester.get_node(0)->type, xnn_node_type_fully_connected);
+  ASSERT_NE(tester.get_node(0)->flags & XNN_FLAG_FUSED_HARDSWISH, 0);
+  ASSERT_EQ(tester.get_node(0)->outputs[0], 4);
+  ASSERT_EQ(tester.get_node(1)->type, xnn_node_type_invalid);
+}
+
+TEST(SUBGRAPH_FUSION, no_hardswish_fusion_into_multipass_depthwise_conv) {
+  if (!has_multipass_dwconv()) {
+    GTEST_SKIP();
+  }
+
+  auto tester = SubgraphTester(5);
+  tester
+    .add_tensor({1, 16, 16, 8}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({1, 7, 7, 8}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 3)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 4, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_depthwise_conv(3, 3, 3, 3, 7, 7, 1, 1, 1, 1, 1, 8, 0, 1, 2, 3)
+    .add_hardswish(3, 4)
+    .optimize();
+
+  // Multipass DWCONV micro-kernels don't fuse HardSwish, and HardSwish stays a separate Node.
+  ASSERT_EQ(tester.get_node(0)->type, xnn_node_type_depthwise_convolution_2d);
+  ASSERT_EQ(tester.get_node(0)->flags & XNN_FLAG_FUSED_HARDSWISH, 0);
+  ASSERT_EQ(tester.get_node(0)->outputs[0], 3);
+  ASSERT_EQ(tester.get_node(1)->type, xnn_node_type_hardswish);
+  ASSERT_EQ(tester.get_node(1)->inputs[0], 3);
+  ASSERT_EQ(tester.get_node(1)->outputs[0], 4);
+}
+
+TEST(SUBGRAPH_FUSION, no_hardswish_fusion_into_vmulcaddc_depthwise_conv) {
+  auto tester = SubgraphTester(5);
+  tester
+    .add_tensor({1, 16, 16, 8}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({1, 1, 1, 8}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 3)
+    .add_tensor({1, 16, 16, 8}, kDynamic, 4, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_depthwise_conv(0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 8, 0, 1, 2, 3)
+    .add_hardswish(3, 4)
+    .optimize();
+
+  // 1x1 Depthwise Convolution runs on VMULCADDC micro-kernels, which don't fuse HardSwish.
+  ASSERT_EQ(tester.get_node(0)->type, xnn_node_type_depthwise_convolution_2d);
+  ASSERT_EQ(tester.get_node(0)->flags & XNN_FLAG_FUSED_HARDSWISH, 0);
+  ASSERT_EQ(tester.get_node(1)->type, xnn_node_type_hardswish);
+}
+
+TEST(SUBGRAPH_FUSION, no_hardswish_fusion_into_bounded_producer) {
+  auto tester = SubgraphTester(6);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 3)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 4)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 5, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 2, 3)
+    .add_clamp(0.0f, 6.0f, 3, 4)
+    .add_hardswish(4, 5)
+    .optimize();
+
+  // Clamp is fused into the Convolution, which bounds its output, and HardSwish stays a separate Node.
+  ASSERT_EQ(tester.get_node(0)->type, xnn_node_type_convolution_2d);
+  ASSERT_EQ(tester.get_node(0)->flags & XNN_FLAG_FUSED_HARDSWISH, 0);
+  ASSERT_EQ(tester.get_node(0)->activation.output_min, 0.0f);
+  ASSERT_EQ(tester.get_node(0)->activation.output_max, 6.0f);
+  ASSERT_EQ(tester.get_node(0)->outputs[0], 4);
+  ASSERT_EQ(tester.get_node(1)->type, xnn_node_type_invalid);
+  ASSERT_EQ(tester.get_node(2)->type, xnn_node_type_hardswish);
+  ASSERT_EQ(tester.get_node(2)->inputs[0], 4);
+  ASSERT_EQ(tester.get_node(2)->outputs[0], 5);
+}
+
+TEST(SUBGRAPH_FUSION, no_clamp_fusion_after_hardswish) {
+  if (!gemm_hardswish_supported()) {
+    GTEST_SKIP();
+  }
+
+  auto tester = SubgraphTester(6);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 3)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 4)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 5, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 2, 3)
+    .add_hardswish(3, 4)
+    .add_clamp(0.0f, 1.0f, 4, 5)
+    .optimize();
+
+  // HardSwish is fused into the Convolution, but Clamp is not: the fused operator would clamp before HardSwish.
+  ASSERT_EQ(tester.get_node(0)->type, xnn_node_type_convolution_2d);
+  ASSERT_NE(tester.get_node(0)->flags & XNN_FLAG_FUSED_HARDSWISH, 0);
+  ASSERT_EQ(tester.get_node(0)->activation.output_min, -INFINITY);
+  ASSERT_EQ(tester.get_node(0)->activation.output_max, +INFINITY);
+  ASSERT_EQ(tester.get_node(0)->outputs[0], 4);
+  ASSERT_EQ(tester.get_node(1)->type, xnn_node_type_invalid);
+  ASSERT_EQ(tester.get_node(2)->type, xnn_node_type_clamp);
+  ASSERT_EQ(tester.get_node(2)->inputs[0], 4);
+  ASSERT_EQ(tester.get_node(2)->outputs[0], 5);
+}
+
+TEST(SUBGRAPH_FUSION, no_hardswish_fusion_in_fp16_inference) {
+  if (!fp16_inference_supported()) {
+    GTEST_SKIP();
+  }
+  auto tester = SubgraphTester(5);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 3)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 4, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 2, 3)
+    .add_hardswish(3, 4)
+    .optimize(XNN_FLAG_FP16_INFERENCE);
+
+  // F16 operators don't fuse HardSwish: both Nodes run in half precision.
+  uint32_t num_convolution_nodes = 0;
+  uint32_t num_hardswish_nodes = 0;
+  for (uint32_t i = 0; i < tester.get_num_nodes(); i++) {
+    const xnn_node* node = tester.get_node(i);
+    ASSERT_EQ(node->flags & XNN_FLAG_FUSED_HARDSWISH, 0);
+    if (node->type == xnn_node_type_convolution_2d) {
+      num_convolution_nodes += 1;
+    } else if (node->type == xnn_node_type_hardswish) {
+      num_hardswish_nodes += 1;
+      ASSERT_EQ(tester.get_datatype(node->inputs[0]), xnn_datatype_fp16);
+    }
+  }
+  ASSERT_EQ(num_convolution_nodes, 1);
+  ASSERT_EQ(num_hardswish_nodes, 1);
+}
+
+TEST(SUBGRAPH_FUSION, conv_multiply_add) {
+  auto tester = SubgraphTester(8);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 3)
+    .add_tensor({8}, kStaticDense, 4)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 5)
+    .add_tensor({1, 1, 1, 8}, kStaticDense, 6)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 7, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 2, 3)
+    .add_multiplication(3, 4, 5)
+    .add_addition(6, 5, 7)
+    .optimize();
+
+  ASSERT_EQ(tester.get_node(0)->type, xnn_node_type_convolution_2d);
+  ASSERT_EQ(tester.get_node(0)->outputs[0], 7);
+  ASSERT_EQ(tester.get_node(1)->type, xnn_node_type_invalid);
+  ASSERT_EQ(tester.get_node(2)->type, xnn_node_type_invalid);
+}
+
+TEST(SUBGRAPH_FUSION, fully_connected_multiply) {
+  auto tester = SubgraphTester(6);
+  tester
+    .add_tensor({4, 16}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 16}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({4, 8}, kDynamic, 3)
+    .add_tensor({1}, kStaticDense, 4)
+    .add_tensor({4, 8}, kDynamic, 5, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_fully_connected(0, 1, 2, 3)
+    .add_multiplication(3, 4, 5)
+    .optimize();
+
+  ASSERT_EQ(tester.get_node(0)->type, xnn_node_type_fully_connected);
+  ASSERT_EQ(tester.get_node(0)->outputs[0], 5);
+  ASSERT_EQ(tester.get_node(1)->type, xnn_node_type_invalid);
+}
+
+TEST(SUBGRAPH_FUSION, no_multiply_folding_with_shared_filter) {
+  auto tester = SubgraphTester(9);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({8}, kStaticDense, 3)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 4)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 5, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_tensor({8}, kStaticDense, 6)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 7, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 2, 4)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 3, 5)
+    .add_multiplication(4, 6, 7)
+    .optimize();
+
+  // Folding would change the filter of the other Convolution.
+  ASSERT_EQ(tester.get_node(0)->outputs[0], 4);
+  ASSERT_EQ(tester.get_node(2)->type, xnn_node_type_multiply2);
+}
+
+TEST(SUBGRAPH_FUSION, no_add_folding_with_shared_bias) {
+  auto tester = SubgraphTester(9);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 2)
+    .add_tensor({8}, kStaticDense, 3)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 4)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 5, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_tensor({8}, kStaticDense, 6)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 7, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 3, 4)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 2, 3, 5)
+    .add_addition(4, 6, 7)
+    .optimize();
+
+  // Folding would change the bias of the other Convolution.
+  ASSERT_EQ(tester.get_node(0)->outputs[0], 4);
+  ASSERT_EQ(tester.get_node(2)->type, xnn_node_type_add2);
+}
+
+TEST(SUBGRAPH_FUSION, no_multiply_folding_with_non_broadcastable_parameter) {
+  auto tester = SubgraphTester(6);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 3)
+    .add_tensor({1, 8, 1, 8}, kStaticDense, 4)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 5, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 2, 3)
+    .add_multiplication(3, 4, 5)
+    .optimize();
+
+  // The parameter varies along the height, and can't be folded into the per-channel filter and bias.
+  ASSERT_EQ(tester.get_node(0)->outputs[0], 3);
+  ASSERT_EQ(tester.get_node(1)->type, xnn_node_type_multiply2);
+}
+
+TEST(SUBGRAPH_FUSION, no_multiply_folding_into_bounded_producer) {
+  auto tester = SubgraphTester(7);
+  tester
+    .add_tensor({1, 16, 16, 3}, kDynamic, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT)
+    .add_tensor({8, 3, 3, 3}, kStaticDense, 1)
+    .add_tensor({8}, kStaticDense, 2)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 3)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 4)
+    .add_tensor({8}, kStaticDense, 5)
+    .add_tensor({1, 8, 8, 8}, kDynamic, 6, XNN_VALUE_FLAG_EXTERNAL_OUTPUT)
+    .add_conv(1, 1, 1, 1, 3, 3, 2, 2, 1, 1, 1, 3, 8, 0, 1, 2, 3)
+    .add_clamp(0.0f, 6.0f, 3, 4)
+    .add_multiplication(4, 5, 6)
+    .optimize();
+
+  // Clamp is fused into the Convolution, and Multiply can't be moved before the clamping.
+  ASSERT_EQ(tester.get_node(0)->outputs[0], 4);
+  ASSERT_EQ(tester.get_node(0)->activation.output_max, 6.0f);
+  ASSERT_EQ(tester.get_node(2)->type, xnn_node_type_multiply2);
+}
+
+// Runtime computing output = (conv(input) * scale + offset) for a [1, 8, 8, 4] input, a 3x3 filter, and 8 output
+// channels. Static scale and offset are folded into the Convolution, while external ones are not.
+static xnn_runtime_t create_conv_multiply_add_runtime(
+  const std::vector<float>& filter, const std::vector<float>& bias,
+  const std::vector<float>& scale, const std::vector<float>& offset, bool static_parameters)
+{
+  xnn_subgraph_t subgraph = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_subgraph(4, 0 /* flags */, &subgraph));
+  const std::array<size_t, 4> input_dims = {{1, 8, 8, 4}};
+  const std::array<size_t, 4> filter_dims = {{8, 3, 3, 4}};
+  const std::array<size_t, 1> channel_dims = {{8}};
+  const std::array<size_t, 4> output_dims = {{1, 8, 8, 8}};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, input_dims.size(),
+    input_dims.data(), nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, output_dims.size(),
+    output_dims.data(), nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  uint32_t scale_id = XNN_INVALID_VALUE_ID;
+  uint32_t offset_id = XNN_INVALID_VALUE_ID;
+  if (static_parameters) {
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, channel_dims.size(),
+      channel_dims.data(), scale.data(), XNN_INVALID_VALUE_ID, 0 /* flags */, &scale_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, channel_dims.size(),
+      channel_dims.data(), offset.data(), XNN_INVALID_VALUE_ID, 0 /* flags */, &offset_id));
+  } else {
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, channel_dims.size(),
+      channel_dims.data(), nullptr, 2, XNN_VALUE_FLAG_EXTERNAL_INPUT, &scale_id));
+    EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, channel_dims.size(),
+      channel_dims.data(), nullptr, 3, XNN_VALUE_FLAG_EXTERNAL_INPUT, &offset_id));
+  }
+  uint32_t filter_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, filter_dims.size(),
+    filter_dims.data(), filter.data(), XNN_INVALID_VALUE_ID, 0 /* flags */, &filter_id));
+  uint32_t bias_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, channel_dims.size(),
+    channel_dims.data(), bias.data(), XNN_INVALID_VALUE_ID, 0 /* flags */, &bias_id));
+  uint32_t conv_output_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, output_dims.size(),
+    output_dims.data(), nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */, &conv_output_id));
+  uint32_t scaled_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, output_dims.size(),
+    output_dims.data(), nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */, &scaled_id));
+  EXPECT_EQ(xnn_status_success, xnn_define_convolution_2d(subgraph, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 4, 8,
+    -INFINITY, INFINITY, input_id, filter_id, bias_id, conv_output_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_success,
+    xnn_define_multiply2(subgraph, -INFINITY, INFINITY, conv_output_id, scale_id, scaled_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_success,
+    xnn_define_add2(subgraph, -1.0f, 1.0f, offset_id, scaled_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success,
+    xnn_create_runtime_v3(subgraph, nullptr /* workspace */, nullptr /* threadpool */, 0 /* flags */, &runtime));
+  xnn_delete_subgraph(subgraph);
+  return runtime;
+}
+
+TEST(SUBGRAPH_FUSION, conv_multiply_add_matches_unfolded) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  std::vector<float> filter(8 * 3 * 3 * 4);
+  std::vector<float> bias(8);
+  std::vector<float> scale(8);
+  std::vector<float> offset(8);
+  std::vector<float> input(1 * 8 * 8 * 4);
+  std::generate(filter.begin(), filter.end(), std::ref(f32rng));
+  std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+  std::generate(scale.begin(), scale.end(), std::ref(f32rng));
+  std::generate(offset.begin(), offset.end(), std::ref(f32rng));
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+
+  xnn_runtime_t folded_runtime = create_conv_multiply_add_runtime(filter, bias, scale, offset, true);
+  ASSERT_NE(nullptr, folded_runtime);
+  xnn_runtime_t unfolded_runtime = create_conv_multiply_add_runtime(filter, bias, scale, offset, false);
+  ASSERT_NE(nullptr, unfolded_runtime);
+  // Folded Nodes don't create operators.
+  ASSERT_NE(nullptr, folded_runtime->opdata[0].operator_object);
+  ASSERT_EQ(nullptr, folded_runtime->opdata[1].operator_object);
+  ASSERT_EQ(nullptr, folded_runtime->opdata[2].operator_object);
+  ASSERT_NE(nullptr, unfolded_runtime->opdata[1].operator_object);
+  ASSERT_NE(nullptr, unfolded_runtime->opdata[2].operator_object);
+
+  std::vector<float> folded_output(1 * 8 * 8 * 8, std::nanf(""));
+  std::vector<float> unfolded_output(1 * 8 * 8 * 8, std::nanf(""));
+  const std::array<xnn_external_value, 2> folded_external = {{
+    xnn_external_value{0, input.data()}, xnn_external_value{1, folded_output.data()}}};
+  const std::array<xnn_external_value, 4> unfolded_external = {{
+    xnn_external_value{0, input.data()}, xnn_external_value{1, unfolded_output.data()},
+    xnn_external_value{2, scale.data()}, xnn_external_value{3, offset.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(folded_runtime, folded_external.size(), folded_external.data()));
+  ASSERT_EQ(xnn_status_success,
+    xnn_setup_runtime(unfolded_runtime, unfolded_external.size(), unfolded_external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(folded_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(unfolded_runtime));
+
+  // Folding changes the order of floating-point operations, and results match only approximately.
+  for (size_t i = 0; i < folded_output.size(); i++) {
+    ASSERT_NEAR(unfolded_output[i], folded_output[i], 1.0e-5f * std::max(1.0f, std::abs(unfolded_output[i])))
+      << "at " << i;
+  }
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(folded_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(unfolded_runtime));
+}
@@ -42,7 +42,8 @@ class SubgraphTester {
 
   inline SubgraphTester& add_tensor(const std::vector<size_t>& dims,
                                     xnn_tensor_type tensor_type,
-                                    uint32_t external_id) {
+                                    uint32_t external_id,
+                                    uint32_t flags = 0) {
     void* data = nullptr;
     if (tensor_type == kStaticDense || tensor_type == kStaticSparse) {
       const size_t num_elements = std::accumulate(std::begin(dims), std::end(dims), 1, std::multiplies<size_t>());
@@ -64,7 +65,7 @@ class SubgraphTester {
     uint32_t id_out = 0;
     const xnn_status status =
         xnn_define_tensor_value(subgraph_.get(), xnn_datatype_fp32, dims.size(),
-                                dims.data(), data, external_id, 0 /* flags */, &id_out);
+                                dims.data(), data, external_id, flags, &id_out);
     EXPECT_EQ(status, xnn_status_success);
     EXPECT_EQ(id_out, external_id);
 
@@ -116,6 +117,18 @@ class SubgraphTester {
     return *this;
   }
 
+  inline SubgraphTester& add_fully_connected(uint32_t input_id, uint32_t filter_id, uint32_t bias_id,
+                                             uint32_t output_id)
+  {
+    const xnn_status status = xnn_define_fully_connected(
+        subgraph_.get(), -std::numeric_limits<float>::infinity(),
+        std::numeric_limits<float>::infinity(), input_id, filter_id, bias_id,
+        output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
   inline SubgraphTester& add_addition(uint32_t input_id1, uint32_t input_id2, uint32_t output_id)
   {
     const xnn_status status =
@@ -127,6 +140,17 @@ class SubgraphTester {
     return *this;
   }
 
+  inline SubgraphTester& add_multiplication(uint32_t input_id1, uint32_t input_id2, uint32_t output_id)
+  {
+    const xnn_status status =
+        xnn_define_multiply2(subgraph_.get(), -std::numeric_limits<float>::infinity(),
+                             std::numeric_limits<float>::infinity(), input_id1,
+                             input_id2, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
   inline SubgraphTester& add_global_average_pooling(uint32_t input_id, uint32_t output_id)
   {
     const xnn_status status = xnn_define_global_average_pooling_2d(
@@ -137,8 +161,25 @@ class SubgraphTester {
     return *this;
   }
 
-  inline SubgraphTester& optimize() {
-    const xnn_status status = xnn_subgraph_optimize(subgraph_.get(), 0 /* flags */);
+  inline SubgraphTester& add_clamp(float output_min, float output_max, uint32_t input_id, uint32_t output_id)
+  {
+    const xnn_status status =
+        xnn_define_clamp(subgraph_.get(), output_min, output_max, input_id, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
+  inline SubgraphTester& add_hardswish(uint32_t input_id, uint32_t output_id)
+  {
+    const xnn_status status = xnn_define_hardswish(subgraph_.get(), input_id, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
+  inline SubgraphTester& optimize(uint32_t flags = 0) {
+    const xnn_status status = xnn_subgraph_optimize(subgraph_.get(), flags);
     EXPECT_EQ(status, xnn_status_success);
 
     return *this;
@@ -154,6 +195,18 @@ class SubgraphTester {
     return subgraph_->values[value_id].layout;
   }
 
+  inline xnn_datatype get_datatype(uint32_t value_id) const {
+    return subgraph_->values[value_id].datatype;
+  }
+
+  inline uint32_t get_num_nodes() const {
+    return subgraph_->num_nodes;
+  }
+
+  inline const xnn_node* get_node(uint32_t node_id) const {
+    return &subgraph_->nodes[node_id];
+  }
+
  private:
   std::vector<std::vector<float>> static_data_;
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph_{nullptr, xnn_delete_subgraph};
@@ -0,0 +1,133 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <xnnpack/params.h>
+
+
+class TransposeMicrokernelTester {
+ public:
+  inline TransposeMicrokernelTester& block_width(size_t block_width) {
+    assert(block_width != 0);
+    this->block_width_ = block_width;
+    return *this;
+  }
+
+  inline size_t block_width() const {
+    return this->block_width_;
+  }
+
+  inline TransposeMicrokernelTester& block_height(size_t block_height) {
+    assert(block_height != 0);
+    this->block_height_ = block_height;
+    return *this;
+  }
+
+  inline size_t block_height() const {
+    return this->block_height_;
+  }
+
+  inline TransposeMicrokernelTester& input_stride(size_t input_stride) {
+    this->input_stride_ = input_stride;
+    return *this;
+  }
+
+  inline size_t input_stride() const {
+    if (this->input_stride_ == 0) {
+      return block_width();
+    } else {
+      assert(this->input_stride_ >= block_width());
+      return this->input_stride_;
+    }
+  }
+
+  inline TransposeMicrokernelTester& output_stride(size_t output_stride) {
+    this->output_stride_ = output_stride;
+    return *this;
+  }
+
+  inline size_t output_stride() const {
+    if (this->output_stride_ == 0) {
+      return block_height();
+    } else {
+      assert(this->output_stride_ >= block_height());
+      return this->output_stride_;
+    }
+  }
+
+  inline TransposeMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_x8_transpose_ukernel_function transpose) const {
+    Test<uint8_t>(transpose);
+  }
+
+  void Test(xnn_x16_transpose_ukernel_function transpose) const {
+    Test<uint16_t>(transpose);
+  }
+
+  void Test(xnn_x32_transpose_ukernel_function transpose) const {
+    Test<uint32_t>(transpose);
+  }
+
+ private:
+  template<class T>
+  void Test(void (*transpose)(const T*, T*, size_t, size_t, size_t, size_t)) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto xrng = std::bind(std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<T>::max()), rng);
+
+    std::vector<T> input((block_height() - 1) * input_stride() + block_width());
+    std::vector<T> output((block_width() - 1) * output_stride() + block_height());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return T(xrng()); });
+      std::fill(output.begin(), output.end(), T(0xA5A5A5A5));
+
+      // Call optimized micro-kernel.
+      transpose(input.data(), output.data(),
+        input_stride() * sizeof(T), output_stride() * sizeof(T),
+        block_width(), block_height());
+
+      // Verify results.
+      for (size_t y = 0; y < block_height(); y++) {
+        for (size_t x = 0; x < block_width(); x++) {
+          ASSERT_EQ(uint32_t(output[x * output_stride() + y]), uint32_t(input[y * input_stride() + x]))
+            << "at row " << y << " / " << block_height() << ", column " << x << " / " << block_width();
+        }
+      }
+      // Elements between the output rows must not be overwritten.
+      for (size_t x = 0; x + 1 < block_width(); x++) {
+        for (size_t y = block_height(); y < output_stride(); y++) {
+          ASSERT_EQ(uint32_t(output[x * output_stride() + y]), uint32_t(T(0xA5A5A5A5)))
+            << "at padding element " << y << " of output row " << x;
+        }
+      }
+    }
+  }
+
+  size_t block_width_{1};
+  size_t block_height_{1};
+  size_t input_stride_{0};
+  size_t output_stride_{0};
+  size_t iterations_{3};
+};
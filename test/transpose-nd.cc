@@ -0,0 +1,284 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "transpose-operator-tester.h"
+
+constexpr size_t kDim1 = 2;
+constexpr size_t kDim2 = 3;
+constexpr size_t kDim3 = 4;
+constexpr size_t kDim4 = 5;
+constexpr size_t kDim5 = 2;
+constexpr size_t kDim6 = 3;
+
+
+TEST(TRANSPOSE_ND_X8, 1d) {
+  std::vector<size_t> perm(1);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1})
+      .perm(perm)
+      .TestX8();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X8, 2d) {
+  std::vector<size_t> perm(2);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2})
+      .perm(perm)
+      .TestX8();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X8, 3d) {
+  std::vector<size_t> perm(3);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2, kDim3})
+      .perm(perm)
+      .TestX8();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X8, 4d) {
+  std::vector<size_t> perm(4);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2, kDim3, kDim4})
+      .perm(perm)
+      .TestX8();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X8, 5d) {
+  std::vector<size_t> perm(5);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5})
+      .perm(perm)
+      .TestX8();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X8, 6d) {
+  std::vector<size_t> perm(6);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5, kDim6})
+      .perm(perm)
+      .TestX8();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X8, 2d_large) {
+  for (size_t rows = 1; rows <= 33; rows += 4) {
+    for (size_t columns = 1; columns <= 33; columns += 4) {
+      TransposeOperatorTester()
+        .input_shape({rows, columns})
+        .perm({1, 0})
+        .TestX8();
+    }
+  }
+}
+
+TEST(TRANSPOSE_ND_X8, unit_dims) {
+  std::vector<size_t> perm(4);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({1, 7, 1, 11})
+      .perm(perm)
+      .TestX8();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X16, 1d) {
+  std::vector<size_t> perm(1);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1})
+      .perm(perm)
+      .TestX16();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X16, 2d) {
+  std::vector<size_t> perm(2);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2})
+      .perm(perm)
+      .TestX16();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X16, 3d) {
+  std::vector<size_t> perm(3);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2, kDim3})
+      .perm(perm)
+      .TestX16();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X16, 4d) {
+  std::vector<size_t> perm(4);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2, kDim3, kDim4})
+      .perm(perm)
+      .TestX16();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X16, 5d) {
+  std::vector<size_t> perm(5);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5})
+      .perm(perm)
+      .TestX16();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X16, 6d) {
+  std::vector<size_t> perm(6);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5, kDim6})
+      .perm(perm)
+      .TestX16();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X16, 2d_large) {
+  for (size_t rows = 1; rows <= 33; rows += 4) {
+    for (size_t columns = 1; columns <= 33; columns += 4) {
+      TransposeOperatorTester()
+        .input_shape({rows, columns})
+        .perm({1, 0})
+        .TestX16();
+    }
+  }
+}
+
+TEST(TRANSPOSE_ND_X16, unit_dims) {
+  std::vector<size_t> perm(4);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({1, 7, 1, 11})
+      .perm(perm)
+      .TestX16();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X32, 1d) {
+  std::vector<size_t> perm(1);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1})
+      .perm(perm)
+      .TestX32();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X32, 2d) {
+  std::vector<size_t> perm(2);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2})
+      .perm(perm)
+      .TestX32();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X32, 3d) {
+  std::vector<size_t> perm(3);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2, kDim3})
+      .perm(perm)
+      .TestX32();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X32, 4d) {
+  std::vector<size_t> perm(4);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2, kDim3, kDim4})
+      .perm(perm)
+      .TestX32();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X32, 5d) {
+  std::vector<size_t> perm(5);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5})
+      .perm(perm)
+      .TestX32();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X32, 6d) {
+  std::vector<size_t> perm(6);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({kDim1, kDim2, kDim3, kDim4, kDim5, kDim6})
+      .perm(perm)
+      .TestX32();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_ND_X32, 2d_large) {
+  for (size_t rows = 1; rows <= 33; rows += 4) {
+    for (size_t columns = 1; columns <= 33; columns += 4) {
+      TransposeOperatorTester()
+        .input_shape({rows, columns})
+        .perm({1, 0})
+        .TestX32();
+    }
+  }
+}
+
+TEST(TRANSPOSE_ND_X32, unit_dims) {
+  std::vector<size_t> perm(4);
+  std::iota(perm.begin(), perm.end(), 0);
+  do {
+    TransposeOperatorTester()
+      .input_shape({1, 7, 1, 11})
+      .perm(perm)
+      .TestX32();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
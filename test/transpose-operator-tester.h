@@ -0,0 +1,181 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class TransposeOperatorTester {
+ public:
+  inline TransposeOperatorTester& input_shape(std::initializer_list<size_t> input_shape) {
+    assert(input_shape.size() <= XNN_MAX_TENSOR_DIMS);
+    input_shape_ = std::vector<size_t>(input_shape);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& input_shape() const {
+    return input_shape_;
+  }
+
+  inline size_t input_dim(size_t i) const {
+    return i < input_shape_.size() ? input_shape_[i] : 1;
+  }
+
+  inline size_t num_dims() const {
+    return input_shape_.size();
+  }
+
+  inline size_t num_elements() const {
+    return std::accumulate(
+      input_shape_.cbegin(), input_shape_.cend(), size_t(1), std::multiplies<size_t>());
+  }
+
+  inline TransposeOperatorTester& perm(std::initializer_list<size_t> perm) {
+    assert(perm.size() <= XNN_MAX_TENSOR_DIMS);
+    perm_ = std::vector<size_t>(perm);
+    return *this;
+  }
+
+  inline TransposeOperatorTester& perm(const std::vector<size_t>& perm) {
+    assert(perm.size() <= XNN_MAX_TENSOR_DIMS);
+    perm_ = perm;
+    return *this;
+  }
+
+  inline const std::vector<size_t>& perm() const {
+    return perm_;
+  }
+
+  inline TransposeOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestX8() const {
+    Test<uint8_t>(xnn_create_transpose_nd_x8, xnn_setup_transpose_nd_x8);
+  }
+
+  void TestX16() const {
+    Test<uint16_t>(xnn_create_transpose_nd_x16, xnn_setup_transpose_nd_x16);
+  }
+
+  void TestX32() const {
+    Test<uint32_t>(xnn_create_transpose_nd_x32, xnn_setup_transpose_nd_x32);
+  }
+
+ private:
+  template<class T>
+  void Test(
+    enum xnn_status (*create)(uint32_t, xnn_operator_t*),
+    enum xnn_status (*setup)(xnn_operator_t, size_t, const size_t*, const size_t*, const void*, void*, pthreadpool_t)) const
+  {
+    ASSERT_EQ(num_dims(), perm().size());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto xrng = std::bind(std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<T>::max()), rng);
+
+    // Compute generalized shapes: input dimensions are padded with leading 1s, and the permutation
+    // is extended with identity on the padded dimensions.
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> input_dims;
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> output_perm;
+    std::fill(input_dims.begin(), input_dims.end(), 1);
+    for (size_t i = 0; i < XNN_MAX_TENSOR_DIMS - num_dims(); i++) {
+      output_perm[i] = i;
+    }
+    for (size_t i = 0; i < num_dims(); i++) {
+      input_dims[XNN_MAX_TENSOR_DIMS - num_dims() + i] = input_dim(i);
+      output_perm[XNN_MAX_TENSOR_DIMS - num_dims() + i] = XNN_MAX_TENSOR_DIMS - num_dims() + perm()[i];
+    }
+
+    // Compute generalized strides.
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> input_strides;
+    size_t input_stride = 1;
+    for (size_t i = XNN_MAX_TENSOR_DIMS; i != 0; i--) {
+      input_strides[i - 1] = input_stride;
+      input_stride *= input_dims[i - 1];
+    }
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> output_dims;
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> output_strides;
+    for (size_t i = 0; i < XNN_MAX_TENSOR_DIMS; i++) {
+      output_dims[i] = input_dims[output_perm[i]];
+      // Stride in the input tensor of the i-th output dimension.
+      output_strides[i] = input_strides[output_perm[i]];
+    }
+
+    std::vector<T> input(XNN_EXTRA_BYTES / sizeof(T) + num_elements());
+    std::vector<T> output(num_elements());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return T(xrng()); });
+      std::fill(output.begin(), output.end(), T(0xA5A5A5A5));
+
+      // Create, setup, run, and destroy a transpose operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t transpose_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success, create(0, &transpose_op));
+      ASSERT_NE(nullptr, transpose_op);
+
+      // Smart pointer to automatically delete transpose_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_transpose_op(transpose_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        setup(
+          transpose_op,
+          num_dims(), input_shape().data(), perm().data(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(transpose_op, nullptr /* thread pool */));
+
+      // Verify results.
+      size_t index = 0;
+      for (size_t i = 0; i < output_dims[0]; i++) {
+        for (size_t j = 0; j < output_dims[1]; j++) {
+          for (size_t k = 0; k < output_dims[2]; k++) {
+            for (size_t l = 0; l < output_dims[3]; l++) {
+              for (size_t m = 0; m < output_dims[4]; m++) {
+                for (size_t n = 0; n < output_dims[5]; n++) {
+                  const size_t input_index =
+                    i * output_strides[0] + j * output_strides[1] + k * output_strides[2] +
+                    l * output_strides[3] + m * output_strides[4] + n * output_strides[5];
+                  ASSERT_EQ(uint32_t(output[index]), uint32_t(input[input_index]))
+                    << "(i, j, k, l, m, n) = ("
+                    << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ")";
+                  index++;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  std::vector<size_t> input_shape_;
+  std::vector<size_t> perm_;
+  size_t iterations_{3};
+};
@@ -0,0 +1,308 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+#include <xnnpack/params-init.h>
+#include <xnnpack/params.h>
+
+
+class VCvtMicrokernelTester {
+ public:
+  enum class Variant {
+    Native,
+    Scalar,
+  };
+
+  inline VCvtMicrokernelTester& batch_size(size_t batch_size) {
+    assert(batch_size != 0);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline VCvtMicrokernelTester& input_min(float input_min) {
+    this->input_min_ = input_min;
+    return *this;
+  }
+
+  inline float input_min() const {
+    return this->input_min_;
+  }
+
+  inline VCvtMicrokernelTester& input_max(float input_max) {
+    this->input_max_ = input_max;
+    return *this;
+  }
+
+  inline float input_max() const {
+    return this->input_max_;
+  }
+
+  inline VCvtMicrokernelTester& scale(float scale) {
+    assert(scale > 0.0f);
+    assert(std::isnormal(scale));
+    this->scale_ = scale;
+    return *this;
+  }
+
+  inline float scale() const {
+    return this->scale_;
+  }
+
+  inline VCvtMicrokernelTester& zero_point(int16_t zero_point) {
+    this->zero_point_ = zero_point;
+    return *this;
+  }
+
+  inline int16_t zero_point() const {
+    return this->zero_point_;
+  }
+
+  inline VCvtMicrokernelTester& qmin(int16_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline int16_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline VCvtMicrokernelTester& qmax(int16_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline int16_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline VCvtMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f16_f32_vcvt_ukernel_function vcvt) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(input_min(), input_max()), rng);
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+    std::vector<uint16_t> x(batch_size() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<float> y(batch_size());
+    std::vector<float> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f16rng));
+      std::fill(y.begin(), y.end(), std::nanf(""));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        y_ref[i] = fp16_ieee_to_fp32_value(x[i]);
+      }
+
+      // Call optimized micro-kernel.
+      vcvt(batch_size() * sizeof(uint16_t), x.data(), y.data(), nullptr);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_EQ(y_ref[i], y[i])
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = 0x" << std::hex << x[i];
+      }
+    }
+  }
+
+  void Test(xnn_f32_f16_vcvt_ukernel_function vcvt) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(input_min(), input_max()), rng);
+
+    std::vector<float> x(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<uint16_t> y(batch_size());
+    std::vector<uint16_t> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f32rng));
+      std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        y_ref[i] = fp16_ieee_from_fp32_value(x[i]);
+      }
+
+      // Call optimized micro-kernel.
+      vcvt(batch_size() * sizeof(float), x.data(), y.data(), nullptr);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_EQ(y_ref[i], y[i])
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << x[i];
+      }
+    }
+  }
+
+  void Test(xnn_f32_qd8_vcvt_ukernel_function vcvt) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(input_min(), input_max()), rng);
+
+    std::vector<float> x(batch_size());
+    std::vector<int8_t> y(batch_size());
+    std::vector<int8_t> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f32rng));
+      std::fill(y.begin(), y.end(), INT8_C(0xA5));
+
+      // Compute reference quantization parameters and results.
+      const float x_min = std::min(*std::min_element(x.cbegin(), x.cend()), 0.0f);
+      const float x_max = std::max(*std::max_element(x.cbegin(), x.cend()), 0.0f);
+      const float scale_ref = x_max == x_min ? 1.0f : (x_max - x_min) / 255.0f;
+      const float inv_scale = 1.0f / scale_ref;
+      const int32_t zero_point_ref = std::min<int32_t>(int32_t(-128 - lrintf(x_min * inv_scale)), 127);
+      for (size_t i = 0; i < batch_size(); i++) {
+        const long q = lrintf(x[i] * inv_scale) + zero_point_ref;
+        y_ref[i] = int8_t(std::max<long>(std::min<long>(q, 127), -128));
+      }
+
+      // Call optimized micro-kernel.
+      xnn_qd8_quantization_params quantization_params = { 0, std::nanf("") };
+      vcvt(batch_size() * sizeof(float), x.data(), y.data(), &quantization_params);
+
+      // Verify results.
+      ASSERT_EQ(scale_ref, quantization_params.scale) << "batch size = " << batch_size();
+      ASSERT_EQ(zero_point_ref, quantization_params.zero_point) << "batch size = " << batch_size();
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_EQ(int32_t(y_ref[i]), int32_t(y[i]))
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << x[i]
+          << ", scale = " << scale_ref << ", zero point = " << zero_point_ref;
+        // Dequantized values must be within half a quantization step of the inputs.
+        ASSERT_NEAR(float(int32_t(y[i]) - zero_point_ref) * scale_ref, x[i], 0.5001f * scale_ref)
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << x[i];
+      }
+    }
+  }
+
+  void Test(xnn_f32_qs8_vcvt_ukernel_function vcvt, Variant variant = Variant::Native) const {
+    ASSERT_GE(zero_point(), std::numeric_limits<int8_t>::min());
+    ASSERT_LE(zero_point(), std::numeric_limits<int8_t>::max());
+    ASSERT_GE(qmin(), std::numeric_limits<int8_t>::min());
+    ASSERT_LE(qmax(), std::numeric_limits<int8_t>::max());
+    ASSERT_LT(qmin(), qmax());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+
+    std::vector<float> x(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<int8_t> y(batch_size());
+    std::vector<int8_t> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f32rng));
+      std::fill(y.begin(), y.end(), INT8_C(0xA5));
+
+      union xnn_f32_qs8_cvt_params params;
+      switch (variant) {
+        case Variant::Native:
+          params = xnn_init_f32_qs8_cvt_params(scale(), int8_t(zero_point()), int8_t(qmin()), int8_t(qmax()));
+          break;
+        case Variant::Scalar:
+          params = xnn_init_scalar_f32_qs8_cvt_params(scale(), int8_t(zero_point()), int8_t(qmin()), int8_t(qmax()));
+          break;
+      }
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        float scaled_input = x[i] * scale();
+        scaled_input = std::min<float>(scaled_input, float(qmax() - zero_point()));
+        scaled_input = std::max<float>(scaled_input, float(qmin() - zero_point()));
+        y_ref[i] = int8_t(std::lrintf(scaled_input) + long(zero_point()));
+      }
+
+      // Call optimized micro-kernel.
+      vcvt(batch_size() * sizeof(float), x.data(), y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_EQ(int32_t(y_ref[i]), int32_t(y[i]))
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << x[i]
+          << ", scale = " << scale() << ", zero point = " << zero_point();
+      }
+    }
+  }
+
+  void Test(xnn_qs8_f32_vcvt_ukernel_function vcvt, Variant variant = Variant::Native) const {
+    ASSERT_GE(zero_point(), std::numeric_limits<int8_t>::min());
+    ASSERT_LE(zero_point(), std::numeric_limits<int8_t>::max());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+      std::ref(rng));
+
+    std::vector<int8_t> x(batch_size() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<float> y(batch_size());
+    std::vector<float> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(i8rng));
+      std::fill(y.begin(), y.end(), std::nanf(""));
+
+      union xnn_qs8_f32_cvt_params params;
+      switch (variant) {
+        case Variant::Native:
+          params = xnn_init_qs8_f32_cvt_params(scale(), int8_t(zero_point()));
+          break;
+        case Variant::Scalar:
+          params = xnn_init_scalar_qs8_f32_cvt_params(scale(), int8_t(zero_point()));
+          break;
+      }
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        y_ref[i] = float(int32_t(x[i]) - int32_t(zero_point())) * scale();
+      }
+
+      // Call optimized micro-kernel.
+      vcvt(batch_size() * sizeof(int8_t), x.data(), y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_EQ(y_ref[i], y[i])
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << int32_t(x[i])
+          << ", scale = " << scale() << ", zero point = " << zero_point();
+      }
+    }
+  }
+
+ private:
+  size_t batch_size_{1};
+  float input_min_{-1.0f};
+  float input_max_{1.0f};
+  float scale_{150.0f};
+  int16_t zero_point_{1};
+  int16_t qmin_{std::numeric_limits<int8_t>::min()};
+  int16_t qmax_{std::numeric_limits<int8_t>::max()};
+  size_t iterations_{15};
+};
@@ -0,0 +1,466 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/subgraph.h>
+#include <xnnpack/weights-cache.h>
+
+#include <gtest/gtest.h>
+
+// Weights of a model with a 3x3 Convolution and a Fully Connected Node:
+//   input [1, 8, 8, 3] -> Convolution -> [1, 8, 8, 8] -> Fully Connected -> output [1, 8, 8, 4]
+struct ModelWeights {
+  ModelWeights() : conv_filter(8 * 3 * 3 * 3), conv_bias(8), fc_filter(4 * 8), fc_bias(4) {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+    std::generate(conv_filter.begin(), conv_filter.end(), std::ref(f32rng));
+    std::generate(conv_bias.begin(), conv_bias.end(), std::ref(f32rng));
+    std::generate(fc_filter.begin(), fc_filter.end(), std::ref(f32rng));
+    std::generate(fc_bias.begin(), fc_bias.end(), std::ref(f32rng));
+  }
+
+  std::vector<float> conv_filter;
+  std::vector<float> conv_bias;
+  std::vector<float> fc_filter;
+  std::vector<float> fc_bias;
+};
+
+static const size_t kInputSize = 1 * 8 * 8 * 3;
+static const size_t kOutputSize = 1 * 8 * 8 * 4;
+
+static xnn_runtime_t create_runtime(const ModelWeights& weights, xnn_weights_cache_t weights_cache)
+{
+  xnn_subgraph_t subgraph = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph));
+
+  const std::array<size_t, 4> input_dims = {{1, 8, 8, 3}};
+  const std::array<size_t, 4> conv_filter_dims = {{8, 3, 3, 3}};
+  const std::array<size_t, 1> conv_bias_dims = {{8}};
+  const std::array<size_t, 4> conv_output_dims = {{1, 8, 8, 8}};
+  const std::array<size_t, 2> fc_filter_dims = {{4, 8}};
+  const std::array<size_t, 1> fc_bias_dims = {{4}};
+  const std::array<size_t, 4> output_dims = {{1, 8, 8, 4}};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, input_dims.size(),
+    input_dims.data(), nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t conv_filter_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, conv_filter_dims.size(),
+    conv_filter_dims.data(), weights.conv_filter.data(), XNN_INVALID_VALUE_ID, 0 /* flags */, &conv_filter_id));
+  uint32_t conv_bias_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, conv_bias_dims.size(),
+    conv_bias_dims.data(), weights.conv_bias.data(), XNN_INVALID_VALUE_ID, 0 /* flags */, &conv_bias_id));
+  uint32_t conv_output_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, conv_output_dims.size(),
+    conv_output_dims.data(), nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */, &conv_output_id));
+  uint32_t fc_filter_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, fc_filter_dims.size(),
+    fc_filter_dims.data(), weights.fc_filter.data(), XNN_INVALID_VALUE_ID, 0 /* flags */, &fc_filter_id));
+  uint32_t fc_bias_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, fc_bias_dims.size(),
+    fc_bias_dims.data(), weights.fc_bias.data(), XNN_INVALID_VALUE_ID, 0 /* flags */, &fc_bias_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, output_dims.size(),
+    output_dims.data(), nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+
+  EXPECT_EQ(xnn_status_success, xnn_define_convolution_2d(subgraph,
+    1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 3, 8, -INFINITY, INFINITY,
+    input_id, conv_filter_id, conv_bias_id, conv_output_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_success, xnn_define_fully_connected(subgraph, -INFINITY, INFINITY,
+    conv_output_id, fc_filter_id, fc_bias_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_runtime_v4(subgraph, weights_cache, nullptr /* workspace */,
+    nullptr /* threadpool */, 0 /* flags */, &runtime));
+  xnn_delete_subgraph(subgraph);
+  return runtime;
+}
+
+static std::vector<float> run_runtime(xnn_runtime_t runtime, const std::vector<float>& input)
+{
+  std::vector<float> output(kOutputSize, std::nanf(""));
+  const std::array<xnn_external_value, 2> external = {{
+    xnn_external_value{0, const_cast<float*>(input.data())}, xnn_external_value{1, output.data()}}};
+  EXPECT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  EXPECT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  return output;
+}
+
+static std::vector<float> random_input()
+{
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  std::vector<float> input(kInputSize);
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  return input;
+}
+
+// Packed weights of the operators in the runtime which have weights, in execution order.
+static std::vector<const void*> packed_weights(xnn_runtime_t runtime)
+{
+  std::vector<const void*> result;
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    const xnn_operator_t op = runtime->opdata[i].operator_object;
+    if (op != nullptr && op->packed_weights != nullptr) {
+      result.push_back(op->packed_weights);
+    }
+  }
+  return result;
+}
+
+TEST(WEIGHTS_CACHE, compute_key) {
+  const std::array<size_t, 2> config = {{3, 4}};
+  std::vector<float> kernel(12, 1.0f);
+  std::vector<float> bias(4, 0.0f);
+
+  const xnn_weights_cache_key key = xnn_weights_cache_compute_key(
+    config.data(), sizeof(config), nullptr, 0, kernel.data(), kernel.size() * sizeof(float),
+    bias.data(), bias.size() * sizeof(float));
+  const xnn_weights_cache_key same_key = xnn_weights_cache_compute_key(
+    config.data(), sizeof(config), nullptr, 0, kernel.data(), kernel.size() * sizeof(float),
+    bias.data(), bias.size() * sizeof(float));
+  ASSERT_EQ(key.hash[0], same_key.hash[0]);
+  ASSERT_EQ(key.hash[1], same_key.hash[1]);
+
+  // Missing bias differs from the all-zeroes bias.
+  const xnn_weights_cache_key no_bias_key = xnn_weights_cache_compute_key(
+    config.data(), sizeof(config), nullptr, 0, kernel.data(), kernel.size() * sizeof(float),
+    nullptr, bias.size() * sizeof(float));
+  ASSERT_NE(key.hash[0], no_bias_key.hash[0]);
+  ASSERT_NE(key.hash[1], no_bias_key.hash[1]);
+
+  // Every bit of the kernel affects both halves of the key.
+  for (size_t i = 0; i < kernel.size() * sizeof(float) * 8; i++) {
+    std::vector<float> changed_kernel(kernel);
+    reinterpret_cast<uint8_t*>(changed_kernel.data())[i / 8] ^= uint8_t(1 << (i % 8));
+    const xnn_weights_cache_key changed_key = xnn_weights_cache_compute_key(
+      config.data(), sizeof(config), nullptr, 0, changed_kernel.data(), changed_kernel.size() * sizeof(float),
+      bias.data(), bias.size() * sizeof(float));
+    ASSERT_NE(key.hash[0], changed_key.hash[0]) << "bit " << i;
+    ASSERT_NE(key.hash[1], changed_key.hash[1]) << "bit " << i;
+  }
+
+  // Moving bytes between the kernel and the bias changes the key.
+  const xnn_weights_cache_key shifted_key = xnn_weights_cache_compute_key(
+    config.data(), sizeof(config), nullptr, 0, kernel.data(), (kernel.size() - 1) * sizeof(float),
+    bias.data(), bias.size() * sizeof(float));
+  ASSERT_NE(key.hash[0], shifted_key.hash[0]);
+
+  // Additional data changes the key.
+  xnn_weights_cache_key scaled_key = key;
+  const std::array<float, 4> scale = {{1.0f, 1.0f, 1.0f, 1.0f}};
+  xnn_weights_cache_update_key(&scaled_key, scale.data(), sizeof(scale));
+  ASSERT_NE(key.hash[0], scaled_key.hash[0]);
+  ASSERT_NE(key.hash[1], scaled_key.hash[1]);
+}
+
+TEST(WEIGHTS_CACHE, dedup_across_runtimes) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+
+  const ModelWeights weights;
+  xnn_runtime_t runtime1 = create_runtime(weights, weights_cache);
+  ASSERT_NE(nullptr, runtime1);
+  ASSERT_EQ(2, weights_cache->num_entries);
+
+  // Identical raw weights in a separate copy are looked up by key.
+  const ModelWeights weights_copy(weights);
+  xnn_runtime_t runtime2 = create_runtime(weights_copy, weights_cache);
+  ASSERT_NE(nullptr, runtime2);
+  ASSERT_EQ(2, weights_cache->num_entries);
+  for (size_t i = 0; i < weights_cache->num_entries; i++) {
+    ASSERT_EQ(2, weights_cache->entries[i].ref_count);
+  }
+
+  const std::vector<const void*> packed_weights1 = packed_weights(runtime1);
+  const std::vector<const void*> packed_weights2 = packed_weights(runtime2);
+  ASSERT_EQ(2, packed_weights1.size());
+  ASSERT_EQ(packed_weights1, packed_weights2);
+
+  xnn_runtime_t reference_runtime = create_runtime(weights, nullptr /* weights cache */);
+  ASSERT_NE(nullptr, reference_runtime);
+  const std::vector<float> input = random_input();
+  const std::vector<float> reference_output = run_runtime(reference_runtime, input);
+  ASSERT_EQ(reference_output, run_runtime(runtime1, input));
+  ASSERT_EQ(reference_output, run_runtime(runtime2, input));
+
+  // Packed weights stay in the cache while any runtime uses them.
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime1));
+  ASSERT_EQ(2, weights_cache->num_entries);
+  ASSERT_EQ(reference_output, run_runtime(runtime2, input));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime2));
+  ASSERT_EQ(0, weights_cache->num_entries);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(reference_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_release_weights_cache(weights_cache));
+}
+
+TEST(WEIGHTS_CACHE, no_reuse_after_weights_change) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+
+  const ModelWeights weights;
+  xnn_runtime_t runtime1 = create_runtime(weights, weights_cache);
+  ASSERT_NE(nullptr, runtime1);
+
+  // Change one element of the Convolution filter, and one bit of the Fully Connected bias.
+  ModelWeights changed_weights(weights);
+  changed_weights.conv_filter[17] += 1.0f;
+  uint32_t bias_bits;
+  memcpy(&bias_bits, &changed_weights.fc_bias[3], sizeof(bias_bits));
+  bias_bits ^= 1;
+  memcpy(&changed_weights.fc_bias[3], &bias_bits, sizeof(bias_bits));
+  xnn_runtime_t runtime2 = create_runtime(changed_weights, weights_cache);
+  ASSERT_NE(nullptr, runtime2);
+  ASSERT_EQ(4, weights_cache->num_entries);
+
+  const std::vector<const void*> packed_weights1 = packed_weights(runtime1);
+  const std::vector<const void*> packed_weights2 = packed_weights(runtime2);
+  ASSERT_EQ(2, packed_weights1.size());
+  ASSERT_EQ(2, packed_weights2.size());
+  ASSERT_NE(packed_weights1[0], packed_weights2[0]);
+  ASSERT_NE(packed_weights1[1], packed_weights2[1]);
+
+  xnn_runtime_t reference_runtime1 = create_runtime(weights, nullptr /* weights cache */);
+  xnn_runtime_t reference_runtime2 = create_runtime(changed_weights, nullptr /* weights cache */);
+  ASSERT_NE(nullptr, reference_runtime1);
+  ASSERT_NE(nullptr, reference_runtime2);
+  const std::vector<float> input = random_input();
+  ASSERT_EQ(run_runtime(reference_runtime1, input), run_runtime(runtime1, input));
+  ASSERT_EQ(run_runtime(reference_runtime2, input), run_runtime(runtime2, input));
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime1));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime2));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(reference_runtime1));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(reference_runtime2));
+  ASSERT_EQ(xnn_status_success, xnn_release_weights_cache(weights_cache));
+}
+
+TEST(WEIGHTS_CACHE, release_before_runtimes) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+  const ModelWeights weights;
+  xnn_runtime_t runtime = create_runtime(weights, weights_cache);
+  ASSERT_NE(nullptr, runtime);
+
+  // Operators keep the cache alive.
+  ASSERT_EQ(xnn_status_success, xnn_release_weights_cache(weights_cache));
+
+  xnn_runtime_t reference_runtime = create_runtime(weights, nullptr /* weights cache */);
+  ASSERT_NE(nullptr, reference_runtime);
+  const std::vector<float> input = random_input();
+  ASSERT_EQ(run_runtime(reference_runtime, input), run_runtime(runtime, input));
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(reference_runtime));
+}
+
+static std::string temp_filename(const char* name)
+{
+  std::random_device random_device;
+  return testing::TempDir() + "/" + name + "-" + std::to_string(random_device()) + ".xnncache";
+}
+
+static std::vector<char> read_file(const std::string& filename)
+{
+  std::ifstream file(filename, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static void write_file(const std::string& filename, const std::vector<char>& data)
+{
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  file.write(data.data(), data.size());
+}
+
+// Save a weights cache with the packed weights of a model to a file.
+static void save_model_weights(const ModelWeights& weights, const std::string& filename)
+{
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_weights_cache(&weights_cache));
+  xnn_runtime_t runtime = create_runtime(weights, weights_cache);
+  ASSERT_NE(nullptr, runtime);
+  ASSERT_EQ(xnn_status_success, xnn_save_weights_cache(weights_cache, filename.c_str()));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+  ASSERT_EQ(xnn_status_success, xnn_release_weights_cache(weights_cache));
+}
+
+TEST(WEIGHTS_CACHE, save_and_load) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const std::string filename = temp_filename("save_and_load");
+  const ModelWeights weights;
+  save_model_weights(weights, filename);
+
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_load_weights_cache(filename.c_str(), &weights_cache));
+  ASSERT_EQ(2, weights_cache->num_entries);
+
+  // Operators use the packed weights directly from the mapping of the file.
+  xnn_runtime_t runtime = create_runtime(weights, weights_cache);
+  ASSERT_NE(nullptr, runtime);
+  ASSERT_EQ(2, weights_cache->num_entries);
+  for (const void* packed_weights : packed_weights(runtime)) {
+    const uintptr_t mapping_start = reinterpret_cast<uintptr_t>(weights_cache->mapping);
+    ASSERT_GE(reinterpret_cast<uintptr_t>(packed_weights), mapping_start);
+    ASSERT_LT(reinterpret_cast<uintptr_t>(packed_weights), mapping_start + weights_cache->mapping_size);
+  }
+
+  xnn_runtime_t reference_runtime = create_runtime(weights, nullptr /* weights cache */);
+  ASSERT_NE(nullptr, reference_runtime);
+  const std::vector<float> input = random_input();
+  ASSERT_EQ(run_runtime(reference_runtime, input), run_runtime(runtime, input));
+
+  // Mapped entries stay in the cache after the runtime is deleted.
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+  ASSERT_EQ(2, weights_cache->num_entries);
+
+  // Saving the loaded cache to another file reproduces the file.
+  const std::string resaved_filename = temp_filename("save_and_load_resaved");
+  ASSERT_EQ(xnn_status_success, xnn_save_weights_cache(weights_cache, resaved_filename.c_str()));
+  ASSERT_EQ(read_file(filename), read_file(resaved_filename));
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(reference_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_release_weights_cache(weights_cache));
+  std::remove(filename.c_str());
+  std::remove(resaved_filename.c_str());
+}
+
+TEST(WEIGHTS_CACHE, load_with_different_weights) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const std::string filename = temp_filename("load_with_different_weights");
+  const ModelWeights weights;
+  save_model_weights(weights, filename);
+
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_load_weights_cache(filename.c_str(), &weights_cache));
+
+  // Weights which are not in the file are packed, and added to the cache.
+  ModelWeights changed_weights(weights);
+  changed_weights.fc_filter[0] = -changed_weights.fc_filter[0];
+  xnn_runtime_t runtime = create_runtime(changed_weights, weights_cache);
+  ASSERT_NE(nullptr, runtime);
+  ASSERT_EQ(3, weights_cache->num_entries);
+
+  xnn_runtime_t reference_runtime = create_runtime(changed_weights, nullptr /* weights cache */);
+  ASSERT_NE(nullptr, reference_runtime);
+  const std::vector<float> input = random_input();
+  ASSERT_EQ(run_runtime(reference_runtime, input), run_runtime(runtime, input));
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+  ASSERT_EQ(2, weights_cache->num_entries);
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(reference_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_release_weights_cache(weights_cache));
+  std::remove(filename.c_str());
+}
+
+TEST(WEIGHTS_CACHE, load_truncated_file) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const std::string filename = temp_filename("load_truncated_file");
+  save_model_weights(ModelWeights(), filename);
+  const std::vector<char> data = read_file(filename);
+  ASSERT_GT(data.size(), 64);
+
+  const std::string truncated_filename = temp_filename("load_truncated_file_truncated");
+  for (size_t size : {size_t(0), size_t(4), size_t(31), size_t(32), size_t(40), size_t(64), data.size() - 1}) {
+    write_file(truncated_filename, std::vector<char>(data.begin(), data.begin() + size));
+    xnn_weights_cache_t weights_cache = nullptr;
+    ASSERT_EQ(xnn_status_invalid_parameter, xnn_load_weights_cache(truncated_filename.c_str(), &weights_cache))
+      << "size " << size;
+  }
+
+  std::remove(filename.c_str());
+  std::remove(truncated_filename.c_str());
+}
+
+TEST(WEIGHTS_CACHE, load_mismatched_file) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const std::string filename = temp_filename("load_mismatched_file");
+  save_model_weights(ModelWeights(), filename);
+  const std::vector<char> data = read_file(filename);
+
+  const std::string mismatched_filename = temp_filename("load_mismatched_file_mismatched");
+  xnn_weights_cache_t weights_cache = nullptr;
+
+  // Different magic number: not a weights cache file.
+  std::vector<char> mismatched_data(data);
+  mismatched_data[0] ^= 1;
+  write_file(mismatched_filename, mismatched_data);
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_load_weights_cache(mismatched_filename.c_str(), &weights_cache));
+
+  // Different version of the file format.
+  mismatched_data = data;
+  mismatched_data[4] += 1;
+  write_file(mismatched_filename, mismatched_data);
+  ASSERT_EQ(xnn_status_unsupported_parameter, xnn_load_weights_cache(mismatched_filename.c_str(), &weights_cache));
+
+  // Different micro-kernel configuration.
+  for (size_t offset : {size_t(8), size_t(16)}) {
+    mismatched_data = data;
+    mismatched_data[offset] ^= 1;
+    write_file(mismatched_filename, mismatched_data);
+    ASSERT_EQ(xnn_status_unsupported_parameter, xnn_load_weights_cache(mismatched_filename.c_str(), &weights_cache))
+      << "offset " << offset;
+  }
+
+  // Missing file.
+  std::remove(mismatched_filename.c_str());
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_load_weights_cache(mismatched_filename.c_str(), &weights_cache));
+
+  std::remove(filename.c_str());
+}
+
+TEST(WEIGHTS_CACHE, save_to_loaded_file) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const std::string filename = temp_filename("save_to_loaded_file");
+  const ModelWeights weights;
+  save_model_weights(weights, filename);
+  const std::vector<char> data = read_file(filename);
+
+  xnn_weights_cache_t weights_cache = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_load_weights_cache(filename.c_str(), &weights_cache));
+  xnn_runtime_t runtime = create_runtime(weights, weights_cache);
+  ASSERT_NE(nullptr, runtime);
+
+  // Overwriting the mapped file would invalidate the packed weights in use: the file is left unchanged.
+  ASSERT_EQ(xnn_status_invalid_parameter, xnn_save_weights_cache(weights_cache, filename.c_str()));
+  ASSERT_EQ(data, read_file(filename));
+
+  xnn_runtime_t reference_runtime = create_runtime(weights, nullptr /* weights cache */);
+  ASSERT_NE(nullptr, reference_runtime);
+  const std::vector<float> input = random_input();
+  ASSERT_EQ(run_runtime(reference_runtime, input), run_runtime(runtime, input));
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(reference_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_release_weights_cache(weights_cache));
+  std::remove(filename.c_str());
+}
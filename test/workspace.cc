@@ -0,0 +1,178 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+#include <gtest/gtest.h>
+
+// Runtime computing output = abs(-input) for a [1, height, width, 8] input, with the intermediate Value in the
+// Workspace.
+static xnn_runtime_t create_negate_abs_runtime(xnn_workspace_t workspace, size_t height, size_t width)
+{
+  xnn_subgraph_t subgraph = nullptr;
+  EXPECT_EQ(xnn_status_success, xnn_create_subgraph(2, 0 /* flags */, &subgraph));
+  const std::array<size_t, 4> dims = {{1, height, width, 8}};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+    nullptr, 0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t negated_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+    nullptr, XNN_INVALID_VALUE_ID, 0 /* flags */, &negated_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  EXPECT_EQ(xnn_status_success, xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+    nullptr, 1, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  EXPECT_EQ(xnn_status_success, xnn_define_negate(subgraph, input_id, negated_id, 0 /* flags */));
+  EXPECT_EQ(xnn_status_success, xnn_define_abs(subgraph, negated_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime = nullptr;
+  EXPECT_EQ(xnn_status_success,
+    xnn_create_runtime_v3(subgraph, workspace, nullptr /* threadpool */, 0 /* flags */, &runtime));
+  xnn_delete_subgraph(subgraph);
+  return runtime;
+}
+
+static std::vector<float> random_input(size_t size)
+{
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  std::vector<float> input(size);
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+  return input;
+}
+
+static void verify_output(const std::vector<float>& input, const std::vector<float>& output)
+{
+  for (size_t i = 0; i < input.size(); i++) {
+    ASSERT_EQ(std::abs(input[i]), output[i]) << "at " << i;
+  }
+}
+
+TEST(WORKSPACE, private_workspace) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_runtime_t runtime = create_negate_abs_runtime(nullptr /* workspace */, 4, 4);
+  ASSERT_NE(nullptr, runtime);
+
+  const std::vector<float> input = random_input(4 * 4 * 8);
+  std::vector<float> output(input.size());
+  const std::array<xnn_external_value, 2> external = {{
+    xnn_external_value{0, const_cast<float*>(input.data())}, xnn_external_value{1, output.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  verify_output(input, output);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(WORKSPACE, invoke_before_setup) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_runtime_t runtime = create_negate_abs_runtime(nullptr /* workspace */, 4, 4);
+  ASSERT_NE(nullptr, runtime);
+  ASSERT_EQ(xnn_status_invalid_state, xnn_invoke_runtime(runtime));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
+
+TEST(WORKSPACE, shared_workspace_growth_requires_setup) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_workspace_t workspace = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_workspace(&workspace));
+
+  xnn_runtime_t small_runtime = create_negate_abs_runtime(workspace, 4, 4);
+  ASSERT_NE(nullptr, small_runtime);
+  const std::vector<float> small_input = random_input(4 * 4 * 8);
+  std::vector<float> small_output(small_input.size());
+  const std::array<xnn_external_value, 2> small_external = {{
+    xnn_external_value{0, const_cast<float*>(small_input.data())}, xnn_external_value{1, small_output.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(small_runtime, small_external.size(), small_external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(small_runtime));
+  verify_output(small_input, small_output);
+
+  // Creation of a runtime with larger internal Values grows the shared workspace, and invalidates the setup of the
+  // first runtime.
+  xnn_runtime_t large_runtime = create_negate_abs_runtime(workspace, 16, 16);
+  ASSERT_NE(nullptr, large_runtime);
+  ASSERT_EQ(xnn_status_invalid_state, xnn_invoke_runtime(small_runtime));
+
+  const std::vector<float> large_input = random_input(16 * 16 * 8);
+  std::vector<float> large_output(large_input.size());
+  const std::array<xnn_external_value, 2> large_external = {{
+    xnn_external_value{0, const_cast<float*>(large_input.data())}, xnn_external_value{1, large_output.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(large_runtime, large_external.size(), large_external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(large_runtime));
+  verify_output(large_input, large_output);
+
+  // Setting up the first runtime again binds it to the new workspace memory.
+  std::fill(small_output.begin(), small_output.end(), std::nanf(""));
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(small_runtime, small_external.size(), small_external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(small_runtime));
+  verify_output(small_input, small_output);
+
+  // The runtime with the larger Values fits into the workspace, and stays valid.
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(large_runtime));
+  verify_output(large_input, large_output);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(small_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(large_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_release_workspace(workspace));
+}
+
+TEST(WORKSPACE, smaller_runtime_keeps_setup) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_workspace_t workspace = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_workspace(&workspace));
+
+  xnn_runtime_t large_runtime = create_negate_abs_runtime(workspace, 16, 16);
+  ASSERT_NE(nullptr, large_runtime);
+  const std::vector<float> large_input = random_input(16 * 16 * 8);
+  std::vector<float> large_output(large_input.size());
+  const std::array<xnn_external_value, 2> large_external = {{
+    xnn_external_value{0, const_cast<float*>(large_input.data())}, xnn_external_value{1, large_output.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(large_runtime, large_external.size(), large_external.data()));
+
+  // A runtime which fits into the workspace doesn't reallocate it.
+  xnn_runtime_t small_runtime = create_negate_abs_runtime(workspace, 4, 4);
+  ASSERT_NE(nullptr, small_runtime);
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(large_runtime));
+  verify_output(large_input, large_output);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(small_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(large_runtime));
+  ASSERT_EQ(xnn_status_success, xnn_release_workspace(workspace));
+}
+
+TEST(WORKSPACE, release_before_runtime) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  xnn_workspace_t workspace = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_workspace(&workspace));
+  xnn_runtime_t runtime = create_negate_abs_runtime(workspace, 4, 4);
+  ASSERT_NE(nullptr, runtime);
+
+  // The runtime keeps the workspace alive.
+  ASSERT_EQ(xnn_status_success, xnn_release_workspace(workspace));
+
+  const std::vector<float> input = random_input(4 * 4 * 8);
+  std::vector<float> output(input.size());
+  const std::array<xnn_external_value, 2> external = {{
+    xnn_external_value{0, const_cast<float*>(input.data())}, xnn_external_value{1, output.data()}}};
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime, external.size(), external.data()));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime));
+  verify_output(input, output);
+
+  ASSERT_EQ(xnn_status_success, xnn_delete_runtime(runtime));
+}
@@ -0,0 +1,223 @@
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/transpose.h>
+#include "transpose-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(X16_TRANSPOSE__8X8_NEON, block_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    TransposeMicrokernelTester()
+      .block_width(8)
+      .block_height(8)
+      .Test(xnn_x16_transpose_ukernel__8x8_neon);
+  }
+
+  TEST(X16_TRANSPOSE__8X8_NEON, block_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t block_height = 8; block_height <= 24; block_height += 8) {
+      for (size_t block_width = 8; block_width <= 24; block_width += 8) {
+        TransposeMicrokernelTester()
+          .block_width(block_width)
+          .block_height(block_height)
+          .Test(xnn_x16_transpose_ukernel__8x8_neon);
+      }
+    }
+  }
+
+  TEST(X16_TRANSPOSE__8X8_NEON, block_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t block_height = 1; block_height < 8; block_height++) {
+      for (size_t block_width = 1; block_width < 8; block_width++) {
+        TransposeMicrokernelTester()
+          .block_width(block_width)
+          .block_height(block_height)
+          .Test(xnn_x16_transpose_ukernel__8x8_neon);
+      }
+    }
+  }
+
+  TEST(X16_TRANSPOSE__8X8_NEON, block_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t block_height = 1; block_height < 17; block_height++) {
+      for (size_t block_width = 1; block_width < 17; block_width++) {
+        TransposeMicrokernelTester()
+          .block_width(block_width)
+          .block_height(block_height)
+          .Test(xnn_x16_transpose_ukernel__8x8_neon);
+      }
+    }
+  }
+
+  TEST(X16_TRANSPOSE__8X8_NEON, input_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t block_height = 1; block_height <= 17; block_height += 7) {
+      for (size_t block_width = 1; block_width <= 17; block_width += 7) {
+        TransposeMicrokernelTester()
+          .block_width(block_width)
+          .block_height(block_height)
+          .input_stride(21)
+          .Test(xnn_x16_transpose_ukernel__8x8_neon);
+      }
+    }
+  }
+
+  TEST(X16_TRANSPOSE__8X8_NEON, output_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t block_height = 1; block_height <= 17; block_height += 7) {
+      for (size_t block_width = 1; block_width <= 17; block_width += 7) {
+        TransposeMicrokernelTester()
+          .block_width(block_width)
+          .block_height(block_height)
+          .output_stride(21)
+          .Test(xnn_x16_transpose_ukernel__8x8_neon);
+      }
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X16_TRANSPOSE__8X8_SSE2, block_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    TransposeMicrokernelTester()
+      .block_width(8)
+      .block_height(8)
+      .Test(xnn_x16_transpose_ukernel__8x8_sse2);
+  }
+
+  TEST(X16_TRANSPOSE__8X8_SSE2, block_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t block_height = 8; block_height <= 24; block_height += 8) {
+      for (size_t block_width = 8; block_width <= 24; block_width += 8) {
+        TransposeMicrokernelTester()
+          .block_width(block_width)
+          .block_height(block_height)
+          .Test(xnn_x16_transpose_ukernel__8x8_sse2);
+      }
+    }
+  }
+
+  TEST(X16_TRANSPOSE__8X8_SSE2, block_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t block_height = 1; block_height < 8; block_height++) {
+      for (size_t block_width = 1; block_width < 8; block_width++) {
+        TransposeMicrokernelTester()
+          .block_width(block_width)
+          .block_height(block_height)
+          .Test(xnn_x16_transpose_ukernel__8x8_sse2);
+      }
+    }
+  }
+
+  TEST(X16_TRANSPOSE__8X8_SSE2, block_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t block_height = 1; block_height < 17; block_height++) {
+      for (size_t block_width = 1; block_width < 17; block_width++) {
+        TransposeMicrokernelTester()
+          .block_width(block_width)
+          .block_height(block_height)
+          .Test(xnn_x16_transpose_ukernel__8x8_sse2);
+      }
+    }
+  }
+
+  TEST(X16_TRANSPOSE__8X8_SSE2, input_stride) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t block_height = 1; block_height <= 17; block_height += 7) {
+      for (size_t block_width = 1; block_width <= 17; block_width += 7) {
+        TransposeMicrokernelTester()
+          .block_width(block_width)
+          .block_height(block_height)
+          .input_stride(21)
+          .Test(xnn_x16_transpose_ukernel__8x8_sse2);
+      }
+    }
+  }
+
+  TEST(X16_TRANSPOSE__8X8_SSE2, output_stride) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t block_height = 1; block_height <= 17; block_height += 7) {
+      for (size_t block_width = 1; block_width <= 17; block_width += 7) {
+        TransposeMicrokernelTester()
+          .block_width(block_width)
+          .block_height(block_height)
+          .output_stride(21)
+          .Test(xnn_x16_transpose_ukernel__8x8_sse2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(X16_TRANSPOSE__4X4_SCALAR, block_eq_4) {
+  TransposeMicrokernelTester()
+    .block_width(4)
+    .block_height(4)
+    .Test(xnn_x16_transpose_ukernel__4x4_scalar);
+}
+
+TEST(X16_TRANSPOSE__4X4_SCALAR, block_div_4) {
+  for (size_t block_height = 4; block_height <= 12; block_height += 4) {
+    for (size_t block_width = 4; block_width <= 12; block_width += 4) {
+      TransposeMicrokernelTester()
+        .block_width(block_width)
+        .block_height(block_height)
+        .Test(xnn_x16_transpose_ukernel__4x4_scalar);
+    }
+  }
+}
+
+TEST(X16_TRANSPOSE__4X4_SCALAR, block_lt_4) {
+  for (size_t block_height = 1; block_height < 4; block_height++) {
+    for (size_t block_width = 1; block_width < 4; block_width++) {
+      TransposeMicrokernelTester()
+        .block_width(block_width)
+        .block_height(block_height)
+        .Test(xnn_x16_transpose_ukernel__4x4_scalar);
+    }
+  }
+}
+
+TEST(X16_TRANSPOSE__4X4_SCALAR, block_gt_4) {
+  for (size_t block_height = 1; block_height < 9; block_height++) {
+    for (size_t block_width = 1; block_width < 9; block_width++) {
+      TransposeMicrokernelTester()
+        .block_width(block_width)
+        .block_height(block_height)
+        .Test(xnn_x16_transpose_ukernel__4x4_scalar);
+    }
+  }
+}
+
+TEST(X16_TRANSPOSE__4X4_SCALAR, input_stride) {
+  for (size_t block_height = 1; block_height <= 9; block_height += 3) {
+    for (size_t block_width = 1; block_width <= 9; block_width += 3) {
+      TransposeMicrokernelTester()
+        .block_width(block_width)
+        .block_height(block_height)
+        .input_stride(13)
+        .Test(xnn_x16_transpose_ukernel__4x4_scalar);
+    }
+  }
+}
+
+TEST(X16_TRANSPOSE__4X4_SCALAR, output_stride) {
+  for (size_t block_height = 1; block_height <= 9; block_height += 3) {
+    for (size_t block_width = 1; block_width <= 9; block_width += 3) {
+      TransposeMicrokernelTester()
+        .block_width(block_width)
+        .block_height(block_height)
+        .output_stride(13)
+        .Test(xnn_x16_transpose_ukernel__4x4_scalar);
+    }
+  }
+}
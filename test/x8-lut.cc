@@ -1,60 +1,1211 @@
-// Copyright (c) Facebook, Inc. and its affiliates.
-// All rights reserved.
-//
 // Copyright 2019 Google LLC
 //
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/x8-lut.yaml
+//   Generator: tools/generate-lut-test.py
+
 
 #include <gtest/gtest.h>
 
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
 #include <xnnpack/lut.h>
 #include "lut-microkernel-tester.h"
 
 
-TEST(X8_LUT__SCALAR, n_eq_1) {
+#if XNN_ARCH_ARM64
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X16, n_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    LUTMicrokernelTester()
+      .n(16)
+      .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x16);
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X16, n_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 32; n < 160; n += 16) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x16);
+    }
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X16, n_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 16; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x16);
+    }
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X16, n_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 17; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x16);
+    }
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X16, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n <= 80; n += 15) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x16);
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM64
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X32, n_eq_32) {
+    TEST_REQUIRES_ARM_NEON;
+    LUTMicrokernelTester()
+      .n(32)
+      .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x32);
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X32, n_div_32) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 64; n < 320; n += 32) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x32);
+    }
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X32, n_lt_32) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x32);
+    }
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X32, n_gt_32) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 33; n < 64; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x32);
+    }
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X32, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n <= 160; n += 31) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x32);
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM64
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X48, n_eq_48) {
+    TEST_REQUIRES_ARM_NEON;
+    LUTMicrokernelTester()
+      .n(48)
+      .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x48);
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X48, n_div_48) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 96; n < 480; n += 48) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x48);
+    }
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X48, n_lt_48) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 48; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x48);
+    }
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X48, n_gt_48) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 49; n < 96; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x48);
+    }
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X48, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n <= 240; n += 47) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x48);
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM64
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X64, n_eq_64) {
+    TEST_REQUIRES_ARM_NEON;
+    LUTMicrokernelTester()
+      .n(64)
+      .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x64);
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X64, n_div_64) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 128; n < 640; n += 64) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x64);
+    }
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X64, n_lt_64) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 64; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x64);
+    }
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X64, n_gt_64) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 65; n < 128; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x64);
+    }
+  }
+
+  TEST(X8_LUT__AARCH64_NEON_TBX128X4_X64, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n <= 320; n += 63) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__aarch64_neon_tbx128x4_x64);
+    }
+  }
+#endif  // XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__SSSE3_X16, n_eq_16) {
+    TEST_REQUIRES_X86_SSSE3;
+    LUTMicrokernelTester()
+      .n(16)
+      .Test(xnn_x8_lut_ukernel__ssse3_x16);
+  }
+
+  TEST(X8_LUT__SSSE3_X16, n_div_16) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 32; n < 160; n += 16) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__ssse3_x16);
+    }
+  }
+
+  TEST(X8_LUT__SSSE3_X16, n_lt_16) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 1; n < 16; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__ssse3_x16);
+    }
+  }
+
+  TEST(X8_LUT__SSSE3_X16, n_gt_16) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 17; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__ssse3_x16);
+    }
+  }
+
+  TEST(X8_LUT__SSSE3_X16, inplace) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 1; n <= 80; n += 15) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__ssse3_x16);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__SSSE3_X32, n_eq_32) {
+    TEST_REQUIRES_X86_SSSE3;
+    LUTMicrokernelTester()
+      .n(32)
+      .Test(xnn_x8_lut_ukernel__ssse3_x32);
+  }
+
+  TEST(X8_LUT__SSSE3_X32, n_div_32) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 64; n < 320; n += 32) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__ssse3_x32);
+    }
+  }
+
+  TEST(X8_LUT__SSSE3_X32, n_lt_32) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 1; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__ssse3_x32);
+    }
+  }
+
+  TEST(X8_LUT__SSSE3_X32, n_gt_32) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 33; n < 64; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__ssse3_x32);
+    }
+  }
+
+  TEST(X8_LUT__SSSE3_X32, inplace) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 1; n <= 160; n += 31) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__ssse3_x32);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__AVX2_X32, n_eq_32) {
+    TEST_REQUIRES_X86_AVX2;
+    LUTMicrokernelTester()
+      .n(32)
+      .Test(xnn_x8_lut_ukernel__avx2_x32);
+  }
+
+  TEST(X8_LUT__AVX2_X32, n_div_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 64; n < 320; n += 32) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x32);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X32, n_lt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x32);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X32, n_gt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 33; n < 64; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x32);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X32, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 160; n += 31) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx2_x32);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__AVX2_X64, n_eq_64) {
+    TEST_REQUIRES_X86_AVX2;
+    LUTMicrokernelTester()
+      .n(64)
+      .Test(xnn_x8_lut_ukernel__avx2_x64);
+  }
+
+  TEST(X8_LUT__AVX2_X64, n_div_64) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 128; n < 640; n += 64) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x64);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X64, n_lt_64) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 64; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x64);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X64, n_gt_64) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 65; n < 128; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x64);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X64, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 320; n += 63) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx2_x64);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__AVX2_X96, n_eq_96) {
+    TEST_REQUIRES_X86_AVX2;
+    LUTMicrokernelTester()
+      .n(96)
+      .Test(xnn_x8_lut_ukernel__avx2_x96);
+  }
+
+  TEST(X8_LUT__AVX2_X96, n_div_96) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 192; n < 960; n += 96) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x96);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X96, n_lt_96) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 96; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x96);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X96, n_gt_96) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 97; n < 192; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x96);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X96, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 480; n += 95) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx2_x96);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__AVX2_X128, n_eq_128) {
+    TEST_REQUIRES_X86_AVX2;
+    LUTMicrokernelTester()
+      .n(128)
+      .Test(xnn_x8_lut_ukernel__avx2_x128);
+  }
+
+  TEST(X8_LUT__AVX2_X128, n_div_128) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 256; n < 1280; n += 128) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x128);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X128, n_lt_128) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 128; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x128);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X128, n_gt_128) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 129; n < 256; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx2_x128);
+    }
+  }
+
+  TEST(X8_LUT__AVX2_X128, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 640; n += 127) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx2_x128);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X64, n_eq_64) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    LUTMicrokernelTester()
+      .n(64)
+      .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x64);
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X64, n_div_64) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 128; n < 640; n += 64) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x64);
+    }
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X64, n_lt_64) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 1; n < 64; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x64);
+    }
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X64, n_gt_64) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 65; n < 128; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x64);
+    }
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X64, inplace) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 1; n <= 320; n += 63) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x64);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X128, n_eq_128) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    LUTMicrokernelTester()
+      .n(128)
+      .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x128);
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X128, n_div_128) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 256; n < 1280; n += 128) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x128);
+    }
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X128, n_lt_128) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 1; n < 128; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x128);
+    }
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X128, n_gt_128) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 129; n < 256; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x128);
+    }
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X128, inplace) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 1; n <= 640; n += 127) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x128);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X192, n_eq_192) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    LUTMicrokernelTester()
+      .n(192)
+      .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x192);
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X192, n_div_192) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 384; n < 1920; n += 192) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x192);
+    }
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X192, n_lt_192) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 1; n < 192; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x192);
+    }
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X192, n_gt_192) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 193; n < 384; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x192);
+    }
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X192, inplace) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 1; n <= 960; n += 191) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x192);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X256, n_eq_256) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    LUTMicrokernelTester()
+      .n(256)
+      .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x256);
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X256, n_div_256) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 512; n < 2560; n += 256) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x256);
+    }
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X256, n_lt_256) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 1; n < 256; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x256);
+    }
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X256, n_gt_256) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 257; n < 512; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x256);
+    }
+  }
+
+  TEST(X8_LUT__AVX512SKX_VPSHUFB_X256, inplace) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t n = 1; n <= 1280; n += 255) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx512skx_vpshufb_x256);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X64, n_eq_64) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    LUTMicrokernelTester()
+      .n(64)
+      .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x64);
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X64, n_div_64) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 128; n < 640; n += 64) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x64);
+    }
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X64, n_lt_64) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 1; n < 64; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x64);
+    }
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X64, n_gt_64) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 65; n < 128; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x64);
+    }
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X64, inplace) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 1; n <= 320; n += 63) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x64);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X128, n_eq_128) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    LUTMicrokernelTester()
+      .n(128)
+      .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x128);
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X128, n_div_128) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 256; n < 1280; n += 128) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x128);
+    }
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X128, n_lt_128) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 1; n < 128; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x128);
+    }
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X128, n_gt_128) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 129; n < 256; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x128);
+    }
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X128, inplace) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 1; n <= 640; n += 127) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x128);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X192, n_eq_192) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    LUTMicrokernelTester()
+      .n(192)
+      .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x192);
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X192, n_div_192) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 384; n < 1920; n += 192) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x192);
+    }
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X192, n_lt_192) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 1; n < 192; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x192);
+    }
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X192, n_gt_192) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 193; n < 384; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x192);
+    }
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X192, inplace) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 1; n <= 960; n += 191) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x192);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X256, n_eq_256) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    LUTMicrokernelTester()
+      .n(256)
+      .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x256);
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X256, n_div_256) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 512; n < 2560; n += 256) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x256);
+    }
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X256, n_lt_256) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 1; n < 256; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x256);
+    }
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X256, n_gt_256) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 257; n < 512; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x256);
+    }
+  }
+
+  TEST(X8_LUT__AVX512VBMI_VPERMX2B_X256, inplace) {
+    TEST_REQUIRES_X86_AVX512VBMI;
+    for (size_t n = 1; n <= 1280; n += 255) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__avx512vbmi_vpermx2b_x256);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_WASMSIMD
+  TEST(X8_LUT__WASMSIMD_X16, n_eq_16) {
+    LUTMicrokernelTester()
+      .n(16)
+      .Test(xnn_x8_lut_ukernel__wasmsimd_x16);
+  }
+
+  TEST(X8_LUT__WASMSIMD_X16, n_div_16) {
+    for (size_t n = 32; n < 160; n += 16) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x16);
+    }
+  }
+
+  TEST(X8_LUT__WASMSIMD_X16, n_lt_16) {
+    for (size_t n = 1; n < 16; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x16);
+    }
+  }
+
+  TEST(X8_LUT__WASMSIMD_X16, n_gt_16) {
+    for (size_t n = 17; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x16);
+    }
+  }
+
+  TEST(X8_LUT__WASMSIMD_X16, inplace) {
+    for (size_t n = 1; n <= 80; n += 15) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x16);
+    }
+  }
+#endif  // XNN_ARCH_WASMSIMD
+
+
+#if XNN_ARCH_WASMSIMD
+  TEST(X8_LUT__WASMSIMD_X32, n_eq_32) {
+    LUTMicrokernelTester()
+      .n(32)
+      .Test(xnn_x8_lut_ukernel__wasmsimd_x32);
+  }
+
+  TEST(X8_LUT__WASMSIMD_X32, n_div_32) {
+    for (size_t n = 64; n < 320; n += 32) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x32);
+    }
+  }
+
+  TEST(X8_LUT__WASMSIMD_X32, n_lt_32) {
+    for (size_t n = 1; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x32);
+    }
+  }
+
+  TEST(X8_LUT__WASMSIMD_X32, n_gt_32) {
+    for (size_t n = 33; n < 64; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x32);
+    }
+  }
+
+  TEST(X8_LUT__WASMSIMD_X32, inplace) {
+    for (size_t n = 1; n <= 160; n += 31) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x32);
+    }
+  }
+#endif  // XNN_ARCH_WASMSIMD
+
+
+#if XNN_ARCH_WASMSIMD
+  TEST(X8_LUT__WASMSIMD_X48, n_eq_48) {
+    LUTMicrokernelTester()
+      .n(48)
+      .Test(xnn_x8_lut_ukernel__wasmsimd_x48);
+  }
+
+  TEST(X8_LUT__WASMSIMD_X48, n_div_48) {
+    for (size_t n = 96; n < 480; n += 48) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x48);
+    }
+  }
+
+  TEST(X8_LUT__WASMSIMD_X48, n_lt_48) {
+    for (size_t n = 1; n < 48; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x48);
+    }
+  }
+
+  TEST(X8_LUT__WASMSIMD_X48, n_gt_48) {
+    for (size_t n = 49; n < 96; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x48);
+    }
+  }
+
+  TEST(X8_LUT__WASMSIMD_X48, inplace) {
+    for (size_t n = 1; n <= 240; n += 47) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x48);
+    }
+  }
+#endif  // XNN_ARCH_WASMSIMD
+
+
+#if XNN_ARCH_WASMSIMD
+  TEST(X8_LUT__WASMSIMD_X64, n_eq_64) {
+    LUTMicrokernelTester()
+      .n(64)
+      .Test(xnn_x8_lut_ukernel__wasmsimd_x64);
+  }
+
+  TEST(X8_LUT__WASMSIMD_X64, n_div_64) {
+    for (size_t n = 128; n < 640; n += 64) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x64);
+    }
+  }
+
+  TEST(X8_LUT__WASMSIMD_X64, n_lt_64) {
+    for (size_t n = 1; n < 64; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x64);
+    }
+  }
+
+  TEST(X8_LUT__WASMSIMD_X64, n_gt_64) {
+    for (size_t n = 65; n < 128; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x64);
+    }
+  }
+
+  TEST(X8_LUT__WASMSIMD_X64, inplace) {
+    for (size_t n = 1; n <= 320; n += 63) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_x8_lut_ukernel__wasmsimd_x64);
+    }
+  }
+#endif  // XNN_ARCH_WASMSIMD
+
+
+TEST(X8_LUT__SCALAR_X1, n_eq_1) {
   LUTMicrokernelTester()
     .n(1)
-    .Test(xnn_x8_lut_ukernel__scalar);
+    .Test(xnn_x8_lut_ukernel__scalar_x1);
 }
 
-TEST(X8_LUT__SCALAR, small_n) {
-  for (size_t n = 2; n <= 16; n++) {
+TEST(X8_LUT__SCALAR_X1, n_gt_1) {
+  for (size_t n = 2; n < 10; n++) {
     LUTMicrokernelTester()
       .n(n)
-      .Test(xnn_x8_lut_ukernel__scalar);
+      .Test(xnn_x8_lut_ukernel__scalar_x1);
   }
 }
 
-TEST(X8_LUT__SCALAR, large_n) {
-  for (size_t n = 16; n <= 128; n+=2) {
+TEST(X8_LUT__SCALAR_X1, inplace) {
+  for (size_t n = 1; n <= 5; n += 1) {
     LUTMicrokernelTester()
       .n(n)
-      .Test(xnn_x8_lut_ukernel__scalar);
+      .inplace(true)
+      .Test(xnn_x8_lut_ukernel__scalar_x1);
   }
 }
 
-TEST(X8_LUT__SCALAR, n_eq_1_inplace) {
+TEST(X8_LUT__SCALAR_X2, n_eq_2) {
   LUTMicrokernelTester()
-    .n(1)
-    .inplace(true)
-    .Test(xnn_x8_lut_ukernel__scalar);
+    .n(2)
+    .Test(xnn_x8_lut_ukernel__scalar_x2);
+}
+
+TEST(X8_LUT__SCALAR_X2, n_div_2) {
+  for (size_t n = 4; n < 20; n += 2) {
+    LUTMicrokernelTester()
+      .n(n)
+      .Test(xnn_x8_lut_ukernel__scalar_x2);
+  }
+}
+
+TEST(X8_LUT__SCALAR_X2, n_lt_2) {
+  for (size_t n = 1; n < 2; n++) {
+    LUTMicrokernelTester()
+      .n(n)
+      .Test(xnn_x8_lut_ukernel__scalar_x2);
+  }
+}
+
+TEST(X8_LUT__SCALAR_X2, n_gt_2) {
+  for (size_t n = 3; n < 4; n++) {
+    LUTMicrokernelTester()
+      .n(n)
+      .Test(xnn_x8_lut_ukernel__scalar_x2);
+  }
 }
 
-TEST(X8_LUT__SCALAR, small_n_inplace) {
-  for (size_t n = 2; n <= 16; n++) {
+TEST(X8_LUT__SCALAR_X2, inplace) {
+  for (size_t n = 1; n <= 10; n += 1) {
     LUTMicrokernelTester()
       .n(n)
       .inplace(true)
-      .Test(xnn_x8_lut_ukernel__scalar);
+      .Test(xnn_x8_lut_ukernel__scalar_x2);
   }
 }
 
-TEST(X8_LUT__SCALAR, large_n_inplace) {
-  for (size_t n = 16; n <= 128; n+=2) {
+TEST(X8_LUT__SCALAR_X4, n_eq_4) {
+  LUTMicrokernelTester()
+    .n(4)
+    .Test(xnn_x8_lut_ukernel__scalar_x4);
+}
+
+TEST(X8_LUT__SCALAR_X4, n_div_4) {
+  for (size_t n = 8; n < 40; n += 4) {
+    LUTMicrokernelTester()
+      .n(n)
+      .Test(xnn_x8_lut_ukernel__scalar_x4);
+  }
+}
+
+TEST(X8_LUT__SCALAR_X4, n_lt_4) {
+  for (size_t n = 1; n < 4; n++) {
+    LUTMicrokernelTester()
+      .n(n)
+      .Test(xnn_x8_lut_ukernel__scalar_x4);
+  }
+}
+
+TEST(X8_LUT__SCALAR_X4, n_gt_4) {
+  for (size_t n = 5; n < 8; n++) {
+    LUTMicrokernelTester()
+      .n(n)
+      .Test(xnn_x8_lut_ukernel__scalar_x4);
+  }
+}
+
+TEST(X8_LUT__SCALAR_X4, inplace) {
+  for (size_t n = 1; n <= 20; n += 3) {
     LUTMicrokernelTester()
       .n(n)
       .inplace(true)
-      .Test(xnn_x8_lut_ukernel__scalar);
+      .Test(xnn_x8_lut_ukernel__scalar_x4);
   }
 }
+
+TEST(X8_LUT__SCALAR_X8, n_eq_8) {
+  LUTMicrokernelTester()
+    .n(8)
+    .Test(xnn_x8_lut_ukernel__scalar_x8);
+}
+
+TEST(X8_LUT__SCALAR_X8, n_div_8) {
+  for (size_t n = 16; n < 80; n += 8) {
+    LUTMicrokernelTester()
+      .n(n)
+      .Test(xnn_x8_lut_ukernel__scalar_x8);
+  }
+}
+
+TEST(X8_LUT__SCALAR_X8, n_lt_8) {
+  for (size_t n = 1; n < 8; n++) {
+    LUTMicrokernelTester()
+      .n(n)
+      .Test(xnn_x8_lut_ukernel__scalar_x8);
+  }
+}
+
+TEST(X8_LUT__SCALAR_X8, n_gt_8) {
+  for (size_t n = 9; n < 16; n++) {
+    LUTMicrokernelTester()
+      .n(n)
+      .Test(xnn_x8_lut_ukernel__scalar_x8);
+  }
+}
+
+TEST(X8_LUT__SCALAR_X8, inplace) {
+  for (size_t n = 1; n <= 40; n += 7) {
+    LUTMicrokernelTester()
+      .n(n)
+      .inplace(true)
+      .Test(xnn_x8_lut_ukernel__scalar_x8);
+  }
+}
+
+TEST(X8_LUT__SCALAR_X16, n_eq_16) {
+  LUTMicrokernelTester()
+    .n(16)
+    .Test(xnn_x8_lut_ukernel__scalar_x16);
+}
+
+TEST(X8_LUT__SCALAR_X16, n_div_16) {
+  for (size_t n = 32; n < 160; n += 16) {
+    LUTMicrokernelTester()
+      .n(n)
+      .Test(xnn_x8_lut_ukernel__scalar_x16);
+  }
+}
+
+TEST(X8_LUT__SCALAR_X16, n_lt_16) {
+  for (size_t n = 1; n < 16; n++) {
+    LUTMicrokernelTester()
+      .n(n)
+      .Test(xnn_x8_lut_ukernel__scalar_x16);
+  }
+}
+
+TEST(X8_LUT__SCALAR_X16, n_gt_16) {
+  for (size_t n = 17; n < 32; n++) {
+    LUTMicrokernelTester()
+      .n(n)
+      .Test(xnn_x8_lut_ukernel__scalar_x16);
+  }
+}
+
+TEST(X8_LUT__SCALAR_X16, inplace) {
+  for (size_t n = 1; n <= 80; n += 15) {
+    LUTMicrokernelTester()
+      .n(n)
+      .inplace(true)
+      .Test(xnn_x8_lut_ukernel__scalar_x16);
+  }
+}
\ No newline at end of file
@@ -30,10 +30,16 @@ def split_ukernel_name(name):
   common_name, target_name = name.split("__", 1)
   common_parts = common_name.split("_")
   param_spec = common_parts[-1]
-  assert param_spec.startswith("up")
-  cr, kr = map(int, param_spec[2:].split("x"))
+  if param_spec.startswith("up"):
+    cr, kr = map(int, param_spec[2:].split("x"))
+    qr = 0
+  else:
+    assert param_spec.startswith("mp")
+    cr, tile_spec = param_spec[2:].split("x")
+    kr, qr = map(int, tile_spec.split("p"))
+    cr = int(cr)
   arch, isa = xnncommon.parse_target_name(target_name)
-  return cr, kr, arch, isa
+  return cr, kr, qr, arch, isa
 
 
 DWCONV_TEST_CODE = """\
@@ -282,13 +288,230 @@ TEST(${TEST_NAME}, zero) {
 }
 """
 
-def generate_test_cases(ukernel, cr, kr, c_block, is_pipelined, isa):
+DWCONV_MULTIPASS_TEST_CODE = """\
+TEST(${TEST_NAME}, c_eq_${CBLOCK}) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (uint32_t kernel_size = ${KR + 1}; kernel_size <= ${KR + 2 * QR + 1}; kernel_size++) {
+    DWConvMicrokernelTester()
+      .cr(${CR})
+      .primary_tile(${KR})
+      .incremental_tile(${QR})
+      .kr(kernel_size)
+      .channels(${CBLOCK})
+      .Test(${", ".join(TEST_ARGS)});
+  }
+}
+
+$if CBLOCK > 1:
+  TEST(${TEST_NAME}, c_div_${CBLOCK}) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (uint32_t kernel_size = ${KR + 1}; kernel_size <= ${KR + 2 * QR + 1}; kernel_size++) {
+      for (uint32_t channels = ${CBLOCK * 2}; channels < ${CR * 16}; channels += ${CR * 3}) {
+        DWConvMicrokernelTester()
+          .cr(${CR})
+          .primary_tile(${KR})
+          .incremental_tile(${QR})
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(${", ".join(TEST_ARGS)});
+      }
+    }
+  }
+
+  TEST(${TEST_NAME}, c_lt_${CBLOCK}) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (uint32_t kernel_size = ${KR + 1}; kernel_size <= ${KR + 2 * QR + 1}; kernel_size++) {
+      for (uint32_t channels = 1; channels < ${CBLOCK}; channels++) {
+        DWConvMicrokernelTester()
+          .cr(${CR})
+          .primary_tile(${KR})
+          .incremental_tile(${QR})
+          .kr(kernel_size)
+          .channels(channels)
+          .Test(${", ".join(TEST_ARGS)});
+      }
+    }
+  }
+
+TEST(${TEST_NAME}, c_gt_${CBLOCK}) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (uint32_t kernel_size = ${KR + 1}; kernel_size <= ${KR + 2 * QR + 1}; kernel_size++) {
+    for (uint32_t channels = ${CBLOCK + 1}; channels < ${10 if CBLOCK == 1 else CBLOCK * 2}; channels++) {
+      DWConvMicrokernelTester()
+        .cr(${CR})
+        .primary_tile(${KR})
+        .incremental_tile(${QR})
+        .kr(kernel_size)
+        .channels(channels)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+}
+
+$if ACTIVATION == "MINMAX":
+  TEST(${TEST_NAME}, c_gt_${CBLOCK}_with_qmin) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (uint32_t channels = ${CBLOCK + 1}; channels < ${10 if CBLOCK == 1 else CBLOCK * 2}; channels++) {
+      DWConvMicrokernelTester()
+        .cr(${CR})
+        .primary_tile(${KR})
+        .incremental_tile(${QR})
+        .kr(${KR + QR + 1})
+        .channels(channels)
+        .qmin(128)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+  TEST(${TEST_NAME}, c_gt_${CBLOCK}_with_qmax) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (uint32_t channels = ${CBLOCK + 1}; channels < ${10 if CBLOCK == 1 else CBLOCK * 2}; channels++) {
+      DWConvMicrokernelTester()
+        .cr(${CR})
+        .primary_tile(${KR})
+        .incremental_tile(${QR})
+        .kr(${KR + QR + 1})
+        .channels(channels)
+        .qmax(128)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+TEST(${TEST_NAME}, multipixel) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (uint32_t kernel_size = ${KR + 1}; kernel_size <= ${KR + 2 * QR + 1}; kernel_size += ${QR - 1}) {
+    for (size_t channels = 1; channels <= ${CBLOCK * 5}; channels += ${max(1, CBLOCK - 1)}) {
+      DWConvMicrokernelTester()
+        .cr(${CR})
+        .primary_tile(${KR})
+        .incremental_tile(${QR})
+        .kr(kernel_size)
+        .channels(channels)
+        .width(3)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+}
+
+TEST(${TEST_NAME}, multipixel_with_step) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (size_t channels = 1; channels <= ${CBLOCK * 5}; channels += ${max(1, CBLOCK - 1)}) {
+    for (size_t step = 2; step <= ${KR + QR + 1}; step++) {
+      DWConvMicrokernelTester()
+        .cr(${CR})
+        .primary_tile(${KR})
+        .incremental_tile(${QR})
+        .kr(${KR + QR + 1})
+        .channels(channels)
+        .width(3)
+        .step(step)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+}
+
+TEST(${TEST_NAME}, multipixel_with_output_stride) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (size_t channels = 1; channels <= ${CBLOCK * 5}; channels += ${max(1, CBLOCK - 1)}) {
+    DWConvMicrokernelTester()
+      .cr(${CR})
+      .primary_tile(${KR})
+      .incremental_tile(${QR})
+      .kr(${KR + QR + 1})
+      .channels(${CR})
+      .width(5)
+      .output_stride(${next_prime(CR * 5 + 1)})
+      .Test(${", ".join(TEST_ARGS)});
+  }
+}
+
+$if ACTIVATION == "MINMAX":
+  TEST(${TEST_NAME}, multipixel_with_qmin) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t channels = 1; channels <= ${CBLOCK * 5}; channels += ${max(1, CBLOCK - 1)}) {
+      DWConvMicrokernelTester()
+        .cr(${CR})
+        .primary_tile(${KR})
+        .incremental_tile(${QR})
+        .kr(${KR + QR + 1})
+        .channels(channels)
+        .width(3)
+        .qmin(128)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+  TEST(${TEST_NAME}, multipixel_with_qmax) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t channels = 1; channels <= ${CBLOCK * 5}; channels += ${max(1, CBLOCK - 1)}) {
+      DWConvMicrokernelTester()
+        .cr(${CR})
+        .primary_tile(${KR})
+        .incremental_tile(${QR})
+        .kr(${KR + QR + 1})
+        .channels(channels)
+        .width(3)
+        .qmax(128)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+TEST(${TEST_NAME}, input_offset) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (uint32_t channels = ${CBLOCK * 2}; channels < ${CR * 16}; channels += ${CR * 3}) {
+    DWConvMicrokernelTester()
+      .cr(${CR})
+      .primary_tile(${KR})
+      .incremental_tile(${QR})
+      .kr(${KR + QR + 1})
+      .channels(channels)
+      .input_offset(${next_prime(CR + 1) * 16})
+      .Test(${", ".join(TEST_ARGS)});
+  }
+}
+
+TEST(${TEST_NAME}, zero) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (uint32_t mz = 0; mz < ${KR + QR + 1}; mz++) {
+    for (uint32_t channels = ${CBLOCK * 2}; channels < ${CR * 16}; channels += ${CR * 3}) {
+      DWConvMicrokernelTester()
+        .cr(${CR})
+        .primary_tile(${KR})
+        .incremental_tile(${QR})
+        .kr(${KR + QR + 1})
+        .channels(channels)
+        .input_offset(${next_prime(CR + 1) * 16})
+        .zero_index(mz)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+}
+"""
+
+
+def generate_test_cases(ukernel, cr, kr, qr, c_block, is_pipelined, isa):
   """Generates all tests cases for a DWCONV micro-kernel.
 
   Args:
     ukernel: C name of the micro-kernel function.
     cr: CR parameter of the DWCONV micro-kernel.
-    kr: KR parameter of the DWCONV micro-kernel.
+    kr: KR parameter of the DWCONV micro-kernel (primary tile of a multipass
+        micro-kernel).
+    qr: incremental tile of a multipass DWCONV micro-kernel, or 0 for a
+        unipass micro-kernel.
     k_block: Number of C values processed per one iteration of the main loop of
              the micro-kernel.
     is_pipelined: Indicates if the micro-kernel is implemented with software
@@ -308,7 +531,7 @@ def generate_test_cases(ukernel, cr, kr, c_block, is_pipelined, isa):
   test_args = [ukernel]
   if activation != "linear" and not isa:
     test_args.append("DWConvMicrokernelTester::Variant::Scalar")
-  return xngen.preprocess(DWCONV_TEST_CODE, {
+  return xngen.preprocess(DWCONV_MULTIPASS_TEST_CODE if qr != 0 else DWCONV_TEST_CODE, {
       "TEST_NAME": test_name.upper().replace("UKERNEL_", ""),
       "TEST_ARGS": test_args,
       "UKERNEL_TYPE": ukernel_type.upper(),
@@ -316,6 +539,7 @@ def generate_test_cases(ukernel, cr, kr, c_block, is_pipelined, isa):
       "ACTIVATION": activation.upper(),
       "CR": cr,
       "KR": kr,
+      "QR": qr,
       "CBLOCK": c_block,
       "ADJCBLOCK": 2 * c_block if is_pipelined else c_block,
       "IS_PIPELINED": is_pipelined,
@@ -360,12 +584,12 @@ def main(args):
       name = ukernel_spec["name"]
       pipelined = bool(ukernel_spec.get("pipelined", False))
       assembly = bool(ukernel_spec.get("assembly", False))
-      cr, kr, arch, isa = split_ukernel_name(name)
+      cr, kr, qr, arch, isa = split_ukernel_name(name)
 
       # specification can override architecture
       arch = ukernel_spec.get("arch", arch)
 
-      test_case = generate_test_cases(name, cr, kr, cr, pipelined, isa)
+      test_case = generate_test_cases(name, cr, kr, qr, cr, pipelined, isa)
       tests += "\n\n" + xnncommon.postprocess_test_case(test_case, arch, isa, assembly)
 
     with codecs.open(options.output, "w", encoding="utf-8") as output_file:
@@ -781,7 +781,12 @@ def generate_test_cases(ukernel, mr, nr, kr, sr,
     Code for the test case.
   """
   _, test_name = ukernel.split("_", 1)
-  _, datatype, ukernel_type, activation, _ = ukernel.split("_", 4)
+  if ukernel.startswith("xnn_qd8_f32_qc8w_"):
+    # Micro-kernels with dynamically quantized inputs spell out the input, output, and weights datatypes.
+    datatype = "qd8_f32_qc8w"
+    ukernel_type, activation, _ = ukernel[len("xnn_qd8_f32_qc8w_"):].split("_", 2)
+  else:
+    _, datatype, ukernel_type, activation, _ = ukernel.split("_", 4)
   if activation == "ukernel":
     activation = "linear"
   test_args = [ukernel]
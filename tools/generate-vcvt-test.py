@@ -0,0 +1,244 @@
+#!/usr/bin/env python
+# Copyright 2020 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+import argparse
+import codecs
+import math
+import os
+import re
+import sys
+import yaml
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import xngen
+import xnncommon
+
+
+parser = argparse.ArgumentParser(
+  description='Vector conversion operation microkernel test generator')
+parser.add_argument("-s", "--spec", metavar="FILE", required=True,
+                    help="Specification (YAML) file")
+parser.add_argument("-o", "--output", metavar="FILE", required=True,
+                    help='Output (C++ source) file')
+parser.set_defaults(defines=list())
+
+
+def split_ukernel_name(name):
+  match = re.match(r"^xnn_(f16_f32|f32_f16|f32_qs8|qs8_f32)_vcvt_ukernel__(.+)_x(\d+)$", name)
+  if match is None:
+    raise ValueError("Unexpected microkernel name: " + name)
+  input_datatype, output_datatype = match.group(1).split("_")
+  batch_tile = int(match.group(3))
+
+  arch, isa = xnncommon.parse_target_name(target_name=match.group(2))
+  return input_datatype, output_datatype, batch_tile, arch, isa
+
+
+CVT_TEST_TEMPLATE = """\
+TEST(${TEST_NAME}, batch_eq_${BATCH_TILE}) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  VCvtMicrokernelTester()
+    .batch_size(${BATCH_TILE})
+    .Test(${", ".join(TEST_ARGS)});
+}
+
+$if BATCH_TILE > 1:
+  TEST(${TEST_NAME}, batch_div_${BATCH_TILE}) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t batch_size = ${BATCH_TILE*2}; batch_size < ${BATCH_TILE*10}; batch_size += ${BATCH_TILE}) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+  TEST(${TEST_NAME}, batch_lt_${BATCH_TILE}) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t batch_size = 1; batch_size < ${BATCH_TILE}; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+TEST(${TEST_NAME}, batch_gt_${BATCH_TILE}) {
+  $if ISA_CHECK:
+    ${ISA_CHECK};
+  for (size_t batch_size = ${BATCH_TILE+1}; batch_size < ${10 if BATCH_TILE == 1 else BATCH_TILE*2}; batch_size++) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(${", ".join(TEST_ARGS)});
+  }
+}
+
+$if INPUT_DATATYPE == "f16":
+  TEST(${TEST_NAME}, large_inputs) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t batch_size = 1; batch_size <= ${BATCH_TILE*5}; batch_size += ${max(1, BATCH_TILE-1)}) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-65504.0f)
+        .input_max(65504.0f)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+$if OUTPUT_DATATYPE == "f16":
+  TEST(${TEST_NAME}, large_inputs) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t batch_size = 1; batch_size <= ${BATCH_TILE*5}; batch_size += ${max(1, BATCH_TILE-1)}) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .input_min(-100000.0f)
+        .input_max(100000.0f)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+$if "qs8" in (INPUT_DATATYPE, OUTPUT_DATATYPE):
+  TEST(${TEST_NAME}, scale) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t batch_size = 1; batch_size <= ${BATCH_TILE*5}; batch_size += ${max(1, BATCH_TILE-1)}) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .scale(50)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+  TEST(${TEST_NAME}, zero_point) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (int16_t zero_point = -128; zero_point < 128; zero_point += 51) {
+      for (size_t batch_size = 1; batch_size <= ${BATCH_TILE*5}; batch_size += ${max(1, BATCH_TILE-1)}) {
+        VCvtMicrokernelTester()
+          .batch_size(batch_size)
+          .zero_point(zero_point)
+          .scale(500)
+          .Test(${", ".join(TEST_ARGS)});
+      }
+    }
+  }
+
+$if OUTPUT_DATATYPE == "qs8":
+  TEST(${TEST_NAME}, saturation) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t batch_size = 1; batch_size <= ${BATCH_TILE*5}; batch_size += ${max(1, BATCH_TILE-1)}) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .scale(500)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+  TEST(${TEST_NAME}, qmin) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (int16_t qmin = -128; qmin < 127; qmin += 51) {
+      for (size_t batch_size = 1; batch_size <= ${BATCH_TILE*5}; batch_size += ${max(1, BATCH_TILE-1)}) {
+        VCvtMicrokernelTester()
+          .batch_size(batch_size)
+          .qmin(qmin)
+          .Test(${", ".join(TEST_ARGS)});
+      }
+    }
+  }
+
+  TEST(${TEST_NAME}, qmax) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (int16_t qmax = -127; qmax <= 127; qmax += 51) {
+      for (size_t batch_size = 1; batch_size <= ${BATCH_TILE*5}; batch_size += ${max(1, BATCH_TILE-1)}) {
+        VCvtMicrokernelTester()
+          .batch_size(batch_size)
+          .qmax(qmax)
+          .Test(${", ".join(TEST_ARGS)});
+      }
+    }
+  }
+"""
+
+
+def generate_test_cases(ukernel, input_datatype, output_datatype, batch_tile, isa):
+  """Generates all tests cases for a Vector Convert Operation micro-kernel.
+
+  Args:
+    ukernel: C name of the micro-kernel function.
+    input_datatype: input conversion data type.
+    output_datatype: output conversion data type.
+    batch_tile: Number of batch elements processed per one iteration of the
+                inner loop of the micro-kernel.
+    isa: instruction set required to run the micro-kernel. Generated unit test
+         will skip execution if the host processor doesn't support this ISA.
+
+  Returns:
+    Code for the test case.
+  """
+  _, test_name = ukernel.split("_", 1)
+  test_args = [ukernel]
+  if not isa and "qs8" in (input_datatype, output_datatype):
+    test_args.append("VCvtMicrokernelTester::Variant::Scalar")
+  return xngen.preprocess(CVT_TEST_TEMPLATE, {
+      "TEST_NAME": test_name.upper().replace("UKERNEL_", ""),
+      "TEST_ARGS": test_args,
+      "BATCH_TILE": batch_tile,
+      "INPUT_DATATYPE": input_datatype,
+      "OUTPUT_DATATYPE": output_datatype,
+      "ISA_CHECK": xnncommon.generate_isa_check_macro(isa),
+    })
+
+
+def main(args):
+  options = parser.parse_args(args)
+
+  with codecs.open(options.spec, "r", encoding="utf-8") as spec_file:
+    spec_yaml = yaml.safe_load(spec_file)
+    if not isinstance(spec_yaml, list):
+      raise ValueError("expected a list of micro-kernels in the spec")
+
+    tests = """\
+// Copyright 2020 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: {specification}
+//   Generator: {generator}
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/vcvt.h>
+#include "vcvt-microkernel-tester.h"
+""".format(specification=options.spec, generator=sys.argv[0])
+
+    for ukernel_spec in spec_yaml:
+      name = ukernel_spec["name"]
+      input_datatype, output_datatype, batch_tile, arch, isa = split_ukernel_name(name)
+
+      # specification can override architecture
+      arch = ukernel_spec.get("arch", arch)
+
+      test_case = generate_test_cases(name, input_datatype, output_datatype, batch_tile, isa)
+      tests += "\n\n" + xnncommon.postprocess_test_case(test_case, arch, isa)
+
+    with codecs.open(options.output, "w", encoding="utf-8") as output_file:
+      output_file.write(tests)
+
+
+if __name__ == "__main__":
+  main(sys.argv[1:])
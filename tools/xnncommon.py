@@ -40,11 +40,13 @@ _ISA_TO_ARCH_MAP = {
   "ssse3": ["x86-32", "x86-64"],
   "sse41": ["x86-32", "x86-64"],
   "avx": ["x86-32", "x86-64"],
+  "f16c": ["x86-32", "x86-64"],
   "xop": ["x86-32", "x86-64"],
   "fma3": ["x86-32", "x86-64"],
   "avx2": ["x86-32", "x86-64"],
   "avx512f": ["x86-32", "x86-64"],
   "avx512skx": ["x86-32", "x86-64"],
+  "avx512vbmi": ["x86-32", "x86-64"],
   "wasm32": ["wasm", "wasmsimd"],
   "wasm": ["wasm", "wasmsimd"],
   "wasmsimd": ["wasmsimd"],
@@ -61,11 +63,13 @@ _ISA_TO_CHECK_MAP = {
   "ssse3": "TEST_REQUIRES_X86_SSSE3",
   "sse41": "TEST_REQUIRES_X86_SSE41",
   "avx": "TEST_REQUIRES_X86_AVX",
+  "f16c": "TEST_REQUIRES_X86_F16C",
   "xop": "TEST_REQUIRES_X86_XOP",
   "avx2": "TEST_REQUIRES_X86_AVX2",
   "fma3": "TEST_REQUIRES_X86_FMA3",
   "avx512f": "TEST_REQUIRES_X86_AVX512F",
   "avx512skx": "TEST_REQUIRES_X86_AVX512SKX",
+  "avx512vbmi": "TEST_REQUIRES_X86_AVX512VBMI",
 }
 
 